@@ -19,39 +19,91 @@ HEADERS  += \
     src/include/win_inttypes.h \
     src/include/win_stdint.h \
     src/qc/dm.h \
+    src/qc/dm_capture.h \
+    src/qc/dm_capture_decoder.h \
+    src/qc/dm_client.h \
+    src/qc/dm_efs_backup.h \
+    src/qc/dm_efs_file_reader.h \
+    src/qc/dm_efs_file_writer.h \
+    src/qc/dm_efs_tree.h \
+    src/qc/dm_memory_reader.h \
     src/qc/dm_nv.h \
     src/qc/dm_efs.h \
     src/qc/dm_efs_manager.h \
     src/qc/dm_efs_node.h \
     src/qc/dm_nv.h \
     src/qc/dload.h \
+    src/qc/dm_nv_backup.h \
+    src/qc/dm_nv_batch_writer.h \
+    src/qc/dm_nv_bulk_reader.h \
+    src/qc/dm_nv_catalogue.h \
+    src/qc/dm_nv_sparsity_map.h \
+    src/qc/dm_scheduler.h \
     src/qc/hdlc.h \
+    src/qc/hdlc_frame_template.h \
     src/qc/mbn.h \
     src/qc/qcdm_nv_responses.h \
     src/qc/qcdm_packet_types.h \
     src/qc/sahara.h \
     src/qc/streaming_dload.h \
+    src/qc/streaming_dload_flash_plan.h \
+    src/qc/streaming_dload_write_verifier.h \
     src/serial/hdlc_serial.h \
     src/serial/qcdm_serial.h \
     src/serial/sahara_serial.h \
     src/serial/streaming_dload_serial.h \
+    src/util/block_manifest.h \
+    src/util/byte_ring.h \
     src/util/convert.h \
     src/util/endian.h \
+    src/util/gpt.h \
     src/util/hexdump.h \
-    src/util/sleep.h 
+    src/util/md5.h \
+    src/util/nand_ecc.h \
+    src/util/nand_ecc_pipeline.h \
+    src/util/rtt_estimator.h \
+    src/util/sleep.h \
+    src/util/transfer_journal.h \
+    src/util/xxhash.h 
 
 SOURCES += \
+    src/qc/dm_capture.cpp \
+    src/qc/dm_capture_decoder.cpp \
+    src/qc/dm_client.cpp \
+    src/qc/dm_efs_backup.cpp \
+    src/qc/dm_efs_file_reader.cpp \
+    src/qc/dm_efs_file_writer.cpp \
     src/qc/dm_efs_manager.cpp \
     src/qc/dm_efs_node.cpp \
+    src/qc/dm_efs_tree.cpp \
+    src/qc/dm_memory_reader.cpp \
+    src/qc/dm_nv_backup.cpp \
+    src/qc/dm_nv_batch_writer.cpp \
+    src/qc/dm_nv_bulk_reader.cpp \
+    src/qc/dm_nv_catalogue.cpp \
+    src/qc/dm_nv_sparsity_map.cpp \
+    src/qc/dm_scheduler.cpp \
     src/qc/hdlc.cpp \
+    src/qc/hdlc_frame_template.cpp \
+    src/qc/streaming_dload_flash_plan.cpp \
+    src/qc/streaming_dload_write_verifier.cpp \
     src/serial/hdlc_serial.cpp \
     src/serial/qcdm_serial.cpp \
     src/serial/sahara_serial.cpp \
     src/serial/streaming_dload_serial.cpp \
+    src/util/block_manifest.cpp \
+    src/util/byte_ring.cpp \
     src/util/convert.cpp \
     src/util/endian.cpp \
+    src/util/gpt.cpp \
     src/util/hexdump.cpp \
-    src/util/sleep.cpp 
+    src/util/md5.cpp \
+    src/util/nand_ecc.cpp \
+    src/util/nand_ecc_pipeline.cpp \
+    src/util/rtt_estimator.cpp \
+    src/util/sleep.cpp \
+    src/util/transfer_journal.cpp \
+    src/util/xxhash.cpp 
 
 win32:CONFIG(release, debug|release): LIBS += -L$$OUT_PWD/release/ -lserial
 else:win32:CONFIG(debug, debug|release): LIBS += -L$$OUT_PWD/debug/ -lserial
@@ -2,7 +2,7 @@
 # PLACEHOLDER
 #-------------------------------------------------
 
-QT += core gui xml
+QT += core gui
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
@@ -23,26 +23,34 @@ SOURCES += \
     src/gui/application.cpp \
     src/gui/qcdm_window.cpp \
     src/gui/about_dialog.cpp \
+    src/gui/nv_item_list_model.cpp \
     src/worker/qcdm_efs_directory_tree_worker.cpp \
     src/worker/qcdm_efs_file_read_worker.cpp \
+    src/worker/qcdm_efs_backup_worker.cpp \
     src/worker/qcdm_efs_file_write_worker.cpp \
     src/worker/qcdm_memory_read_worker.cpp \
     src/worker/qcdm_prl_read_worker.cpp \
     src/worker/qcdm_prl_write_worker.cpp \
     src/worker/qcdm_nv_item_read_worker.cpp \
+    src/worker/qcdm_nv_item_write_worker.cpp \
+    src/worker/qcdm_capture_worker.cpp \
     src/qcdm.cpp
 
 HEADERS  += \
     src/util/hexdump.h \
     src/gui/qcdm_window.h \
     src/gui/about_dialog.h \
+    src/gui/nv_item_list_model.h \
     src/worker/qcdm_efs_directory_tree_worker.h \
     src/worker/qcdm_efs_file_read_worker.h \
+    src/worker/qcdm_efs_backup_worker.h \
     src/worker/qcdm_efs_file_write_worker.h \
     src/worker/qcdm_memory_read_worker.h \
     src/worker/qcdm_prl_read_worker.h \
     src/worker/qcdm_prl_write_worker.h \
     src/worker/qcdm_nv_item_read_worker.h \
+    src/worker/qcdm_nv_item_write_worker.h \
+    src/worker/qcdm_capture_worker.h \
     src/gui/application.h 
 
 
@@ -23,6 +23,9 @@ SOURCES += \
     src/gui/streaming_dload_window.cpp \
     src/worker/streaming_dload_read_worker.cpp \
     src/worker/streaming_dload_stream_write_worker.cpp \
+    src/worker/streaming_dload_flash_worker.cpp \
+    src/worker/streaming_dload_emmc_backup_worker.cpp \
+    src/worker/streaming_dload_nand_read_worker.cpp \
     src/gui/application.cpp \
     src/streaming_dload.cpp
 
@@ -32,6 +35,9 @@ HEADERS  += \
     src/gui/streaming_dload_window.h \
     src/worker/streaming_dload_read_worker.h \
     src/worker/streaming_dload_stream_write_worker.h \
+    src/worker/streaming_dload_flash_worker.h \
+    src/worker/streaming_dload_emmc_backup_worker.h \
+    src/worker/streaming_dload_nand_read_worker.h \
     src/gui/application.h
 
 
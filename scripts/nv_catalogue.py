@@ -0,0 +1,135 @@
+#!/usr/bin/env python
+#
+# Regenerates src/qc/dm_nv_catalogue_hash.h from src/qc/dm_nv_items.def
+#
+# The header holds a minimal perfect hash of the item names (hash and
+# displace). Run this after adding or renaming items in dm_nv_items.def.
+#
+# usage: python scripts/nv_catalogue.py
+
+import os
+import re
+import sys
+
+root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+defPath = os.path.join(root, "src", "qc", "dm_nv_items.def")
+outPath = os.path.join(root, "src", "qc", "dm_nv_catalogue_hash.h")
+
+ITEMS_PER_BUCKET = 4
+MAX_DISPLACEMENT = 0xFFFF
+
+# must match DmNvCatalogue::hashName
+def hashName(name, seed):
+	h = (2166136261 ^ ((seed * 0x9E3779B9) & 0xFFFFFFFF)) & 0xFFFFFFFF
+	for c in name.encode("ascii"):
+		h ^= c
+		h = (h * 16777619) & 0xFFFFFFFF
+	h ^= h >> 15
+	return h
+
+def readItems():
+	items = []
+	with open(defPath) as f:
+		for line in f:
+			m = re.match(r"^NV_ITEM(?:_EX)?\((\w+),\s*(\d+)", line)
+			if m:
+				items.append((m.group(1), int(m.group(2))))
+
+	ids = [i[1] for i in items]
+
+	if ids != sorted(ids) or len(set(ids)) != len(ids):
+		sys.exit("dm_nv_items.def must be sorted by id without duplicates")
+
+	return items
+
+def build(names):
+	count = len(names)
+	bucketCount = (count + ITEMS_PER_BUCKET - 1) // ITEMS_PER_BUCKET
+	buckets = [[] for i in range(bucketCount)]
+
+	for index, name in enumerate(names):
+		buckets[hashName(name, 0) % bucketCount].append(index)
+
+	displacements = [0] * bucketCount
+	slots = [None] * count
+
+	# largest buckets first while there is the most room
+	for bucket in sorted(range(bucketCount), key=lambda b: -len(buckets[b])):
+		members = buckets[bucket]
+
+		if not members:
+			continue
+
+		for d in range(1, MAX_DISPLACEMENT + 1):
+			taken = [hashName(names[i], d) % count for i in members]
+
+			if len(set(taken)) == len(taken) and all(slots[s] is None for s in taken):
+				break
+		else:
+			sys.exit("No displacement found for bucket %d" % bucket)
+
+		displacements[bucket] = d
+
+		for i, s in zip(members, taken):
+			slots[s] = i
+
+	return displacements, slots
+
+# must match checksumItems in dm_nv_catalogue.cpp, covers the ids, the names and their order
+def checksum(items, low, high):
+	if high - low == 1:
+		h = 2166136261 ^ items[low][1]
+		for c in items[low][0].encode("ascii"):
+			h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+		return h
+
+	mid = low + (high - low) // 2
+
+	return ((checksum(items, low, mid) * 16777619) & 0xFFFFFFFF) ^ checksum(items, mid, high)
+
+def table(values, perLine):
+	lines = []
+	for i in range(0, len(values), perLine):
+		lines.append("    " + ", ".join(str(v) for v in values[i:i + perLine]) + ",")
+	return "\n".join(lines)
+
+items = readItems()
+names = [i[0] for i in items]
+displacements, slots = build(names)
+
+with open(outPath, "w") as f:
+	f.write("""/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_nv_catalogue_hash.h
+* @package OpenPST
+* @brief Minimal perfect hash of the NV item names in dm_nv_items.def
+*
+* Generated by scripts/nv_catalogue.py, do not edit.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_NV_CATALOGUE_HASH_H_
+#define _QC_DM_NV_CATALOGUE_HASH_H_
+
+#define DM_NV_CATALOGUE_HASH_ITEMS   %d
+#define DM_NV_CATALOGUE_HASH_BUCKETS %d
+
+// of the ids and names the tables below were built from
+#define DM_NV_CATALOGUE_HASH_CHECKSUM 0x%08X
+
+// per bucket seed, bucket = hashName(name, 0) %% DM_NV_CATALOGUE_HASH_BUCKETS
+static const uint16_t dmNvCatalogueHashDisplacements[DM_NV_CATALOGUE_HASH_BUCKETS] = {
+%s
+};
+
+// catalogue index of each slot, slot = hashName(name, displacement) %% DM_NV_CATALOGUE_HASH_ITEMS
+static const uint16_t dmNvCatalogueHashSlots[DM_NV_CATALOGUE_HASH_ITEMS] = {
+%s
+};
+
+#endif // _QC_DM_NV_CATALOGUE_HASH_H_
+""" % (len(names), len(displacements), checksum(items, 0, len(items)), table(displacements, 16), table(slots, 16)))
+
+print("%d items, %d buckets, max displacement %d" % (len(names), len(displacements), max(displacements)))
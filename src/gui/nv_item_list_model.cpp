@@ -0,0 +1,48 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file nv_item_list_model.cpp
+* @class NvItemListModel
+* @package OpenPST
+* @brief List model over the NV item catalogue, rows are formatted as they are shown
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "nv_item_list_model.h"
+
+using namespace OpenPST;
+
+NvItemListModel::NvItemListModel(QObject *parent) :
+    QAbstractListModel(parent)
+{
+
+}
+
+NvItemListModel::~NvItemListModel()
+{
+
+}
+
+int NvItemListModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : (int)DmNvCatalogue::getCount();
+}
+
+QVariant NvItemListModel::data(const QModelIndex &index, int role) const
+{
+    const DmNvItemInfo* item = DmNvCatalogue::getItem(index.row());
+
+    if (!index.isValid() || item == nullptr) {
+        return QVariant();
+    }
+
+    switch (role) {
+        case Qt::DisplayRole:
+            return QString("Item #%1 - %2").arg(item->id).arg(item->name);
+        case ItemIdRole:
+            return item->id;
+    }
+
+    return QVariant();
+}
@@ -0,0 +1,38 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file nv_item_list_model.h
+* @class NvItemListModel
+* @package OpenPST
+* @brief List model over the NV item catalogue, rows are formatted as they are shown
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _GUI_NV_ITEM_LIST_MODEL_H
+#define _GUI_NV_ITEM_LIST_MODEL_H
+
+#include <QAbstractListModel>
+#include "qc/dm_nv_catalogue.h"
+
+namespace OpenPST {
+
+    class NvItemListModel : public QAbstractListModel
+    {
+        Q_OBJECT
+
+        public:
+            /**
+            * Role holding the item id of a row
+            */
+            static const int ItemIdRole = Qt::UserRole;
+
+            NvItemListModel(QObject *parent = 0);
+            ~NvItemListModel();
+
+            int rowCount(const QModelIndex &parent = QModelIndex()) const Q_DECL_OVERRIDE;
+            QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const Q_DECL_OVERRIDE;
+    };
+}
+
+#endif // _GUI_NV_ITEM_LIST_MODEL_H
@@ -21,8 +21,18 @@ QcdmWindow::QcdmWindow(QWidget *parent) :
     ui(new Ui::QcdmWindow),
     port("", 115200),
 	efsManager(port),
-	nvItemReadWorker(nullptr)
+	scheduler(port),
+	nvItemReadWorker(nullptr),
+	nvItemWriteWorker(nullptr),
+	efsBackupWorker(nullptr),
+	efsFileWriteWorker(nullptr),
+	captureWorker(nullptr),
+	memoryReadWorker(nullptr)
 {
+	QElapsedTimer openTimer;
+
+	openTimer.start();
+
     ui->setupUi(this);
 
     disableUI();
@@ -63,8 +73,10 @@ QcdmWindow::QcdmWindow(QWidget *parent) :
 	QObject::connect(ui->switchDloadModeButton, SIGNAL(clicked()), this, SLOT(switchToDload()));
 	
 	QObject::connect(ui->decSpcValue, SIGNAL(textChanged(QString)), this, SLOT(onSpcTextChanged(QString)));
+	QObject::connect(ui->nvCacheCheckbox, SIGNAL(toggled(bool)), this, SLOT(onNvCacheToggled(bool)));
 	
 	QObject::connect(ui->probeCommandsButton, SIGNAL(clicked()), this, SLOT(probeCommands()));
+	QObject::connect(ui->cancelButton, SIGNAL(clicked()), this, SLOT(cancelOperation()));
 	
 	// NV Tab Buttons
 	QObject::connect(ui->nvReadSelectionToLogButton, SIGNAL(clicked()), this, SLOT(nvReadSelectionToLog()));
@@ -73,6 +85,13 @@ QcdmWindow::QcdmWindow(QWidget *parent) :
 	QObject::connect(ui->nvReadRangeToLogButton, SIGNAL(clicked()), this, SLOT(nvReadRangeToLog()));
 	QObject::connect(ui->nvReadRangeToTextButton, SIGNAL(clicked()), this, SLOT(nvReadRangeToText()));
 	QObject::connect(ui->nvReadRangeToBinaryButton, SIGNAL(clicked()), this, SLOT(nvReadRangeToBinary()));
+	QObject::connect(ui->nvWriteFromTextButton, SIGNAL(clicked()), this, SLOT(nvWriteFromText()));
+	QObject::connect(ui->nvWriteFromBinaryButton, SIGNAL(clicked()), this, SLOT(nvWriteFromBinary()));
+
+	// Logs Tab Buttons
+	QObject::connect(ui->captureStartButton, SIGNAL(clicked()), this, SLOT(captureStart()));
+	QObject::connect(ui->captureStopButton, SIGNAL(clicked()), this, SLOT(captureStop()));
+	QObject::connect(ui->captureDecodeButton, SIGNAL(clicked()), this, SLOT(captureDecode()));
 
 
 	// EFS Browse Sub Tab
@@ -101,6 +120,9 @@ QcdmWindow::QcdmWindow(QWidget *parent) :
 	QObject::connect(ui->actionEfsMakeGoldenCopy, SIGNAL(triggered()), this, SLOT(efsMakeGoldenCopy()));
 	QObject::connect(ui->actionEfsFilesystemImage, SIGNAL(triggered()), this, SLOT(efsFilesystemImage()));
 
+	// Memory Action Menu
+	QObject::connect(ui->actionMemoryRead, SIGNAL(triggered()), this, SLOT(memoryRead()));
+
 	
 	// Help Action Menu
 	QObject::connect(ui->actionAbout, SIGNAL(triggered()), this, SLOT(About()));
@@ -119,21 +141,17 @@ QcdmWindow::QcdmWindow(QWidget *parent) :
 	qRegisterMetaType<QcdmPrlWriteWorkerRequest>("QcdmPrlWriteWorkerRequest");
 	qRegisterMetaType<QcdmNvItemReadWorkerRequest>("QcdmNvItemReadWorkerRequest");
 	qRegisterMetaType<QcdmNvItemReadWorkerResponse>("QcdmNvItemReadWorkerResponse");
+	qRegisterMetaType<QcdmNvItemWriteWorkerRequest>("QcdmNvItemWriteWorkerRequest");
+	qRegisterMetaType<QcdmEfsBackupWorkerRequest>("QcdmEfsBackupWorkerRequest");
+	qRegisterMetaType<QcdmCaptureWorkerRequest>("QcdmCaptureWorkerRequest");
 
-	// load nv item selection list
-	QFile nvItemXmlList(":/xml/nv_items.xml");
-	QDomDocument document;
-	document.setContent(&nvItemXmlList);
-	QDomNodeList nodes = document.elementsByTagName("NvItem");
-	QString tmp;
-	for (int i = 0; i < nodes.count(); i++){
-		QDomNode elm = nodes.at(i);
-		QDomElement e = elm.toElement();
-		QListWidgetItem* item = new QListWidgetItem(ui->nvReadSelectionList);
-		item->setText(tmp.sprintf("Item #%d - %s", e.attribute("id").toInt(), e.text().toStdString().c_str()));
-		item->setData(1, e.attribute("id").toInt());
-		ui->nvReadSelectionList->addItem(item);
-	}
+	ui->cancelButton->setEnabled(false);
+	ui->captureStopButton->setEnabled(false);
+
+	// rows are only formatted when they are shown
+	ui->nvReadSelectionList->setModel(new NvItemListModel(this));
+
+	LOGD("QcdmWindow ready in %lld ms\n", openTimer.elapsed());
 }
 
 /**
@@ -210,6 +228,11 @@ void QcdmWindow::connectPort()
 
         port.open();
 
+        // a reconnect may well be a different device
+        port.invalidateNvCache();
+
+        scheduler.start();
+
         ui->portConnectButton->setEnabled(false);
         ui->portDisconnectButton->setEnabled(true);
         ui->portListRefreshButton->setEnabled(false);
@@ -246,8 +269,12 @@ void QcdmWindow::disconnectPort()
         closeText.append(currentPort.port.c_str());
         log(kLogTypeInfo, closeText);
 
+        scheduler.stop();
+
         port.close();
 
+        port.invalidateNvCache();
+
         ui->portConnectButton->setEnabled(true);
         ui->portDisconnectButton->setEnabled(false);
         ui->portListRefreshButton->setEnabled(true);
@@ -266,6 +293,8 @@ void QcdmWindow::getVersionInfo()
 	uint16_t diagVersion;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		version = port.getVersion();
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -284,6 +313,7 @@ void QcdmWindow::getVersionInfo()
 	log(kLogTypeInfo, tmp.sprintf("Slot Cycle Index: %d", version.slotCycleIndex));
 
 	try {
+		DmSchedulerLease lease(scheduler);
 
 		diagVersion = port.getDiagVersion();
 
@@ -303,6 +333,8 @@ void QcdmWindow::getStatus()
 	QString tmp;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		status = port.getStatus();
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -331,6 +363,8 @@ void QcdmWindow::getGuid()
 	QString tmp;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		response = port.getGuid();
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -353,6 +387,8 @@ void QcdmWindow::sendSpc()
     }
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		valid = port.sendSpc(ui->sendSpcValue->text().toStdString());
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -379,6 +415,7 @@ void QcdmWindow::sendPassword()
     }
 
 	try {
+		DmSchedulerLease lease(scheduler);
 
 		if (port.sendPassword(ui->sendPasswordValue->text().toStdString())) {
 			log(kLogTypeInfo, "Password Accepted: " + ui->sendPasswordValue->text());
@@ -402,6 +439,8 @@ void QcdmWindow::setPhoneMode()
 	bool success;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		port.setPhoneMode(mode);
 
 	} catch (std::exception &e) {
@@ -421,6 +460,8 @@ void QcdmWindow::setPhoneMode()
 void QcdmWindow::switchToDload()
 {
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		port.switchToDload();
 
 	} catch (std::exception &e) {
@@ -448,6 +489,8 @@ void QcdmWindow::readMeid()
     }
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_MEID_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -498,6 +541,8 @@ void QcdmWindow::readImei() {
 	int i;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_UE_IMEI_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -526,16 +571,12 @@ void QcdmWindow::nvReadSelectionToLog()
 	}
 		
 	QcdmNvItemReadWorkerRequest request = {};
-	QList<QListWidgetItem*> selectedItems;
-	QListWidgetItem* item;
 	QString tmp; 
 
 	request.type = QcdmNvItemReadWorkerRequestTypeLog;
 
-	selectedItems = ui->nvReadSelectionList->selectedItems();
-
-	for (auto item : selectedItems) {
-		request.items.push_back(item->data(1).toInt());
+	for (auto index : ui->nvReadSelectionList->selectionModel()->selectedIndexes()) {
+		request.items.push_back(index.data(NvItemListModel::ItemIdRole).toInt());
 	}
 
 
@@ -560,17 +601,13 @@ void QcdmWindow::nvReadSelectionToText()
 	}
 
 	QcdmNvItemReadWorkerRequest request = {};
-	QList<QListWidgetItem*> selectedItems;
-	QListWidgetItem* item;
 	QString tmp;
 
 	request.type = QcdmNvItemReadWorkerRequestTypeText;
 	request.outFilePath = outPath.toStdString();
 
-	selectedItems = ui->nvReadSelectionList->selectedItems();
-
-	for (auto item : selectedItems) {
-		request.items.push_back(item->data(1).toInt());
+	for (auto index : ui->nvReadSelectionList->selectionModel()->selectedIndexes()) {
+		request.items.push_back(index.data(NvItemListModel::ItemIdRole).toInt());
 	}
 
 	return nvReadRequest(request);
@@ -595,17 +632,13 @@ void QcdmWindow::nvReadSelectionToBinary()
 	}
 
 	QcdmNvItemReadWorkerRequest request = {};
-	QList<QListWidgetItem*> selectedItems;
-	QListWidgetItem* item;
 	QString tmp;
 
 	request.type = QcdmNvItemReadWorkerRequestTypeBinary;
 	request.outFilePath = outPath.toStdString();
 
-	selectedItems = ui->nvReadSelectionList->selectedItems();
-
-	for (auto item : selectedItems) {
-		request.items.push_back(item->data(1).toInt());
+	for (auto index : ui->nvReadSelectionList->selectionModel()->selectedIndexes()) {
+		request.items.push_back(index.data(NvItemListModel::ItemIdRole).toInt());
 	}
 
 	return nvReadRequest(request);
@@ -730,7 +763,34 @@ void QcdmWindow::nvReadRangeToBinary()
 void QcdmWindow::nvReadRequest(QcdmNvItemReadWorkerRequest &request)
 {
 	QString tmp;
+	QcdmVersionResponse version;
+	DmNvSparsityMap sparsityMap;
 	
+	try {
+		DmSchedulerLease lease(scheduler);
+
+		version = port.getVersion();
+
+		request.model = DmNvSparsityMap::getModelKey(version);
+
+		QDir mapDir(QCoreApplication::applicationDirPath() + "/nvmap");
+
+		if (mapDir.mkpath(".")) {
+			request.sparsityMapPath = mapDir.filePath(QString::fromStdString(request.model) + ".nvmap").toStdString();
+		}
+	} catch (std::exception &e) {
+		log(kLogTypeWarning, "Could not identify the device model, NV items will not be skipped");
+	}
+
+	// an unchecked box sweeps everything and refreshes the map
+	if (request.sparsityMapPath.length() && ui->nvReadSkipInactiveCheckbox->isChecked() && sparsityMap.load(request.sparsityMapPath)) {
+		size_t skipped = sparsityMap.filter(request.items);
+
+		if (skipped) {
+			log(kLogTypeInfo, tmp.sprintf("Skipping %lu items known to be inactive on %s", skipped, request.model.c_str()));
+		}
+	}
+
 	ui->progressBar->reset();
 	ui->progressBar->setMaximum(request.items.size());
 	ui->progressBar->setMinimum(0);
@@ -738,14 +798,17 @@ void QcdmWindow::nvReadRequest(QcdmNvItemReadWorkerRequest &request)
 
 	ui->progressBarLabelRight->setText(tmp.sprintf("0 / %lu items", request.items.size()));
 
-	nvItemReadWorker = new QcdmNvItemReadWorker(port, request, this);
+	nvItemReadWorker = new QcdmNvItemReadWorker(port, scheduler, request, this);
 
 	connect(nvItemReadWorker, &QcdmNvItemReadWorker::update, this, &QcdmWindow::nvItemReadUpdate, Qt::QueuedConnection);
 	connect(nvItemReadWorker, &QcdmNvItemReadWorker::complete, this, &QcdmWindow::nvItemReadComplete);
 	connect(nvItemReadWorker, &QcdmNvItemReadWorker::error, this, &QcdmWindow::nvItemReadError);
 	connect(nvItemReadWorker, &QcdmNvItemReadWorker::finished, nvItemReadWorker, &QObject::deleteLater);
+	connect(nvItemReadWorker, &QcdmNvItemReadWorker::finished, this, &QcdmWindow::nvItemReadFinished);
 
-	disableUI();
+	// the read runs as a bulk job on the scheduler, the other tabs stay usable meanwhile
+	ui->tabNv->setEnabled(false);
+	ui->cancelButton->setEnabled(true);
 
 	nvItemReadWorker->start();
 }
@@ -761,7 +824,7 @@ void QcdmWindow::nvItemReadUpdate(QcdmNvItemReadWorkerResponse response)
 	ui->progressBarLabelRight->setText(tmp.sprintf("%lu / %lu items", ui->progressBar->value(), ui->progressBar->maximum()));
 	
 	if (response.type == QcdmNvItemReadWorkerRequestTypeLog) {
-		log(kLogTypeInfo, tmp.sprintf("===========\nItem %d - %s\n===========", response.item, ui->nvReadSelectionList->item(response.item)->text().toStdString().c_str()));
+		log(kLogTypeInfo, tmp.sprintf("===========\nItem %d - %s\n===========", response.item, DmNvCatalogue::getName(response.item)));
 		hexdump(response.data, DIAG_NV_ITEM_SIZE, result, true);
 		log(kLogTypeInfo, result);
 	}
@@ -772,8 +835,9 @@ void QcdmWindow::nvItemReadUpdate(QcdmNvItemReadWorkerResponse response)
 */
 void QcdmWindow::nvItemReadComplete(QcdmNvItemReadWorkerRequest request)
 {
-	nvItemReadWorker = nullptr;
-	enableUI();
+	QString tmp;
+
+	log(kLogTypeInfo, tmp.sprintf("Read of %lu items complete", request.items.size()));
 }
 
 /**
@@ -789,7 +853,7 @@ void QcdmWindow::nvItemReadError(QcdmNvItemReadWorkerRequest request, QString ms
 	
 
 	if (request.type == QcdmNvItemReadWorkerRequestTypeLog) {
-		log(kLogTypeError, tmp.sprintf("===========\nError Reading Item %d - %s\n===========", request.current, ui->nvReadSelectionList->item(request.current)->text().toStdString().c_str()));
+		log(kLogTypeError, tmp.sprintf("===========\nError Reading Item %d - %s\n===========", request.current, DmNvCatalogue::getName(request.current)));
 		log(kLogTypeError, msg);
 	} else {
 		log(kLogTypeError, tmp.sprintf("Error reading item %d: %s", request.current, msg.toStdString().c_str()));
@@ -798,10 +862,167 @@ void QcdmWindow::nvItemReadError(QcdmNvItemReadWorkerRequest request, QString ms
 }
 
 
+/**
+* @brief QcdmWindow::nvItemReadFinished - Cancelled and failed reads end here too
+*/
+void QcdmWindow::nvItemReadFinished()
+{
+	nvItemReadWorker = nullptr;
+	ui->tabNv->setEnabled(true);
+	updateCancelButton();
+}
+
+/**
+* @brief QcdmWindow::nvWriteFromText
+*/
+void QcdmWindow::nvWriteFromText()
+{
+	if (nvItemReadWorker != nullptr || nvItemWriteWorker != nullptr) {
+		log(kLogTypeError, "Operation currently in progress");
+		return;
+	}
+
+	QString inPath = QFileDialog::getOpenFileName(this, tr("Open File"), "", tr("*.txt"));
+
+	if (!inPath.length()) {
+		log(kLogTypeError, "Operation Cancelled");
+		return;
+	}
+
+	QcdmNvItemWriteWorkerRequest request = {};
+
+	request.type = QcdmNvItemWriteWorkerRequestTypeText;
+	request.inFilePath = inPath.toStdString();
+
+	return nvWriteRequest(request);
+}
+
+/**
+* @brief QcdmWindow::nvWriteFromBinary
+*/
+void QcdmWindow::nvWriteFromBinary()
+{
+	if (nvItemReadWorker != nullptr || nvItemWriteWorker != nullptr) {
+		log(kLogTypeError, "Operation currently in progress");
+		return;
+	}
+
+	QString inPath = QFileDialog::getOpenFileName(this, tr("Open File"), "", tr("*.bin"));
+
+	if (!inPath.length()) {
+		log(kLogTypeError, "Operation Cancelled");
+		return;
+	}
+
+	QcdmNvItemWriteWorkerRequest request = {};
+
+	request.type = QcdmNvItemWriteWorkerRequestTypeBinary;
+	request.inFilePath = inPath.toStdString();
+
+	return nvWriteRequest(request);
+}
+
+/**
+* @brief QcdmWindow::nvWriteRequest
+*/
+void QcdmWindow::nvWriteRequest(QcdmNvItemWriteWorkerRequest &request)
+{
+	request.rollback = ui->nvWriteRollbackCheckbox->isChecked();
+
+	ui->progressBar->reset();
+	ui->progressBar->setMinimum(0);
+	ui->progressBar->setMaximum(0);
+
+	ui->progressBarLabelRight->setText("");
+
+	nvItemWriteWorker = new QcdmNvItemWriteWorker(port, scheduler, request, this);
+
+	connect(nvItemWriteWorker, &QcdmNvItemWriteWorker::update, this, &QcdmWindow::nvItemWriteUpdate, Qt::QueuedConnection);
+	connect(nvItemWriteWorker, &QcdmNvItemWriteWorker::complete, this, &QcdmWindow::nvItemWriteComplete);
+	connect(nvItemWriteWorker, &QcdmNvItemWriteWorker::error, this, &QcdmWindow::nvItemWriteError);
+	connect(nvItemWriteWorker, &QcdmNvItemWriteWorker::finished, nvItemWriteWorker, &QObject::deleteLater);
+	connect(nvItemWriteWorker, &QcdmNvItemWriteWorker::finished, this, &QcdmWindow::nvItemWriteFinished);
+
+	// the write runs as a bulk job on the scheduler like the NV read
+	ui->tabNv->setEnabled(false);
+	ui->cancelButton->setEnabled(true);
+
+	nvItemWriteWorker->start();
+}
+
+/**
+* @brief QcdmWindow::nvItemWriteUpdate
+*/
+void QcdmWindow::nvItemWriteUpdate(QcdmNvItemWriteWorkerRequest request)
+{
+	QString tmp;
+
+	// an empty file would leave the bar busy
+	ui->progressBar->setMaximum(request.total ? request.total : 1);
+	ui->progressBar->setValue(request.done);
+
+	ui->progressBarLabelRight->setText(tmp.sprintf("%lu / %lu items", request.done, request.total));
+}
+
+/**
+* @brief QcdmWindow::nvItemWriteComplete
+*/
+void QcdmWindow::nvItemWriteComplete(QcdmNvItemWriteWorkerRequest request)
+{
+	QString tmp;
+
+	if (request.failed) {
+		log(kLogTypeWarning, tmp.sprintf("Wrote %lu items, %lu failed and %lu were rolled back", request.total - request.failed, request.failed, request.rolledBack));
+		return;
+	}
+
+	log(kLogTypeInfo, tmp.sprintf("Wrote and verified %lu items", request.total));
+}
+
+/**
+* @brief QcdmWindow::nvItemWriteError
+*/
+void QcdmWindow::nvItemWriteError(QcdmNvItemWriteWorkerRequest request, QString msg)
+{
+	log(kLogTypeError, msg);
+}
+
+/**
+* @brief QcdmWindow::nvItemWriteFinished - Cancelled and failed writes end here too
+*/
+void QcdmWindow::nvItemWriteFinished()
+{
+	nvItemWriteWorker = nullptr;
+
+	if (ui->progressBar->maximum() == 0) {
+		ui->progressBar->setMaximum(1);
+		ui->progressBar->reset();
+	}
+
+	ui->tabNv->setEnabled(true);
+	updateCancelButton();
+}
+
 /**
 * @brief QcdmWindow::readNam
 */
 void QcdmWindow::readNam() {
+	static const std::vector<uint16_t> namItems = {
+		NV_DIR_NUMBER_I, NV_MIN1_I, NV_MIN2_I, NV_HOME_SID_NID_I, NV_SYSTEM_PREF_I,
+		NV_PREF_MODE_I, NV_CDMA_PREF_SERV_I, NV_ROAM_PREF_I,
+		NV_PAP_USER_ID_I, NV_PAP_PASSWORD_I, NV_PPP_USER_ID_I, NV_PPP_PASSWORD_I,
+		NV_HDR_AN_AUTH_NAI_I, NV_HDR_AN_AUTH_PASSWORD_I, NV_HDR_AN_AUTH_USER_ID_LONG_I,
+		NV_HDR_AN_AUTH_PASSWD_LONG_I, NV_HDR_AN_PPP_USER_ID_I, NV_HDR_AN_PPP_PASSWORD_I
+	};
+	QString tmp;
+	// the readers below run under this lease and do not wait for one of their own
+	DmSchedulerLease lease(scheduler);
+	uint32_t hits = port.getNvCacheHits();
+	uint32_t misses = port.getNvCacheMisses();
+
+	// one pipelined read for whatever is not cached yet, the readers below then stay off the port
+	port.prefetchNV(namItems);
+
     // readMdn();
     // readMin();
     // readSid();
@@ -819,6 +1040,9 @@ void QcdmWindow::readNam() {
     ReadHdrAnLongUserId();
     ReadHdrAnLongPassword();
     ReadHdrAnPppUserId();
+
+	log(kLogTypeDebug, tmp.sprintf("NAM read with %d items from cache and %d from the device",
+		port.getNvCacheHits() - hits, port.getNvCacheMisses() - misses));
 }
 
 /**
@@ -845,6 +1069,8 @@ void QcdmWindow::ReadMdn() {
 	}
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_DIR_NUMBER_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -904,6 +1130,8 @@ void QcdmWindow::ReadMin() {
 	QcdmNvResponse min2;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		min1 = port.readNV(NV_MIN1_I);
 		min2 = port.readNV(NV_MIN2_I);
 	} catch (std::exception &e) {
@@ -962,6 +1190,8 @@ void QcdmWindow::ReadSid() {
 	QcdmNvResponse nvItem;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_HOME_SID_NID_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1000,6 +1230,8 @@ void QcdmWindow::ReadSystemPref()
 	QcdmNvResponse nvItem; 
 	
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_SYSTEM_PREF_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1059,6 +1291,8 @@ void QcdmWindow::ReadPrefMode()
 	QcdmNvResponse nvItem;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_PREF_MODE_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1180,6 +1414,8 @@ void QcdmWindow::ReadPrefServ()
 	QcdmNvResponse nvItem;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_CDMA_PREF_SERV_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1239,6 +1475,8 @@ void QcdmWindow::ReadRoamPref()
 	QcdmNvResponse nvItem;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_ROAM_PREF_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1396,6 +1634,8 @@ void QcdmWindow::readSubscription() {
 	QcdmNvResponse nvItem;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_RTRE_CONFIG_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1423,6 +1663,8 @@ void QcdmWindow::writeSubscription()
 	packet.data[0] = mode;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		port.writeNV(NV_RTRE_CONFIG_I, &packet.data[0], sizeof(packet.data));	
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1442,6 +1684,8 @@ void QcdmWindow::ReadPapUserId() {
 	QcdmNvResponse nvItem;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_PAP_USER_ID_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1474,6 +1718,8 @@ void QcdmWindow::ReadPapPassword() {
 	QcdmNvResponse nvItem;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_PAP_PASSWORD_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1505,6 +1751,8 @@ void QcdmWindow::ReadPppUserId() {
 	QcdmNvResponse nvItem;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_PPP_USER_ID_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1537,6 +1785,8 @@ void QcdmWindow::ReadPppPassword() {
 	QcdmNvResponse nvItem;
 	
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_PPP_PASSWORD_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1571,6 +1821,8 @@ void QcdmWindow::ReadHdrAnUserId() {
 	QcdmNvResponse nvItem;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_HDR_AN_AUTH_NAI_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1602,6 +1854,8 @@ void QcdmWindow::ReadHdrAnPassword() {
 	QcdmNvResponse nvItem;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_HDR_AN_AUTH_PASSWORD_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1634,6 +1888,8 @@ void QcdmWindow::ReadHdrAnLongUserId() {
 	QcdmNvResponse nvItem;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_HDR_AN_AUTH_USER_ID_LONG_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1666,6 +1922,8 @@ void QcdmWindow::ReadHdrAnLongPassword() {
 	QcdmNvResponse nvItem;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_HDR_AN_AUTH_PASSWD_LONG_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1698,6 +1956,8 @@ void QcdmWindow::ReadHdrAnPppUserId() {
 	QcdmNvResponse nvItem;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_HDR_AN_PPP_USER_ID_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1730,6 +1990,8 @@ void QcdmWindow::ReadHdrAnPppPassword() {
 	QcdmNvResponse nvItem;
 
 	try {
+		DmSchedulerLease lease(scheduler);
+
 		nvItem = port.readNV(NV_HDR_AN_PPP_PASSWORD_I);
 	} catch (std::exception &e) {
 		log(kLogTypeError, e.what());
@@ -1755,6 +2017,14 @@ void QcdmWindow::ReadHdrAnPppPassword() {
     }*/
 }
 
+/**
+* @brief QcdmWindow::onNvCacheToggled
+*/
+void QcdmWindow::onNvCacheToggled(bool checked) {
+	// repeated reads of the same items, like the NAM screen, are served from memory
+	port.setNvCacheEnabled(checked);
+}
+
 /**
 * @brief QcdmWindow::onSpcTextChanged
 */
@@ -1807,6 +2077,8 @@ void QcdmWindow::efsHello() {
 	QString tmp; 
 	QcdmEfsHelloResponse response;
 
+	DmSchedulerLease lease(scheduler);
+
 	if (!efsManager.hello(response)) {
 		log(kLogTypeError, "Error sending hello");
 	}
@@ -1837,6 +2109,8 @@ void QcdmWindow::efsGetDeviceInfo() {
 
 	QcdmEfsDeviceInfoResponse response = {};
 
+	DmSchedulerLease lease(scheduler);
+
 	if (!efsManager.getDeviceInfo(response)) {
 		log(kLogTypeError, "Error getting device info");
 		return;
@@ -1869,6 +2143,8 @@ void QcdmWindow::efsQuery() {
 
 	QcdmEfsQueryResponse response = {};
 
+	DmSchedulerLease lease(scheduler);
+
 	if (!efsManager.query(response)) {
 		log(kLogTypeError, "Error querying for efs settings");
 		return;
@@ -1918,6 +2194,8 @@ void QcdmWindow::efsListDirectories() {
 	connect(readWorker, &StreamingDloadReadWorker::error, this, &StreamingDloadWindow::readChunkErrorHandler);
 	connect(readWorker, &StreamingDloadReadWorker::finished, readWorker, &QObject::deleteLater);*/
 
+	DmSchedulerLease lease(scheduler);
+
 	if (!efsManager.readDir(rootDir, contents, true)){
 		enableUI();
 		log(kLogTypeError, "Error Reading From Directory /");
@@ -1974,6 +2252,8 @@ void QcdmWindow::efsExtractFactoryImage()
 
 	std::vector<uint8_t> data;
 
+	DmSchedulerLease lease(scheduler);
+
 	if (efsManager.factoryImagePrepare() == efsManager.kDmEfsSuccess) {
 		
 		if (efsManager.factoryImageStart() == efsManager.kDmEfsSuccess) {
@@ -2001,6 +2281,8 @@ void QcdmWindow::efsMakeGoldenCopy()
 		return;
 	}
 	
+	DmSchedulerLease lease(scheduler);
+
 	if (efsManager.makeGoldenCopy("/") != efsManager.kDmEfsSuccess) {
 		log(kLogTypeError, "Error Making Golden Copy Request");
 		return;
@@ -2017,6 +2299,8 @@ void QcdmWindow::efsFilesystemImage()
 	}
 
 	int32_t handle;
+	DmSchedulerLease lease(scheduler);
+
 	if (efsManager.openFilesystemImage("/", DIAG_EFS_FILESYSTEM_IMAGE_TAR, handle) != efsManager.kDmEfsSuccess) {
 		log(kLogTypeError, "Error Opening For Filesystem Image Request");
 		return;
@@ -2048,6 +2332,8 @@ void QcdmWindow::efsGetFileInfo()
 	log(kLogTypeInfo, tmp.sprintf("Info For File: %s", path.toStdString().c_str()));
 	log(kLogTypeInfo, "---------------------------");
 
+	DmSchedulerLease lease(scheduler);
+
 	if (efsManager.stat(path.toStdString().c_str(), statResponse) != efsManager.kDmEfsSuccess) {
 		log(kLogTypeError, "Stat Error");
 	} else {
@@ -2093,6 +2379,8 @@ void QcdmWindow::efsGetFile()
 		return;
 	}
 
+	DmSchedulerLease lease(scheduler);
+
 	if (efsManager.read(path.toStdString(), outFile.toStdString()) != efsManager.kDmEfsSuccess) {
 		log(kLogTypeError, tmp.sprintf("Error reading file %s", path.toStdString().c_str()));
 		return;
@@ -2116,6 +2404,8 @@ void QcdmWindow::efsDeleteFile()
 		return;
 	}
 
+	DmSchedulerLease lease(scheduler);
+
 	if (efsManager.unlink(path.toStdString()) != efsManager.kDmEfsSuccess) {
 		log(kLogTypeError, tmp.sprintf("Error removing file %s", path.toStdString().c_str()));
 		return;
@@ -2131,14 +2421,14 @@ void QcdmWindow::EfsAddTreeNodes(QTreeWidgetItem* parent, std::vector<DmEfsNode>
 	for (auto entry : entries) {
 		QTreeWidgetItem *treeNode = new QTreeWidgetItem(parent);
 		
-		treeNode->setText(kEfsBrowserColumnName, entry.name.c_str());
+		treeNode->setText(kEfsBrowserColumnName, entry.getName().c_str());
 			
 		if (entry.isFile()) {
 			treeNode->setText(kEfsBrowserColumnType, tr("File"));
-			treeNode->setIcon(kEfsBrowserColumnName, QIcon(entry.error ? ":/images/file-protected-2x.png" : ":/images/file-2x.png"));
+			treeNode->setIcon(kEfsBrowserColumnName, QIcon(entry.getError() ? ":/images/file-protected-2x.png" : ":/images/file-2x.png"));
 		} else if (entry.isDir()) {
 			treeNode->setText(kEfsBrowserColumnType, tr("Directory"));
-			treeNode->setIcon(kEfsBrowserColumnName, QIcon(entry.error ? ":/images/folder-protected-2x.png" : ":/images/folder-2x.png"));
+			treeNode->setIcon(kEfsBrowserColumnName, QIcon(entry.getError() ? ":/images/folder-protected-2x.png" : ":/images/folder-2x.png"));
 		} else if (entry.isLink()) {
 			treeNode->setText(kEfsBrowserColumnType, tr("Link"));
 		} else if (entry.isImmovable()) {
@@ -2147,20 +2437,16 @@ void QcdmWindow::EfsAddTreeNodes(QTreeWidgetItem* parent, std::vector<DmEfsNode>
 			treeNode->setText(kEfsBrowserColumnType, tr("Unknown"));
 		}
 
-		treeNode->setText(kEfsBrowserColumnSize, tmp.sprintf("%lu", entry.size));
-		treeNode->setText(kEfsBrowserColumnMode, tmp.sprintf("%08X", entry.mode));
-		treeNode->setText(kEfsBrowserColumnATime, tmp.sprintf("%lu", entry.atime));
-		treeNode->setText(kEfsBrowserColumnMTime, tmp.sprintf("%lu", entry.mtime));
-		treeNode->setText(kEfsBrowserColumnCTime, tmp.sprintf("%lu", entry.ctime));
-
-		if (entry.path.compare("/") == 0) {
-			treeNode->setText(kEfsBrowserColumnFullPath, tmp.sprintf("/%s", entry.name.c_str()));
-		} else {
-			treeNode->setText(kEfsBrowserColumnFullPath, tmp.sprintf("%s%s", entry.path.c_str(), entry.name.c_str()));
-		}
+		treeNode->setText(kEfsBrowserColumnSize, tmp.sprintf("%lu", entry.getSize()));
+		treeNode->setText(kEfsBrowserColumnMode, tmp.sprintf("%08X", entry.getMode()));
+		treeNode->setText(kEfsBrowserColumnATime, tmp.sprintf("%lu", entry.getAtime()));
+		treeNode->setText(kEfsBrowserColumnMTime, tmp.sprintf("%lu", entry.getMtime()));
+		treeNode->setText(kEfsBrowserColumnCTime, tmp.sprintf("%lu", entry.getCtime()));
+		treeNode->setText(kEfsBrowserColumnFullPath, entry.getFullPath().c_str());
 
-		if (entry.children.size()) {
-			EfsAddTreeNodes(treeNode, entry.children);
+		if (entry.getChildCount()) {
+			std::vector<DmEfsNode> children = entry.getChildren();
+			EfsAddTreeNodes(treeNode, children);
 		}
 	}
 }
@@ -2348,6 +2634,8 @@ void QcdmWindow::efsContextMenuSaveFile()
 		return;
 	}
 
+	DmSchedulerLease lease(scheduler);
+
 	if (efsManager.read(path.toStdString(), outPath.toStdString()) != efsManager.kDmEfsSuccess) {
 		log(kLogTypeError, "Error reading file");
 		return;
@@ -2368,6 +2656,485 @@ void QcdmWindow::efsContextMenuSaveDirectory()
 		return;
 	}
 
+	QString outPath = QFileDialog::getExistingDirectory(this, tr("Save Directory"), "");
+
+	if (!outPath.length()) {
+		log(kLogTypeInfo, "Operation Cancelled");
+		return;
+	}
+
+	bool incremental = true;
+
+	// a directory holding an earlier backup only gets what changed since, unless asked otherwise
+	if (QFileInfo(QDir(outPath).filePath(DM_EFS_BACKUP_MANIFEST_NAME)).exists()) {
+		incremental = QMessageBox::question(this, tr("Save Directory"),
+			tr("This directory holds an earlier backup. Only download files that changed since?"),
+			QMessageBox::Yes | QMessageBox::No, QMessageBox::Yes) == QMessageBox::Yes;
+	}
+
+	QcdmEfsBackupWorkerRequest request = {};
+
+	request.remotePath	= path.toStdString();
+	request.localPath	= outPath.toStdString();
+	request.incremental = incremental;
+
+	ui->progressBar->reset();
+	ui->progressBar->setMinimum(0);
+	ui->progressBar->setMaximum(0); // busy until the crawl has counted the files
+	ui->progressBarLabelRight->setText("");
+	ui->progressBarLabelBottom->setText(tmp.sprintf("Crawling %s", request.remotePath.c_str()));
+
+	efsBackupWorker = new QcdmEfsBackupWorker(efsManager, scheduler, request, this);
+
+	connect(efsBackupWorker, &QcdmEfsBackupWorker::update, this, &QcdmWindow::efsBackupUpdate, Qt::QueuedConnection);
+	connect(efsBackupWorker, &QcdmEfsBackupWorker::complete, this, &QcdmWindow::efsBackupComplete);
+	connect(efsBackupWorker, &QcdmEfsBackupWorker::error, this, &QcdmWindow::efsBackupError);
+	connect(efsBackupWorker, &QcdmEfsBackupWorker::finished, efsBackupWorker, &QObject::deleteLater);
+
+	disableUI();
+	ui->cancelButton->setEnabled(true);
+
+	efsBackupWorker->start();
+}
+
+/**
+* @brief QcdmWindow::efsBackupUpdate
+*/
+void QcdmWindow::efsBackupUpdate(QcdmEfsBackupWorkerRequest request)
+{
+	QString tmp;
+	uint32_t done = request.stats.added + request.stats.changed + request.stats.unchanged + request.stats.failed;
+
+	// an empty directory would leave the bar busy
+	ui->progressBar->setMaximum(request.stats.files ? request.stats.files : 1);
+	ui->progressBar->setValue(done);
+	ui->progressBarLabelRight->setText(tmp.sprintf("%u / %u files", done, request.stats.files));
+	ui->progressBarLabelBottom->setText(QString::fromStdString(request.current));
+}
+
+/**
+* @brief QcdmWindow::efsBackupComplete
+*/
+void QcdmWindow::efsBackupComplete(QcdmEfsBackupWorkerRequest request)
+{
+	QString tmp;
+	DmEfsBackupStats& stats = request.stats;
+
+	efsBackupWorker = nullptr;
+
+	ui->progressBarLabelBottom->setText("");
+	updateCancelButton();
+	enableUI();
+
+	log(kLogTypeInfo, tmp.sprintf("%u files in %u directories: %u new, %u changed, %u unchanged, %u removed, %u checked by md5, %llu bytes in %u ms",
+		stats.files, stats.directories, stats.added, stats.changed, stats.unchanged, stats.removed, stats.hashed, (unsigned long long)stats.bytesRead, stats.elapsed));
+
+	log(kLogTypeInfo, tmp.sprintf("Directory %s saved to %s", request.remotePath.c_str(), request.localPath.c_str()));
+}
+
+/**
+* @brief QcdmWindow::efsBackupError
+*/
+void QcdmWindow::efsBackupError(QcdmEfsBackupWorkerRequest request, QString msg)
+{
+	QString tmp;
+	DmEfsBackupStats& stats = request.stats;
+
+	efsBackupWorker = nullptr;
+
+	ui->progressBar->setMaximum(1);
+	ui->progressBar->reset();
+	ui->progressBarLabelBottom->setText("");
+	updateCancelButton();
+	enableUI();
+
+	log(kLogTypeInfo, tmp.sprintf("%u files in %u directories: %u new, %u changed, %u unchanged, %u removed, %u checked by md5, %llu bytes in %u ms",
+		stats.files, stats.directories, stats.added, stats.changed, stats.unchanged, stats.removed, stats.hashed, (unsigned long long)stats.bytesRead, stats.elapsed));
+
+	log(kLogTypeError, msg);
+}
+
+/**
+* @brief QcdmWindow::captureStart
+*/
+void QcdmWindow::captureStart()
+{
+	QcdmCaptureWorkerRequest request = {};
+	QString mask = ui->extMsgMask->text().trimmed();
+
+	if (captureWorker != nullptr || efsBackupWorker != nullptr || efsFileWriteWorker != nullptr || nvItemReadWorker != nullptr || nvItemWriteWorker != nullptr || memoryReadWorker != nullptr) {
+		log(kLogTypeError, "Operation currently in progress");
+		return;
+	}
+
+	try {
+		// 0x1098, 0xB0C0-0xB0C7
+		for (auto &entry : ui->captureLogCodesValue->text().split(",", QString::SkipEmptyParts)) {
+			QStringList range = entry.trimmed().split("-");
+			uint32_t first = std::stoul(range.first().trimmed().toStdString(), nullptr, 16);
+			uint32_t last = std::stoul(range.last().trimmed().toStdString(), nullptr, 16);
+
+			if (range.size() > 2 || first > last || last > 0xFFFF) {
+				throw std::invalid_argument(entry.toStdString());
+			}
+
+			for (uint32_t code = first; code <= last; code++) {
+				request.logCodes.push_back(code);
+			}
+		}
+
+		request.messageMask = mask.length() ? std::stoul(mask.toStdString(), nullptr, 16) : 0;
+	} catch (std::exception &e) {
+		log(kLogTypeError, "Log codes and the message mask must be hex, like 0x1098, 0xB0C0-0xB0C7");
+		return;
+	}
+
+	request.events = ui->captureEventsCheckbox->isChecked();
+
+	if (!request.logCodes.size() && !request.events && !request.messageMask) {
+		log(kLogTypeError, "Enter log codes, a message mask or check events to capture");
+		return;
+	}
+
+	QString outPath = QFileDialog::getSaveFileName(this, tr("Save Capture"), "capture.bin", tr("*.bin"));
+
+	if (!outPath.length()) {
+		log(kLogTypeError, "Operation Cancelled");
+		return;
+	}
+
+	request.type = QcdmCaptureWorkerRequestTypeCapture;
+	request.filePath = outPath.toStdString();
+
+	return captureRequest(request);
+}
+
+/**
+* @brief QcdmWindow::captureStop
+*/
+void QcdmWindow::captureStop()
+{
+	if (captureWorker != nullptr && captureWorker->isRunning()) {
+		captureWorker->cancel();
+		log(kLogTypeInfo, "Stopping capture");
+	}
+}
+
+/**
+* @brief QcdmWindow::captureDecode
+*/
+void QcdmWindow::captureDecode()
+{
+	QcdmCaptureWorkerRequest request = {};
+
+	if (captureWorker != nullptr) {
+		log(kLogTypeError, "Operation currently in progress");
+		return;
+	}
+
+	QString inPath = QFileDialog::getOpenFileName(this, tr("Open Capture"), "", tr("*.bin"));
+
+	if (!inPath.length()) {
+		log(kLogTypeError, "Operation Cancelled");
+		return;
+	}
+
+	request.type = QcdmCaptureWorkerRequestTypeDecode;
+	request.filePath = inPath.toStdString();
+
+	return captureRequest(request);
+}
+
+/**
+* @brief QcdmWindow::captureRequest
+*/
+void QcdmWindow::captureRequest(QcdmCaptureWorkerRequest &request)
+{
+	QString tmp;
+
+	ui->deviceLogs->clear();
+
+	captureWorker = new QcdmCaptureWorker(scheduler, request, this);
+
+	connect(captureWorker, &QcdmCaptureWorker::update, this, &QcdmWindow::captureUpdate, Qt::QueuedConnection);
+	connect(captureWorker, &QcdmCaptureWorker::decoded, this, &QcdmWindow::captureDecoded, Qt::QueuedConnection);
+	connect(captureWorker, &QcdmCaptureWorker::complete, this, &QcdmWindow::captureComplete);
+	connect(captureWorker, &QcdmCaptureWorker::error, this, &QcdmWindow::captureError);
+	connect(captureWorker, &QcdmCaptureWorker::finished, captureWorker, &QObject::deleteLater);
+	connect(captureWorker, &QcdmCaptureWorker::finished, this, &QcdmWindow::captureFinished);
+
+	if (request.type == QcdmCaptureWorkerRequestTypeCapture) {
+		// the capture holds the port until it is stopped
+		setCapturing(true);
+		ui->captureStatsLabel->setText("Starting capture");
+		log(kLogTypeInfo, tmp.sprintf("Capturing to %s", request.filePath.c_str()));
+	} else {
+		ui->captureStartButton->setEnabled(false);
+		ui->captureDecodeButton->setEnabled(false);
+	}
+
+	updateCancelButton();
+
+	captureWorker->start();
+}
+
+/**
+* @brief QcdmWindow::captureUpdate
+*/
+void QcdmWindow::captureUpdate(QcdmCaptureWorkerRequest request)
+{
+	QString tmp;
+	DmCaptureStats& stats = request.stats;
+
+	ui->captureStatsLabel->setText(tmp.sprintf("%llu frames, %llu dropped, %llu KB in %llu s",
+		(unsigned long long)stats.frames, (unsigned long long)stats.framesDropped, (unsigned long long)stats.bytesWritten / 1024, (unsigned long long)stats.elapsed / 1000));
+}
+
+/**
+* @brief QcdmWindow::captureDecoded
+*/
+void QcdmWindow::captureDecoded(QcdmCaptureWorkerRequest request, QString records)
+{
+	ui->deviceLogs->appendPlainText(records.trimmed());
+}
+
+/**
+* @brief QcdmWindow::captureComplete
+*/
+void QcdmWindow::captureComplete(QcdmCaptureWorkerRequest request)
+{
+	QString tmp;
+	DmCaptureDecodeStats& stats = request.decodeStats;
+
+	if (request.type == QcdmCaptureWorkerRequestTypeCapture) {
+		log(kLogTypeInfo, tmp.sprintf("Captured %llu frames to %s, %llu dropped",
+			(unsigned long long)request.stats.frames, request.filePath.c_str(), (unsigned long long)request.stats.framesDropped));
+	}
+
+	log(kLogTypeInfo, tmp.sprintf("Decoded %llu frames into %lu records in %llu ms, %llu CRC errors and %llu malformed",
+		(unsigned long long)stats.frames, request.records, (unsigned long long)stats.elapsed, (unsigned long long)stats.crcErrors, (unsigned long long)stats.malformed));
+
+	if (request.records > QCDM_CAPTURE_WORKER_MAX_RECORDS) {
+		log(kLogTypeWarning, tmp.sprintf("Only the first %d records are shown", QCDM_CAPTURE_WORKER_MAX_RECORDS));
+	}
+}
+
+/**
+* @brief QcdmWindow::captureError
+*/
+void QcdmWindow::captureError(QcdmCaptureWorkerRequest request, QString msg)
+{
+	log(kLogTypeError, msg);
+}
+
+/**
+* @brief QcdmWindow::captureFinished - Stopped and failed captures end here too
+*/
+void QcdmWindow::captureFinished()
+{
+	captureWorker = nullptr;
+
+	setCapturing(false);
+	updateCancelButton();
+}
+
+/**
+* @brief QcdmWindow::memoryRead
+*/
+void QcdmWindow::memoryRead()
+{
+	QString tmp;
+	bool ok = false;
+	QcdmMemoryReadWorkerRequest request = {};
+
+	if (!port.isOpen()) {
+		log(kLogTypeError, "Connect to a port first");
+		return;
+	}
+
+	// the progress bar is shared with the other long operations
+	if (memoryReadWorker != nullptr || captureWorker != nullptr || efsBackupWorker != nullptr || efsFileWriteWorker != nullptr || nvItemReadWorker != nullptr || nvItemWriteWorker != nullptr) {
+		log(kLogTypeError, "Operation currently in progress");
+		return;
+	}
+
+	QString address = QInputDialog::getText(this, tr("Read Memory"), tr("Start address (hex):"), QLineEdit::Normal, "0x00000000", &ok);
+
+	if (!ok) {
+		return;
+	}
+
+	QString size = QInputDialog::getText(this, tr("Read Memory"), tr("Size in bytes (hex):"), QLineEdit::Normal, "0x1000", &ok);
+
+	if (!ok) {
+		return;
+	}
+
+	try {
+		uint64_t start = std::stoull(address.trimmed().toStdString(), nullptr, 16);
+		uint64_t length = std::stoull(size.trimmed().toStdString(), nullptr, 16);
+
+		if (!length || start + length > 0x100000000ULL) {
+			throw std::out_of_range(size.toStdString());
+		}
+
+		request.address = (uint32_t)start;
+		request.size = (uint32_t)length;
+	} catch (std::exception &e) {
+		log(kLogTypeError, "Address and size must be hex and stay within 32 bits");
+		return;
+	}
+
+	QString outPath = QFileDialog::getSaveFileName(this, tr("Save Memory"), tr("memory_%1.bin").arg(request.address, 8, 16, QChar('0')), tr("*.bin"));
+
+	if (!outPath.length()) {
+		log(kLogTypeError, "Operation Cancelled");
+		return;
+	}
+
+	request.outFilePath = outPath.toStdString();
+
+	ui->progressBar->reset();
+	ui->progressBar->setMinimum(0);
+	ui->progressBar->setMaximum(request.size >> 1); // halved to stay within an int
+	ui->progressBar->setValue(0);
+	ui->progressBarLabelRight->setText(tmp.sprintf("0 / %u bytes", request.size));
+
+	log(kLogTypeInfo, tmp.sprintf("Reading %u bytes from 0x%08X", request.size, request.address));
+
+	memoryReadWorker = new QcdmMemoryReadWorker(scheduler, request, this);
+
+	connect(memoryReadWorker, &QcdmMemoryReadWorker::update, this, &QcdmWindow::memoryReadUpdate, Qt::QueuedConnection);
+	connect(memoryReadWorker, &QcdmMemoryReadWorker::complete, this, &QcdmWindow::memoryReadComplete);
+	connect(memoryReadWorker, &QcdmMemoryReadWorker::error, this, &QcdmWindow::memoryReadError);
+	connect(memoryReadWorker, &QcdmMemoryReadWorker::finished, memoryReadWorker, &QObject::deleteLater);
+	connect(memoryReadWorker, &QcdmMemoryReadWorker::finished, this, &QcdmWindow::memoryReadFinished);
+
+	// the read runs as a bulk job on the scheduler, the tabs stay usable meanwhile
+	ui->actionMemoryRead->setEnabled(false);
+	ui->cancelButton->setEnabled(true);
+
+	memoryReadWorker->start();
+}
+
+/**
+* @brief QcdmWindow::memoryReadUpdate
+*/
+void QcdmWindow::memoryReadUpdate(QcdmMemoryReadWorkerRequest request)
+{
+	QString tmp;
+
+	ui->progressBar->setValue(request.outSize >> 1);
+	ui->progressBarLabelRight->setText(tmp.sprintf("%u / %u bytes", request.outSize, request.size));
+}
+
+/**
+* @brief QcdmWindow::memoryReadComplete
+*/
+void QcdmWindow::memoryReadComplete(QcdmMemoryReadWorkerRequest request)
+{
+	QString tmp;
+
+	log(kLogTypeInfo, tmp.sprintf("Read %u bytes from 0x%08X to %s in %lld ms", request.outSize, request.address, request.outFilePath.c_str(), request.elapsed));
+
+	if (!request.unreadable) {
+		return;
+	}
+
+	log(kLogTypeWarning, tmp.sprintf("%u bytes could not be read and were saved as zero", request.unreadable));
+
+	for (auto &failure : request.failures) {
+		log(kLogTypeWarning, tmp.sprintf("Unreadable: 0x%08X - 0x%08X", failure.address, failure.address + failure.size - 1));
+	}
+}
+
+/**
+* @brief QcdmWindow::memoryReadError
+*/
+void QcdmWindow::memoryReadError(QcdmMemoryReadWorkerRequest request, QString msg)
+{
+	log(kLogTypeError, msg);
+}
+
+/**
+* @brief QcdmWindow::memoryReadFinished - Cancelled and failed reads end here too
+*/
+void QcdmWindow::memoryReadFinished()
+{
+	memoryReadWorker = nullptr;
+	ui->actionMemoryRead->setEnabled(true);
+	updateCancelButton();
+}
+
+/**
+* @brief QcdmWindow::setCapturing
+*/
+void QcdmWindow::setCapturing(bool capturing)
+{
+	// a window command would wait on the port for as long as the capture runs
+	ui->securityGroupBox->setEnabled(!capturing);
+	ui->modeGroupBox->setEnabled(!capturing);
+	ui->menuEFS->setEnabled(!capturing);
+	ui->menuMemory->setEnabled(!capturing);
+
+	for (int i = 0; i < ui->qcdmTabWidget->count(); i++) {
+		if (ui->qcdmTabWidget->widget(i) != ui->tabLogs) {
+			ui->qcdmTabWidget->widget(i)->setEnabled(!capturing);
+		}
+	}
+
+	ui->pushButton->setEnabled(!capturing);
+	ui->extMsgMask->setEnabled(!capturing);
+	ui->captureLogCodesValue->setEnabled(!capturing);
+	ui->captureEventsCheckbox->setEnabled(!capturing);
+	ui->captureStartButton->setEnabled(!capturing);
+	ui->captureDecodeButton->setEnabled(!capturing);
+	ui->captureStopButton->setEnabled(capturing);
+}
+
+/**
+* @brief QcdmWindow::cancelOperation
+*/
+void QcdmWindow::cancelOperation()
+{
+	// the workers stop at the next file or slice and report through their error signal
+	if (efsBackupWorker != nullptr && efsBackupWorker->isRunning()) {
+		efsBackupWorker->cancel();
+		log(kLogTypeInfo, "Cancelling backup");
+	}
+
+	if (efsFileWriteWorker != nullptr && efsFileWriteWorker->isRunning()) {
+		efsFileWriteWorker->cancel();
+		log(kLogTypeInfo, "Cancelling upload");
+	}
+
+	if (nvItemReadWorker != nullptr && nvItemReadWorker->isRunning()) {
+		nvItemReadWorker->cancel();
+		log(kLogTypeInfo, "Cancelling NV read");
+	}
+
+	if (nvItemWriteWorker != nullptr && nvItemWriteWorker->isRunning()) {
+		nvItemWriteWorker->cancel();
+		log(kLogTypeInfo, "Cancelling NV write");
+	}
+
+	if (memoryReadWorker != nullptr && memoryReadWorker->isRunning()) {
+		memoryReadWorker->cancel();
+		log(kLogTypeInfo, "Cancelling memory read");
+	}
+
+	if (captureWorker != nullptr && captureWorker->isRunning()) {
+		captureWorker->cancel();
+		log(kLogTypeInfo, "Stopping capture");
+	}
+}
+
+/**
+* @brief QcdmWindow::updateCancelButton
+*/
+void QcdmWindow::updateCancelButton()
+{
+	ui->cancelButton->setEnabled(efsBackupWorker != nullptr || efsFileWriteWorker != nullptr || nvItemReadWorker != nullptr || nvItemWriteWorker != nullptr || captureWorker != nullptr || memoryReadWorker != nullptr);
 }
 
 void QcdmWindow::efsContextMenuSaveDirectoryCompressed()
@@ -2394,6 +3161,95 @@ void QcdmWindow::efsContextMenuUploadFile()
 		log(kLogTypeError, "Invalid path");
 		return;
 	}
+
+	if (efsFileWriteWorker != nullptr || efsBackupWorker != nullptr || captureWorker != nullptr || memoryReadWorker != nullptr || nvItemReadWorker != nullptr || nvItemWriteWorker != nullptr) {
+		log(kLogTypeError, "Operation currently in progress");
+		return;
+	}
+
+	QString localPath = QFileDialog::getOpenFileName(this, tr("Upload File"), "", tr("*.*"));
+
+	if (!localPath.length()) {
+		log(kLogTypeInfo, "Operation Cancelled");
+		return;
+	}
+
+	// directory paths are listed without a trailing slash
+	QString remotePath = path.endsWith("/") ? path : path + "/";
+
+	remotePath += QFileInfo(localPath).fileName();
+
+	QcdmEfsFileWriteWorkerRequest request = {};
+
+	request.localPath	= localPath.toStdString();
+	request.remotePath	= remotePath.toStdString();
+	request.verify		= true;
+
+	ui->progressBar->reset();
+	ui->progressBar->setMinimum(0);
+	ui->progressBar->setMaximum(0); // busy until the first write is answered
+	ui->progressBarLabelRight->setText("");
+	ui->progressBarLabelBottom->setText(tmp.sprintf("Uploading %s", request.remotePath.c_str()));
+
+	efsFileWriteWorker = new QcdmEfsFileWriteWorker(efsManager, scheduler, request, this);
+
+	connect(efsFileWriteWorker, &QcdmEfsFileWriteWorker::update, this, &QcdmWindow::efsFileWriteUpdate, Qt::QueuedConnection);
+	connect(efsFileWriteWorker, &QcdmEfsFileWriteWorker::complete, this, &QcdmWindow::efsFileWriteComplete);
+	connect(efsFileWriteWorker, &QcdmEfsFileWriteWorker::error, this, &QcdmWindow::efsFileWriteError);
+	connect(efsFileWriteWorker, &QcdmEfsFileWriteWorker::finished, efsFileWriteWorker, &QObject::deleteLater);
+	connect(efsFileWriteWorker, &QcdmEfsFileWriteWorker::finished, this, &QcdmWindow::efsFileWriteFinished);
+
+	disableUI();
+	ui->cancelButton->setEnabled(true);
+
+	efsFileWriteWorker->start();
+}
+
+/**
+* @brief QcdmWindow::efsFileWriteUpdate
+*/
+void QcdmWindow::efsFileWriteUpdate(QcdmEfsFileWriteWorkerRequest request)
+{
+	QString tmp;
+
+	// an empty file would leave the bar busy
+	ui->progressBar->setMaximum(request.fileSize ? request.fileSize >> 1 : 1); // halved to stay within an int
+	ui->progressBar->setValue(request.bytesWritten >> 1);
+	ui->progressBarLabelRight->setText(tmp.sprintf("%u / %u bytes", request.bytesWritten, request.fileSize));
+}
+
+/**
+* @brief QcdmWindow::efsFileWriteComplete
+*/
+void QcdmWindow::efsFileWriteComplete(QcdmEfsFileWriteWorkerRequest request)
+{
+	QString tmp;
+
+	log(kLogTypeInfo, tmp.sprintf("File %s uploaded to %s, %u bytes in %lld ms%s", request.localPath.c_str(), request.remotePath.c_str(),
+		request.bytesWritten, request.elapsed, request.verified ? ", md5 verified" : ""));
+}
+
+/**
+* @brief QcdmWindow::efsFileWriteError
+*/
+void QcdmWindow::efsFileWriteError(QcdmEfsFileWriteWorkerRequest request, QString msg)
+{
+	log(kLogTypeError, msg);
+}
+
+/**
+* @brief QcdmWindow::efsFileWriteFinished - Cancelled and failed uploads end here too
+*/
+void QcdmWindow::efsFileWriteFinished()
+{
+	efsFileWriteWorker = nullptr;
+
+	ui->progressBar->setMaximum(1);
+	ui->progressBar->reset();
+	ui->progressBarLabelRight->setText("");
+	ui->progressBarLabelBottom->setText("");
+	updateCancelButton();
+	enableUI();
 }
 
 void QcdmWindow::efsContextMenuCopyPathToClipboard()
@@ -2427,6 +3283,8 @@ void QcdmWindow::efsContextMenuDeleteDirectory()
 		return;
 	}
 
+	DmSchedulerLease lease(scheduler);
+
 	if (efsManager.deltree(path.toStdString()) != efsManager.kDmEfsSuccess) {
 		log(kLogTypeError, tmp.sprintf("Error deleting %s", path.toStdString().c_str()));
 		return;
@@ -2455,6 +3313,8 @@ void QcdmWindow::efsContextMenuDeleteFile()
 		return;
 	}
 
+	DmSchedulerLease lease(scheduler);
+
 	if (efsManager.unlink(path.toStdString()) != efsManager.kDmEfsSuccess) {
 		log(kLogTypeError, tmp.sprintf("Error deleting %s", path.toStdString().c_str()));
 		return;
@@ -2491,6 +3351,8 @@ void QcdmWindow::efsContextMenuCreateDirectory()
 		if (collectedMode && mode > 0) {
 			path.sprintf("%s%s", basePath.toStdString().c_str(), directoryName.toStdString().c_str());
 
+			DmSchedulerLease lease(scheduler);
+
 			if (efsManager.mkdir(path.toStdString(), mode) != efsManager.kDmEfsSuccess) {
 				log(kLogTypeError, "Error creating directory");
 				return;
@@ -2521,6 +3383,8 @@ void QcdmWindow::efsContextMenuCreateLink()
 		QString name = QInputDialog::getText(this, tr("Link Name"), tr("Link name:"), QLineEdit::Normal, NULL, &collectedName);
 		if (collectedName && !name.isEmpty()) {
 			path.append(name);
+			DmSchedulerLease lease(scheduler);
+
 			if (efsManager.symlink(targetPath.toStdString(), path.toStdString()) != efsManager.kDmEfsSuccess) {
 				log(kLogTypeError, tmp.sprintf("Error creating link from %s to %s", path.toStdString().c_str(), targetPath.toStdString().c_str()));
 			} else {
@@ -2534,38 +3398,6 @@ void QcdmWindow::efsContextMenuCreateLink()
 
 void QcdmWindow::probeCommands()
 {
-
-	//port.getLog();
-
-
-	/*QcdmVersionResponse version = {};
-	
-	port.getVersion(version);
-
-	printf("Version: %d\n", version.version);
-	*/
-
-	/*
-	QcdmQueryQpstCookieRequest r = {};
-	r.header.command = DIAG_SUBSYS_CMD_F;
-	r.header.subsysId = DIAG_SUBSYS_DIAG_SERV;
-	r.header.subsysCommand = 0x0054;
-	r.version = 1;
-	*/
-	QcdmTestStruct r = {};
-	r.header.command = DIAG_SUBSYS_CMD_F;
-	r.header.subsysId = DIAG_SUBSYS_DIAG_SERV;
-	r.header.subsysCommand = 0x080A;
-	r.processorId = 0x00;
-
-	port.write((uint8_t*)&r, sizeof(r));
-
-	uint8_t b[DIAG_MAX_PACKET_SIZE];
-	port.read(b, DIAG_MAX_PACKET_SIZE);
-
-	return;
-
-
 	QString tmp;
 	uint8_t buf[DIAG_MAX_PACKET_SIZE];
 
@@ -2573,6 +3405,12 @@ void QcdmWindow::probeCommands()
 
 	size_t rxSize, txSize;
 
+	QElapsedTimer sweepTimer;
+
+	sweepTimer.start();
+
+	DmSchedulerLease lease(scheduler);
+
 	for (int i = 0; i <= DIAG_MAX_F; i++) {
 		packet.command = i;
 
@@ -2624,6 +3462,12 @@ void QcdmWindow::probeCommands()
 		}
 
 	}
+
+	RttStats rtt = port.getRttStats();
+
+	// commands that get no answer only cost what the measured round trips allow
+	log(kLogTypeInfo, tmp.sprintf("Probed %d commands in %lld ms, round trip %.2f ms smoothed %.2f ms max, %llu timeouts, next wait %u ms",
+		DIAG_MAX_F + 1, sweepTimer.elapsed(), rtt.smoothed / 1000.0, rtt.max / 1000.0, (unsigned long long)rtt.timeouts, rtt.timeout));
 }
 
 void QcdmWindow::readSome()
@@ -2632,6 +3476,8 @@ void QcdmWindow::readSome()
 
 	size_t readSize = 1;
 
+	DmSchedulerLease lease(scheduler);
+
 	while (readSize > 0) {
 		readSize = port.read(buf, DIAG_MAX_PACKET_SIZE, false);
 		hexdump(buf, readSize);
@@ -2647,6 +3493,8 @@ void QcdmWindow::sendCommand()
 	uint8_t buf[DIAG_MAX_PACKET_SIZE];
 
 	QcdmGenericRequest packet = { command };
+	DmSchedulerLease lease(scheduler);
+
 	size_t txSize = port.write(reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
 	hexdump(reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
 
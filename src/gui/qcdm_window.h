@@ -20,13 +20,17 @@
 #include <QInputDialog>
 #include <QClipboard>
 #include <QListWidget>
-#include <QtXml>
+#include <QDir>
+#include <QElapsedTimer>
 #include "ui_qcdm_window.h"
 #include "about_dialog.h"
+#include "nv_item_list_model.h"
 #include "qc/dm.h"
 #include "qc/dm_nv.h"
 #include "qc/dm_efs.h"
 #include "qc/dm_efs_manager.h"
+#include "qc/dm_efs_backup.h"
+#include "qc/dm_scheduler.h"
 #include "serial/qcdm_serial.h"
 #include "worker/qcdm_efs_directory_tree_worker.h"
 #include "worker/qcdm_efs_file_read_worker.h"
@@ -35,6 +39,10 @@
 #include "worker/qcdm_prl_write_worker.h"
 #include "worker/qcdm_prl_read_worker.h"
 #include "worker/qcdm_nv_item_read_worker.h"
+#include "worker/qcdm_nv_item_write_worker.h"
+#include "worker/qcdm_efs_backup_worker.h"
+#include "worker/qcdm_capture_worker.h"
+#include "qc/dm_nv_sparsity_map.h"
 #include "util/convert.h"
 
 namespace Ui {
@@ -80,8 +88,14 @@ namespace OpenPST {
 		QcdmSerial port;
 		serial::PortInfo currentPort;
 		DmEfsManager efsManager;
+		DmScheduler scheduler;
 		AboutDialog* aboutDialog;
 		QcdmNvItemReadWorker* nvItemReadWorker;
+		QcdmNvItemWriteWorker* nvItemWriteWorker;
+		QcdmEfsBackupWorker* efsBackupWorker;
+		QcdmEfsFileWriteWorker* efsFileWriteWorker;
+		QcdmCaptureWorker* captureWorker;
+		QcdmMemoryReadWorker* memoryReadWorker;
 
 		/**
 		* @brief
@@ -199,6 +213,36 @@ namespace OpenPST {
 		*/
 		void nvReadRangeToBinary();
 
+		/**
+		* @brief nvWriteFromText - Write the items of a text dump made by the NV read
+		*/
+		void nvWriteFromText();
+
+		/**
+		* @brief nvWriteFromBinary - Write the items of a backup made by the NV read
+		*/
+		void nvWriteFromBinary();
+
+		/**
+		* @brief captureStart - Capture the selected logs, events and messages to a file until stopped
+		*/
+		void captureStart();
+
+		/**
+		* @brief captureStop - Stop the capture and decode what was captured
+		*/
+		void captureStop();
+
+		/**
+		* @brief captureDecode - Decode a capture file or a raw HDLC stream into the device log
+		*/
+		void captureDecode();
+
+		/**
+		* @brief memoryRead - Read a range of device memory to a file with pipelined peeks
+		*/
+		void memoryRead();
+
 		/**
 		* @brief
 		*/
@@ -235,6 +279,11 @@ namespace OpenPST {
 		*/
 		void onSpcTextChanged(QString value);
 
+		/**
+		* @brief
+		*/
+		void onNvCacheToggled(bool checked);
+
 		/**
 		* @brief
 		*/
@@ -383,9 +432,72 @@ namespace OpenPST {
 
 		void nvItemReadError(QcdmNvItemReadWorkerRequest request, QString msg);
 
+		void nvItemReadFinished();
+
+		void nvWriteRequest(QcdmNvItemWriteWorkerRequest& request);
+
+		void nvItemWriteUpdate(QcdmNvItemWriteWorkerRequest request);
+
+		void nvItemWriteComplete(QcdmNvItemWriteWorkerRequest request);
+
+		void nvItemWriteError(QcdmNvItemWriteWorkerRequest request, QString msg);
+
+		void nvItemWriteFinished();
+
+		void efsBackupUpdate(QcdmEfsBackupWorkerRequest request);
+
+		void efsBackupComplete(QcdmEfsBackupWorkerRequest request);
+
+		void efsBackupError(QcdmEfsBackupWorkerRequest request, QString msg);
+
+		void efsFileWriteUpdate(QcdmEfsFileWriteWorkerRequest request);
+
+		void efsFileWriteComplete(QcdmEfsFileWriteWorkerRequest request);
+
+		void efsFileWriteError(QcdmEfsFileWriteWorkerRequest request, QString msg);
+
+		void efsFileWriteFinished();
+
+		void captureRequest(QcdmCaptureWorkerRequest& request);
+
+		void captureUpdate(QcdmCaptureWorkerRequest request);
+
+		void captureDecoded(QcdmCaptureWorkerRequest request, QString records);
+
+		void captureComplete(QcdmCaptureWorkerRequest request);
+
+		void captureError(QcdmCaptureWorkerRequest request, QString msg);
+
+		void captureFinished();
+
+		void memoryReadUpdate(QcdmMemoryReadWorkerRequest request);
+
+		void memoryReadComplete(QcdmMemoryReadWorkerRequest request);
+
+		void memoryReadError(QcdmMemoryReadWorkerRequest request, QString msg);
+
+		void memoryReadFinished();
+
+		/**
+		* @brief cancelOperation - Cancel the running backup, upload, NV read, NV write, memory read or capture
+		*/
+		void cancelOperation();
+
 
 
 	private:
+		/**
+		* @brief updateCancelButton - Enable the cancel button while any worker runs
+		*/
+		void updateCancelButton();
+
+		/**
+		* @brief setCapturing - Keep everything that needs the port disabled while a capture holds it
+		*
+		* @param bool capturing
+		*/
+		void setCapturing(bool capturing);
+
 		/**
 		* @brief
 		*/
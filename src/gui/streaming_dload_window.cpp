@@ -17,7 +17,10 @@ StreamingDloadWindow::StreamingDloadWindow(QWidget *parent) :
 	ui(new Ui::StreamingDloadWindow),
 	port("", 115200),
 	readWorker(nullptr),
-	streamWriteWorker(nullptr)
+	streamWriteWorker(nullptr),
+	flashWorker(nullptr),
+	emmcBackupWorker(nullptr),
+	nandReadWorker(nullptr)
 {
 	ui->setupUi(this);
 	 
@@ -26,6 +29,11 @@ StreamingDloadWindow::StreamingDloadWindow(QWidget *parent) :
 	ui->securityModeValue->addItem("0x01 - Trusted", STREAMING_DLOAD_SECURITY_MODE_TRUSTED);
 	ui->securityModeValue->addItem("0x00 - Untrusted", STREAMING_DLOAD_SECURITY_MODE_UNTRUSTED);
 	ui->securityModeValue->setCurrentIndex(0);
+
+	ui->nandEccValue->addItem("BCH-4", kNandEccBch4);
+	ui->nandEccValue->addItem("BCH-8", kNandEccBch8);
+	ui->nandEccValue->addItem("Hamming", kNandEccHamming);
+	ui->nandEccValue->setCurrentIndex(0);
 	
 	ui->openModeValue->addItem("0x01 - Bootloader Download", STREAMING_DLOAD_OPEN_MODE_BOOTLOADER_DOWNLOAD);
 	ui->openModeValue->addItem("0x02 - Bootable Image Download", STREAMING_DLOAD_OPEN_MODE_BOOTABLE_IMAGE_DOWNLOAD);
@@ -91,9 +99,20 @@ StreamingDloadWindow::StreamingDloadWindow(QWidget *parent) :
 	QObject::connect(ui->writePartitionTableFileBrowseButton, SIGNAL(clicked()), this, SLOT(browseForParitionTable()));
 	QObject::connect(ui->writeFileBrowseButton, SIGNAL(clicked()), this, SLOT(browseForWriteFile()));
 	QObject::connect(ui->streamWriteButton, SIGNAL(clicked()), this, SLOT(streamWrite()));
+	QObject::connect(ui->flashPlanFileBrowseButton, SIGNAL(clicked()), this, SLOT(browseForFlashPlan()));
+	QObject::connect(ui->flashPlanButton, SIGNAL(clicked()), this, SLOT(flashPlan()));
+	QObject::connect(ui->diffBaseManifestBrowseButton, SIGNAL(clicked()), this, SLOT(browseForBaseManifest()));
+	QObject::connect(ui->generateManifestButton, SIGNAL(clicked()), this, SLOT(generateManifest()));
+	QObject::connect(ui->emmcBackupDirectoryBrowseButton, SIGNAL(clicked()), this, SLOT(browseForEmmcBackupDirectory()));
+	QObject::connect(ui->emmcBackupButton, SIGNAL(clicked()), this, SLOT(emmcBackup()));
+	QObject::connect(ui->nandReadFileBrowseButton, SIGNAL(clicked()), this, SLOT(browseForNandReadFile()));
+	QObject::connect(ui->nandReadButton, SIGNAL(clicked()), this, SLOT(nandRead()));
 
 	qRegisterMetaType<StreamingDloadReadWorkerRequest>("StreamingDloadReadWorkerRequest");
 	qRegisterMetaType<StreamingDloadStreamWriteWorkerRequest>("StreamingDloadStreamWriteWorkerRequest");
+	qRegisterMetaType<StreamingDloadFlashWorkerRequest>("StreamingDloadFlashWorkerRequest");
+	qRegisterMetaType<StreamingDloadEmmcBackupWorkerRequest>("StreamingDloadEmmcBackupWorkerRequest");
+	qRegisterMetaType<StreamingDloadNandReadWorkerRequest>("StreamingDloadNandReadWorkerRequest");
 	
 	updatePortList();
 }
@@ -255,6 +274,36 @@ void StreamingDloadWindow::sendHello()
 	}
 
 	log(tmp.sprintf("Feature Bits: %04X", port.state.hello.featureBits));
+
+	if (port.state.sectorAddresses) {
+		log(tmp.sprintf("Sector addressing enabled. Read and write addresses must be %d byte aligned", STREAMING_DLOAD_SECTOR_SIZE));
+	}
+
+	if (ui->helloCalibrateCheckbox->isChecked()) {
+		calibrateBlockSize();
+	}
+}
+
+/**
+* @brief StreamingDloadWindow::calibrateBlockSize - Pick the fastest block size for this session
+*/
+void StreamingDloadWindow::calibrateBlockSize()
+{
+	QString tmp;
+	std::vector<StreamingDloadCalibrationSample> samples;
+
+	log(tmp.sprintf("Calibrating block size with %d byte reads", STREAMING_DLOAD_CALIBRATION_SAMPLE_SIZE));
+
+	if (port.calibrateBlockSize(0, samples) != kStreamingDloadSuccess) {
+		log(tmp.sprintf("Error calibrating block size, using %lu bytes", port.state.blockSize));
+		return;
+	}
+
+	for (auto &sample : samples) {
+		log(tmp.sprintf("%8lu bytes: %10lld us %12.2f KB/s", sample.blockSize, sample.elapsed, sample.rate / 1024.0));
+	}
+
+	log(tmp.sprintf("Using %lu byte blocks", port.state.blockSize));
 }
 
 /**
@@ -467,8 +516,8 @@ void StreamingDloadWindow::read()
 		return;
 	}
 
-	uint32_t address = std::stoul(ui->readAddressValue->text().toStdString().c_str(), nullptr, 16);
-	size_t	 size = std::stoi(ui->readSizeValue->text().toStdString().c_str(), nullptr, 10);
+	uint64_t address = std::stoull(ui->readAddressValue->text().toStdString().c_str(), nullptr, 16);
+	uint64_t size = std::stoull(ui->readSizeValue->text().toStdString().c_str(), nullptr, 10);
 	size_t	 stepSize = std::stoi(ui->readStepSizeValue->currentText().toStdString().c_str(), nullptr, 10);
 
 	if (size <= 0) {
@@ -486,22 +535,22 @@ void StreamingDloadWindow::read()
 		return;
 	}
 
-	log(tmp.sprintf("Attempting Read %lu bytes starting from address 0x%08X to file %s", size, address, fileName.toStdString().c_str()));
+	log(tmp.sprintf("Attempting Read %llu bytes starting from address 0x%08llX to file %s", size, address, fileName.toStdString().c_str()));
 
 	StreamingDloadReadWorkerRequest request;	
 	request.address = address;
 	request.size = size;
 	request.stepSize = stepSize;
 	request.outFilePath = fileName.toStdString();
+	request.resume = ui->resumeReadCheckbox->isChecked();
+	request.verifyLast = ui->verifyReadCheckbox->isChecked();
 
 	// setup progress bar
 	ui->progressBar->reset();
-	ui->progressBar->setMaximum(request.size);
 	ui->progressBar->setMinimum(0);
-	ui->progressBar->setValue(0);
+	setProgress(0, request.size);
 
 	ui->progressBarTextLabel2->setText(tmp.sprintf("%s", request.outFilePath.c_str()));
-	ui->progressBarTextLabel->setText(tmp.sprintf("0 / %lu bytes", request.size));
 
 	disableControls();
 
@@ -524,7 +573,7 @@ void StreamingDloadWindow::streamWrite()
 		return;
 	}
 
-	uint32_t address = std::stoul(ui->writeAddressValue->text().toStdString().c_str(), nullptr, 16);
+	uint64_t address = std::stoull(ui->writeAddressValue->text().toStdString().c_str(), nullptr, 16);
 
 	QString tmp;
 	QString filePath = ui->writeFileValue->text();
@@ -543,23 +592,40 @@ void StreamingDloadWindow::streamWrite()
 
 	file.seekg(0, file.end);
 
-	size_t fileSize = file.tellg();
+	uint64_t fileSize = file.tellg();
 	
 	file.close();
 
+	// the journal records what reached one unit, each unit flashed from the image needs its own
+	QString journalPath = QFileDialog::getSaveFileName(this, tr("Journal For This Device"),
+		tmp.sprintf("%s.%s.journal", filePath.toStdString().c_str(), port.getDeviceId().c_str()),
+		tr("Journal Files (*.journal)"), nullptr, QFileDialog::DontConfirmOverwrite);
+
+	if (!journalPath.length()) {
+		log("Write operation cancelled");
+		return;
+	}
+
 	StreamingDloadStreamWriteWorkerRequest request;
 	request.address = address;
 	request.filePath = filePath.toStdString();
 	request.unframed = ui->unframedWriteCheckbox->isChecked();
+	request.baseManifestPath = ui->diffBaseManifestValue->text().toStdString();
+	request.journalPath = journalPath.toStdString();
+	request.resume = ui->resumeWriteCheckbox->isChecked();
+	request.verifyLast = ui->verifyWriteCheckbox->isChecked();
+	request.verify = ui->readBackWriteCheckbox->isChecked();
+
+	if (request.baseManifestPath.size()) {
+		log(tmp.sprintf("Differential write against %s", request.baseManifestPath.c_str()));
+	}
 
 	// setup progress bar
 	ui->progressBar->reset();
-	ui->progressBar->setMaximum(fileSize);
 	ui->progressBar->setMinimum(0);
-	ui->progressBar->setValue(0);
+	setProgress(0, fileSize);
 
 	ui->progressBarTextLabel2->setText(tmp.sprintf("%s", request.filePath.c_str()));
-	ui->progressBarTextLabel->setText(tmp.sprintf("0 / %lu bytes", fileSize));
 
 	disableControls();
 
@@ -578,10 +644,7 @@ void StreamingDloadWindow::streamWrite()
 */
 void StreamingDloadWindow::readChunkReadyHandler(StreamingDloadReadWorkerRequest request)
 {
-	// update progress bar
-	QString tmp;
-	ui->progressBar->setValue(request.outSize);
-	ui->progressBarTextLabel->setText(tmp.sprintf("%lu / %lu bytes", ui->progressBar->value(), request.size));
+	setProgress(request.outSize, request.size);
 }
 
 /**
@@ -593,7 +656,7 @@ void StreamingDloadWindow::readCompleteHandler(StreamingDloadReadWorkerRequest r
 
 	enableControls(); 
 	
-	log(tmp.sprintf("Read complete. Contents dumped to %s. Final size is %lu bytes", request.outFilePath.c_str(), request.outSize));
+	log(tmp.sprintf("Read complete. Contents dumped to %s. Final size is %llu bytes", request.outFilePath.c_str(), request.outSize));
 
 	readWorker = nullptr;
 }
@@ -703,6 +766,47 @@ void StreamingDloadWindow::browseForWriteFile()
 	}
 }
 
+/**
+* @brief StreamingDloadWindow::browseForBaseManifest
+*/
+void StreamingDloadWindow::browseForBaseManifest()
+{
+	QString fileName = QFileDialog::getOpenFileName(this, "Select Baseline Manifest", "", "Block Manifest Files (*.bhm)");
+
+	if (fileName.length()) {
+		ui->diffBaseManifestValue->setText(fileName);
+	}
+}
+
+/**
+* @brief StreamingDloadWindow::generateManifest - Generate a block manifest for a selected image
+*/
+void StreamingDloadWindow::generateManifest()
+{
+	QString tmp;
+	QString fileName = QFileDialog::getOpenFileName(this, "Select Image To Hash", "", "Image Files (*.bin *.mbn *.img)");
+
+	if (!fileName.length()) {
+		return;
+	}
+
+	QString outFileName = QFileDialog::getSaveFileName(this, "Save Manifest", fileName + ".bhm", "Block Manifest Files (*.bhm)");
+
+	if (!outFileName.length()) {
+		log("Manifest generation cancelled");
+		return;
+	}
+
+	BlockManifest manifest;
+
+	if (!manifest.generate(fileName.toStdString()) || !manifest.save(outFileName.toStdString())) {
+		log(tmp.sprintf("Error generating manifest for %s", fileName.toStdString().c_str()));
+		return;
+	}
+
+	log(tmp.sprintf("Manifest of %lu blocks saved to %s", manifest.hashes.size(), outFileName.toStdString().c_str()));
+}
+
 /**
 * @brief StreamingDloadWindow::disableControls
 */
@@ -756,6 +860,42 @@ void StreamingDloadWindow::cancelOperation()
 			streamWriteWorker = nullptr;
 			log("Read cancelled");
 		}
+	} else if (nullptr != flashWorker && flashWorker->isRunning()) {
+		QMessageBox::StandardButton userResponse = QMessageBox::question(this, "Confirm", "Really cancel operation?");
+
+		if (userResponse == QMessageBox::Yes) {
+			flashWorker->cancel();
+			if (!flashWorker->wait(5000)) {
+				flashWorker->terminate();
+				flashWorker->wait();
+			}
+			flashWorker = nullptr;
+			log("Flash plan cancelled");
+		}
+	} else if (nullptr != emmcBackupWorker && emmcBackupWorker->isRunning()) {
+		QMessageBox::StandardButton userResponse = QMessageBox::question(this, "Confirm", "Really cancel operation?");
+
+		if (userResponse == QMessageBox::Yes) {
+			emmcBackupWorker->cancel();
+			if (!emmcBackupWorker->wait(5000)) {
+				emmcBackupWorker->terminate();
+				emmcBackupWorker->wait();
+			}
+			emmcBackupWorker = nullptr;
+			log("eMMC backup cancelled");
+		}
+	} else if (nullptr != nandReadWorker && nandReadWorker->isRunning()) {
+		QMessageBox::StandardButton userResponse = QMessageBox::question(this, "Confirm", "Really cancel operation?");
+
+		if (userResponse == QMessageBox::Yes) {
+			nandReadWorker->cancel();
+			if (!nandReadWorker->wait(5000)) {
+				nandReadWorker->terminate();
+				nandReadWorker->wait();
+			}
+			nandReadWorker = nullptr;
+			log("NAND read cancelled");
+		}
 	} else {
 		log("No operation currently running");
 	}
@@ -768,10 +908,7 @@ void StreamingDloadWindow::cancelOperation()
 */
 void StreamingDloadWindow::streamWriteChunkCompleteHandler(StreamingDloadStreamWriteWorkerRequest request)
 {
-	// update progress bar
-	QString tmp;
-	ui->progressBar->setValue(request.outSize);
-	ui->progressBarTextLabel->setText(tmp.sprintf("%lu / %lu bytes", ui->progressBar->value(), ui->progressBar->maximum()));
+	setProgress(request.outSize, request.fileSize);
 }
 
 /**
@@ -785,6 +922,16 @@ void StreamingDloadWindow::streamWriteCompleteHandler(StreamingDloadStreamWriteW
 	
 	log(tmp.sprintf("Write complete"));
 
+	if (request.skippedSize) {
+		log(tmp.sprintf("Skipped %llu unchanged bytes", request.skippedSize));
+	}
+
+	if (request.verify) {
+		log(tmp.sprintf("Verified %llu bytes. Read back took %lld ms of %lld ms (%.1f%%)",
+			request.verifiedSize, request.verifyElapsed, request.elapsed,
+			request.elapsed > 0 ? (request.verifyElapsed * 100.0) / request.elapsed : 0));
+	}
+
 	streamWriteWorker = nullptr;
 }
 
@@ -800,6 +947,400 @@ void StreamingDloadWindow::streamWriteErrorHandler(StreamingDloadStreamWriteWork
 	streamWriteWorker = nullptr;
 }
 
+/**
+* @brief StreamingDloadWindow::browseForFlashPlan
+*/
+void StreamingDloadWindow::browseForFlashPlan()
+{
+	QString fileName = QFileDialog::getOpenFileName(this, "Select Flash Plan", "", "Flash Plan Files (*.plan *.txt)");
+
+	if (fileName.length()) {
+		ui->flashPlanFileValue->setText(fileName);
+	}
+}
+
+/**
+* @brief StreamingDloadWindow::flashPlan - Load the selected flash plan and run it
+*/
+void StreamingDloadWindow::flashPlan()
+{
+	if (!port.isOpen()) {
+		log("Port Not Open");
+		return;
+	}
+
+	QString tmp;
+	QString filePath = ui->flashPlanFileValue->text();
+
+	if (!filePath.length()) {
+		log("No flash plan specified");
+		return;
+	}
+
+	StreamingDloadFlashWorkerRequest request;
+
+	if (!request.plan.load(filePath.toStdString())) {
+		log(tmp.sprintf("Error loading flash plan: %s", request.plan.lastError.c_str()));
+		return;
+	}
+
+	request.unframed = ui->flashPlanUnframedCheckbox->isChecked();
+	request.verify = ui->flashPlanReadBackCheckbox->isChecked();
+	request.totalSize = 0;
+	request.outSize = 0;
+
+	for (auto &image : request.plan.images) {
+		QFileInfo info(QString::fromStdString(image.filePath));
+
+		if (!info.exists()) {
+			log(tmp.sprintf("Image %s does not exist", image.filePath.c_str()));
+			return;
+		}
+
+		request.totalSize += info.size();
+
+		log(tmp.sprintf("%s - %s at 0x%08llX", port.getNamedMultiImage(image.imageType), image.filePath.c_str(), image.address));
+	}
+
+	// setup progress bar
+	ui->progressBar->reset();
+	ui->progressBar->setMinimum(0);
+	setProgress(0, request.totalSize);
+
+	ui->progressBarTextLabel2->setText(filePath);
+
+	disableControls();
+
+	flashWorker = new StreamingDloadFlashWorker(port, request, this);
+	connect(flashWorker, &StreamingDloadFlashWorker::chunkComplete, this, &StreamingDloadWindow::flashPlanChunkCompleteHandler, Qt::QueuedConnection);
+	connect(flashWorker, &StreamingDloadFlashWorker::stepComplete, this, &StreamingDloadWindow::flashPlanStepCompleteHandler, Qt::QueuedConnection);
+	connect(flashWorker, &StreamingDloadFlashWorker::complete, this, &StreamingDloadWindow::flashPlanCompleteHandler);
+	connect(flashWorker, &StreamingDloadFlashWorker::error, this, &StreamingDloadWindow::flashPlanErrorHandler);
+	connect(flashWorker, &StreamingDloadFlashWorker::finished, flashWorker, &QObject::deleteLater);
+
+	flashWorker->start();
+}
+
+/**
+* @brief StreamingDloadWindow::flashPlanChunkCompleteHandler
+*/
+void StreamingDloadWindow::flashPlanChunkCompleteHandler(StreamingDloadFlashWorkerRequest request)
+{
+	setProgress(request.outSize, request.totalSize);
+}
+
+/**
+* @brief StreamingDloadWindow::flashPlanStepCompleteHandler
+*/
+void StreamingDloadWindow::flashPlanStepCompleteHandler(StreamingDloadFlashWorkerRequest request)
+{
+	QString tmp;
+	StreamingDloadFlashWorkerStep& step = request.steps.back();
+
+	log(tmp.sprintf("%s complete in %lld ms", step.name.c_str(), step.elapsed));
+}
+
+/**
+* @brief StreamingDloadWindow::flashPlanCompleteHandler
+*/
+void StreamingDloadWindow::flashPlanCompleteHandler(StreamingDloadFlashWorkerRequest request)
+{
+	enableControls();
+
+	log("Flash plan complete");
+
+	logFlashReport(request);
+
+	flashWorker = nullptr;
+}
+
+/**
+* @brief StreamingDloadWindow::flashPlanErrorHandler
+*/
+void StreamingDloadWindow::flashPlanErrorHandler(StreamingDloadFlashWorkerRequest request, QString msg)
+{
+	log(msg);
+
+	logFlashReport(request);
+
+	enableControls();
+
+	flashWorker = nullptr;
+}
+
+/**
+* @brief StreamingDloadWindow::browseForEmmcBackupDirectory
+*/
+void StreamingDloadWindow::browseForEmmcBackupDirectory()
+{
+	QString directory = QFileDialog::getExistingDirectory(this, "Select Backup Directory");
+
+	if (directory.length()) {
+		ui->emmcBackupDirectoryValue->setText(directory);
+	}
+}
+
+/**
+* @brief StreamingDloadWindow::emmcBackup - Dump every partition of the eMMC user area described by its GPT
+*/
+void StreamingDloadWindow::emmcBackup()
+{
+	if (!port.isOpen()) {
+		log("Port Not Open");
+		return;
+	}
+
+	QString tmp;
+	QString directory = ui->emmcBackupDirectoryValue->text();
+
+	if (!directory.length() || !QFileInfo(directory).isDir()) {
+		log("Select a directory to save the backup to");
+		return;
+	}
+
+	if (!port.state.sectorAddresses) {
+		log("Sector addressing is not enabled, partitions past 4GB will fail to read");
+	}
+
+	StreamingDloadEmmcBackupWorkerRequest request = {};
+	request.outDirectory = directory.toStdString();
+	request.stepSize = port.state.hello.maxPreferredBlockSize;
+
+	for (QString name : ui->emmcBackupSkipValue->text().split(",", QString::SkipEmptyParts)) {
+		request.skip.push_back(name.trimmed().toStdString());
+	}
+
+	log(tmp.sprintf("Backing up the eMMC user partition to %s", request.outDirectory.c_str()));
+
+	ui->progressBar->reset();
+	ui->progressBar->setMinimum(0);
+	ui->progressBar->setValue(0);
+
+	ui->progressBarTextLabel2->setText(directory);
+
+	disableControls();
+
+	emmcBackupWorker = new StreamingDloadEmmcBackupWorker(port, request, this);
+	connect(emmcBackupWorker, &StreamingDloadEmmcBackupWorker::chunkComplete, this, &StreamingDloadWindow::emmcBackupChunkCompleteHandler, Qt::QueuedConnection);
+	connect(emmcBackupWorker, &StreamingDloadEmmcBackupWorker::partitionComplete, this, &StreamingDloadWindow::emmcBackupPartitionCompleteHandler, Qt::QueuedConnection);
+	connect(emmcBackupWorker, &StreamingDloadEmmcBackupWorker::complete, this, &StreamingDloadWindow::emmcBackupCompleteHandler);
+	connect(emmcBackupWorker, &StreamingDloadEmmcBackupWorker::error, this, &StreamingDloadWindow::emmcBackupErrorHandler);
+	connect(emmcBackupWorker, &StreamingDloadEmmcBackupWorker::finished, emmcBackupWorker, &QObject::deleteLater);
+
+	emmcBackupWorker->start();
+}
+
+/**
+* @brief StreamingDloadWindow::emmcBackupChunkCompleteHandler
+*/
+void StreamingDloadWindow::emmcBackupChunkCompleteHandler(StreamingDloadEmmcBackupWorkerRequest request)
+{
+	setProgress(request.outSize, request.totalSize);
+}
+
+/**
+* @brief StreamingDloadWindow::emmcBackupPartitionCompleteHandler
+*/
+void StreamingDloadWindow::emmcBackupPartitionCompleteHandler(StreamingDloadEmmcBackupWorkerRequest request)
+{
+	QString tmp;
+	StreamingDloadEmmcBackupPartition& entry = request.partitions[request.current];
+
+	log(tmp.sprintf("%s saved to %s", entry.partition.name.c_str(), entry.fileName.c_str()));
+}
+
+/**
+* @brief StreamingDloadWindow::emmcBackupCompleteHandler
+*/
+void StreamingDloadWindow::emmcBackupCompleteHandler(StreamingDloadEmmcBackupWorkerRequest request)
+{
+	QString tmp;
+
+	enableControls();
+
+	for (auto &entry : request.partitions) {
+		if (entry.skipped) {
+			log(tmp.sprintf("Skipped %s", entry.partition.name.c_str()));
+		}
+	}
+
+	log(tmp.sprintf("eMMC backup complete. %llu bytes saved", request.outSize));
+
+	emmcBackupWorker = nullptr;
+}
+
+/**
+* @brief StreamingDloadWindow::emmcBackupErrorHandler
+*/
+void StreamingDloadWindow::emmcBackupErrorHandler(StreamingDloadEmmcBackupWorkerRequest request, QString msg)
+{
+	log(msg);
+
+	enableControls();
+
+	emmcBackupWorker = nullptr;
+}
+
+/**
+* @brief StreamingDloadWindow::browseForNandReadFile
+*/
+void StreamingDloadWindow::browseForNandReadFile()
+{
+	QString fileName = QFileDialog::getSaveFileName(this, "Save NAND Data", "", "Binary Files (*.bin)");
+
+	if (fileName.length()) {
+		ui->nandReadFileValue->setText(fileName);
+	}
+}
+
+/**
+* @brief StreamingDloadWindow::nandRead - Read raw NAND pages with the device ECC off and correct them on the host
+*/
+void StreamingDloadWindow::nandRead()
+{
+	if (!port.isOpen()) {
+		log("Port Not Open");
+		return;
+	}
+
+	QString tmp;
+	StreamingDloadNandReadWorkerRequest request = {};
+
+	if (!ui->nandReadAddressValue->text().length() || !ui->nandReadPagesValue->text().length()) {
+		log("Address and page count are required");
+		return;
+	}
+
+	if (!ui->nandReadFileValue->text().length()) {
+		log("Select a file to save the corrected data to");
+		return;
+	}
+
+	request.address = std::stoull(ui->nandReadAddressValue->text().toStdString().c_str(), nullptr, 16);
+	request.pageCount = std::stoull(ui->nandReadPagesValue->text().toStdString().c_str(), nullptr, 10);
+	request.layout.pageSize = ui->nandPageSizeValue->text().toUInt();
+	request.layout.spareSize = ui->nandSpareSizeValue->text().toUInt();
+	request.layout.codewordSize = ui->nandCodewordSizeValue->text().toUInt();
+	request.layout.eccType = (NandEccType)ui->nandEccValue->currentData().toInt();
+	request.outFilePath = ui->nandReadFileValue->text().toStdString();
+
+	if (!request.pageCount || !request.layout.pageSize || !request.layout.codewordSize) {
+		log("Page count, page size and codeword size must be greater than 0");
+		return;
+	}
+
+	log(tmp.sprintf("Reading %llu raw pages of %lu + %lu bytes from 0x%08llX, correcting with %s",
+		request.pageCount, request.layout.pageSize, request.layout.spareSize, request.address, ui->nandEccValue->currentText().toStdString().c_str()));
+
+	ui->progressBar->reset();
+	ui->progressBar->setMinimum(0);
+	ui->progressBar->setValue(0);
+
+	ui->progressBarTextLabel2->setText(ui->nandReadFileValue->text());
+
+	disableControls();
+
+	nandReadWorker = new StreamingDloadNandReadWorker(port, request, this);
+	connect(nandReadWorker, &StreamingDloadNandReadWorker::chunkComplete, this, &StreamingDloadWindow::nandReadChunkCompleteHandler, Qt::QueuedConnection);
+	connect(nandReadWorker, &StreamingDloadNandReadWorker::complete, this, &StreamingDloadWindow::nandReadCompleteHandler);
+	connect(nandReadWorker, &StreamingDloadNandReadWorker::error, this, &StreamingDloadWindow::nandReadErrorHandler);
+	connect(nandReadWorker, &StreamingDloadNandReadWorker::finished, nandReadWorker, &QObject::deleteLater);
+
+	nandReadWorker->start();
+}
+
+/**
+* @brief StreamingDloadWindow::nandReadChunkCompleteHandler
+*/
+void StreamingDloadWindow::nandReadChunkCompleteHandler(StreamingDloadNandReadWorkerRequest request)
+{
+	setProgress(request.pagesRead, request.pageCount);
+}
+
+/**
+* @brief StreamingDloadWindow::nandReadCompleteHandler
+*/
+void StreamingDloadWindow::nandReadCompleteHandler(StreamingDloadNandReadWorkerRequest request)
+{
+	QString tmp;
+
+	enableControls();
+
+	log(tmp.sprintf("NAND read complete. %llu pages in %lld ms, %llu bits corrected", request.pagesWritten, request.elapsed, request.correctedBits));
+
+	if (request.uncorrectablePages) {
+		log(tmp.sprintf("%llu pages had uncorrectable codewords:", request.uncorrectablePages));
+
+		for (auto page : request.badPages) {
+			log(tmp.sprintf("  Page %llu at 0x%08llX", page, request.address + page * (request.layout.pageSize + request.layout.spareSize)));
+		}
+	}
+
+	nandReadWorker = nullptr;
+}
+
+/**
+* @brief StreamingDloadWindow::nandReadErrorHandler
+*/
+void StreamingDloadWindow::nandReadErrorHandler(StreamingDloadNandReadWorkerRequest request, QString msg)
+{
+	log(msg);
+
+	enableControls();
+
+	nandReadWorker = nullptr;
+}
+
+/**
+* @brief StreamingDloadWindow::setProgress - Update the progress bar and its label. The bar
+*                                            only holds an int, so transfers past 2GB are
+*                                            shown scaled down.
+*/
+void StreamingDloadWindow::setProgress(uint64_t value, uint64_t total)
+{
+	QString tmp;
+	int shift = 0;
+
+	while ((total >> shift) > 0x7FFFFFFF) {
+		shift++;
+	}
+
+	ui->progressBar->setMaximum(total >> shift);
+	ui->progressBar->setValue(value >> shift);
+	ui->progressBarTextLabel->setText(tmp.sprintf("%llu / %llu bytes", value, total));
+}
+
+/**
+* @brief StreamingDloadWindow::logFlashReport - Log the per step timings of a flash plan run
+*/
+void StreamingDloadWindow::logFlashReport(StreamingDloadFlashWorkerRequest& request)
+{
+	QString tmp;
+	qint64 total = 0;
+	qint64 verifyTotal = 0;
+
+	if (!request.steps.size()) {
+		return;
+	}
+
+	log(tmp.sprintf("%-40s %12s %10s %10s %12s", "Step", "Bytes", "Wait ms", "Time ms", "KB/s"));
+
+	for (auto &step : request.steps) {
+		double rate = step.elapsed > 0 ? (step.size / 1024.0) / (step.elapsed / 1000.0) : 0;
+
+		log(tmp.sprintf("%-40s %12lu %10lld %10lld %12.2f", step.name.c_str(), step.size, step.prefetchWait, step.elapsed, rate));
+
+		total += step.prefetchWait + step.elapsed;
+		verifyTotal += step.verifyElapsed;
+	}
+
+	log(tmp.sprintf("Total: %llu bytes in %lld ms", request.outSize, total));
+
+	if (request.verify) {
+		log(tmp.sprintf("Read back took %lld ms of %lld ms (%.1f%%)", verifyTotal, total, total > 0 ? (verifyTotal * 100.0) / total : 0));
+	}
+}
+
 /**
 * @brief StreamingDloadWindow::clearLog
 */
@@ -13,12 +13,16 @@
 
 #include <QMainWindow>
 #include <QFileDialog>
+#include <QFileInfo>
 #include <QMessageBox>
 #include "ui_streaming_dload_window.h"
 #include "qc/streaming_dload.h"
 #include "serial/streaming_dload_serial.h"
 #include "worker/streaming_dload_read_worker.h"
 #include "worker/streaming_dload_stream_write_worker.h"
+#include "worker/streaming_dload_flash_worker.h"
+#include "worker/streaming_dload_emmc_backup_worker.h"
+#include "worker/streaming_dload_nand_read_worker.h"
 #include <iostream>
 #include <fstream>
 
@@ -59,6 +63,11 @@ namespace OpenPST{
              */
             void sendHello();
 
+            /**
+            * @brief calibrateBlockSize
+            */
+            void calibrateBlockSize();
+
             /**
             * @brief sendUnlock
             */
@@ -148,6 +157,16 @@ namespace OpenPST{
             * @brief browseForWriteFile
             */
             void browseForWriteFile();
+
+            /**
+            * @brief browseForBaseManifest
+            */
+            void browseForBaseManifest();
+
+            /**
+            * @brief generateManifest - Generate a block manifest for a selected image
+            */
+            void generateManifest();
             
             /**
             * @brief readChunkReadyHandler - callback function to update UI when a read chunk is ready. 
@@ -181,6 +200,94 @@ namespace OpenPST{
             */
             void streamWriteErrorHandler(StreamingDloadStreamWriteWorkerRequest request, QString msg);
 
+            /**
+            * @brief browseForFlashPlan
+            */
+            void browseForFlashPlan();
+
+            /**
+            * @brief flashPlan - Load the selected flash plan and run it
+            */
+            void flashPlan();
+
+            /**
+            * @brief flashPlanChunkCompleteHandler - callback function to update UI when a flash plan chunk has been written.
+            *                                     used to increment the progress bar
+            */
+            void flashPlanChunkCompleteHandler(StreamingDloadFlashWorkerRequest request);
+
+            /**
+            * @brief flashPlanStepCompleteHandler - callback function to update UI when a flash plan step has finished
+            */
+            void flashPlanStepCompleteHandler(StreamingDloadFlashWorkerRequest request);
+
+            /**
+            * @brief flashPlanCompleteHandler - callback function to update UI when the flash worker completes the plan
+            */
+            void flashPlanCompleteHandler(StreamingDloadFlashWorkerRequest request);
+
+            /**
+            * @brief flashPlanErrorHandler - callback function to update UI when the flash worker encounters an error
+            */
+            void flashPlanErrorHandler(StreamingDloadFlashWorkerRequest request, QString msg);
+
+            /**
+            * @brief browseForEmmcBackupDirectory
+            */
+            void browseForEmmcBackupDirectory();
+
+            /**
+            * @brief emmcBackup - Dump every partition of the eMMC user area described by its GPT
+            */
+            void emmcBackup();
+
+            /**
+            * @brief emmcBackupChunkCompleteHandler - callback function to update UI when a backup chunk has been read.
+            *                                      used to increment the progress bar
+            */
+            void emmcBackupChunkCompleteHandler(StreamingDloadEmmcBackupWorkerRequest request);
+
+            /**
+            * @brief emmcBackupPartitionCompleteHandler - callback function to update UI when a partition has been dumped
+            */
+            void emmcBackupPartitionCompleteHandler(StreamingDloadEmmcBackupWorkerRequest request);
+
+            /**
+            * @brief emmcBackupCompleteHandler - callback function to update UI when the backup worker completes
+            */
+            void emmcBackupCompleteHandler(StreamingDloadEmmcBackupWorkerRequest request);
+
+            /**
+            * @brief emmcBackupErrorHandler - callback function to update UI when the backup worker encounters an error
+            */
+            void emmcBackupErrorHandler(StreamingDloadEmmcBackupWorkerRequest request, QString msg);
+
+            /**
+            * @brief browseForNandReadFile
+            */
+            void browseForNandReadFile();
+
+            /**
+            * @brief nandRead - Read raw NAND pages with the device ECC off and correct them on the host
+            */
+            void nandRead();
+
+            /**
+            * @brief nandReadChunkCompleteHandler - callback function to update UI when a batch of pages has been read.
+            *                                    used to increment the progress bar
+            */
+            void nandReadChunkCompleteHandler(StreamingDloadNandReadWorkerRequest request);
+
+            /**
+            * @brief nandReadCompleteHandler - callback function to update UI when the NAND read worker completes
+            */
+            void nandReadCompleteHandler(StreamingDloadNandReadWorkerRequest request);
+
+            /**
+            * @brief nandReadErrorHandler - callback function to update UI when the NAND read worker encounters an error
+            */
+            void nandReadErrorHandler(StreamingDloadNandReadWorkerRequest request, QString msg);
+
             /**
             * @brief cancelOperation - Cancels any currently running workers
             */          
@@ -212,6 +319,22 @@ namespace OpenPST{
             serial::PortInfo currentPort;
             StreamingDloadReadWorker* readWorker;
             StreamingDloadStreamWriteWorker* streamWriteWorker;
+            StreamingDloadFlashWorker* flashWorker;
+            StreamingDloadEmmcBackupWorker* emmcBackupWorker;
+            StreamingDloadNandReadWorker* nandReadWorker;
+
+            /**
+            * @brief setProgress - Update the progress bar and its label
+            *
+            * @param uint64_t value
+            * @param uint64_t total
+            */
+            void setProgress(uint64_t value, uint64_t total);
+
+            /**
+            * @brief logFlashReport - Log the per step timings of a flash plan run
+            */
+            void logFlashReport(StreamingDloadFlashWorkerRequest& request);
         };
 }
 #endif // _GUI_STREAMING_DLOAD_WINDOW_H
@@ -22,6 +22,10 @@
 #define DIAG_NV_PEEK_MAX_SIZE   32
 #endif
 
+#ifndef DIAG_MEMORY_PEEK_MAX_SIZE
+#define DIAG_MEMORY_PEEK_MAX_SIZE   16 // 16 bytes, 8 words or 4 dwords per peek
+#endif
+
 #ifndef DIAG_MAX_PACKET_SIZE
 #define DIAG_MAX_PACKET_SIZE (2048 * 2)
 #endif
@@ -309,6 +313,42 @@ enum QcdmRuimConfigType : uint8_t {
 	kQcdmRuimConfigTypeGsm1x = 0x03
 };
 
+/**
+* NV status, trails the item data in NV read and write responses
+*/
+enum QcdmNvStatus : uint16_t {
+	kQcdmNvStatusDone         = 0x00,
+	kQcdmNvStatusBusy         = 0x01,
+	kQcdmNvStatusBadCommand   = 0x02,
+	kQcdmNvStatusFull         = 0x03,
+	kQcdmNvStatusFail         = 0x04,
+	kQcdmNvStatusInactive     = 0x05,
+	kQcdmNvStatusBadParam     = 0x06,
+	kQcdmNvStatusReadOnly     = 0x07,
+	kQcdmNvStatusBadType      = 0x08,
+	kQcdmNvStatusNoMemory     = 0x09,
+	kQcdmNvStatusNotAllocated = 0x0A
+};
+
+/**
+* DIAG_LOG_CONFIG_F operations
+*/
+enum QcdmLogConfigOperation : uint32_t {
+	kQcdmLogConfigDisable   = 0x00,
+	kQcdmLogConfigGetRanges = 0x01,
+	kQcdmLogConfigSetMask   = 0x03,
+	kQcdmLogConfigGetMask   = 0x04
+};
+
+/**
+* DIAG_EXT_MSG_CONFIG_F sub commands
+*/
+enum QcdmExtMsgConfigOperation : uint8_t {
+	kQcdmExtMsgConfigGetRanges      = 0x01,
+	kQcdmExtMsgConfigSetRtMask      = 0x04,
+	kQcdmExtMsgConfigSetAllRtMasks  = 0x05
+};
+
 
 PACKED(typedef struct QcdmRequestHeader{
     uint8_t command;
@@ -386,6 +426,22 @@ PACKED(typedef struct QcdmNvPeekResponse {
 	uint8_t		data[DIAG_NV_PEEK_MAX_SIZE];
 }) QcdmNvPeekResponse;
 
+/**
+* Memory peek, DIAG_MEMORY_PEEK_BYTE_F, DIAG_MEMORY_PEEK_WORD_F or DIAG_MEMORY_PEEK_DWORD_F
+*/
+PACKED(typedef struct QcdmMemoryPeekRequest{
+    uint8_t  command;
+    uint32_t address;
+    uint16_t length;    // in bytes, words or dwords for the command
+}) QcdmMemoryPeekRequest;
+
+PACKED(typedef struct QcdmMemoryPeekResponse{
+    uint8_t  command;
+    uint32_t address;
+    uint16_t length;
+    uint8_t  data[DIAG_MEMORY_PEEK_MAX_SIZE];
+}) QcdmMemoryPeekResponse;
+
 /**
 * Subsystem General 
 */
@@ -417,6 +473,81 @@ PACKED(typedef struct QcdmLogResponse{
     uint8_t  logs[0];
 }) QcdmLogResponse;
 
+/**
+* Streamed log packet, follows QcdmLogResponse in a DIAG_LOG_F packet
+*/
+PACKED(typedef struct QcdmLogHeader{
+    uint16_t length;        // this header and the log payload
+    uint16_t logCode;       // equipment id << 12 | log item
+    uint64_t timestamp;     // upper 48 bits in 1.25ms units since Jan 6 1980
+}) QcdmLogHeader;
+
+/**
+* Streamed event reports, a DIAG_EVENT_REPORT_F packet holds one or more events
+*
+* Each event starts with a uint16_t: id in bits 0-11, payload length in bits 13-14
+* (0 - 2 bytes, 3 - a length byte follows the timestamp) and bit 15 set when only
+* bits 16-31 of the timestamp are sent, as a uint16_t, instead of all 64 bits
+*/
+PACKED(typedef struct QcdmEventReportResponse{
+    uint8_t  command;
+    uint16_t length;        // bytes of events
+    uint8_t  events[0];
+}) QcdmEventReportResponse;
+
+/**
+* Streamed extended (F3) message, args are followed by the null terminated
+* format string and file name
+*/
+PACKED(typedef struct QcdmExtMsgResponse{
+    uint8_t  command;
+    uint8_t  timestampType;
+    uint8_t  argCount;
+    uint8_t  dropCount;
+    uint64_t timestamp;
+    uint16_t line;
+    uint16_t subsystem;
+    uint32_t subsystemMask;
+    uint32_t args[0];
+}) QcdmExtMsgResponse;
+
+/**
+* Log masks, one bit per log code within an equipment id (log code >> 12)
+*/
+PACKED(typedef struct QcdmLogConfigRequest{
+    uint8_t  command;
+    uint8_t  reserved[3];
+    uint32_t operation;
+    uint32_t equipmentId;
+    uint32_t items;         // bits in mask, highest log item + 1
+    uint8_t  mask[0];
+}) QcdmLogConfigRequest;
+
+PACKED(typedef struct QcdmLogConfigResponse{
+    uint8_t  command;
+    uint8_t  reserved[3];
+    uint32_t operation;
+    uint32_t status;        // 0 on success
+}) QcdmLogConfigResponse;
+
+/**
+* Event reports
+*/
+PACKED(typedef struct QcdmEventReportRequest{
+    uint8_t command;
+    uint8_t enable;
+}) QcdmEventReportRequest;
+
+/**
+* Extended message masks
+*/
+PACKED(typedef struct QcdmExtMsgConfigRequest{
+    uint8_t  command;
+    uint8_t  operation;
+    uint16_t reserved;
+    uint32_t mask;          // MSG_LEGACY_* level bits, applied to every subsystem
+}) QcdmExtMsgConfigRequest;
+
 /**
 * Version
 */
@@ -0,0 +1,220 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_capture.cpp
+* @class OpenPST::DmCapture
+* @package OpenPST
+* @brief Continuous capture of DIAG log, event and message traffic to a file
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "dm_capture.h"
+
+using namespace OpenPST;
+
+/**
+* @brief DmCapture - Constructor
+*
+* @param DmClient& client
+* @param size_t ringSize
+*/
+DmCapture::DmCapture(DmClient& client, size_t ringSize) :
+    client(client),
+    ring(ringSize),
+    subscription(0),
+    reading(false),
+    bytesRead(0),
+    frames(0),
+    framesDropped(0),
+    bytesWritten(0),
+    ringHighWater(0)
+{
+
+}
+
+/**
+* @brief ~DmCapture - Deconstructor
+*/
+DmCapture::~DmCapture()
+{
+    stop();
+}
+
+/**
+* @brief start - Start capturing to a file
+*
+* @param std::string filePath
+* @return bool
+*/
+bool DmCapture::start(std::string filePath)
+{
+    DmCaptureFileHeader header = {};
+
+    if (writer.joinable()) {
+        return false;
+    }
+
+    if (!client.isRunning()) {
+        LOGE("Capture needs a running DIAG client\n");
+        return false;
+    }
+
+    file.open(filePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open()) {
+        LOGE("Could not open %s\n", filePath.c_str());
+        return false;
+    }
+
+    header.magic        = DM_CAPTURE_MAGIC;
+    header.version      = DM_CAPTURE_VERSION;
+    header.headerSize   = sizeof(header);
+    header.started      = (uint64_t)std::time(nullptr);
+
+    file.write((char*)&header, sizeof(header));
+
+    bytesRead       = 0;
+    frames          = 0;
+    framesDropped   = 0;
+    bytesWritten    = sizeof(header);
+    ringHighWater   = 0;
+
+    frame.reserve(DM_CAPTURE_MAX_FRAME_SIZE);
+
+    reading = true;
+
+    startedAt = stoppedAt = std::chrono::steady_clock::now();
+
+    writer = std::thread(&DmCapture::writeLoop, this);
+
+    subscription = client.subscribeAll([this](const uint8_t* packet, size_t size) {
+        receive(packet, size);
+    });
+
+    return true;
+}
+
+/**
+* @brief stop - Unsubscribe and wait for everything received to reach the file
+*
+* @return void
+*/
+void DmCapture::stop()
+{
+    if (!writer.joinable()) {
+        return;
+    }
+
+    // no callback is running once this returns, nothing more is queued
+    client.unsubscribe(subscription);
+
+    reading = false;
+
+    writer.join();
+
+    file.close();
+
+    stoppedAt = std::chrono::steady_clock::now();
+}
+
+/**
+* @brief isRunning
+*
+* @return bool
+*/
+bool DmCapture::isRunning()
+{
+    return reading && client.isRunning();
+}
+
+/**
+* @brief getStats
+*
+* @return DmCaptureStats
+*/
+DmCaptureStats DmCapture::getStats()
+{
+    DmCaptureStats stats = {};
+
+    auto end = writer.joinable() ? std::chrono::steady_clock::now() : stoppedAt;
+
+    stats.bytesRead     = bytesRead;
+    stats.frames        = frames;
+    stats.framesDropped = framesDropped;
+    stats.bytesWritten  = bytesWritten;
+    stats.ringHighWater = ringHighWater;
+    stats.elapsed       = std::chrono::duration_cast<std::chrono::milliseconds>(end - startedAt).count();
+
+    return stats;
+}
+
+/**
+* @brief writeLoop - Writer thread, ring to file
+*/
+void DmCapture::writeLoop()
+{
+    std::vector<uint8_t> chunk(DM_CAPTURE_WRITE_SIZE);
+    size_t size;
+
+    while (true) {
+        // check before reading so nothing queued before the capture stopped is missed
+        bool done = !reading;
+
+        if ((size = ring.read(&chunk[0], chunk.size())) > 0) {
+            file.write((char*)&chunk[0], size);
+            bytesWritten.fetch_add(size, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (done) {
+            break;
+        }
+
+        sleep(1);
+    }
+
+    file.flush();
+}
+
+/**
+* @brief receive - Frame a packet from the client and queue it, on the client reader thread
+*
+* @param uint8_t* packet
+* @param size_t size
+*/
+void DmCapture::receive(const uint8_t* packet, size_t size)
+{
+    bytesRead.fetch_add(size, std::memory_order_relaxed);
+
+    frame.clear();
+
+    hdlc_append(frame, packet, size);
+
+    // stored between the flags, as it was on the wire
+    queue(&frame[1], frame.size() - 2);
+
+    size_t used = ring.getUsed();
+
+    if (used > ringHighWater.load(std::memory_order_relaxed)) {
+        ringHighWater.store(used, std::memory_order_relaxed);
+    }
+}
+
+/**
+* @brief queue - Queue a frame with its length prefix, or drop it
+*
+* @param uint8_t* frame
+* @param size_t size
+*/
+void DmCapture::queue(const uint8_t* frame, size_t size)
+{
+    uint16_t length = (uint16_t)size;
+
+    if (size > DM_CAPTURE_MAX_FRAME_SIZE || !ring.write((uint8_t*)&length, sizeof(length), frame, size)) {
+        framesDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    frames.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,153 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_capture.h
+* @class OpenPST::DmCapture
+* @package OpenPST
+* @brief Continuous capture of DIAG log, event and message traffic to a file
+*
+* Once log masks, event reports or message masks are turned on the device
+* streams packets without being asked. The capture subscribes to every
+* unsolicited packet of a DmClient, so requests can still be sent through the
+* client while capturing, and answers to them are not captured. Each packet is
+* framed again and queued into a lock free ring on the client reader thread,
+* and a writer thread moves the ring to disk. Frames are stored escaped and
+* with their CRC, as they came over the port; frames that do not fit in the
+* ring are dropped whole and counted.
+*
+* File layout, all values little endian:
+*
+*   [DmCaptureFileHeader][uint16_t length][frame] ... [uint16_t length][frame]
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_CAPTURE_H_
+#define _QC_DM_CAPTURE_H_
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include "include/definitions.h"
+#include "qc/dm.h"
+#include "qc/hdlc.h"
+#include "qc/dm_client.h"
+#include "util/byte_ring.h"
+#include "util/sleep.h"
+
+#define DM_CAPTURE_MAGIC            0x50434D44 // DMCP
+#define DM_CAPTURE_VERSION          1
+#define DM_CAPTURE_RING_SIZE        (8 * 1024 * 1024)
+#define DM_CAPTURE_WRITE_SIZE       (256 * 1024)
+#define DM_CAPTURE_MAX_FRAME_SIZE   0xFFFF
+
+namespace OpenPST {
+
+    PACKED(typedef struct {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t headerSize;
+        uint64_t started;       // unix time
+    }) DmCaptureFileHeader;
+
+    struct DmCaptureStats {
+        uint64_t bytesRead;     // packets from the client, unescaped without their CRC
+        uint64_t frames;        // queued for the file
+        uint64_t framesDropped; // ring full or frame too large
+        uint64_t bytesWritten;  // to the file, including the header and length prefixes
+        size_t   ringHighWater; // most bytes waiting in the ring at once
+        uint64_t elapsed;       // ms
+    };
+
+    /**
+    * @brief OpenPST::DmCapture
+    */
+    class DmCapture {
+        public:
+            /**
+            * @brief DmCapture - Constructor
+            *
+            * @param DmClient& client - Started by the caller and kept running for the capture
+            * @param size_t ringSize - Bytes buffered between the client reader and the writer
+            */
+            DmCapture(DmClient& client, size_t ringSize = DM_CAPTURE_RING_SIZE);
+
+            /**
+            * @brief ~DmCapture - Deconstructor, stops a running capture
+            */
+            ~DmCapture();
+
+            /**
+            * @brief start - Start capturing to a file
+            *
+            * @param std::string filePath
+            * @return bool - false if already running or the file could not be opened
+            */
+            bool start(std::string filePath);
+
+            /**
+            * @brief stop - Unsubscribe and wait for everything received to reach the file
+            *
+            * @return void
+            */
+            void stop();
+
+            /**
+            * @brief isRunning - false once stopped, or after the client stopped
+            *
+            * @return bool
+            */
+            bool isRunning();
+
+            /**
+            * @brief getStats - Counters of the current or last capture
+            *
+            * @return DmCaptureStats
+            */
+            DmCaptureStats getStats();
+
+        private:
+            DmClient& client;
+            ByteRing ring;
+            std::ofstream file;
+            std::thread writer;
+            int subscription;
+            std::atomic<bool> reading;
+            std::atomic<uint64_t> bytesRead;
+            std::atomic<uint64_t> frames;
+            std::atomic<uint64_t> framesDropped;
+            std::atomic<uint64_t> bytesWritten;
+            std::atomic<size_t> ringHighWater;
+            std::chrono::steady_clock::time_point startedAt;
+            std::chrono::steady_clock::time_point stoppedAt;
+            std::vector<uint8_t> frame;     // client reader thread only
+
+            /**
+            * @brief writeLoop - Writer thread, ring to file
+            */
+            void writeLoop();
+
+            /**
+            * @brief receive - Frame a packet from the client and queue it, on the client reader thread
+            *
+            * @param uint8_t* packet
+            * @param size_t size
+            */
+            void receive(const uint8_t* packet, size_t size);
+
+            /**
+            * @brief queue - Queue a frame with its length prefix, or drop it
+            *
+            * @param uint8_t* frame
+            * @param size_t size
+            */
+            void queue(const uint8_t* frame, size_t size);
+    };
+}
+
+#endif // _QC_DM_CAPTURE_H_
@@ -0,0 +1,765 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_capture_decoder.cpp
+* @class OpenPST::DmCaptureDecoder
+* @package OpenPST
+* @brief Offline decoder for captured DIAG log, event and message traffic
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "dm_capture_decoder.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace OpenPST;
+
+/**
+* @brief DmCaptureDecoder - Constructor
+*/
+DmCaptureDecoder::DmCaptureDecoder() :
+    data(nullptr),
+    size(0)
+#ifdef _WIN32
+    ,fileHandle(INVALID_HANDLE_VALUE),
+    mappingHandle(nullptr)
+#endif
+{
+    memset(&stats, 0x00, sizeof(stats));
+}
+
+/**
+* @brief ~DmCaptureDecoder - Deconstructor, unmaps the file
+*/
+DmCaptureDecoder::~DmCaptureDecoder()
+{
+    close();
+}
+
+/**
+* @brief open - Map a DmCapture file or a raw HDLC stream and index its frames
+*
+* @param std::string filePath
+* @param unsigned int threads - 0 to use all available cores
+*
+* @return bool
+*/
+bool DmCaptureDecoder::open(std::string filePath, unsigned int threads)
+{
+    close();
+
+#ifdef _WIN32
+    LARGE_INTEGER fileSize;
+
+    fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (fileHandle == INVALID_HANDLE_VALUE || !GetFileSizeEx(fileHandle, &fileSize) || !fileSize.QuadPart) {
+        LOGE("Could not open %s\n", filePath.c_str());
+        close();
+        return false;
+    }
+
+    mappingHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    if (mappingHandle != nullptr) {
+        data = (const uint8_t*)MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    }
+
+    size = (size_t)fileSize.QuadPart;
+#else
+    struct stat fileStat;
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+
+    if (fd < 0 || fstat(fd, &fileStat) != 0 || !fileStat.st_size) {
+        LOGE("Could not open %s\n", filePath.c_str());
+
+        if (fd >= 0) {
+            ::close(fd);
+        }
+
+        return false;
+    }
+
+    void* mapped = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    ::close(fd);
+
+    if (mapped != MAP_FAILED) {
+        data = (const uint8_t*)mapped;
+        size = fileStat.st_size;
+    }
+#endif
+
+    if (data == nullptr) {
+        LOGE("Could not map %s\n", filePath.c_str());
+        close();
+        return false;
+    }
+
+    if (!threads) {
+        threads = std::thread::hardware_concurrency();
+    }
+
+    if (!threads) {
+        threads = 1;
+    }
+
+    const DmCaptureFileHeader* header = (const DmCaptureFileHeader*)data;
+
+    if (size >= sizeof(DmCaptureFileHeader) && header->magic == DM_CAPTURE_MAGIC) {
+        if (!indexCapture()) {
+            LOGE("%s is not a supported capture\n", filePath.c_str());
+            close();
+            return false;
+        }
+    } else {
+        indexStream(threads);
+    }
+
+    return true;
+}
+
+/**
+* @brief close - Unmap the file, invalidates all records
+*
+* @return void
+*/
+void DmCaptureDecoder::close()
+{
+#ifdef _WIN32
+    if (data != nullptr) {
+        UnmapViewOfFile(data);
+    }
+
+    if (mappingHandle != nullptr) {
+        CloseHandle(mappingHandle);
+    }
+
+    if (fileHandle != INVALID_HANDLE_VALUE) {
+        CloseHandle(fileHandle);
+    }
+
+    fileHandle = INVALID_HANDLE_VALUE;
+    mappingHandle = nullptr;
+#else
+    if (data != nullptr) {
+        munmap((void*)data, size);
+    }
+#endif
+
+    data = nullptr;
+    size = 0;
+
+    frames.clear();
+    ranges.clear();
+}
+
+/**
+* @brief getFrameCount
+*
+* @return size_t
+*/
+size_t DmCaptureDecoder::getFrameCount()
+{
+    return frames.size();
+}
+
+/**
+* @brief decode - Decode every frame and merge the matching records in timestamp order
+*
+* @param DmCaptureFilter& filter
+* @param std::vector<DmCaptureRecord>& records - Replaced with the result
+* @param unsigned int threads - 0 to use all available cores
+*
+* @return bool - false if no file is open
+*/
+bool DmCaptureDecoder::decode(const DmCaptureFilter& filter, std::vector<DmCaptureRecord>& records, unsigned int threads)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    records.clear();
+
+    if (data == nullptr) {
+        return false;
+    }
+
+    memset(&stats, 0x00, sizeof(stats));
+
+    // flag tables so the filter costs one lookup per record
+    std::vector<bool> logCodes(0x10000, filter.logCodes.empty());
+    std::vector<bool> eventIds(0x1000, filter.eventIds.empty());
+
+    for (auto code : filter.logCodes) {
+        logCodes[code] = true;
+    }
+
+    for (auto id : filter.eventIds) {
+        eventIds[id & 0xFFF] = true;
+    }
+
+    size_t rangeCount = (frames.size() + DM_CAPTURE_DECODE_RANGE_FRAMES - 1) / DM_CAPTURE_DECODE_RANGE_FRAMES;
+
+    ranges.clear();
+    ranges.resize(rangeCount);
+
+    if (!threads) {
+        threads = std::thread::hardware_concurrency();
+    }
+
+    if (!threads) {
+        threads = 1;
+    }
+
+    if (threads > rangeCount) {
+        threads = (unsigned int)rangeCount;
+    }
+
+    // ranges are handed out one at a time so a slow range does not hold up a whole thread's share
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+
+    for (unsigned int i = 0; i < threads; i++) {
+        workers.push_back(std::thread([this, &next, rangeCount, &logCodes, &eventIds, &filter]() {
+            size_t r;
+
+            while ((r = next.fetch_add(1)) < rangeCount) {
+                size_t first = r * DM_CAPTURE_DECODE_RANGE_FRAMES;
+                size_t last  = first + DM_CAPTURE_DECODE_RANGE_FRAMES < frames.size() ? first + DM_CAPTURE_DECODE_RANGE_FRAMES : frames.size();
+
+                decodeRange(ranges[r], first, last, logCodes, eventIds, filter.types);
+            }
+        }));
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    size_t total = 0;
+
+    for (auto& range : ranges) {
+        total           += range.records.size();
+        stats.crcErrors += range.crcErrors;
+        stats.malformed += range.malformed;
+    }
+
+    stats.frames  = frames.size();
+    stats.records = total;
+
+    records.reserve(total);
+
+    // merge the ranges, taking whole runs from one range while it stays behind the others
+    auto later = [this](size_t a, size_t b, size_t ia, size_t ib) {
+        uint64_t ta = ranges[a].records[ia].timestamp;
+        uint64_t tb = ranges[b].records[ib].timestamp;
+        return ta > tb || (ta == tb && a > b);
+    };
+
+    std::vector<size_t> heads(rangeCount, 0);
+    std::vector<size_t> heap;
+
+    auto compare = [&](size_t a, size_t b) { return later(a, b, heads[a], heads[b]); };
+
+    for (size_t r = 0; r < rangeCount; r++) {
+        if (ranges[r].records.size()) {
+            heap.push_back(r);
+        }
+    }
+
+    std::make_heap(heap.begin(), heap.end(), compare);
+
+    while (heap.size()) {
+        std::pop_heap(heap.begin(), heap.end(), compare);
+
+        size_t r = heap.back();
+        heap.pop_back();
+
+        std::vector<DmCaptureRecord>& source = ranges[r].records;
+        size_t end = heads[r] + 1;
+
+        if (heap.empty()) {
+            end = source.size();
+        } else {
+            size_t t = heap.front();
+
+            while (end < source.size() && !later(r, t, end, heads[t])) {
+                end++;
+            }
+        }
+
+        records.insert(records.end(), source.begin() + heads[r], source.begin() + end);
+
+        heads[r] = end;
+
+        if (heads[r] < source.size()) {
+            heap.push_back(r);
+            std::push_heap(heap.begin(), heap.end(), compare);
+        } else {
+            std::vector<DmCaptureRecord>().swap(source);
+        }
+    }
+
+    stats.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    return true;
+}
+
+/**
+* @brief getStats - Counters of the last decode
+*
+* @return DmCaptureDecodeStats
+*/
+DmCaptureDecodeStats DmCaptureDecoder::getStats()
+{
+    return stats;
+}
+
+/**
+* @brief formatMessage - Render a message record as file:line text
+*
+* @param DmCaptureRecord& record
+*
+* @return std::string
+*/
+std::string DmCaptureDecoder::formatMessage(const DmCaptureRecord& record)
+{
+    if (record.type != kDmCaptureRecordMessage || record.size < sizeof(QcdmExtMsgResponse)) {
+        return "";
+    }
+
+    const QcdmExtMsgResponse* message = (const QcdmExtMsgResponse*)record.data;
+    size_t argsSize = message->argCount * sizeof(uint32_t);
+
+    if (sizeof(QcdmExtMsgResponse) + argsSize > record.size) {
+        return "";
+    }
+
+    const char* format = (const char*)record.data + sizeof(QcdmExtMsgResponse) + argsSize;
+    const char* end    = (const char*)record.data + record.size;
+    const char* formatEnd = (const char*)memchr(format, 0x00, end - format);
+
+    if (formatEnd == nullptr) {
+        return "";
+    }
+
+    const char* file    = formatEnd + 1;
+    const char* fileEnd = file < end ? (const char*)memchr(file, 0x00, end - file) : nullptr;
+
+    std::string out = fileEnd != nullptr ? std::string(file, fileEnd) : std::string("?");
+    char buffer[64];
+    uint8_t arg = 0;
+
+    snprintf(buffer, sizeof(buffer), ":%d ", message->line);
+
+    out.append(buffer);
+
+    for (const char* p = format; p < formatEnd; p++) {
+        if (*p != '%') {
+            out.push_back(*p);
+            continue;
+        }
+
+        if (p + 1 < formatEnd && p[1] == '%') {
+            out.push_back('%');
+            p++;
+            continue;
+        }
+
+        // copy flags, width and precision, drop length modifiers, the arguments are all 32 bit
+        std::string spec("%");
+        const char* q = p + 1;
+
+        while (q < formatEnd && strchr("-+ #0123456789.", *q)) {
+            spec.push_back(*q++);
+        }
+
+        while (q < formatEnd && strchr("hlLqjzt", *q)) {
+            q++;
+        }
+
+        if (q >= formatEnd || arg >= message->argCount) {
+            out.append(p, q < formatEnd ? q + 1 : formatEnd);
+            p = q;
+            continue;
+        }
+
+        uint32_t value;
+
+        memcpy(&value, (const uint8_t*)message->args + arg++ * sizeof(uint32_t), sizeof(value));
+
+        switch (*q) {
+            case 'd':
+            case 'i':
+                spec.push_back(*q);
+                snprintf(buffer, sizeof(buffer), spec.c_str(), (int32_t)value);
+                break;
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+            case 'c':
+                spec.push_back(*q);
+                snprintf(buffer, sizeof(buffer), spec.c_str(), value);
+                break;
+            default:
+                snprintf(buffer, sizeof(buffer), "0x%08X", value);
+                break;
+        }
+
+        out.append(buffer);
+
+        p = q;
+    }
+
+    return out;
+}
+
+/**
+* @brief indexCapture - Walk the length prefixes of a DmCapture file
+*
+* @return bool
+*/
+bool DmCaptureDecoder::indexCapture()
+{
+    const DmCaptureFileHeader* header = (const DmCaptureFileHeader*)data;
+
+    if (header->version != DM_CAPTURE_VERSION || header->headerSize < sizeof(DmCaptureFileHeader) || header->headerSize > size) {
+        return false;
+    }
+
+    uint64_t position = header->headerSize;
+    uint16_t length;
+
+    frames.reserve((size - position) / 64);
+
+    while (position + sizeof(length) <= size) {
+        memcpy(&length, data + position, sizeof(length));
+
+        position += sizeof(length);
+
+        if (position + length > size) {
+            LOGD("Capture ends in the middle of a frame at %llu\n", (unsigned long long)position);
+            break;
+        }
+
+        if (length) {
+            DmCaptureFrame frame = { position, length };
+            frames.push_back(frame);
+        }
+
+        position += length;
+    }
+
+    return true;
+}
+
+/**
+* @brief indexStream - Scan a raw HDLC stream for flags, in slices on each thread
+*
+* @param unsigned int threads
+*
+* @return void
+*/
+void DmCaptureDecoder::indexStream(unsigned int threads)
+{
+    size_t sliceSize = (size + threads - 1) / threads;
+
+    if (sliceSize < DM_CAPTURE_DECODE_ARENA_BLOCK) {
+        sliceSize = DM_CAPTURE_DECODE_ARENA_BLOCK;
+    }
+
+    size_t sliceCount = (size + sliceSize - 1) / sliceSize;
+
+    std::vector<std::vector<uint64_t>> flags(sliceCount);
+    std::vector<std::thread> workers;
+
+    for (size_t i = 0; i < sliceCount; i++) {
+        workers.push_back(std::thread([this, i, sliceSize, &flags]() {
+            const uint8_t* start = data + i * sliceSize;
+            const uint8_t* end   = data + (size - i * sliceSize < sliceSize ? size : (i + 1) * sliceSize);
+            const uint8_t* flag;
+
+            while (start < end && (flag = (const uint8_t*)memchr(start, HDLC_CONTROL_CHAR, end - start)) != nullptr) {
+                flags[i].push_back(flag - data);
+                start = flag + 1;
+            }
+        }));
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // a frame is whatever sits between two flags, what trails the last flag was cut off
+    // and runs longer than any capture could hold are not diag traffic
+    uint64_t position = 0;
+
+    for (auto& slice : flags) {
+        for (auto flag : slice) {
+            if (flag > position && flag - position <= DM_CAPTURE_MAX_FRAME_SIZE) {
+                DmCaptureFrame frame = { position, (uint32_t)(flag - position) };
+                frames.push_back(frame);
+            }
+
+            position = flag + 1;
+        }
+
+        std::vector<uint64_t>().swap(slice);
+    }
+}
+
+/**
+* @brief decodeRange - Decode frames [first, last) into a range
+*
+* @param Range& range
+* @param size_t first
+* @param size_t last
+* @param std::vector<bool>& logCodes - One flag per log code
+* @param std::vector<bool>& eventIds - One flag per event id
+* @param uint32_t types
+*
+* @return void
+*/
+void DmCaptureDecoder::decodeRange(Range& range, size_t first, size_t last, const std::vector<bool>& logCodes, const std::vector<bool>& eventIds, uint32_t types)
+{
+    uint64_t timestamp = 0;
+
+    range.crcErrors = 0;
+    range.malformed = 0;
+    range.records.reserve(last - first);
+
+    for (size_t i = first; i < last; i++) {
+        const uint8_t* frame = data + frames[i].offset;
+        size_t frameSize     = frames[i].size;
+        size_t records       = range.records.size();
+        size_t blocks        = range.arena.size();
+        size_t blockSize     = blocks ? range.arena.back().size() : 0;
+        const uint8_t* packet = frame;
+
+        if (memchr(frame, HDLC_ESC_CHAR, frameSize) != nullptr) {
+            packet = unescape(range, frame, frameSize);
+        }
+
+        size_t packetSize = frameSize > sizeof(uint16_t) ? frameSize - sizeof(uint16_t) : 0;
+
+        if (!packetSize) {
+            range.malformed++;
+        } else if (crc16((const char*)packet, packetSize) != (packet[packetSize] | (packet[packetSize + 1] << 8))) {
+            range.crcErrors++;
+        } else {
+            DmCaptureRecord record = { timestamp, packet, (uint32_t)i, (uint16_t)packetSize, packet[0], kDmCaptureRecordOther };
+
+            switch (packet[0]) {
+                case DIAG_LOG_F: {
+                    if (packetSize < sizeof(QcdmLogResponse) + sizeof(QcdmLogHeader)) {
+                        range.malformed++;
+                        break;
+                    }
+
+                    const QcdmLogHeader* log = (const QcdmLogHeader*)(packet + sizeof(QcdmLogResponse));
+
+                    if (log->length < sizeof(QcdmLogHeader) || sizeof(QcdmLogResponse) + log->length > packetSize) {
+                        range.malformed++;
+                        break;
+                    }
+
+                    timestamp = log->timestamp;
+
+                    if ((types & kDmCaptureRecordLog) && logCodes[log->logCode]) {
+                        record.type      = kDmCaptureRecordLog;
+                        record.code      = log->logCode;
+                        record.timestamp = timestamp;
+                        record.data      = (const uint8_t*)log + sizeof(QcdmLogHeader);
+                        record.size      = (uint16_t)(log->length - sizeof(QcdmLogHeader));
+                        range.records.push_back(record);
+                    }
+
+                    break;
+                }
+                case DIAG_EVENT_REPORT_F:
+                    if (types & kDmCaptureRecordEvent) {
+                        timestamp = decodeEvents(range, i, packet, packetSize, timestamp, eventIds);
+                    }
+                    break;
+                case DIAG_EXT_MSG_F: {
+                    const QcdmExtMsgResponse* message = (const QcdmExtMsgResponse*)packet;
+
+                    if (packetSize < sizeof(QcdmExtMsgResponse) || sizeof(QcdmExtMsgResponse) + message->argCount * sizeof(uint32_t) > packetSize) {
+                        range.malformed++;
+                        break;
+                    }
+
+                    timestamp = message->timestamp;
+
+                    if (types & kDmCaptureRecordMessage) {
+                        record.type      = kDmCaptureRecordMessage;
+                        record.code      = message->subsystem;
+                        record.timestamp = timestamp;
+                        range.records.push_back(record);
+                    }
+
+                    break;
+                }
+                default:
+                    if (types & kDmCaptureRecordOther) {
+                        range.records.push_back(record);
+                    }
+                    break;
+            }
+        }
+
+        if (packet != frame && range.records.size() == records) {
+            // nothing kept a pointer to the unescaped copy, give the space back
+            range.arena.resize(blocks);
+
+            if (blocks) {
+                range.arena.back().resize(blockSize);
+            }
+        }
+    }
+
+    // mostly in order already, the sort just settles what different processors interleaved
+    if (!std::is_sorted(range.records.begin(), range.records.end(), [](const DmCaptureRecord& a, const DmCaptureRecord& b) { return a.timestamp < b.timestamp; })) {
+        std::stable_sort(range.records.begin(), range.records.end(), [](const DmCaptureRecord& a, const DmCaptureRecord& b) { return a.timestamp < b.timestamp; });
+    }
+}
+
+/**
+* @brief unescape - Unescape a frame into the arena of a range
+*
+* @return uint8_t* - The unescaped frame, size is updated
+*/
+uint8_t* DmCaptureDecoder::unescape(Range& range, const uint8_t* frame, size_t& size)
+{
+    if (!range.arena.size() || range.arena.back().capacity() - range.arena.back().size() < size) {
+        range.arena.push_back(std::vector<uint8_t>());
+        range.arena.back().reserve(size > DM_CAPTURE_DECODE_ARENA_BLOCK ? size : DM_CAPTURE_DECODE_ARENA_BLOCK);
+    }
+
+    std::vector<uint8_t>& block = range.arena.back();
+    size_t start = block.size();
+
+    // within the reserved capacity, so nothing already handed out moves
+    block.resize(start + size);
+
+    uint8_t* out = &block[start];
+    const uint8_t* end = frame + size;
+    size_t length = 0;
+
+    // escapes are rare, copy the runs between them
+    while (frame < end) {
+        const uint8_t* escape = (const uint8_t*)memchr(frame, HDLC_ESC_CHAR, end - frame);
+        const uint8_t* run = escape != nullptr ? escape : end;
+
+        memcpy(out + length, frame, run - frame);
+
+        length += run - frame;
+        frame   = run;
+
+        if (escape != nullptr) {
+            if (escape + 1 < end) {
+                out[length++] = escape[1] ^ HDLC_ESC_MASK;
+            }
+
+            frame = escape + 2;
+        }
+    }
+
+    block.resize(start + length);
+
+    size = length;
+
+    return out;
+}
+
+/**
+* @brief decodeEvents - Add a record for each event of an event report
+*
+* @return uint64_t - The timestamp of the last event
+*/
+uint64_t DmCaptureDecoder::decodeEvents(Range& range, uint32_t frame, const uint8_t* packet, size_t size, uint64_t timestamp, const std::vector<bool>& eventIds)
+{
+    if (size < sizeof(QcdmEventReportResponse)) {
+        range.malformed++;
+        return timestamp;
+    }
+
+    const QcdmEventReportResponse* report = (const QcdmEventReportResponse*)packet;
+    const uint8_t* p   = report->events;
+    const uint8_t* end = p + report->length;
+
+    if (end > packet + size) {
+        range.malformed++;
+        end = packet + size;
+    }
+
+    while (p < end) {
+        uint16_t word;
+        size_t payloadSize;
+
+        if (end - p < (ptrdiff_t)sizeof(word)) {
+            range.malformed++;
+            break;
+        }
+
+        memcpy(&word, p, sizeof(word));
+
+        p += sizeof(word);
+
+        if (word & 0x8000) {
+            uint16_t truncated;
+
+            if (end - p < (ptrdiff_t)sizeof(truncated)) {
+                range.malformed++;
+                break;
+            }
+
+            memcpy(&truncated, p, sizeof(truncated));
+
+            timestamp = (timestamp & ~0xFFFF0000ULL) | ((uint64_t)truncated << 16);
+            p += sizeof(truncated);
+        } else {
+            if (end - p < (ptrdiff_t)sizeof(timestamp)) {
+                range.malformed++;
+                break;
+            }
+
+            memcpy(&timestamp, p, sizeof(timestamp));
+
+            p += sizeof(timestamp);
+        }
+
+        payloadSize = (word >> 13) & 0x03;
+
+        if (payloadSize == 3) {
+            if (p >= end) {
+                range.malformed++;
+                break;
+            }
+
+            payloadSize = *p++;
+        }
+
+        if ((size_t)(end - p) < payloadSize) {
+            range.malformed++;
+            break;
+        }
+
+        if (eventIds[word & 0xFFF]) {
+            DmCaptureRecord record = { timestamp, p, frame, (uint16_t)payloadSize, (uint16_t)(word & 0xFFF), kDmCaptureRecordEvent };
+            range.records.push_back(record);
+        }
+
+        p += payloadSize;
+    }
+
+    return timestamp;
+}
@@ -0,0 +1,213 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_capture_decoder.h
+* @class OpenPST::DmCaptureDecoder
+* @package OpenPST
+* @brief Offline decoder for captured DIAG log, event and message traffic
+*
+* A capture is memory mapped and indexed first, walking the length prefixes
+* of a DmCapture file or scanning a raw HDLC stream for flags in parallel.
+* The index is then cut into ranges of frames that a pool of threads unescape,
+* check and decode, and each range is sorted on its own before all of them
+* are merged into one list in timestamp order.
+*
+* Record payloads point into the mapped file when a frame had nothing escaped,
+* or into buffers the decoder owns, so records are only valid until the next
+* decode() or close().
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_CAPTURE_DECODER_H_
+#define _QC_DM_CAPTURE_DECODER_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <queue>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include "include/definitions.h"
+#include "qc/dm.h"
+#include "qc/dm_capture.h"
+#include "qc/hdlc.h"
+
+#define DM_CAPTURE_DECODE_RANGE_FRAMES  65536
+#define DM_CAPTURE_DECODE_ARENA_BLOCK   (1024 * 1024)
+
+namespace OpenPST {
+
+    enum DmCaptureRecordType {
+        kDmCaptureRecordLog     = 0x01,
+        kDmCaptureRecordEvent   = 0x02,
+        kDmCaptureRecordMessage = 0x04,
+        kDmCaptureRecordOther   = 0x08, // anything else, usually command responses
+        kDmCaptureRecordAll     = 0x0F
+    };
+
+    struct DmCaptureFrame {
+        uint64_t offset;        // first byte after the flag or length prefix
+        uint32_t size;          // escaped, including the CRC
+    };
+
+    struct DmCaptureRecord {
+        uint64_t timestamp;     // from the packet, or the last one before it for other records
+        const uint8_t* data;    // log payload after QcdmLogHeader, event payload, or the whole packet
+        uint32_t frame;         // frame index it was decoded from
+        uint16_t size;
+        uint16_t code;          // log code, event id, message subsystem or command code
+        uint8_t  type;          // DmCaptureRecordType
+    };
+
+    struct DmCaptureFilter {
+        uint32_t types;                 // DmCaptureRecordType bits
+        std::vector<uint16_t> logCodes; // empty for every log code
+        std::vector<uint16_t> eventIds; // empty for every event
+    };
+
+    struct DmCaptureDecodeStats {
+        uint64_t frames;        // frames decoded
+        uint64_t records;       // records that passed the filter
+        uint64_t crcErrors;
+        uint64_t malformed;     // frames or events shorter than they claim to be
+        uint64_t elapsed;       // ms
+    };
+
+    /**
+    * @brief OpenPST::DmCaptureDecoder
+    */
+    class DmCaptureDecoder {
+        public:
+            /**
+            * @brief DmCaptureDecoder - Constructor
+            */
+            DmCaptureDecoder();
+
+            /**
+            * @brief ~DmCaptureDecoder - Deconstructor, unmaps the file
+            */
+            ~DmCaptureDecoder();
+
+            /**
+            * @brief open - Map a DmCapture file or a raw HDLC stream and index its frames
+            *
+            * @param std::string filePath
+            * @param unsigned int threads - 0 to use all available cores
+            *
+            * @return bool
+            */
+            bool open(std::string filePath, unsigned int threads = 0);
+
+            /**
+            * @brief close - Unmap the file, invalidates all records
+            *
+            * @return void
+            */
+            void close();
+
+            /**
+            * @brief getFrameCount
+            *
+            * @return size_t
+            */
+            size_t getFrameCount();
+
+            /**
+            * @brief decode - Decode every frame and merge the matching records in timestamp order
+            *
+            * @param DmCaptureFilter& filter
+            * @param std::vector<DmCaptureRecord>& records - Replaced with the result
+            * @param unsigned int threads - 0 to use all available cores
+            *
+            * @return bool - false if no file is open
+            */
+            bool decode(const DmCaptureFilter& filter, std::vector<DmCaptureRecord>& records, unsigned int threads = 0);
+
+            /**
+            * @brief getStats - Counters of the last decode
+            *
+            * @return DmCaptureDecodeStats
+            */
+            DmCaptureDecodeStats getStats();
+
+            /**
+            * @brief formatMessage - Render a message record as file:line text
+            *
+            * String arguments are pointers on the device and are shown as such.
+            *
+            * @param DmCaptureRecord& record
+            *
+            * @return std::string
+            */
+            static std::string formatMessage(const DmCaptureRecord& record);
+
+        private:
+            struct Range {
+                std::vector<DmCaptureRecord> records;
+                std::vector<std::vector<uint8_t>> arena;    // unescaped frames that had escapes, blocks never move
+                uint64_t crcErrors;
+                uint64_t malformed;
+            };
+
+            const uint8_t* data;
+            size_t size;
+            std::vector<DmCaptureFrame> frames;
+            std::vector<Range> ranges;
+            DmCaptureDecodeStats stats;
+#ifdef _WIN32
+            void* fileHandle;
+            void* mappingHandle;
+#endif
+
+            /**
+            * @brief indexCapture - Walk the length prefixes of a DmCapture file
+            *
+            * @return bool
+            */
+            bool indexCapture();
+
+            /**
+            * @brief indexStream - Scan a raw HDLC stream for flags, in slices on each thread
+            *
+            * @param unsigned int threads
+            *
+            * @return void
+            */
+            void indexStream(unsigned int threads);
+
+            /**
+            * @brief decodeRange - Decode frames [first, last) into a range
+            *
+            * @param Range& range
+            * @param size_t first
+            * @param size_t last
+            * @param std::vector<bool>& logCodes - One flag per log code
+            * @param std::vector<bool>& eventIds - One flag per event id
+            * @param uint32_t types
+            *
+            * @return void
+            */
+            void decodeRange(Range& range, size_t first, size_t last, const std::vector<bool>& logCodes, const std::vector<bool>& eventIds, uint32_t types);
+
+            /**
+            * @brief unescape - Unescape a frame into the arena of a range
+            *
+            * @return uint8_t* - The unescaped frame, size is updated
+            */
+            uint8_t* unescape(Range& range, const uint8_t* frame, size_t& size);
+
+            /**
+            * @brief decodeEvents - Add a record for each event of an event report
+            *
+            * @return uint64_t - The timestamp of the last event
+            */
+            uint64_t decodeEvents(Range& range, uint32_t frame, const uint8_t* packet, size_t size, uint64_t timestamp, const std::vector<bool>& eventIds);
+    };
+}
+
+#endif // _QC_DM_CAPTURE_DECODER_H_
@@ -0,0 +1,527 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_client.cpp
+* @class OpenPST::DmClient
+* @package OpenPST
+* @brief Asynchronous DIAG command client
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "dm_client.h"
+
+using namespace OpenPST;
+
+/**
+* @brief DmClient - Constructor
+*
+* @param QcdmSerial& port
+*/
+DmClient::DmClient(QcdmSerial& port) :
+    port(port),
+    running(false),
+    reading(false),
+    sequence(0),
+    nextSubscription(1),
+    crcBaseline(0)
+{
+    memset(&stats, 0x00, sizeof(stats));
+}
+
+/**
+* @brief ~DmClient - Deconstructor, stops the reader
+*/
+DmClient::~DmClient()
+{
+    stop();
+}
+
+/**
+* @brief start - Start the reader thread
+*
+* @return bool - false if already running
+*/
+bool DmClient::start()
+{
+    if (reader.joinable()) {
+        return false;
+    }
+
+    crcBaseline = port.getCrcErrors();
+    portTimeout = port.getTimeout();
+
+    // a read blocks the reader for the port timeout, so queued requests wait at most this long
+    serial::Timeout timeout = serial::Timeout::simpleTimeout(DM_CLIENT_POLL_TIMEOUT);
+    port.setTimeout(timeout);
+
+    running = true;
+    reading = true;
+
+    reader = std::thread(&DmClient::readLoop, this);
+
+    return true;
+}
+
+/**
+* @brief stop - Stop the reader thread and fail every pending request
+*
+* @return void
+*/
+void DmClient::stop()
+{
+    if (!reader.joinable()) {
+        return;
+    }
+
+    running = false;
+
+    reader.join();
+}
+
+/**
+* @brief isRunning
+*
+* @return bool
+*/
+bool DmClient::isRunning()
+{
+    return reading;
+}
+
+/**
+* @brief send - Queue a request for the reader to write, safe to call from any thread
+*
+* @param uint8_t* request - Unescaped packet without a CRC
+* @param size_t size
+* @param int timeout - ms
+*
+* @return std::future<DmClientResponse>
+*/
+std::future<DmClientResponse> DmClient::send(const uint8_t* request, size_t size, int timeout)
+{
+    std::shared_ptr<std::promise<DmClientResponse>> promise = std::make_shared<std::promise<DmClientResponse>>();
+    std::future<DmClientResponse> future = promise->get_future();
+    Outgoing queued;
+    Pending entry;
+
+    queued.key = key(request, size);
+
+    entry.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+    entry.promise  = promise;
+
+    // registered and queued under one lock so pending order is the order on the wire
+    std::lock_guard<std::mutex> outgoingLock(outgoingMutex);
+
+    if (!size || !reading) {
+        DmClientResponse response = { kDmClientStopped };
+        promise->set_value(response);
+        return future;
+    }
+
+    hdlc_append(queued.frame, request, size);
+
+    port.invalidateNvCache(request, size);
+
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        entry.sequence = queued.sequence = sequence++;
+        pending[queued.key].push_back(entry);
+    }
+
+    outgoing.push_back(std::move(queued));
+
+    return future;
+}
+
+/**
+* @brief call - Send a request and wait for its response
+*
+* @param uint8_t* request
+* @param size_t size
+* @param int timeout - ms
+*
+* @return DmClientResponse
+*/
+DmClientResponse DmClient::call(const uint8_t* request, size_t size, int timeout)
+{
+    return send(request, size, timeout).get();
+}
+
+/**
+* @brief subscribe - Receive every unsolicited packet with a command code
+*
+* @param uint8_t command
+* @param DmClientCallback callback
+*
+* @return int
+*/
+int DmClient::subscribe(uint8_t command, DmClientCallback callback)
+{
+    std::lock_guard<std::recursive_mutex> lock(subscriberMutex);
+    Subscription subscription = { nextSubscription++, false, command, callback };
+
+    subscribers.push_back(subscription);
+
+    return subscription.id;
+}
+
+/**
+* @brief subscribeAll - Receive every unsolicited packet
+*
+* @param DmClientCallback callback
+*
+* @return int
+*/
+int DmClient::subscribeAll(DmClientCallback callback)
+{
+    std::lock_guard<std::recursive_mutex> lock(subscriberMutex);
+    Subscription subscription = { nextSubscription++, true, 0x00, callback };
+
+    subscribers.push_back(subscription);
+
+    return subscription.id;
+}
+
+/**
+* @brief unsubscribe
+*
+* @param int id
+*
+* @return void
+*/
+void DmClient::unsubscribe(int id)
+{
+    std::lock_guard<std::recursive_mutex> lock(subscriberMutex);
+
+    for (auto it = subscribers.begin(); it != subscribers.end(); it++) {
+        if (it->id == id) {
+            // cleared rather than erased so a publish walking the list is not disturbed
+            it->callback = nullptr;
+            return;
+        }
+    }
+}
+
+/**
+* @brief getStats
+*
+* @return DmClientStats
+*/
+DmClientStats DmClient::getStats()
+{
+    std::lock_guard<std::mutex> lock(pendingMutex);
+
+    return stats;
+}
+
+/**
+* @brief isStreamed - Packets the device sends without being asked
+*
+* @param uint8_t command
+*
+* @return bool
+*/
+bool DmClient::isStreamed(uint8_t command)
+{
+    switch (command) {
+        case DIAG_LOG_F:
+        case DIAG_MSG_F:
+        case DIAG_EVENT_REPORT_F:
+        case DIAG_TRACE_EVENT_REPORT_F:
+        case DIAG_EXT_MSG_F:
+        case DIAG_EXT_MSG_TERSE_F:
+            return true;
+    }
+
+    return false;
+}
+
+/**
+* @brief isError - Error responses, followed by the rejected request
+*
+* @param uint8_t command
+*
+* @return bool
+*/
+bool DmClient::isError(uint8_t command)
+{
+    switch (command) {
+        case DIAG_BAD_CMD_F:
+        case DIAG_BAD_PARM_F:
+        case DIAG_BAD_LEN_F:
+        case DIAG_BAD_MODE_F:
+        case DIAG_BAD_SPC_MODE_F:
+        case DIAG_BAD_SEC_MODE_F:
+            return true;
+    }
+
+    return false;
+}
+
+/**
+* @brief key - Match key of a request or response, command and subsystem ids
+*
+* @param uint8_t* packet
+* @param size_t size
+*
+* @return uint32_t
+*/
+uint32_t DmClient::key(const uint8_t* packet, size_t size)
+{
+    if (!size) {
+        return 0;
+    }
+
+    if ((packet[0] == DIAG_SUBSYS_CMD_F || packet[0] == DIAG_SUBSYS_CMD_VER_2_F) && size >= sizeof(QcdmSubsysHeader)) {
+        const QcdmSubsysHeader* header = (const QcdmSubsysHeader*)packet;
+        return header->command | (header->subsysId << 8) | (header->subsysCommand << 16);
+    }
+
+    return packet[0];
+}
+
+/**
+* @brief readLoop - Reader thread
+*/
+void DmClient::readLoop()
+{
+    HdlcFrameHandler handler = [this](const uint8_t* packet, size_t size) {
+        dispatch(packet, size);
+    };
+
+    while (running) {
+        flush();
+        expire();
+
+        try {
+            if (!port.receiveFrames(handler, DM_CLIENT_POLL_TIMEOUT)) {
+                continue;
+            }
+        } catch (std::exception& e) {
+            LOGE("DIAG client stopped, %s\n", e.what());
+            break;
+        }
+
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        stats.crcErrors = port.getCrcErrors() - crcBaseline;
+    }
+
+    // taken under the outgoing lock so no send registers after the final fail
+    std::lock_guard<std::mutex> outgoingLock(outgoingMutex);
+
+    reading = false;
+
+    outgoing.clear();
+
+    failAll(kDmClientStopped);
+
+    try {
+        port.setTimeout(portTimeout);
+    } catch (std::exception& e) {
+        LOGE("DIAG client could not restore the port timeout, %s\n", e.what());
+    }
+}
+
+/**
+* @brief flush - Write the queued requests, reader thread only
+*/
+void DmClient::flush()
+{
+    std::deque<Outgoing> queued;
+
+    {
+        std::lock_guard<std::mutex> lock(outgoingMutex);
+        queued.swap(outgoing);
+    }
+
+    for (auto& request : queued) {
+        try {
+            // past the bookkeeping of write, which would drop the partial frame the reader keeps
+            port.writeFrames(&request.frame[0], request.frame.size());
+        } catch (std::exception& e) {
+            LOGE("DIAG request not sent, %s\n", e.what());
+
+            std::lock_guard<std::mutex> lock(pendingMutex);
+            std::deque<Pending>& queue = pending[request.key];
+
+            for (auto it = queue.begin(); it != queue.end(); it++) {
+                if (it->sequence == request.sequence) {
+                    DmClientResponse response = { kDmClientStopped };
+                    it->promise->set_value(response);
+                    queue.erase(it);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/**
+* @brief dispatch - Route a received frame
+*
+* @param uint8_t* data - Unescaped packet without its CRC
+* @param size_t size
+*/
+void DmClient::dispatch(const uint8_t* data, size_t size)
+{
+    std::vector<uint8_t> packet(data, data + size);
+    uint8_t command = packet[0];
+
+    if (isStreamed(command)) {
+        publish(&packet[0], packet.size());
+        return;
+    }
+
+    bool matched;
+
+    if (isError(command)) {
+        matched = packet.size() > 1 ? complete(key(&packet[1], packet.size() - 1), kDmClientRejected, packet) : false;
+
+        // some errors come back without the request, they answer the oldest one
+        if (!matched) {
+            matched = completeOldest(kDmClientRejected, packet);
+        }
+    } else {
+        matched = complete(key(&packet[0], packet.size()), kDmClientOk, packet);
+    }
+
+    if (!matched) {
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex);
+            stats.unmatched++;
+        }
+
+        publish(&packet[0], packet.size());
+    }
+}
+
+/**
+* @brief complete - Complete the oldest pending request for a key
+*
+* @return bool - false if nothing was pending for the key
+*/
+bool DmClient::complete(uint32_t key, DmClientStatus status, std::vector<uint8_t>& packet)
+{
+    std::shared_ptr<std::promise<DmClientResponse>> promise;
+
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        auto it = pending.find(key);
+
+        if (it == pending.end() || !it->second.size()) {
+            return false;
+        }
+
+        promise = it->second.front().promise;
+        it->second.pop_front();
+
+        stats.responses++;
+    }
+
+    DmClientResponse response = { status };
+    response.data.swap(packet);
+
+    promise->set_value(response);
+
+    return true;
+}
+
+/**
+* @brief completeOldest - Complete the oldest pending request of any key
+*
+* @return bool - false if nothing was pending
+*/
+bool DmClient::completeOldest(DmClientStatus status, std::vector<uint8_t>& packet)
+{
+    uint32_t oldest = 0;
+    bool found = false;
+
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        uint64_t lowest = 0;
+
+        for (auto& entry : pending) {
+            if (entry.second.size() && (!found || entry.second.front().sequence < lowest)) {
+                lowest = entry.second.front().sequence;
+                oldest = entry.first;
+                found  = true;
+            }
+        }
+    }
+
+    // a failed send may have taken it back in between, then nothing is completed
+    return found && complete(oldest, status, packet);
+}
+
+/**
+* @brief publish - Give a packet to the subscribers
+*/
+void DmClient::publish(const uint8_t* packet, size_t size)
+{
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        stats.unsolicited++;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(subscriberMutex);
+
+    // by index, a callback may subscribe and grow the list
+    for (size_t i = 0; i < subscribers.size(); i++) {
+        if (subscribers[i].callback && (subscribers[i].all || subscribers[i].command == packet[0])) {
+            DmClientCallback callback = subscribers[i].callback;
+            callback(packet, size);
+        }
+    }
+
+    subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(), [](const Subscription& s) { return !s.callback; }), subscribers.end());
+}
+
+/**
+* @brief expire - Fail pending requests past their deadline
+*/
+void DmClient::expire()
+{
+    std::vector<std::shared_ptr<std::promise<DmClientResponse>>> expired;
+    auto now = std::chrono::steady_clock::now();
+
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+
+        for (auto& entry : pending) {
+            std::deque<Pending>& queue = entry.second;
+
+            for (auto it = queue.begin(); it != queue.end();) {
+                if (it->deadline <= now) {
+                    expired.push_back(it->promise);
+                    it = queue.erase(it);
+                    stats.timeouts++;
+                } else {
+                    it++;
+                }
+            }
+        }
+    }
+
+    for (auto& promise : expired) {
+        DmClientResponse response = { kDmClientTimeout };
+        promise->set_value(response);
+    }
+}
+
+/**
+* @brief failAll - Fail every pending request
+*/
+void DmClient::failAll(DmClientStatus status)
+{
+    std::lock_guard<std::mutex> lock(pendingMutex);
+
+    for (auto& entry : pending) {
+        for (auto& waiting : entry.second) {
+            DmClientResponse response = { status };
+            waiting.promise->set_value(response);
+        }
+    }
+
+    pending.clear();
+}
@@ -0,0 +1,296 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_client.h
+* @class OpenPST::DmClient
+* @package OpenPST
+* @brief Asynchronous DIAG command client
+*
+* QcdmSerial::sendCommand takes whatever arrives next as the response, so any
+* log, event or message packet the device streams in between breaks it. Here a
+* single reader thread owns the receiving side of the port. It splits what
+* arrives into frames and classifies each one by command code. Streamed
+* packets go to subscribers, and responses complete the oldest pending request
+* with the same command, and the same subsystem and subsystem command for
+* subsystem requests. Error responses echo the rejected request after the
+* error code, so they are matched the same way.
+*
+* Requests may be sent from any thread. They are framed and queued, and the
+* reader thread writes them between reads, so only that thread touches the
+* port. A request that times out is failed and forgotten, so a response
+* arriving after that is given to the next request with the same key, if
+* any, or to the subscribers.
+*
+* The port must not be used by anything else while the client is running.
+* Its timeout is shortened for the reader and put back when it stops.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_CLIENT_H_
+#define _QC_DM_CLIENT_H_
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <memory>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <algorithm>
+#include "include/definitions.h"
+#include "qc/dm.h"
+#include "qc/hdlc.h"
+#include "serial/qcdm_serial.h"
+
+/**
+* Time to wait for a response when no timeout is given
+*/
+#define DM_CLIENT_DEFAULT_TIMEOUT 1000 // ms
+
+/**
+* Longest the reader waits for data before it writes queued requests, checks
+* for expired ones and being stopped again
+*/
+#define DM_CLIENT_POLL_TIMEOUT 10 // ms
+
+namespace OpenPST {
+
+    enum DmClientStatus {
+        kDmClientOk = 0,
+        kDmClientRejected,      // the device answered with an error response, it is in data
+        kDmClientTimeout,       // no response before the timeout
+        kDmClientStopped        // the client stopped or the port failed before a response
+    };
+
+    struct DmClientResponse {
+        DmClientStatus status;
+        std::vector<uint8_t> data; // unescaped packet without its CRC
+    };
+
+    struct DmClientStats {
+        uint64_t responses;     // frames matched to a request
+        uint64_t unsolicited;   // frames given to subscribers
+        uint64_t unmatched;     // responses that matched no request
+        uint64_t crcErrors;
+        uint64_t timeouts;
+    };
+
+    /**
+    * Called on the reader thread with an unescaped packet without its CRC,
+    * it must return quickly and must not wait on a response from the client
+    */
+    typedef std::function<void(const uint8_t* packet, size_t size)> DmClientCallback;
+
+    /**
+    * @brief OpenPST::DmClient
+    */
+    class DmClient {
+        public:
+            /**
+            * @brief DmClient - Constructor
+            *
+            * @param QcdmSerial& port
+            */
+            DmClient(QcdmSerial& port);
+
+            /**
+            * @brief ~DmClient - Deconstructor, stops the reader
+            */
+            ~DmClient();
+
+            /**
+            * @brief start - Start the reader thread
+            *
+            * @return bool - false if already running
+            */
+            bool start();
+
+            /**
+            * @brief stop - Stop the reader thread and fail every pending request
+            *
+            * @return void
+            */
+            void stop();
+
+            /**
+            * @brief isRunning - false once stopped, or after the port failed
+            *
+            * @return bool
+            */
+            bool isRunning();
+
+            /**
+            * @brief send - Queue a request for the reader to write, safe to call from any thread
+            *
+            * @param uint8_t* request - Unescaped packet without a CRC
+            * @param size_t size
+            * @param int timeout - ms
+            *
+            * @return std::future<DmClientResponse>
+            */
+            std::future<DmClientResponse> send(const uint8_t* request, size_t size, int timeout = DM_CLIENT_DEFAULT_TIMEOUT);
+
+            /**
+            * @brief call - Send a request and wait for its response
+            *
+            * @param uint8_t* request
+            * @param size_t size
+            * @param int timeout - ms
+            *
+            * @return DmClientResponse
+            */
+            DmClientResponse call(const uint8_t* request, size_t size, int timeout = DM_CLIENT_DEFAULT_TIMEOUT);
+
+            /**
+            * @brief subscribe - Receive every unsolicited packet with a command code
+            *
+            * @param uint8_t command - DIAG_LOG_F, DIAG_EVENT_REPORT_F, DIAG_EXT_MSG_F ...
+            * @param DmClientCallback callback
+            *
+            * @return int - Subscription id for unsubscribe
+            */
+            int subscribe(uint8_t command, DmClientCallback callback);
+
+            /**
+            * @brief subscribeAll - Receive every unsolicited packet
+            *
+            * @param DmClientCallback callback
+            *
+            * @return int - Subscription id for unsubscribe
+            */
+            int subscribeAll(DmClientCallback callback);
+
+            /**
+            * @brief unsubscribe - Safe to call from a callback
+            *
+            * @param int id
+            *
+            * @return void
+            */
+            void unsubscribe(int id);
+
+            /**
+            * @brief getStats
+            *
+            * @return DmClientStats
+            */
+            DmClientStats getStats();
+
+            /**
+            * @brief isStreamed - Packets the device sends without being asked
+            *
+            * @param uint8_t command
+            *
+            * @return bool
+            */
+            static bool isStreamed(uint8_t command);
+
+            /**
+            * @brief isError - Error responses, followed by the rejected request
+            *
+            * @param uint8_t command
+            *
+            * @return bool
+            */
+            static bool isError(uint8_t command);
+
+        private:
+            struct Pending {
+                uint64_t sequence;
+                std::chrono::steady_clock::time_point deadline;
+                std::shared_ptr<std::promise<DmClientResponse>> promise;
+            };
+
+            struct Outgoing {
+                uint64_t sequence;
+                uint32_t key;
+                std::vector<uint8_t> frame;
+            };
+
+            struct Subscription {
+                int id;
+                bool all;
+                uint8_t command;
+                DmClientCallback callback;
+            };
+
+            QcdmSerial& port;
+            std::thread reader;
+            std::atomic<bool> running;
+            std::atomic<bool> reading;
+            std::mutex outgoingMutex;
+            std::mutex pendingMutex;
+            std::recursive_mutex subscriberMutex;
+            std::map<uint32_t, std::deque<Pending>> pending; // by request key, oldest first
+            std::vector<Subscription> subscribers;
+            std::deque<Outgoing> outgoing;                  // framed, in send order
+            serial::Timeout portTimeout;                    // put back when the reader stops
+            uint64_t sequence;
+            int nextSubscription;
+            uint64_t crcBaseline;                           // port CRC errors before the client started
+            DmClientStats stats;
+
+            /**
+            * @brief key - Match key of a request or response, command and subsystem ids
+            *
+            * @param uint8_t* packet
+            * @param size_t size
+            *
+            * @return uint32_t
+            */
+            static uint32_t key(const uint8_t* packet, size_t size);
+
+            /**
+            * @brief readLoop - Reader thread
+            */
+            void readLoop();
+
+            /**
+            * @brief flush - Write the queued requests, reader thread only
+            */
+            void flush();
+
+            /**
+            * @brief dispatch - Route a received frame
+            *
+            * @param uint8_t* data - Unescaped packet without its CRC
+            * @param size_t size
+            */
+            void dispatch(const uint8_t* data, size_t size);
+
+            /**
+            * @brief complete - Complete the oldest pending request for a key
+            *
+            * @return bool - false if nothing was pending for the key
+            */
+            bool complete(uint32_t key, DmClientStatus status, std::vector<uint8_t>& packet);
+
+            /**
+            * @brief completeOldest - Complete the oldest pending request of any key
+            *
+            * @return bool - false if nothing was pending
+            */
+            bool completeOldest(DmClientStatus status, std::vector<uint8_t>& packet);
+
+            /**
+            * @brief publish - Give a packet to the subscribers
+            */
+            void publish(const uint8_t* packet, size_t size);
+
+            /**
+            * @brief expire - Fail pending requests past their deadline
+            */
+            void expire();
+
+            /**
+            * @brief failAll - Fail every pending request
+            */
+            void failAll(DmClientStatus status);
+    };
+}
+
+#endif // _QC_DM_CLIENT_H_
@@ -97,6 +97,19 @@ enum DIAG_EFS_ERROR {
 };
 
 
+/**
+* Open flags, EFS2 takes the Linux values whatever the host platform is
+*/
+enum DIAG_EFS_OPEN_FLAGS {
+    DIAG_EFS_O_RDONLY   = 00,
+    DIAG_EFS_O_WRONLY   = 01,
+    DIAG_EFS_O_RDWR     = 02,
+    DIAG_EFS_O_CREAT    = 0100,
+    DIAG_EFS_O_EXCL     = 0200,
+    DIAG_EFS_O_TRUNC    = 01000,
+    DIAG_EFS_O_APPEND   = 02000,
+};
+
 enum DIAG_EFS_FILE_TYPES {
     DIAG_EFS_FILE_TYPE_FILE         = 0x00,
     DIAG_EFS_FILE_TYPE_DIR          = 0x01,
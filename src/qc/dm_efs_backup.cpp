@@ -0,0 +1,345 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_efs_backup.cpp
+* @class OpenPST::DmEfsBackup
+* @package OpenPST
+* @brief Incremental backup of an EFS directory tree to a local directory
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "dm_efs_backup.h"
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+using namespace OpenPST;
+
+/**
+* @brief makeDirectories - Create a local directory and any missing parents
+*/
+static void makeDirectories(const std::string& path)
+{
+    for (size_t i = 1; i <= path.size(); i++) {
+        if (i < path.size() && path[i] != '/') {
+            continue;
+        }
+
+        std::string parent = path.substr(0, i);
+#ifdef _WIN32
+        _mkdir(parent.c_str());
+#else
+        ::mkdir(parent.c_str(), 0755);
+#endif
+    }
+}
+
+/**
+* @brief localSize - Size of a local file
+*
+* @return int64_t - -1 if it does not exist
+*/
+static int64_t localSize(const std::string& path)
+{
+    std::ifstream file(path.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+
+    if (!file.is_open()) {
+        return -1;
+    }
+
+    return (int64_t)file.tellg();
+}
+
+/**
+* @brief DmEfsBackup - Constructor
+*
+* @param DmEfsManager& efs
+*/
+DmEfsBackup::DmEfsBackup(DmEfsManager& efs) :
+    efs(efs),
+    reader(efs)
+{
+    memset(&stats, 0x00, sizeof(stats));
+}
+
+/**
+* @brief ~DmEfsBackup - Deconstructor
+*/
+DmEfsBackup::~DmEfsBackup()
+{
+
+}
+
+/**
+* @brief run - Back up a remote directory
+*
+* @param std::string remotePath
+* @param std::string localPath
+* @param bool incremental
+* @param DmEfsBackupProgress progress
+*
+* @return int
+*/
+int DmEfsBackup::run(std::string remotePath, std::string localPath, bool incremental, DmEfsBackupProgress progress)
+{
+    auto started = std::chrono::steady_clock::now();
+    DmEfsTree tree;
+    std::map<std::string, DmEfsBackupEntry> files;
+    int result = DmEfsManager::kDmEfsSuccess;
+
+    memset(&stats, 0x00, sizeof(stats));
+
+    manifest.clear();
+
+    if (!remotePath.size() || remotePath.back() != '/') {
+        remotePath.append("/");
+    }
+
+    if (!localPath.size() || localPath.back() != '/') {
+        localPath.append("/");
+    }
+
+    std::string manifestPath = localPath + DM_EFS_BACKUP_MANIFEST_NAME;
+
+    if (incremental && !loadManifest(manifestPath)) {
+        LOGI("No manifest in %s, backing up everything\n", localPath.c_str());
+    }
+
+    int readResult = efs.readDir(remotePath, tree, true);
+
+    if (readResult != DmEfsManager::kDmEfsSuccess) {
+        return readResult;
+    }
+
+    collect(tree, files);
+
+    makeDirectories(localPath.substr(0, localPath.size() - 1));
+
+    for (auto& file : files) {
+        const std::string& path = file.first;
+        DmEfsBackupEntry& current = file.second;
+        std::string localFile = localPath + path;
+        auto saved = manifest.find(path);
+        bool fetch = true;
+
+        if (progress && !progress(stats, path)) {
+            result = DmEfsManager::kDmEfsError;
+            break;
+        }
+
+        if (saved != manifest.end() && localSize(localFile) == saved->second.size) {
+            DmEfsBackupEntry& previous = saved->second;
+
+            if (current.size != previous.size) {
+                fetch = true;
+            } else if (current.mtime == previous.mtime && current.mtime) {
+                fetch = false;
+            } else {
+                // same size but touched since, or a device that keeps no times
+                std::string hash;
+
+                stats.hashed++;
+
+                fetch = efs.md5sum(remotePath + path, hash) != DmEfsManager::kDmEfsSuccess || hash != previous.md5;
+
+                if (!fetch) {
+                    previous.mtime = current.mtime;
+                }
+            }
+        }
+
+        if (!fetch) {
+            stats.unchanged++;
+            continue;
+        }
+
+        if (!download(remotePath + path, localFile, current)) {
+            LOGE("Error backing up %s\n", (remotePath + path).c_str());
+            stats.failed++;
+            continue;
+        }
+
+        if (saved != manifest.end()) {
+            stats.changed++;
+            saved->second = current;
+        } else {
+            stats.added++;
+            manifest[path] = current;
+        }
+    }
+
+    // files gone from the device leave the manifest, their last copy stays on disk
+    if (result == DmEfsManager::kDmEfsSuccess) {
+        for (auto it = manifest.begin(); it != manifest.end();) {
+            if (files.find(it->first) == files.end()) {
+                stats.removed++;
+                it = manifest.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    if (!saveManifest(manifestPath)) {
+        LOGE("Error saving manifest %s\n", manifestPath.c_str());
+        result = DmEfsManager::kDmEfsIOError;
+    } else if (stats.failed) {
+        result = DmEfsManager::kDmEfsError;
+    }
+
+    stats.elapsed = (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count();
+
+    return result;
+}
+
+/**
+* @brief getStats
+*
+* @return DmEfsBackupStats
+*/
+DmEfsBackupStats DmEfsBackup::getStats()
+{
+    return stats;
+}
+
+/**
+* @brief collect - Flatten a crawled tree into files by path relative to its root
+*/
+void DmEfsBackup::collect(const DmEfsTree& tree, std::map<std::string, DmEfsBackupEntry>& files)
+{
+    size_t root = tree.getPath(0).size();
+
+    for (uint32_t i = 1; i < tree.size(); i++) {
+        const DmEfsTreeEntry& node = tree.getEntry(i);
+
+        if (node.type == DIAG_EFS_FILE_TYPE_DIR) {
+            stats.directories++;
+            continue;
+        }
+
+        // links are not followed, whatever they point to is backed up where it lives
+        if (node.type != DIAG_EFS_FILE_TYPE_FILE && node.type != DIAG_EFS_FILE_TYPE_IMMOVABLE) {
+            continue;
+        }
+
+        DmEfsBackupEntry entry = { (uint32_t)node.size, (uint32_t)node.mtime, "" };
+
+        files[tree.getPath(i).substr(root)] = entry;
+
+        stats.files++;
+    }
+}
+
+/**
+* @brief download - Download a file and hash what was saved
+*
+* @return bool
+*/
+bool DmEfsBackup::download(const std::string& remotePath, const std::string& localPath, DmEfsBackupEntry& entry)
+{
+    std::string partPath = localPath + ".part";
+    size_t separator = localPath.rfind('/');
+
+    if (separator != std::string::npos) {
+        makeDirectories(localPath.substr(0, separator));
+    }
+
+    if (reader.read(remotePath, partPath) != DmEfsManager::kDmEfsSuccess) {
+        std::remove(partPath.c_str());
+        return false;
+    }
+
+    stats.bytesRead += reader.getStats().bytesRead;
+
+    std::ifstream file(partPath.c_str(), std::ios::in | std::ios::binary);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    file.close();
+
+    // what was saved, the file may have changed size since readdir
+    entry.size = (uint32_t)data.size();
+    entry.md5  = md5_hex(data.size() ? &data[0] : nullptr, data.size());
+
+    std::remove(localPath.c_str());
+
+    return std::rename(partPath.c_str(), localPath.c_str()) == 0;
+}
+
+/**
+* @brief loadManifest
+*
+* @param std::string filePath
+*
+* @return bool
+*/
+bool DmEfsBackup::loadManifest(std::string filePath)
+{
+    std::ifstream file(filePath.c_str(), std::ios::in);
+    std::string line, magic;
+    int version = 0;
+
+    if (!file.is_open() || !std::getline(file, line)) {
+        return false;
+    }
+
+    std::istringstream header(line);
+
+    header >> magic >> version;
+
+    if (magic.compare("openpst-efs-manifest") != 0 || version != DM_EFS_BACKUP_MANIFEST_VERSION) {
+        return false;
+    }
+
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        DmEfsBackupEntry entry = {};
+        std::string path;
+
+        if (!(fields >> entry.size >> entry.mtime >> entry.md5) || fields.get() != ' ' || !std::getline(fields, path) || !path.size()) {
+            // a torn line is dropped, the file is fetched again
+            continue;
+        }
+
+        manifest[path] = entry;
+    }
+
+    return true;
+}
+
+/**
+* @brief saveManifest - Written aside and renamed over the old one
+*
+* @param std::string filePath
+*
+* @return bool
+*/
+bool DmEfsBackup::saveManifest(std::string filePath)
+{
+    std::string partPath = filePath + ".part";
+    std::ofstream file(partPath.c_str(), std::ios::out | std::ios::trunc);
+
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file << "openpst-efs-manifest " << DM_EFS_BACKUP_MANIFEST_VERSION << "\n";
+
+    for (auto& entry : manifest) {
+        file << entry.second.size << " " << entry.second.mtime << " " << entry.second.md5 << " " << entry.first << "\n";
+    }
+
+    file.close();
+
+    if (!file.good()) {
+        std::remove(partPath.c_str());
+        return false;
+    }
+
+    std::remove(filePath.c_str());
+
+    return std::rename(partPath.c_str(), filePath.c_str()) == 0;
+}
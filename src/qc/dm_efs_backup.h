@@ -0,0 +1,150 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_efs_backup.h
+* @class OpenPST::DmEfsBackup
+* @package OpenPST
+* @brief Incremental backup of an EFS directory tree to a local directory
+*
+* The backup directory keeps a manifest of every file saved in it, one line
+* per file after a header:
+*
+*   openpst-efs-manifest <version>
+*   <size> <mtime> <md5> <path>
+*
+* The path is the rest of the line, relative to the backed up directory.
+*
+* A run crawls the remote tree and compares what readdir reports with the
+* manifest. A file of another size has changed. A file of the same size and
+* mtime is unchanged. Only the files left in between, the same size with
+* another mtime or with no mtime kept by the device, are hashed on the device
+* with DmEfsManager::md5sum and compared with the manifest. New and changed
+* files are downloaded, a repeat backup is mostly a readdir crawl.
+*
+* Files are downloaded beside their old copy and renamed over it once
+* complete, a failed download leaves the previous copy and its manifest entry.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_EFS_BACKUP_H_
+#define _QC_DM_EFS_BACKUP_H_
+
+#include <iostream>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <functional>
+#include "include/definitions.h"
+#include "qc/dm_efs.h"
+#include "qc/dm_efs_manager.h"
+#include "qc/dm_efs_tree.h"
+#include "qc/dm_efs_file_reader.h"
+#include "util/md5.h"
+
+#define DM_EFS_BACKUP_MANIFEST_VERSION  1
+#define DM_EFS_BACKUP_MANIFEST_NAME     ".openpst-efs-manifest"
+
+namespace OpenPST {
+
+    struct DmEfsBackupEntry {
+        uint32_t    size;
+        uint32_t    mtime;
+        std::string md5;
+    };
+
+    struct DmEfsBackupStats {
+        uint32_t files;         // found on the device
+        uint32_t directories;
+        uint32_t added;         // not in the manifest, downloaded
+        uint32_t changed;       // downloaded again
+        uint32_t unchanged;
+        uint32_t removed;       // in the manifest but gone from the device, the local copy is kept
+        uint32_t hashed;        // files the device was asked to md5
+        uint32_t failed;
+        uint64_t bytesRead;
+        uint32_t elapsed;       // ms
+    };
+
+    /**
+    * Called before each file is compared, return false to stop the backup
+    */
+    typedef std::function<bool(const DmEfsBackupStats& stats, const std::string& path)> DmEfsBackupProgress;
+
+    /**
+    * @brief OpenPST::DmEfsBackup
+    */
+    class DmEfsBackup {
+        public:
+            /**
+            * @brief DmEfsBackup - Constructor
+            *
+            * @param DmEfsManager& efs
+            */
+            DmEfsBackup(DmEfsManager& efs);
+
+            /**
+            * @brief ~DmEfsBackup - Deconstructor
+            */
+            ~DmEfsBackup();
+
+            /**
+            * @brief run - Back up a remote directory
+            *
+            * @param std::string remotePath - Directory to back up
+            * @param std::string localPath - Existing or new local directory, holds the manifest
+            * @param bool incremental - false ignores the manifest and downloads everything
+            * @param DmEfsBackupProgress progress
+            *
+            * @return int - DmEfsManager::DmEfsOperationResult, kDmEfsError if any file failed or the backup was stopped
+            */
+            int run(std::string remotePath, std::string localPath, bool incremental = true, DmEfsBackupProgress progress = nullptr);
+
+            /**
+            * @brief getStats - Of the last run
+            *
+            * @return DmEfsBackupStats
+            */
+            DmEfsBackupStats getStats();
+
+        private:
+            DmEfsManager& efs;
+            DmEfsFileReader reader;
+            std::map<std::string, DmEfsBackupEntry> manifest;   // by path relative to the backed up directory
+            DmEfsBackupStats stats;
+
+            /**
+            * @brief collect - Flatten a crawled tree into files by path relative to its root
+            */
+            void collect(const DmEfsTree& tree, std::map<std::string, DmEfsBackupEntry>& files);
+
+            /**
+            * @brief download - Download a file and hash what was saved
+            *
+            * @return bool
+            */
+            bool download(const std::string& remotePath, const std::string& localPath, DmEfsBackupEntry& entry);
+
+            /**
+            * @brief loadManifest
+            *
+            * @param std::string filePath
+            * @return bool - false if there is none or it is not a manifest
+            */
+            bool loadManifest(std::string filePath);
+
+            /**
+            * @brief saveManifest - Written aside and renamed over the old one
+            *
+            * @param std::string filePath
+            * @return bool
+            */
+            bool saveManifest(std::string filePath);
+    };
+}
+
+#endif // _QC_DM_EFS_BACKUP_H_
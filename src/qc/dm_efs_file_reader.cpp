@@ -0,0 +1,340 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_efs_file_reader.cpp
+* @class OpenPST::DmEfsFileReader
+* @package OpenPST
+* @brief Pipelined EFS file reads streamed to disk
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "dm_efs_file_reader.h"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+using namespace OpenPST;
+
+/**
+* @brief truncateFile - Cut a local file down to size
+*/
+static bool truncateFile(const std::string& path, uint32_t size)
+{
+#ifdef _WIN32
+    int fd = _open(path.c_str(), _O_RDWR | _O_BINARY);
+
+    if (fd < 0) {
+        return false;
+    }
+
+    bool truncated = _chsize_s(fd, size) == 0;
+
+    _close(fd);
+
+    return truncated;
+#else
+    return ::truncate(path.c_str(), size) == 0;
+#endif
+}
+
+/**
+* @brief DmEfsFileReader - Constructor
+*
+* @param DmEfsManager& efs
+* @param size_t window
+* @param size_t chunkSize
+*/
+DmEfsFileReader::DmEfsFileReader(DmEfsManager& efs, size_t window, size_t chunkSize) :
+    efs(efs),
+    port(efs.getPort()),
+    window(window ? window : 1),
+    chunkSize(chunkSize ? chunkSize : DM_EFS_READ_DEFAULT_CHUNK_SIZE),
+    requestFrame(sizeof(QcdmEfsReadFileRequest)),
+    fp(-1),
+    end(0),
+    result(DmEfsManager::kDmEfsSuccess)
+{
+    memset(&stats, 0x00, sizeof(stats));
+}
+
+/**
+* @brief ~DmEfsFileReader - Deconstructor
+*/
+DmEfsFileReader::~DmEfsFileReader()
+{
+
+}
+
+/**
+* @brief read - Read a remote file into a local file
+*
+* @param std::string path
+* @param std::string outPath
+* @param DmEfsFileReadProgress progress
+*
+* @return int
+*/
+int DmEfsFileReader::read(std::string path, std::string outPath, DmEfsFileReadProgress progress)
+{
+    QcdmEfsFstatResponse fileInfo = {};
+
+    memset(&stats, 0x00, sizeof(stats));
+
+    queue.clear();
+    inFlight.clear();
+
+    started = std::chrono::steady_clock::now();
+    result  = DmEfsManager::kDmEfsSuccess;
+
+    int openResult = efs.open(path, O_RDONLY, 0x00, fp);
+
+    if (openResult != DmEfsManager::kDmEfsSuccess) {
+        return openResult;
+    }
+
+    int fstatResult = efs.fstat(fp, fileInfo);
+
+    if (fstatResult != DmEfsManager::kDmEfsSuccess || fileInfo.size < 0) {
+        efs.close(fp);
+        return fstatResult != DmEfsManager::kDmEfsSuccess ? fstatResult : DmEfsManager::kDmEfsError;
+    }
+
+    out.open(outPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!out.is_open()) {
+        efs.close(fp);
+        return DmEfsManager::kDmEfsIOError;
+    }
+
+    stats.fileSize = fileInfo.size;
+    end = fileInfo.size;
+
+    for (uint32_t offset = 0; offset < end; offset += chunkSize) {
+        Chunk chunk = { offset, end - offset < chunkSize ? end - offset : (uint32_t)chunkSize };
+        queue.push_back(chunk);
+    }
+
+    while (result == DmEfsManager::kDmEfsSuccess && (queue.size() || inFlight.size())) {
+        uint32_t before = stats.bytesRead;
+
+        try {
+            fill();
+
+            if (!receive()) {
+                LOGE("No response reading %s at offset %u\n", path.c_str(), inFlight.size() ? inFlight.begin()->first : 0);
+                result = DmEfsManager::kDmEfsIOError;
+            }
+        } catch (std::exception& e) {
+            LOGE("EFS read failed, %s\n", e.what());
+            result = DmEfsManager::kDmEfsIOError;
+        }
+
+        if (progress && stats.bytesRead != before) {
+            updateStats();
+
+            if (!progress(stats)) {
+                result = DmEfsManager::kDmEfsError;
+            }
+        }
+    }
+
+    drain();
+
+    out.close();
+
+    // reads that landed before the file shrank may have left data past the new end
+    if (end < stats.fileSize && !truncateFile(outPath, end)) {
+        LOGE("Could not truncate %s to %u bytes\n", outPath.c_str(), end);
+        result = DmEfsManager::kDmEfsIOError;
+    }
+
+    efs.close(fp);
+
+    updateStats();
+
+    return result;
+}
+
+/**
+* @brief getStats
+*
+* @return DmEfsFileReadStats
+*/
+DmEfsFileReadStats DmEfsFileReader::getStats()
+{
+    return stats;
+}
+
+/**
+* @brief fill - Send reads until the window is full, in a single write
+*/
+void DmEfsFileReader::fill()
+{
+    std::vector<uint8_t> frames;
+
+    while (queue.size() && inFlight.size() < window) {
+        Chunk chunk = queue.front();
+
+        queue.pop_front();
+
+        if (chunk.offset >= end) {
+            continue;
+        }
+
+        QcdmEfsReadFileRequest packet = {};
+
+        packet.header.command       = efs.getSubsystemCommand();
+        packet.header.subsysId      = efs.getSubsystemId();
+        packet.header.subsysCommand = DIAG_EFS_READ;
+        packet.fp                   = fp;
+        packet.size                 = chunk.size;
+        packet.offset               = chunk.offset;
+
+        requestFrame.set(0, reinterpret_cast<const uint8_t*>(&packet), sizeof(packet));
+
+        frames.insert(frames.end(), requestFrame.getFrame(), requestFrame.getFrame() + requestFrame.getFrameSize());
+
+        inFlight[chunk.offset] = chunk;
+
+        stats.requests++;
+    }
+
+    if (frames.size()) {
+        port.write(&frames[0], frames.size(), false);
+    }
+}
+
+/**
+* @brief receive - Read whatever the device has sent and dispatch complete frames
+*
+* @return bool - false if nothing arrived before the timeout
+*/
+bool DmEfsFileReader::receive()
+{
+    return port.receiveResponses([this](const uint8_t* packet, size_t size) {
+        dispatch(packet, size);
+    });
+}
+
+/**
+* @brief dispatch - Match a received frame to its read and write the data out
+*
+* @param uint8_t* data - Unescaped packet without its CRC
+* @param size_t packetSize
+*/
+void DmEfsFileReader::dispatch(const uint8_t* data, size_t packetSize)
+{
+    switch (data[0]) {
+        case DIAG_BAD_CMD_F:
+        case DIAG_BAD_PARM_F:
+        case DIAG_BAD_LEN_F:
+        case DIAG_BAD_MODE_F:
+        case DIAG_BAD_SPC_MODE_F:
+        case DIAG_BAD_SEC_MODE_F: {
+            // the rejected request follows the error code
+            const QcdmEfsReadFileRequest* echo = (const QcdmEfsReadFileRequest*)&data[1];
+
+            if (packetSize < 1 + sizeof(QcdmEfsReadFileRequest) || echo->header.subsysCommand != DIAG_EFS_READ) {
+                return;
+            }
+
+            if (inFlight.erase(echo->offset)) {
+                LOGE("EFS read at offset %u rejected with %d\n", echo->offset, data[0]);
+                result = DmEfsManager::kDmEfsError;
+            }
+
+            return;
+        }
+    }
+
+    const QcdmEfsReadFileResponse* response = (const QcdmEfsReadFileResponse*)&data[0];
+
+    if (packetSize < sizeof(QcdmEfsReadFileResponse) ||
+        response->header.command != efs.getSubsystemCommand() ||
+        response->header.subsysId != efs.getSubsystemId() ||
+        response->header.subsysCommand != DIAG_EFS_READ ||
+        response->fp != fp
+    ) {
+        // streamed logs and anything else not ours
+        return;
+    }
+
+    auto it = inFlight.find(response->offset);
+
+    if (it == inFlight.end()) {
+        return;
+    }
+
+    Chunk chunk = it->second;
+
+    inFlight.erase(it);
+
+    if (response->error || response->bytesRead < 0 || (uint32_t)response->bytesRead > chunk.size ||
+        packetSize < sizeof(QcdmEfsReadFileResponse) + response->bytesRead
+    ) {
+        LOGE("EFS read at offset %u failed with error %d\n", chunk.offset, response->error);
+        result = DmEfsManager::kDmEfsError;
+        return;
+    }
+
+    if (!response->bytesRead) {
+        // the file is shorter than it was when it was opened
+        if (chunk.offset < end) {
+            end = chunk.offset;
+        }
+
+        return;
+    }
+
+    out.seekp(chunk.offset);
+    out.write(reinterpret_cast<const char*>(response->data), response->bytesRead);
+
+    if (!out.good()) {
+        result = DmEfsManager::kDmEfsIOError;
+        return;
+    }
+
+    stats.bytesRead += response->bytesRead;
+
+    if ((uint32_t)response->bytesRead < chunk.size) {
+        Chunk rest = { chunk.offset + response->bytesRead, chunk.size - response->bytesRead };
+
+        stats.shortReads++;
+
+        queue.push_front(rest);
+    }
+}
+
+/**
+* @brief drain - Wait out the reads still in flight
+*/
+void DmEfsFileReader::drain()
+{
+    while (inFlight.size()) {
+        try {
+            if (!receive()) {
+                break;
+            }
+        } catch (std::exception& e) {
+            break;
+        }
+    }
+
+    inFlight.clear();
+    queue.clear();
+}
+
+/**
+* @brief updateStats
+*/
+void DmEfsFileReader::updateStats()
+{
+    uint64_t elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count();
+
+    stats.elapsed    = (uint32_t)elapsed;
+    stats.throughput = elapsed ? (uint32_t)((uint64_t)stats.bytesRead * 1000 / elapsed) : 0;
+}
@@ -0,0 +1,158 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_efs_file_reader.h
+* @class OpenPST::DmEfsFileReader
+* @package OpenPST
+* @brief Pipelined EFS file reads streamed to disk
+*
+* A file is read with DIAG_EFS_READ requests of at most chunkSize bytes at
+* advancing offsets, so no response grows past what fits in a DIAG packet.
+* Up to window requests are kept in flight and matched back by the offset the
+* device echoes, the same way DmMemoryReader matches peeks. Each chunk is
+* written at its own offset in the output file as it arrives, nothing is held
+* in memory past the chunk being written.
+*
+* A short read is requested again from where it stopped. A read returning
+* nothing means the file ended early, chunks past that are dropped and the
+* output file ends there too.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_EFS_FILE_READER_H_
+#define _QC_DM_EFS_FILE_READER_H_
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <fcntl.h>
+#include "include/definitions.h"
+#include "qc/dm.h"
+#include "qc/dm_efs.h"
+#include "qc/dm_efs_manager.h"
+#include "qc/hdlc.h"
+#include "qc/hdlc_frame_template.h"
+#include "serial/qcdm_serial.h"
+
+/**
+* Reads kept in flight when no window is given
+*/
+#define DM_EFS_READ_DEFAULT_WINDOW 4
+
+/**
+* Bytes asked for by each read when no chunk size is given, the response
+* with its header stays within DIAG_MAX_PACKET_SIZE even fully escaped
+*/
+#define DM_EFS_READ_DEFAULT_CHUNK_SIZE 1024
+
+namespace OpenPST {
+
+    struct DmEfsFileReadStats {
+        uint32_t fileSize;      // as reported by fstat
+        uint32_t bytesRead;     // written to the output file so far
+        uint32_t requests;      // reads sent, re-requested short reads included
+        uint32_t shortReads;
+        uint32_t elapsed;       // ms
+        uint32_t throughput;    // bytes per second
+    };
+
+    /**
+    * Called after every chunk written, return false to stop the read
+    */
+    typedef std::function<bool(const DmEfsFileReadStats& stats)> DmEfsFileReadProgress;
+
+    /**
+    * @brief OpenPST::DmEfsFileReader
+    */
+    class DmEfsFileReader {
+        public:
+            /**
+            * @brief DmEfsFileReader - Constructor
+            *
+            * @param DmEfsManager& efs - Subsystem settings and the port are taken from here
+            * @param size_t window - Reads kept in flight, 1 reads a chunk at a time
+            * @param size_t chunkSize - Bytes per read
+            */
+            DmEfsFileReader(DmEfsManager& efs, size_t window = DM_EFS_READ_DEFAULT_WINDOW, size_t chunkSize = DM_EFS_READ_DEFAULT_CHUNK_SIZE);
+
+            /**
+            * @brief ~DmEfsFileReader - Deconstructor
+            */
+            ~DmEfsFileReader();
+
+            /**
+            * @brief read - Read a remote file into a local file
+            *
+            * @param std::string path - Remote path
+            * @param std::string outPath - Local path, truncated first
+            * @param DmEfsFileReadProgress progress
+            *
+            * @return int - DmEfsManager::DmEfsOperationResult, kDmEfsError as well when stopped by progress
+            */
+            int read(std::string path, std::string outPath, DmEfsFileReadProgress progress = nullptr);
+
+            /**
+            * @brief getStats - Of the last read
+            *
+            * @return DmEfsFileReadStats
+            */
+            DmEfsFileReadStats getStats();
+
+        private:
+            struct Chunk {
+                uint32_t offset;
+                uint32_t size;
+            };
+
+            DmEfsManager& efs;
+            QcdmSerial& port;
+            size_t window;
+            size_t chunkSize;
+            std::deque<Chunk> queue;                // not yet sent, short read remainders go first
+            std::map<uint32_t, Chunk> inFlight;     // by offset
+            HdlcFrameTemplate requestFrame;
+            std::ofstream out;
+            int32_t fp;
+            uint32_t end;                           // where the file ended, the fstat size unless a read came back empty
+            int result;
+            DmEfsFileReadStats stats;
+            std::chrono::steady_clock::time_point started;
+
+            /**
+            * @brief fill - Send reads until the window is full, in a single write
+            */
+            void fill();
+
+            /**
+            * @brief receive - Read whatever the device has sent and dispatch complete frames
+            *
+            * @return bool - false if nothing arrived before the timeout
+            */
+            bool receive();
+
+            /**
+            * @brief dispatch - Match a received frame to its read and write the data out
+            *
+            * @param uint8_t* data - Unescaped packet without its CRC
+            * @param size_t packetSize
+            */
+            void dispatch(const uint8_t* data, size_t packetSize);
+
+            /**
+            * @brief drain - Wait out the reads still in flight so they are not
+            * taken as the response to the next command
+            */
+            void drain();
+
+            /**
+            * @brief updateStats
+            */
+            void updateStats();
+    };
+}
+
+#endif // _QC_DM_EFS_FILE_READER_H_
@@ -0,0 +1,424 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_efs_file_writer.cpp
+* @class OpenPST::DmEfsFileWriter
+* @package OpenPST
+* @brief Pipelined EFS file writes from a mapped local file
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "dm_efs_file_writer.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace OpenPST;
+
+/**
+* @brief DmEfsFileWriter - Constructor
+*
+* @param DmEfsManager& efs
+* @param size_t window
+* @param size_t chunkSize
+*/
+DmEfsFileWriter::DmEfsFileWriter(DmEfsManager& efs, size_t window, size_t chunkSize) :
+    efs(efs),
+    port(efs.getPort()),
+    window(window ? window : 1),
+    chunkSize(chunkSize && chunkSize < DM_EFS_WRITE_MAX_CHUNK_SIZE ? chunkSize : DM_EFS_WRITE_MAX_CHUNK_SIZE),
+    data(nullptr),
+    size(0),
+#ifdef _WIN32
+    fileHandle(INVALID_HANDLE_VALUE),
+    mappingHandle(nullptr),
+#endif
+    fp(-1),
+    result(DmEfsManager::kDmEfsSuccess)
+{
+    memset(&stats, 0x00, sizeof(stats));
+
+    packet.reserve(offsetof(QcdmEfsWriteFileRequest, data) + this->chunkSize);
+}
+
+/**
+* @brief ~DmEfsFileWriter - Deconstructor, unmaps the file
+*/
+DmEfsFileWriter::~DmEfsFileWriter()
+{
+    unmap();
+}
+
+/**
+* @brief write - Write a local file to a remote file
+*
+* @param std::string localPath
+* @param std::string remotePath
+* @param bool verify
+* @param DmEfsFileWriteProgress progress
+* @param int32_t mode
+*
+* @return int
+*/
+int DmEfsFileWriter::write(std::string localPath, std::string remotePath, bool verify, DmEfsFileWriteProgress progress, int32_t mode)
+{
+    memset(&stats, 0x00, sizeof(stats));
+
+    queue.clear();
+    inFlight.clear();
+
+    started = std::chrono::steady_clock::now();
+    result  = DmEfsManager::kDmEfsSuccess;
+
+    if (!map(localPath)) {
+        return DmEfsManager::kDmEfsIOError;
+    }
+
+    if ((uint64_t)size > UINT32_MAX) {
+        LOGE("%s is too large for EFS\n", localPath.c_str());
+        unmap();
+        return DmEfsManager::kDmEfsError;
+    }
+
+    int openResult = efs.open(remotePath, DIAG_EFS_O_WRONLY | DIAG_EFS_O_CREAT | DIAG_EFS_O_TRUNC, mode, fp);
+
+    if (openResult != DmEfsManager::kDmEfsSuccess) {
+        unmap();
+        return openResult;
+    }
+
+    stats.fileSize = (uint32_t)size;
+
+    for (uint32_t offset = 0; offset < stats.fileSize; offset += chunkSize) {
+        Chunk chunk = { offset, stats.fileSize - offset < chunkSize ? stats.fileSize - offset : (uint32_t)chunkSize };
+        queue.push_back(chunk);
+    }
+
+    while (result == DmEfsManager::kDmEfsSuccess && (queue.size() || inFlight.size())) {
+        uint32_t before = stats.bytesWritten;
+
+        try {
+            fill();
+
+            if (!receive()) {
+                LOGE("No response writing %s at offset %u\n", remotePath.c_str(), inFlight.size() ? inFlight.begin()->first : 0);
+                result = DmEfsManager::kDmEfsIOError;
+            }
+        } catch (std::exception& e) {
+            LOGE("EFS write failed, %s\n", e.what());
+            result = DmEfsManager::kDmEfsIOError;
+        }
+
+        if (progress && stats.bytesWritten != before) {
+            updateStats();
+
+            if (!progress(stats)) {
+                result = DmEfsManager::kDmEfsError;
+            }
+        }
+    }
+
+    drain();
+
+    int closeResult = efs.close(fp);
+
+    if (result == DmEfsManager::kDmEfsSuccess && closeResult != DmEfsManager::kDmEfsSuccess) {
+        // the last data may only reach flash on close
+        result = closeResult;
+    }
+
+    updateStats();
+
+    if (result == DmEfsManager::kDmEfsSuccess && verify) {
+        std::string remoteHash;
+        std::string localHash = md5_hex(data, size);
+
+        result = efs.md5sum(remotePath, remoteHash);
+
+        if (result == DmEfsManager::kDmEfsSuccess && remoteHash != localHash) {
+            LOGE("%s md5 mismatch, device has %s expected %s\n", remotePath.c_str(), remoteHash.c_str(), localHash.c_str());
+            result = DmEfsManager::kDmEfsError;
+        }
+
+        stats.verified = result == DmEfsManager::kDmEfsSuccess;
+    }
+
+    unmap();
+
+    return result;
+}
+
+/**
+* @brief getStats
+*
+* @return DmEfsFileWriteStats
+*/
+DmEfsFileWriteStats DmEfsFileWriter::getStats()
+{
+    return stats;
+}
+
+/**
+* @brief map - Map the local file, an empty file maps to nothing
+*
+* @param std::string localPath
+*
+* @return bool
+*/
+bool DmEfsFileWriter::map(std::string localPath)
+{
+    unmap();
+
+#ifdef _WIN32
+    LARGE_INTEGER fileSize;
+
+    fileHandle = CreateFileA(localPath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (fileHandle == INVALID_HANDLE_VALUE || !GetFileSizeEx(fileHandle, &fileSize)) {
+        LOGE("Could not open %s\n", localPath.c_str());
+        unmap();
+        return false;
+    }
+
+    if (!fileSize.QuadPart) {
+        return true;
+    }
+
+    mappingHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    if (mappingHandle != nullptr) {
+        data = (const uint8_t*)MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    }
+
+    size = (size_t)fileSize.QuadPart;
+#else
+    struct stat fileStat;
+    int fd = ::open(localPath.c_str(), O_RDONLY);
+
+    if (fd < 0 || fstat(fd, &fileStat) != 0) {
+        LOGE("Could not open %s\n", localPath.c_str());
+
+        if (fd >= 0) {
+            ::close(fd);
+        }
+
+        return false;
+    }
+
+    if (!fileStat.st_size) {
+        ::close(fd);
+        return true;
+    }
+
+    void* mapped = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    ::close(fd);
+
+    if (mapped != MAP_FAILED) {
+        data = (const uint8_t*)mapped;
+        size = fileStat.st_size;
+#ifdef MADV_SEQUENTIAL
+        madvise(mapped, size, MADV_SEQUENTIAL);
+#endif
+    }
+#endif
+
+    if (data == nullptr) {
+        LOGE("Could not map %s\n", localPath.c_str());
+        unmap();
+        return false;
+    }
+
+    return true;
+}
+
+/**
+* @brief unmap
+*/
+void DmEfsFileWriter::unmap()
+{
+#ifdef _WIN32
+    if (data != nullptr) {
+        UnmapViewOfFile(data);
+    }
+
+    if (mappingHandle != nullptr) {
+        CloseHandle(mappingHandle);
+    }
+
+    if (fileHandle != INVALID_HANDLE_VALUE) {
+        CloseHandle(fileHandle);
+    }
+
+    fileHandle = INVALID_HANDLE_VALUE;
+    mappingHandle = nullptr;
+#else
+    if (data != nullptr) {
+        munmap((void*)data, size);
+    }
+#endif
+
+    data = nullptr;
+    size = 0;
+}
+
+/**
+* @brief fill - Send writes until the window is full, in a single port write
+*/
+void DmEfsFileWriter::fill()
+{
+    QcdmSubsysHeader header = {};
+
+    header.command       = efs.getSubsystemCommand();
+    header.subsysId      = efs.getSubsystemId();
+    header.subsysCommand = DIAG_EFS_WRITE;
+
+    txBuffer.clear();
+
+    while (queue.size() && inFlight.size() < window) {
+        Chunk chunk = queue.front();
+
+        queue.pop_front();
+
+        // the request is assembled once for the CRC, then escaped straight into the outgoing buffer
+        packet.resize(offsetof(QcdmEfsWriteFileRequest, data) + chunk.size);
+
+        QcdmEfsWriteFileRequest* request = (QcdmEfsWriteFileRequest*)&packet[0];
+
+        request->header = header;
+        request->fp     = fp;
+        request->offset = chunk.offset;
+
+        memcpy(request->data, data + chunk.offset, chunk.size);
+
+        hdlc_append(txBuffer, &packet[0], packet.size());
+
+        inFlight[chunk.offset] = chunk;
+
+        stats.requests++;
+    }
+
+    if (txBuffer.size()) {
+        port.write(&txBuffer[0], txBuffer.size(), false);
+    }
+}
+
+/**
+* @brief receive - Read whatever the device has sent and dispatch complete frames
+*
+* @return bool - false if nothing arrived before the timeout
+*/
+bool DmEfsFileWriter::receive()
+{
+    return port.receiveResponses([this](const uint8_t* packet, size_t size) {
+        dispatch(packet, size);
+    });
+}
+
+/**
+* @brief dispatch - Match a received frame to its write
+*
+* @param uint8_t* response - Unescaped packet without its CRC
+* @param size_t packetSize
+*/
+void DmEfsFileWriter::dispatch(const uint8_t* response, size_t packetSize)
+{
+    switch (response[0]) {
+        case DIAG_BAD_CMD_F:
+        case DIAG_BAD_PARM_F:
+        case DIAG_BAD_LEN_F:
+        case DIAG_BAD_MODE_F:
+        case DIAG_BAD_SPC_MODE_F:
+        case DIAG_BAD_SEC_MODE_F: {
+            // the rejected request follows the error code, a too long one may be cut short after its offset
+            const QcdmEfsWriteFileRequest* echo = (const QcdmEfsWriteFileRequest*)&response[1];
+
+            if (packetSize < 1 + offsetof(QcdmEfsWriteFileRequest, data) || echo->header.subsysCommand != DIAG_EFS_WRITE) {
+                return;
+            }
+
+            if (inFlight.erase(echo->offset)) {
+                LOGE("EFS write at offset %u rejected with %d\n", echo->offset, response[0]);
+                result = DmEfsManager::kDmEfsError;
+            }
+
+            return;
+        }
+    }
+
+    const QcdmEfsWriteFileResponse* write = (const QcdmEfsWriteFileResponse*)&response[0];
+
+    if (packetSize < sizeof(QcdmEfsWriteFileResponse) ||
+        write->header.command != efs.getSubsystemCommand() ||
+        write->header.subsysId != efs.getSubsystemId() ||
+        write->header.subsysCommand != DIAG_EFS_WRITE ||
+        write->fp != fp
+    ) {
+        // streamed logs and anything else not ours
+        return;
+    }
+
+    auto it = inFlight.find(write->offset);
+
+    if (it == inFlight.end()) {
+        return;
+    }
+
+    Chunk chunk = it->second;
+
+    inFlight.erase(it);
+
+    if (write->error || write->bytesWritten <= 0 || (uint32_t)write->bytesWritten > chunk.size) {
+        // nothing written with no error is a full file system
+        LOGE("EFS write at offset %u failed, %d bytes written with error %d\n", chunk.offset, write->bytesWritten, write->error);
+        result = DmEfsManager::kDmEfsError;
+        return;
+    }
+
+    stats.bytesWritten += write->bytesWritten;
+
+    if ((uint32_t)write->bytesWritten < chunk.size) {
+        Chunk rest = { chunk.offset + write->bytesWritten, chunk.size - write->bytesWritten };
+
+        stats.shortWrites++;
+
+        queue.push_front(rest);
+    }
+}
+
+/**
+* @brief drain - Wait out the writes still in flight
+*/
+void DmEfsFileWriter::drain()
+{
+    while (inFlight.size()) {
+        try {
+            if (!receive()) {
+                break;
+            }
+        } catch (std::exception& e) {
+            break;
+        }
+    }
+
+    inFlight.clear();
+    queue.clear();
+}
+
+/**
+* @brief updateStats
+*/
+void DmEfsFileWriter::updateStats()
+{
+    uint64_t elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count();
+
+    stats.elapsed    = (uint32_t)elapsed;
+    stats.throughput = elapsed ? (uint32_t)((uint64_t)stats.bytesWritten * 1000 / elapsed) : 0;
+}
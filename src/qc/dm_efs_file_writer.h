@@ -0,0 +1,179 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_efs_file_writer.h
+* @class OpenPST::DmEfsFileWriter
+* @package OpenPST
+* @brief Pipelined EFS file writes from a mapped local file
+*
+* The local file is mapped and sent straight from the mapping in the largest
+* DIAG_EFS_WRITE payloads a packet holds, at advancing offsets. Up to window
+* writes are kept in flight and matched back by the offset the device echoes,
+* a short write is sent again from where it stopped.
+*
+* With verify set the device is asked for the md5 of the written file once it
+* is closed, and it is compared with the md5 of the mapping.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_EFS_FILE_WRITER_H_
+#define _QC_DM_EFS_FILE_WRITER_H_
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <chrono>
+#include <functional>
+#include <cstddef>
+#include "include/definitions.h"
+#include "qc/dm.h"
+#include "qc/dm_efs.h"
+#include "qc/dm_efs_manager.h"
+#include "qc/hdlc.h"
+#include "serial/qcdm_serial.h"
+#include "util/md5.h"
+
+/**
+* Writes kept in flight when no window is given
+*/
+#define DM_EFS_WRITE_DEFAULT_WINDOW 4
+
+/**
+* Largest payload of a single write, the request with its CRC fills DIAG_MAX_PACKET_SIZE before escaping
+*/
+#define DM_EFS_WRITE_MAX_CHUNK_SIZE (DIAG_MAX_PACKET_SIZE - offsetof(QcdmEfsWriteFileRequest, data) - sizeof(uint16_t))
+
+/**
+* Mode new files are created with
+*/
+#define DM_EFS_WRITE_DEFAULT_MODE 0644
+
+namespace OpenPST {
+
+    struct DmEfsFileWriteStats {
+        uint32_t fileSize;      // of the local file
+        uint32_t bytesWritten;  // acknowledged by the device so far
+        uint32_t requests;      // writes sent, re-sent short writes included
+        uint32_t shortWrites;
+        uint32_t elapsed;       // ms
+        uint32_t throughput;    // bytes per second
+        bool     verified;      // the device md5 matched the local one
+    };
+
+    /**
+    * Called after every acknowledged write, return false to stop the write
+    */
+    typedef std::function<bool(const DmEfsFileWriteStats& stats)> DmEfsFileWriteProgress;
+
+    /**
+    * @brief OpenPST::DmEfsFileWriter
+    */
+    class DmEfsFileWriter {
+        public:
+            /**
+            * @brief DmEfsFileWriter - Constructor
+            *
+            * @param DmEfsManager& efs - Subsystem settings and the port are taken from here
+            * @param size_t window - Writes kept in flight, 1 writes a chunk at a time
+            * @param size_t chunkSize - Bytes per write, at most DM_EFS_WRITE_MAX_CHUNK_SIZE
+            */
+            DmEfsFileWriter(DmEfsManager& efs, size_t window = DM_EFS_WRITE_DEFAULT_WINDOW, size_t chunkSize = DM_EFS_WRITE_MAX_CHUNK_SIZE);
+
+            /**
+            * @brief ~DmEfsFileWriter - Deconstructor
+            */
+            ~DmEfsFileWriter();
+
+            /**
+            * @brief write - Write a local file to a remote file
+            *
+            * @param std::string localPath
+            * @param std::string remotePath - Created, or truncated if it exists
+            * @param bool verify - Compare md5 sums once written
+            * @param DmEfsFileWriteProgress progress
+            * @param int32_t mode - Mode the remote file is created with
+            *
+            * @return int - DmEfsManager::DmEfsOperationResult, kDmEfsError as well when stopped by progress or on an md5 mismatch
+            */
+            int write(std::string localPath, std::string remotePath, bool verify = false, DmEfsFileWriteProgress progress = nullptr, int32_t mode = DM_EFS_WRITE_DEFAULT_MODE);
+
+            /**
+            * @brief getStats - Of the last write
+            *
+            * @return DmEfsFileWriteStats
+            */
+            DmEfsFileWriteStats getStats();
+
+        private:
+            struct Chunk {
+                uint32_t offset;
+                uint32_t size;
+            };
+
+            DmEfsManager& efs;
+            QcdmSerial& port;
+            size_t window;
+            size_t chunkSize;
+            std::deque<Chunk> queue;                // not yet sent, short write remainders go first
+            std::map<uint32_t, Chunk> inFlight;     // by offset
+            std::vector<uint8_t> txBuffer;          // frames of the writes going out in one port write
+            std::vector<uint8_t> packet;            // request being framed
+            const uint8_t* data;
+            size_t size;
+#ifdef _WIN32
+            void* fileHandle;
+            void* mappingHandle;
+#endif
+            int32_t fp;
+            int result;
+            DmEfsFileWriteStats stats;
+            std::chrono::steady_clock::time_point started;
+
+            /**
+            * @brief map - Map the local file, an empty file maps to nothing
+            *
+            * @param std::string localPath
+            * @return bool
+            */
+            bool map(std::string localPath);
+
+            /**
+            * @brief unmap
+            */
+            void unmap();
+
+            /**
+            * @brief fill - Send writes until the window is full, in a single port write
+            */
+            void fill();
+
+            /**
+            * @brief receive - Read whatever the device has sent and dispatch complete frames
+            *
+            * @return bool - false if nothing arrived before the timeout
+            */
+            bool receive();
+
+            /**
+            * @brief dispatch - Match a received frame to its write
+            *
+            * @param uint8_t* response - Unescaped packet without its CRC
+            * @param size_t packetSize
+            */
+            void dispatch(const uint8_t* response, size_t packetSize);
+
+            /**
+            * @brief drain - Wait out the writes still in flight so they are not
+            * taken as the response to the next command
+            */
+            void drain();
+
+            /**
+            * @brief updateStats
+            */
+            void updateStats();
+    };
+}
+
+#endif // _QC_DM_EFS_FILE_WRITER_H_
@@ -11,6 +11,8 @@
 */
 
 #include "dm_efs_manager.h"
+#include "dm_efs_file_reader.h"
+#include "dm_efs_file_writer.h"
 
 using namespace OpenPST;
 
@@ -74,6 +76,30 @@ uint32_t DmEfsManager::getSubsystemId()
     return subsystemId;
 }
 
+/**
+* @brief getPort - Port the EFS subsystem is accessed over
+*
+* @return QcdmSerial&
+*/
+QcdmSerial& DmEfsManager::getPort()
+{
+    return port;
+}
+
+/**
+* @brief invalidateNvCache - Drop the NV cache of the port when a path is
+* where the device keeps NV items, /nv/item_files and the legacy /nvm
+*
+* @param std::string path
+* @return void
+*/
+void DmEfsManager::invalidateNvCache(const std::string& path)
+{
+    if (path.compare(0, 3, "/nv") == 0) {
+        port.invalidateNvCache();
+    }
+}
+
 /**
 * @brief DmEfsManager::hello - Send the hello and receive configuration parameters
 *
@@ -178,6 +204,10 @@ int DmEfsManager::open(std::string path, int32_t flags, int32_t mode, int32_t& f
         return kDmEfsIOError;
     }
 
+    if (flags & (DIAG_EFS_O_WRONLY | DIAG_EFS_O_RDWR | DIAG_EFS_O_CREAT | DIAG_EFS_O_TRUNC)) {
+        invalidateNvCache(path);
+    }
+
     size_t packetSize = sizeof(QcdmEfsOpenFileRequest) + path.size();
     QcdmEfsOpenFileRequest* packet = (QcdmEfsOpenFileRequest*) new uint8_t[packetSize]();
 
@@ -276,8 +306,6 @@ int DmEfsManager::read(int32_t fp, size_t size, uint32_t offset, std::vector<uin
     }
     
     QcdmEfsReadFileResponse* response = (QcdmEfsReadFileResponse*)buffer;
-    
-    hexdump(response->data, rxSize - sizeof(QcdmEfsReadFileResponse));
 
     data.insert(data.end(), response->data, response->data + (rxSize - sizeof(QcdmEfsReadFileResponse)));
     
@@ -298,61 +326,78 @@ int DmEfsManager::read(std::string path, std::string outPath)
         return kDmEfsIOError;
     }
 
-    int32_t fp;
-    
-    int openResult = open(path, O_RDONLY, 0x00, fp);
+    // one read of the whole file would not fit in a response past a few KB
+    DmEfsFileReader reader(*this);
 
-    if (openResult != kDmEfsSuccess) {
-        return openResult;
-    }
+    return reader.read(path, outPath);
+}
 
-    QcdmEfsFstatResponse fileInfo;
+/**
+* @brief DmEfsManager::write - Write to a file, in as many requests as it takes
+*
+* @param int32_t - fp of file
+* @param uint8_t* - data to write
+* @param size_t amount - amount of data to write
+* @param uint32_t offset - offset in file to start writing at
+*
+* @return int
+*/
+int DmEfsManager::write(int32_t fp, uint8_t* data, size_t amount, uint32_t offset)
+{
+    if (!port.isOpen()) {
+        return kDmEfsIOError;
+    }
 
-    int fstatResult = fstat(fp, fileInfo);
+    size_t written = 0;
+    size_t chunkSize = amount < DM_EFS_WRITE_MAX_CHUNK_SIZE ? amount : DM_EFS_WRITE_MAX_CHUNK_SIZE;
+    std::vector<uint8_t> packet(offsetof(QcdmEfsWriteFileRequest, data) + chunkSize);
+    QcdmEfsWriteFileRequest* request = (QcdmEfsWriteFileRequest*)&packet[0];
 
-    if (fstatResult != kDmEfsSuccess) {
-        return fstatResult;
-    }
+    request->header = getHeader(DIAG_EFS_WRITE);
+    request->fp = fp;
 
-    if (fileInfo.size <= 0) {
-        return kDmEfsError;
-    }
+    while (written < amount) {
+        size_t size = amount - written < chunkSize ? amount - written : chunkSize;
 
-    std::vector<uint8_t> data;
+        request->offset = offset + written;
+        std::memcpy(request->data, data + written, size);
 
-    int readResult = read(fp, fileInfo.size, 0x00, data);
+        int commandResult = sendCommand(DIAG_EFS_WRITE, &packet[0], offsetof(QcdmEfsWriteFileRequest, data) + size);
 
-    if (readResult != kDmEfsSuccess) {
-        close(fp);
-        return readResult;
-    }
+        if (commandResult != kDmEfsSuccess) {
+            return commandResult;
+        }
 
-    close(fp);
+        QcdmEfsWriteFileResponse* response = (QcdmEfsWriteFileResponse*)buffer;
 
-    std::ofstream out(outPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        if (response->error || response->bytesWritten <= 0 || (size_t)response->bytesWritten > size) {
+            return kDmEfsError;
+        }
 
-    if (!out.is_open()) {
-        return kDmEfsIOError;
+        written += response->bytesWritten;
     }
 
-    out.write(reinterpret_cast<char*>(&data[0]), data.size());
-
     return kDmEfsSuccess;
 }
 
 /**
-* @brief DmEfsManager::write - Write to a file
+* @brief DmEfsManager::write - Write from a file to a file
 *
-* @param int32_t - fp of file
-* @param uint8_t* - data to write
-* @param size_t amount - amount of data to write
-* @paramuint32_t offset - offset in file to start writing at
+* @param std::string - Local path to read
+* @param std::string - Remote path to write
+* @param bool verify - Compare md5 sums once written
 *
 * @return int
 */
-int DmEfsManager::write(int32_t fp, uint8_t* data, size_t amount, uint32_t offset)
+int DmEfsManager::write(std::string localPath, std::string path, bool verify)
 {
-    return 0;
+    if (!port.isOpen()) {
+        return kDmEfsIOError;
+    }
+
+    DmEfsFileWriter writer(*this);
+
+    return writer.write(localPath, path, verify);
 }
 
 /**
@@ -369,6 +414,8 @@ int DmEfsManager::symlink(std::string path, std::string linkPath)
         return kDmEfsIOError;
     }
 
+    invalidateNvCache(linkPath);
+
     size_t packetSize = sizeof(QcdmEfsCreateLinkRequest) + path.size() + linkPath.size();
     QcdmEfsCreateLinkRequest* packet = (QcdmEfsCreateLinkRequest*) new uint8_t[packetSize]();
 
@@ -447,6 +494,8 @@ int DmEfsManager::unlink(std::string path)
         return kDmEfsIOError;
     }
 
+    invalidateNvCache(path);
+
     size_t packetSize = sizeof(QcdmEfsUnlinkRequest) + path.size();
     QcdmEfsUnlinkRequest* packet = (QcdmEfsUnlinkRequest*) new uint8_t[packetSize]();
 
@@ -595,77 +644,86 @@ int DmEfsManager::openDir(std::string path, uint32_t& dp)
 * @return int
 */
 int DmEfsManager::readDir(std::string path, std::vector<DmEfsNode>& contents, bool recursive)
+{
+    std::shared_ptr<DmEfsTree> tree = std::make_shared<DmEfsTree>();
+
+    int readResult = readDir(path, *tree, recursive);
+
+    if (readResult != kDmEfsSuccess) {
+        return readResult;
+    }
+
+    std::vector<DmEfsNode> children = DmEfsNode(tree, 0).getChildren();
+
+    contents.insert(contents.end(), children.begin(), children.end());
+
+    return kDmEfsSuccess;
+}
+
+/**
+* @brief DmEfsManager::readDir - Read a directory contents into a tree, optionally recursively
+*
+* @param std:;string path - Full path to directory
+* @param DmEfsTree& tree
+* @param bool - read recursively
+*
+* @return int
+*/
+int DmEfsManager::readDir(std::string path, DmEfsTree& tree, bool recursive)
 {
     if (!port.isOpen()) {
         return kDmEfsIOError;
     }
 
-    size_t txSize, rxSize;
+    if (!path.size() || path.back() != '/') {
+        path.append("/");
+    }
+
+    tree.clear(path);
+
     uint32_t dp;
 
-    int openResult = openResult = openDir(path, dp);
+    int openResult = openDir(path, dp);
 
     if (openResult != kDmEfsSuccess) {
         return openResult;
     }
 
-    QcdmEfsReadDirRequest packet = {};
-    packet.header = getHeader(DIAG_EFS_READDIR);
-    packet.dp = dp;
-    packet.sequenceNumber = 1;
+    int readResult = readDirEntries(dp, path, tree, 0);
 
-    do {
+    if (closeDir(dp) != kDmEfsSuccess) {
+        LOGI("Error closing directory %s\n", path.c_str());
+    }
 
-        int commandResult = sendCommand(DIAG_EFS_READDIR, reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
+    if (readResult != kDmEfsSuccess || !recursive) {
+        return readResult;
+    }
 
-        if (commandResult != kDmEfsSuccess) {
-            if (closeDir(dp) != kDmEfsSuccess) {
-                LOGI("Error closing directory %s\n", path.c_str());
-            }
-            return commandResult;
+    // breadth first, each directory is read in full before the next so its entries stay together
+    for (uint32_t i = 1; i < tree.size(); i++) {
+        if (tree.getEntry(i).type != DIAG_EFS_FILE_TYPE_DIR) {
+            continue;
         }
 
-        QcdmEfsReadDirResponse* response = (QcdmEfsReadDirResponse*)buffer;
+        std::string checkPath = tree.getPath(i).append("/");
 
-        if (response->sequenceNumber != packet.sequenceNumber) {
-            LOGI("Invalid readDir Sequence Received\n");
+        if (openDir(checkPath, dp) != kDmEfsSuccess) {
+            LOGE("Error on recursive readDir for %s\n", checkPath.c_str());
+            tree.setError(i, 0x000001);
+            continue;
         }
 
-        if (response->error) {
-            LOGE("Error Reading %s/%s. Error: %08X\n", path.c_str(), response->name, response->error);
+        if (readDirEntries(dp, checkPath, tree, i) != kDmEfsSuccess) {
+            LOGE("Error on recursive readDir for %s\n", checkPath.c_str());
+            tree.setError(i, 0x000001);
         }
 
-        if (strlen(response->name) == 0) {
-            break; // end
+        if (closeDir(dp) != kDmEfsSuccess) {
+            LOGI("Error closing directory %s\n", checkPath.c_str());
         }
-    
-        DmEfsNode node(path, response);
-
-        contents.insert(contents.end(), node);
-
-        packet.sequenceNumber++;
-
-    } while (true);
-
-    if (closeDir(dp) != kDmEfsSuccess) {
-        LOGI("Error closing directory %s\n", path.c_str());
     }
 
-    if (recursive) {
-        for (auto &node : contents) {
-            if (node.isDir()) {
-
-                std::string checkPath = path;
-
-                checkPath.append(node.name).append("/");
-        
-                if (readDir(checkPath, node.children, recursive) != kDmEfsSuccess) {
-                    LOGE("Error on recursive readDir for %s\n", checkPath.c_str());
-                    node.error = 0x000001;
-                }
-            }
-        }
-    }
+    tree.compact();
 
     return kDmEfsSuccess;
 }
@@ -680,45 +738,72 @@ int DmEfsManager::readDir(std::string path, std::vector<DmEfsNode>& contents, bo
 */
 int DmEfsManager::readDir(uint32_t dp, std::vector<DmEfsNode>& contents)
 {
-
     if (!port.isOpen()) {
         return kDmEfsIOError;
     }
 
-    size_t txSize, rxSize;
+    std::shared_ptr<DmEfsTree> tree = std::make_shared<DmEfsTree>("");
+
+    int readResult = readDirEntries(dp, "", *tree, 0);
+
+    if (readResult != kDmEfsSuccess) {
+        if (closeDir(dp) != kDmEfsSuccess) {
+            LOGI("Error closing directory dp %d\n", dp);
+        }
+        return readResult;
+    }
+
+    std::vector<DmEfsNode> children = DmEfsNode(tree, 0).getChildren();
+
+    contents.insert(contents.end(), children.begin(), children.end());
 
+    return kDmEfsSuccess;
+}
+
+/**
+* @brief DmEfsManager::readDirEntries - Add the entries of an open directory to a tree
+*
+* @param uint32_t dp
+* @param std::string path
+* @param DmEfsTree& tree
+* @param uint32_t parent
+*
+* @return int
+*/
+int DmEfsManager::readDirEntries(uint32_t dp, const std::string& path, DmEfsTree& tree, uint32_t parent)
+{
     QcdmEfsReadDirRequest packet = {};
     packet.header = getHeader(DIAG_EFS_READDIR);
     packet.dp = dp;
     packet.sequenceNumber = 1;
-            
+
+    // only the sequence number changes between requests
+    HdlcFrameTemplate request(reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
+
     do {
-        int commandResult = sendCommand(DIAG_EFS_READDIR, reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
+        request.set(offsetof(QcdmEfsReadDirRequest, sequenceNumber), packet.sequenceNumber);
+
+        int commandResult = sendCommand(DIAG_EFS_READDIR, request);
 
         if (commandResult != kDmEfsSuccess) {
-            if (closeDir(dp) != kDmEfsSuccess) {
-                LOGI("Error closing directory dp %d\n", dp);
-            }
             return commandResult;
         }
-        
+
         QcdmEfsReadDirResponse* response = (QcdmEfsReadDirResponse*)buffer;
 
         if (response->sequenceNumber != packet.sequenceNumber) {
-            LOGI("Invalid sequence received in read directory response\n");
+            LOGI("Invalid readDir Sequence Received\n");
         }
 
         if (response->error) {
-            LOGE("Error reading directory fp %s. Error %08X\n", response->name, response->error);
+            LOGE("Error Reading %s%s. Error: %08X\n", path.c_str(), response->name, response->error);
         }
 
         if (strlen(response->name) == 0) {
             break; // end
         }
 
-        DmEfsNode node("", response);
-
-        contents.insert(contents.end(), node);
+        tree.add(parent, response);
 
         packet.sequenceNumber++;
 
@@ -774,6 +859,9 @@ int DmEfsManager::rename(std::string path, std::string newPath)
         return kDmEfsIOError;
     }
 
+    invalidateNvCache(path);
+    invalidateNvCache(newPath);
+
     size_t packetSize = sizeof(QcdmEfsRenameRequest) + path.size() + newPath.size();
     QcdmEfsRenameRequest* packet = (QcdmEfsRenameRequest*) new uint8_t[packetSize]();
 
@@ -1276,6 +1364,8 @@ int DmEfsManager::deltree(std::string path, int sequence)
         return kDmEfsIOError;
     }
 
+    invalidateNvCache(path);
+
     size_t packetSize = sizeof(QcdmEfsDeltreeRequest) + path.size() + 1;
     QcdmEfsDeltreeRequest* packet = (QcdmEfsDeltreeRequest*) new uint8_t[packetSize]();
 
@@ -1315,6 +1405,8 @@ int DmEfsManager::truncate(std::string path, size_t amount, int32_t sequence)
         return kDmEfsIOError;
     }
 
+    invalidateNvCache(path);
+
     size_t packetSize = sizeof(QcdmEfsTruncateRequest) + path.size();
     QcdmEfsTruncateRequest* packet = (QcdmEfsTruncateRequest*) new uint8_t[packetSize]();
 
@@ -1440,13 +1532,11 @@ int DmEfsManager::md5sum(std::string path, std::string& hash, int32_t sequence)
     }
 
     std::stringstream ss;
-    ss << std::hex << std::setw(2) << std::setfill('0'); 
+    ss << std::hex << std::setfill('0');
     for (int i = 0; i < 16; i++) {
-        ss << (int)response->hash[i];
+        // setw only holds for the next value, without it a byte under 0x10 lost its leading zero
+        ss << std::setw(2) << (int)response->hash[i];
     }
-    
-    std::string tmp = ss.str();
-    std::transform(tmp.begin(), tmp.end(), tmp.begin(), ::toupper);
 
     hash.clear();
     hash.append(ss.str());
@@ -1506,6 +1596,8 @@ int DmEfsManager::shred(std::string path, int32_t sequence)
         return kDmEfsIOError;
     }
 
+    invalidateNvCache(path);
+
     size_t packetSize = sizeof(QcdmEfsShredRequest) + path.size();
     QcdmEfsShredRequest* packet = (QcdmEfsShredRequest*) new uint8_t[packetSize]();
 
@@ -1786,6 +1878,47 @@ int DmEfsManager::sendCommand(uint16_t command, uint8_t* data, size_t dataSize)
         return kDmEfsIOError;
     }
 
+    return receiveResponse(command);
+}
+
+/**
+* @brief sendCommand - Same as sendCommand(uint16_t command, uint8_t* packet, size_t packetSize)
+*                       but writes an already framed request as is
+*
+*
+* @param uint16_t - The expected response command
+* @param HdlcFrameTemplate& - The framed request
+*
+* @return int
+*/
+int DmEfsManager::sendCommand(uint16_t command, HdlcFrameTemplate& frame)
+{
+    if (!port.isOpen()) {
+        return kDmEfsIOError;
+    }
+
+    try {
+        if (!port.write(frame.getFrame(), frame.getFrameSize(), false)) {
+            return kDmEfsIOError;
+        }
+    }
+    catch (const serial::IOException&) {
+        return kDmEfsIOError;
+    }
+
+    return receiveResponse(command);
+}
+
+/**
+* @brief receiveResponse - Read and validate the response to a request just written
+*
+*
+* @param uint16_t - The expected response command
+*
+* @return int
+*/
+int DmEfsManager::receiveResponse(uint16_t command)
+{
     size_t rxSize;
 
     try {
@@ -1795,7 +1928,7 @@ int DmEfsManager::sendCommand(uint16_t command, uint8_t* data, size_t dataSize)
             return kDmEfsIOError;
         }
     }
-    catch (serial::IOException e) {
+    catch (const serial::IOException&) {
         return kDmEfsIOError;
     }
 
@@ -18,9 +18,12 @@
 #include <iomanip>
 #include <algorithm>
 #include <fcntl.h>
+#include <cstddef>
 #include "qc/dm.h"
 #include "qc/dm_efs.h"
 #include "qc/dm_efs_node.h"
+#include "qc/dm_efs_tree.h"
+#include "qc/hdlc_frame_template.h"
 #include "serial/qcdm_serial.h"
 
 namespace OpenPST {
@@ -85,6 +88,22 @@ namespace OpenPST {
             */
             uint32_t getSubsystemId();
 
+            /**
+            * @brief getPort - Port the EFS subsystem is accessed over
+            *
+            * @return QcdmSerial&
+            */
+            QcdmSerial& getPort();
+
+            /**
+            * @brief invalidateNvCache - Drop the NV cache of the port when a path is
+            * where the device keeps NV items, called by everything that changes a path
+            *
+            * @param std::string path
+            * @return void
+            */
+            void invalidateNvCache(const std::string& path);
+
             /**
             * @brief hello - Send the hello and recieve configuration parameters
             *
@@ -152,16 +171,27 @@ namespace OpenPST {
             int read(std::string path, std::string outPath);
 
             /**
-            * @brief write - Write to a file
+            * @brief write - Write to a file, in as many requests as it takes
             *
             * @param int32_t - fp of file
             * @param uint8_t* - data to write
             * @param size_t amount - amount of data to write
-            * @paramuint32_t offset - offset in file to start writing at
+            * @param uint32_t offset - offset in file to start writing at
             *
             * @return int
             */
             int write(int32_t fp, uint8_t* data, size_t amount, uint32_t offset);
+
+            /**
+            * @brief write - Write from a file to a file
+            *
+            * @param std::string - Local path to read
+            * @param std::string - Remote path to write, created or truncated
+            * @param bool verify - Compare md5 sums once written
+            *
+            * @return int
+            */
+            int write(std::string localPath, std::string path, bool verify = false);
             
             /**
             * @brief symlink - Create a symlink
@@ -232,6 +262,17 @@ namespace OpenPST {
             */
             int readDir(std::string path, std::vector<DmEfsNode>& contents, bool recursive = false);
 
+            /**
+            * @brief readDir - Read a directory contents into a tree, optionally recursively
+            *
+            * @param std:;string path - Full path to directory, the root of the tree
+            * @param DmEfsTree& tree - Cleared first
+            * @param bool - read recursively
+            *
+            * @return int
+            */
+            int readDir(std::string path, DmEfsTree& tree, bool recursive = false);
+
             /**
             * @brief readDir - Read a directory contents, not recursive
             *
@@ -502,6 +543,18 @@ namespace OpenPST {
             * @return QcdmSubsysHeader
             */
             QcdmSubsysHeader getHeader(uint16_t command);
+
+            /**
+            * @brief readDirEntries - Add the entries of an open directory to a tree
+            *
+            * @param uint32_t dp - dp from openDir operation
+            * @param std::string path - For logging
+            * @param DmEfsTree& tree
+            * @param uint32_t parent - Tree entry of the directory
+            *
+            * @return int
+            */
+            int readDirEntries(uint32_t dp, const std::string& path, DmEfsTree& tree, uint32_t parent);
             
             /**
             * @brief sendCommand - Same as sendCommand(uint16_t command) but does not construct a packet,
@@ -529,6 +582,28 @@ namespace OpenPST {
             */
             int sendCommand(uint16_t command, uint8_t* packet, size_t packetSize);
 
+            /**
+            * @brief sendCommand - Same as sendCommand(uint16_t command, uint8_t* packet, size_t packetSize)
+            *                       but writes an already framed request as is
+            *
+            *
+            * @param uint16_t - The expected response command
+            * @param HdlcFrameTemplate& - The framed request
+            *
+            * @return int
+            */
+            int sendCommand(uint16_t command, HdlcFrameTemplate& frame);
+
+            /**
+            * @brief receiveResponse - Read and validate the response to a request just written
+            *
+            *
+            * @param uint16_t - The expected response command
+            *
+            * @return int
+            */
+            int receiveResponse(uint16_t command);
+
             /**
             * @brief isValidResponse - used internally to validate responses
             *
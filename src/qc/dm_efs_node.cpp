@@ -15,18 +15,13 @@ using namespace OpenPST;
 
 /**
 * @brief DmEfsNode - Constructor
-* @param QcdmSerial port
+*
+* @param std::shared_ptr<const DmEfsTree> tree
+* @param uint32_t index
 */
-DmEfsNode::DmEfsNode(std::string path, QcdmEfsReadDirResponse* data) :
-    path(path),
-    name(data->name),
-    error(data->error),
-    type(data->entryType),
-    mode(data->mode),
-    size(data->size),
-    atime(data->atime),
-    mtime(data->mtime),
-    ctime(data->ctime)
+DmEfsNode::DmEfsNode(std::shared_ptr<const DmEfsTree> tree, uint32_t index) :
+    tree(tree),
+    index(index)
 {
 }
 
@@ -38,40 +33,96 @@ DmEfsNode::~DmEfsNode()
 
 }
 
-/**
-* @brief Copy Constructor
-*/
-DmEfsNode::DmEfsNode(const DmEfsNode& org) :
-    path(org.path),
-    name(org.name),
-    error(org.error),
-    type(org.type),
-    mode(org.mode),
-    size(org.size),
-    atime(org.atime),
-    mtime(org.mtime),
-    ctime(org.ctime),
-    children(org.children)
+std::string DmEfsNode::getName()
 {
+    return tree->getName(index);
+}
 
+std::string DmEfsNode::getPath()
+{
+    return tree->getDirectoryPath(index);
+}
+
+std::string DmEfsNode::getFullPath()
+{
+    return tree->getPath(index);
+}
+
+uint32_t DmEfsNode::getError()
+{
+    return tree->getEntry(index).error;
+}
+
+int32_t DmEfsNode::getType()
+{
+    return tree->getEntry(index).type;
+}
+
+int32_t DmEfsNode::getMode()
+{
+    return tree->getEntry(index).mode;
+}
+
+size_t DmEfsNode::getSize()
+{
+    return tree->getEntry(index).size;
+}
+
+time_t DmEfsNode::getAtime()
+{
+    return tree->getEntry(index).atime;
+}
+
+time_t DmEfsNode::getMtime()
+{
+    return tree->getEntry(index).mtime;
+}
+
+time_t DmEfsNode::getCtime()
+{
+    return tree->getEntry(index).ctime;
+}
+
+std::vector<DmEfsNode> DmEfsNode::getChildren()
+{
+    const DmEfsTreeEntry& entry = tree->getEntry(index);
+    std::vector<DmEfsNode> children;
+
+    children.reserve(entry.childCount);
+
+    for (uint32_t i = 0; i < entry.childCount; i++) {
+        children.push_back(DmEfsNode(tree, entry.firstChild + i));
+    }
+
+    return children;
+}
+
+size_t DmEfsNode::getChildCount()
+{
+    return tree->getEntry(index).childCount;
+}
+
+uint32_t DmEfsNode::getIndex()
+{
+    return index;
 }
 
 bool DmEfsNode::isDir()
 {
-    return type == DIAG_EFS_FILE_TYPE_DIR;
+    return getType() == DIAG_EFS_FILE_TYPE_DIR;
 }
 
 bool DmEfsNode::isFile()
 {
-    return type == DIAG_EFS_FILE_TYPE_FILE;
+    return getType() == DIAG_EFS_FILE_TYPE_FILE;
 }
 
 bool DmEfsNode::isLink()
 {
-    return type == DIAG_EFS_FILE_TYPE_LINK;
+    return getType() == DIAG_EFS_FILE_TYPE_LINK;
 }
 
 bool DmEfsNode::isImmovable()
 {
-    return type == DIAG_EFS_FILE_TYPE_IMMOVABLE;
+    return getType() == DIAG_EFS_FILE_TYPE_IMMOVABLE;
 }
@@ -6,6 +6,9 @@
 * @package OpenPST
 * @brief Represents a file or dir retrieved from the diagnostic monitor EFS subsystem
 *
+* A node is a view of an entry in a DmEfsTree and shares the tree, copying
+* a node copies a pointer and an index, never a subtree.
+*
 * @author Gassan Idriss <ghassani@gmail.com>
 */
 
@@ -15,42 +18,117 @@
 #include "include/definitions.h"
 #include <iostream>
 #include <vector>
+#include <memory>
 #include "dm_efs.h"
+#include "dm_efs_tree.h"
 
 namespace OpenPST {
 
     class DmEfsNode {
         public:
-            std::string name;
-            std::string path;
-            uint32_t error;
-            int32_t type;
-            int32_t mode;
-            size_t size;
-            time_t atime;
-            time_t mtime;
-            time_t ctime;
-            std::vector<DmEfsNode> children;
-
             /**
             * @brief - Constructor
+            *
+            * @param std::shared_ptr<const DmEfsTree> tree
+            * @param uint32_t index - Entry in the tree
             */
-            DmEfsNode(std::string path, QcdmEfsReadDirResponse* data);
+            DmEfsNode(std::shared_ptr<const DmEfsTree> tree, uint32_t index);
 
             /**
-            * @brief - Constructor
+            * @brief - Deconstructor
             */
-            DmEfsNode(std::string path, std::string name);
+            ~DmEfsNode();
 
             /**
-            * @brief - Deconstructor
+            * @brief getName
+            *
+            * @return std::string
             */
-            ~DmEfsNode();
+            std::string getName();
+
+            /**
+            * @brief getPath - Directory holding the node, with a trailing slash
+            *
+            * @return std::string
+            */
+            std::string getPath();
+
+            /**
+            * @brief getFullPath - getPath() followed by the name
+            *
+            * @return std::string
+            */
+            std::string getFullPath();
+
+            /**
+            * @brief getError
+            *
+            * @return uint32_t
+            */
+            uint32_t getError();
+
+            /**
+            * @brief getType
+            *
+            * @return int32_t
+            */
+            int32_t getType();
+
+            /**
+            * @brief getMode
+            *
+            * @return int32_t
+            */
+            int32_t getMode();
+
+            /**
+            * @brief getSize
+            *
+            * @return size_t
+            */
+            size_t getSize();
+
+            /**
+            * @brief getAtime
+            *
+            * @return time_t
+            */
+            time_t getAtime();
+
+            /**
+            * @brief getMtime
+            *
+            * @return time_t
+            */
+            time_t getMtime();
 
             /**
-            * @brief Copy Constructor
+            * @brief getCtime
+            *
+            * @return time_t
+            */
+            time_t getCtime();
+
+            /**
+            * @brief getChildren - Views of the entries read from this directory
+            *
+            * @return std::vector<DmEfsNode>
+            */
+            std::vector<DmEfsNode> getChildren();
+
+            /**
+            * @brief getChildCount
+            *
+            * @return size_t
+            */
+            size_t getChildCount();
+
+            /**
+            * @brief getIndex - Entry in the tree
+            *
+            * @return uint32_t
             */
-            DmEfsNode(const DmEfsNode& copy);
+            uint32_t getIndex();
 
             /**
             * @brief isDir
@@ -80,7 +158,10 @@ namespace OpenPST {
             */
             bool isImmovable();
 
+        private:
+            std::shared_ptr<const DmEfsTree> tree;
+            uint32_t index;
     };
 }
 
-#endif // _QC_DM_EFS_NODE_H_
\ No newline at end of file
+#endif // _QC_DM_EFS_NODE_H_
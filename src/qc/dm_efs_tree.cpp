@@ -0,0 +1,267 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_efs_tree.cpp
+* @class OpenPST::DmEfsTree
+* @package OpenPST
+* @brief Compact EFS directory tree, as read by DmEfsManager::readDir
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "dm_efs_tree.h"
+
+using namespace OpenPST;
+
+/**
+* @brief DmEfsTree - Constructor
+*
+* @param std::string rootPath
+*/
+DmEfsTree::DmEfsTree(std::string rootPath)
+{
+    clear(rootPath);
+}
+
+/**
+* @brief ~DmEfsTree - Deconstructor
+*/
+DmEfsTree::~DmEfsTree()
+{
+
+}
+
+/**
+* @brief clear - Drop every entry and start again from a root
+*
+* @param std::string rootPath
+*
+* @return void
+*/
+void DmEfsTree::clear(std::string rootPath)
+{
+    DmEfsTreeEntry root = {};
+
+    entries.clear();
+    names.clear();
+    index.assign(64, 0);
+    internCount = 0;
+
+    root.name       = intern(rootPath.c_str(), rootPath.size());
+    root.parent     = DM_EFS_TREE_NONE;
+    root.type       = DIAG_EFS_FILE_TYPE_DIR;
+
+    entries.push_back(root);
+}
+
+/**
+* @brief add - Add an entry read from a directory
+*
+* @param uint32_t parent
+* @param QcdmEfsReadDirResponse* data
+*
+* @return uint32_t
+*/
+uint32_t DmEfsTree::add(uint32_t parent, const QcdmEfsReadDirResponse* data)
+{
+    DmEfsTreeEntry entry = {};
+    uint32_t position = (uint32_t)entries.size();
+
+    if (parent >= entries.size()) {
+        throw std::invalid_argument("Parent is not in the tree");
+    }
+
+    if (!entries[parent].childCount) {
+        entries[parent].firstChild = position;
+    } else if (entries[parent].firstChild + entries[parent].childCount != position) {
+        throw std::invalid_argument("Children of a directory must be added together");
+    }
+
+    entry.name      = intern(data->name, strlen(data->name));
+    entry.parent    = parent;
+    entry.error     = data->error;
+    entry.type      = data->entryType;
+    entry.mode      = data->mode;
+    entry.size      = data->size;
+    entry.atime     = data->atime;
+    entry.mtime     = data->mtime;
+    entry.ctime     = data->ctime;
+
+    entries.push_back(entry);
+
+    entries[parent].childCount++;
+
+    return position;
+}
+
+/**
+* @brief compact - Give back the room kept for more entries, once the tree is read
+*
+* @return void
+*/
+void DmEfsTree::compact()
+{
+    entries.shrink_to_fit();
+    names.shrink_to_fit();
+}
+
+/**
+* @brief setError
+*
+* @param uint32_t index
+* @param uint32_t error
+*
+* @return void
+*/
+void DmEfsTree::setError(uint32_t index, uint32_t error)
+{
+    entries.at(index).error = error;
+}
+
+/**
+* @brief getEntry
+*
+* @param uint32_t index
+*
+* @return const DmEfsTreeEntry&
+*/
+const DmEfsTreeEntry& DmEfsTree::getEntry(uint32_t index) const
+{
+    return entries.at(index);
+}
+
+/**
+* @brief getName
+*
+* @param uint32_t index
+*
+* @return const char*
+*/
+const char* DmEfsTree::getName(uint32_t index) const
+{
+    return &names[entries.at(index).name];
+}
+
+/**
+* @brief getPath - Full path of an entry, directories without a trailing slash
+*
+* @param uint32_t index
+*
+* @return std::string
+*/
+std::string DmEfsTree::getPath(uint32_t index) const
+{
+    if (!index) {
+        return getName(0);
+    }
+
+    std::string path = getDirectoryPath(index);
+
+    path.append(getName(index));
+
+    return path;
+}
+
+/**
+* @brief getDirectoryPath - Path of the directory holding an entry, with a trailing slash
+*
+* @param uint32_t index
+*
+* @return std::string
+*/
+std::string DmEfsTree::getDirectoryPath(uint32_t index) const
+{
+    std::vector<uint32_t> chain;
+    std::string path;
+
+    // walk up to the root, then back down appending names
+    for (uint32_t i = entries.at(index).parent; i != DM_EFS_TREE_NONE; i = entries[i].parent) {
+        chain.push_back(i);
+    }
+
+    size_t depth = chain.size();
+
+    while (depth--) {
+        const char* name = getName(chain[depth]);
+
+        path.append(name);
+
+        // a root read by directory pointer has no name, and a root of / already ends in one
+        if (*name && path.back() != '/') {
+            path.append("/");
+        }
+    }
+
+    return path;
+}
+
+/**
+* @brief size - Number of entries, the root included
+*
+* @return size_t
+*/
+size_t DmEfsTree::size() const
+{
+    return entries.size();
+}
+
+/**
+* @brief getMemoryUsage - Bytes held by the entries, the arena and the name index
+*
+* @return size_t
+*/
+size_t DmEfsTree::getMemoryUsage() const
+{
+    return entries.capacity() * sizeof(DmEfsTreeEntry) + names.capacity() + index.capacity() * sizeof(uint32_t);
+}
+
+/**
+* @brief intern - Arena offset of a name, added if not seen before
+*/
+uint32_t DmEfsTree::intern(const char* name, size_t length)
+{
+    size_t mask = index.size() - 1;
+    size_t slot = (size_t)xxhash64(reinterpret_cast<const uint8_t*>(name), length) & mask;
+
+    for (; index[slot]; slot = (slot + 1) & mask) {
+        const char* existing = &names[index[slot] - 1];
+
+        if (!strncmp(existing, name, length) && !existing[length]) {
+            return index[slot] - 1;
+        }
+    }
+
+    uint32_t offset = (uint32_t)names.size();
+
+    names.insert(names.end(), name, name + length);
+    names.push_back('\0');
+
+    index[slot] = offset + 1;
+
+    // kept at most half full, grown by rehashing every name in the arena
+    if (++internCount * 2 > index.size()) {
+        std::vector<uint32_t> grown(index.size() * 2, 0);
+
+        mask = grown.size() - 1;
+
+        for (auto value : index) {
+            if (!value) {
+                continue;
+            }
+
+            const char* existing = &names[value - 1];
+
+            slot = (size_t)xxhash64(reinterpret_cast<const uint8_t*>(existing), strlen(existing)) & mask;
+
+            while (grown[slot]) {
+                slot = (slot + 1) & mask;
+            }
+
+            grown[slot] = value;
+        }
+
+        index.swap(grown);
+    }
+
+    return offset;
+}
@@ -0,0 +1,166 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_efs_tree.h
+* @class OpenPST::DmEfsTree
+* @package OpenPST
+* @brief Compact EFS directory tree, as read by DmEfsManager::readDir
+*
+* Entries are kept in one flat array. Each holds the index of its parent and
+* the range of its children, a directory listing is appended in one go so
+* the children of a directory are always next to each other. Names are kept
+* once each in a string arena, many directories on a device share names like
+* item_files or numbered items. Full paths are not stored, getPath builds
+* them from the parents when asked.
+*
+* DmEfsNode is a view over an entry of a shared tree.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_EFS_TREE_H_
+#define _QC_DM_EFS_TREE_H_
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <stdexcept>
+#include "include/definitions.h"
+#include "qc/dm_efs.h"
+#include "util/xxhash.h"
+
+/**
+* Parent of the root entry
+*/
+#define DM_EFS_TREE_NONE 0xFFFFFFFF
+
+namespace OpenPST {
+
+    struct DmEfsTreeEntry {
+        uint32_t name;          // offset in the name arena
+        uint32_t parent;
+        uint32_t firstChild;
+        uint32_t childCount;
+        uint32_t error;
+        int32_t  type;
+        int32_t  mode;
+        int32_t  size;
+        int32_t  atime;
+        int32_t  mtime;
+        int32_t  ctime;
+    };
+
+    /**
+    * @brief OpenPST::DmEfsTree
+    */
+    class DmEfsTree {
+        public:
+            /**
+            * @brief DmEfsTree - Constructor
+            *
+            * @param std::string rootPath - Path of the directory the tree is read from, entry 0
+            */
+            DmEfsTree(std::string rootPath = "/");
+
+            /**
+            * @brief ~DmEfsTree - Deconstructor
+            */
+            ~DmEfsTree();
+
+            /**
+            * @brief clear - Drop every entry and start again from a root
+            *
+            * @param std::string rootPath
+            * @return void
+            */
+            void clear(std::string rootPath);
+
+            /**
+            * @brief add - Add an entry read from a directory
+            *
+            * @param uint32_t parent - Directory the entry was read from. All entries of
+            *                          a directory must be added before any entry of another
+            * @param QcdmEfsReadDirResponse* data
+            *
+            * @return uint32_t - index of the new entry
+            *
+            * @throws std::invalid_argument - if the children of parent would not be contiguous
+            */
+            uint32_t add(uint32_t parent, const QcdmEfsReadDirResponse* data);
+
+            /**
+            * @brief compact - Give back the room kept for more entries, once the tree is read
+            *
+            * @return void
+            */
+            void compact();
+
+            /**
+            * @brief setError
+            *
+            * @param uint32_t index
+            * @param uint32_t error
+            * @return void
+            */
+            void setError(uint32_t index, uint32_t error);
+
+            /**
+            * @brief getEntry
+            *
+            * @param uint32_t index
+            * @return const DmEfsTreeEntry&
+            */
+            const DmEfsTreeEntry& getEntry(uint32_t index) const;
+
+            /**
+            * @brief getName
+            *
+            * @param uint32_t index
+            * @return const char* - valid until the next add
+            */
+            const char* getName(uint32_t index) const;
+
+            /**
+            * @brief getPath - Full path of an entry, directories without a trailing slash
+            *
+            * @param uint32_t index
+            * @return std::string
+            */
+            std::string getPath(uint32_t index) const;
+
+            /**
+            * @brief getDirectoryPath - Path of the directory holding an entry, with a trailing slash
+            *
+            * @param uint32_t index
+            * @return std::string
+            */
+            std::string getDirectoryPath(uint32_t index) const;
+
+            /**
+            * @brief size - Number of entries, the root included
+            *
+            * @return size_t
+            */
+            size_t size() const;
+
+            /**
+            * @brief getMemoryUsage - Bytes held by the entries, the arena and the name index
+            *
+            * @return size_t
+            */
+            size_t getMemoryUsage() const;
+
+        private:
+            std::vector<DmEfsTreeEntry> entries;
+            std::vector<char> names;        // null terminated names, back to back
+            std::vector<uint32_t> index;    // open addressing, arena offset + 1 of each distinct name
+            size_t internCount;
+
+            /**
+            * @brief intern - Arena offset of a name, added if not seen before
+            */
+            uint32_t intern(const char* name, size_t length);
+    };
+}
+
+#endif // _QC_DM_EFS_TREE_H_
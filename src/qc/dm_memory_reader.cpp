@@ -0,0 +1,311 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_memory_reader.cpp
+* @class OpenPST::DmMemoryReader
+* @package OpenPST
+* @brief Pipelined memory reads over diagnostic monitor peek commands
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "dm_memory_reader.h"
+
+using namespace OpenPST;
+
+/**
+* @brief DmMemoryReader - Constructor
+*
+* @param QcdmSerial& port
+* @param size_t window
+*/
+DmMemoryReader::DmMemoryReader(QcdmSerial& port, size_t window) :
+    port(port),
+    window(window ? window : 1),
+    requestFrame(sizeof(QcdmMemoryPeekRequest)),
+    base(0),
+    out(nullptr),
+    peekCount(0),
+    retryCount(0)
+{
+
+}
+
+/**
+* @brief ~DmMemoryReader - Deconstructor
+*/
+DmMemoryReader::~DmMemoryReader()
+{
+
+}
+
+/**
+* @brief read - Read a range, unreadable bytes are left zero and added to the failures
+*
+* @param uint32_t address
+* @param uint32_t size
+* @param uint8_t* out
+*
+* @return bool
+*/
+bool DmMemoryReader::read(uint32_t address, uint32_t size, uint8_t* out)
+{
+    size_t failed = failures.size();
+
+    this->base = address;
+    this->out  = out;
+
+    std::memset(out, 0x00, size);
+
+    queue.clear();
+    inFlight.clear();
+
+    plan(address, size);
+
+    while (queue.size() || inFlight.size()) {
+        try {
+            fill();
+
+            if (!receive()) {
+                LOGE("No response to a memory peek at 0x%08X\n", inFlight.size() ? (uint32_t)(inFlight.begin()->first & 0xFFFFFFFF) : address);
+                return false;
+            }
+        } catch (std::exception& e) {
+            LOGE("Memory read failed, %s\n", e.what());
+            return false;
+        }
+    }
+
+    // retries finish out of order, keep the list sorted with touching ranges joined
+    std::sort(failures.begin() + failed, failures.end(), [](const DmMemoryReadFailure& a, const DmMemoryReadFailure& b) {
+        return a.address < b.address;
+    });
+
+    std::vector<DmMemoryReadFailure> merged(failures.begin(), failures.begin() + failed);
+
+    for (size_t i = failed; i < failures.size(); i++) {
+        if (merged.size() && (uint64_t)merged.back().address + merged.back().size == failures[i].address) {
+            merged.back().size += failures[i].size;
+        } else {
+            merged.push_back(failures[i]);
+        }
+    }
+
+    failures.swap(merged);
+
+    return true;
+}
+
+/**
+* @brief getFailures
+*
+* @return const std::vector<DmMemoryReadFailure>&
+*/
+const std::vector<DmMemoryReadFailure>& DmMemoryReader::getFailures()
+{
+    return failures;
+}
+
+/**
+* @brief getPeekCount
+*
+* @return uint64_t
+*/
+uint64_t DmMemoryReader::getPeekCount()
+{
+    return peekCount;
+}
+
+/**
+* @brief getRetryCount
+*
+* @return uint64_t
+*/
+uint64_t DmMemoryReader::getRetryCount()
+{
+    return retryCount;
+}
+
+/**
+* @brief plan - Queue the widest peeks covering a range
+*/
+void DmMemoryReader::plan(uint32_t address, uint32_t size)
+{
+    uint64_t end = (uint64_t)address + size;
+    uint64_t position = address;
+
+    while (position < end) {
+        uint64_t remaining = end - position;
+        Peek peek;
+
+        if (!(position & 3) && remaining >= 4) {
+            peek.width = 4;
+        } else if (!(position & 1) && remaining >= 2) {
+            peek.width = 2;
+        } else {
+            peek.width = 1;
+        }
+
+        uint64_t units = remaining / peek.width;
+        uint64_t most  = DIAG_MEMORY_PEEK_MAX_SIZE / peek.width;
+
+        // the narrow peeks at the start only run up to the first wider alignment
+        if (peek.width == 1 && (position & 1)) {
+            units = 1;
+        } else if (peek.width == 2 && (position & 3) && remaining >= 4) {
+            units = 1;
+        }
+
+        peek.address = (uint32_t)position;
+        peek.count   = (uint8_t)(units < most ? units : most);
+
+        queue.push_back(peek);
+
+        position += peek.width * peek.count;
+    }
+}
+
+/**
+* @brief fill - Send peeks until the window is full, in a single write
+*/
+void DmMemoryReader::fill()
+{
+    std::vector<uint8_t> frames;
+
+    while (queue.size() && inFlight.size() < window) {
+        Peek peek = queue.front();
+        QcdmMemoryPeekRequest packet = { getCommand(peek.width), peek.address, peek.count };
+
+        queue.pop_front();
+
+        requestFrame.set(0, reinterpret_cast<const uint8_t*>(&packet), sizeof(packet));
+
+        frames.insert(frames.end(), requestFrame.getFrame(), requestFrame.getFrame() + requestFrame.getFrameSize());
+
+        inFlight[key(packet.command, packet.address)] = peek;
+
+        peekCount++;
+    }
+
+    if (frames.size()) {
+        port.write(&frames[0], frames.size(), false);
+    }
+}
+
+/**
+* @brief receive - Read whatever the device has sent and dispatch complete frames
+*
+* @return bool - false if nothing arrived before the timeout
+*/
+bool DmMemoryReader::receive()
+{
+    return port.receiveResponses([this](const uint8_t* packet, size_t size) {
+        dispatch(packet, size);
+    });
+}
+
+/**
+* @brief dispatch - Match a received frame to its peek
+*
+* @param uint8_t* data - Unescaped packet without its CRC
+* @param size_t packetSize
+*/
+void DmMemoryReader::dispatch(const uint8_t* data, size_t packetSize)
+{
+    uint8_t command = data[0];
+    bool rejected = false;
+    const QcdmMemoryPeekRequest* echo = nullptr;
+
+    switch (command) {
+        case DIAG_MEMORY_PEEK_BYTE_F:
+        case DIAG_MEMORY_PEEK_WORD_F:
+        case DIAG_MEMORY_PEEK_DWORD_F:
+            echo = (const QcdmMemoryPeekRequest*)&data[0];
+            break;
+        case DIAG_BAD_CMD_F:
+        case DIAG_BAD_PARM_F:
+        case DIAG_BAD_LEN_F:
+        case DIAG_BAD_MODE_F:
+        case DIAG_BAD_SPC_MODE_F:
+        case DIAG_BAD_SEC_MODE_F:
+            // the rejected request follows the error code
+            echo = (const QcdmMemoryPeekRequest*)&data[1];
+            rejected = true;
+
+            if (packetSize < 1 + sizeof(QcdmMemoryPeekRequest)) {
+                return;
+            }
+            break;
+        default:
+            // streamed logs and anything else not ours
+            return;
+    }
+
+    if (packetSize < sizeof(QcdmMemoryPeekRequest)) {
+        return;
+    }
+
+    auto it = inFlight.find(key(echo->command, echo->address));
+
+    if (it == inFlight.end()) {
+        return;
+    }
+
+    Peek peek = it->second;
+    size_t bytes = peek.width * peek.count;
+
+    inFlight.erase(it);
+
+    if (rejected || echo->length != peek.count || packetSize < sizeof(QcdmMemoryPeekRequest) + bytes) {
+        retry(peek);
+        return;
+    }
+
+    std::memcpy(out + (peek.address - base), &data[sizeof(QcdmMemoryPeekRequest)], bytes);
+}
+
+/**
+* @brief retry - Queue smaller peeks for a rejected one
+*/
+void DmMemoryReader::retry(const Peek& peek)
+{
+    if (peek.count == 1 && peek.width == 1) {
+        DmMemoryReadFailure failure = { peek.address, 1 };
+        failures.push_back(failure);
+        return;
+    }
+
+    retryCount++;
+
+    if (peek.count > 1) {
+        // the range may only be partly readable, find out which units are
+        for (int i = peek.count - 1; i >= 0; i--) {
+            Peek unit = { peek.address + i * peek.width, peek.width, 1 };
+            queue.push_front(unit);
+        }
+    } else {
+        Peek half = { peek.address, (uint8_t)(peek.width / 2), 2 };
+        queue.push_front(half);
+    }
+}
+
+/**
+* @brief key - In flight key of a peek
+*/
+uint64_t DmMemoryReader::key(uint8_t command, uint32_t address)
+{
+    return ((uint64_t)command << 32) | address;
+}
+
+/**
+* @brief getCommand - Peek command for a width
+*/
+uint8_t DmMemoryReader::getCommand(uint8_t width)
+{
+    switch (width) {
+        case 4: return DIAG_MEMORY_PEEK_DWORD_F;
+        case 2: return DIAG_MEMORY_PEEK_WORD_F;
+    }
+
+    return DIAG_MEMORY_PEEK_BYTE_F;
+}
@@ -0,0 +1,160 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_memory_reader.h
+* @class OpenPST::DmMemoryReader
+* @package OpenPST
+* @brief Pipelined memory reads over diagnostic monitor peek commands
+*
+* A range is covered with the widest peek each address allows: dword peeks
+* where it is 4 byte aligned, word and byte peeks for the ends. Every peek
+* returns at most 16 bytes whatever its width, but registers and some memory
+* only answer accesses of their own width. Up to window peeks are kept in
+* flight and matched back by the command and address the device echoes, the
+* same way DmNvBulkReader matches NV reads.
+*
+* A rejected peek is retried smaller. A multi unit peek is split into single
+* units, and a single unit is retried at half the width. A byte nobody can
+* read is left zero and reported in getFailures().
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_MEMORY_READER_H_
+#define _QC_DM_MEMORY_READER_H_
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+#include "include/definitions.h"
+#include "qc/dm.h"
+#include "qc/hdlc.h"
+#include "qc/hdlc_frame_template.h"
+#include "serial/qcdm_serial.h"
+
+/**
+* Peeks kept in flight when no window is given
+*/
+#define DM_MEMORY_READ_DEFAULT_WINDOW 16
+
+namespace OpenPST {
+
+    struct DmMemoryReadFailure {
+        uint32_t address;
+        uint32_t size;
+    };
+
+    /**
+    * @brief OpenPST::DmMemoryReader
+    */
+    class DmMemoryReader {
+        public:
+            /**
+            * @brief DmMemoryReader - Constructor
+            *
+            * @param QcdmSerial& port
+            * @param size_t window - Peeks kept in flight, 1 peeks one at a time
+            */
+            DmMemoryReader(QcdmSerial& port, size_t window = DM_MEMORY_READ_DEFAULT_WINDOW);
+
+            /**
+            * @brief ~DmMemoryReader - Deconstructor
+            */
+            ~DmMemoryReader();
+
+            /**
+            * @brief read - Read a range, unreadable bytes are left zero and added to the failures
+            *
+            * @param uint32_t address
+            * @param uint32_t size
+            * @param uint8_t* out - At least size bytes
+            *
+            * @return bool - false if the device stopped answering or the port failed
+            */
+            bool read(uint32_t address, uint32_t size, uint8_t* out);
+
+            /**
+            * @brief getFailures - Ranges no peek could read, in address order, since the reader was made
+            *
+            * @return const std::vector<DmMemoryReadFailure>&
+            */
+            const std::vector<DmMemoryReadFailure>& getFailures();
+
+            /**
+            * @brief getPeekCount - Peeks sent, retries included
+            *
+            * @return uint64_t
+            */
+            uint64_t getPeekCount();
+
+            /**
+            * @brief getRetryCount - Peeks that were rejected and retried smaller
+            *
+            * @return uint64_t
+            */
+            uint64_t getRetryCount();
+
+        private:
+            struct Peek {
+                uint32_t address;
+                uint8_t  width;     // 1, 2 or 4
+                uint8_t  count;     // units of width
+            };
+
+            QcdmSerial& port;
+            size_t window;
+            std::deque<Peek> queue;                 // not yet sent, retries go first
+            std::map<uint64_t, Peek> inFlight;      // by command and address
+            std::vector<DmMemoryReadFailure> failures;
+            HdlcFrameTemplate requestFrame;
+            uint32_t base;
+            uint8_t* out;
+            uint64_t peekCount;
+            uint64_t retryCount;
+
+            /**
+            * @brief plan - Queue the widest peeks covering a range
+            */
+            void plan(uint32_t address, uint32_t size);
+
+            /**
+            * @brief fill - Send peeks until the window is full, in a single write
+            */
+            void fill();
+
+            /**
+            * @brief receive - Read whatever the device has sent and dispatch complete frames
+            *
+            * @return bool - false if nothing arrived before the timeout
+            */
+            bool receive();
+
+            /**
+            * @brief dispatch - Match a received frame to its peek
+            *
+            * @param uint8_t* data - Unescaped packet without its CRC
+            * @param size_t packetSize
+            */
+            void dispatch(const uint8_t* data, size_t packetSize);
+
+            /**
+            * @brief retry - Queue smaller peeks for a rejected one
+            */
+            void retry(const Peek& peek);
+
+            /**
+            * @brief key - In flight key of a peek
+            */
+            static uint64_t key(uint8_t command, uint32_t address);
+
+            /**
+            * @brief getCommand - Peek command for a width
+            */
+            static uint8_t getCommand(uint8_t width);
+    };
+}
+
+#endif // _QC_DM_MEMORY_READER_H_
@@ -13,6226 +13,11 @@
 #define _QC_DIAG_NV_H
 
 enum NV_ITEM {
-	NV_ESN_I = 0,
-	NV_ESN_CHKSUM_I = 1,
-	NV_VERNO_MAJ_I = 2,
-	NV_VERNO_MIN_I = 3,
-	NV_SCM_I = 4,
-	NV_SLOT_CYCLE_INDEX_I = 5,
-	NV_MOB_CAI_REV_I = 6,
-	NV_MOB_FIRM_REV_I = 7,
-	NV_MOB_MODEL_I = 8,
-	NV_CONFIG_CHKSUM_I = 9,
-	NV_PREF_MODE_I = 10,
-	NV_CDMA_PREF_SERV_I = 11,
-	NV_ANALOG_PREF_SERV_I = 12,
-	NV_CDMA_SID_LOCK_I = 13,
-	NV_CDMA_SID_ACQ_I = 14,
-	NV_ANALOG_SID_LOCK_I = 15,
-	NV_ANALOG_SID_ACQ_I = 16,
-	NV_ANALOG_FIRSTCHP_I = 17,
-	NV_ANALOG_HOME_SID_I = 18,
-	NV_ANALOG_REG_I = 19,
-	NV_PCDMACH_I = 20,
-	NV_SCDMACH_I = 21,
-	NV_PPCNCH_I = 22,
-	NV_SPCNCH_I = 23,
-	NV_NAM_CHKSUM_I = 24,
-	NV_A_KEY_I = 25,
-	NV_A_KEY_CHKSUM_I = 26,
-	NV_SSD_A_I = 27,
-	NV_SSD_A_CHKSUM_I = 28,
-	NV_SSD_B_I = 29,
-	NV_SSD_B_CHKSUM_I = 30,
-	NV_COUNT_I = 31,
-	NV_MIN1_I = 32,
-	NV_MIN2_I = 33,
-	NV_MOB_TERM_HOME_I = 34,
-	NV_MOB_TERM_FOR_SID_I = 35,
-	NV_MOB_TERM_FOR_NID_I = 36,
-	NV_ACCOLC_I = 37,
-	NV_SID_NID_I = 38,
-	NV_MIN_CHKSUM_I = 39,
-	NV_CURR_NAM_I = 40,
-	NV_ORIG_MIN_I = 41,
-	NV_AUTO_NAM_I = 42,
-	NV_NAME_NAM_I = 43,
-	NV_NXTREG_I = 44,
-	NV_LSTSID_I = 45,
-	NV_LOCAID_I = 46,
-	NV_PUREG_I = 47,
-	NV_ZONE_LIST_I = 48,
-	NV_SID_NID_LIST_I = 49,
-	NV_DIST_REG_I = 50,
-	NV_LAST_CDMACH_I = 51,
-	NV_CALL_TIMER_I = 52,
-	NV_AIR_TIMER_I = 53,
-	NV_ROAM_TIMER_I = 54,
-	NV_LIFE_TIMER_I = 55,
-	NV_RUN_TIMER_I = 56,
-	NV_DIAL_I = 57,
-	NV_STACK_I = 58,
-	NV_STACK_IDX_I = 59,
-	NV_PAGE_SET_I = 60,
-	NV_PAGE_MSG_I = 61,
-	NV_EAR_LVL_I = 62,
-	NV_SPEAKER_LVL_I = 63,
-	NV_RINGER_LVL_I = 64,
-	NV_BEEP_LVL_I = 65,
-	NV_CALL_BEEP_I = 66,
-	NV_CONT_KEY_DTMF_I = 67,
-	NV_CONT_STR_DTMF_I = 68,
-	NV_SVC_AREA_ALERT_I = 69,
-	NV_CALL_FADE_ALERT_I = 70,
-	NV_BANNER_I = 71,
-	NV_LCD_I = 72,
-	NV_AUTO_POWER_I = 73,
-	NV_AUTO_ANSWER_I = 74,
-	NV_AUTO_REDIAL_I = 75,
-	NV_AUTO_HYPHEN_I = 76,
-	NV_BACK_LIGHT_I = 77,
-	NV_AUTO_MUTE_I = 78,
-	NV_MAINTRSN_I = 79,
-	NV_LCKRSN_P_I = 80,
-	NV_LOCK_I = 81,
-	NV_LOCK_CODE_I = 82,
-	NV_AUTO_LOCK_I = 83,
-	NV_CALL_RSTRC_I = 84,
-	NV_SEC_CODE_I = 85,
-	NV_HORN_ALERT_I = 86,
-	NV_ERR_LOG_I = 87,
-	NV_UNIT_ID_I = 88,
-	NV_FREQ_ADJ_I = 89,
-	NV_VBATT_I = 90,
-	NV_FM_TX_PWR_I = 91,
-	NV_FR_TEMP_OFFSET_I = 92,
-	NV_DM_IO_MODE_I = 93,
-	NV_CDMA_TX_LIMIT_I = 94,
-	NV_FM_RSSI_I = 95,
-	NV_CDMA_RIPPLE_I = 96,
-	NV_CDMA_RX_OFFSET_I = 97,
-	NV_CDMA_RX_POWER_I = 98,
-	NV_CDMA_RX_ERROR_I = 99,
-	NV_CDMA_TX_SLOPE_1_I = 100,
-	NV_CDMA_TX_SLOPE_2_I = 101,
-	NV_CDMA_TX_ERROR_I = 102,
-	NV_PA_CURRENT_CTL_I = 103,
-	NV_SONY_ATTEN_1_I = 104,
-	NV_SONY_ATTEN_2_I = 105,
-	NV_VOC_GAIN_I = 106,
-	NV_SPARE_1_I = 107,
-	NV_SPARE_2_I = 108,
-	NV_DATA_SRVC_STATE_I = 109,
-	NV_DATA_IO_MODE_I = 110,
-	NV_IDLE_DATA_TIMEOUT_I = 111,
-	NV_MAX_TX_ADJ_I = 112,
-	NV_INI_MUTE_I = 113,
-	NV_FACTORY_INFO_I = 114,
-	NV_SONY_ATTEN_3_I = 115,
-	NV_SONY_ATTEN_4_I = 116,
-	NV_SONY_ATTEN_5_I = 117,
-	NV_DM_ADDR_I = 118,
-	NV_CDMA_PN_MASK_I = 119,
-	NV_SEND_TIMEOUT_I = 120,
-	NV_FM_AGC_SET_VS_PWR_I = 121,
-	NV_FM_AGC_SET_VS_FREQ_I = 122,
-	NV_FM_AGC_SET_VS_TEMP_I = 123,
-	NV_FM_EXP_HDET_VS_PWR_I = 124,
-	NV_FM_ERR_SLP_VS_PWR_I = 125,
-	NV_FM_FREQ_SENSE_GAIN_I = 126,
-	NV_CDMA_RX_LIN_OFF_0_I = 127,
-	NV_CDMA_RX_LIN_SLP_I = 128,
-	NV_CDMA_RX_COMP_VS_FREQ_I = 129,
-	NV_CDMA_TX_COMP_VS_FREQ_I = 130,
-	NV_CDMA_TX_COMP_VS_VOLT_I = 131,
-	NV_CDMA_TX_LIN_MASTER_OFF_0_I = 132,
-	NV_CDMA_TX_LIN_MASTER_SLP_I = 133,
-	NV_CDMA_TX_LIN_VS_TEMP_I = 134,
-	NV_CDMA_TX_LIN_VS_VOLT_I = 135,
-	NV_CDMA_TX_LIM_VS_TEMP_I = 136,
-	NV_CDMA_TX_LIM_VS_VOLT_I = 137,
-	NV_CDMA_TX_LIM_VS_FREQ_I = 138,
-	NV_CDMA_EXP_HDET_VS_AGC_I = 139,
-	NV_CDMA_ERR_SLP_VS_HDET_I = 140,
-	NV_THERM_I = 141,
-	NV_VBATT_PA_I = 142,
-	NV_HDET_OFF_I = 143,
-	NV_HDET_SPN_I = 144,
-	NV_ONETOUCH_DIAL_I = 145,
-	NV_FM_AGC_ADJ_VS_FREQ_I = 146,
-	NV_FM_AGC_ADJ_VS_TEMP_I = 147,
-	NV_RF_CONFIG_I = 148,
-	NV_R1_RISE_I = 149,
-	NV_R1_FALL_I = 150,
-	NV_R2_RISE_I = 151,
-	NV_R2_FALL_I = 152,
-	NV_R3_RISE_I = 153,
-	NV_R3_FALL_I = 154,
-	NV_PA_RANGE_STEP_CAL_I = 155,
-	NV_LNA_RANGE_POL_I = 156,
-	NV_LNA_RANGE_RISE_I = 157,
-	NV_LNA_RANGE_FALL_I = 158,
-	NV_LNA_RANGE_OFFSET_I = 159,
-	NV_POWER_CYCLES_I = 160,
-	NV_ALERTS_LVL_I = 161,
-	NV_ALERTS_LVL_SHADOW_I = 162,
-	NV_RINGER_LVL_SHADOW_I = 163,
-	NV_BEEP_LVL_SHADOW_I = 164,
-	NV_EAR_LVL_SHADOW_I = 165,
-	NV_TIME_SHOW_I = 166,
-	NV_AIR_CNT_I = 168,
-	NV_ROAM_CNT_I = 169,
-	NV_LIFE_CNT_I = 170,
-	NV_SEND_PIN_I = 171,
-	NV_SMS_I = 174,
-	NV_SMS_DM_I = 175,
-	NV_IMSI_MCC_I = 176,
-	NV_IMSI_11_12_I = 177,
-	NV_DIR_NUMBER_I = 178,
-	NV_VOICE_PRIV_I = 179,
-	NV_SPARE_B1_I = 180,
-	NV_SPARE_B2_I = 181,
-	NV_SPARE_W1_I = 182,
-	NV_SPARE_W2_I = 183,
-	NV_FSC_I = 184,
-	NV_ALARMS_I = 185,
-	NV_STANDING_ALARM_I = 186,
-	NV_ISD_STD_PASSWD_I = 187,
-	NV_ISD_STD_RESTRICT_I = 188,
-	NV_DIALING_PLAN_I = 189,
-	NV_FM_LNA_CTL_I = 190,
-	NV_LIFE_TIMER_G_I = 191,
-	NV_CALL_TIMER_G_I = 192,
-	NV_PWR_DWN_CNT_I = 193,
-	NV_FM_AGC_I = 194,
-	NV_FSC2_I = 195,
-	NV_FSC2_CHKSUM_I = 196,
-	NV_WDC_I = 197,
-	NV_HW_CONFIG_I = 198,
-	NV_CDMA_RX_LIN_VS_TEMP_I = 199,
-	NV_CDMA_ADJ_FACTOR_I = 200,
-	NV_CDMA_TX_LIM_BOOSTER_OFF_I = 201,
-	NV_CDMA_RX_SLP_VS_TEMP_I = 202,
-	NV_CDMA_TX_SLP_VS_TEMP_I = 203,
-	NV_PA_RANGE_VS_TEMP_I = 204,
-	NV_LNA_SWITCH_VS_TEMP_I = 205,
-	NV_FM_EXP_HDET_VS_TEMP_I = 206,
-	NV_N1M_I = 207,
-	NV_IMSI_I = 208,
-	NV_IMSI_ADDR_NUM_I = 209,
-	NV_ASSIGNING_TMSI_ZONE_LEN_I = 210,
-	NV_ASSIGNING_TMSI_ZONE_I = 211,
-	NV_TMSI_CODE_I = 212,
-	NV_TMSI_EXP_I = 213,
-	NV_HOME_PCS_FREQ_BLOCK_I = 214,
-	NV_DIR_NUMBER_PCS_I = 215,
-	NV_ROAMING_LIST_I = 216,
-	NV_MRU_TABLE_I = 217,
-	NV_REDIAL_I = 218,
-	NV_OTKSL_I = 219,
-	NV_TIMED_PREF_MODE_I = 220,
-	NV_RINGER_TYPE_I = 221,
-	NV_ANY_KEY_ANSWER_I = 222,
-	NV_BACK_LIGHT_HFK_I = 223,
-	NV_KEY_SOUND_I = 225,
-	NV_DIALS_SORTING_METHOD_I = 226,
-	NV_LANGUAGE_SELECTION_I = 227,
-	NV_MENU_FORMAT_I = 228,
-	NV_RINGER_SPKR_LVL_I = 229,
-	NV_BEEP_SPKR_LVL_I = 230,
-	NV_MRU2_TABLE_I = 231,
-	NV_VIBRATOR_I = 232,
-	NV_FLIP_ANSWERS_I = 233,
-	NV_DIAL_RESTRICT_LVLS_I = 234,
-	NV_DIAL_STATE_TABLE_LEN_I = 235,
-	NV_DIAL_STATE_TABLE_I = 236,
-	NV_VOICE_PRIV_ALERT_I = 237,
-	NV_IP_ADDRESS_I = 238,
-	NV_CURR_GATEWAY_I = 239,
-	NV_DATA_QNC_ENABLED_I = 240,
-	NV_DATA_SO_SET_I = 241,
-	NV_UP_LINK_INFO_I = 242,
-	NV_UP_PARMS_I = 243,
-	NV_ELAPSED_TIME_I = 245,
-	NV_PDM2_I = 246,
-	NV_RX_AGC_MINMAX_I = 247,
-	NV_VBATT_AUX_I = 248,
-	NV_DTACO_CONTROL_I = 249,
-	NV_DTACO_INTERDIGIT_TIMEOUT_I = 250,
-	NV_PDM1_I = 251,
-	NV_BELL_MODEM_I = 252,
-	NV_PDM1_VS_TEMP_I = 253,
-	NV_PDM2_VS_TEMP_I = 254,
-	NV_SID_NID_LOCK_I = 255,
-	NV_PRL_ENABLED_I = 256,
-	NV_ROAMING_LIST_683_I = 257,
-	NV_SYSTEM_PREF_I = 258,
-	NV_HOME_SID_NID_I = 259,
-	NV_OTAPA_ENABLED_I = 260,
-	NV_NAM_LOCK_I = 261,
-	NV_IMSI_T_S1_I = 262,
-	NV_IMSI_T_S2_I = 263,
-	NV_IMSI_T_MCC_I = 264,
-	NV_IMSI_T_11_12_I = 265,
-	NV_IMSI_T_ADDR_NUM_I = 266,
-	NV_UP_ALERTS_I = 267,
-	NV_UP_IDLE_TIMER_I = 268,
-	NV_SMS_UTC_I = 269,
-	NV_ROAM_RINGER_I = 270,
-	NV_RENTAL_TIMER_I = 271,
-	NV_RENTAL_TIMER_INC_I = 272,
-	NV_RENTAL_CNT_I = 273,
-	NV_RENTAL_TIMER_ENABLED_I = 274,
-	NV_FULL_SYSTEM_PREF_I = 275,
-	NV_BORSCHT_RINGER_FREQ_I = 276,
-	NV_PAYPHONE_ENABLE_I = 277,
-	NV_DSP_ANSWER_DET_ENABLE_I = 278,
-	NV_EVRC_PRI_I = 279,
-	NV_AFAX_CLASS_20_I = 280,
-	NV_V52_CONTROL_I = 281,
-	NV_CARRIER_INFO_I = 282,
-	NV_AFAX_I = 283,
-	NV_SIO_PWRDWN_I = 284,
-	NV_PREF_VOICE_SO_I = 285,
-	NV_VRHFK_ENABLED_I = 286,
-	NV_VRHFK_VOICE_ANSWER_I = 287,
-	NV_PDM1_VS_FREQ_I = 288,
-	NV_PDM2_VS_FREQ_I = 289,
-	NV_SMS_AUTO_DELETE_I = 290,
-	NV_SRDA_ENABLED_I = 291,
-	NV_OUTPUT_UI_KEYS_I = 292,
-	NV_POL_REV_TIMEOUT_I = 293,
-	NV_SI_TEST_DATA_1_I = 294,
-	NV_SI_TEST_DATA_2_I = 295,
-	NV_SPC_CHANGE_ENABLED_I = 296,
-	NV_DATA_MDR_MODE_I = 297,
-	NV_DATA_PKT_ORIG_STR_I = 298,
-	NV_UP_KEY_I = 299,
-	NV_DATA_AUTO_PACKET_DETECTION_I = 300,
-	NV_AUTO_VOLUME_ENABLED_I = 301,
-	NV_WILDCARD_SID_I = 302,
-	NV_ROAM_MSG_I = 303,
-	NV_OTKSL_FLAG_I = 304,
-	NV_BROWSER_TYPE_I = 305,
-	NV_SMS_REMINDER_TONE_I = 306,
-	NV_UBROWSER_I = 307,
-	NV_BTF_ADJUST_I = 308,
-	NV_FULL_PREF_MODE_I = 309,
-	NV_UP_BROWSER_WARN_I = 310,
-	NV_FM_HDET_ADC_RANGE_I = 311,
-	NV_CDMA_HDET_ADC_RANGE_I = 312,
-	NV_PN_ID_I = 313,
-	NV_USER_ZONE_ENABLED_I = 314,
-	NV_USER_ZONE_I = 315,
-	NV_PAP_DATA_I = 316,
-	NV_DATA_DEFAULT_PROFILE_I = 317,
-	NV_PAP_USER_ID_I = 318,
-	NV_PAP_PASSWORD_I = 319,
-	NV_STA_TBYE_I = 320,
-	NV_STA_MIN_THR_I = 321,
-	NV_STA_MIN_RX_I = 322,
-	NV_STA_MIN_ECIO_I = 323,
-	NV_STA_PRI_I = 324,
-	NV_PCS_RX_LIN_OFF_0_I = 325,
-	NV_PCS_RX_LIN_SLP_I = 326,
-	NV_PCS_RX_COMP_VS_FREQ_I = 327,
-	NV_PCS_TX_COMP_VS_FREQ_I = 328,
-	NV_PCS_TX_LIN_MASTER_OFF_0_I = 329,
-	NV_PCS_TX_LIN_MASTER_SLP_I = 330,
-	NV_PCS_TX_LIN_VS_TEMP_I = 331,
-	NV_PCS_TX_LIM_VS_TEMP_I = 332,
-	NV_PCS_TX_LIM_VS_FREQ_I = 333,
-	NV_PCS_EXP_HDET_VS_AGC_I = 334,
-	NV_PCS_HDET_OFF_I = 335,
-	NV_PCS_HDET_SPN_I = 336,
-	NV_PCS_R1_RISE_I = 337,
-	NV_PCS_R1_FALL_I = 338,
-	NV_PCS_R2_RISE_I = 339,
-	NV_PCS_R2_FALL_I = 340,
-	NV_PCS_R3_RISE_I = 341,
-	NV_PCS_R3_FALL_I = 342,
-	NV_PCS_PA_RANGE_STEP_CAL_I = 343,
-	NV_PCS_PDM1_VS_FREQ_I = 344,
-	NV_PCS_PDM2_VS_FREQ_I = 345,
-	NV_PCS_LNA_RANGE_POL_I = 346,
-	NV_PCS_LNA_RANGE_RISE_I = 347,
-	NV_PCS_LNA_RANGE_FALL_I = 348,
-	NV_PCS_LNA_RANGE_OFFSET_I = 349,
-	NV_PCS_RX_LIN_VS_TEMP_I = 350,
-	NV_PCS_ADJ_FACTOR_I = 351,
-	NV_PCS_PA_RANGE_VS_TEMP_I = 352,
-	NV_PCS_PDM1_VS_TEMP_I = 353,
-	NV_PCS_PDM2_VS_TEMP_I = 354,
-	NV_PCS_RX_SLP_VS_TEMP_I = 355,
-	NV_PCS_TX_SLP_VS_TEMP_I = 356,
-	NV_PCS_RX_AGC_MINMAX_I = 357,
-	NV_PA_OFFSETS_I = 358,
-	NV_CDMA_TX_LIN_MASTER0_I = 367,
-	NV_CDMA_TX_LIN_MASTER1_I = 368,
-	NV_CDMA_TX_LIN_MASTER2_I = 369,
-	NV_CDMA_TX_LIN_MASTER3_I = 370,
-	NV_TIME_FMT_SELECTION_I = 371,
-	NV_SMS_BC_SERVICE_TABLE_SIZE_I = 372,
-	NV_SMS_BC_SERVICE_TABLE_I = 373,
-	NV_SMS_BC_CONFIG_I = 374,
-	NV_SMS_BC_USER_PREF_I = 375,
-	NV_LNA_RANGE_2_RISE_I = 376,
-	NV_LNA_RANGE_2_FALL_I = 377,
-	NV_LNA_RANGE_12_OFFSET_I = 378,
-	NV_NONBYPASS_TIMER_I = 379,
-	NV_BYPASS_TIMER_I = 380,
-	NV_IM_LEVEL1_I = 381,
-	NV_IM_LEVEL2_I = 382,
-	NV_CDMA_LNA_OFFSET_VS_FREQ_I = 383,
-	NV_CDMA_LNA_12_OFFSET_VS_FREQ_I = 384,
-	NV_AGC_PHASE_OFFSET_I = 385,
-	NV_RX_AGC_MIN_11_I = 386,
-	NV_PCS_LNA_RANGE_2_RISE_I = 387,
-	NV_PCS_LNA_RANGE_2_FALL_I = 388,
-	NV_PCS_LNA_RANGE_12_OFFSET_I = 389,
-	NV_PCS_NONBYPASS_TIMER_I = 390,
-	NV_PCS_BYPASS_TIMER_I = 391,
-	NV_PCS_IM_LEVEL1_I = 392,
-	NV_PCS_IM_LEVEL2_I = 393,
-	NV_PCS_CDMA_LNA_OFFSET_VS_FREQ_I = 394,
-	NV_PCS_CDMA_LNA_12_OFFSET_VS_FREQ_I = 395,
-	NV_PCS_AGC_PHASE_OFFSET_I = 396,
-	NV_PCS_RX_AGC_MIN_11_I = 397,
-	NV_RUIM_CHV_1_I = 398,
-	NV_RUIM_CHV_2_I = 399,
-	NV_GPS1_CAPABILITIES_I = 400,
-	NV_GPS1_PDE_ADDRESS_I = 401,
-	NV_GPS1_ALLOWED_I = 402,
-	NV_GPS1_PDE_TRANSPORT_I = 403,
-	NV_GPS1_MOBILE_CALC_I = 404,
-	NV_PREF_FOR_RC_I = 405,
-	NV_DS_DEFAULT_BAUD_I = 406,
-	NV_DIAG_DEFAULT_BAUD_I = 407,
-	NV_SIO_DEV_MAP_MENU_ITEM_I = 408,
-	NV_TTY_I = 409,
-	NV_PA_RANGE_OFFSETS_I = 410,
-	NV_TX_COMP0_I = 411,
-	NV_MM_SDAC_LVL_I = 412,
-	NV_BEEP_SDAC_LVL_I = 413,
-	NV_SDAC_LVL_I = 414,
-	NV_MM_LVL_I = 415,
-	NV_MM_LVL_SHADOW_I = 416,
-	NV_MM_SPEAKER_LVL_I = 417,
-	NV_MM_PLAY_MODE_I = 418,
-	NV_MM_REPEAT_MODE_I = 419,
-	NV_TX_COMP1_I = 420,
-	NV_TX_COMP2_I = 421,
-	NV_TX_COMP3_I = 422,
-	NV_PRIMARY_DNS_I = 423,
-	NV_SECONDARY_DNS_I = 424,
-	NV_DIAG_PORT_SELECT_I = 425,
-	NV_GPS1_PDE_PORT_I = 426,
-	NV_MM_RINGER_FILE_I = 427,
-	NV_MM_STORAGE_DEVICE_I = 428,
-	NV_DATA_SCRM_ENABLED_I = 429,
-	NV_RUIM_SMS_STATUS_I = 430,
-	NV_PCS_TX_LIN_MASTER0_I = 431,
-	NV_PCS_TX_LIN_MASTER1_I = 432,
-	NV_PCS_TX_LIN_MASTER2_I = 433,
-	NV_PCS_TX_LIN_MASTER3_I = 434,
-	NV_PCS_PA_RANGE_OFFSETS_I = 435,
-	NV_PCS_TX_COMP0_I = 436,
-	NV_PCS_TX_COMP1_I = 437,
-	NV_PCS_TX_COMP2_I = 438,
-	NV_PCS_TX_COMP3_I = 439,
-	NV_DIAG_RESTART_CONFIG_I = 440,
-	NV_BAND_PREF_I = 441,
-	NV_ROAM_PREF_I = 442,
-	NV_GPS1_GPS_RF_DELAY_I = 443,
-	NV_GPS1_CDMA_RF_DELAY_I = 444,
-	NV_PCS_ENC_BTF_I = 445,
-	NV_CDMA_ENC_BTF_I = 446,
-	NV_BD_ADDR_I = 447,
-	NV_SUBPCG_PA_WARMUP_DELAY_I = 448,
-	NV_GPS1_GPS_RF_LOSS_I = 449,
-	NV_DATA_TRTL_ENABLED_I = 450,
-	NV_AMPS_BACKSTOP_ENABLED_I = 451,
-	NV_GPS1_LOCK_I = 452,
-	NV_FTM_MODE_I = 453,
-	NV_DS_DEFAULT_BAUDRATE_I = 454,
-	NV_DIAG_DEFAULT_BAUDRATE_I = 455,
-	NV_JCDMA_DS_F92_I = 456,
-	NV_DS_QCMIP_I = 459,
-	NV_DS_MIP_RETRIES_I = 460,
-	NV_DS_MIP_RETRY_INT_I = 461,
-	NV_DS_MIP_PRE_RE_RRQ_TIME_I = 462,
-	NV_DS_MIP_NUM_PROF_I = 463,
-	NV_DS_MIP_ACTIVE_PROF_I = 464,
-	NV_DS_MIP_GEN_USER_PROF_I = 465,
-	NV_DS_MIP_SS_USER_PROF_I = 466,
-	NV_HDR_CON_SUSPEND_I = 467,
-	NV_HDR_PRE_CC_CYC_ENABLED_I = 468,
-	NV_HDR_PRE_CC_CYC_I = 469,
-	NV_HDR_SRCH_PARAMS_I = 470,
-	NV_HDRSMP_KEEP_ALIVE_START_I = 471,
-	NV_HDRSMP_KEEP_ALIVE_SENT_I = 472,
-	NV_HDRSMP_KEEP_ALIVE_REQ_INT_I = 473,
-	NV_HDRAMP_ADDRESS_DATA_I = 474,
-	NV_HDRSCP_SESSION_STATUS_I = 475,
-	NV_HDRSCP_TOKEN_I = 476,
-	NV_HDRSCP_PROTOCOL_SUBTYPE_I = 477,
-	NV_HDRAMP_DUAL_EXPIRE_TIME_I = 478,
-	NV_HDRSTREAM_CURR_STREAM_CFG_I = 479,
-	NV_HDR_SET_MNGMT_SAME_CHAN_I = 480,
-	NV_HDR_SET_MNGMT_DIFF_CHAN_I = 481,
-	NV_HDRLUP_UNSOLICITED_ENABLED_I = 482,
-	NV_HDRAMAC_INITIAL_CONFIG_I = 483,
-	NV_HDRAMAC_POWER_PARAMS_I = 484,
-	NV_HDRFMAC_DRC_GATING_I = 485,
-	NV_HDRFMAC_HANDOFF_DELAYS_I = 486,
-	NV_HDRRMAC_POWER_PARAMS_I = 487,
-	NV_HDRRMAC_RATE_PARAMS_I = 488,
-	NV_HDRSLP_RESET_SEQNO_I = 489,
-	NV_PWR_BACKOFF_VS_VOLT_MED_I = 490,
-	NV_PWR_BACKOFF_VS_VOLT_LOW_I = 491,
-	NV_PA_BACKOFF_VOLTS_I = 492,
-	NV_VBATT_MIN_MAX_I = 493,
-	NV_DS_MIP_MN_HA_TIME_DELTA_I = 494,
-	NV_DS_MIP_QC_DRS_OPT_I = 495,
-	NV_ANT2_CDMA_RX_LIN_OFF_0_I = 496,
-	NV_ANT2_CDMA_RX_LIN_SLP_I = 497,
-	NV_ANT2_CDMA_RX_COMP_VS_FREQ_I = 498,
-	NV_ANT2_CDMA_RX_LIN_VS_TEMP_I = 499,
-	NV_ANT2_CDMA_RX_SLP_VS_TEMP_I = 500,
-	NV_ANT2_LNA_RANGE_OFFSET_I = 501,
-	NV_ANT2_LNA_RANGE_12_OFFSET_I = 502,
-	NV_ANT2_CDMA_LNA_OFFSET_VS_FREQ_I = 503,
-	NV_ANT2_CDMA_LNA_12_OFFSET_VS_FREQ_I = 504,
-	NV_ANT2_PCS_RX_LIN_OFF_0_I = 505,
-	NV_ANT2_PCS_RX_LIN_SLP_I = 506,
-	NV_ANT2_PCS_RX_COMP_VS_FREQ_I = 507,
-	NV_ANT2_PCS_RX_LIN_VS_TEMP_I = 508,
-	NV_ANT2_PCS_RX_SLP_VS_TEMP_I = 509,
-	NV_ANT2_PCS_LNA_RANGE_OFFSET_I = 510,
-	NV_ANT2_PCS_LNA_RANGE_12_OFFSET_I = 511,
-	NV_ANT2_PCS_CDMA_LNA_OFFSET_VS_FREQ_I = 512,
-	NV_ANT2_PCS_CDMA_LNA_12_OFFSET_VS_FREQ_I = 513,
-	NV_WCDMA_RX_LIN_I = 514,
-	NV_WCDMA_RX_COMP_VS_FREQ_I = 515,
-	NV_WCDMA_RX_LIN_VS_TEMP_I = 516,
-	NV_WCDMA_RX_SLP_VS_TEMP_I = 517,
-	NV_WCDMA_LNA_RANGE_POL_I = 518,
-	NV_WCDMA_LNA_RANGE_RISE_I = 519,
-	NV_WCDMA_LNA_RANGE_FALL_I = 520,
-	NV_WCDMA_IM_LEVEL_I = 521,
-	NV_WCDMA_NONBYPASS_TIMER_I = 522,
-	NV_WCDMA_BYPASS_TIMER_I = 523,
-	NV_WCDMA_LNA_RANGE_OFFSET_I = 524,
-	NV_WCDMA_LNA_OFFSET_VS_FREQ_I = 525,
-	NV_WCDMA_RX_AGC_MIN_I = 526,
-	NV_WCDMA_RX_AGC_MAX_I = 527,
-	NV_WCDMA_AGC_PHASE_OFFSET_I = 528,
-	NV_WCDMA_TX_LIN_MASTER_0_I = 529,
-	NV_WCDMA_TX_LIN_MASTER_1_I = 530,
-	NV_WCDMA_TX_COMP_VS_FREQ_0_I = 531,
-	NV_WCDMA_TX_COMP_VS_FREQ_1_I = 532,
-	NV_WCDMA_TX_LIN_VS_TEMP_0_I = 533,
-	NV_WCDMA_TX_LIN_VS_TEMP_1_I = 534,
-	NV_WCDMA_TX_SLP_VS_TEMP_0_I = 535,
-	NV_WCDMA_TX_SLP_VS_TEMP_1_I = 536,
-	NV_WCDMA_R1_RISE_I = 537,
-	NV_WCDMA_R1_FALL_I = 538,
-	NV_WCDMA_TX_LIM_VS_TEMP_I = 539,
-	NV_WCDMA_TX_LIM_VS_FREQ_I = 540,
-	NV_WCDMA_ADJ_FACTOR_I = 541,
-	NV_WCDMA_EXP_HDET_VS_AGC_I = 542,
-	NV_WCDMA_HDET_OFF_I = 543,
-	NV_WCDMA_HDET_SPN_I = 544,
-	NV_WCDMA_ENC_BTF_I = 545,
-	NV_DS_MIP_2002BIS_MN_HA_AUTH_I = 546,
-	NV_UE_RAT_CAPABILITY_I = 547,
-	NV_GSM_UE_OP_CLASS_I = 548,
-	NV_UMTS_UE_OP_CLASS_I = 549,
-	NV_UE_IMEI_I = 550,
-	NV_MSRAC_SMS_VALUE_I = 551,
-	NV_MSRAC_SM_VALUE_I = 552,
-	NV_GSM_A5_ALGORITHMS_SUPPORTED_I = 553,
-	NV_HDRFMAC_DRC_LOCK_I = 554,
-	NV_GPS1_LO_CAL_I = 555,
-	NV_GPS1_ANT_OFF_DB_I = 556,
-	NV_GPS1_PCS_RF_DELAY_I = 557,
-	NV_SMS_VM_NUMBER_I = 558,
-	NV_SMS_GW_PARMS_I = 559,
-	NV_SMS_GW_I = 561,
-	NV_HYBRID_PREF_I = 562,
-	NV_SP_ECC_ENABLED_I = 563,
-	NV_ECC_LIST_I = 564,
-	NV_BT_LPOS_LAT_I = 565,
-	NV_BT_LPOS_LONG_I = 566,
-	NV_TEST_CODE_VER_I = 567,
-	NV_SYS_SW_VER_I = 568,
-	NV_RF_CAL_VER_I = 569,
-	NV_RF_CONFIG_VER_I = 570,
-	NV_RF_CAL_DATE_I = 571,
-	NV_RF_NV_LOADED_DATE_I = 572,
-	NV_RF_CAL_DAT_FILE_I = 573,
-	NV_DOMAIN_NAME_I = 574,
-	NV_PREF_PLMN_I = 577,
-	NV_HDR_AN_AUTH_NAI_I = 579,
-	NV_HDR_AN_AUTH_PASSWORD_I = 580,
-	NV_PUZL_ENABLED_I = 581,
-	NV_HDRKEP_CONFIG_I = 583,
-	NV_HDRAUTH_CONFIG_I = 584,
-	NV_IM_LEVEL3_I = 585,
-	NV_IM_LEVEL4_I = 586,
-	NV_AGC_VALUE_3_MIN_I = 587,
-	NV_AGC_VALUE_4_MIN_I = 588,
-	NV_TX_GAIN_ATTEN_LIMIT_I = 589,
-	NV_CDMA_LNA_3_FALL_I = 590,
-	NV_CDMA_LNA_3_OFFSET_I = 591,
-	NV_CDMA_LNA_3_RISE_I = 592,
-	NV_CDMA_LNA_3_OFFSET_VS_FREQ_I = 593,
-	NV_PCS_LNA_3_FALL_I = 594,
-	NV_PCS_LNA_3_OFFSET_I = 595,
-	NV_PCS_LNA_3_RISE_I = 596,
-	NV_PCS_LNA_3_OFFSET_VS_FREQ_I = 597,
-	NV_CDMA_LNA_4_FALL_I = 598,
-	NV_CDMA_LNA_4_OFFSET_I = 599,
-	NV_CDMA_LNA_4_RISE_I = 600,
-	NV_CDMA_LNA_4_OFFSET_VS_FREQ_I = 601,
-	NV_PCS_LNA_4_FALL_I = 602,
-	NV_PCS_LNA_4_OFFSET_I = 603,
-	NV_PCS_LNA_4_RISE_I = 604,
-	NV_PCS_LNA_4_OFFSET_VS_FREQ_I = 605,
-	NV_DFM_LNA_FALL_I = 606,
-	NV_DFM_LNA_OFFSET_I = 607,
-	NV_DFM_LNA_RISE_I = 608,
-	NV_DFM_LNA_OFFSET_VS_FREQ_I = 609,
-	NV_DFM_AGC_ACC_MIN_1_I = 610,
-	NV_DFM_AGC_IM_GAIN_I = 611,
-	NV_DFM_AGC_DC_GAIN_I = 612,
-	NV_DFM_IM_LEVEL1_I = 613,
-	NV_GPS_FG_TRK_OFFSET_SCALER_I = 614,
-	NV_DIGITAL_FG_TRK_OFFSET_SCALER_I = 615,
-	NV_FM_FG_TRK_OFFSET_SCALER_I = 616,
-	NV_DFM_LNA_S0_PHASE_OFFSET_I = 617,
-	NV_DFM_LNA_S1_PHASE_OFFSET_I = 618,
-	NV_CDMA_RXF_CG_IOFFSET_I = 619,
-	NV_PCS_RXF_CG_IOFFSET_I = 620,
-	NV_FM_RXF_CG_IOFFSET_I = 621,
-	NV_GPS_RXF_CG_IOFFSET_I = 622,
-	NV_CDMA_RXF_CG_QOFFSET_I = 623,
-	NV_PCS_RXF_CG_QOFFSET_I = 624,
-	NV_FM_RXF_CG_QOFFSET_I = 625,
-	NV_GPS_RXF_CG_QOFFSET_I = 626,
-	NV_CDMA_RXF_FG_IOFFSET_I = 627,
-	NV_PCS_RXF_FG_IOFFSET_I = 628,
-	NV_FM_RXF_FG_IOFFSET_I = 629,
-	NV_GPS_RXF_FG_IOFFSET_I = 630,
-	NV_CDMA_RXF_FG_QOFFSET_I = 631,
-	NV_PCS_RXF_FG_QOFFSET_I = 632,
-	NV_FM_RXF_FG_QOFFSET_I = 633,
-	NV_GPS_RXF_FG_QOFFSET_I = 634,
-	NV_CDMA_DACC_EST_IOFFSET_I = 635,
-	NV_PCS_DACC_EST_IOFFSET_I = 636,
-	NV_FM_DACC_EST_IOFFSET_I = 637,
-	NV_GPS_DACC_EST_IOFFSET_I = 638,
-	NV_CDMA_DACC_EST_QOFFSET_I = 639,
-	NV_PCS_DACC_EST_QOFFSET_I = 640,
-	NV_FM_DACC_EST_QOFFSET_I = 641,
-	NV_GPS_DACC_EST_QOFFSET_I = 642,
-	NV_CDMA_DACC_IACCUM0_I = 643,
-	NV_PCS_DACC_IACCUM0_I = 644,
-	NV_FM_DACC_IACCUM0_I = 645,
-	NV_GPS_DACC_IACCUM0_I = 646,
-	NV_CDMA_DACC_IACCUM1_I = 647,
-	NV_PCS_DACC_IACCUM1_I = 648,
-	NV_FM_DACC_IACCUM1_I = 649,
-	NV_GPS_DACC_IACCUM1_I = 650,
-	NV_CDMA_DACC_IACCUM2_I = 651,
-	NV_PCS_DACC_IACCUM2_I = 652,
-	NV_FM_DACC_IACCUM2_I = 653,
-	NV_GPS_DACC_IACCUM2_I = 654,
-	NV_CDMA_DACC_IACCUM3_I = 655,
-	NV_PCS_DACC_IACCUM3_I = 656,
-	NV_FM_DACC_IACCUM3_I = 657,
-	NV_GPS_DACC_IACCUM3_I = 658,
-	NV_CDMA_DACC_IACCUM4_I = 659,
-	NV_PCS_DACC_IACCUM4_I = 660,
-	NV_FM_DACC_IACCUM4_I = 661,
-	NV_GPS_DACC_IACCUM4_I = 662,
-	NV_CDMA_DACC_QACCUM0_I = 663,
-	NV_PCS_DACC_QACCUM0_I = 664,
-	NV_FM_DACC_QACCUM0_I = 665,
-	NV_GPS_DACC_QACCUM0_I = 666,
-	NV_CDMA_DACC_QACCUM1_I = 667,
-	NV_PCS_DACC_QACCUM1_I = 668,
-	NV_FM_DACC_QACCUM1_I = 669,
-	NV_GPS_DACC_QACCUM1_I = 670,
-	NV_CDMA_DACC_QACCUM2_I = 671,
-	NV_PCS_DACC_QACCUM2_I = 672,
-	NV_FM_DACC_QACCUM2_I = 673,
-	NV_GPS_DACC_QACCUM2_I = 674,
-	NV_CDMA_DACC_QACCUM3_I = 675,
-	NV_PCS_DACC_QACCUM3_I = 676,
-	NV_FM_DACC_QACCUM3_I = 677,
-	NV_GPS_DACC_QACCUM3_I = 678,
-	NV_CDMA_DACC_QACCUM4_I = 679,
-	NV_PCS_DACC_QACCUM4_I = 680,
-	NV_FM_DACC_QACCUM4_I = 681,
-	NV_GPS_DACC_QACCUM4_I = 682,
-	NV_CDMA_DACC_GAIN_MULT_I = 683,
-	NV_PCS_DACC_GAIN_MULT_I = 684,
-	NV_FM_DACC_GAIN_MULT_I = 685,
-	NV_GPS_DACC_GAIN_MULT_I = 686,
-	NV_CDMA_IM2_I_VALUE_I = 687,
-	NV_PCS_IM2_I_VALUE_I = 688,
-	NV_CDMA_IM2_Q_VALUE_I = 689,
-	NV_PCS_IM2_Q_VALUE_I = 690,
-	NV_RTC_TIME_ADJUST_I = 691,
-	NV_FM_VGA_GAIN_OFFSET_I = 692,
-	NV_CDMA_VGA_GAIN_OFFSET_I = 693,
-	NV_PCS_VGA_GAIN_OFFSET_I = 694,
-	NV_FM_VGA_GAIN_OFFSET_VS_FREQ_I = 695,
-	NV_CDMA_VGA_GAIN_OFFSET_VS_FREQ_I = 696,
-	NV_PCS_VGA_GAIN_OFFSET_VS_FREQ_I = 697,
-	NV_FM_VGA_GAIN_OFFSET_VS_TEMP_I = 698,
-	NV_CDMA_VGA_GAIN_OFFSET_VS_TEMP_I = 699,
-	NV_PCS_VGA_GAIN_OFFSET_VS_TEMP_I = 700,
-	NV_FM_MIS_COMP_A_OFFSET_I = 701,
-	NV_DIGITAL_MIS_COMP_A_OFFSET_I = 702,
-	NV_GPS_MIS_COMP_A_OFFSET_I = 703,
-	NV_FM_MIS_COMP_B_OFFSET_I = 704,
-	NV_DIGITAL_MIS_COMP_B_OFFSET_I = 705,
-	NV_GPS_MIS_COMP_B_OFFSET_I = 706,
-	NV_DS_MIP_RRQ_IF_TFRK_I = 707,
-	NV_COLLOC_DISALLOWED_TIME_I = 708,
-	NV_HOLD_HDR_TIME_I = 709,
-	NV_LO_BIAS_UPDATE_CNT_I = 710,
-	NV_HDRSCP_AN_AUTH_STATUS_I = 712,
-	NV_IMSI_INDEX_I = 713,
-	NV_DS_MIP_ENABLE_PROF_I = 714,
-	NV_PCS_IM_LEVEL3_I = 715,
-	NV_PCS_IM_LEVEL4_I = 716,
-	NV_PCS_AGC_VALUE_3_MIN_I = 717,
-	NV_PCS_AGC_VALUE_4_MIN_I = 718,
-	NV_HDRSMPKA_START_TIME_I = 719,
-	NV_HDRSMPKA_SENT_TIME_I = 720,
-	NV_SMS_BC_SERVICE_TABLE_OPTIONS_I = 721,
-	NV_ACQ_DB_I = 722,
-	NV_ACQ_LIST_1_I = 723,
-	NV_GSM_CAL_ARFCN_I = 724,
-	NV_DCS_CAL_ARFCN_I = 725,
-	NV_GSM_RX_GAIN_RANGE_1_FREQ_COMP_I = 726,
-	NV_GSM_RX_GAIN_RANGE_2_FREQ_COMP_I = 727,
-	NV_GSM_RX_GAIN_RANGE_3_FREQ_COMP_I = 728,
-	NV_GSM_RX_GAIN_RANGE_4_FREQ_COMP_I = 729,
-	NV_DCS_RX_GAIN_RANGE_1_FREQ_COMP_I = 730,
-	NV_DCS_RX_GAIN_RANGE_2_FREQ_COMP_I = 731,
-	NV_DCS_RX_GAIN_RANGE_3_FREQ_COMP_I = 732,
-	NV_DCS_RX_GAIN_RANGE_4_FREQ_COMP_I = 733,
-	NV_GSM_TRK_LO_ADJ_PDM_INIT_VAL_I = 734,
-	NV_GSM_TRK_LO_ADJ_PDM_GAIN_SLOPE_I = 735,
-	NV_GPS_DOPP_SDEV_I = 736,
-	NV_ACQ_LIST_2_I = 737,
-	NV_ACQ_LIST_3_I = 738,
-	NV_ACQ_LIST_4_I = 739,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_00_I = 740,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_01_I = 741,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_02_I = 742,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_03_I = 743,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_04_I = 744,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_05_I = 745,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_06_I = 746,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_07_I = 747,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_08_I = 748,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_09_I = 749,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_10_I = 750,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_11_I = 751,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_12_I = 752,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_13_I = 753,
-	NV_GSM_TX_BURST_RAMP_UP_INDEX_14_I = 754,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_00_I = 755,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_01_I = 756,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_02_I = 757,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_03_I = 758,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_04_I = 759,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_05_I = 760,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_06_I = 761,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_07_I = 762,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_08_I = 763,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_09_I = 764,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_10_I = 765,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_11_I = 766,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_12_I = 767,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_13_I = 768,
-	NV_GSM_TX_BURST_RAMP_DOWN_INDEX_14_I = 769,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_00_I = 770,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_01_I = 771,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_02_I = 772,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_03_I = 773,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_04_I = 774,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_05_I = 775,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_06_I = 776,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_07_I = 777,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_08_I = 778,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_09_I = 779,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_10_I = 780,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_11_I = 781,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_12_I = 782,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_13_I = 783,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_14_I = 784,
-	NV_DCS_TX_BURST_RAMP_UP_INDEX_15_I = 785,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_00_I = 786,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_01_I = 787,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_02_I = 788,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_03_I = 789,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_04_I = 790,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_05_I = 791,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_06_I = 792,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_07_I = 793,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_08_I = 794,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_09_I = 795,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_10_I = 796,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_11_I = 797,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_12_I = 798,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_13_I = 799,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_14_I = 800,
-	NV_DCS_TX_BURST_RAMP_DOWN_INDEX_15_I = 801,
-	NV_GSM_PA_GAIN_SLOPE_I = 802,
-	NV_DCS_PA_GAIN_SLOPE_I = 803,
-	NV_GSM_TX_FREQ_COMP_I = 804,
-	NV_DCS_TX_FREQ_COMP_I = 805,
-	NV_GSM_VBATT_HI_PA_COMP_I = 806,
-	NV_GSM_VBATT_LO_PA_COMP_I = 807,
-	NV_DCS_VBATT_HI_PA_COMP_I = 808,
-	NV_DCS_VBATT_LO_PA_COMP_I = 809,
-	NV_VBATT_3200_MV_ADC_I = 810,
-	NV_VBATT_3700_MV_ADC_I = 811,
-	NV_VBATT_4200_MV_ADC_I = 812,
-	NV_GSM_PRECHARGE_I = 813,
-	NV_DCS_PRECHARGE_I = 814,
-	NV_GSM_PRECHARGE_DUR_I = 815,
-	NV_DCS_PRECHARGE_DUR_I = 816,
-	NV_DIGITAL_PLL_LOCK_TIMER_I = 817,
-	NV_HDR_RX_DIVERSITY_CTRL_I = 818,
-	NV_GSM_PA_START_TIME_OFFSET_I = 819,
-	NV_GSM_PA_STOP_TIME_OFFSET_I = 820,
-	NV_DCS_PA_START_TIME_OFFSET_I = 821,
-	NV_DCS_PA_STOP_TIME_OFFSET_I = 822,
-	NV_GPS1_PRIVACY_I = 823,
-	NV_GPS1_NET_ACCESS_I = 824,
-	NV_GPS1_CELLBASED_SMS_I = 825,
-	NV_GPS1_TELESERVICE_ID_I = 826,
-	NV_HDRRUP_SRCH_PARAMS_I = 827,
-	NV_DFM_LNA_BYPASS_TIMER_I = 828,
-	NV_DFM_LNA_NONBYPASS_TIMER_I = 829,
-	NV_SMS_CFG_ROUTING_I = 830,
-	NV_GPS1_NET_DBM_SIZE_I = 831,
-	NV_HDR_DO_NOT_DISTURB_I = 832,
-	NV_CDMA_TX_GAIN_ATTEN_LIMIT_I = 833,
-	NV_PCS_TX_GAIN_ATTEN_LIMIT_I = 834,
-	NV_AMPS_TX_GAIN_ATTEN_LIMIT_I = 835,
-	NV_GPS_TX_GAIN_ATTEN_LIMIT_I = 836,
-	NV_CDMA_IM2_TRANSCONDUCTOR_VALUE_I = 837,
-	NV_PCS_IM2_TRANSCONDUCTOR_VALUE_I = 838,
-	NV_LNA_NON_BYPASS_TIMER_0_I = 839,
-	NV_LNA_NON_BYPASS_TIMER_1_I = 840,
-	NV_LNA_NON_BYPASS_TIMER_2_I = 841,
-	NV_LNA_NON_BYPASS_TIMER_3_I = 842,
-	NV_LNA_BYPASS_TIMER_0_I = 843,
-	NV_LNA_BYPASS_TIMER_1_I = 844,
-	NV_LNA_BYPASS_TIMER_2_I = 845,
-	NV_LNA_BYPASS_TIMER_3_I = 846,
-	NV_SMS_CD_PARMS_I = 847,
-	NV_ACQ_ORDER_PREF_I = 848,
-	NV_NET_SEL_MODE_PREF_I = 849,
-	NV_SERVICE_DOMAIN_PREF_I = 850,
-	NV_PPP_AUTHENTICATION_I = 851,
-	NV_APN_NAME_I = 852,
-	NV_EQUIVALENT_PLMN_LIST_I = 853,
-	NV_DS_MIP_DMU_PKOID_I = 854,
-	NV_RTRE_CONFIG_I = 855,
-	NV_WCDMA_VGA_GAIN_OFFSET_I = 856,
-	NV_WCDMA_VGA_GAIN_OFFSET_VS_FREQ_I = 857,
-	NV_WCDMA_VGA_GAIN_OFFSET_VS_TEMP_I = 858,
-	NV_WCDMA_LNA_RANGE_RISE_2_I = 859,
-	NV_WCDMA_LNA_RANGE_RISE_3_I = 860,
-	NV_WCDMA_LNA_RANGE_FALL_2_I = 861,
-	NV_WCDMA_LNA_RANGE_FALL_3_I = 862,
-	NV_WCDMA_IM_LEVEL_2_I = 863,
-	NV_WCDMA_IM_LEVEL_3_I = 864,
-	NV_WCDMA_LNA_RANGE_OFFSET_2_I = 865,
-	NV_WCDMA_LNA_RANGE_OFFSET_3_I = 866,
-	NV_WCDMA_LNA_OFFSET_VS_FREQ_2_I = 867,
-	NV_WCDMA_LNA_OFFSET_VS_FREQ_3_I = 868,
-	NV_WCDMA_IM2_I_VALUE_I = 869,
-	NV_WCDMA_IM2_Q_VALUE_I = 870,
-	NV_WCDMA_IM2_TRANSCONDUCTOR_VALUE_I = 871,
-	NV_WCDMA_RX_AGC_MIN_2_I = 872,
-	NV_WCDMA_RX_AGC_MIN_3_I = 873,
-	NV_WCDMA_VBATT_I = 874,
-	NV_WCDMA_THERM_I = 875,
-	NV_WCDMA_MAX_TX_POWER_I = 876,
-	NV_FM_PA_MAC_HIGH_I = 877,
-	NV_CDMA_DYNAMIC_RANGE_I = 878,
-	NV_CDMA_MIN_RX_RSSI_I = 879,
-	NV_RRC_INTEGRITY_ENABLED_I = 880,
-	NV_RRC_CIPHERING_ENABLED_I = 881,
-	NV_RRC_FAKE_SECURITY_ENABLED_I = 882,
-	NV_CDMA_POWERUP_REG_PERFORMED_I = 883,
-	NV_TX_WARMUP_I = 884,
-	NV_LAST_TX_DATA_COUNT_I = 885,
-	NV_LAST_RX_DATA_COUNT_I = 886,
-	NV_TOTAL_TX_DATA_COUNT_I = 887,
-	NV_TOTAL_RX_DATA_COUNT_I = 888,
-	NV_DS_MIP_DMU_MN_AUTH_I = 889,
-	NV_USB_PRODUCT_ID_OFFSET_I = 890,
-	NV_AVCD_CALL_DURATION_I = 891,
-	NV_AVCD_TIME_BETWEEN_CALLS_I = 892,
-	NV_AVCD_NUMBER_OF_CALLS_I = 893,
-	NV_AVCD_SO_I = 894,
-	NV_WCDMA_OUT_OF_SERVICE_THRESH_I = 895,
-	NV_UIM_FIRST_INST_CLASS_I = 896,
-	NV_HDRRUP_OVERRIDE_ALLOWED_I = 897,
-	NV_JCDMA_M511_MODE_I = 898,
-	NV_JCDMA_M512_MODE_I = 899,
-	NV_JCDMA_M513_MODE_I = 900,
-	NV_CDMA_P1_RISE_FALL_OFF_I = 901,
-	NV_PCS_P1_RISE_FALL_OFF_I = 902,
-	NV_GSM_LOCIGPRS_I = 903,
-	NV_GSM_KCGPRS_I = 904,
-	NV_ERR_FATAL_OPTIONS_I = 905,
-	NV_PPP_PASSWORD_I = 906,
-	NV_TRK_LO_ADJ_VS_TEMP_I = 907,
-	NV_ROT_FREQ_VS_TEMP_I = 908,
-	NV_SMS_GW_BEARER_PREF_I = 909,
-	NV_PPP_USER_ID_I = 910,
-	NV_MULTISLOT_CLASS_I = 911,
-	NV_NON_DRX_TIMER_I = 912,
-	NV_SPLIT_PAGING_CYCLE_I = 913,
-	NV_UIM_PREF_PROTOCOL_I = 914,
-	NV_WCDMACS_SYNC_TEST_APP_ENABLED_I = 915,
-	NV_GSM_GAINRANGE_SWITCHPOINTS_I = 916,
-	NV_DCS_GAINRANGE_SWITCHPOINTS_I = 917,
-	NV_HDR_AN_PPP_USER_ID_I = 919,
-	NV_HDR_AN_PPP_PASSWORD_I = 920,
-	NV_JTACS_PCDMACH_I = 921,
-	NV_JTACS_SCDMACH_I = 922,
-	NV_GSMUMTS_IMSI_I = 923,
-	NV_RTSP_PROXY_SERVER_ADDR_I = 924,
-	NV_SMS_GW_DEFAULT_TEMPLATE_I = 925,
-	NV_SMS_CD_DEFAULT_TEMPLATE_I = 926,
-	NV_NON_COMPLIANCE_COMMENT_I = 927,
-	NV_HYSTERISIS_ACTIVATION_TIMER_I = 928,
-	NV_HYSTERISIS_TIMER_I = 929,
-	NV_PKT_DIAL_STRINGS_I = 930,
-	NV_VCO_COARSE_TUNE_TABLE_I = 931,
-	NV_DATA_INCOMING_CSD_CALL_IS_INTERNAL_I = 932,
-	NV_DF_I = 933,
-	NV_GSM_PA_TEMP_COMP_INDEX_14_I = 934,
-	NV_DCS_PA_TEMP_COMP_INDEX_15_I = 935,
-	NV_RF_TEST_ITEM_1_I = 936,
-	NV_RF_TEST_ITEM_2_I = 937,
-	NV_NEG_SLOT_CYCLE_INDEX_I = 938,
-	NV_BTFD_OLPC_FLOOR_DB_I = 939,
-	NV_NON_BTFD_OLPC_FLOOR_DB_I = 940,
-	NV_SSPR_P_REV_I = 941,
-	NV_RTSP_PROXY_SERVER_ADDR_ALTERNATE_I = 942,
-	NV_UIM_CDMA_PREF_SLOT_I = 943,
-	NV_UIM_GSM_PREF_SLOT_I = 944,
-	NV_MRU3_TABLE_I = 945,
-	NV_BAND_PREF_16_31_I = 946,
-	NV_GPRS_ANITE_GCF_I = 947,
-	NV_C1_CDMA_LNA_OFFSET_I = 948,
-	NV_C1_CDMA_LNA_OFFSET_VS_FREQ_I = 949,
-	NV_C1_PCS_LNA_OFFSET_I = 950,
-	NV_C1_PCS_LNA_OFFSET_VS_FREQ_I = 951,
-	NV_C1_CDMA_LNA_2_OFFSET_I = 952,
-	NV_C1_CDMA_LNA_2_OFFSET_VS_FREQ_I = 953,
-	NV_C1_PCS_LNA_2_OFFSET_I = 954,
-	NV_C1_PCS_LNA_2_OFFSET_VS_FREQ_I = 955,
-	NV_C1_CDMA_LNA_3_OFFSET_I = 956,
-	NV_C1_CDMA_LNA_3_OFFSET_VS_FREQ_I = 957,
-	NV_C1_PCS_LNA_3_OFFSET_I = 958,
-	NV_C1_PCS_LNA_3_OFFSET_VS_FREQ_I = 959,
-	NV_C1_CDMA_LNA_4_OFFSET_I = 960,
-	NV_C1_CDMA_LNA_4_OFFSET_VS_FREQ_I = 961,
-	NV_C1_PCS_LNA_4_OFFSET_I = 962,
-	NV_C1_PCS_LNA_4_OFFSET_VS_FREQ_I = 963,
-	NV_C1_CDMA_P1_RISE_FALL_OFFSET_I = 964,
-	NV_C1_PCS_P1_RISE_FALL_OFFSET_I = 965,
-	NV_C1_RX_AGC_VALUE_1_MINMAX_I = 966,
-	NV_C1_RX_AGC_VALUE_2_MINMAX_I = 967,
-	NV_C1_RX_AGC_VALUE_3_MINMAX_I = 968,
-	NV_C1_RX_AGC_VALUE_4_MINMAX_I = 969,
-	NV_C0_RX_AGC_VREF_VAL_I = 970,
-	NV_C1_RX_AGC_VREF_VAL_I = 971,
-	NV_C0_GRP_DELAY_ADJ_I = 972,
-	NV_C1_GRP_DELAY_ADJ_I = 973,
-	NV_C1_CDMA_VGA_GAIN_OFFSET_I = 974,
-	NV_C1_CDMA_VGA_GAIN_OFFSET_VS_FREQ_I = 975,
-	NV_C1_CDMA_VGA_GAIN_OFFSET_VS_TEMP_I = 976,
-	NV_C1_PCS_VGA_GAIN_OFFSET_I = 977,
-	NV_C1_PCS_VGA_GAIN_OFFSET_VS_FREQ_I = 978,
-	NV_C1_PCS_VGA_GAIN_OFFSET_VS_TEMP_I = 979,
-	NV_C1_DIGITAL_MIS_COMP_A_OFFSET_I = 980,
-	NV_C1_GPS_MIS_COMP_A_OFFSET_I = 981,
-	NV_C1_DIGITAL_MIS_COMP_B_OFFSET_I = 982,
-	NV_C1_GPS_MIS_COMP_B_OFFSET_I = 983,
-	NV_C1_CDMA_DACC_IACCUM0_I = 984,
-	NV_C1_PCS_DACC_IACCUM0_I = 985,
-	NV_C1_GPS_DACC_IACCUM0_I = 986,
-	NV_C1_CDMA_DACC_IACCUM1_I = 987,
-	NV_C1_PCS_DACC_IACCUM1_I = 988,
-	NV_C1_GPS_DACC_IACCUM1_I = 989,
-	NV_C1_CDMA_DACC_IACCUM2_I = 990,
-	NV_C1_PCS_DACC_IACCUM2_I = 991,
-	NV_C1_GPS_DACC_IACCUM2_I = 992,
-	NV_C1_CDMA_DACC_IACCUM3_I = 993,
-	NV_C1_PCS_DACC_IACCUM3_I = 994,
-	NV_C1_GPS_DACC_IACCUM3_I = 995,
-	NV_C1_CDMA_DACC_IACCUM4_I = 996,
-	NV_C1_PCS_DACC_IACCUM4_I = 997,
-	NV_C1_GPS_DACC_IACCUM4_I = 998,
-	NV_C1_CDMA_DACC_QACCUM0_I = 999,
-	NV_C1_PCS_DACC_QACCUM0_I = 1000,
-	NV_C1_GPS_DACC_QACCUM0_I = 1001,
-	NV_C1_CDMA_DACC_QACCUM1_I = 1002,
-	NV_C1_PCS_DACC_QACCUM1_I = 1003,
-	NV_C1_GPS_DACC_QACCUM1_I = 1004,
-	NV_C1_CDMA_DACC_QACCUM2_I = 1005,
-	NV_C1_PCS_DACC_QACCUM2_I = 1006,
-	NV_C1_GPS_DACC_QACCUM2_I = 1007,
-	NV_C1_CDMA_DACC_QACCUM3_I = 1008,
-	NV_C1_PCS_DACC_QACCUM3_I = 1009,
-	NV_C1_GPS_DACC_QACCUM3_I = 1010,
-	NV_C1_CDMA_DACC_QACCUM4_I = 1011,
-	NV_C1_PCS_DACC_QACCUM4_I = 1012,
-	NV_C1_GPS_DACC_QACCUM4_I = 1013,
-	NV_SMS_GW_CB_SERVICE_TABLE_I = 1014,
-	NV_SMS_GW_CB_SERVICE_TABLE_SIZE_I = 1015,
-	NV_SMS_GW_CB_CONFIG_I = 1016,
-	NV_SMS_GW_CB_USER_PREF_I = 1017,
-	NV_CDMA_RX_DIVERSITY_CTRL_I = 1018,
-	NV_LONG_PDPACT_TOLERANCE_FOR_TE_I = 1019,
-	NV_C1_CDMA_IM2_Q_VALUE_I = 1020,
-	NV_C1_PCS_IM2_Q_VALUE_I = 1021,
-	NV_C1_CDMA_IM2_I_VALUE_I = 1022,
-	NV_C1_PCS_IM2_I_VALUE_I = 1023,
-	NV_C1_CDMA_IM2_TRANSCONDUCTOR_VALUE_I = 1024,
-	NV_C1_PCS_IM2_TRANSCONDUCTOR_VALUE_I = 1025,
-	NV_C1_VCO_COARSE_TUNE_TABLE_I = 1026,
-	NV_MDSP_MEM_DUMP_ENABLED_I = 1027,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_14_I = 1028,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_15_I = 1029,
-	NV_FORCE_UE_SGSNR_R99_I = 1030,
-	NV_FORCE_UE_MSCR_R99_I = 1031,
-	NV_GPS_RF_CONFIG_I = 1032,
-	NV_C1_CDMA_LNA_1_RISE_I = 1033,
-	NV_C1_CDMA_LNA_2_RISE_I = 1034,
-	NV_C1_CDMA_LNA_3_RISE_I = 1035,
-	NV_C1_CDMA_LNA_4_RISE_I = 1036,
-	NV_C1_PCS_LNA_1_RISE_I = 1037,
-	NV_C1_PCS_LNA_2_RISE_I = 1038,
-	NV_C1_PCS_LNA_3_RISE_I = 1039,
-	NV_C1_PCS_LNA_4_RISE_I = 1040,
-	NV_C1_CDMA_LNA_1_FALL_I = 1041,
-	NV_C1_CDMA_LNA_2_FALL_I = 1042,
-	NV_C1_CDMA_LNA_3_FALL_I = 1043,
-	NV_C1_CDMA_LNA_4_FALL_I = 1044,
-	NV_C1_PCS_LNA_1_FALL_I = 1045,
-	NV_C1_PCS_LNA_2_FALL_I = 1046,
-	NV_C1_PCS_LNA_3_FALL_I = 1047,
-	NV_C1_PCS_LNA_4_FALL_I = 1048,
-	NV_C1_CDMA_IM_LEVEL1_I = 1049,
-	NV_C1_CDMA_IM_LEVEL2_I = 1050,
-	NV_C1_CDMA_IM_LEVEL3_I = 1051,
-	NV_C1_CDMA_IM_LEVEL4_I = 1052,
-	NV_C1_PCS_IM_LEVEL1_I = 1053,
-	NV_C1_PCS_IM_LEVEL2_I = 1054,
-	NV_C1_PCS_IM_LEVEL3_I = 1055,
-	NV_C1_PCS_IM_LEVEL4_I = 1056,
-	NV_GSM_1900_CAL_ARFCN_I = 1057,
-	NV_GSM_1900_RX_GAIN_RANGE_1_FREQ_COMP_I = 1058,
-	NV_GSM_1900_RX_GAIN_RANGE_2_FREQ_COMP_I = 1059,
-	NV_GSM_1900_RX_GAIN_RANGE_3_FREQ_COMP_I = 1060,
-	NV_GSM_1900_RX_GAIN_RANGE_4_FREQ_COMP_I = 1061,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_00_I = 1062,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_01_I = 1063,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_02_I = 1064,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_03_I = 1065,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_04_I = 1066,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_05_I = 1067,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_06_I = 1068,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_07_I = 1069,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_08_I = 1070,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_09_I = 1071,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_10_I = 1072,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_11_I = 1073,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_12_I = 1074,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_13_I = 1075,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_14_I = 1076,
-	NV_GSM_1900_TX_BURST_RAMP_UP_INDEX_15_I = 1077,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_00_I = 1078,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_01_I = 1079,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_02_I = 1080,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_03_I = 1081,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_04_I = 1082,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_05_I = 1083,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_06_I = 1084,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_07_I = 1085,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_08_I = 1086,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_09_I = 1087,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_10_I = 1088,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_11_I = 1089,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_12_I = 1090,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_13_I = 1091,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_14_I = 1092,
-	NV_GSM_1900_TX_BURST_RAMP_DOWN_INDEX_15_I = 1093,
-	NV_GSM_1900_PA_GAIN_SLOPE_I = 1094,
-	NV_GSM_1900_TX_FREQ_COMP_I = 1095,
-	NV_GSM_1900_VBATT_HI_PA_COMP_I = 1096,
-	NV_GSM_1900_VBATT_LO_PA_COMP_I = 1097,
-	NV_GSM_1900_PA_START_TIME_OFFSET_I = 1098,
-	NV_GSM_1900_PA_STOP_TIME_OFFSET_I = 1099,
-	NV_GSM_1900_GAINRANGE_SWITCHPOINTS_I = 1100,
-	NV_GSM_850_CAL_ARFCN_I = 1101,
-	NV_GSM_850_RX_GAIN_RANGE_1_FREQ_COMP_I = 1102,
-	NV_GSM_850_RX_GAIN_RANGE_2_FREQ_COMP_I = 1103,
-	NV_GSM_850_RX_GAIN_RANGE_3_FREQ_COMP_I = 1104,
-	NV_GSM_850_RX_GAIN_RANGE_4_FREQ_COMP_I = 1105,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_00_I = 1106,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_01_I = 1107,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_02_I = 1108,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_03_I = 1109,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_04_I = 1110,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_05_I = 1111,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_06_I = 1112,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_07_I = 1113,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_08_I = 1114,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_09_I = 1115,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_10_I = 1116,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_11_I = 1117,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_12_I = 1118,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_13_I = 1119,
-	NV_GSM_850_TX_BURST_RAMP_UP_INDEX_14_I = 1120,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_00_I = 1121,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_01_I = 1122,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_02_I = 1123,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_03_I = 1124,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_04_I = 1125,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_05_I = 1126,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_06_I = 1127,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_07_I = 1128,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_08_I = 1129,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_09_I = 1130,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_10_I = 1131,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_11_I = 1132,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_12_I = 1133,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_13_I = 1134,
-	NV_GSM_850_TX_BURST_RAMP_DOWN_INDEX_14_I = 1135,
-	NV_GSM_850_PA_GAIN_SLOPE_I = 1136,
-	NV_GSM_850_TX_FREQ_COMP_I = 1137,
-	NV_GSM_850_VBATT_HI_PA_COMP_I = 1138,
-	NV_GSM_850_VBATT_LO_PA_COMP_I = 1139,
-	NV_GSM_850_PA_START_TIME_OFFSET_I = 1140,
-	NV_GSM_850_PA_STOP_TIME_OFFSET_I = 1141,
-	NV_GSM_850_GAINRANGE_SWITCHPOINTS_I = 1142,
-	NV_WCDMA_1900_VGA_GAIN_OFFSET_I = 1143,
-	NV_WCDMA_1900_VGA_GAIN_OFFSET_VS_FREQ_I = 1144,
-	NV_WCDMA_1900_VGA_GAIN_OFFSET_VS_TEMP_I = 1145,
-	NV_WCDMA_1900_LNA_RANGE_RISE_2_I = 1146,
-	NV_WCDMA_1900_LNA_RANGE_RISE_3_I = 1147,
-	NV_WCDMA_1900_LNA_RANGE_FALL_2_I = 1148,
-	NV_WCDMA_1900_LNA_RANGE_FALL_3_I = 1149,
-	NV_WCDMA_1900_IM_LEVEL_2_I = 1150,
-	NV_WCDMA_1900_IM_LEVEL_3_I = 1151,
-	NV_WCDMA_1900_LNA_RANGE_OFFSET_2_I = 1152,
-	NV_WCDMA_1900_LNA_RANGE_OFFSET_3_I = 1153,
-	NV_WCDMA_1900_LNA_OFFSET_VS_FREQ_2_I = 1154,
-	NV_WCDMA_1900_LNA_OFFSET_VS_FREQ_3_I = 1155,
-	NV_WCDMA_1900_IM2_I_VALUE_I = 1156,
-	NV_WCDMA_1900_IM2_Q_VALUE_I = 1157,
-	NV_WCDMA_1900_IM2_TRANSCONDUCTOR_VALUE_I = 1158,
-	NV_WCDMA_1900_RX_AGC_MIN_2_I = 1159,
-	NV_WCDMA_1900_RX_AGC_MIN_3_I = 1160,
-	NV_WCDMA_1900_MAX_TX_POWER_I = 1161,
-	NV_WCDMA_1900_OUT_OF_SERVICE_THRESH_I = 1162,
-	NV_WCDMA_1900_LNA_RANGE_RISE_I = 1163,
-	NV_WCDMA_1900_LNA_RANGE_FALL_I = 1164,
-	NV_WCDMA_1900_IM_LEVEL_I = 1165,
-	NV_WCDMA_1900_NONBYPASS_TIMER_I = 1166,
-	NV_WCDMA_1900_BYPASS_TIMER_I = 1167,
-	NV_WCDMA_1900_LNA_RANGE_OFFSET_I = 1168,
-	NV_WCDMA_1900_LNA_OFFSET_VS_FREQ_I = 1169,
-	NV_WCDMA_1900_RX_AGC_MIN_I = 1170,
-	NV_WCDMA_1900_RX_AGC_MAX_I = 1171,
-	NV_WCDMA_1900_AGC_PHASE_OFFSET_I = 1172,
-	NV_WCDMA_1900_TX_LIN_MASTER_0_I = 1173,
-	NV_WCDMA_1900_TX_LIN_MASTER_1_I = 1174,
-	NV_WCDMA_1900_TX_COMP_VS_FREQ_0_I = 1175,
-	NV_WCDMA_1900_TX_COMP_VS_FREQ_1_I = 1176,
-	NV_WCDMA_1900_TX_LIN_VS_TEMP_0_I = 1177,
-	NV_WCDMA_1900_TX_LIN_VS_TEMP_1_I = 1178,
-	NV_WCDMA_1900_TX_SLP_VS_TEMP_0_I = 1179,
-	NV_WCDMA_1900_TX_SLP_VS_TEMP_1_I = 1180,
-	NV_WCDMA_1900_R1_RISE_I = 1181,
-	NV_WCDMA_1900_R1_FALL_I = 1182,
-	NV_WCDMA_1900_TX_LIM_VS_TEMP_I = 1183,
-	NV_WCDMA_1900_TX_LIM_VS_FREQ_I = 1184,
-	NV_WCDMA_1900_ADJ_FACTOR_I = 1185,
-	NV_WCDMA_1900_EXP_HDET_VS_AGC_I = 1186,
-	NV_WCDMA_1900_HDET_OFF_I = 1187,
-	NV_WCDMA_1900_HDET_SPN_I = 1188,
-	NV_WCDMA_1900_ENC_BTF_I = 1189,
-	NV_RPLMNACT_I = 1190,
-	NV_PS_DATA_ORIG_PREF_I = 1191,
-	NV_HDR_AN_AUTH_PASSWD_LONG_I = 1192,
-	NV_DS_MIP_QC_HANDDOWN_TO_1X_OPT_I = 1193,
-	NV_HDR_AN_AUTH_USER_ID_LONG_I = 1194,
-	NV_PCS_LNA_BYPASS_TIMER_0_I = 1195,
-	NV_WCDMA_AGC_PA_ON_RISE_DELAY_I = 1196,
-	NV_WCDMA_AGC_PA_ON_FALL_DELAY_I = 1197,
-	NV_WCDMA_AGC_TX_ON_RISE_DELAY_I = 1198,
-	NV_WCDMA_AGC_TX_ON_FALL_DELAY_I = 1199,
-	NV_WCDMA_AGC_UPDATE_TX_AGC_TIME_I = 1200,
-	NV_WCDMA_1900_AGC_PA_ON_RISE_DELAY_I = 1201,
-	NV_WCDMA_1900_AGC_PA_ON_FALL_DELAY_I = 1202,
-	NV_WCDMA_1900_AGC_TX_ON_RISE_DELAY_I = 1203,
-	NV_WCDMA_1900_AGC_TX_ON_FALL_DELAY_I = 1204,
-	NV_WCDMA_1900_AGC_UPDATE_TX_AGC_TIME_I = 1205,
-	NV_PPP_CONFIG_DATA_I = 1206,
-	NV_CELL_1X_OLTA_BACKOFF_I = 1207,
-	NV_CELL_HDR_OLTA_BACKOFF_I = 1208,
-	NV_PCS_OLTA_BACKOFF_I = 1209,
-	NV_BC6_TX_LIM_VS_TEMP_I = 1210,
-	NV_C0_BC6_RX_CAL_CHAN_I = 1211,
-	NV_BC6_TX_LIN_MASTER0_I = 1212,
-	NV_BC6_TX_LIN_MASTER1_I = 1213,
-	NV_BC6_TX_COMP0_I = 1214,
-	NV_BC6_TX_COMP1_I = 1215,
-	NV_BC6_TX_LIM_VS_FREQ_I = 1216,
-	NV_BC6_EXP_HDET_VS_AGC_I = 1217,
-	NV_BC6_HDET_OFF_I = 1218,
-	NV_BC6_HDET_SPN_I = 1219,
-	NV_BC6_PA_R1_RISE_I = 1220,
-	NV_BC6_PA_R1_FALL_I = 1221,
-	NV_BC6_LNA_RANGE_POL_I = 1222,
-	NV_BC6_LNA_1_RISE_I = 1223,
-	NV_BC6_LNA_1_FALL_I = 1224,
-	NV_C0_BC6_LNA_RANGE_OFFSET_I = 1225,
-	NV_C1_BC6_LNA_RANGE_OFFSET_I = 1226,
-	NV_BC6_LNA_2_RISE_I = 1227,
-	NV_BC6_LNA_2_FALL_I = 1228,
-	NV_BC6_LNA_RANGE_12_OFFSET_I = 1229,
-	NV_C0_BC6_IM_LEVEL1_I = 1230,
-	NV_C0_BC6_IM_LEVEL2_I = 1231,
-	NV_C0_BC6_IM_LEVEL3_I = 1232,
-	NV_C0_BC6_IM_LEVEL4_I = 1233,
-	NV_C0_BC6_LNA_1_OFFSET_VS_FREQ_I = 1234,
-	NV_C1_BC6_LNA_1_OFFSET_VS_FREQ_I = 1235,
-	NV_BC6_AGC_PHASE_OFFSET_I = 1236,
-	NV_BC6_ADJ_FACTOR_I = 1237,
-	NV_BC6_RX_AGC_MINMAX_I = 1238,
-	NV_BC6_RX_AGC_MIN_11_I = 1239,
-	NV_BC6_ENC_BTF_I = 1240,
-	NV_BC6_TX_GAIN_ATTEN_LIMIT_I = 1241,
-	NV_BC6_LNA_3_FALL_I = 1242,
-	NV_BC6_LNA_3_RISE_I = 1243,
-	NV_BC6_LNA_3_OFFSET_I = 1244,
-	NV_C0_BC6_LNA_3_OFFSET_VS_FREQ_I = 1245,
-	NV_C1_BC6_LNA_3_OFFSET_VS_FREQ_I = 1246,
-	NV_BC6_LNA_4_FALL_I = 1247,
-	NV_BC6_LNA_4_RISE_I = 1248,
-	NV_C0_BC6_LNA_4_OFFSET_I = 1249,
-	NV_C1_BC6_LNA_4_OFFSET_I = 1250,
-	NV_C0_BC6_IM2_I_VALUE_I = 1251,
-	NV_C1_BC6_IM2_I_VALUE_I = 1252,
-	NV_C0_BC6_IM2_Q_VALUE_I = 1253,
-	NV_C1_BC6_IM2_Q_VALUE_I = 1254,
-	NV_C0_BC6_VGA_GAIN_OFFSET_I = 1255,
-	NV_C1_BC6_VGA_GAIN_OFFSET_I = 1256,
-	NV_C0_BC6_VGA_GAIN_OFFSET_VS_FREQ_I = 1257,
-	NV_C1_BC6_VGA_GAIN_OFFSET_VS_FREQ_I = 1258,
-	NV_C0_BC6_VGA_GAIN_OFFSET_VS_TEMP_I = 1259,
-	NV_C1_BC6_VGA_GAIN_OFFSET_VS_TEMP_I = 1260,
-	NV_BC6_P1_RISE_FALL_OFF_I = 1261,
-	NV_C0_BC6_LNA_4_OFFSET_VS_FREQ_I = 1262,
-	NV_C1_BC6_LNA_4_OFFSET_VS_FREQ_I = 1263,
-	NV_C0_BC6_P1_RISE_FALL_OFFSET_I = 1264,
-	NV_C1_BC6_P1_RISE_FALL_OFFSET_I = 1265,
-	NV_C0_BC6_DIGITAL_MIS_COMP_A_OFFSET_I = 1266,
-	NV_C1_BC6_DIGITAL_MIS_COMP_A_OFFSET_I = 1267,
-	NV_C0_BC6_DIGITAL_MIS_COMP_B_OFFSET_I = 1268,
-	NV_C1_BC6_DIGITAL_MIS_COMP_B_OFFSET_I = 1269,
-	NV_C0_BC6_IM2_TRANSCONDUCTOR_VALUE_I = 1270,
-	NV_C1_BC6_IM2_TRANSCONDUCTOR_VALUE_I = 1271,
-	NV_BC6_VCO_COARSE_TUNE_TABLE_I = 1272,
-	NV_GSM_PA_TEMP_COMP_INDEX_00_I = 1273,
-	NV_GSM_PA_TEMP_COMP_INDEX_01_I = 1274,
-	NV_GSM_PA_TEMP_COMP_INDEX_02_I = 1275,
-	NV_GSM_PA_TEMP_COMP_INDEX_03_I = 1276,
-	NV_GSM_PA_TEMP_COMP_INDEX_04_I = 1277,
-	NV_GSM_PA_TEMP_COMP_INDEX_05_I = 1278,
-	NV_GSM_PA_TEMP_COMP_INDEX_06_I = 1279,
-	NV_GSM_PA_TEMP_COMP_INDEX_07_I = 1280,
-	NV_GSM_PA_TEMP_COMP_INDEX_08_I = 1281,
-	NV_GSM_PA_TEMP_COMP_INDEX_09_I = 1282,
-	NV_GSM_PA_TEMP_COMP_INDEX_10_I = 1283,
-	NV_GSM_PA_TEMP_COMP_INDEX_11_I = 1284,
-	NV_GSM_PA_TEMP_COMP_INDEX_12_I = 1285,
-	NV_GSM_PA_TEMP_COMP_INDEX_13_I = 1286,
-	NV_DCS_PA_TEMP_COMP_INDEX_00_I = 1287,
-	NV_DCS_PA_TEMP_COMP_INDEX_01_I = 1288,
-	NV_DCS_PA_TEMP_COMP_INDEX_02_I = 1289,
-	NV_DCS_PA_TEMP_COMP_INDEX_03_I = 1290,
-	NV_DCS_PA_TEMP_COMP_INDEX_04_I = 1291,
-	NV_DCS_PA_TEMP_COMP_INDEX_05_I = 1292,
-	NV_DCS_PA_TEMP_COMP_INDEX_06_I = 1293,
-	NV_DCS_PA_TEMP_COMP_INDEX_07_I = 1294,
-	NV_DCS_PA_TEMP_COMP_INDEX_08_I = 1295,
-	NV_DCS_PA_TEMP_COMP_INDEX_09_I = 1296,
-	NV_DCS_PA_TEMP_COMP_INDEX_10_I = 1297,
-	NV_DCS_PA_TEMP_COMP_INDEX_11_I = 1298,
-	NV_DCS_PA_TEMP_COMP_INDEX_12_I = 1299,
-	NV_DCS_PA_TEMP_COMP_INDEX_13_I = 1300,
-	NV_DCS_PA_TEMP_COMP_INDEX_14_I = 1301,
-	NV_GSM_AMR_CALL_CONFIG_I = 1302,
-	NV_GSM_PA_TEMP_COMP_INT8_INDEX_14_I = 1303,
-	NV_DCS_PA_TEMP_COMP_INT8_INDEX_15_I = 1304,
-	NV_GMM_PTMSI_SIG_TOBE_DELETED_I = 1305,
-	NV_C0_BC6_TX_CAL_CHAN_I = 1306,
-	NV_CDMA_TX_CAL_CHAN_I = 1307,
-	NV_CDMA_RX_CAL_CHAN_I = 1308,
-	NV_PCS_RX_CAL_CHAN_I = 1309,
-	NV_PCS_TX_CAL_CHAN_I = 1310,
-	NV_SEC_DEVICE_KEY_I = 1311,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_00_I = 1312,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_01_I = 1313,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_02_I = 1314,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_03_I = 1315,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_04_I = 1316,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_05_I = 1317,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_06_I = 1318,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_07_I = 1319,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_08_I = 1320,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_09_I = 1321,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_10_I = 1322,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_11_I = 1323,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_12_I = 1324,
-	NV_GSM_850_PA_TEMP_COMP_INDEX_13_I = 1325,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_00_I = 1326,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_01_I = 1327,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_02_I = 1328,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_03_I = 1329,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_04_I = 1330,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_05_I = 1331,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_06_I = 1332,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_07_I = 1333,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_08_I = 1334,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_09_I = 1335,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_10_I = 1336,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_11_I = 1337,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_12_I = 1338,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_13_I = 1339,
-	NV_GSM_1900_PA_TEMP_COMP_INDEX_14_I = 1340,
-	NV_TCP_GRACEFUL_DORMANT_CLOSE_I = 1341,
-	NV_INTERFREQ_ENABLED_I = 1342,
-	NV_EPLMN_ENABLED_I = 1343,
-	NV_DTMF_I = 1344,
-	NV_TRK_LO_ADJ_DEFAULT_I = 1345,
-	NV_TRK_LO_ADJ_SLOPE_DEFAULT_I = 1346,
-	NV_WCDMA_PA_GAIN_UP_TIME_I = 1347,
-	NV_WCDMA_PA_GAIN_DOWN_TIME_I = 1348,
-	NV_BC6_GPS1_RF_DELAY_I = 1349,
-	NV_BC6_RF_TUNE_RESERVED_I = 1350,
-	NV_BC6_TX_LIN_MASTER2_I = 1351,
-	NV_BC6_TX_LIN_MASTER3_I = 1352,
-	NV_BC6_TX_COMP2_I = 1353,
-	NV_BC6_TX_COMP3_I = 1354,
-	NV_BC6_PA_R2_RISE_I = 1355,
-	NV_BC6_PA_R2_FALL_I = 1356,
-	NV_BC6_PA_R3_RISE_I = 1357,
-	NV_BC6_PA_R3_FALL_I = 1358,
-	NV_C0_BC6_LNA_2_OFFSET_VS_FREQ_I = 1359,
-	NV_C0_BC6_LNA_1_OFFSET_I = 1360,
-	NV_C0_BC6_LNA_2_OFFSET_I = 1361,
-	NV_C0_BC6_LNA_3_OFFSET_I = 1362,
-	NV_C0_BC6_LNA_1_RISE_I = 1363,
-	NV_C0_BC6_LNA_1_FALL_I = 1364,
-	NV_C0_BC6_LNA_2_RISE_I = 1365,
-	NV_C0_BC6_LNA_2_FALL_I = 1366,
-	NV_C0_BC6_LNA_3_RISE_I = 1367,
-	NV_C0_BC6_LNA_3_FALL_I = 1368,
-	NV_C0_BC6_LNA_4_RISE_I = 1369,
-	NV_C0_BC6_LNA_4_FALL_I = 1370,
-	NV_C1_BC6_TX_CAL_CHAN_I = 1371,
-	NV_C1_BC6_RX_CAL_CHAN_I = 1372,
-	NV_C1_BC6_LNA_2_OFFSET_VS_FREQ_I = 1373,
-	NV_C1_BC6_LNA_1_OFFSET_I = 1374,
-	NV_C1_BC6_LNA_2_OFFSET_I = 1375,
-	NV_C1_BC6_LNA_3_OFFSET_I = 1376,
-	NV_C1_BC6_LNA_1_RISE_I = 1377,
-	NV_C1_BC6_LNA_1_FALL_I = 1378,
-	NV_C1_BC6_LNA_2_RISE_I = 1379,
-	NV_C1_BC6_LNA_2_FALL_I = 1380,
-	NV_C1_BC6_LNA_3_RISE_I = 1381,
-	NV_C1_BC6_LNA_3_FALL_I = 1382,
-	NV_C1_BC6_LNA_4_RISE_I = 1383,
-	NV_C1_BC6_LNA_4_FALL_I = 1384,
-	NV_C1_BC6_IM_LEVEL1_I = 1385,
-	NV_C1_BC6_IM_LEVEL2_I = 1386,
-	NV_C1_BC6_IM_LEVEL3_I = 1387,
-	NV_C1_BC6_IM_LEVEL4_I = 1388,
-	NV_BC5_GPS1_RF_DELAY_I = 1389,
-	NV_BC5_RF_TUNE_RESERVED_I = 1390,
-	NV_BC5_TX_LIM_VS_TEMP_I = 1391,
-	NV_BC5_TX_LIN_MASTER0_I = 1392,
-	NV_BC5_TX_LIN_MASTER1_I = 1393,
-	NV_BC5_TX_LIN_MASTER2_I = 1394,
-	NV_BC5_TX_LIN_MASTER3_I = 1395,
-	NV_BC5_TX_COMP0_I = 1396,
-	NV_BC5_TX_COMP1_I = 1397,
-	NV_BC5_TX_COMP2_I = 1398,
-	NV_BC5_TX_COMP3_I = 1399,
-	NV_BC5_TX_LIM_VS_FREQ_I = 1400,
-	NV_BC5_PA_R1_RISE_I = 1401,
-	NV_BC5_PA_R1_FALL_I = 1402,
-	NV_BC5_PA_R2_RISE_I = 1403,
-	NV_BC5_PA_R2_FALL_I = 1404,
-	NV_BC5_PA_R3_RISE_I = 1405,
-	NV_BC5_PA_R3_FALL_I = 1406,
-	NV_BC5_HDET_OFF_I = 1407,
-	NV_BC5_HDET_SPN_I = 1408,
-	NV_BC5_EXP_HDET_VS_AGC_I = 1409,
-	NV_BC5_ENC_BTF_I = 1410,
-	NV_BC5_VCO_COARSE_TUNE_TABLE_I = 1411,
-	NV_BC5_P1_RISE_FALL_OFF_I = 1412,
-	NV_C0_BC5_TX_CAL_CHAN_I = 1413,
-	NV_C0_BC5_RX_CAL_CHAN_I = 1414,
-	NV_C0_BC5_LNA_1_OFFSET_VS_FREQ_I = 1415,
-	NV_C0_BC5_LNA_2_OFFSET_VS_FREQ_I = 1416,
-	NV_C0_BC5_LNA_3_OFFSET_VS_FREQ_I = 1417,
-	NV_C0_BC5_LNA_4_OFFSET_VS_FREQ_I = 1418,
-	NV_C0_BC5_LNA_1_OFFSET_I = 1419,
-	NV_C0_BC5_LNA_2_OFFSET_I = 1420,
-	NV_C0_BC5_LNA_3_OFFSET_I = 1421,
-	NV_C0_BC5_LNA_4_OFFSET_I = 1422,
-	NV_C0_BC5_IM2_I_VALUE_I = 1423,
-	NV_C0_BC5_IM2_Q_VALUE_I = 1424,
-	NV_C0_BC5_VGA_GAIN_OFFSET_I = 1425,
-	NV_C0_BC5_VGA_GAIN_OFFSET_VS_FREQ_I = 1426,
-	NV_C0_BC5_IM2_TRANSCONDUCTOR_VALUE_I = 1427,
-	NV_C0_BC5_LNA_1_RISE_I = 1428,
-	NV_C0_BC5_LNA_1_FALL_I = 1429,
-	NV_C0_BC5_LNA_2_RISE_I = 1430,
-	NV_C0_BC5_LNA_2_FALL_I = 1431,
-	NV_C0_BC5_LNA_3_RISE_I = 1432,
-	NV_C0_BC5_LNA_3_FALL_I = 1433,
-	NV_C0_BC5_LNA_4_RISE_I = 1434,
-	NV_C0_BC5_LNA_4_FALL_I = 1435,
-	NV_C0_BC5_IM_LEVEL1_I = 1436,
-	NV_C0_BC5_IM_LEVEL2_I = 1437,
-	NV_C0_BC5_IM_LEVEL3_I = 1438,
-	NV_C0_BC5_IM_LEVEL4_I = 1439,
-	NV_C1_BC5_TX_CAL_CHAN_I = 1440,
-	NV_C1_BC5_RX_CAL_CHAN_I = 1441,
-	NV_C1_BC5_LNA_1_OFFSET_VS_FREQ_I = 1442,
-	NV_C1_BC5_LNA_2_OFFSET_VS_FREQ_I = 1443,
-	NV_C1_BC5_LNA_3_OFFSET_VS_FREQ_I = 1444,
-	NV_C1_BC5_LNA_4_OFFSET_VS_FREQ_I = 1445,
-	NV_C1_BC5_LNA_1_OFFSET_I = 1446,
-	NV_C1_BC5_LNA_2_OFFSET_I = 1447,
-	NV_C1_BC5_LNA_3_OFFSET_I = 1448,
-	NV_C1_BC5_LNA_4_OFFSET_I = 1449,
-	NV_C1_BC5_IM2_I_VALUE_I = 1450,
-	NV_C1_BC5_IM2_Q_VALUE_I = 1451,
-	NV_C1_BC5_VGA_GAIN_OFFSET_I = 1452,
-	NV_C1_BC5_VGA_GAIN_OFFSET_VS_FREQ_I = 1453,
-	NV_C1_BC5_IM2_TRANSCONDUCTOR_VALUE_I = 1454,
-	NV_C1_BC5_LNA_1_RISE_I = 1455,
-	NV_C1_BC5_LNA_1_FALL_I = 1456,
-	NV_C1_BC5_LNA_2_RISE_I = 1457,
-	NV_C1_BC5_LNA_2_FALL_I = 1458,
-	NV_C1_BC5_LNA_3_RISE_I = 1459,
-	NV_C1_BC5_LNA_3_FALL_I = 1460,
-	NV_C1_BC5_LNA_4_RISE_I = 1461,
-	NV_C1_BC5_LNA_4_FALL_I = 1462,
-	NV_C1_BC5_IM_LEVEL1_I = 1463,
-	NV_C1_BC5_IM_LEVEL2_I = 1464,
-	NV_C1_BC5_IM_LEVEL3_I = 1465,
-	NV_C1_BC5_IM_LEVEL4_I = 1466,
-	NV_BC4_GPS1_RF_DELAY_I = 1467,
-	NV_BC4_RF_TUNE_RESERVED_I = 1468,
-	NV_BC4_TX_LIM_VS_TEMP_I = 1469,
-	NV_BC4_TX_LIN_MASTER0_I = 1470,
-	NV_BC4_TX_LIN_MASTER1_I = 1471,
-	NV_BC4_TX_LIN_MASTER2_I = 1472,
-	NV_BC4_TX_LIN_MASTER3_I = 1473,
-	NV_BC4_TX_COMP0_I = 1474,
-	NV_BC4_TX_COMP1_I = 1475,
-	NV_BC4_TX_COMP2_I = 1476,
-	NV_BC4_TX_COMP3_I = 1477,
-	NV_BC4_TX_LIM_VS_FREQ_I = 1478,
-	NV_BC4_PA_R1_RISE_I = 1479,
-	NV_BC4_PA_R1_FALL_I = 1480,
-	NV_BC4_PA_R2_RISE_I = 1481,
-	NV_BC4_PA_R2_FALL_I = 1482,
-	NV_BC4_PA_R3_RISE_I = 1483,
-	NV_BC4_PA_R3_FALL_I = 1484,
-	NV_BC4_HDET_OFF_I = 1485,
-	NV_BC4_HDET_SPN_I = 1486,
-	NV_BC4_EXP_HDET_VS_AGC_I = 1487,
-	NV_BC4_ENC_BTF_I = 1488,
-	NV_BC4_VCO_COARSE_TUNE_TABLE_I = 1489,
-	NV_BC4_P1_RISE_FALL_OFF_I = 1490,
-	NV_C0_BC4_TX_CAL_CHAN_I = 1491,
-	NV_C0_BC4_RX_CAL_CHAN_I = 1492,
-	NV_C0_BC4_LNA_1_OFFSET_VS_FREQ_I = 1493,
-	NV_C0_BC4_LNA_2_OFFSET_VS_FREQ_I = 1494,
-	NV_C0_BC4_LNA_3_OFFSET_VS_FREQ_I = 1495,
-	NV_C0_BC4_LNA_4_OFFSET_VS_FREQ_I = 1496,
-	NV_C0_BC4_LNA_1_OFFSET_I = 1497,
-	NV_C0_BC4_LNA_2_OFFSET_I = 1498,
-	NV_C0_BC4_LNA_3_OFFSET_I = 1499,
-	NV_C0_BC4_LNA_4_OFFSET_I = 1500,
-	NV_C0_BC4_IM2_I_VALUE_I = 1501,
-	NV_C0_BC4_IM2_Q_VALUE_I = 1502,
-	NV_C0_BC4_VGA_GAIN_OFFSET_I = 1503,
-	NV_C0_BC4_VGA_GAIN_OFFSET_VS_FREQ_I = 1504,
-	NV_C0_BC4_IM2_TRANSCONDUCTOR_VALUE_I = 1505,
-	NV_C0_BC4_LNA_1_RISE_I = 1506,
-	NV_C0_BC4_LNA_1_FALL_I = 1507,
-	NV_C0_BC4_LNA_2_RISE_I = 1508,
-	NV_C0_BC4_LNA_2_FALL_I = 1509,
-	NV_C0_BC4_LNA_3_RISE_I = 1510,
-	NV_C0_BC4_LNA_3_FALL_I = 1511,
-	NV_C0_BC4_LNA_4_RISE_I = 1512,
-	NV_C0_BC4_LNA_4_FALL_I = 1513,
-	NV_C0_BC4_IM_LEVEL1_I = 1514,
-	NV_C0_BC4_IM_LEVEL2_I = 1515,
-	NV_C0_BC4_IM_LEVEL3_I = 1516,
-	NV_C0_BC4_IM_LEVEL4_I = 1517,
-	NV_C1_BC4_TX_CAL_CHAN_I = 1518,
-	NV_C1_BC4_RX_CAL_CHAN_I = 1519,
-	NV_C1_BC4_LNA_1_OFFSET_VS_FREQ_I = 1520,
-	NV_C1_BC4_LNA_2_OFFSET_VS_FREQ_I = 1521,
-	NV_C1_BC4_LNA_3_OFFSET_VS_FREQ_I = 1522,
-	NV_C1_BC4_LNA_4_OFFSET_VS_FREQ_I = 1523,
-	NV_C1_BC4_LNA_1_OFFSET_I = 1524,
-	NV_C1_BC4_LNA_2_OFFSET_I = 1525,
-	NV_C1_BC4_LNA_3_OFFSET_I = 1526,
-	NV_C1_BC4_LNA_4_OFFSET_I = 1527,
-	NV_C1_BC4_IM2_I_VALUE_I = 1528,
-	NV_C1_BC4_IM2_Q_VALUE_I = 1529,
-	NV_C1_BC4_VGA_GAIN_OFFSET_I = 1530,
-	NV_C1_BC4_VGA_GAIN_OFFSET_VS_FREQ_I = 1531,
-	NV_C1_BC4_IM2_TRANSCONDUCTOR_VALUE_I = 1532,
-	NV_C1_BC4_LNA_1_RISE_I = 1533,
-	NV_C1_BC4_LNA_1_FALL_I = 1534,
-	NV_C1_BC4_LNA_2_RISE_I = 1535,
-	NV_C1_BC4_LNA_2_FALL_I = 1536,
-	NV_C1_BC4_LNA_3_RISE_I = 1537,
-	NV_C1_BC4_LNA_3_FALL_I = 1538,
-	NV_C1_BC4_LNA_4_RISE_I = 1539,
-	NV_C1_BC4_LNA_4_FALL_I = 1540,
-	NV_C1_BC4_IM_LEVEL1_I = 1541,
-	NV_C1_BC4_IM_LEVEL2_I = 1542,
-	NV_C1_BC4_IM_LEVEL3_I = 1543,
-	NV_C1_BC4_IM_LEVEL4_I = 1544,
-	NV_BC3_GPS1_RF_DELAY_I = 1545,
-	NV_BC3_RF_TUNE_RESERVED_I = 1546,
-	NV_BC3_TX_LIM_VS_TEMP_I = 1547,
-	NV_BC3_TX_LIN_MASTER0_I = 1548,
-	NV_BC3_TX_LIN_MASTER1_I = 1549,
-	NV_BC3_TX_LIN_MASTER2_I = 1550,
-	NV_BC3_TX_LIN_MASTER3_I = 1551,
-	NV_BC3_TX_COMP0_I = 1552,
-	NV_BC3_TX_COMP1_I = 1553,
-	NV_BC3_TX_COMP2_I = 1554,
-	NV_BC3_TX_COMP3_I = 1555,
-	NV_BC3_TX_LIM_VS_FREQ_I = 1557,
-	NV_BC3_PA_R1_RISE_I = 1558,
-	NV_BC3_PA_R1_FALL_I = 1559,
-	NV_BC3_PA_R2_RISE_I = 1560,
-	NV_BC3_PA_R2_FALL_I = 1561,
-	NV_BC3_PA_R3_RISE_I = 1562,
-	NV_BC3_PA_R3_FALL_I = 1563,
-	NV_BC3_HDET_OFF_I = 1564,
-	NV_BC3_HDET_SPN_I = 1565,
-	NV_BC3_EXP_HDET_VS_AGC_I = 1566,
-	NV_BC3_ENC_BTF_I = 1567,
-	NV_BC3_VCO_COARSE_TUNE_TABLE_I = 1568,
-	NV_BC3_P1_RISE_FALL_OFF_I = 1569,
-	NV_C0_BC3_TX_CAL_CHAN_I = 1570,
-	NV_C0_BC3_RX_CAL_CHAN_I = 1571,
-	NV_C0_BC3_LNA_1_OFFSET_VS_FREQ_I = 1572,
-	NV_C0_BC3_LNA_2_OFFSET_VS_FREQ_I = 1573,
-	NV_C0_BC3_LNA_3_OFFSET_VS_FREQ_I = 1574,
-	NV_C0_BC3_LNA_4_OFFSET_VS_FREQ_I = 1575,
-	NV_C0_BC3_LNA_1_OFFSET_I = 1576,
-	NV_C0_BC3_LNA_2_OFFSET_I = 1577,
-	NV_C0_BC3_LNA_3_OFFSET_I = 1578,
-	NV_C0_BC3_LNA_4_OFFSET_I = 1579,
-	NV_C0_BC3_IM2_I_VALUE_I = 1580,
-	NV_C0_BC3_IM2_Q_VALUE_I = 1581,
-	NV_C0_BC3_VGA_GAIN_OFFSET_I = 1582,
-	NV_C0_BC3_VGA_GAIN_OFFSET_VS_FREQ_I = 1583,
-	NV_C0_BC3_IM2_TRANSCONDUCTOR_VALUE_I = 1584,
-	NV_C0_BC3_LNA_1_RISE_I = 1585,
-	NV_C0_BC3_LNA_1_FALL_I = 1586,
-	NV_C0_BC3_LNA_2_RISE_I = 1587,
-	NV_C0_BC3_LNA_2_FALL_I = 1588,
-	NV_C0_BC3_LNA_3_RISE_I = 1589,
-	NV_C0_BC3_LNA_3_FALL_I = 1590,
-	NV_C0_BC3_LNA_4_RISE_I = 1591,
-	NV_C0_BC3_LNA_4_FALL_I = 1592,
-	NV_C0_BC3_IM_LEVEL1_I = 1593,
-	NV_C0_BC3_IM_LEVEL2_I = 1594,
-	NV_C0_BC3_IM_LEVEL3_I = 1595,
-	NV_C0_BC3_IM_LEVEL4_I = 1596,
-	NV_C1_BC3_TX_CAL_CHAN_I = 1597,
-	NV_C1_BC3_RX_CAL_CHAN_I = 1598,
-	NV_C1_BC3_LNA_1_OFFSET_VS_FREQ_I = 1599,
-	NV_C1_BC3_LNA_2_OFFSET_VS_FREQ_I = 1600,
-	NV_C1_BC3_LNA_3_OFFSET_VS_FREQ_I = 1601,
-	NV_C1_BC3_LNA_4_OFFSET_VS_FREQ_I = 1602,
-	NV_C1_BC3_LNA_1_OFFSET_I = 1603,
-	NV_C1_BC3_LNA_2_OFFSET_I = 1604,
-	NV_C1_BC3_LNA_3_OFFSET_I = 1605,
-	NV_C1_BC3_LNA_4_OFFSET_I = 1606,
-	NV_C1_BC3_IM2_I_VALUE_I = 1607,
-	NV_C1_BC3_IM2_Q_VALUE_I = 1608,
-	NV_C1_BC3_VGA_GAIN_OFFSET_I = 1609,
-	NV_C1_BC3_VGA_GAIN_OFFSET_VS_FREQ_I = 1610,
-	NV_C1_BC3_IM2_TRANSCONDUCTOR_VALUE_I = 1611,
-	NV_C1_BC3_LNA_1_RISE_I = 1612,
-	NV_C1_BC3_LNA_1_FALL_I = 1613,
-	NV_C1_BC3_LNA_2_RISE_I = 1614,
-	NV_C1_BC3_LNA_2_FALL_I = 1615,
-	NV_C1_BC3_LNA_3_RISE_I = 1616,
-	NV_C1_BC3_LNA_3_FALL_I = 1617,
-	NV_C1_BC3_LNA_4_RISE_I = 1618,
-	NV_C1_BC3_LNA_4_FALL_I = 1619,
-	NV_C1_BC3_IM_LEVEL1_I = 1620,
-	NV_C1_BC3_IM_LEVEL2_I = 1621,
-	NV_C1_BC3_IM_LEVEL3_I = 1622,
-	NV_C1_BC3_IM_LEVEL4_I = 1623,
-	NV_BC1_GPS1_RF_DELAY_I = 1624,
-	NV_BC1_RF_TUNE_RESERVED_I = 1625,
-	NV_BC1_TX_LIM_VS_TEMP_I = 1626,
-	NV_BC1_TX_LIN_MASTER0_I = 1627,
-	NV_BC1_TX_LIN_MASTER1_I = 1628,
-	NV_BC1_TX_LIN_MASTER2_I = 1629,
-	NV_BC1_TX_LIN_MASTER3_I = 1630,
-	NV_BC1_TX_COMP0_I = 1631,
-	NV_BC1_TX_COMP1_I = 1632,
-	NV_BC1_TX_COMP2_I = 1633,
-	NV_BC1_TX_COMP3_I = 1634,
-	NV_BC1_TX_LIM_VS_FREQ_I = 1635,
-	NV_BC1_PA_R1_RISE_I = 1636,
-	NV_BC1_PA_R1_FALL_I = 1637,
-	NV_BC1_PA_R2_RISE_I = 1638,
-	NV_BC1_PA_R2_FALL_I = 1639,
-	NV_BC1_PA_R3_RISE_I = 1640,
-	NV_BC1_PA_R3_FALL_I = 1641,
-	NV_BC1_HDET_OFF_I = 1642,
-	NV_BC1_HDET_SPN_I = 1643,
-	NV_BC1_EXP_HDET_VS_AGC_I = 1644,
-	NV_BC1_ENC_BTF_I = 1645,
-	NV_BC1_VCO_COARSE_TUNE_TABLE_I = 1646,
-	NV_BC1_P1_RISE_FALL_OFF_I = 1647,
-	NV_C0_BC1_TX_CAL_CHAN_I = 1648,
-	NV_C0_BC1_RX_CAL_CHAN_I = 1649,
-	NV_C0_BC1_LNA_1_OFFSET_VS_FREQ_I = 1650,
-	NV_C0_BC1_LNA_2_OFFSET_VS_FREQ_I = 1651,
-	NV_C0_BC1_LNA_3_OFFSET_VS_FREQ_I = 1652,
-	NV_C0_BC1_LNA_4_OFFSET_VS_FREQ_I = 1653,
-	NV_C0_BC1_LNA_1_OFFSET_I = 1654,
-	NV_C0_BC1_LNA_2_OFFSET_I = 1655,
-	NV_C0_BC1_LNA_3_OFFSET_I = 1666,
-	NV_C0_BC1_LNA_4_OFFSET_I = 1667,
-	NV_C0_BC1_IM2_I_VALUE_I = 1668,
-	NV_C0_BC1_IM2_Q_VALUE_I = 1669,
-	NV_C0_BC1_VGA_GAIN_OFFSET_I = 1670,
-	NV_C0_BC1_VGA_GAIN_OFFSET_VS_FREQ_I = 1671,
-	NV_C0_BC1_IM2_TRANSCONDUCTOR_VALUE_I = 1672,
-	NV_C0_BC1_LNA_1_RISE_I = 1673,
-	NV_C0_BC1_LNA_1_FALL_I = 1674,
-	NV_C0_BC1_LNA_2_RISE_I = 1675,
-	NV_C0_BC1_LNA_2_FALL_I = 1676,
-	NV_C0_BC1_LNA_3_RISE_I = 1677,
-	NV_C0_BC1_LNA_3_FALL_I = 1678,
-	NV_C0_BC1_LNA_4_RISE_I = 1679,
-	NV_C0_BC1_LNA_4_FALL_I = 1680,
-	NV_C0_BC1_IM_LEVEL1_I = 1681,
-	NV_C0_BC1_IM_LEVEL2_I = 1682,
-	NV_C0_BC1_IM_LEVEL3_I = 1683,
-	NV_C0_BC1_IM_LEVEL4_I = 1684,
-	NV_C1_BC1_TX_CAL_CHAN_I = 1685,
-	NV_C1_BC1_RX_CAL_CHAN_I = 1686,
-	NV_C1_BC1_LNA_1_OFFSET_VS_FREQ_I = 1687,
-	NV_C1_BC1_LNA_2_OFFSET_VS_FREQ_I = 1689,
-	NV_C1_BC1_LNA_3_OFFSET_VS_FREQ_I = 1690,
-	NV_C1_BC1_LNA_4_OFFSET_VS_FREQ_I = 1691,
-	NV_C1_BC1_LNA_1_OFFSET_I = 1692,
-	NV_C1_BC1_LNA_2_OFFSET_I = 1693,
-	NV_C1_BC1_LNA_3_OFFSET_I = 1694,
-	NV_C1_BC1_LNA_4_OFFSET_I = 1695,
-	NV_C1_BC1_IM2_I_VALUE_I = 1696,
-	NV_C1_BC1_IM2_Q_VALUE_I = 1697,
-	NV_C1_BC1_VGA_GAIN_OFFSET_I = 1698,
-	NV_C1_BC1_VGA_GAIN_OFFSET_VS_FREQ_I = 1699,
-	NV_C1_BC1_IM2_TRANSCONDUCTOR_VALUE_I = 1700,
-	NV_C1_BC1_LNA_1_RISE_I = 1701,
-	NV_C1_BC1_LNA_1_FALL_I = 1702,
-	NV_C1_BC1_LNA_2_RISE_I = 1703,
-	NV_C1_BC1_LNA_2_FALL_I = 1704,
-	NV_C1_BC1_LNA_3_RISE_I = 1705,
-	NV_C1_BC1_LNA_3_FALL_I = 1706,
-	NV_C1_BC1_LNA_4_RISE_I = 1707,
-	NV_C1_BC1_LNA_4_FALL_I = 1708,
-	NV_C1_BC1_IM_LEVEL1_I = 1709,
-	NV_C1_BC1_IM_LEVEL2_I = 1710,
-	NV_C1_BC1_IM_LEVEL3_I = 1711,
-	NV_C1_BC1_IM_LEVEL4_I = 1712,
-	NV_BC0_GPS1_RF_DELAY_I = 1713,
-	NV_BC0_RF_TUNE_RESERVED_I = 1714,
-	NV_BC0_TX_LIM_VS_TEMP_I = 1715,
-	NV_BC0_TX_LIN_MASTER0_I = 1716,
-	NV_BC0_TX_LIN_MASTER1_I = 1717,
-	NV_BC0_TX_LIN_MASTER2_I = 1718,
-	NV_BC0_TX_LIN_MASTER3_I = 1719,
-	NV_BC0_TX_COMP0_I = 1720,
-	NV_BC0_TX_COMP1_I = 1721,
-	NV_BC0_TX_COMP2_I = 1722,
-	NV_BC0_TX_COMP3_I = 1723,
-	NV_BC0_TX_LIM_VS_FREQ_I = 1724,
-	NV_BC0_PA_R1_RISE_I = 1725,
-	NV_BC0_PA_R1_FALL_I = 1726,
-	NV_BC0_PA_R2_RISE_I = 1727,
-	NV_BC0_PA_R2_FALL_I = 1728,
-	NV_BC0_PA_R3_RISE_I = 1729,
-	NV_BC0_PA_R3_FALL_I = 1730,
-	NV_BC0_HDET_OFF_I = 1731,
-	NV_BC0_HDET_SPN_I = 1732,
-	NV_BC0_EXP_HDET_VS_AGC_I = 1733,
-	NV_BC0_ENC_BTF_I = 1734,
-	NV_BC0_VCO_COARSE_TUNE_TABLE_I = 1735,
-	NV_BC0_P1_RISE_FALL_OFF_I = 1736,
-	NV_C0_BC0_TX_CAL_CHAN_I = 1737,
-	NV_C0_BC0_RX_CAL_CHAN_I = 1738,
-	NV_C0_BC0_LNA_1_OFFSET_VS_FREQ_I = 1739,
-	NV_C0_BC0_LNA_2_OFFSET_VS_FREQ_I = 1740,
-	NV_C0_BC0_LNA_3_OFFSET_VS_FREQ_I = 1741,
-	NV_C0_BC0_LNA_4_OFFSET_VS_FREQ_I = 1742,
-	NV_C0_BC0_LNA_1_OFFSET_I = 1743,
-	NV_C0_BC0_LNA_2_OFFSET_I = 1744,
-	NV_C0_BC0_LNA_3_OFFSET_I = 1745,
-	NV_C0_BC0_LNA_4_OFFSET_I = 1746,
-	NV_C0_BC0_IM2_I_VALUE_I = 1747,
-	NV_C0_BC0_IM2_Q_VALUE_I = 1748,
-	NV_C0_BC0_VGA_GAIN_OFFSET_I = 1749,
-	NV_C0_BC0_VGA_GAIN_OFFSET_VS_FREQ_I = 1750,
-	NV_C0_BC0_IM2_TRANSCONDUCTOR_VALUE_I = 1751,
-	NV_C0_BC0_LNA_1_RISE_I = 1752,
-	NV_C0_BC0_LNA_1_FALL_I = 1753,
-	NV_C0_BC0_LNA_2_RISE_I = 1754,
-	NV_C0_BC0_LNA_2_FALL_I = 1755,
-	NV_C0_BC0_LNA_3_RISE_I = 1756,
-	NV_C0_BC0_LNA_3_FALL_I = 1757,
-	NV_C0_BC0_LNA_4_RISE_I = 1758,
-	NV_C0_BC0_LNA_4_FALL_I = 1759,
-	NV_C0_BC0_IM_LEVEL1_I = 1760,
-	NV_C0_BC0_IM_LEVEL2_I = 1761,
-	NV_C0_BC0_IM_LEVEL3_I = 1762,
-	NV_C0_BC0_IM_LEVEL4_I = 1763,
-	NV_C1_BC0_TX_CAL_CHAN_I = 1764,
-	NV_C1_BC0_RX_CAL_CHAN_I = 1765,
-	NV_C1_BC0_LNA_1_OFFSET_VS_FREQ_I = 1766,
-	NV_C1_BC0_LNA_2_OFFSET_VS_FREQ_I = 1767,
-	NV_C1_BC0_LNA_3_OFFSET_VS_FREQ_I = 1768,
-	NV_C1_BC0_LNA_4_OFFSET_VS_FREQ_I = 1769,
-	NV_C1_BC0_LNA_1_OFFSET_I = 1770,
-	NV_C1_BC0_LNA_2_OFFSET_I = 1771,
-	NV_C1_BC0_LNA_3_OFFSET_I = 1772,
-	NV_C1_BC0_LNA_4_OFFSET_I = 1773,
-	NV_C1_BC0_IM2_I_VALUE_I = 1774,
-	NV_C1_BC0_IM2_Q_VALUE_I = 1775,
-	NV_C1_BC0_VGA_GAIN_OFFSET_I = 1776,
-	NV_C1_BC0_VGA_GAIN_OFFSET_VS_FREQ_I = 1777,
-	NV_C1_BC0_IM2_TRANSCONDUCTOR_VALUE_I = 1778,
-	NV_C1_BC0_LNA_1_RISE_I = 1779,
-	NV_C1_BC0_LNA_1_FALL_I = 1780,
-	NV_C1_BC0_LNA_2_RISE_I = 1781,
-	NV_C1_BC0_LNA_2_FALL_I = 1782,
-	NV_C1_BC0_LNA_3_RISE_I = 1783,
-	NV_C1_BC0_LNA_3_FALL_I = 1784,
-	NV_C1_BC0_LNA_4_RISE_I = 1785,
-	NV_C1_BC0_LNA_4_FALL_I = 1786,
-	NV_C1_BC0_IM_LEVEL1_I = 1787,
-	NV_C1_BC0_IM_LEVEL2_I = 1788,
-	NV_C1_BC0_IM_LEVEL3_I = 1789,
-	NV_C1_BC0_IM_LEVEL4_I = 1790,
-	NV_RFR_BB_FILTER_I = 1791,
-	NV_RFR_IQ_LINE_RESISTOR_I = 1792,
-	NV_WCDMA_RFR_VCO_COARSE_TUNING_I = 1793,
-	NV_RFR_VCO_COARSE_TUNING_1900_I = 1794,
-	NV_WCDMA_TX_ROT_ANGLE_PA_STATE_00_I = 1795,
-	NV_WCDMA_TX_ROT_ANGLE_PA_STATE_01_I = 1796,
-	NV_WCDMA_TX_ROT_ANGLE_PA_STATE_10_I = 1797,
-	NV_WCDMA_TX_ROT_ANGLE_PA_STATE_11_I = 1798,
-	NV_AMR_I = 1799,
-	NV_WCDMA_SPIKE_MITIGATION_ENABLED_I = 1800,
-	NV_PA_COMPENSATE_UP_I = 1801,
-	NV_PA_COMPENSATE_DOWN_I = 1802,
-	NV_SN_PPP_STATUS_I = 1803,
-	NV_DS_UCSD_RLPV2_DEFAULT_I = 1804,
-	NV_SELECT_TECH_FOR_CARD_I = 1805,
-	NV_PPP_NCP_REMOTE_INITIATE_I = 1806,
-	NV_DS_UCSD_RLP_VERSION_GSM_I = 1807,
-	NV_DS_UCSD_RLP_VERSION_WCDMA_I = 1808,
-	NV_DS_ATCOP_RLP_VERSION_DEFAULT_I = 1809,
-	NV_DS_UCSD_RECOVERY_MODE_SREJ_I = 1810,
-	NV_TCP_KEEPALIVE_IDLE_TIME_I = 1811,
-	NV_RF_TUNE_RESERVED_I = 1812,
-	NV_DATA_FORCE_CDMA_PKT_STR_I = 1813,
-	NV_WCDMA_800_VGA_GAIN_OFFSET_I = 1814,
-	NV_WCDMA_800_VGA_GAIN_OFFSET_VS_FREQ_I = 1815,
-	NV_WCDMA_800_VGA_GAIN_OFFSET_VS_TEMP_I = 1816,
-	NV_WCDMA_800_LNA_RANGE_RISE_2_I = 1817,
-	NV_WCDMA_800_LNA_RANGE_RISE_3_I = 1818,
-	NV_WCDMA_800_LNA_RANGE_FALL_2_I = 1819,
-	NV_WCDMA_800_LNA_RANGE_FALL_3_I = 1820,
-	NV_WCDMA_800_IM_LEVEL_2_I = 1821,
-	NV_WCDMA_800_IM_LEVEL_3_I = 1822,
-	NV_WCDMA_800_LNA_RANGE_OFFSET_2_I = 1823,
-	NV_WCDMA_800_LNA_RANGE_OFFSET_3_I = 1824,
-	NV_WCDMA_800_LNA_OFFSET_VS_FREQ_2_I = 1825,
-	NV_WCDMA_800_LNA_OFFSET_VS_FREQ_3_I = 1826,
-	NV_WCDMA_800_IM2_I_VALUE_I = 1827,
-	NV_WCDMA_800_IM2_Q_VALUE_I = 1828,
-	NV_WCDMA_800_IM2_TRANSCONDUCTOR_VALUE_I = 1829,
-	NV_WCDMA_800_RX_AGC_MIN_2_I = 1830,
-	NV_WCDMA_800_RX_AGC_MIN_3_I = 1831,
-	NV_WCDMA_800_MAX_TX_POWER_I = 1832,
-	NV_WCDMA_800_OUT_OF_SERVICE_THRESH_I = 1833,
-	NV_WCDMA_800_LNA_RANGE_RISE_I = 1834,
-	NV_WCDMA_800_LNA_RANGE_FALL_I = 1835,
-	NV_WCDMA_800_IM_LEVEL_I = 1836,
-	NV_WCDMA_800_NONBYPASS_TIMER_I = 1837,
-	NV_WCDMA_800_BYPASS_TIMER_I = 1838,
-	NV_WCDMA_800_LNA_RANGE_OFFSET_I = 1839,
-	NV_WCDMA_800_LNA_OFFSET_VS_FREQ_I = 1840,
-	NV_WCDMA_800_RX_AGC_MIN_I = 1841,
-	NV_WCDMA_800_RX_AGC_MAX_I = 1842,
-	NV_WCDMA_800_AGC_PHASE_OFFSET_I = 1843,
-	NV_WCDMA_800_TX_LIN_MASTER_0_I = 1844,
-	NV_WCDMA_800_TX_LIN_MASTER_1_I = 1845,
-	NV_WCDMA_800_TX_COMP_VS_FREQ_0_I = 1846,
-	NV_WCDMA_800_TX_COMP_VS_FREQ_1_I = 1847,
-	NV_WCDMA_800_TX_LIN_VS_TEMP_0_I = 1848,
-	NV_WCDMA_800_TX_LIN_VS_TEMP_1_I = 1849,
-	NV_WCDMA_800_TX_SLP_VS_TEMP_0_I = 1850,
-	NV_WCDMA_800_TX_SLP_VS_TEMP_1_I = 1860,
-	NV_WCDMA_800_R1_RISE_I = 1861,
-	NV_WCDMA_800_R1_FALL_I = 1862,
-	NV_WCDMA_800_TX_LIM_VS_TEMP_I = 1863,
-	NV_WCDMA_800_TX_LIM_VS_FREQ_I = 1864,
-	NV_WCDMA_800_ADJ_FACTOR_I = 1865,
-	NV_WCDMA_800_EXP_HDET_VS_AGC_I = 1866,
-	NV_WCDMA_800_HDET_OFF_I = 1867,
-	NV_WCDMA_800_HDET_SPN_I = 1868,
-	NV_WCDMA_800_ENC_BTF_I = 1869,
-	NV_WCDMA_800_AGC_PA_ON_RISE_DELAY_I = 1870,
-	NV_WCDMA_800_AGC_PA_ON_FALL_DELAY_I = 1871,
-	NV_WCDMA_800_AGC_TX_ON_RISE_DELAY_I = 1872,
-	NV_WCDMA_800_AGC_TX_ON_FALL_DELAY_I = 1873,
-	NV_WCDMA_800_AGC_UPDATE_TX_AGC_TIME_I = 1874,
-	NV_PA_R_MAP_I = 1875,
-	NV_PS_IPV6_IID_I = 1876,
-	NV_RF_BC_CONFIG_I = 1877,
-	NV_RF_HW_CONFIG_I = 1878,
-	NV_BC0_HDR_IM_FALL_I = 1879,
-	NV_BC0_HDR_IM_RISE_I = 1880,
-	NV_VCO_TEMP_I = 1881,
-	NV_VCO_DEFAULT_I = 1882,
-	NV_VCO_SLOPE_I = 1883,
-	NV_VCO_SLOPE_RANGE_I = 1884,
-	NV_RGS_TIME_I = 1885,
-	NV_RGS_TYPE_I = 1886,
-	NV_RGS_TEMP_I = 1887,
-	NV_RGS_ROT_I = 1888,
-	NV_RGS_VCO_I = 1889,
-	NV_BC0_HDR_IM_LEVEL_I = 1890,
-	NV_GSM_TX_BURST_OFFSET_ADJ_I = 1891,
-	NV_DIAG_DEBUG_CONTROL_I = 1892,
-	NV_QVP_APP_DEFAULT_CAPABILITY_TYPE_I = 1893,
-	NV_RR_STORED_LAST_BEST_ARFCNS_BAND_I = 1894,
-	NV_DIAG_DEBUG_DETAIL_I = 1895,
-	NV_IPV6_ENABLED_I = 1896,
-	NV_IPV6_SM_CONFIG_I = 1897,
-	NV_C1_BC0_VCO_COARSE_TUNE_TABLE_I = 1898,
-	NV_C1_BC1_VCO_COARSE_TUNE_TABLE_I = 1899,
-	NV_C1_BC3_VCO_COARSE_TUNE_TABLE_I = 1900,
-	NV_C1_BC4_VCO_COARSE_TUNE_TABLE_I = 1901,
-	NV_C1_BC5_VCO_COARSE_TUNE_TABLE_I = 1902,
-	NV_C1_BC6_VCO_COARSE_TUNE_TABLE_I = 1903,
-	NV_C1_RFR_BB_FILTER_I = 1904,
-	NV_IPV6_PRIMARY_DNS_I = 1905,
-	NV_IPV6_SECONDARY_DNS_I = 1906,
-	NV_AUTH_REQUIRE_PASSWORD_ENCRYPTION_I = 1907,
-	NV_WCDMA_PRACH_R1_RISE_OFFSET_I = 1908,
-	NV_WCDMA_1900_PRACH_R1_RISE_OFFSET_I = 1909,
-	NV_WCDMA_PRACH_R1_FALL_OFFSET_I = 1910,
-	NV_WCDMA_1900_PRACH_R1_FALL_OFFSET_I = 1911,
-	NV_WCDMA_800_PRACH_R1_FALL_OFFSET_I = 1912,
-	NV_AAGPS_MAX_OSC_UNC_I = 1913,
-	NV_AAGPS_MAX_OSC_UNC_RATE_I = 1914,
-	NV_AAGPS_PROCESSING_LOSSES_I = 1915,
-	NV_AAGPS_MAX_PLATFORM_VELOCITY_I = 1916,
-	NV_AAGPS_MAX_PLATFORM_ACCL_I = 1917,
-	NV_AAGPS_DEFAULT_QOS_TIME_I = 1918,
-	NV_AAGPS_RAPID_FIX_REPORT_MAX_LATENCY_I = 1919,
-	NV_AAGPS_POSITIONING_MODES_SUPPORTED_I = 1920,
-	NV_AAGPS_DEFAULT_REF_TIME_UNC_I = 1921,
-	NV_AAGPS_DEFAULT_REF_POSITION_UNC_I = 1922,
-	NV_AAGPS_APP_TRACKING_GPSIDLE_THSLD_I = 1923,
-	NV_AAGPS_GPS_LOCK_CONTROL_I = 1924,
-	NV_AAGPS_DEFAULT_URL_I = 1925,
-	NV_AAGPS_DEFAULT_IP_ADDRESS_I = 1926,
-	NV_AAGPS_TRANSPORT_TYPE_I = 1927,
-	NV_AAGPS_KEEP_WARM_MODE_I = 1928,
-	NV_AAGPS_2G_MO_LRSUPPORT_I = 1929,
-	NV_AAGPS_EMERGENCY_SERVICES_SPPRT_I = 1930,
-	NV_WCDMA_800_PRACH_R1_RISE_OFFSET_I = 1931,
-	NV_PDSN_AS_PROXY_IPV6_DNS_SERVER_I = 1932,
-	NV_HDRAMP_HARDWARE_ID_I = 1933,
-	NV_AAGPS_PROTOCOL_SELECT_I = 1934,
-	NV_AAGPS_APP_TRKG_PERIODIC_REQ_DLY_MARGIN_I = 1935,
-	NV_AAGPS_DEFAULT_QOS_UNC_I = 1936,
-	NV_AAGPS_APP_TRACKING_GPSON_THSLD_I = 1937,
-	NV_AAGPS_MT_LRSUPPORT_I = 1940,
-	NV_IPV6_FAILOVER_CONFIG_I = 1941,
-	NV_UIM_USE_CAVE_FOR_AN_AUTH_I = 1942,
-	NV_MEID_I = 1943,
-	NV_GPS1_CALL_RELATED_I = 1944,
-	NV_RF_ANTSEL_GSM_DEFAULT_I = 1945,
-	NV_RF_ANTSEL_GSM_850_TX_I = 1946,
-	NV_RF_ANTSEL_GSM_850_RX_I = 1947,
-	NV_RF_ANTSEL_GSM_900_TX_I = 1948,
-	NV_RF_ANTSEL_GSM_900_RX_I = 1949,
-	NV_RF_ANTSEL_GSM_1800_TX_I = 1950,
-	NV_RF_ANTSEL_GSM_1800_RX_I = 1951,
-	NV_RF_ANTSEL_GSM_1900_TX_I = 1952,
-	NV_RF_ANTSEL_GSM_1900_RX_I = 1953,
-	NV_RF_ANTSEL_UMTS_800_I = 1954,
-	NV_RF_ANTSEL_UMTS_1900_I = 1955,
-	NV_RF_ANTSEL_UMTS_2100_I = 1956,
-	NV_TCP_SACK_TIMESTAMP_ENABLED_I = 1957,
-	NV_PRL_PREF_I = 1958,
-	NV_AAGPS_DEFAULT_IP_PORT_I = 1959,
-	NV_AAGPS_3G_MO_LRSUPPORT_I = 1960,
-	NV_AAGPS_DEVELOPMENT_TEST_CONTROL_I = 1961,
-	NV_DIAG_DEBUG_MAX_FILES_I = 1962,
-	NV_WCDMA_800_PA_COMPENSATE_UP_I = 1963,
-	NV_WCDMA_800_PA_COMPENSATE_DOWN_I = 1964,
-	NV_WCDMA_1900_PA_COMPENSATE_UP_I = 1965,
-	NV_WCDMA_1900_PA_COMPENSATE_DOWN_I = 1966,
-	NV_WCDMA_800_PA_GAIN_UP_TIME_I = 1967,
-	NV_WCDMA_800_PA_GAIN_DOWN_TIME_I = 1968,
-	NV_WCDMA_1900_PA_GAIN_UP_TIME_I = 1969,
-	NV_WCDMA_1900_PA_GAIN_DOWN_TIME_I = 1970,
-	NV_WCDMA_TX_CAL_CHAN_I = 1971,
-	NV_WCDMA_RX_CAL_CHAN_I = 1972,
-	NV_WCDMA_1900_TX_CAL_CHAN_I = 1973,
-	NV_WCDMA_1900_RX_CAL_CHAN_I = 1974,
-	NV_WCDMA_800_TX_CAL_CHAN_I = 1975,
-	NV_WCDMA_800_RX_CAL_CHAN_I = 1976,
-	NV_BREW_CARRIER_ID_I = 1977,
-	NV_BREW_PLATFORM_ID_I = 1978,
-	NV_BREW_BKEY_I = 1979,
-	NV_BREW_SERVER_I = 1980,
-	NV_BREW_DOWNLOAD_FLAGS_I = 1981,
-	NV_BREW_AUTH_POLICY_I = 1982,
-	NV_BREW_PRIVACY_POLICY_I = 1983,
-	NV_BREW_SUBSCRIBER_ID_I = 1984,
-	NV_WCDMA_RX_DELAY_I = 1985,
-	NV_WCDMA_800_RX_DELAY_I = 1986,
-	NV_WCDMA_1900_RX_DELAY_I = 1987,
-	NV_AAGPS_DEVELOPMENT_TEST_CONTROL2_I = 1988,
-	NV_AAGPS_DEVELOPMENT_TEST_CONTROL3_I = 1989,
-	NV_AAGPS_DEVELOPMENT_TEST_CONTROL4_I = 1990,
-	NV_AAGPS_DEVELOPMENT_TEST_CONTROL5_I = 1991,
-	NV_MEID_CD_I = 1992,
-	NV_GPS1_VX_LCS_AGENT_I = 1993,
-	NV_GPS1_VX_APP_TRUSTED_SETTINGS_I = 1994,
-	NV_GPS1_VX_NI_TELESERVICE_ID_I = 1995,
-	NV_GPS1_VX_LCS_AGENT_PREV6_ONLY_I = 1996,
-	NV_GPS1_VX_MO_MAX_DURATION_I = 1997,
-	NV_GPS1_OOS_OPERATION_PREF_I = 1998,
-	NV_GPS1_VX_GPS_DURING_VOICE_CALL_I = 1999,
-	NV_WLAN_TECH_PREF_I = 2000,
-	NV_DS_UCSD_RLP_ADM_IDLE_I = 2001,
-	NV_PPP_CCP_REJECT_I = 2002,
-	NV_WLAN_SCAN_PREF_I = 2003,
-	NV_HDRBCMCS_OVHD_PERIOD_I = 2004,
-	NV_HDRBCMCS_PAGE_REG_PERIOD_I = 2005,
-	NV_HDRBCMCS_DYN_REG_PERIOD_I = 2006,
-	NV_HDRBCMCS_MONITOR_PERIOD_I = 2007,
-	NV_HDRBCMCS_NUM_PERIODS_I = 2008,
-	NV_WCDMA_TX_LIN_MASTER_2_I = 2009,
-	NV_WCDMA_TX_LIN_MASTER_3_I = 2010,
-	NV_WCDMA_TX_COMP_VS_FREQ_2_I = 2011,
-	NV_WCDMA_TX_COMP_VS_FREQ_3_I = 2012,
-	NV_WCDMA_TX_LIN_VS_TEMP_2_I = 2013,
-	NV_WCDMA_TX_LIN_VS_TEMP_3_I = 2014,
-	NV_WCDMA_TX_SLP_VS_TEMP_2_I = 2015,
-	NV_WCDMA_TX_SLP_VS_TEMP_3_I = 2016,
-	NV_WCDMA_R2_RISE_I = 2017,
-	NV_WCDMA_R2_FALL_I = 2018,
-	NV_WCDMA_R3_RISE_I = 2019,
-	NV_WCDMA_R3_FALL_I = 2020,
-	NV_PA_COMPENSATE_UP_R2_I = 2021,
-	NV_PA_COMPENSATE_DOWN_R2_I = 2022,
-	NV_PA_COMPENSATE_UP_R3_I = 2023,
-	NV_PA_COMPENSATE_DOWN_R3_I = 2024,
-	NV_WCDMA_PRACH_R2_RISE_OFFSET_I = 2025,
-	NV_WCDMA_PRACH_R2_FALL_OFFSET_I = 2026,
-	NV_WCDMA_PRACH_R3_RISE_OFFSET_I = 2027,
-	NV_WCDMA_PRACH_R3_FALL_OFFSET_I = 2028,
-	NV_WCDMA_PA_RANGE_MAP_I = 2029,
-	NV_WCDMA_1900_TX_LIN_MASTER_2_I = 2030,
-	NV_WCDMA_1900_TX_LIN_MASTER_3_I = 2031,
-	NV_WCDMA_1900_TX_COMP_VS_FREQ_2_I = 2032,
-	NV_WCDMA_1900_TX_COMP_VS_FREQ_3_I = 2033,
-	NV_WCDMA_1900_TX_LIN_VS_TEMP_2_I = 2034,
-	NV_WCDMA_1900_TX_LIN_VS_TEMP_3_I = 2035,
-	NV_WCDMA_1900_TX_SLP_VS_TEMP_2_I = 2036,
-	NV_WCDMA_1900_TX_SLP_VS_TEMP_3_I = 2037,
-	NV_WCDMA_1900_R2_RISE_I = 2038,
-	NV_WCDMA_1900_R2_FALL_I = 2039,
-	NV_WCDMA_1900_R3_RISE_I = 2040,
-	NV_WCDMA_1900_R3_FALL_I = 2041,
-	NV_WCDMA_1900_PA_COMPENSATE_UP_R2_I = 2042,
-	NV_WCDMA_1900_PA_COMPENSATE_DOWN_R2_I = 2043,
-	NV_WCDMA_1900_PA_COMPENSATE_UP_R3_I = 2044,
-	NV_WCDMA_1900_PA_COMPENSATE_DOWN_R3_I = 2045,
-	NV_WCDMA_1900_TX_ROT_ANGLE_PA_STATE_00_I = 2046,
-	NV_WCDMA_1900_TX_ROT_ANGLE_PA_STATE_01_I = 2047,
-	NV_WCDMA_1900_TX_ROT_ANGLE_PA_STATE_10_I = 2048,
-	NV_WCDMA_1900_TX_ROT_ANGLE_PA_STATE_11_I = 2049,
-	NV_WCDMA_1900_PRACH_R2_RISE_OFFSET_I = 2050,
-	NV_WCDMA_1900_PRACH_R2_FALL_OFFSET_I = 2051,
-	NV_WCDMA_1900_PRACH_R3_RISE_OFFSET_I = 2052,
-	NV_WCDMA_1900_PRACH_R3_FALL_OFFSET_I = 2053,
-	NV_WCDMA_1900_PA_RANGE_MAP_I = 2054,
-	NV_WCDMA_800_TX_LIN_MASTER_2_I = 2055,
-	NV_WCDMA_800_TX_LIN_MASTER_3_I = 2056,
-	NV_WCDMA_800_TX_COMP_VS_FREQ_2_I = 2057,
-	NV_WCDMA_800_TX_COMP_VS_FREQ_3_I = 2058,
-	NV_WCDMA_800_TX_LIN_VS_TEMP_2_I = 2059,
-	NV_WCDMA_800_TX_LIN_VS_TEMP_3_I = 2060,
-	NV_WCDMA_800_TX_SLP_VS_TEMP_2_I = 2061,
-	NV_WCDMA_800_TX_SLP_VS_TEMP_3_I = 2062,
-	NV_WCDMA_800_R2_RISE_I = 2063,
-	NV_WCDMA_800_R2_FALL_I = 2064,
-	NV_WCDMA_800_R3_RISE_I = 2065,
-	NV_WCDMA_800_R3_FALL_I = 2066,
-	NV_WCDMA_800_PA_COMPENSATE_UP_R2_I = 2067,
-	NV_WCDMA_800_PA_COMPENSATE_DOWN_R2_I = 2068,
-	NV_WCDMA_800_PA_COMPENSATE_UP_R3_I = 2069,
-	NV_WCDMA_800_PA_COMPENSATE_DOWN_R3_I = 2070,
-	NV_WCDMA_800_TX_ROT_ANGLE_PA_STATE_00_I = 2071,
-	NV_WCDMA_800_TX_ROT_ANGLE_PA_STATE_01_I = 2072,
-	NV_WCDMA_800_TX_ROT_ANGLE_PA_STATE_10_I = 2073,
-	NV_WCDMA_800_TX_ROT_ANGLE_PA_STATE_11_I = 2074,
-	NV_WCDMA_800_PRACH_R2_RISE_OFFSET_I = 2075,
-	NV_WCDMA_800_PRACH_R2_FALL_OFFSET_I = 2076,
-	NV_WCDMA_800_PRACH_R3_RISE_OFFSET_I = 2077,
-	NV_WCDMA_800_PRACH_R3_FALL_OFFSET_I = 2078,
-	NV_WCDMA_800_PA_RANGE_MAP_I = 2079,
-	NV_BC0_VCO_COARSE_TUNE_2_I = 2080,
-	NV_BC1_VCO_COARSE_TUNE_2_I = 2081,
-	NV_BC3_VCO_COARSE_TUNE_2_I = 2082,
-	NV_BC4_VCO_COARSE_TUNE_2_I = 2083,
-	NV_BC5_VCO_COARSE_TUNE_2_I = 2084,
-	NV_BC6_VCO_COARSE_TUNE_2_I = 2085,
-	NV_GSM_PRUI_00_I = 2086,
-	NV_GSM_PRUI_01_I = 2087,
-	NV_GSM_PRUI_02_I = 2088,
-	NV_GSM_PRUI_03_I = 2089,
-	NV_GSM_PRUI_04_I = 2090,
-	NV_GSM_PRUI_05_I = 2091,
-	NV_GSM_PRUI_06_I = 2092,
-	NV_GSM_PRUI_07_I = 2093,
-	NV_GSM_PRUI_08_I = 2094,
-	NV_GSM_PRUI_09_I = 2095,
-	NV_GSM_PRUI_10_I = 2096,
-	NV_GSM_PRDI_00_I = 2097,
-	NV_GSM_PRDI_01_I = 2098,
-	NV_GSM_PRDI_02_I = 2099,
-	NV_GSM_PRDI_03_I = 2100,
-	NV_GSM_PRDI_04_I = 2101,
-	NV_GSM_PRDI_05_I = 2102,
-	NV_GSM_PRDI_06_I = 2103,
-	NV_GSM_PRDI_07_I = 2104,
-	NV_GSM_PRDI_08_I = 2105,
-	NV_GSM_PRDI_09_I = 2106,
-	NV_GSM_PRDI_10_I = 2107,
-	NV_GSM_PRDI_11_I = 2108,
-	NV_DCS_PRUI_00_I = 2109,
-	NV_DCS_PRUI_01_I = 2110,
-	NV_DCS_PRUI_02_I = 2111,
-	NV_DCS_PRUI_03_I = 2112,
-	NV_DCS_PRUI_04_I = 2113,
-	NV_DCS_PRUI_05_I = 2114,
-	NV_DCS_PRUI_06_I = 2115,
-	NV_DCS_PRUI_07_I = 2116,
-	NV_DCS_PRUI_08_I = 2117,
-	NV_DCS_PRUI_09_I = 2118,
-	NV_DCS_PRUI_10_I = 2119,
-	NV_DCS_PRUI_11_I = 2120,
-	NV_DCS_PRUI_12_I = 2121,
-	NV_DCS_PRDI_00_I = 2122,
-	NV_DCS_PRDI_01_I = 2123,
-	NV_DCS_PRDI_02_I = 2124,
-	NV_DCS_PRDI_03_I = 2125,
-	NV_DCS_PRDI_04_I = 2126,
-	NV_DCS_PRDI_05_I = 2127,
-	NV_DCS_PRDI_06_I = 2128,
-	NV_DCS_PRDI_07_I = 2129,
-	NV_DCS_PRDI_08_I = 2130,
-	NV_DCS_PRDI_09_I = 2131,
-	NV_DCS_PRDI_10_I = 2132,
-	NV_DCS_PRDI_11_I = 2133,
-	NV_DCS_PRDI_12_I = 2134,
-	NV_GSM_1900_PRUI_00_I = 2135,
-	NV_GSM_1900_PRUI_01_I = 2136,
-	NV_GSM_1900_PRUI_02_I = 2137,
-	NV_GSM_1900_PRUI_03_I = 2138,
-	NV_GSM_1900_PRUI_04_I = 2139,
-	NV_GSM_1900_PRUI_05_I = 2140,
-	NV_GSM_1900_PRUI_06_I = 2141,
-	NV_GSM_1900_PRUI_07_I = 2142,
-	NV_GSM_1900_PRUI_08_I = 2143,
-	NV_GSM_1900_PRUI_09_I = 2144,
-	NV_GSM_1900_PRUI_10_I = 2145,
-	NV_GSM_1900_PRUI_11_I = 2146,
-	NV_GSM_1900_PRUI_12_I = 2147,
-	NV_GSM_1900_PRDI_02_I = 2148,
-	NV_GSM_1900_PRDI_03_I = 2149,
-	NV_GSM_1900_PRDI_04_I = 2150,
-	NV_GSM_1900_PRDI_05_I = 2151,
-	NV_GSM_1900_PRDI_06_I = 2152,
-	NV_GSM_1900_PRDI_07_I = 2153,
-	NV_GSM_1900_PRDI_09_I = 2154,
-	NV_GSM_1900_PRDI_10_I = 2155,
-	NV_GSM_1900_PRDI_12_I = 2156,
-	NV_GSM_VL_TL_BRUI_14_I = 2157,
-	NV_GSM_VL_TL_BRUI_13_I = 2158,
-	NV_GSM_VL_TL_BRUI_12_I = 2159,
-	NV_GSM_VL_TL_BRDI_14_I = 2160,
-	NV_GSM_VL_TL_BRDI_13_I = 2161,
-	NV_GSM_VL_TL_BRDI_12_I = 2162,
-	NV_DCS_VL_TL_BRUI_15_I = 2163,
-	NV_DCS_VL_TL_BRUI_14_I = 2164,
-	NV_DCS_VL_TL_BRUI_13_I = 2165,
-	NV_DCS_VL_TL_BRDI_15_I = 2166,
-	NV_DCS_VL_TL_BRDI_14_I = 2167,
-	NV_DCS_VL_TL_BRDI_13_I = 2168,
-	NV_GSM_1900_VL_TL_BRUI_15_I = 2169,
-	NV_GSM_1900_VL_TL_BRUI_14_I = 2170,
-	NV_GSM_1900_VL_TL_BRUI_13_I = 2171,
-	NV_GSM_1900_VL_TL_BRDI_15_I = 2172,
-	NV_GSM_1900_VL_TL_BRDI_14_I = 2173,
-	NV_GSM_1900_VL_TL_BRDI_13_I = 2174,
-	NV_GSM_VM_TL_BRUI_14_I = 2175,
-	NV_GSM_VM_TL_BRUI_13_I = 2176,
-	NV_GSM_VM_TL_BRUI_12_I = 2177,
-	NV_GSM_VM_TL_BRDI_14_I = 2178,
-	NV_GSM_VM_TL_BRDI_13_I = 2179,
-	NV_GSM_VM_TL_BRDI_12_I = 2180,
-	NV_DCS_VM_TL_BRUI_15_I = 2181,
-	NV_DCS_VM_TL_BRUI_14_I = 2182,
-	NV_DCS_VM_TL_BRUI_13_I = 2183,
-	NV_DCS_VM_TL_BRDI_15_I = 2184,
-	NV_DCS_VM_TL_BRDI_14_I = 2185,
-	NV_DCS_VM_TL_BRDI_13_I = 2186,
-	NV_GSM_1900_VM_TL_BRUI_15_I = 2187,
-	NV_GSM_1900_VM_TL_BRUI_14_I = 2188,
-	NV_GSM_1900_VM_TL_BRUI_13_I = 2189,
-	NV_GSM_1900_VM_TL_BRDI_15_I = 2190,
-	NV_GSM_1900_VM_TL_BRDI_14_I = 2191,
-	NV_GSM_1900_VM_TL_BRDI_13_I = 2192,
-	NV_GSM_VH_TL_BRUI_14_I = 2193,
-	NV_GSM_VH_TL_BRUI_13_I = 2194,
-	NV_GSM_VH_TL_BRUI_12_I = 2195,
-	NV_GSM_VH_TL_BRDI_14_I = 2196,
-	NV_GSM_VH_TL_BRDI_13_I = 2197,
-	NV_GSM_VH_TL_BRDI_12_I = 2198,
-	NV_DCS_VH_TL_BRUI_15_I = 2199,
-	NV_DCS_VH_TL_BRUI_14_I = 2200,
-	NV_DCS_VH_TL_BRUI_13_I = 2201,
-	NV_DCS_VH_TL_BRDI_15_I = 2202,
-	NV_DCS_VH_TL_BRDI_14_I = 2203,
-	NV_DCS_VH_TL_BRDI_13_I = 2204,
-	NV_GSM_1900_VH_TL_BRUI_15_I = 2205,
-	NV_GSM_1900_VH_TL_BRUI_14_I = 2206,
-	NV_GSM_1900_VH_TL_BRUI_13_I = 2207,
-	NV_GSM_1900_VH_TL_BRDI_15_I = 2208,
-	NV_GSM_1900_VH_TL_BRDI_14_I = 2209,
-	NV_GSM_1900_VH_TL_BRDI_13_I = 2210,
-	NV_GSM_VL_TM_BRUI_14_I = 2211,
-	NV_GSM_VL_TM_BRUI_13_I = 2212,
-	NV_GSM_VL_TM_BRUI_12_I = 2213,
-	NV_GSM_VL_TM_BRDI_14_I = 2214,
-	NV_GSM_VL_TM_BRDI_13_I = 2215,
-	NV_GSM_VL_TM_BRDI_12_I = 2216,
-	NV_DCS_VL_TM_BRUI_15_I = 2217,
-	NV_DCS_VL_TM_BRUI_14_I = 2218,
-	NV_DCS_VL_TM_BRUI_13_I = 2219,
-	NV_DCS_VL_TM_BRDI_15_I = 2220,
-	NV_DCS_VL_TM_BRDI_14_I = 2221,
-	NV_DCS_VL_TM_BRDI_13_I = 2222,
-	NV_GSM_1900_VL_TM_BRUI_15_I = 2223,
-	NV_GSM_1900_VL_TM_BRUI_14_I = 2224,
-	NV_GSM_1900_VL_TM_BRUI_13_I = 2225,
-	NV_GSM_1900_VL_TM_BRDI_15_I = 2226,
-	NV_GSM_1900_VL_TM_BRDI_14_I = 2227,
-	NV_GSM_1900_VL_TM_BRDI_13_I = 2228,
-	NV_GSM_VM_TM_BRUI_14_I = 2229,
-	NV_GSM_VM_TM_BRUI_13_I = 2230,
-	NV_GSM_VM_TM_BRUI_12_I = 2231,
-	NV_GSM_VM_TM_BRDI_14_I = 2232,
-	NV_GSM_VM_TM_BRDI_13_I = 2233,
-	NV_GSM_VM_TM_BRDI_12_I = 2234,
-	NV_DCS_VM_TM_BRUI_15_I = 2235,
-	NV_DCS_VM_TM_BRUI_14_I = 2236,
-	NV_DCS_VM_TM_BRUI_13_I = 2237,
-	NV_DCS_VM_TM_BRDI_15_I = 2238,
-	NV_DCS_VM_TM_BRDI_14_I = 2239,
-	NV_DCS_VM_TM_BRDI_13_I = 2240,
-	NV_GSM_1900_VM_TM_BRUI_15_I = 2241,
-	NV_GSM_1900_VM_TM_BRUI_14_I = 2242,
-	NV_GSM_1900_VM_TM_BRUI_13_I = 2243,
-	NV_GSM_1900_VM_TM_BRDI_15_I = 2244,
-	NV_GSM_1900_VM_TM_BRDI_14_I = 2245,
-	NV_GSM_1900_VM_TM_BRDI_13_I = 2246,
-	NV_GSM_VH_TM_BRUI_14_I = 2247,
-	NV_GSM_VH_TM_BRUI_13_I = 2248,
-	NV_GSM_VH_TM_BRUI_12_I = 2249,
-	NV_GSM_VH_TM_BRDI_14_I = 2250,
-	NV_GSM_VH_TM_BRDI_13_I = 2251,
-	NV_GSM_VH_TM_BRDI_12_I = 2252,
-	NV_DCS_VH_TM_BRUI_15_I = 2253,
-	NV_DCS_VH_TM_BRUI_14_I = 2254,
-	NV_DCS_VH_TM_BRUI_13_I = 2255,
-	NV_DCS_VH_TM_BRDI_15_I = 2256,
-	NV_DCS_VH_TM_BRDI_14_I = 2257,
-	NV_DCS_VH_TM_BRDI_13_I = 2258,
-	NV_GSM_1900_VH_TM_BRUI_15_I = 2259,
-	NV_GSM_1900_VH_TM_BRUI_14_I = 2260,
-	NV_GSM_1900_VH_TM_BRUI_13_I = 2261,
-	NV_GSM_1900_VH_TM_BRDI_15_I = 2262,
-	NV_GSM_1900_VH_TM_BRDI_14_I = 2263,
-	NV_GSM_1900_VH_TM_BRDI_13_I = 2264,
-	NV_GSM_VL_TH_BRUI_14_I = 2265,
-	NV_GSM_VL_TH_BRUI_13_I = 2266,
-	NV_GSM_VL_TH_BRUI_12_I = 2267,
-	NV_GSM_VL_TH_BRDI_14_I = 2268,
-	NV_GSM_VL_TH_BRDI_13_I = 2269,
-	NV_GSM_VL_TH_BRDI_12_I = 2270,
-	NV_DCS_VL_TH_BRUI_15_I = 2271,
-	NV_DCS_VL_TH_BRUI_14_I = 2272,
-	NV_DCS_VL_TH_BRUI_13_I = 2273,
-	NV_DCS_VL_TH_BRDI_15_I = 2274,
-	NV_DCS_VL_TH_BRDI_14_I = 2275,
-	NV_DCS_VL_TH_BRDI_13_I = 2276,
-	NV_GSM_1900_VL_TH_BRUI_15_I = 2277,
-	NV_GSM_1900_VL_TH_BRUI_14_I = 2278,
-	NV_GSM_1900_VL_TH_BRUI_13_I = 2279,
-	NV_GSM_1900_VL_TH_BRDI_15_I = 2280,
-	NV_GSM_1900_VL_TH_BRDI_14_I = 2281,
-	NV_GSM_1900_VL_TH_BRDI_13_I = 2282,
-	NV_GSM_VM_TH_BRUI_14_I = 2283,
-	NV_GSM_VM_TH_BRUI_13_I = 2284,
-	NV_GSM_VM_TH_BRUI_12_I = 2285,
-	NV_GSM_VM_TH_BRDI_14_I = 2286,
-	NV_GSM_VM_TH_BRDI_13_I = 2287,
-	NV_GSM_VM_TH_BRDI_12_I = 2288,
-	NV_DCS_VM_TH_BRUI_15_I = 2289,
-	NV_DCS_VM_TH_BRUI_14_I = 2290,
-	NV_DCS_VM_TH_BRUI_13_I = 2291,
-	NV_DCS_VM_TH_BRDI_15_I = 2292,
-	NV_DCS_VM_TH_BRDI_14_I = 2293,
-	NV_DCS_VM_TH_BRDI_13_I = 2294,
-	NV_GSM_1900_VM_TH_BRUI_15_I = 2295,
-	NV_GSM_1900_VM_TH_BRUI_14_I = 2296,
-	NV_GSM_1900_VM_TH_BRUI_13_I = 2297,
-	NV_GSM_1900_VM_TH_BRDI_15_I = 2298,
-	NV_GSM_1900_VM_TH_BRDI_14_I = 2299,
-	NV_GSM_1900_VM_TH_BRDI_13_I = 2300,
-	NV_GSM_VH_TH_BRUI_14_I = 2301,
-	NV_GSM_VH_TH_BRUI_13_I = 2302,
-	NV_GSM_VH_TH_BRUI_12_I = 2303,
-	NV_GSM_VH_TH_BRDI_14_I = 2304,
-	NV_GSM_VH_TH_BRDI_13_I = 2305,
-	NV_GSM_VH_TH_BRDI_12_I = 2306,
-	NV_DCS_VH_TH_BRUI_15_I = 2307,
-	NV_DCS_VH_TH_BRUI_14_I = 2308,
-	NV_DCS_VH_TH_BRUI_13_I = 2309,
-	NV_DCS_VH_TH_BRDI_15_I = 2310,
-	NV_DCS_VH_TH_BRDI_14_I = 2311,
-	NV_DCS_VH_TH_BRDI_13_I = 2312,
-	NV_GSM_1900_VH_TH_BRUI_15_I = 2313,
-	NV_GSM_1900_VH_TH_BRUI_14_I = 2314,
-	NV_GSM_1900_VH_TH_BRUI_13_I = 2315,
-	NV_GSM_1900_VH_TH_BRDI_15_I = 2316,
-	NV_GSM_1900_VH_TH_BRDI_14_I = 2317,
-	NV_GSM_1900_VH_TH_BRDI_13_I = 2318,
-	NV_GSM_C0_TX_FREQ_COMP_I = 2319,
-	NV_DCS_C0_TX_FREQ_COMP_I = 2320,
-	NV_GSM_1900_C0_TX_FREQ_COMP_I = 2321,
-	NV_GSM_C1_TX_FREQ_COMP_I = 2322,
-	NV_DCS_C1_TX_FREQ_COMP_I = 2323,
-	NV_GSM1900_C1_TX_FREQ_COMP_I = 2324,
-	NV_GSM_ENABLE_TX_FREQ_COMP_VS_PCL_I = 2325,
-	NV_DCS_ENABLE_TX_FREQ_COMP_VS_PCL_I = 2326,
-	NV_GSM_1900_ENABLE_TX_FREQ_COMP_VS_PCL_I = 2327,
-	NV_THERM_COMP_THRESHOLDS_I = 2328,
-	NV_VBATT_COMP_THRESHOLDS_I = 2329,
-	NV_WCDMA_C0_TX_COMP_VS_FREQ_0_I = 2330,
-	NV_WCDMA_C0_TX_COMP_VS_FREQ_1_I = 2331,
-	NV_WCDMA_C1_TX_COMP_VS_FREQ_0_I = 2332,
-	NV_WCDMA_C1_TX_COMP_VS_FREQ_1_I = 2333,
-	NV_WCDMA_TX_LIM_VS_VOLT_OFFSET_I = 2334,
-	NV_GSM_VL_TL_PRUI_14_I = 2335,
-	NV_GSM_VL_TL_PRUI_13_I = 2336,
-	NV_GSM_VL_TL_PRUI_12_I = 2337,
-	NV_GSM_VL_TL_PRDI_14_I = 2338,
-	NV_GSM_VL_TL_PRDI_13_I = 2339,
-	NV_GSM_VL_TL_PRDI_12_I = 2340,
-	NV_DCS_VL_TL_PRUI_15_I = 2341,
-	NV_DCS_VL_TL_PRUI_14_I = 2342,
-	NV_DCS_VL_TL_PRUI_13_I = 2343,
-	NV_DCS_VL_TL_PRDI_15_I = 2344,
-	NV_DCS_VL_TL_PRDI_14_I = 2345,
-	NV_DCS_VL_TL_PRDI_13_I = 2346,
-	NV_GSM_1900_VL_TL_PRUI_15_I = 2347,
-	NV_GSM_1900_VL_TL_PRUI_14_I = 2348,
-	NV_GSM_1900_VL_TL_PRUI_13_I = 2349,
-	NV_GSM_1900_VL_TL_PRDI_15_I = 2350,
-	NV_GSM_1900_VL_TL_PRDI_14_I = 2351,
-	NV_GSM_1900_VL_TL_PRDI_13_I = 2352,
-	NV_GSM_VM_TL_PRUI_14_I = 2353,
-	NV_GSM_VM_TL_PRUI_13_I = 2354,
-	NV_GSM_VM_TL_PRUI_12_I = 2355,
-	NV_GSM_VM_TL_PRDI_14_I = 2356,
-	NV_GSM_VM_TL_PRDI_13_I = 2357,
-	NV_GSM_VM_TL_PRDI_12_I = 2358,
-	NV_DCS_VM_TL_PRUI_15_I = 2359,
-	NV_DCS_VM_TL_PRUI_14_I = 2360,
-	NV_DCS_VM_TL_PRUI_13_I = 2361,
-	NV_DCS_VM_TL_PRDI_15_I = 2362,
-	NV_DCS_VM_TL_PRDI_14_I = 2363,
-	NV_DCS_VM_TL_PRDI_13_I = 2364,
-	NV_GSM_1900_VM_TL_PRUI_15_I = 2365,
-	NV_GSM_1900_VM_TL_PRUI_14_I = 2366,
-	NV_GSM_1900_VM_TL_PRUI_13_I = 2367,
-	NV_GSM_1900_VM_TL_PRDI_15_I = 2368,
-	NV_GSM_1900_VM_TL_PRDI_14_I = 2369,
-	NV_GSM_1900_VM_TL_PRDI_13_I = 2370,
-	NV_GSM_VH_TL_PRUI_14_I = 2371,
-	NV_GSM_VH_TL_PRUI_13_I = 2372,
-	NV_GSM_VH_TL_PRUI_12_I = 2373,
-	NV_GSM_VH_TL_PRDI_14_I = 2374,
-	NV_GSM_VH_TL_PRDI_13_I = 2375,
-	NV_GSM_VH_TL_PRDI_12_I = 2376,
-	NV_DCS_VH_TL_PRUI_15_I = 2377,
-	NV_DCS_VH_TL_PRUI_14_I = 2378,
-	NV_DCS_VH_TL_PRUI_13_I = 2379,
-	NV_DCS_VH_TL_PRDI_15_I = 2380,
-	NV_DCS_VH_TL_PRDI_14_I = 2381,
-	NV_DCS_VH_TL_PRDI_13_I = 2382,
-	NV_GSM_1900_VH_TL_PRUI_15_I = 2383,
-	NV_GSM_1900_VH_TL_PRUI_14_I = 2384,
-	NV_GSM_1900_VH_TL_PRUI_13_I = 2385,
-	NV_GSM_1900_VH_TL_PRDI_15_I = 2386,
-	NV_GSM_1900_VH_TL_PRDI_14_I = 2387,
-	NV_GSM_1900_VH_TL_PRDI_13_I = 2388,
-	NV_GSM_VL_TM_PRUI_14_I = 2389,
-	NV_GSM_VL_TM_PRUI_13_I = 2390,
-	NV_GSM_VL_TM_PRUI_12_I = 2391,
-	NV_GSM_VL_TM_PRDI_14_I = 2392,
-	NV_GSM_VL_TM_PRDI_13_I = 2393,
-	NV_GSM_VL_TM_PRDI_12_I = 2394,
-	NV_DCS_VL_TM_PRUI_15_I = 2395,
-	NV_DCS_VL_TM_PRUI_14_I = 2396,
-	NV_DCS_VL_TM_PRUI_13_I = 2397,
-	NV_DCS_VL_TM_PRDI_15_I = 2398,
-	NV_DCS_VL_TM_PRDI_14_I = 2399,
-	NV_DCS_VL_TM_PRDI_13_I = 2400,
-	NV_GSM_1900_VL_TM_PRUI_15_I = 2401,
-	NV_GSM_1900_VL_TM_PRUI_14_I = 2402,
-	NV_GSM_1900_VL_TM_PRUI_13_I = 2403,
-	NV_GSM_1900_VL_TM_PRDI_15_I = 2404,
-	NV_GSM_1900_VL_TM_PRDI_14_I = 2405,
-	NV_GSM_1900_VL_TM_PRDI_13_I = 2406,
-	NV_GSM_VM_TM_PRUI_14_I = 2407,
-	NV_GSM_VM_TM_PRUI_13_I = 2408,
-	NV_GSM_VM_TM_PRUI_12_I = 2409,
-	NV_GSM_VM_TM_PRDI_14_I = 2410,
-	NV_GSM_VM_TM_PRDI_13_I = 2411,
-	NV_GSM_VM_TM_PRDI_12_I = 2412,
-	NV_DCS_VM_TM_PRUI_15_I = 2413,
-	NV_DCS_VM_TM_PRUI_14_I = 2414,
-	NV_DCS_VM_TM_PRUI_13_I = 2415,
-	NV_DCS_VM_TM_PRDI_15_I = 2416,
-	NV_DCS_VM_TM_PRDI_14_I = 2417,
-	NV_DCS_VM_TM_PRDI_13_I = 2418,
-	NV_GSM_1900_VM_TM_PRUI_15_I = 2419,
-	NV_GSM_1900_VM_TM_PRUI_14_I = 2420,
-	NV_GSM_1900_VM_TM_PRUI_13_I = 2421,
-	NV_GSM_1900_VM_TM_PRDI_15_I = 2422,
-	NV_GSM_1900_VM_TM_PRDI_14_I = 2423,
-	NV_GSM_1900_VM_TM_PRDI_13_I = 2424,
-	NV_GSM_VH_TM_PRUI_14_I = 2425,
-	NV_GSM_VH_TM_PRUI_13_I = 2426,
-	NV_GSM_VH_TM_PRUI_12_I = 2427,
-	NV_GSM_VH_TM_PRDI_14_I = 2428,
-	NV_GSM_VH_TM_PRDI_13_I = 2429,
-	NV_GSM_VH_TM_PRDI_12_I = 2430,
-	NV_DCS_VH_TM_PRUI_15_I = 2431,
-	NV_DCS_VH_TM_PRUI_14_I = 2432,
-	NV_DCS_VH_TM_PRUI_13_I = 2433,
-	NV_DCS_VH_TM_PRDI_15_I = 2434,
-	NV_DCS_VH_TM_PRDI_14_I = 2435,
-	NV_DCS_VH_TM_PRDI_13_I = 2436,
-	NV_GSM_1900_VH_TM_PRUI_15_I = 2437,
-	NV_GSM_1900_VH_TM_PRUI_14_I = 2438,
-	NV_GSM_1900_VH_TM_PRUI_13_I = 2439,
-	NV_GSM_1900_VH_TM_PRDI_15_I = 2440,
-	NV_GSM_1900_VH_TM_PRDI_14_I = 2441,
-	NV_GSM_1900_VH_TM_PRDI_13_I = 2442,
-	NV_GSM_VL_TH_PRUI_14_I = 2443,
-	NV_GSM_VL_TH_PRUI_13_I = 2444,
-	NV_GSM_VL_TH_PRUI_12_I = 2445,
-	NV_GSM_VL_TH_PRDI_14_I = 2446,
-	NV_GSM_VL_TH_PRDI_13_I = 2447,
-	NV_GSM_VL_TH_PRDI_12_I = 2448,
-	NV_DCS_VL_TH_PRUI_15_I = 2449,
-	NV_DCS_VL_TH_PRUI_14_I = 2450,
-	NV_DCS_VL_TH_PRUI_13_I = 2451,
-	NV_DCS_VL_TH_PRDI_15_I = 2452,
-	NV_DCS_VL_TH_PRDI_14_I = 2453,
-	NV_DCS_VL_TH_PRDI_13_I = 2454,
-	NV_GSM_1900_VL_TH_PRUI_15_I = 2455,
-	NV_GSM_1900_VL_TH_PRUI_14_I = 2456,
-	NV_GSM_1900_VL_TH_PRUI_13_I = 2457,
-	NV_GSM_1900_VL_TH_PRDI_15_I = 2458,
-	NV_GSM_1900_VL_TH_PRDI_14_I = 2459,
-	NV_GSM_1900_VL_TH_PRDI_13_I = 2460,
-	NV_GSM_VM_TH_PRUI_14_I = 2461,
-	NV_GSM_VM_TH_PRUI_13_I = 2462,
-	NV_GSM_VM_TH_PRUI_12_I = 2463,
-	NV_GSM_VM_TH_PRDI_14_I = 2464,
-	NV_GSM_VM_TH_PRDI_13_I = 2465,
-	NV_GSM_VM_TH_PRDI_12_I = 2466,
-	NV_DCS_VM_TH_PRUI_15_I = 2467,
-	NV_DCS_VM_TH_PRUI_14_I = 2468,
-	NV_DCS_VM_TH_PRUI_13_I = 2469,
-	NV_DCS_VM_TH_PRDI_15_I = 2470,
-	NV_DCS_VM_TH_PRDI_14_I = 2471,
-	NV_DCS_VM_TH_PRDI_13_I = 2472,
-	NV_GSM_1900_VM_TH_PRUI_15_I = 2473,
-	NV_GSM_1900_VM_TH_PRUI_14_I = 2474,
-	NV_GSM_1900_VM_TH_PRUI_13_I = 2475,
-	NV_GSM_1900_VM_TH_PRDI_15_I = 2476,
-	NV_GSM_1900_VM_TH_PRDI_14_I = 2477,
-	NV_GSM_1900_VM_TH_PRDI_13_I = 2478,
-	NV_GSM_VH_TH_PRUI_14_I = 2479,
-	NV_GSM_VH_TH_PRUI_13_I = 2480,
-	NV_GSM_VH_TH_PRUI_12_I = 2481,
-	NV_GSM_VH_TH_PRDI_14_I = 2482,
-	NV_GSM_VH_TH_PRDI_13_I = 2483,
-	NV_GSM_VH_TH_PRDI_12_I = 2484,
-	NV_DCS_VH_TH_PRUI_15_I = 2485,
-	NV_DCS_VH_TH_PRUI_14_I = 2486,
-	NV_DCS_VH_TH_PRUI_13_I = 2487,
-	NV_DCS_VH_TH_PRDI_15_I = 2488,
-	NV_DCS_VH_TH_PRDI_14_I = 2489,
-	NV_DCS_VH_TH_PRDI_13_I = 2490,
-	NV_GSM_1900_VH_TH_PRUI_15_I = 2491,
-	NV_GSM_1900_VH_TH_PRUI_14_I = 2492,
-	NV_GSM_1900_VH_TH_PRUI_13_I = 2493,
-	NV_GSM_1900_VH_TH_PRDI_15_I = 2494,
-	NV_GSM_1900_VH_TH_PRDI_14_I = 2495,
-	NV_GSM_1900_VH_TH_PRDI_13_I = 2496,
-	NV_FACTORY_DATA_1_I = 2497,
-	NV_FACTORY_DATA_2_I = 2498,
-	NV_FACTORY_DATA_3_I = 2499,
-	NV_FACTORY_DATA_4_I = 2500,
-	NV_GSM_PRUI_11_I = 2501,
-	NV_GSM_1900_PRDI_00_I = 2502,
-	NV_GSM_1900_PRDI_01_I = 2503,
-	NV_GSM_1900_PRDI_11_I = 2504,
-	NV_GSM_1900_PRDI_08_I = 2505,
-	NV_APPX5_PREF_I = 2506,
-	NV_WLAN_NET_SEL_MODE_PREF_I = 2507,
-	NV_EDGE_FEATURE_SUPPORT_I = 2508,
-	NV_EDGE_MULTISLOT_CLASS_I = 2509,
-	NV_EDGE_8PSK_POWER_CLASS_I = 2510,
-	NV_EDGE_8PSK_POWER_CAPABILITY_I = 2511,
-	NV_GERAN_FEATURE_PACK_1_I = 2512,
-	NV_GSM_AMAM_MAX_PWR_I = 2513,
-	NV_GSM_AMAM_MIN_PWR_I = 2514,
-	NV_DCS_AMAM_MAX_PWR_I = 2515,
-	NV_DCS_AMAM_MIN_PWR_I = 2516,
-	NV_GSM_850_AMAM_MAX_PWR_I = 2517,
-	NV_GSM_850_AMAM_MIN_PWR_I = 2518,
-	NV_GSM_1900_AMAM_MAX_PWR_I = 2519,
-	NV_GSM_1900_AMAM_MIN_PWR_I = 2520,
-	NV_GSM_AMAM_MASTER_TBL_SEG1_F1_I = 2521,
-	NV_GSM_AMAM_MASTER_TBL_SEG2_F1_I = 2522,
-	NV_GSM_AMAM_MASTER_TBL_SEG3_F1_I = 2523,
-	NV_GSM_AMAM_MASTER_TBL_SEG4_F1_I = 2524,
-	NV_GSM_AMAM_MASTER_TBL_SEG5_F1_I = 2525,
-	NV_GSM_AMAM_MASTER_TBL_SEG6_F1_I = 2526,
-	NV_GSM_AMAM_MASTER_TBL_SEG7_F1_I = 2527,
-	NV_GSM_AMAM_MASTER_TBL_SEG8_F1_I = 2528,
-	NV_DCS_AMAM_MASTER_TBL_SEG1_F1_I = 2529,
-	NV_DCS_AMAM_MASTER_TBL_SEG2_F1_I = 2530,
-	NV_DCS_AMAM_MASTER_TBL_SEG3_F1_I = 2531,
-	NV_DCS_AMAM_MASTER_TBL_SEG4_F1_I = 2532,
-	NV_DCS_AMAM_MASTER_TBL_SEG5_F1_I = 2533,
-	NV_DCS_AMAM_MASTER_TBL_SEG6_F1_I = 2534,
-	NV_DCS_AMAM_MASTER_TBL_SEG7_F1_I = 2535,
-	NV_DCS_AMAM_MASTER_TBL_SEG8_F1_I = 2536,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG1_F1_I = 2537,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG2_F1_I = 2538,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG3_F1_I = 2539,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG4_F1_I = 2540,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG5_F1_I = 2541,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG6_F1_I = 2542,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG7_F1_I = 2543,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG8_F1_I = 2544,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG1_F1_I = 2545,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG2_F1_I = 2546,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG3_F1_I = 2547,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG4_F1_I = 2548,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG5_F1_I = 2549,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG6_F1_I = 2550,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG7_F1_I = 2551,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG8_F1_I = 2552,
-	NV_GSM_AMAM_MASTER_TBL_SEG1_F2_I = 2553,
-	NV_GSM_AMAM_MASTER_TBL_SEG2_F2_I = 2554,
-	NV_GSM_AMAM_MASTER_TBL_SEG3_F2_I = 2555,
-	NV_GSM_AMAM_MASTER_TBL_SEG4_F2_I = 2556,
-	NV_GSM_AMAM_MASTER_TBL_SEG5_F2_I = 2557,
-	NV_GSM_AMAM_MASTER_TBL_SEG6_F2_I = 2558,
-	NV_GSM_AMAM_MASTER_TBL_SEG7_F2_I = 2559,
-	NV_GSM_AMAM_MASTER_TBL_SEG8_F2_I = 2560,
-	NV_DCS_AMAM_MASTER_TBL_SEG1_F2_I = 2561,
-	NV_DCS_AMAM_MASTER_TBL_SEG2_F2_I = 2562,
-	NV_DCS_AMAM_MASTER_TBL_SEG3_F2_I = 2563,
-	NV_DCS_AMAM_MASTER_TBL_SEG4_F2_I = 2564,
-	NV_DCS_AMAM_MASTER_TBL_SEG5_F2_I = 2565,
-	NV_DCS_AMAM_MASTER_TBL_SEG6_F2_I = 2566,
-	NV_DCS_AMAM_MASTER_TBL_SEG7_F2_I = 2567,
-	NV_DCS_AMAM_MASTER_TBL_SEG8_F2_I = 2568,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG1_F2_I = 2569,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG2_F2_I = 2570,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG3_F2_I = 2571,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG4_F2_I = 2572,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG5_F2_I = 2573,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG6_F2_I = 2574,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG7_F2_I = 2575,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG8_F2_I = 2576,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG1_F2_I = 2577,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG2_F2_I = 2578,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG3_F2_I = 2579,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG4_F2_I = 2580,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG5_F2_I = 2581,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG6_F2_I = 2582,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG7_F2_I = 2583,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG8_F2_I = 2584,
-	NV_GSM_AMPM_MASTER_TBL_SEG1_F1_I = 2585,
-	NV_GSM_AMPM_MASTER_TBL_SEG2_F1_I = 2586,
-	NV_GSM_AMPM_MASTER_TBL_SEG3_F1_I = 2587,
-	NV_GSM_AMPM_MASTER_TBL_SEG4_F1_I = 2588,
-	NV_GSM_AMPM_MASTER_TBL_SEG5_F1_I = 2589,
-	NV_GSM_AMPM_MASTER_TBL_SEG6_F1_I = 2590,
-	NV_GSM_AMPM_MASTER_TBL_SEG7_F1_I = 2591,
-	NV_GSM_AMPM_MASTER_TBL_SEG8_F1_I = 2592,
-	NV_DCS_AMPM_MASTER_TBL_SEG1_F1_I = 2593,
-	NV_DCS_AMPM_MASTER_TBL_SEG2_F1_I = 2594,
-	NV_DCS_AMPM_MASTER_TBL_SEG3_F1_I = 2595,
-	NV_DCS_AMPM_MASTER_TBL_SEG4_F1_I = 2596,
-	NV_DCS_AMPM_MASTER_TBL_SEG5_F1_I = 2597,
-	NV_DCS_AMPM_MASTER_TBL_SEG6_F1_I = 2598,
-	NV_DCS_AMPM_MASTER_TBL_SEG7_F1_I = 2599,
-	NV_DCS_AMPM_MASTER_TBL_SEG8_F1_I = 2600,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG1_F1_I = 2601,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG2_F1_I = 2602,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG3_F1_I = 2603,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG4_F1_I = 2604,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG5_F1_I = 2605,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG6_F1_I = 2606,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG7_F1_I = 2607,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG8_F1_I = 2608,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG1_F1_I = 2609,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG2_F1_I = 2610,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG3_F1_I = 2611,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG4_F1_I = 2612,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG5_F1_I = 2613,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG6_F1_I = 2614,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG7_F1_I = 2615,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG8_F1_I = 2616,
-	NV_GSM_AMPM_MASTER_TBL_SEG1_F2_I = 2617,
-	NV_GSM_AMPM_MASTER_TBL_SEG2_F2_I = 2618,
-	NV_GSM_AMPM_MASTER_TBL_SEG3_F2_I = 2619,
-	NV_GSM_AMPM_MASTER_TBL_SEG4_F2_I = 2620,
-	NV_GSM_AMPM_MASTER_TBL_SEG5_F2_I = 2621,
-	NV_GSM_AMPM_MASTER_TBL_SEG6_F2_I = 2622,
-	NV_GSM_AMPM_MASTER_TBL_SEG7_F2_I = 2623,
-	NV_GSM_AMPM_MASTER_TBL_SEG8_F2_I = 2624,
-	NV_DCS_AMPM_MASTER_TBL_SEG1_F2_I = 2625,
-	NV_DCS_AMPM_MASTER_TBL_SEG2_F2_I = 2626,
-	NV_DCS_AMPM_MASTER_TBL_SEG3_F2_I = 2627,
-	NV_DCS_AMPM_MASTER_TBL_SEG4_F2_I = 2628,
-	NV_DCS_AMPM_MASTER_TBL_SEG5_F2_I = 2629,
-	NV_DCS_AMPM_MASTER_TBL_SEG6_F2_I = 2630,
-	NV_DCS_AMPM_MASTER_TBL_SEG7_F2_I = 2631,
-	NV_DCS_AMPM_MASTER_TBL_SEG8_F2_I = 2632,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG1_F2_I = 2633,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG2_F2_I = 2634,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG3_F2_I = 2635,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG4_F2_I = 2636,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG5_F2_I = 2637,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG6_F2_I = 2638,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG7_F2_I = 2639,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG8_F2_I = 2640,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG1_F2_I = 2641,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG2_F2_I = 2642,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG3_F2_I = 2643,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG4_F2_I = 2644,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG5_F2_I = 2645,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG6_F2_I = 2646,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG7_F2_I = 2647,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG8_F2_I = 2648,
-	NV_GSM_CALPATH_RSB_A_G1_I = 2649,
-	NV_GSM_CALPATH_RSB_B_G1_I = 2650,
-	NV_GSM_850_CALPATH_RSB_A_G1_I = 2651,
-	NV_GSM_850_CALPATH_RSB_B_G1_I = 2652,
-	NV_DCS_CALPATH_RSB_A_G1_I = 2653,
-	NV_DCS_CALPATH_RSB_B_G1_I = 2654,
-	NV_GSM_1900_CALPATH_RSB_A_G1_I = 2655,
-	NV_GSM_1900_CALPATH_RSB_B_G1_I = 2656,
-	NV_GSM_CALPATH_RSB_A_G2_I = 2657,
-	NV_GSM_CALPATH_RSB_B_G2_I = 2658,
-	NV_GSM_850_CALPATH_RSB_A_G2_I = 2659,
-	NV_GSM_850_CALPATH_RSB_B_G2_I = 2660,
-	NV_DCS_CALPATH_RSB_A_G2_I = 2661,
-	NV_DCS_CALPATH_RSB_B_G2_I = 2662,
-	NV_GSM_1900_CALPATH_RSB_A_G2_I = 2663,
-	NV_GSM_1900_CALPATH_RSB_B_G2_I = 2664,
-	NV_GSM_AMAM_GAIN_LOW_TEMP_I = 2665,
-	NV_GSM_AMAM_DC_LOW_TEMP_I = 2666,
-	NV_GSM_AMAM_GAIN_HIGH_TEMP_I = 2667,
-	NV_GSM_AMAM_DC_HIGH_TEMP_I = 2668,
-	NV_GSM_AMAM_GAIN_NOM_TEMP_I = 2669,
-	NV_GSM_AMAM_DC_NOM_TEMP_I = 2670,
-	NV_GSM_850_AMAM_GAIN_LOW_TEMP_I = 2671,
-	NV_GSM_850_AMAM_DC_LOW_TEMP_I = 2672,
-	NV_GSM_850_AMAM_GAIN_HIGH_TEMP_I = 2673,
-	NV_GSM_850_AMAM_DC_HIGH_TEMP_I = 2674,
-	NV_GSM_850_AMAM_GAIN_NOM_TEMP_I = 2675,
-	NV_GSM_850_AMAM_DC_NOM_TEMP_I = 2676,
-	NV_DCS_AMAM_GAIN_LOW_TEMP_I = 2677,
-	NV_DCS_AMAM_DC_LOW_TEMP_I = 2678,
-	NV_DCS_AMAM_GAIN_HIGH_TEMP_I = 2679,
-	NV_DCS_AMAM_DC_HIGH_TEMP_I = 2680,
-	NV_DCS_AMAM_GAIN_NOM_TEMP_I = 2681,
-	NV_DCS_AMAM_DC_NOM_TEMP_I = 2682,
-	NV_GSM_1900_AMAM_GAIN_LOW_TEMP_I = 2683,
-	NV_GSM_1900_AMAM_DC_LOW_TEMP_I = 2684,
-	NV_GSM_1900_AMAM_GAIN_HIGH_TEMP_I = 2685,
-	NV_GSM_1900_AMAM_DC_HIGH_TEMP_I = 2686,
-	NV_GSM_1900_AMAM_GAIN_NOM_TEMP_I = 2687,
-	NV_GSM_1900_AMAM_DC_NOM_TEMP_I = 2688,
-	NV_GSM_AMAM_ARFCN_I = 2689,
-	NV_DCS_AMAM_ARFCN_I = 2690,
-	NV_GSM_850_AMAM_ARFCN_I = 2691,
-	NV_GSM_1900_AMAM_ARFCN_I = 2692,
-	NV_ABNORMAL_EXIT_COUNT_I = 2693,
-	NV_SYS_STRUCT_FCT_FILE_NAME_I = 2694,
-	NV_SYS_STRUCT_FCT_FILE_XSUM_I = 2695,
-	NV_SYS_CUSTOM_INI_FILE_NAME_I = 2696,
-	NV_SYS_CUSTOM_INI_FILE_XSUM_I = 2697,
-	NV_SYS_STD_MAP_FILE_VER_I = 2698,
-	NV_SYS_STD_MAP_FILE_XSUM_I = 2699,
-	NV_SYS_SPC_DELTA_FILE_VER_I = 2700,
-	NV_SYS_SPC_DELTA_FILE_XSUM_I = 2701,
-	NV_LCD_ID_I = 2702,
-	NV_WCDMA_PA_RANGE_FOR_DVS_I = 2703,
-	NV_WCDMA_PA_COMPENSATE_UP_WITH_DVS_I = 2704,
-	NV_WCDMA_PA_COMPENSATE_DN_WITH_DVS_I = 2705,
-	NV_WCDMA_1900_PA_RANGE_FOR_DVS_I = 2706,
-	NV_WCDMA_1900_PA_COMPENSATE_UP_WITH_DVS_I = 2707,
-	NV_WCDMA_1900_PA_COMPENSATE_DN_WITH_DVS_I = 2708,
-	NV_WCDMA_800_PA_RANGE_FOR_DVS_I = 2709,
-	NV_WCDMA_800_PA_COMPENSATE_UP_WITH_DVS_I = 2710,
-	NV_WCDMA_800_PA_COMPENSATE_DN_WITH_DVS_I = 2711,
-	NV_WCDMA_MAX_PWR_BACKOFF_VOLTAGES_I = 2712,
-	NV_WCDMA_MAX_PWR_BACKOFF_VOLT1_I = 2713,
-	NV_WCDMA_MAX_PWR_BACKOFF_VOLT2_I = 2714,
-	NV_WCDMA_MAX_PWR_BACKOFF_VOLT3_I = 2715,
-	NV_WCDMA_1900_MAX_PWR_BACKOFF_VOLTAGES_I = 2716,
-	NV_WCDMA_1900_MAX_PWR_BACKOFF_VOLT1_I = 2717,
-	NV_WCDMA_1900_MAX_PWR_BACKOFF_VOLT2_I = 2718,
-	NV_WCDMA_1900_MAX_PWR_BACKOFF_VOLT3_I = 2719,
-	NV_WCDMA_800_MAX_PWR_BACKOFF_VOLTAGES_I = 2720,
-	NV_WCDMA_800_MAX_PWR_BACKOFF_VOLT1_I = 2721,
-	NV_WCDMA_800_MAX_PWR_BACKOFF_VOLT2_I = 2722,
-	NV_WCDMA_800_MAX_PWR_BACKOFF_VOLT3_I = 2723,
-	NV_WCDMA_HS_R1_RISE_I = 2724,
-	NV_WCDMA_HS_R1_FALL_I = 2725,
-	NV_WCDMA_HS_R2_RISE_I = 2726,
-	NV_WCDMA_HS_R2_FALL_I = 2727,
-	NV_WCDMA_HS_R3_RISE_I = 2728,
-	NV_WCDMA_HS_R3_FALL_I = 2729,
-	NV_WCDMA_1900_HS_R1_RISE_I = 2730,
-	NV_WCDMA_1900_HS_R1_FALL_I = 2731,
-	NV_WCDMA_1900_HS_R2_RISE_I = 2732,
-	NV_WCDMA_1900_HS_R2_FALL_I = 2733,
-	NV_WCDMA_1900_HS_R3_RISE_I = 2734,
-	NV_WCDMA_1900_HS_R3_FALL_I = 2735,
-	NV_WCDMA_800_HS_R1_RISE_I = 2736,
-	NV_WCDMA_800_HS_R1_FALL_I = 2737,
-	NV_WCDMA_800_HS_R2_RISE_I = 2738,
-	NV_WCDMA_800_HS_R2_FALL_I = 2739,
-	NV_WCDMA_800_HS_R3_RISE_I = 2740,
-	NV_WCDMA_800_HS_R3_FALL_I = 2741,
-	NV_GSM_AUTOCAL_PWR_DAC_F1_I = 2742,
-	NV_GSM_AMAM_DYNAMIC_RANGE_I = 2743,
-	NV_DCS_AUTOCAL_PWR_DAC_F1_I = 2744,
-	NV_DCS_AMAM_DYNAMIC_RANGE_I = 2745,
-	NV_GSM_850_AUTOCAL_PWR_DAC_F1_I = 2746,
-	NV_GSM_850_AMAM_DYNAMIC_RANGE_I = 2747,
-	NV_GSM_1900_AUTOCAL_PWR_DAC_F1_I = 2748,
-	NV_GSM_1900_AMAM_DYNAMIC_RANGE_I = 2749,
-	NV_GSM_CALPATH_RSB_I = 2750,
-	NV_DCS_CALPATH_RSB_I = 2751,
-	NV_GSM_850_CALPATH_RSB_I = 2752,
-	NV_GSM_1900_CALPATH_RSB_I = 2753,
-	NV_GSM_AMAM_SYS_GAIN_DC_CORR_I = 2754,
-	NV_GSM_850_AMAM_SYS_GAIN_DC_CORR_I = 2755,
-	NV_DCS_AMAM_SYS_GAIN_DC_CORR_I = 2756,
-	NV_GSM_1900_AMAM_SYS_GAIN_DC_CORR_I = 2757,
-	NV_GSM_AMAM_ARFCN_F1_I = 2758,
-	NV_DCS_AMAM_ARFCN_F1_I = 2759,
-	NV_GSM_850_AMAM_ARFCN_F1_I = 2760,
-	NV_GSM_1900_AMAM_ARFCN_F1_I = 2761,
-	NV_GSM_AMAM_ARFCN_F2_I = 2762,
-	NV_DCS_AMAM_ARFCN_F2_I = 2763,
-	NV_GSM_850_AMAM_ARFCN_F2_I = 2764,
-	NV_GSM_1900_AMAM_ARFCN_F2_I = 2765,
-	NV_GSM_AUTOCAL_PWR_DAC_F2_I = 2766,
-	NV_DCS_AUTOCAL_PWR_DAC_F2_I = 2767,
-	NV_GSM_850_AUTOCAL_PWR_DAC_F2_I = 2768,
-	NV_GSM_1900_AUTOCAL_PWR_DAC_F2_I = 2769,
-	NV_GSM_POLAR_PATH_DELAY_I = 2770,
-	NV_DCS_POLAR_PATH_DELAY_I = 2771,
-	NV_GSM_850_POLAR_PATH_DELAY_I = 2772,
-	NV_GSM_1900_POLAR_PATH_DELAY_I = 2773,
-	NV_GSM_OPLL_BW_VAL_I = 2774,
-	NV_DCS_OPLL_BW_VAL_I = 2775,
-	NV_GSM_850_OPLL_BW_VAL_I = 2776,
-	NV_GSM_1900_OPLL_BW_VAL_I = 2777,
-	NV_GSM_BASEBAND_BW_VAL_I = 2778,
-	NV_DCS_BASEBAND_BW_VAL_I = 2779,
-	NV_GSM_850_BASEBAND_BW_VAL_I = 2780,
-	NV_GSM_1900_BASEBAND_BW_VAL_I = 2781,
-	NV_USB_CURRENT_DEVICE_I = 2782,
-	NV_GPS1_MIN_NUM_SVS_I = 2783,
-	NV_AAGPS_DEFAULT_ALLOW_RRC_I = 2784,
-	NV_AAGPS_DEFAULT_MTLR_GUARD_TIMER_I = 2785,
-	NV_AAGPS_DEFAULT_SMLC_COMM_TIMEOUT_I = 2786,
-	NV_AAGPS_DEFAULT_PRESUPL_UE_TIMER1_VALUE_I = 2787,
-	NV_AAGPS_DEFAULT_PRESUPL_UE_TIMER2_VALUE_I = 2788,
-	NV_AAGPS_DEFAULT_PRESUPL_UE_TIMER3_VALUE_I = 2789,
-	NV_ACTIVE_EPZID_TYPE_I = 2790,
-	NV_C0_BC0_RX_CAL_CHAN_LRU_I = 2791,
-	NV_C1_BC0_RX_CAL_CHAN_LRU_I = 2792,
-	NV_C0_BC1_RX_CAL_CHAN_LRU_I = 2793,
-	NV_C1_BC1_RX_CAL_CHAN_LRU_I = 2794,
-	NV_C0_BC3_RX_CAL_CHAN_LRU_I = 2795,
-	NV_C1_BC3_RX_CAL_CHAN_LRU_I = 2796,
-	NV_C0_BC4_RX_CAL_CHAN_LRU_I = 2797,
-	NV_C1_BC4_RX_CAL_CHAN_LRU_I = 2798,
-	NV_C0_BC5_RX_CAL_CHAN_LRU_I = 2799,
-	NV_C1_BC5_RX_CAL_CHAN_LRU_I = 2800,
-	NV_C0_BC6_RX_CAL_CHAN_LRU_I = 2801,
-	NV_C1_BC6_RX_CAL_CHAN_LRU_I = 2802,
-	NV_CCM_VERSION_INFO_I = 2803,
-	NV_TURNOFF_COUNTER_I = 2804,
-	NV_POWERDOWN_STATUS_I = 2805,
-	NV_PHONE_POWER_ON_STATUS_I = 2806,
-	NV_FIRST_POWER_ON_TIME_I = 2807,
-	NV_SW_VERSION_INFO_I = 2808,
-	NV_SET_DATE_FORMAT_I = 2809,
-	NV_SET_TIME_FORMAT_I = 2810,
-	NV_SET_SHOW_TIME_I = 2811,
-	NV_SET_AUTO_TIME_I = 2812,
-	NV_SET_BUDDHIST_YEAR_I = 2813,
-	NV_BC0_HDR_P1_RISE_FALL_OFF_I = 2814,
-	NV_BC1_HDR_P1_RISE_FALL_OFF_I = 2815,
-	NV_BC3_HDR_P1_RISE_FALL_OFF_I = 2816,
-	NV_BC4_HDR_P1_RISE_FALL_OFF_I = 2817,
-	NV_BC5_HDR_P1_RISE_FALL_OFF_I = 2818,
-	NV_BC6_HDR_P1_RISE_FALL_OFF_I = 2819,
-	NV_DS_INCOMING_DATA_RLP_TIMEOUT_I = 2820,
-	NV_DS_DEFAULT_INACTIVITY_RESTORE_TIMEOUT_I = 2821,
-	NV_CHG_USB_NVDISABLE_VAL_I = 2822,
-	NV_CONSORTIUM_CONFIG_I = 2823,
-	NV_DEVICE_SERIAL_NO_I = 2824,
-	NV_DS_MIP_RM_NAI_I = 2825,
-	NV_SMS_BMC_READING_PREF_I = 2826,
-	NV_VOC_HS_MIC_GAIN_ADJUST_I = 2827,
-	NV_AUTO_POWER_OFF_I = 2828,
-	NV_FAST_SEARCH_I = 2829,
-	NV_UPLOADMEDIA_ALBUM_MENU_ENABLED_I = 2830,
-	NV_UPLOADMEDIA_ALBUM_ADDR_I = 2831,
-	NV_UPLOADMEDIA_POSTCARD_MENU_ENABLED_I = 2832,
-	NV_UPLOADMEDIA_POSTCARD_SEPARATOR_I = 2833,
-	NV_UPLOADMEDIA_POSTCARD_ADDR_I = 2834,
-	NV_UPLOADMEDIA_POSTCARD_MAX_CHARACTERS_I = 2835,
-	NV_UPLOADMEDIA_POSTCARD_MAX_RECIPIENTS_I = 2836,
-	NV_UPLOADMEDIA_POSTCARD_AUTO_SAVE_I = 2837,
-	NV_EMAIL_ACTIVE_PROFILE_I = 2838,
-	NV_BT_ACTIVE_I = 2839,
-	NV_BT_VISIBLE_I = 2840,
-	NV_BT_SAP_ENABLE_I = 2841,
-	NV_WCLOCK_AUTO_NITZ_ZONE_DST_I = 2842,
-	NV_TIMEZONE_I = 2843,
-	NV_HDRSCP_BCMCS_ENABLE_I = 2844,
-	NV_WCDMA_1800_VGA_GAIN_OFFSET_I = 2845,
-	NV_WCDMA_1800_VGA_GAIN_OFFSET_VS_FREQ_I = 2846,
-	NV_WCDMA_1800_VGA_GAIN_OFFSET_VS_TEMP_I = 2847,
-	NV_WCDMA_1800_LNA_RANGE_RISE_2_I = 2848,
-	NV_WCDMA_1800_LNA_RANGE_RISE_3_I = 2849,
-	NV_WCDMA_1800_LNA_RANGE_FALL_2_I = 2850,
-	NV_WCDMA_1800_LNA_RANGE_FALL_3_I = 2851,
-	NV_WCDMA_1800_IM_LEVEL_2_I = 2852,
-	NV_WCDMA_1800_IM_LEVEL_3_I = 2853,
-	NV_WCDMA_1800_LNA_RANGE_OFFSET_2_I = 2854,
-	NV_WCDMA_1800_LNA_RANGE_OFFSET_3_I = 2855,
-	NV_WCDMA_1800_LNA_OFFSET_VS_FREQ_2_I = 2856,
-	NV_WCDMA_1800_LNA_OFFSET_VS_FREQ_3_I = 2857,
-	NV_WCDMA_1800_IM2_I_VALUE_I = 2858,
-	NV_WCDMA_1800_IM2_Q_VALUE_I = 2859,
-	NV_WCDMA_1800_IM2_TRANSCONDUCTOR_VALUE_I = 2860,
-	NV_WCDMA_1800_RX_AGC_MIN_2_I = 2861,
-	NV_WCDMA_1800_RX_AGC_MIN_3_I = 2862,
-	NV_WCDMA_1800_LNA_RANGE_RISE_I = 2863,
-	NV_WCDMA_1800_LNA_RANGE_FALL_I = 2864,
-	NV_WCDMA_1800_IM_LEVEL_I = 2865,
-	NV_WCDMA_1800_NONBYPASS_TIMER_I = 2866,
-	NV_WCDMA_1800_BYPASS_TIMER_I = 2867,
-	NV_WCDMA_1800_LNA_RANGE_OFFSET_I = 2868,
-	NV_WCDMA_1800_LNA_OFFSET_VS_FREQ_I = 2869,
-	NV_WCDMA_1800_RX_AGC_MIN_I = 2870,
-	NV_WCDMA_1800_RX_AGC_MAX_I = 2871,
-	NV_WCDMA_1800_AGC_PHASE_OFFSET_I = 2872,
-	NV_WCDMA_1800_TX_LIN_MASTER_0_I = 2873,
-	NV_WCDMA_1800_TX_LIN_MASTER_1_I = 2874,
-	NV_WCDMA_1800_TX_LIN_MASTER_2_I = 2875,
-	NV_WCDMA_1800_TX_LIN_MASTER_3_I = 2876,
-	NV_WCDMA_1800_TX_COMP_VS_FREQ_0_I = 2877,
-	NV_WCDMA_1800_TX_COMP_VS_FREQ_1_I = 2878,
-	NV_WCDMA_1800_TX_COMP_VS_FREQ_2_I = 2879,
-	NV_WCDMA_1800_TX_COMP_VS_FREQ_3_I = 2880,
-	NV_WCDMA_1800_TX_LIN_VS_TEMP_0_I = 2881,
-	NV_WCDMA_1800_TX_LIN_VS_TEMP_1_I = 2882,
-	NV_WCDMA_1800_TX_LIN_VS_TEMP_2_I = 2883,
-	NV_WCDMA_1800_TX_LIN_VS_TEMP_3_I = 2884,
-	NV_WCDMA_1800_TX_SLP_VS_TEMP_0_I = 2885,
-	NV_WCDMA_1800_TX_SLP_VS_TEMP_1_I = 2886,
-	NV_WCDMA_1800_TX_SLP_VS_TEMP_2_I = 2887,
-	NV_WCDMA_1800_TX_SLP_VS_TEMP_3_I = 2888,
-	NV_WCDMA_1800_R1_RISE_I = 2889,
-	NV_WCDMA_1800_R1_FALL_I = 2890,
-	NV_WCDMA_1800_TX_LIM_VS_TEMP_I = 2891,
-	NV_WCDMA_1800_TX_LIM_VS_FREQ_I = 2892,
-	NV_WCDMA_1800_ADJ_FACTOR_I = 2893,
-	NV_WCDMA_1800_EXP_HDET_VS_AGC_I = 2894,
-	NV_WCDMA_1800_HDET_OFF_I = 2895,
-	NV_WCDMA_1800_HDET_SPN_I = 2896,
-	NV_WCDMA_1800_MAX_TX_POWER_I = 2897,
-	NV_WCDMA_1800_OUT_OF_SERVICE_THRESH_I = 2898,
-	NV_WCDMA_1800_ENC_BTF_I = 2899,
-	NV_WCDMA_1800_RX_DELAY_I = 2900,
-	NV_WCDMA_1800_AGC_PA_ON_RISE_DELAY_I = 2901,
-	NV_WCDMA_1800_AGC_PA_ON_FALL_DELAY_I = 2902,
-	NV_WCDMA_1800_AGC_TX_ON_RISE_DELAY_I = 2903,
-	NV_WCDMA_1800_AGC_TX_ON_FALL_DELAY_I = 2904,
-	NV_WCDMA_1800_AGC_UPDATE_TX_AGC_TIME_I = 2905,
-	NV_WCDMA_1800_PA_GAIN_UP_TIME_I = 2906,
-	NV_WCDMA_1800_PA_GAIN_DOWN_TIME_I = 2907,
-	NV_WCDMA_1800_TX_ROT_ANGLE_PA_STATE_00_I = 2908,
-	NV_WCDMA_1800_TX_ROT_ANGLE_PA_STATE_01_I = 2909,
-	NV_WCDMA_1800_TX_ROT_ANGLE_PA_STATE_10_I = 2910,
-	NV_WCDMA_1800_TX_ROT_ANGLE_PA_STATE_11_I = 2911,
-	NV_RFR_VCO_COARSE_TUNING_1800_I = 2912,
-	NV_WCDMA_1800_PA_COMPENSATE_UP_I = 2913,
-	NV_WCDMA_1800_PA_COMPENSATE_DOWN_I = 2914,
-	NV_WCDMA_1800_PRACH_R1_RISE_OFFSET_I = 2915,
-	NV_WCDMA_1800_PRACH_R1_FALL_OFFSET_I = 2916,
-	NV_WCDMA_1800_TX_CAL_CHAN_I = 2917,
-	NV_WCDMA_1800_RX_CAL_CHAN_I = 2918,
-	NV_WCDMA_1800_R2_RISE_I = 2919,
-	NV_WCDMA_1800_R2_FALL_I = 2920,
-	NV_WCDMA_1800_R3_RISE_I = 2921,
-	NV_WCDMA_1800_R3_FALL_I = 2922,
-	NV_WCDMA_1800_PA_COMPENSATE_UP_R2_I = 2923,
-	NV_WCDMA_1800_PA_COMPENSATE_DOWN_R2_I = 2924,
-	NV_WCDMA_1800_PA_COMPENSATE_UP_R3_I = 2925,
-	NV_WCDMA_1800_PA_COMPENSATE_DOWN_R3_I = 2926,
-	NV_WCDMA_1800_PRACH_R2_RISE_OFFSET_I = 2927,
-	NV_WCDMA_1800_PRACH_R2_FALL_OFFSET_I = 2928,
-	NV_WCDMA_1800_PRACH_R3_RISE_OFFSET_I = 2929,
-	NV_WCDMA_1800_PRACH_R3_FALL_OFFSET_I = 2930,
-	NV_WCDMA_1800_PA_RANGE_MAP_I = 2931,
-	NV_WCDMA_1800_PA_RANGE_FOR_DVS_I = 2932,
-	NV_WCDMA_1800_PA_COMPENSATE_UP_WITH_DVS_I = 2933,
-	NV_WCDMA_1800_PA_COMPENSATE_DN_WITH_DVS_I = 2934,
-	NV_WCDMA_1800_MAX_PWR_BACKOFF_VOLTAGES_I = 2935,
-	NV_WCDMA_1800_MAX_PWR_BACKOFF_VOLT1_I = 2936,
-	NV_WCDMA_1800_MAX_PWR_BACKOFF_VOLT2_I = 2937,
-	NV_WCDMA_1800_MAX_PWR_BACKOFF_VOLT3_I = 2938,
-	NV_WCDMA_1800_HS_R1_RISE_I = 2939,
-	NV_WCDMA_1800_HS_R1_FALL_I = 2940,
-	NV_WCDMA_1800_HS_R2_RISE_I = 2941,
-	NV_WCDMA_1800_HS_R2_FALL_I = 2942,
-	NV_WCDMA_1800_HS_R3_RISE_I = 2943,
-	NV_WCDMA_1800_HS_R3_FALL_I = 2944,
-	NV_WCDMA_1800_DCH_AGC_UPDATE_TX_AGC_TIME_I = 2945,
-	NV_WCDMA_1800_AGC_TX_ADJ_PDM_DELAY_I = 2946,
-	NV_WCDMA_1900_DCH_AGC_UPDATE_TX_AGC_TIME_I = 2947,
-	NV_WCDMA_1900_AGC_TX_ADJ_PDM_DELAY_I = 2948,
-	NV_WCDMA_800_DCH_AGC_UPDATE_TX_AGC_TIME_I = 2949,
-	NV_WCDMA_800_AGC_TX_ADJ_PDM_DELAY_I = 2950,
-	NV_WCDMA_DCH_AGC_UPDATE_TX_AGC_TIME_I = 2951,
-	NV_WCDMA_AGC_TX_ADJ_PDM_DELAY_I = 2952,
-	NV_DS_SIP_RM_NAI_I = 2953,
-	NV_BAND_PREF_32_63_I = 2954,
-	NV_MMS_MAX_MSG_SIZE1_I = 2955,
-	NV_MMS_MAX_MSG_SIZE2_I = 2956,
-	NV_MMS_MAX_MSG_SIZE3_I = 2957,
-	NV_MMS_MAX_SIZE_USER_SELECTABLE_I = 2958,
-	NV_MMS_ACTIVE_MAX_MSG_SIZE_I = 2959,
-	NV_MMS_ACTIVE_PROFILE_I = 2960,
-	NV_MMS_HIDE_NUMBER_I = 2961,
-	NV_MMS_REQ_DELIVERY_RPT_I = 2962,
-	NV_MMS_REQ_READ_RPT_I = 2963,
-	NV_MMS_PRIORITY_I = 2964,
-	NV_MMS_VALIDITY_PERIOD_I = 2965,
-	NV_MMS_SLIDE_DURATION_I = 2966,
-	NV_MMS_RETRIEVAL_HOME_I = 2967,
-	NV_MMS_RETRIEVAL_ROAM_I = 2968,
-	NV_MMS_DELIVERY_TIME_I = 2969,
-	NV_MMS_ALLOW_ANON_MSG_I = 2970,
-	NV_MMS_CREATION_MODE_I = 2971,
-	NV_MMS_AUTOSIG_I = 2972,
-	NV_MMS_AUTO_SAVE_I = 2973,
-	NV_MMS_ALLOW_READ_RPT_I = 2974,
-	NV_MMS_ALLOW_DELIVERY_RPT_I = 2975,
-	NV_MMS_MAX_RECIPIENTS_I = 2976,
-	NV_MMS_MAX_STORED_MMS_I = 2977,
-	NV_MMS_SIGNATURE_ACTIVE_TEMPLATE_I = 2978,
-	NV_BT_FILELOCATION_ONDEVICE_I = 2979,
-	NV_WCDMA_UTRAN_TX_LIM_VS_TEMP_OFFSET_I = 2980,
-	NV_WCDMA_1800_UTRAN_TX_LIM_VS_TEMP_OFFSET_I = 2981,
-	NV_WCDMA_800_UTRAN_TX_LIM_VS_TEMP_OFFSET_I = 2982,
-	NV_WCDMA_1900_UTRAN_TX_LIM_VS_TEMP_OFFSET_I = 2983,
-	NV_SENDVIA_CFG_I = 2984,
-	NV_PU_PROMPT_ENABLED_I = 2985,
-	NV_USER_GREETING_I = 2986,
-	NV_SCREENSAVER_STYLE_I = 2987,
-	NV_SCREENSAVER_TIMEOUT_I = 2988,
-	NV_MESSAGING_FONT_I = 2989,
-	NV_SYNCML_DM_ACTIVEPROFILE_I = 2990,
-	NV_SYNCML_DS_ACTIVEPROFILE_I = 2991,
-	NV_SYNCML_SYNCDIRECTION_I = 2992,
-	NV_SYNCML_DATATOSYNC_I = 2993,
-	NV_SYNCML_APPSTOSYNC_I = 2994,
-	NV_MS_SMS_ACTIVE_PROFILE_I = 2995,
-	NV_MS_SMS_TEXT_SIZE_I = 2996,
-	NV_MS_SMS_AUTOHEADER_I = 2997,
-	NV_MS_SMS_AUTOSIGNATURE_I = 2998,
-	NV_MS_SMS_HEADER_ACTIVE_TEMPLATE_I = 2999,
-	NV_MS_SMS_SIGNATURE_ACTIVE_TEMPLATE_I = 3000,
-	NV_MS_SMS_AUTOSAVE_I = 3001,
-	NV_MS_SMS_AUTODELETE_I = 3002,
-	NV_MS_SMS_ALLOW_EMOTICONS_I = 3003,
-	NV_MS_SMS_MAX_SEGMENTS_I = 3004,
-	NV_MS_SMS_MAX_RECIPIENTS_I = 3005,
-	NV_MS_SMS_MAX_NUMBER_OF_SMS_I = 3006,
-	NV_MS_SMS_MAX_TEMPLATES_I = 3007,
-	NV_MS_SMS_OPCO_TYPES_SUPPORTED_I = 3008,
-	NV_MS_SMS_SMSC_ADDRESS1_I = 3009,
-	NV_MS_SMS_SMSC_ADDRESS2_I = 3010,
-	NV_MS_SMS_SMSC_ADDRESS3_I = 3011,
-	NV_MS_SMS_SMSC_ADDRESS4_I = 3012,
-	NV_MS_SMS_SMSC_ADDRESS5_I = 3013,
-	NV_WCDMA_MAX_TX_POWER_DCH_PC4_I = 3014,
-	NV_POC_SHOW_PT_MENU_I = 3015,
-	NV_POC_SERVER_IP1_I = 3016,
-	NV_POC_SERVER_IP2_I = 3017,
-	NV_POC_SERVER_PORT_I = 3018,
-	NV_POC_NAI_I = 3019,
-	NV_POC_BILLING_SERVICE_I = 3020,
-	NV_POC_GLM_PASSWORD_I = 3021,
-	NV_POC_RTP_PORT_I = 3022,
-	NV_POC_SIP_PORT_I = 3023,
-	NV_POC_IS_SIG_COMP_I = 3024,
-	NV_POC_MAX_AUTH_RETRIES_I = 3025,
-	NV_POC_CONNECTION_PROFILE_I = 3026,
-	NV_RF_ANTSEL_UMTS_1800_I = 3027,
-	NV_IM_SHOW_MENU_I = 3028,
-	NV_IM_CONNECTION_PROFILE_I = 3029,
-	NV_IM_PRIMARY_IP_ADDR_I = 3030,
-	NV_IM_PRIMARY_PORT_I = 3031,
-	NV_IM_ENCODING_METHOD_I = 3032,
-	NV_IM_SERVER_NAME_I = 3033,
-	NV_IM_WV_VERSION_I = 3034,
-	NV_BC0_PA_DVS_VOLTAGE_I = 3035,
-	NV_BC1_PA_DVS_VOLTAGE_I = 3036,
-	NV_BC3_PA_DVS_VOLTAGE_I = 3037,
-	NV_BC4_PA_DVS_VOLTAGE_I = 3038,
-	NV_BC5_PA_DVS_VOLTAGE_I = 3039,
-	NV_BC6_PA_DVS_VOLTAGE_I = 3040,
-	NV_EXT_OP_LIST_ENTRY_VALID_I = 3041,
-	NV_EXT_OP_LIST_ENTRY_NAME_I = 3042,
-	NV_EXT_OP_LIST_ENTRY_PLMN_I = 3043,
-	NV_BM_BAT_STATS_I = 3044,
-	NV_DISPLAY_LANGUAGE_OPTIONS_I = 3045,
-	NV_DISPLAY_LANGUAGE_I = 3046,
-	NV_INPUT_LANGUAGE_MODE_I = 3047,
-	NV_INPUT_LANGUAGE_OPTIONS_I = 3048,
-	NV_INPUT_LANGUAGE_I = 3049,
-	NV_SYS_CONVERT_SCRIPT_VER_I = 3050,
-	NV_SYS_PROD_SPEC_CONVERT_SCRIPT_VER_I = 3051,
-	NV_SYS_MANUAL_CONVERT_SCRIPT_VER_I = 3052,
-	NV_IRDA_ACTIVE_I = 3053,
-	NV_IRDA_FILE_LOCATION_I = 3054,
-	NV_GSM_RAMP_UP_STEPS_I = 3055,
-	NV_GSM_RAMP_UP_RAISE_COSINE_POWER_I = 3056,
-	NV_GSM_RAMP_DOWN_STEPS_I = 3057,
-	NV_GSM_RAMP_DOWN_RAISE_COSINE_POWER_I = 3058,
-	NV_GSM_POWER_LEVELS_I = 3059,
-	NV_DCS_POWER_LEVELS_I = 3060,
-	NV_GSM_850_POWER_LEVELS_I = 3061,
-	NV_GSM_1900_POWER_LEVELS_I = 3062,
-	NV_GSM_PA_EN_START_I = 3063,
-	NV_GSM_ANT_TIMING_REL_TO_PA_EN_START_I = 3064,
-	NV_DCS_PA_EN_START_I = 3065,
-	NV_DCS_ANT_TIMING_REL_TO_PA_EN_START_I = 3066,
-	NV_GSM_850_PA_EN_START_I = 3067,
-	NV_GSM_1900_PA_EN_START_I = 3068,
-	NV_GSM_1900_ANT_TIMING_REL_TO_PA_EN_START_I = 3069,
-	NV_GSM_PA_EN_STOP_I = 3070,
-	NV_GSM_ANT_TIMING_REL_TO_PA_EN_STOP_I = 3071,
-	NV_DCS_PA_EN_STOP_I = 3072,
-	NV_DCS_ANT_TIMING_REL_TO_PA_EN_STOP_I = 3073,
-	NV_GSM_850_PA_EN_STOP_I = 3074,
-	NV_GSM_850_ANT_TIMING_REL_TO_PA_EN_STOP_I = 3075,
-	NV_GSM_1900_PA_EN_STOP_I = 3076,
-	NV_GSM_1900_ANT_TIMING_REL_TO_PA_EN_STOP_I = 3077,
-	NV_GSM_AMAM_MASTER_TBL_SEG1_F3_I = 3078,
-	NV_GSM_AMAM_MASTER_TBL_SEG2_F3_I = 3079,
-	NV_GSM_AMAM_MASTER_TBL_SEG3_F3_I = 3080,
-	NV_GSM_AMAM_MASTER_TBL_SEG4_F3_I = 3081,
-	NV_GSM_AMAM_MASTER_TBL_SEG5_F3_I = 3082,
-	NV_GSM_AMAM_MASTER_TBL_SEG6_F3_I = 3083,
-	NV_GSM_AMAM_MASTER_TBL_SEG7_F3_I = 3084,
-	NV_GSM_AMAM_MASTER_TBL_SEG8_F3_I = 3085,
-	NV_DCS_AMAM_MASTER_TBL_SEG1_F3_I = 3086,
-	NV_DCS_AMAM_MASTER_TBL_SEG2_F3_I = 3087,
-	NV_DCS_AMAM_MASTER_TBL_SEG3_F3_I = 3088,
-	NV_DCS_AMAM_MASTER_TBL_SEG4_F3_I = 3089,
-	NV_DCS_AMAM_MASTER_TBL_SEG5_F3_I = 3090,
-	NV_DCS_AMAM_MASTER_TBL_SEG6_F3_I = 3091,
-	NV_DCS_AMAM_MASTER_TBL_SEG7_F3_I = 3092,
-	NV_DCS_AMAM_MASTER_TBL_SEG8_F3_I = 3093,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG1_F3_I = 3094,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG2_F3_I = 3095,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG3_F3_I = 3096,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG4_F3_I = 3097,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG5_F3_I = 3098,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG6_F3_I = 3099,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG7_F3_I = 3100,
-	NV_GSM_850_AMAM_MASTER_TBL_SEG8_F3_I = 3101,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG1_F3_I = 3102,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG2_F3_I = 3103,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG3_F3_I = 3104,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG4_F3_I = 3105,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG5_F3_I = 3106,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG6_F3_I = 3107,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG7_F3_I = 3108,
-	NV_GSM_1900_AMAM_MASTER_TBL_SEG8_F3_I = 3109,
-	NV_GSM_AMPM_MASTER_TBL_SEG1_F3_I = 3110,
-	NV_GSM_AMPM_MASTER_TBL_SEG2_F3_I = 3111,
-	NV_GSM_AMPM_MASTER_TBL_SEG3_F3_I = 3112,
-	NV_GSM_AMPM_MASTER_TBL_SEG4_F3_I = 3113,
-	NV_GSM_AMPM_MASTER_TBL_SEG5_F3_I = 3114,
-	NV_GSM_AMPM_MASTER_TBL_SEG6_F3_I = 3115,
-	NV_GSM_AMPM_MASTER_TBL_SEG7_F3_I = 3116,
-	NV_GSM_AMPM_MASTER_TBL_SEG8_F3_I = 3117,
-	NV_DCS_AMPM_MASTER_TBL_SEG1_F3_I = 3118,
-	NV_DCS_AMPM_MASTER_TBL_SEG2_F3_I = 3119,
-	NV_DCS_AMPM_MASTER_TBL_SEG3_F3_I = 3120,
-	NV_DCS_AMPM_MASTER_TBL_SEG4_F3_I = 3121,
-	NV_DCS_AMPM_MASTER_TBL_SEG5_F3_I = 3122,
-	NV_DCS_AMPM_MASTER_TBL_SEG6_F3_I = 3123,
-	NV_DCS_AMPM_MASTER_TBL_SEG7_F3_I = 3124,
-	NV_DCS_AMPM_MASTER_TBL_SEG8_F3_I = 3125,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG1_F3_I = 3126,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG2_F3_I = 3127,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG3_F3_I = 3128,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG4_F3_I = 3129,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG5_F3_I = 3130,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG6_F3_I = 3131,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG7_F3_I = 3132,
-	NV_GSM_850_AMPM_MASTER_TBL_SEG8_F3_I = 3133,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG1_F3_I = 3134,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG2_F3_I = 3135,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG3_F3_I = 3136,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG4_F3_I = 3137,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG5_F3_I = 3138,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG6_F3_I = 3139,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG7_F3_I = 3140,
-	NV_GSM_1900_AMPM_MASTER_TBL_SEG8_F3_I = 3141,
-	NV_GSM_AMAM_ARFCN_F3_I = 3142,
-	NV_DCS_AMAM_ARFCN_F3_I = 3143,
-	NV_GSM_850_AMAM_ARFCN_F3_I = 3144,
-	NV_GSM_1900_AMAM_ARFCN_F3_I = 3145,
-	NV_GSM_AUTOCAL_PWR_DAC_F3_I = 3146,
-	NV_DCS_AUTOCAL_PWR_DAC_F3_I = 3147,
-	NV_GSM_850_AUTOCAL_PWR_DAC_F3_I = 3148,
-	NV_GSM_1900_AUTOCAL_PWR_DAC_F3_I = 3149,
-	NV_GSM_850_ANT_TIMING_REL_TO_PA_EN_START_I = 3150,
-	NV_GSM_RTR6250_RSB_I = 3151,
-	NV_DCS_RTR6250_RSB_I = 3152,
-	NV_GSM_850_RTR6250_RSB_I = 3153,
-	NV_GSM_1900_RTR6250_RSB_I = 3154,
-	NV_DISPLAY_LANGUAGE_AUTO_I = 3155,
-	NV_INPUT_LANGUAGE_AUTO_I = 3156,
-	NV_BROWSER_DISPLAY_SPLASH_I = 3157,
-	NV_BROWSER_HTTP_REFERER_I = 3158,
-	NV_BROWSER_ACTIVE_PROFILE_I = 3159,
-	NV_BROWSER_DISABLE_IMAGE_I = 3160,
-	NV_BROWSER_DISABLE_SOUND_I = 3161,
-	NV_BROWSER_DISABLE_OBJECT_I = 3162,
-	NV_BROWSER_MAILTO_PHONENUM_I = 3163,
-	NV_BROWSER_MAILTO_EMAIL_I = 3164,
-	NV_BROWSER_COOKIE_ENABLE_I = 3165,
-	NV_BROWSER_SECURE_PROMPT_I = 3166,
-	NV_BROWSER_IDCACHE_I = 3167,
-	NV_BROWSER_TITLE_REGION_I = 3168,
-	NV_BROWSER_SHOWSESSIONINFO_I = 3169,
-	NV_CURRENTLY_ACTIVE_PROFILE_I = 3170,
-	NV_ALLOW_MP3_RINGERS_I = 3171,
-	NV_ALLOW_AACPLUS_RINGERS_I = 3172,
-	NV_ALLOW_NON_DRM_RINGERS_I = 3173,
-	NV_CBS_ENABLED_I = 3174,
-	NV_CBS_MAX_TOPIC_INDEX_I = 3175,
-	NV_CBS_MIN_TOPIC_INDEX_I = 3176,
-	NV_CBS_ALLOW_RECEIVE_I = 3177,
-	NV_CBS_DISPLAY_CELL_INFO_I = 3178,
-	NV_CBS_NUM_SELECTED_TOPICS_I = 3179,
-	NV_IRDA_DEVICE_NAME_I = 3180,
-	NV_IRDA_PNP_DEVICE_ID_I = 3181,
-	NV_IRDA_PNP_MANUFACTURER_I = 3182,
-	NV_IRDA_PNP_NAME_I = 3183,
-	NV_IRDA_PNP_DEVICE_CATEGORY_I = 3184,
-	NV_IRDA_PNP_COMPATIBILITY_COUNT_I = 3185,
-	NV_IRDA_PNP_STATUS_I = 3186,
-	NV_IRDA_PNP_VERSION_I = 3187,
-	NV_DISPLAY_LANGUAGE_GROUP_NUM_I = 3188,
-	NV_POC_AUTO_ANSWER_I = 3189,
-	NV_POC_INCOMING_CALL_TIMEOUT_I = 3190,
-	NV_POC_AUTO_LOGIN_I = 3191,
-	NV_POC_WILDCARDS_I = 3192,
-	NV_POC_HISTORY_LENGTH_I = 3193,
-	NV_POC_SECONDARY_PDP_CONTEXT_I = 3194,
-	NV_POC_EARLY_SESSION_I = 3195,
-	NV_POC_QOS_MODE_I = 3196,
-	NV_POC_MAX_CONCURRENT_USER_LIMIT1_I = 3197,
-	NV_POC_MAX_CONCURRENT_USER_LIMIT2_I = 3198,
-	NV_POC_MAX_CONCURRENT_USER_LIMIT3_I = 3199,
-	NV_POC_BUFFERED_PACKETS_I = 3200,
-	NV_POC_SPEAKER_PHONE_I = 3201,
-	NV_IM_NOTIFICATION_I = 3202,
-	NV_IM_AUTO_LOGIN_I = 3203,
-	NV_IM_SUPPORTED_BEARERS_I = 3204,
-	NV_IM_SUPPORTED_CIR_METHODS_I = 3205,
-	NV_IM_MAX_SEARCH_RESULTS_I = 3206,
-	NV_IM_SHORT_LOGIN_SEQUENCE_I = 3207,
-	NV_IM_NO_CONTACTS_EXIST_I = 3208,
-	NV_IM_SEND_FILE_DISABLED_I = 3209,
-	NV_IM_VERSION_DISCOVERY_I = 3210,
-	NV_IM_LOGIN_TYPE_I = 3211,
-	NV_IM_INITIAL_DELIVERY_METHOD_I = 3212,
-	NV_IM_ANY_CONTENT_I = 3213,
-	NV_IM_ACCEPTED_CHAR_SETS_I = 3214,
-	NV_IM_ACCEPTED_CONTENT_TYPES_I = 3215,
-	NV_IM_ACCEPTED_TRANSFER_ENCODINGS_I = 3216,
-	NV_IM_ACCEPTED_CONTENT_LENGTH_I = 3217,
-	NV_IM_PARSER_SIZE_I = 3218,
-	NV_IM_MAX_SAVED_CONVERSATIONS_I = 3219,
-	NV_IM_MAX_CONCURRENT_CONVERSATIONS_I = 3220,
-	NV_IM_SUPPORTED_BEARER_COUNT_I = 3221,
-	NV_IM_SERVER_PORT_I = 3222,
-	NV_IM_HIDE_SERVER_I = 3223,
-	NV_IM_ALLOW_CHANGE_SERVER_I = 3224,
-	NV_IM_INTERNET_PROFILE_I = 3225,
-	NV_IM_KNOCK_SERVICE_TIMEOUT_I = 3226,
-	NV_IM_PASSWORD_I = 3227,
-	NV_IM_CIR_PORT_I = 3228,
-	NV_IM_SCHEMA_COUNT_I = 3229,
-	NV_IM_CIR_METHODS_COUNT_I = 3230,
-	NV_IM_MULTIPLE_TRANSACTIONS_I = 3231,
-	NV_IM_SMSC_ADDRESS_I = 3232,
-	NV_IM_OPTIONAL_HEADER_I = 3233,
-	NV_IM_DIGEST_SCHEMAS_I = 3234,
-	NV_POC_LIMIT_SELECTION_I = 3235,
-	NV_IM_USERID_I = 3236,
-	NV_BC0_VCO_TUNE_2_I = 3237,
-	NV_BC1_VCO_TUNE_2_I = 3238,
-	NV_BC3_VCO_TUNE_2_I = 3239,
-	NV_BC4_VCO_TUNE_2_I = 3240,
-	NV_BC5_VCO_TUNE_2_I = 3241,
-	NV_BC6_VCO_TUNE_2_I = 3242,
-	NV_MM_ENABLE_REAL_I = 3243,
-	NV_DIAG_DEBUG_CALL_TRACE_I = 3244,
-	NV_ENABLE_FASTTRACK_I = 3245,
-	NV_IM_EDIT_MESSENGER_ID_PSWD_I = 3246,
-	NV_IM_SAFETY_TIP_I = 3247,
-	NV_IM_START_STRING_I = 3248,
-	NV_IM_MAX_RECEIVED_FILE_LIMIT_I = 3249,
-	NV_WAP_AUTO_CONNECT_I = 3250,
-	NV_WAP_LOCKOUT_TIME_I = 3251,
-	NV_DIAG_SPC_UNLOCK_TTL_I = 3252,
-	NV_C0_BC0_IM2_LPM_1_I = 3253,
-	NV_C0_BC1_IM2_LPM_1_I = 3254,
-	NV_C0_BC3_IM2_LPM_1_I = 3255,
-	NV_C0_BC4_IM2_LPM_1_I = 3256,
-	NV_C0_BC5_IM2_LPM_1_I = 3257,
-	NV_C0_BC6_IM2_LPM_1_I = 3258,
-	NV_C0_BC0_IM2_LPM_2_I = 3259,
-	NV_C0_BC1_IM2_LPM_2_I = 3260,
-	NV_C0_BC3_IM2_LPM_2_I = 3261,
-	NV_C0_BC4_IM2_LPM_2_I = 3262,
-	NV_C0_BC5_IM2_LPM_2_I = 3263,
-	NV_C0_BC6_IM2_LPM_2_I = 3264,
-	NV_C0_BC0_INTELLICEIVER_CAL_I = 3265,
-	NV_C0_BC1_INTELLICEIVER_CAL_I = 3266,
-	NV_C0_BC3_INTELLICEIVER_CAL_I = 3267,
-	NV_C0_BC4_INTELLICEIVER_CAL_I = 3268,
-	NV_C0_BC5_INTELLICEIVER_CAL_I = 3269,
-	NV_C0_BC6_INTELLICEIVER_CAL_I = 3270,
-	NV_C0_BC0_LNA_SWITCHPOINTS_LPM_1_I = 3271,
-	NV_C0_BC1_LNA_SWITCHPOINTS_LPM_1_I = 3272,
-	NV_C0_BC3_LNA_SWITCHPOINTS_LPM_1_I = 3273,
-	NV_C0_BC4_LNA_SWITCHPOINTS_LPM_1_I = 3274,
-	NV_C0_BC5_LNA_SWITCHPOINTS_LPM_1_I = 3275,
-	NV_C0_BC6_LNA_SWITCHPOINTS_LPM_1_I = 3276,
-	NV_C0_BC0_LNA_SWITCHPOINTS_LPM_2_I = 3277,
-	NV_C0_BC1_LNA_SWITCHPOINTS_LPM_2_I = 3278,
-	NV_C0_BC3_LNA_SWITCHPOINTS_LPM_2_I = 3279,
-	NV_C0_BC4_LNA_SWITCHPOINTS_LPM_2_I = 3280,
-	NV_C0_BC5_LNA_SWITCHPOINTS_LPM_2_I = 3281,
-	NV_C0_BC6_LNA_SWITCHPOINTS_LPM_2_I = 3282,
-	NV_RFR_VCO_COARSE_TUNING_800_I = 3283,
-	NV_POC_NETINITDEREG_I = 3284,
-	NV_POC_APP_TIMEOUT_I = 3285,
-	NV_POC_REGISTRATION_TIMEOUT_I = 3286,
-	NV_POC_GLM_TIMEOUT_I = 3287,
-	NV_JAVA_CONNECTION_PROFILE_ID_I = 3288,
-	NV_JAVA_INTERNET_PROFILE_ID_I = 3289,
-	NV_ENABLE_EXT_GPS_ANTENNA_PWR_SUPPLY_I = 3290,
-	NV_PRESUPL_WAP_GATEWAY_ADDRESS_I = 3291,
-	NV_PRESUPL_WAP_GATEWAY_PORT_I = 3292,
-	NV_GPS1_POSITION_REPORT_I = 3293,
-	NV_SET_VOICE_CALL_TONE_I = 3294,
-	NV_CONN_PROFILE_UNPW_RO_OVERRIDE_I = 3295,
-	NV_INTERNET_PROFILE_UNPW_RO_OVERRIDE_I = 3296,
-	NV_AAGPS_RTI_VALIDITY_DUR_I = 3297,
-	NV_IPV6_UMTS_FAILOVER_CONFIG_I = 3298,
-	NV_POC_FORBID_CHANGE_USERID_I = 3299,
-	NV_POC_WTUSER_PASSWORD_I = 3300,
-	NV_CBS_MAX_MSG_PER_TOPIC_I = 3301,
-	NV_BROWSER_FWDURL_TO_I = 3302,
-	NV_BROWSER_WAP_SIM_COMBINELOCK_I = 3303,
-	NV_BROWSER_STARTPAGE_READONLY_I = 3304,
-	NV_CMGR_DISPLAY_RO_FOR_MISSING_DCF_I = 3305,
-	NV_CMGR_PROMPT_FOR_RO_DELETE_I = 3306,
-	NV_CMGR_AUTO_REDIRECT_TO_LICENSE_SERVER_I = 3307,
-	NV_SET_DRM_CONTENT_PROMPT_I = 3308,
-	NV_CMGR_WD_REMAINING_HOURS_1_THRESHOLD_I = 3309,
-	NV_CMGR_WD_REMAINING_HOURS_2_THRESHOLD_I = 3310,
-	NV_CMGR_WD_RUN_EVERY_HOURS_I = 3311,
-	NV_SET_DRM_EXPIRE_WARNING_I = 3312,
-	NV_CMGR_MAX_PREVIEW_DATA_SIZE_I = 3313,
-	NV_BROWSER_DISABLE_IMAGE_RO_I = 3314,
-	NV_BROWSER_DISABLE_SOUND_RO_I = 3315,
-	NV_BROWSER_TIMEOUT_I = 3316,
-	NV_BROWSER_TIMEOUT_RO_I = 3317,
-	NV_BROWSER_SECURE_PROMPT_RO_I = 3318,
-	NV_BROWSER_FONTSIZE_I = 3319,
-	NV_BROWSER_TEXTWRAP_I = 3320,
-	NV_BROWSER_SCROLLSTEP_I = 3321,
-	NV_BROWSER_EXIT_PROMPT_I = 3322,
-	NV_PU_FORCE_ON_I = 3323,
-	NV_BROWSER_JUMP_PORTAL_NAME_I = 3324,
-	NV_BROWSER_JUMP_EMBDLNK1_NAME_I = 3325,
-	NV_BROWSER_JUMP_EMBDLNK2_NAME_I = 3326,
-	NV_BROWSER_JUMP_EMBDLNK3_NAME_I = 3327,
-	NV_BROWSER_JUMP_EMBDLNK4_NAME_I = 3328,
-	NV_BROWSER_JUMP_EMBDLNK5_NAME_I = 3329,
-	NV_BROWSER_JUMP_EMBDLNK6_NAME_I = 3330,
-	NV_BROWSER_JUMP_EMBDLNK7_NAME_I = 3331,
-	NV_BROWSER_JUMP_EMBDLNK8_NAME_I = 3332,
-	NV_VOICE_MAIL_LINE1_I = 3333,
-	NV_VOICE_MAIL_USE_SIM_NUMBER_I = 3334,
-	NV_VOICE_MAIL_NOTIFY_I = 3335,
-	NV_VOICE_MAIL_LINE2_I = 3336,
-	NV_CAMERA_APP_SAVE_LOCATION_I = 3337,
-	NV_VT_SHOW_MY_IMAGE_I = 3338,
-	NV_VT_AUTO_REDIAL_I = 3339,
-	NV_SET_RINGER_VOLUME_I = 3340,
-	NV_WCDMA_C0_TX_LIM_VS_FREQ_I = 3341,
-	NV_SOS_KEY_ENABLED_I = 3342,
-	NV_SOS_NUMBER_I = 3343,
-	NV_WAP_TRUSTED_DOMAIN_I = 3344,
-	NV_WAP_PUSH_AUTOLOAD_I = 3345,
-	NV_IM_SERVER_ADDRESS_I = 3346,
-	NV_POC_TIMEOUT_SCALE_I = 3347,
-	NV_MR_DEFAULTS_STORED_I = 3348,
-	NV_SET_PLAY_STARTUP_SOUND_I = 3349,
-	NV_SET_PLAY_SHUTDOWN_SOUND_I = 3350,
-	NV_SET_PLAY_STARTUP_ANIMATION_I = 3351,
-	NV_SET_PLAY_SHUTDOWN_ANIMATION_I = 3352,
-	NV_GSM_POLAR_RAMP_PROFILE_I = 3353,
-	NV_GPS1_MSB_BACK_OFF_FACTOR_I = 3354,
-	NV_GPS1_MSB_BACK_OFF_MIN_I = 3355,
-	NV_GPS1_MSB_BACK_OFF_MAX_I = 3356,
-	NV_GPS1_MSB_BACK_OFF_RESET_I = 3357,
-	NV_GPS1_MSB_THROTTLE_ENABLE_I = 3358,
-	NV_MANUAL_PLMN_SEL_I = 3359,
-	NV_MANUAL_PLMN_SELECTION_I = 3360,
-	NV_CONSORTIUM_CONFIG_NUMB_I = 3361,
-	NV_HDR_EQUALIZER_CTRL_I = 3362,
-	NV_WLAN_ENABLE_PS_MODE_I = 3363,
-	NV_MF_700_LNA_RISE_2_I = 3364,
-	NV_MF_700_LNA_RISE_3_I = 3365,
-	NV_MF_700_LNA_RISE_4_I = 3366,
-	NV_MF_700_LNA_FALL_2_I = 3367,
-	NV_MF_700_LNA_FALL_3_I = 3368,
-	NV_MF_700_LNA_FALL_4_I = 3369,
-	NV_MF_700_AGC_VS_FREQ_I = 3370,
-	NV_MF_700_RX_CAL_CHAN_I = 3371,
-	NV_MF_HW_CONFIG_I = 3372,
-	NV_MF_BAND_CONFIG_I = 3373,
-	NV_MF_AFC_LOOP_PARAMS_I = 3374,
-	NV_LAST_REGISTERED_SCI_I = 3375,
-	NV_MMS_MAX_CHARS_SLIDE_I = 3376,
-	NV_MMS_MAX_NUMBER_OF_SLIDES_I = 3377,
-	NV_MMS_MAX_SUBJECT_SIZE_I = 3378,
-	NV_QVP_APP_DEFAULT_AUDIO_CAPABILITY_TYPE_I = 3379,
-	NV_QVP_APP_DEFAULT_VIDEO_CAPABILITY_TYPE_I = 3380,
-	NV_HDRMRLP_NUM_BYTES_TO_LOG_I = 3381,
-	NV_SECTIME_TIME_OFFSETS_I = 3382,
-	NV_DS_UCSD_NT_CONNECT_STATE_I = 3383,
-	NV_PB_RECORDASOUND_I = 3384,
-	NV_PB_AUTO_POWER_OFF_I = 3385,
-	NV_BC0_HDR_G0_IM_FALL_I = 3386,
-	NV_BC0_HDR_G0_IM_RISE_I = 3387,
-	NV_BC0_HDR_G0_IM_LEVEL_I = 3388,
-	NV_SET_LINGER_TIME_I = 3389,
-	NV_PB_SIM_DEFAULTNUMBERPRIORITY_FIRST_I = 3390,
-	NV_PB_SIM_DEFAULTNUMBERPRIORITY_SECOND_I = 3391,
-	NV_PB_SIM_DEFAULTNUMBERPRIORITY_THIRD_I = 3392,
-	NV_PB_DEFAULT_SORTING_I = 3393,
-	NV_SND_SEND_RESTRICTED_I = 3394,
-	NV_POC_ROAMIING_ALERT_ENABLED_I = 3395,
-	NV_GSM_850_PRECHARGE_I = 3396,
-	NV_GSM_850_PRECHARGE_DUR_I = 3397,
-	NV_GSM_1900_PRECHARGE_I = 3398,
-	NV_GSM_1900_PRECHARGE_DUR_I = 3399,
-	NV_MS_SMS_USE_SMSC_FROM_SIM_I = 3400,
-	NV_BROWSER_JUMP_MENU_SETTING_ENABLED_I = 3401,
-	NV_BROWSER_DRM_WAIT_TIME_I = 3402,
-	NV_LC_ENABLED_I = 3403,
-	NV_LC_SERVICENAME_I = 3404,
-	NV_LC_CONNECTIONPROFILE_I = 3405,
-	NV_LC_INTERNETPROFILE_I = 3406,
-	NV_LC_UDPPUSHSERVERNAME_I = 3407,
-	NV_LC_UDPPUSHSERVERPORT_I = 3408,
-	NV_LC_UDPPUSHRETRYTIMES_I = 3409,
-	NV_LC_UDPPUSHRETRYSECONDS_I = 3410,
-	NV_LC_MSGASSEMBLYTIMEOUT_I = 3411,
-	NV_LC_TICKERTIMEOUT_I = 3412,
-	NV_LC_TICKERSPEED_I = 3413,
-	NV_LC_TICKERSTARTDELAY_I = 3414,
-	NV_LC_MAXTICKERITEMS_I = 3415,
-	NV_LC_BACKLIGHTTIMEOUT_I = 3416,
-	NV_LC_TRUSTEDDOMAIN_I = 3417,
-	NV_LC_SUBURL_KEY_LABEL_I = 3418,
-	NV_HOMEZONE_ENABLED_I = 3419,
-	NV_BC0_ANT_QUALITY_I = 3420,
-	NV_BC1_ANT_QUALITY_I = 3421,
-	NV_BC3_ANT_QUALITY_I = 3422,
-	NV_BC4_ANT_QUALITY_I = 3423,
-	NV_BC5_ANT_QUALITY_I = 3424,
-	NV_BC6_ANT_QUALITY_I = 3425,
-	NV_MEDIA_PLAYER_MIN_UDP_PORT_I = 3426,
-	NV_MEDIA_PLAYER_MAX_UDP_PORT_I = 3427,
-	NV_MEDIA_PLAYER_CONN_PROF_I = 3428,
-	NV_MEDIA_PLAYER_QOS_ENABLE_I = 3429,
-	NV_GPS1_NUM_SEARCHER_TASKS_I = 3430,
-	NV_GSM_PA_TRANSITION_TABLE_I = 3431,
-	NV_K_KEY_I = 3432,
-	NV_CIPHER_KEY_I = 3433,
-	NV_INT_KEY_I = 3434,
-	NV_LAST_3G_KEY_ID_I = 3435,
-	NV_SSEQ_I = 3436,
-	NV_CK_THRESHOLD_I = 3437,
-	NV_SEQ_ARR_1_I = 3438,
-	NV_SEQ_ARR_2_I = 3439,
-	NV_WCDMA_MIN_TX_POWER_I = 3440,
-	NV_CCBS_SEL_I = 3441,
-	NV_HOME_SCREEN_ENABLED_I = 3442,
-	NV_HOME_SCREEN_LAYOUT_I = 3443,
-	NV_IS_THM_INITIALIZED_I = 3444,
-	NV_HEAPTRACKER_ENABLED_I = 3445,
-	NV_TRM_CONFIG_I = 3446,
-	NV_IRDA_INACTIVITY_TIMER_I = 3447,
-	NV_MMS_MAX_TEMPLATES_I = 3448,
-	NV_MMS_TEXT_SIZE_I = 3449,
-	NV_VIDEO_APP_SAVE_LOCATION_I = 3450,
-	NV_CAMERA_DEFAULT_NAME_PREFIX_I = 3451,
-	NV_VIDEO_DEFAULT_NAME_PREFIX_I = 3452,
-	NV_CAMERA_AUDIO_RECORD_I = 3453,
-	NV_CAMERA_PICT_RESOLUTION_FRONT_I = 3454,
-	NV_CAMERA_PICT_RESOLUTION_BACK_I = 3455,
-	NV_CAMERA_VIDEO_RESOLUTION_FRONT_I = 3456,
-	NV_CAMERA_VIDEO_RESOLUTION_BACK_I = 3457,
-	NV_HDRSCP_SUBTYPE_CUSTOM_CONFIG_I = 3458,
-	NV_SET_LINGER_TIME_MENU_ENABLE_I = 3459,
-	NV_JAVA_SHOW_LOGO_ON_START_I = 3460,
-	NV_ENS_ENABLED_I = 3461,
-	NV_DIAG_SPC_TIMEOUT_I = 3462,
-	NV_MS_SMS_HEADER_TEMPLATE_FILE_I = 3463,
-	NV_MS_SMS_SIGNATURE_TEMPLATE_FILE_I = 3464,
-	NV_HDRIDLE_ENHANCED_CONFIG_I = 3465,
-	NV_HDRIDLE_SLOT_CYCLE_TIMEOUTS_I = 3466,
-	NV_BACK_LIGHT_INTENSITY_I = 3467,
-	NV_DISPLAY_DURATION_I = 3468,
-	NV_C0_BC0_INTELLICEIVER_DET_THRESH_I = 3469,
-	NV_C0_BC1_INTELLICEIVER_DET_THRESH_I = 3470,
-	NV_C0_BC3_INTELLICEIVER_DET_THRESH_I = 3471,
-	NV_C0_BC4_INTELLICEIVER_DET_THRESH_I = 3472,
-	NV_C0_BC5_INTELLICEIVER_DET_THRESH_I = 3473,
-	NV_C0_BC6_INTELLICEIVER_DET_THRESH_I = 3474,
-	NV_SET_VOICE_VOLUME_I = 3475,
-	NV_SET_MEDIA_VOLUME_I = 3476,
-	NV_HDRRMAC_CONFIG_I = 3477,
-	NV_GPS1_CROSS_CORR_THRESHOLD_DBHZ_I = 3478,
-	NV_GPS1_CME_T_TRACK_THRESHOLD_I = 3479,
-	NV_GPS1_VX_LCSAGENT_V2_HANDOFF_ENABLE_I = 3480,
-	NV_GPS1_VX_LCSAGENT_MO_BACKOFF_DURATION_I = 3481,
-	NV_ODM_BACKLIGHT_INTENSITY_I = 3482,
-	NV_ODM_POWER_SAVE_TIMEOUT_I = 3483,
-	NV_ODM_BACKLIGHT_TIMEOUT_I = 3484,
-	NV_TIMEZONE_CITY_I = 3485,
-	NV_SIGMAREJECT_I = 3486,
-	NV_VELNOISEINONESECDRIVE_I = 3487,
-	NV_VELNOISEINONESECPED_I = 3488,
-	NV_VELNOISEINONESECSTATIC_I = 3489,
-	NV_EXTRACLOCKBIASERROR_I = 3490,
-	NV_CONFIGMASK_I = 3491,
-	NV_MAXPROPAGATIONWONEWMEAS_I = 3492,
-	NV_CONFIGCONTROLFLAG_I = 3493,
-	NV_AAGPS_DEVELOPMENT_TEST_CONTROL6_I = 3494,
-	NV_SET_ALARM_CLOCK_TONE_SETTING_I = 3495,
-	NV_SYS_DEFAULT_EFS_FILE_NAME_I = 3496,
-	NV_SYS_EFS_FILE_NAME_I = 3497,
-	NV_SYS_DEFAULT_NV_INI_FILE_NAME_I = 3498,
-	NV_SYS_NV_INI_FILE_NAME_I = 3499,
-	NV_SYS_SCRIPT_FILE_NAME_I = 3500,
-	NV_GSM_GAINRANGE5_SWITCHPOINTS_I = 3501,
-	NV_GSM_RX_GAIN_RANGE_5_FREQ_COMP_I = 3502,
-	NV_DCS_RX_GAIN_RANGE_5_FREQ_COMP_I = 3503,
-	NV_GSM_850_RX_GAIN_RANGE_5_FREQ_COMP_I = 3504,
-	NV_GSM_1900_RX_GAIN_RANGE_5_FREQ_COMP_I = 3505,
-	NV_DCS_GAINRANGE5_SWITCHPOINTS_I = 3506,
-	NV_GSM_850_GAINRANGE5_SWITCHPOINTS_I = 3507,
-	NV_GSM_1900_GAINRANGE5_SWITCHPOINTS_I = 3508,
-	NV_DCS_POLAR_RAMP_PROFILE_I = 3509,
-	NV_GSM_1900_POLAR_RAMP_PROFILE_I = 3510,
-	NV_GSM_850_POLAR_RAMP_PROFILE_I = 3511,
-	NV_WCDMA_TX_LIM_VS_TEMP_VOICE_CALL_ACTIVE_I = 3512,
-	NV_HDRBCMCS_DISABLE_ONE_TIME_REG_I = 3513,
-	NV_HDRBCMCS_DISABLE_SUBNET_REG_I = 3514,
-	NV_CDMA_RX_CHAIN_SEL_THRESH_I = 3515,
-	NV_SET_AUTO_KEYLOCK_I = 3516,
-	NV_SET_ANY_KEY_ANSWER_I = 3517,
-	NV_VP_FRAME_RATE_I = 3518,
-	NV_DYN_CLOCK_VOLTAGE_I = 3519,
-	NV_GPS1_SEEDPOS_OPTION_I = 3520,
-	NV_MS_SEND_ATTEMPTS_I = 3521,
-	NV_MS_PERIOD_BETW_SEND_ATTEMPTS_I = 3522,
-	NV_MS_SEND_IN_BACKGROUND_I = 3523,
-	NV_WCDMA_DL_FREQ_I = 3524,
-	NV_WCDMA_DL_FREQ_ENABLED_I = 3525,
-	NV_MS_SMS_SMSC_ADDRESS6_I = 3526,
-	NV_MS_SMS_SMSC_ADDRESS7_I = 3527,
-	NV_MS_SMS_SMSC_ADDRESS8_I = 3528,
-	NV_MS_SMS_SMSC_ADDRESS9_I = 3529,
-	NV_MS_SMS_SMSC_ADDRESS10_I = 3530,
-	NV_AUTO_TIME_ENABLE_I = 3531,
-	NV_SMS_MO_RETRY_PERIOD_I = 3532,
-	NV_SMS_MO_RETRY_INTERVAL_I = 3533,
-	NV_RMNET_AUTOCONNECT_I = 3534,
-	NV_ENABLE_BT_DIAG_I = 3535,
-	NV_BC14_TX_LIN_MASTER0_I = 3536,
-	NV_BC14_TX_LIN_MASTER1_I = 3537,
-	NV_BC14_TX_LIN_MASTER2_I = 3538,
-	NV_BC14_TX_LIN_MASTER3_I = 3539,
-	NV_BC14_GPS1_RF_DELAY_I = 3540,
-	NV_BC14_TX_LIM_VS_TEMP_I = 3541,
-	NV_BC14_TX_COMP0_I = 3542,
-	NV_BC14_TX_COMP1_I = 3543,
-	NV_BC14_TX_COMP2_I = 3544,
-	NV_BC14_TX_COMP3_I = 3545,
-	NV_BC14_TX_LIM_VS_FREQ_I = 3546,
-	NV_BC14_PA_R1_RISE_I = 3547,
-	NV_BC14_PA_R1_FALL_I = 3548,
-	NV_BC14_PA_R2_RISE_I = 3549,
-	NV_BC14_PA_R2_FALL_I = 3550,
-	NV_BC14_PA_R3_RISE_I = 3551,
-	NV_BC14_PA_R3_FALL_I = 3552,
-	NV_BC14_HDET_OFF_I = 3553,
-	NV_BC14_HDET_SPN_I = 3554,
-	NV_BC14_EXP_HDET_VS_AGC_I = 3555,
-	NV_BC14_ENC_BTF_I = 3556,
-	NV_BC14_VCO_COARSE_TUNE_TABLE_I = 3557,
-	NV_BC14_VCO_TUNE_2_I = 3558,
-	NV_BC14_P1_RISE_FALL_OFF_I = 3559,
-	NV_BC14_HDR_P1_RISE_FALL_OFF_I = 3560,
-	NV_C0_BC14_TX_CAL_CHAN_I = 3561,
-	NV_C0_BC14_RX_CAL_CHAN_I = 3562,
-	NV_C0_BC14_RX_CAL_CHAN_LRU_I = 3563,
-	NV_C0_BC14_LNA_1_OFFSET_I = 3564,
-	NV_C0_BC14_LNA_2_OFFSET_I = 3565,
-	NV_C0_BC14_LNA_3_OFFSET_I = 3566,
-	NV_C0_BC14_LNA_4_OFFSET_I = 3567,
-	NV_C0_BC14_LNA_1_OFFSET_VS_FREQ_I = 3568,
-	NV_C0_BC14_LNA_2_OFFSET_VS_FREQ_I = 3569,
-	NV_C0_BC14_LNA_3_OFFSET_VS_FREQ_I = 3570,
-	NV_C0_BC14_LNA_4_OFFSET_VS_FREQ_I = 3571,
-	NV_C0_BC14_IM2_I_VALUE_I = 3572,
-	NV_C0_BC14_IM2_Q_VALUE_I = 3573,
-	NV_C0_BC14_VGA_GAIN_OFFSET_I = 3574,
-	NV_C0_BC14_VGA_GAIN_OFFSET_VS_FREQ_I = 3575,
-	NV_C0_BC14_IM2_TRANSCONDUCTOR_VALUE_I = 3576,
-	NV_C0_BC14_LNA_1_RISE_I = 3577,
-	NV_C0_BC14_LNA_1_FALL_I = 3578,
-	NV_C0_BC14_LNA_2_RISE_I = 3579,
-	NV_C0_BC14_LNA_2_FALL_I = 3580,
-	NV_C0_BC14_LNA_3_RISE_I = 3581,
-	NV_C0_BC14_LNA_3_FALL_I = 3582,
-	NV_C0_BC14_LNA_4_RISE_I = 3583,
-	NV_C0_BC14_LNA_4_FALL_I = 3584,
-	NV_C0_BC14_IM_LEVEL1_I = 3585,
-	NV_C0_BC14_IM_LEVEL2_I = 3586,
-	NV_C0_BC14_IM_LEVEL3_I = 3587,
-	NV_C0_BC14_IM_LEVEL4_I = 3588,
-	NV_C1_BC14_TX_CAL_CHAN_I = 3589,
-	NV_C1_BC14_RX_CAL_CHAN_I = 3590,
-	NV_C1_BC14_LNA_1_OFFSET_VS_FREQ_I = 3591,
-	NV_C1_BC14_LNA_2_OFFSET_VS_FREQ_I = 3592,
-	NV_C1_BC14_LNA_3_OFFSET_VS_FREQ_I = 3593,
-	NV_C1_BC14_LNA_4_OFFSET_VS_FREQ_I = 3594,
-	NV_C1_BC14_LNA_1_OFFSET_I = 3595,
-	NV_C1_BC14_LNA_2_OFFSET_I = 3596,
-	NV_C1_BC14_LNA_3_OFFSET_I = 3597,
-	NV_C1_BC14_LNA_4_OFFSET_I = 3598,
-	NV_C1_BC14_IM2_I_VALUE_I = 3599,
-	NV_C1_BC14_IM2_Q_VALUE_I = 3600,
-	NV_C1_BC14_VGA_GAIN_OFFSET_I = 3601,
-	NV_C1_BC14_VGA_GAIN_OFFSET_VS_FREQ_I = 3602,
-	NV_C1_BC14_IM2_TRANSCONDUCTOR_VALUE_I = 3603,
-	NV_C1_BC14_LNA_1_RISE_I = 3604,
-	NV_C1_BC14_LNA_1_FALL_I = 3605,
-	NV_C1_BC14_LNA_2_RISE_I = 3606,
-	NV_C1_BC14_LNA_2_FALL_I = 3607,
-	NV_C1_BC14_LNA_3_RISE_I = 3608,
-	NV_C1_BC14_LNA_3_FALL_I = 3609,
-	NV_C1_BC14_LNA_4_RISE_I = 3610,
-	NV_C1_BC14_LNA_4_FALL_I = 3611,
-	NV_C1_BC14_IM_LEVEL1_I = 3612,
-	NV_C1_BC14_IM_LEVEL2_I = 3613,
-	NV_C1_BC14_IM_LEVEL3_I = 3614,
-	NV_C1_BC14_IM_LEVEL4_I = 3615,
-	NV_C1_BC14_VCO_COARSE_TUNE_TABLE_I = 3616,
-	NV_BC14_ANT_QUALITY_I = 3617,
-	NV_BC14_PA_DVS_VOLTAGE_I = 3618,
-	NV_C0_BC14_LNA_SWITCHPOINTS_LPM_1_I = 3619,
-	NV_C0_BC14_LNA_SWITCHPOINTS_LPM_2_I = 3620,
-	NV_C0_BC14_IM2_LPM_1_I = 3621,
-	NV_C0_BC14_IM2_LPM_2_I = 3622,
-	NV_C0_BC14_INTELLICEIVER_CAL_I = 3623,
-	NV_C0_BC14_INTELLICEIVER_DET_THRESH_I = 3624,
-	NV_C1_BC14_RX_CAL_CHAN_LRU_I = 3625,
-	NV_SYS_VARIANT_NAME_I = 3626,
-	NV_SET_SSAVER_AUTO_KEYLOCK_I = 3627,
-	NV_DTM_FEATURE_SUPPORT_I = 3628,
-	NV_DTM_MULTISLOT_CLASS_I = 3629,
-	NV_EDA_FEATURE_SUPPORT_I = 3630,
-	NV_MF_MRU_CHAN_I = 3631,
-	NV_SRCH_DBG_MASK_I = 3632,
-	NV_STRIDE_ACTIVE_I = 3633,
-	NV_DDTM_SETTINGS_I = 3634,
-	NV_SD_CFG_ITEMS_I = 3635,
-	NV_VOIP_QOS_EVDO_SIP_PROFILE_ID_I = 3636,
-	NV_VOIP_QOS_EVDO_RTP_PROFILE_ID_I = 3637,
-	NV_VOIP_QOS_EVDO_DSCP_I = 3638,
-	NV_VOIP_DTX_ENABLED_I = 3639,
-	NV_MF_AFC_INNER_LOOP_GAIN_I = 3640,
-	NV_MF_AFC_INIT_FREQ_OFFSET_I = 3641,
-	NV_MF_C0_IM2_I_VALUE_I = 3642,
-	NV_MF_C0_IM2_Q_VALUE_I = 3643,
-	NV_MF_C0_IM2_TRANSCONDUCTOR_VALUE_I = 3644,
-	NV_MF_C1_IM2_I_VALUE_I = 3645,
-	NV_MF_C1_IM2_Q_VALUE_I = 3646,
-	NV_MF_C1_IM2_TRANSCONDUCTOR_VALUE_I = 3647,
-	NV_MF_ACQ_PARAMETERS_I = 3648,
-	NV_WCDMA_RRC_VERSION_I = 3649,
-	NV_WCDMA_900_VGA_GAIN_OFFSET_I = 3650,
-	NV_WCDMA_900_VGA_GAIN_OFFSET_VS_FREQ_I = 3651,
-	NV_WCDMA_900_VGA_GAIN_OFFSET_VS_TEMP_I = 3652,
-	NV_WCDMA_900_LNA_RANGE_RISE_2_I = 3653,
-	NV_WCDMA_900_LNA_RANGE_RISE_3_I = 3654,
-	NV_WCDMA_900_LNA_RANGE_FALL_2_I = 3655,
-	NV_WCDMA_900_LNA_RANGE_FALL_3_I = 3656,
-	NV_WCDMA_900_IM_LEVEL_2_I = 3657,
-	NV_WCDMA_900_IM_LEVEL_3_I = 3658,
-	NV_WCDMA_900_LNA_RANGE_OFFSET_2_I = 3659,
-	NV_WCDMA_900_LNA_RANGE_OFFSET_3_I = 3660,
-	NV_WCDMA_900_LNA_OFFSET_VS_FREQ_2_I = 3661,
-	NV_WCDMA_900_LNA_OFFSET_VS_FREQ_3_I = 3662,
-	NV_WCDMA_900_IM2_I_VALUE_I = 3663,
-	NV_WCDMA_900_IM2_Q_VALUE_I = 3664,
-	NV_WCDMA_900_IM2_TRANSCONDUCTOR_VALUE_I = 3665,
-	NV_WCDMA_900_RX_AGC_MIN_2_I = 3666,
-	NV_WCDMA_900_RX_AGC_MIN_3_I = 3667,
-	NV_WCDMA_900_MAX_TX_POWER_I = 3668,
-	NV_WCDMA_900_OUT_OF_SERVICE_THRESH_I = 3669,
-	NV_WCDMA_900_LNA_RANGE_RISE_I = 3670,
-	NV_WCDMA_900_LNA_RANGE_FALL_I = 3671,
-	NV_WCDMA_900_IM_LEVEL_I = 3672,
-	NV_WCDMA_900_NONBYPASS_TIMER_I = 3673,
-	NV_WCDMA_900_BYPASS_TIMER_I = 3674,
-	NV_WCDMA_900_LNA_RANGE_OFFSET_I = 3675,
-	NV_WCDMA_900_LNA_OFFSET_VS_FREQ_I = 3676,
-	NV_WCDMA_900_RX_AGC_MIN_I = 3677,
-	NV_WCDMA_900_RX_AGC_MAX_I = 3678,
-	NV_WCDMA_900_AGC_PHASE_OFFSET_I = 3679,
-	NV_WCDMA_900_TX_LIN_MASTER_0_I = 3680,
-	NV_WCDMA_900_TX_LIN_MASTER_1_I = 3681,
-	NV_WCDMA_900_TX_COMP_VS_FREQ_0_I = 3682,
-	NV_WCDMA_900_TX_COMP_VS_FREQ_1_I = 3683,
-	NV_WCDMA_900_TX_LIN_VS_TEMP_0_I = 3684,
-	NV_WCDMA_900_TX_LIN_VS_TEMP_1_I = 3685,
-	NV_WCDMA_900_TX_SLP_VS_TEMP_0_I = 3686,
-	NV_WCDMA_900_TX_SLP_VS_TEMP_1_I = 3687,
-	NV_WCDMA_900_R1_RISE_I = 3688,
-	NV_WCDMA_900_R1_FALL_I = 3689,
-	NV_WCDMA_900_TX_LIM_VS_TEMP_I = 3690,
-	NV_WCDMA_900_TX_LIM_VS_FREQ_I = 3691,
-	NV_WCDMA_900_ADJ_FACTOR_I = 3692,
-	NV_WCDMA_900_EXP_HDET_VS_AGC_I = 3693,
-	NV_WCDMA_900_HDET_OFF_I = 3694,
-	NV_WCDMA_900_HDET_SPN_I = 3695,
-	NV_WCDMA_900_ENC_BTF_I = 3696,
-	NV_WCDMA_900_AGC_PA_ON_RISE_DELAY_I = 3697,
-	NV_WCDMA_900_AGC_PA_ON_FALL_DELAY_I = 3698,
-	NV_WCDMA_900_AGC_TX_ON_RISE_DELAY_I = 3699,
-	NV_WCDMA_900_AGC_TX_ON_FALL_DELAY_I = 3700,
-	NV_WCDMA_900_AGC_UPDATE_TX_AGC_TIME_I = 3701,
-	NV_WCDMA_900_PRACH_R1_RISE_OFFSET_I = 3702,
-	NV_WCDMA_900_PRACH_R1_FALL_OFFSET_I = 3703,
-	NV_WCDMA_900_TX_CAL_CHAN_I = 3704,
-	NV_WCDMA_900_RX_CAL_CHAN_I = 3705,
-	NV_WCDMA_900_TX_LIN_MASTER_2_I = 3706,
-	NV_WCDMA_900_TX_LIN_MASTER_3_I = 3707,
-	NV_WCDMA_900_TX_COMP_VS_FREQ_2_I = 3708,
-	NV_WCDMA_900_TX_COMP_VS_FREQ_3_I = 3709,
-	NV_WCDMA_900_TX_LIN_VS_TEMP_2_I = 3710,
-	NV_WCDMA_900_TX_LIN_VS_TEMP_3_I = 3711,
-	NV_WCDMA_900_TX_SLP_VS_TEMP_2_I = 3712,
-	NV_WCDMA_900_TX_SLP_VS_TEMP_3_I = 3713,
-	NV_WCDMA_900_R2_RISE_I = 3714,
-	NV_WCDMA_900_R2_FALL_I = 3715,
-	NV_WCDMA_900_R3_RISE_I = 3716,
-	NV_WCDMA_900_R3_FALL_I = 3717,
-	NV_WCDMA_900_PA_COMPENSATE_UP_R2_I = 3718,
-	NV_WCDMA_900_PA_COMPENSATE_DOWN_R2_I = 3719,
-	NV_WCDMA_900_PA_COMPENSATE_UP_R3_I = 3720,
-	NV_WCDMA_900_PA_COMPENSATE_DOWN_R3_I = 3721,
-	NV_WCDMA_900_TX_ROT_ANGLE_PA_STATE_00_I = 3722,
-	NV_WCDMA_900_TX_ROT_ANGLE_PA_STATE_01_I = 3723,
-	NV_WCDMA_900_TX_ROT_ANGLE_PA_STATE_10_I = 3724,
-	NV_WCDMA_900_TX_ROT_ANGLE_PA_STATE_11_I = 3725,
-	NV_WCDMA_900_PRACH_R2_RISE_OFFSET_I = 3726,
-	NV_WCDMA_900_PRACH_R2_FALL_OFFSET_I = 3727,
-	NV_WCDMA_900_PRACH_R3_RISE_OFFSET_I = 3728,
-	NV_WCDMA_900_PRACH_R3_FALL_OFFSET_I = 3729,
-	NV_WCDMA_900_PA_RANGE_MAP_I = 3730,
-	NV_WCDMA_900_DCH_AGC_UPDATE_TX_AGC_TIME_I = 3731,
-	NV_WCDMA_900_AGC_TX_ADJ_PDM_DELAY_I = 3732,
-	NV_WCDMA_900_UTRAN_TX_LIM_VS_TEMP_OFFSET_I = 3733,
-	NV_WCDMA_900_PA_GAIN_UP_TIME_I = 3734,
-	NV_WCDMA_900_PA_GAIN_DOWN_TIME_I = 3735,
-	NV_WCDMA_900_PA_COMPENSATE_UP_I = 3736,
-	NV_WCDMA_900_PA_COMPENSATE_DOWN_I = 3737,
-	NV_WCDMA_900_RX_DELAY_I = 3738,
-	NV_WCDMA_900_PA_RANGE_FOR_DVS_I = 3739,
-	NV_WCDMA_900_PA_COMPENSATE_UP_WITH_DVS_I = 3740,
-	NV_WCDMA_900_PA_COMPENSATE_DN_WITH_DVS_I = 3741,
-	NV_WCDMA_900_MAX_PWR_BACKOFF_VOLTAGES_I = 3742,
-	NV_WCDMA_900_MAX_PWR_BACKOFF_VOLT1_I = 3743,
-	NV_WCDMA_900_MAX_PWR_BACKOFF_VOLT2_I = 3744,
-	NV_WCDMA_900_MAX_PWR_BACKOFF_VOLT3_I = 3745,
-	NV_WCDMA_900_HS_R1_RISE_I = 3746,
-	NV_WCDMA_900_HS_R1_FALL_I = 3747,
-	NV_WCDMA_900_HS_R2_RISE_I = 3748,
-	NV_WCDMA_900_HS_R2_FALL_I = 3749,
-	NV_WCDMA_900_HS_R3_RISE_I = 3750,
-	NV_WCDMA_900_HS_R3_FALL_I = 3751,
-	NV_RFR_VCO_COARSE_TUNING_900_I = 3752,
-	NV_NITZ_NW_INFO_I = 3753,
-	NV_CBS_MAX_MSGS_PER_TOPIC_I = 3754,
-	NV_CAMERA_TYPE_I = 3755,
-	NV_GPS1_DYNAMIC_MODE_I = 3756,
-	NV_DQOS_SUPPORTED_I = 3757,
-	NV_AAGPS_USE_TRANSPORT_SECURITY_I = 3758,
-	NV_C1_WCDMA_2100_VGA_GAIN_OFFSET_I = 3759,
-	NV_C1_WCDMA_2100_LNA_RANGE_RISE_I = 3760,
-	NV_C1_WCDMA_2100_LNA_RANGE_FALL_I = 3761,
-	NV_C1_WCDMA_2100_IM_LEVEL_I = 3762,
-	NV_C1_WCDMA_2100_NONBYPASS_TIMER_I = 3763,
-	NV_C1_WCDMA_2100_BYPASS_TIMER_I = 3764,
-	NV_C1_WCDMA_2100_LNA_RANGE_OFFSET_I = 3765,
-	NV_C1_WCDMA_2100_LNA_OFFSET_VS_FREQ_I = 3766,
-	NV_C1_WCDMA_2100_VGA_GAIN_OFFSET_VS_FREQ_I = 3767,
-	NV_C1_WCDMA_2100_VGA_GAIN_OFFSET_VS_TEMP_I = 3768,
-	NV_C1_WCDMA_2100_LNA_RANGE_RISE_2_I = 3769,
-	NV_C1_WCDMA_2100_LNA_RANGE_RISE_3_I = 3770,
-	NV_C1_WCDMA_2100_LNA_RANGE_RISE_4_I = 3771,
-	NV_C1_WCDMA_2100_LNA_RANGE_FALL_2_I = 3772,
-	NV_C1_WCDMA_2100_LNA_RANGE_FALL_3_I = 3773,
-	NV_C1_WCDMA_2100_LNA_RANGE_FALL_4_I = 3774,
-	NV_C1_WCDMA_2100_IM_LEVEL_2_I = 3775,
-	NV_C1_WCDMA_2100_IM_LEVEL_3_I = 3776,
-	NV_C1_WCDMA_2100_IM_LEVEL_4_I = 3777,
-	NV_C1_WCDMA_2100_LNA_RANGE_OFFSET_2_I = 3778,
-	NV_C1_WCDMA_2100_LNA_RANGE_OFFSET_3_I = 3779,
-	NV_C1_WCDMA_2100_LNA_RANGE_OFFSET_4_I = 3780,
-	NV_C1_WCDMA_2100_LNA_OFFSET_VS_FREQ_2_I = 3781,
-	NV_C1_WCDMA_2100_LNA_OFFSET_VS_FREQ_3_I = 3782,
-	NV_C1_WCDMA_2100_LNA_OFFSET_VS_FREQ_4_I = 3783,
-	NV_C1_WCDMA_2100_IM2_I_VALUE_I = 3784,
-	NV_C1_WCDMA_2100_IM2_Q_VALUE_I = 3785,
-	NV_C1_WCDMA_2100_IM2_TRANSCONDUCTOR_VALUE_I = 3786,
-	NV_C1_WCDMA_2100_RX_CAL_CHAN_I = 3787,
-	NV_C1_RF_ANTSEL_UMTS_2100_I = 3788,
-	NV_C1_WCDMA_1900_VGA_GAIN_OFFSET_I = 3789,
-	NV_C1_WCDMA_1900_VGA_GAIN_OFFSET_VS_FREQ_I = 3790,
-	NV_C1_WCDMA_1900_VGA_GAIN_OFFSET_VS_TEMP_I = 3791,
-	NV_C1_WCDMA_1900_LNA_RANGE_RISE_I = 3792,
-	NV_C1_WCDMA_1900_LNA_RANGE_RISE_2_I = 3793,
-	NV_C1_WCDMA_1900_LNA_RANGE_RISE_3_I = 3794,
-	NV_C1_WCDMA_1900_LNA_RANGE_RISE_4_I = 3795,
-	NV_C1_WCDMA_1900_LNA_RANGE_FALL_I = 3796,
-	NV_C1_WCDMA_1900_LNA_RANGE_FALL_2_I = 3797,
-	NV_C1_WCDMA_1900_LNA_RANGE_FALL_3_I = 3798,
-	NV_C1_WCDMA_1900_LNA_RANGE_FALL_4_I = 3799,
-	NV_C1_WCDMA_1900_IM_LEVEL_I = 3800,
-	NV_C1_WCDMA_1900_IM_LEVEL_2_I = 3801,
-	NV_C1_WCDMA_1900_IM_LEVEL_3_I = 3802,
-	NV_C1_WCDMA_1900_IM_LEVEL_4_I = 3803,
-	NV_C1_WCDMA_1900_LNA_RANGE_OFFSET_2_I = 3804,
-	NV_C1_WCDMA_1900_LNA_RANGE_OFFSET_3_I = 3805,
-	NV_C1_WCDMA_1900_LNA_RANGE_OFFSET_4_I = 3806,
-	NV_C1_WCDMA_1900_LNA_OFFSET_VS_FREQ_2_I = 3807,
-	NV_C1_WCDMA_1900_LNA_OFFSET_VS_FREQ_3_I = 3808,
-	NV_C1_WCDMA_1900_LNA_OFFSET_VS_FREQ_4_I = 3809,
-	NV_C1_WCDMA_1900_IM2_I_VALUE_I = 3810,
-	NV_C1_WCDMA_1900_IM2_Q_VALUE_I = 3811,
-	NV_C1_WCDMA_1900_IM2_TRANSCONDUCTOR_VALUE_I = 3812,
-	NV_C1_WCDMA_1900_NONBYPASS_TIMER_I = 3813,
-	NV_C1_WCDMA_1900_BYPASS_TIMER_I = 3814,
-	NV_C1_WCDMA_1900_LNA_RANGE_OFFSET_I = 3815,
-	NV_C1_WCDMA_1900_LNA_OFFSET_VS_FREQ_I = 3816,
-	NV_C1_WCDMA_1900_RX_CAL_CHAN_I = 3817,
-	NV_C1_RF_ANTSEL_UMTS_1900_I = 3818,
-	NV_C1_WCDMA_800_VGA_GAIN_OFFSET_I = 3819,
-	NV_C1_WCDMA_800_VGA_GAIN_OFFSET_VS_FREQ_I = 3820,
-	NV_C1_WCDMA_800_VGA_GAIN_OFFSET_VS_TEMP_I = 3821,
-	NV_C1_WCDMA_800_LNA_RANGE_RISE_I = 3822,
-	NV_C1_WCDMA_800_LNA_RANGE_RISE_2_I = 3823,
-	NV_C1_WCDMA_800_LNA_RANGE_RISE_3_I = 3824,
-	NV_C1_WCDMA_800_LNA_RANGE_RISE_4_I = 3825,
-	NV_C1_WCDMA_800_LNA_RANGE_FALL_I = 3826,
-	NV_C1_WCDMA_800_LNA_RANGE_FALL_2_I = 3827,
-	NV_C1_WCDMA_800_LNA_RANGE_FALL_3_I = 3828,
-	NV_C1_WCDMA_800_LNA_RANGE_FALL_4_I = 3829,
-	NV_C1_WCDMA_800_IM_LEVEL_I = 3830,
-	NV_C1_WCDMA_800_IM_LEVEL_2_I = 3831,
-	NV_C1_WCDMA_800_IM_LEVEL_3_I = 3832,
-	NV_C1_WCDMA_800_IM_LEVEL_4_I = 3833,
-	NV_C1_WCDMA_800_LNA_RANGE_OFFSET_I = 3834,
-	NV_C1_WCDMA_800_LNA_RANGE_OFFSET_2_I = 3835,
-	NV_C1_WCDMA_800_LNA_RANGE_OFFSET_3_I = 3836,
-	NV_C1_WCDMA_800_LNA_RANGE_OFFSET_4_I = 3837,
-	NV_C1_WCDMA_800_LNA_OFFSET_VS_FREQ_I = 3838,
-	NV_C1_WCDMA_800_LNA_OFFSET_VS_FREQ_2_I = 3839,
-	NV_C1_WCDMA_800_LNA_OFFSET_VS_FREQ_3_I = 3840,
-	NV_C1_WCDMA_800_LNA_OFFSET_VS_FREQ_4_I = 3841,
-	NV_C1_WCDMA_800_IM2_I_VALUE_I = 3842,
-	NV_C1_WCDMA_800_IM2_Q_VALUE_I = 3843,
-	NV_C1_WCDMA_800_IM2_TRANSCONDUCTOR_VALUE_I = 3844,
-	NV_C1_WCDMA_800_NONBYPASS_TIMER_I = 3845,
-	NV_C1_WCDMA_800_BYPASS_TIMER_I = 3846,
-	NV_C1_WCDMA_800_RX_CAL_CHAN_I = 3847,
-	NV_C1_RF_ANTSEL_UMTS_800_I = 3848,
-	NV_RFR_VCO_COARSE_TUNE_2_1900_I = 3849,
-	NV_RFR_WCDMA_C0_C1_DELAY_I = 3850,
-	NV_WCDMA_RX_DIVERSITY_CTRL_I = 3851,
-	NV_WCDMA_EQUALIZER_CTRL_I = 3852,
-	NV_BC11_GPS1_RF_DELAY_I = 3853,
-	NV_BC11_TX_LIM_VS_TEMP_I = 3854,
-	NV_BC11_TX_LIN_MASTER0_I = 3855,
-	NV_BC11_TX_LIN_MASTER1_I = 3856,
-	NV_BC11_TX_LIN_MASTER2_I = 3857,
-	NV_BC11_TX_LIN_MASTER3_I = 3858,
-	NV_BC11_TX_COMP0_I = 3859,
-	NV_BC11_TX_COMP1_I = 3860,
-	NV_BC11_TX_COMP2_I = 3861,
-	NV_BC11_TX_COMP3_I = 3862,
-	NV_BC11_TX_LIM_VS_FREQ_I = 3863,
-	NV_BC11_PA_R1_RISE_I = 3864,
-	NV_BC11_PA_R1_FALL_I = 3865,
-	NV_BC11_PA_R2_RISE_I = 3866,
-	NV_BC11_PA_R2_FALL_I = 3867,
-	NV_BC11_PA_R3_RISE_I = 3868,
-	NV_BC11_PA_R3_FALL_I = 3869,
-	NV_BC11_HDET_OFF_I = 3870,
-	NV_BC11_HDET_SPN_I = 3871,
-	NV_BC11_EXP_HDET_VS_AGC_I = 3872,
-	NV_BC11_ENC_BTF_I = 3873,
-	NV_BC11_VCO_COARSE_TUNE_TABLE_I = 3874,
-	NV_BC11_P1_RISE_FALL_OFF_I = 3875,
-	NV_C0_BC11_TX_CAL_CHAN_I = 3876,
-	NV_C0_BC11_RX_CAL_CHAN_I = 3877,
-	NV_C0_BC11_LNA_1_OFFSET_VS_FREQ_I = 3878,
-	NV_C0_BC11_LNA_2_OFFSET_VS_FREQ_I = 3879,
-	NV_C0_BC11_LNA_3_OFFSET_VS_FREQ_I = 3880,
-	NV_C0_BC11_LNA_4_OFFSET_VS_FREQ_I = 3881,
-	NV_C0_BC11_LNA_1_OFFSET_I = 3882,
-	NV_C0_BC11_LNA_2_OFFSET_I = 3883,
-	NV_C0_BC11_LNA_3_OFFSET_I = 3884,
-	NV_C0_BC11_LNA_4_OFFSET_I = 3885,
-	NV_C0_BC11_IM2_I_VALUE_I = 3886,
-	NV_C0_BC11_IM2_Q_VALUE_I = 3887,
-	NV_C0_BC11_VGA_GAIN_OFFSET_I = 3888,
-	NV_C0_BC11_VGA_GAIN_OFFSET_VS_FREQ_I = 3889,
-	NV_C0_BC11_IM2_TRANSCONDUCTOR_VALUE_I = 3890,
-	NV_C0_BC11_LNA_1_RISE_I = 3891,
-	NV_C0_BC11_LNA_1_FALL_I = 3892,
-	NV_C0_BC11_LNA_2_RISE_I = 3893,
-	NV_C0_BC11_LNA_2_FALL_I = 3894,
-	NV_C0_BC11_LNA_3_RISE_I = 3895,
-	NV_C0_BC11_LNA_3_FALL_I = 3896,
-	NV_C0_BC11_LNA_4_RISE_I = 3897,
-	NV_C0_BC11_LNA_4_FALL_I = 3898,
-	NV_C0_BC11_IM_LEVEL1_I = 3899,
-	NV_C0_BC11_IM_LEVEL2_I = 3900,
-	NV_C0_BC11_IM_LEVEL3_I = 3901,
-	NV_C0_BC11_IM_LEVEL4_I = 3902,
-	NV_C1_BC11_TX_CAL_CHAN_I = 3903,
-	NV_C1_BC11_RX_CAL_CHAN_I = 3904,
-	NV_C1_BC11_LNA_1_OFFSET_VS_FREQ_I = 3905,
-	NV_C1_BC11_LNA_2_OFFSET_VS_FREQ_I = 3906,
-	NV_C1_BC11_LNA_3_OFFSET_VS_FREQ_I = 3907,
-	NV_C1_BC11_LNA_4_OFFSET_VS_FREQ_I = 3908,
-	NV_C1_BC11_LNA_1_OFFSET_I = 3909,
-	NV_C1_BC11_LNA_2_OFFSET_I = 3910,
-	NV_C1_BC11_LNA_3_OFFSET_I = 3911,
-	NV_C1_BC11_LNA_4_OFFSET_I = 3912,
-	NV_C1_BC11_IM2_I_VALUE_I = 3913,
-	NV_C1_BC11_IM2_Q_VALUE_I = 3914,
-	NV_C1_BC11_VGA_GAIN_OFFSET_I = 3915,
-	NV_C1_BC11_VGA_GAIN_OFFSET_VS_FREQ_I = 3916,
-	NV_C1_BC11_IM2_TRANSCONDUCTOR_VALUE_I = 3917,
-	NV_C1_BC11_LNA_1_RISE_I = 3918,
-	NV_C1_BC11_LNA_1_FALL_I = 3919,
-	NV_C1_BC11_LNA_2_RISE_I = 3920,
-	NV_C1_BC11_LNA_2_FALL_I = 3921,
-	NV_C1_BC11_LNA_3_RISE_I = 3922,
-	NV_C1_BC11_LNA_3_FALL_I = 3923,
-	NV_C1_BC11_LNA_4_RISE_I = 3924,
-	NV_C1_BC11_LNA_4_FALL_I = 3925,
-	NV_C1_BC11_IM_LEVEL1_I = 3926,
-	NV_C1_BC11_IM_LEVEL2_I = 3927,
-	NV_C1_BC11_IM_LEVEL3_I = 3928,
-	NV_C1_BC11_IM_LEVEL4_I = 3929,
-	NV_BC11_VCO_TUNE_2_I = 3930,
-	NV_BC11_HDR_P1_RISE_FALL_OFF_I = 3931,
-	NV_C0_BC11_RX_CAL_CHAN_LRU_I = 3932,
-	NV_C1_BC11_RX_CAL_CHAN_LRU_I = 3933,
-	NV_BC11_ANT_QUALITY_I = 3934,
-	NV_C0_BC11_IM2_LPM_1_I = 3935,
-	NV_C0_BC11_IM2_LPM_2_I = 3936,
-	NV_C0_BC11_INTELLICEIVER_CAL_I = 3937,
-	NV_C0_BC11_LNA_SWITCHPOINTS_LPM_1_I = 3938,
-	NV_C0_BC11_LNA_SWITCHPOINTS_LPM_2_I = 3939,
-	NV_C0_BC11_INTELLICEIVER_DET_THRESH_I = 3940,
-	NV_BC11_PA_DVS_VOLTAGE_I = 3941,
-	NV_C1_BC11_VCO_COARSE_TUNE_TABLE_I = 3942,
-	NV_VOIP_WLAN_PRFRD_CODEC_I = 3943,
-	NV_VOIP_EVDO_PRFRD_CODEC_I = 3944,
-	NV_WCDMA_PA_COMP_UP_VS_FREQ_I = 3945,
-	NV_WCDMA_PA_COMP_DOWN_VS_FREQ_I = 3946,
-	NV_WCDMA_PA_COMP_UP_R2_VS_FREQ_I = 3947,
-	NV_WCDMA_PA_COMP_DOWN_R2_VS_FREQ_I = 3948,
-	NV_WCDMA_PA_COMP_UP_R3_VS_FREQ_I = 3949,
-	NV_WCDMA_PA_COMP_DOWN_R3_VS_FREQ_I = 3950,
-	NV_WCDMA_800_PA_COMP_UP_VS_FREQ_I = 3951,
-	NV_WCDMA_800_PA_COMP_DOWN_VS_FREQ_I = 3952,
-	NV_WCDMA_800_PA_COMP_UP_R2_VS_FREQ_I = 3953,
-	NV_WCDMA_800_PA_COMP_DOWN_R2_VS_FREQ_I = 3954,
-	NV_WCDMA_800_PA_COMP_UP_R3_VS_FREQ_I = 3955,
-	NV_WCDMA_800_PA_COMP_DOWN_R3_VS_FREQ_I = 3956,
-	NV_WCDMA_1900_PA_COMP_UP_VS_FREQ_I = 3957,
-	NV_WCDMA_1900_PA_COMP_DOWN_VS_FREQ_I = 3958,
-	NV_WCDMA_1900_PA_COMP_UP_R2_VS_FREQ_I = 3959,
-	NV_WCDMA_1900_PA_COMP_DOWN_R2_VS_FREQ_I = 3960,
-	NV_WCDMA_1900_PA_COMP_UP_R3_VS_FREQ_I = 3961,
-	NV_WCDMA_1900_PA_COMP_DOWN_R3_VS_FREQ_I = 3962,
-	NV_WCDMA_900_PA_COMP_UP_VS_FREQ_I = 3963,
-	NV_WCDMA_900_PA_COMP_DOWN_VS_FREQ_I = 3964,
-	NV_WCDMA_900_PA_COMP_UP_R2_VS_FREQ_I = 3965,
-	NV_WCDMA_900_PA_COMP_DOWN_R2_VS_FREQ_I = 3966,
-	NV_WCDMA_900_PA_COMP_UP_R3_VS_FREQ_I = 3967,
-	NV_WCDMA_900_PA_COMP_DOWN_R3_VS_FREQ_I = 3968,
-	NV_WCDMA_TX_PDM_LIN_0_I = 3969,
-	NV_WCDMA_TX_PDM_LIN_1_I = 3970,
-	NV_WCDMA_TX_PDM_LIN_2_I = 3971,
-	NV_WCDMA_TX_PDM_LIN_3_I = 3972,
-	NV_WCDMA_800_TX_PDM_LIN_0_I = 3973,
-	NV_WCDMA_800_TX_PDM_LIN_1_I = 3974,
-	NV_WCDMA_800_TX_PDM_LIN_2_I = 3975,
-	NV_WCDMA_800_TX_PDM_LIN_3_I = 3976,
-	NV_WCDMA_1900_TX_PDM_LIN_0_I = 3977,
-	NV_WCDMA_1900_TX_PDM_LIN_1_I = 3978,
-	NV_WCDMA_1900_TX_PDM_LIN_2_I = 3979,
-	NV_WCDMA_1900_TX_PDM_LIN_3_I = 3980,
-	NV_WCDMA_900_TX_PDM_LIN_0_I = 3981,
-	NV_WCDMA_900_TX_PDM_LIN_1_I = 3982,
-	NV_WCDMA_900_TX_PDM_LIN_2_I = 3983,
-	NV_WCDMA_900_TX_PDM_LIN_3_I = 3984,
-	NV_WCDMA_1800_PA_COMP_UP_VS_FREQ_I = 3985,
-	NV_WCDMA_1800_PA_COMP_DOWN_VS_FREQ_I = 3986,
-	NV_WCDMA_1800_PA_COMP_UP_R2_VS_FREQ_I = 3987,
-	NV_WCDMA_1800_PA_COMP_DOWN_R2_VS_FREQ_I = 3988,
-	NV_WCDMA_1800_PA_COMP_UP_R3_VS_FREQ_I = 3989,
-	NV_WCDMA_1800_PA_COMP_DOWN_R3_VS_FREQ_I = 3990,
-	NV_WCDMA_1800_TX_PDM_LIN_0_I = 3991,
-	NV_WCDMA_1800_TX_PDM_LIN_1_I = 3992,
-	NV_WCDMA_1800_TX_PDM_LIN_2_I = 3993,
-	NV_WCDMA_1800_TX_PDM_LIN_3_I = 3994,
-	NV_WCDMA_BC4_VGA_GAIN_OFFSET_I = 3995,
-	NV_WCDMA_BC4_VGA_GAIN_OFFSET_VS_FREQ_I = 3996,
-	NV_WCDMA_BC4_VGA_GAIN_OFFSET_VS_TEMP_I = 3997,
-	NV_WCDMA_BC4_LNA_RANGE_RISE_2_I = 3998,
-	NV_WCDMA_BC4_LNA_RANGE_RISE_3_I = 3999,
-	NV_WCDMA_BC4_LNA_RANGE_FALL_2_I = 4000,
-	NV_WCDMA_BC4_LNA_RANGE_FALL_3_I = 4001,
-	NV_WCDMA_BC4_IM_LEVEL_2_I = 4002,
-	NV_WCDMA_BC4_IM_LEVEL_3_I = 4003,
-	NV_WCDMA_BC4_LNA_RANGE_OFFSET_2_I = 4004,
-	NV_WCDMA_BC4_LNA_RANGE_OFFSET_3_I = 4005,
-	NV_WCDMA_BC4_LNA_OFFSET_VS_FREQ_2_I = 4006,
-	NV_WCDMA_BC4_LNA_OFFSET_VS_FREQ_3_I = 4007,
-	NV_WCDMA_BC4_IM2_I_VALUE_I = 4008,
-	NV_WCDMA_BC4_IM2_Q_VALUE_I = 4009,
-	NV_WCDMA_BC4_IM2_TRANSCONDUCTOR_VALUE_I = 4010,
-	NV_WCDMA_BC4_RX_AGC_MIN_2_I = 4011,
-	NV_WCDMA_BC4_RX_AGC_MIN_3_I = 4012,
-	NV_WCDMA_BC4_MAX_TX_POWER_I = 4013,
-	NV_WCDMA_BC4_OUT_OF_SERVICE_THRESH_I = 4014,
-	NV_WCDMA_BC4_LNA_RANGE_RISE_I = 4015,
-	NV_WCDMA_BC4_LNA_RANGE_FALL_I = 4016,
-	NV_WCDMA_BC4_IM_LEVEL_I = 4017,
-	NV_WCDMA_BC4_NONBYPASS_TIMER_I = 4018,
-	NV_WCDMA_BC4_BYPASS_TIMER_I = 4019,
-	NV_WCDMA_BC4_LNA_RANGE_OFFSET_I = 4020,
-	NV_WCDMA_BC4_LNA_OFFSET_VS_FREQ_I = 4021,
-	NV_WCDMA_BC4_RX_AGC_MIN_I = 4022,
-	NV_WCDMA_BC4_RX_AGC_MAX_I = 4023,
-	NV_WCDMA_BC4_AGC_PHASE_OFFSET_I = 4024,
-	NV_WCDMA_BC4_TX_LIN_MASTER_0_I = 4025,
-	NV_WCDMA_BC4_TX_LIN_MASTER_1_I = 4026,
-	NV_WCDMA_BC4_TX_COMP_VS_FREQ_0_I = 4027,
-	NV_WCDMA_BC4_TX_COMP_VS_FREQ_1_I = 4028,
-	NV_WCDMA_BC4_TX_LIN_VS_TEMP_0_I = 4029,
-	NV_WCDMA_BC4_TX_LIN_VS_TEMP_1_I = 4030,
-	NV_WCDMA_BC4_TX_SLP_VS_TEMP_0_I = 4031,
-	NV_WCDMA_BC4_TX_SLP_VS_TEMP_1_I = 4032,
-	NV_WCDMA_BC4_R1_RISE_I = 4033,
-	NV_WCDMA_BC4_R1_FALL_I = 4034,
-	NV_WCDMA_BC4_TX_LIM_VS_TEMP_I = 4035,
-	NV_WCDMA_BC4_TX_LIM_VS_FREQ_I = 4036,
-	NV_WCDMA_BC4_ADJ_FACTOR_I = 4037,
-	NV_WCDMA_BC4_EXP_HDET_VS_AGC_I = 4038,
-	NV_WCDMA_BC4_HDET_OFF_I = 4039,
-	NV_WCDMA_BC4_HDET_SPN_I = 4040,
-	NV_WCDMA_BC4_ENC_BTF_I = 4041,
-	NV_WCDMA_BC4_AGC_PA_ON_RISE_DELAY_I = 4042,
-	NV_WCDMA_BC4_AGC_PA_ON_FALL_DELAY_I = 4043,
-	NV_WCDMA_BC4_AGC_TX_ON_RISE_DELAY_I = 4044,
-	NV_WCDMA_BC4_AGC_TX_ON_FALL_DELAY_I = 4045,
-	NV_WCDMA_BC4_AGC_UPDATE_TX_AGC_TIME_I = 4046,
-	NV_WCDMA_BC4_PRACH_R1_RISE_OFFSET_I = 4047,
-	NV_WCDMA_BC4_PRACH_R1_FALL_OFFSET_I = 4048,
-	NV_WCDMA_BC4_TX_CAL_CHAN_I = 4049,
-	NV_WCDMA_BC4_RX_CAL_CHAN_I = 4050,
-	NV_WCDMA_BC4_TX_LIN_MASTER_2_I = 4051,
-	NV_WCDMA_BC4_TX_LIN_MASTER_3_I = 4052,
-	NV_WCDMA_BC4_TX_COMP_VS_FREQ_2_I = 4053,
-	NV_WCDMA_BC4_TX_COMP_VS_FREQ_3_I = 4054,
-	NV_WCDMA_BC4_TX_LIN_VS_TEMP_2_I = 4055,
-	NV_WCDMA_BC4_TX_LIN_VS_TEMP_3_I = 4056,
-	NV_WCDMA_BC4_TX_SLP_VS_TEMP_2_I = 4057,
-	NV_WCDMA_BC4_TX_SLP_VS_TEMP_3_I = 4058,
-	NV_WCDMA_BC4_R2_RISE_I = 4059,
-	NV_WCDMA_BC4_R2_FALL_I = 4060,
-	NV_WCDMA_BC4_R3_RISE_I = 4061,
-	NV_WCDMA_BC4_R3_FALL_I = 4062,
-	NV_WCDMA_BC4_PA_COMPENSATE_UP_R2_I = 4063,
-	NV_WCDMA_BC4_PA_COMPENSATE_DOWN_R2_I = 4064,
-	NV_WCDMA_BC4_PA_COMPENSATE_UP_R3_I = 4065,
-	NV_WCDMA_BC4_PA_COMPENSATE_DOWN_R3_I = 4066,
-	NV_WCDMA_BC4_TX_ROT_ANGLE_PA_STATE_00_I = 4067,
-	NV_WCDMA_BC4_TX_ROT_ANGLE_PA_STATE_01_I = 4068,
-	NV_WCDMA_BC4_TX_ROT_ANGLE_PA_STATE_10_I = 4069,
-	NV_WCDMA_BC4_TX_ROT_ANGLE_PA_STATE_11_I = 4070,
-	NV_WCDMA_BC4_PRACH_R2_RISE_OFFSET_I = 4071,
-	NV_WCDMA_BC4_PRACH_R2_FALL_OFFSET_I = 4072,
-	NV_WCDMA_BC4_PRACH_R3_RISE_OFFSET_I = 4073,
-	NV_WCDMA_BC4_PRACH_R3_FALL_OFFSET_I = 4074,
-	NV_WCDMA_BC4_PA_RANGE_MAP_I = 4075,
-	NV_WCDMA_BC4_DCH_AGC_UPDATE_TX_AGC_TIME_I = 4076,
-	NV_WCDMA_BC4_AGC_TX_ADJ_PDM_DELAY_I = 4077,
-	NV_WCDMA_BC4_UTRAN_TX_LIM_VS_TEMP_OFFSET_I = 4078,
-	NV_WCDMA_BC4_PA_GAIN_UP_TIME_I = 4079,
-	NV_WCDMA_BC4_PA_GAIN_DOWN_TIME_I = 4080,
-	NV_WCDMA_BC4_PA_COMPENSATE_UP_I = 4081,
-	NV_WCDMA_BC4_PA_COMPENSATE_DOWN_I = 4082,
-	NV_WCDMA_BC4_RX_DELAY_I = 4083,
-	NV_WCDMA_BC4_PA_RANGE_FOR_DVS_I = 4084,
-	NV_WCDMA_BC4_PA_COMPENSATE_UP_WITH_DVS_I = 4085,
-	NV_WCDMA_BC4_PA_COMPENSATE_DN_WITH_DVS_I = 4086,
-	NV_WCDMA_BC4_MAX_PWR_BACKOFF_VOLTAGES_I = 4087,
-	NV_WCDMA_BC4_MAX_PWR_BACKOFF_VOLT1_I = 4088,
-	NV_WCDMA_BC4_MAX_PWR_BACKOFF_VOLT2_I = 4089,
-	NV_WCDMA_BC4_MAX_PWR_BACKOFF_VOLT3_I = 4090,
-	NV_WCDMA_BC4_HS_R1_RISE_I = 4091,
-	NV_WCDMA_BC4_HS_R1_FALL_I = 4092,
-	NV_WCDMA_BC4_HS_R2_RISE_I = 4093,
-	NV_WCDMA_BC4_HS_R2_FALL_I = 4094,
-	NV_WCDMA_BC4_HS_R3_RISE_I = 4095,
-	NV_WCDMA_BC4_HS_R3_FALL_I = 4096,
-	NV_RFR_VCO_COARSE_TUNING_BC4_I = 4097,
-	NV_RF_ANTSEL_UMTS_900_I = 4098,
-	NV_RF_ANTSEL_UMTS_BC4_I = 4099,
-	NV_GPS1_NMEA_OUTPUT_I = 4100,
-	NV_ROAM_IND_CUSTOM_HOME_I = 4101,
-	NV_CDMA_SO68_ENABLED_I = 4102,
-	NV_RTR_BB_FILTER_I = 4103,
-	NV_MF_CHAN_SUPPORT_I = 4104,
-	NV_MF_RF_PATH_CONFIG_I = 4105,
-	NV_MF_RSSI_CAL_VS_FREQ_0_I = 4106,
-	NV_MF_RSSI_CAL_VS_FREQ_1_I = 4107,
-	NV_MF_RSSI_CAL_VS_FREQ_2_I = 4108,
-	NV_MF_RSSI_CAL_VS_FREQ_3_I = 4109,
-	NV_UPLOADMEDIA_POSTCARD_SERVER_READONLY_I = 4110,
-	NV_UMTS_CALL_VT_CODEC_LIST_I = 4111,
-	NV_WCDMA_BC4_TX_PDM_LIN_0_I = 4112,
-	NV_WCDMA_BC4_TX_PDM_LIN_1_I = 4113,
-	NV_WCDMA_BC4_TX_PDM_LIN_2_I = 4114,
-	NV_WCDMA_BC4_TX_PDM_LIN_3_I = 4115,
-	NV_INTERRAT_NACC_SUPPORT_I = 4116,
-	NV_DARP_FEATURE_SUPPORT_I = 4117,
-	NV_HSDPA_CAT_I = 4118,
-	NV_SET_DISPLAY_LAYOUT_I = 4119,
-	NV_SET_CHINESE_ASSOCIATED_SWITCH_I = 4120,
-	NV_SET_CHINESE_INPUT_METHODS_I = 4121,
-	NV_WLAN_QOS_MODE_I = 4122,
-	NV_GAME_MODE_PERSIST_I = 4123,
-	NV_GAME_MODE_I = 4124,
-	NV_GSM_850_GMSK_MULTISLOT_2_TX_PWR_I = 4125,
-	NV_GSM_850_GMSK_MULTISLOT_3_TX_PWR_I = 4126,
-	NV_GSM_850_GMSK_MULTISLOT_4_TX_PWR_I = 4127,
-	NV_GSM_850_GMSK_MULTISLOT_5_TX_PWR_I = 4128,
-	NV_GSM_GMSK_MULTISLOT_2_TX_PWR_I = 4129,
-	NV_GSM_GMSK_MULTISLOT_3_TX_PWR_I = 4130,
-	NV_GSM_GMSK_MULTISLOT_4_TX_PWR_I = 4131,
-	NV_GSM_GMSK_MULTISLOT_5_TX_PWR_I = 4132,
-	NV_DCS_GMSK_MULTISLOT_2_TX_PWR_I = 4133,
-	NV_DCS_GMSK_MULTISLOT_3_TX_PWR_I = 4134,
-	NV_DCS_GMSK_MULTISLOT_4_TX_PWR_I = 4135,
-	NV_DCS_GMSK_MULTISLOT_5_TX_PWR_I = 4136,
-	NV_GSM_1900_GMSK_MULTISLOT_2_TX_PWR_I = 4137,
-	NV_GSM_1900_GMSK_MULTISLOT_3_TX_PWR_I = 4138,
-	NV_GSM_1900_GMSK_MULTISLOT_4_TX_PWR_I = 4139,
-	NV_GSM_1900_GMSK_MULTISLOT_5_TX_PWR_I = 4140,
-	NV_GSM_850_8PSK_MULTISLOT_2_TX_PWR_I = 4141,
-	NV_GSM_850_8PSK_MULTISLOT_3_TX_PWR_I = 4142,
-	NV_GSM_850_8PSK_MULTISLOT_4_TX_PWR_I = 4143,
-	NV_GSM_850_8PSK_MULTISLOT_5_TX_PWR_I = 4144,
-	NV_GSM_8PSK_MULTISLOT_2_TX_PWR_I = 4145,
-	NV_GSM_8PSK_MULTISLOT_3_TX_PWR_I = 4146,
-	NV_GSM_8PSK_MULTISLOT_4_TX_PWR_I = 4147,
-	NV_GSM_8PSK_MULTISLOT_5_TX_PWR_I = 4148,
-	NV_DCS_8PSK_MULTISLOT_2_TX_PWR_I = 4149,
-	NV_DCS_8PSK_MULTISLOT_3_TX_PWR_I = 4150,
-	NV_DCS_8PSK_MULTISLOT_4_TX_PWR_I = 4151,
-	NV_DCS_8PSK_MULTISLOT_5_TX_PWR_I = 4152,
-	NV_GSM_1900_8PSK_MULTISLOT_2_TX_PWR_I = 4153,
-	NV_GSM_1900_8PSK_MULTISLOT_3_TX_PWR_I = 4154,
-	NV_GSM_1900_8PSK_MULTISLOT_4_TX_PWR_I = 4155,
-	NV_GSM_1900_8PSK_MULTISLOT_5_TX_PWR_I = 4156,
-	NV_MULTISLOT_GMSK_POWER_PROFILE_I = 4157,
-	NV_MULTISLOT_8PSK_POWER_PROFILE_I = 4158,
-	NV_HSDPA_COMPRESSED_MODE_ENABLED_I = 4159,
-	NV_LOCK_CODE_EXT_I = 4160,
-	NV_WCDMA_IACCUM_I = 4161,
-	NV_WCDMA_QACCUM_I = 4162,
-	NV_WCDMA_1900_IACCUM_I = 4163,
-	NV_WCDMA_1900_QACCUM_I = 4164,
-	NV_WCDMA_1800_IACCUM_I = 4165,
-	NV_WCDMA_1800_QACCUM_I = 4166,
-	NV_WCDMA_BC4_IACCUM_I = 4167,
-	NV_WCDMA_BC4_QACCUM_I = 4168,
-	NV_WCDMA_800_IACCUM_I = 4169,
-	NV_WCDMA_800_QACCUM_I = 4170,
-	NV_WCDMA_900_IACCUM_I = 4171,
-	NV_WCDMA_900_QACCUM_I = 4172,
-	NV_WCDMA_RRC_PDCP_DISABLED_I = 4173,
-	NV_GSM_IM2_850_I = 4174,
-	NV_GSM_IM2_900_I = 4175,
-	NV_GSM_IM2_1800_I = 4176,
-	NV_GSM_IM2_1900_I = 4177,
-	NV_MARKET_REGION_UI_I = 4178,
-	NV_GSM_TX_RSB_CORR_I = 4179,
-	NV_DCS_TX_RSB_CORR_I = 4180,
-	NV_GSM_850_TX_RSB_CORR_I = 4181,
-	NV_GSM_1900_TX_RSB_CORR_I = 4182,
-	NV_VOIP_QOS_ENABLED_I = 4183,
-	NV_SEC_CSPRNG_INIT_SEED_I = 4184,
-	NV_HDR_MIN_UATI_MODE_I = 4185,
-	NV_VOIP_WRITE_MEDIA_FILE_ENABLED_I = 4186,
-	NV_VOIP_READ_MEDIA_FILE_ENABLED_I = 4187,
-	NV_RDB_LOCK_TO_USER_I = 4188,
-	NV_MS_MESSAGINGDAEMON_LOG_ENABLED_I = 4189,
-	NV_JAVA_POSITIONING_ENABLED_I = 4190,
-	NV_LOCK_CODE_EXT_DIGITS_I = 4191,
-	NV_CDMA_SO70_ENABLED_I = 4192,
-	NV_HDRIDLE_DESIRED_SLOTTED_MODE_CONFIG_I = 4193,
-	NV_WCDMA_1800_DRX_MODE_SEL_I = 4194,
-	NV_WCDMA_1900_DRX_MODE_SEL_I = 4195,
-	NV_WCDMA_2100_DRX_MODE_SEL_I = 4196,
-	NV_WCDMA_800_DRX_MODE_SEL_I = 4197,
-	NV_WCDMA_900_DRX_MODE_SEL_I = 4198,
-	NV_WCDMA_BC4_DRX_MODE_SEL_I = 4199,
-	NV_GPS_DRX_MODE_SEL_I = 4200,
-	NV_APPS_PWRC_DISABLE_I = 4201,
-	NV_WLAN_OEM_INDEX_I = 4202,
-	NV_MS_NOTIFY_FIRST_RETRY_I = 4203,
-	NV_HDRSCP_FORCE_REL0_CONFIG_I = 4204,
-	NV_UIM_CONFIG_PARAMS_I = 4205,
-	NV_HDRSCMDB_SECURE_CONFIG_I = 4206,
-	NV_HDRAMP_LOCATION_I = 4207,
-	NV_CRASH_DEBUG_DISALLOWED_I = 4208,
-	NV_EDTM_FEATURE_SUPPORT_I = 4209,
-	NV_WCDMA_HSUPA_CATEGORY_I = 4210,
-	NV_WCDMA_OPTIONAL_FEATURE_LIST_I = 4211,
-	NV_XO_TRIM_VALUES_I = 4212,
-	NV_GSM_PATH_DELAY_COMP_FREQ_TBL_I = 4213,
-	NV_GSM_850_PATH_DELAY_COMP_FREQ_TBL_I = 4214,
-	NV_GSM_PATH_DELAY_COLD_TEMP_VS_FREQ_I = 4215,
-	NV_GSM_PATH_DELAY_ROOM_TEMP_VS_FREQ_I = 4216,
-	NV_GSM_PATH_DELAY_HOT_TEMP_VS_FREQ_I = 4217,
-	NV_GSM_850_PATH_DELAY_COLD_TEMP_VS_FREQ_I = 4218,
-	NV_GSM_850_PATH_DELAY_ROOM_TEMP_VS_FREQ_I = 4219,
-	NV_GSM_850_PATH_DELAY_HOT_TEMP_VS_FREQ_I = 4220,
-	NV_THERM_VALUE_T1_I = 4221,
-	NV_THERM_VALUE_T2_I = 4222,
-	NV_THERM_VALUE_T3_I = 4223,
-	NV_THERM_VALUE_T4_I = 4224,
-	NV_THERM_TEMP_MIN_I = 4225,
-	NV_THERM_TEMP_MAX_I = 4226,
-	NV_SMS_MAX_PAYLOAD_LENGTH_I = 4227,
-	NV_SMS_MO_ON_ACCESS_CHANNEL_I = 4228,
-	NV_SMS_MO_ON_TRAFFIC_CHANNEL_I = 4229,
-	NV_VOIP_CONFRD_URI_I = 4230,
-	NV_HDRL1_DBG_MSK_I = 4231,
-	NV_BUS_PROF_EBI1_ENABLE_I = 4232,
-	NV_BUS_PROF_SMI_ENABLE_I = 4233,
-	NV_BUS_PROF_EBI1_MODE_I = 4234,
-	NV_BUS_PROF_SMI_MODE_I = 4235,
-	NV_BUS_PROF_EBI1_TRIGGER_ID_I = 4236,
-	NV_BUS_PROF_SMI_TRIGGER_ID_I = 4237,
-	NV_BUS_PROF_EBI1_BUS_COUNT_I = 4238,
-	NV_BUS_PROF_SMI_BUS_COUNT_I = 4239,
-	NV_BUS_PROF_EBI1_SIMPLE_SETTINGS_0_I = 4240,
-	NV_BUS_PROF_EBI1_SIMPLE_SETTINGS_1_I = 4241,
-	NV_BUS_PROF_EBI1_SIMPLE_SETTINGS_2_I = 4242,
-	NV_BUS_PROF_EBI1_SIMPLE_SETTINGS_3_I = 4243,
-	NV_BUS_PROF_SMI_SIMPLE_SETTINGS_0_I = 4244,
-	NV_BUS_PROF_SMI_SIMPLE_SETTINGS_1_I = 4245,
-	NV_BUS_PROF_SMI_SIMPLE_SETTINGS_2_I = 4246,
-	NV_BUS_PROF_SMI_SIMPLE_SETTINGS_3_I = 4247,
-	NV_BUS_PROF_EBI1_ADVANCE_SETTINGS_0_I = 4248,
-	NV_BUS_PROF_EBI1_ADVANCE_SETTINGS_1_I = 4249,
-	NV_BUS_PROF_EBI1_ADVANCE_SETTINGS_2_I = 4250,
-	NV_BUS_PROF_EBI1_ADVANCE_SETTINGS_3_I = 4251,
-	NV_BUS_PROF_SMI_ADVANCE_SETTINGS_0_I = 4252,
-	NV_BUS_PROF_SMI_ADVANCE_SETTINGS_1_I = 4253,
-	NV_BUS_PROF_SMI_ADVANCE_SETTINGS_2_I = 4254,
-	NV_BUS_PROF_SMI_ADVANCE_SETTINGS_3_I = 4255,
-	NV_HDR_QOS_FLOW_PRIORITY_I = 4256,
-	NV_RF_PM_CONFIG_I = 4257,
-	NV_SMS_TL_ACK_ENABLED_I = 4258,
-	NV_WLAN_BSS_TYPE_PREF_I = 4259,
-	NV_HDRIDLE_PREF_SLOTTED_MODE_CONFIG_I = 4260,
-	NV_CPU_BASED_FLOW_CONTROL_I = 4261,
-	NV_PAT_ACQ_TIMEOUT_I = 4262,
-	NV_PMT_ACQ_TIMEOUT_I = 4263,
-	NV_INT_ACQ_TIMEOUT_I = 4264,
-	NV_VOIP_REGISTRATION_MODE_I = 4265,
-	NV_GPS1_CME_MAX_THROTTLE_DURATION_I = 4266,
-	NV_TIME_TOD_OFFSET_I = 4267,
-	NV_BC15_TX_LIN_MASTER0_I = 4268,
-	NV_BC15_TX_LIN_MASTER1_I = 4269,
-	NV_BC15_TX_LIN_MASTER2_I = 4270,
-	NV_BC15_TX_LIN_MASTER3_I = 4271,
-	NV_BC15_GPS1_RF_DELAY_I = 4272,
-	NV_BC15_TX_LIM_VS_TEMP_I = 4273,
-	NV_BC15_TX_COMP0_I = 4274,
-	NV_BC15_TX_COMP1_I = 4275,
-	NV_BC15_TX_COMP2_I = 4276,
-	NV_BC15_TX_COMP3_I = 4277,
-	NV_BC15_TX_LIM_VS_FREQ_I = 4278,
-	NV_BC15_PA_R1_RISE_I = 4279,
-	NV_BC15_PA_R1_FALL_I = 4280,
-	NV_BC15_PA_R2_RISE_I = 4281,
-	NV_BC15_PA_R2_FALL_I = 4282,
-	NV_BC15_PA_R3_RISE_I = 4283,
-	NV_BC15_PA_R3_FALL_I = 4284,
-	NV_BC15_HDET_OFF_I = 4285,
-	NV_BC15_HDET_SPN_I = 4286,
-	NV_BC15_EXP_HDET_VS_AGC_I = 4287,
-	NV_BC15_ENC_BTF_I = 4288,
-	NV_BC15_VCO_COARSE_TUNE_TABLE_I = 4289,
-	NV_BC15_VCO_TUNE_2_I = 4290,
-	NV_BC15_P1_RISE_FALL_OFF_I = 4291,
-	NV_BC15_HDR_P1_RISE_FALL_OFF_I = 4292,
-	NV_C0_BC15_TX_CAL_CHAN_I = 4293,
-	NV_C0_BC15_RX_CAL_CHAN_I = 4294,
-	NV_C0_BC15_RX_CAL_CHAN_LRU_I = 4295,
-	NV_C0_BC15_LNA_1_OFFSET_I = 4296,
-	NV_C0_BC15_LNA_2_OFFSET_I = 4297,
-	NV_C0_BC15_LNA_3_OFFSET_I = 4298,
-	NV_C0_BC15_LNA_4_OFFSET_I = 4299,
-	NV_C0_BC15_LNA_1_OFFSET_VS_FREQ_I = 4300,
-	NV_C0_BC15_LNA_2_OFFSET_VS_FREQ_I = 4301,
-	NV_C0_BC15_LNA_3_OFFSET_VS_FREQ_I = 4302,
-	NV_C0_BC15_LNA_4_OFFSET_VS_FREQ_I = 4303,
-	NV_C0_BC15_IM2_I_VALUE_I = 4304,
-	NV_C0_BC15_IM2_Q_VALUE_I = 4305,
-	NV_C0_BC15_VGA_GAIN_OFFSET_I = 4306,
-	NV_C0_BC15_VGA_GAIN_OFFSET_VS_FREQ_I = 4307,
-	NV_C0_BC15_IM2_TRANSCONDUCTOR_VALUE_I = 4308,
-	NV_C0_BC15_LNA_1_RISE_I = 4309,
-	NV_C0_BC15_LNA_1_FALL_I = 4310,
-	NV_C0_BC15_LNA_2_RISE_I = 4311,
-	NV_C0_BC15_LNA_2_FALL_I = 4312,
-	NV_C0_BC15_LNA_3_RISE_I = 4313,
-	NV_C0_BC15_LNA_3_FALL_I = 4314,
-	NV_C0_BC15_LNA_4_RISE_I = 4315,
-	NV_C0_BC15_LNA_4_FALL_I = 4316,
-	NV_C0_BC15_IM_LEVEL1_I = 4317,
-	NV_C0_BC15_IM_LEVEL2_I = 4318,
-	NV_C0_BC15_IM_LEVEL3_I = 4319,
-	NV_C0_BC15_IM_LEVEL4_I = 4320,
-	NV_C1_BC15_TX_CAL_CHAN_I = 4321,
-	NV_C1_BC15_RX_CAL_CHAN_I = 4322,
-	NV_C1_BC15_LNA_1_OFFSET_VS_FREQ_I = 4323,
-	NV_C1_BC15_LNA_2_OFFSET_VS_FREQ_I = 4324,
-	NV_C1_BC15_LNA_3_OFFSET_VS_FREQ_I = 4325,
-	NV_C1_BC15_LNA_4_OFFSET_VS_FREQ_I = 4326,
-	NV_C1_BC15_LNA_1_OFFSET_I = 4327,
-	NV_C1_BC15_LNA_2_OFFSET_I = 4328,
-	NV_C1_BC15_LNA_3_OFFSET_I = 4329,
-	NV_C1_BC15_LNA_4_OFFSET_I = 4330,
-	NV_C1_BC15_IM2_I_VALUE_I = 4331,
-	NV_C1_BC15_IM2_Q_VALUE_I = 4332,
-	NV_C1_BC15_VGA_GAIN_OFFSET_I = 4333,
-	NV_C1_BC15_VGA_GAIN_OFFSET_VS_FREQ_I = 4334,
-	NV_C1_BC15_IM2_TRANSCONDUCTOR_VALUE_I = 4335,
-	NV_C1_BC15_LNA_1_RISE_I = 4336,
-	NV_C1_BC15_LNA_1_FALL_I = 4337,
-	NV_C1_BC15_LNA_2_RISE_I = 4338,
-	NV_C1_BC15_LNA_2_FALL_I = 4339,
-	NV_C1_BC15_LNA_3_RISE_I = 4340,
-	NV_C1_BC15_LNA_3_FALL_I = 4341,
-	NV_C1_BC15_LNA_4_RISE_I = 4342,
-	NV_C1_BC15_LNA_4_FALL_I = 4343,
-	NV_C1_BC15_IM_LEVEL1_I = 4344,
-	NV_C1_BC15_IM_LEVEL2_I = 4345,
-	NV_C1_BC15_IM_LEVEL3_I = 4346,
-	NV_C1_BC15_IM_LEVEL4_I = 4347,
-	NV_C1_BC15_VCO_COARSE_TUNE_TABLE_I = 4348,
-	NV_BC15_ANT_QUALITY_I = 4349,
-	NV_BC15_PA_DVS_VOLTAGE_I = 4350,
-	NV_C0_BC15_LNA_SWITCHPOINTS_LPM_1_I = 4351,
-	NV_C0_BC15_LNA_SWITCHPOINTS_LPM_2_I = 4352,
-	NV_C0_BC15_IM2_LPM_1_I = 4353,
-	NV_C0_BC15_IM2_LPM_2_I = 4354,
-	NV_C0_BC15_INTELLICEIVER_CAL_I = 4355,
-	NV_C0_BC15_INTELLICEIVER_DET_THRESH_I = 4356,
-	NV_C1_BC15_RX_CAL_CHAN_LRU_I = 4357,
-	NV_DCVS_ACPU_ENABLE_I = 4358,
-	NV_GPSONE_PASSWORD_I = 4359,
-	NV_VOIP_CALLERID_MODE_I = 4360,
-	NV_WLAN_MULTIDOMAIN_CAPABILITY_PREF_I = 4361,
-	NV_UMTS_NBNS_ENABLE_I = 4362,
-	NV_SCUDIF_CALLSETUP_PREF_I = 4363,
-	NV_VOIP_REFER_SUBSCRIPTION_EXPIRES_DURATION_I = 4364,
-	NV_VOIP_NOTIFY_REFER_RESPONSE_DURATION_I = 4365,
-	NV_SMS_SERVICE_OPTION_I = 4366,
-	NV_DRM_BIND_SIM_RIGHTS_I = 4367,
-	NV_GSM_850_PA_TEMP_COMP_MAX_PWR_I = 4368,
-	NV_GSM_PA_TEMP_COMP_MAX_PWR_I = 4369,
-	NV_DCS_PA_TEMP_COMP_MAX_PWR_I = 4370,
-	NV_GSM_1900_PA_TEMP_COMP_MAX_PWR_I = 4371,
-	NV_GSM_RSSI_TEMP_VALUES_I = 4372,
-	NV_GSM_850_RX_GAIN_RANGE_1_TEMP_COMP_I = 4373,
-	NV_GSM_RX_GAIN_RANGE_1_TEMP_COMP_I = 4374,
-	NV_DCS_RX_GAIN_RANGE_1_TEMP_COMP_I = 4375,
-	NV_GSM_1900_RX_GAIN_RANGE_1_TEMP_COMP_I = 4376,
-	NV_GSM_850_RX_GAIN_RANGE_2_TEMP_COMP_I = 4377,
-	NV_GSM_RX_GAIN_RANGE_2_TEMP_COMP_I = 4378,
-	NV_DCS_RX_GAIN_RANGE_2_TEMP_COMP_I = 4379,
-	NV_GSM_1900_RX_GAIN_RANGE_2_TEMP_COMP_I = 4380,
-	NV_GSM_850_RX_GAIN_RANGE_3_TEMP_COMP_I = 4381,
-	NV_GSM_RX_GAIN_RANGE_3_TEMP_COMP_I = 4382,
-	NV_DCS_RX_GAIN_RANGE_3_TEMP_COMP_I = 4383,
-	NV_GSM_1900_RX_GAIN_RANGE_3_TEMP_COMP_I = 4384,
-	NV_GSM_850_RX_GAIN_RANGE_4_TEMP_COMP_I = 4385,
-	NV_GSM_RX_GAIN_RANGE_4_TEMP_COMP_I = 4386,
-	NV_DCS_RX_GAIN_RANGE_4_TEMP_COMP_I = 4387,
-	NV_GSM_1900_RX_GAIN_RANGE_4_TEMP_COMP_I = 4388,
-	NV_GSM_850_RX_GAIN_RANGE_5_TEMP_COMP_I = 4389,
-	NV_GSM_RX_GAIN_RANGE_5_TEMP_COMP_I = 4390,
-	NV_DCS_RX_GAIN_RANGE_5_TEMP_COMP_I = 4391,
-	NV_GSM_1900_RX_GAIN_RANGE_5_TEMP_COMP_I = 4392,
-	NV_DCVSAPPS_NV_I = 4393,
-	NV_GPS1_SEC_UPDATE_RATE_I = 4394,
-	NV_MMGSDI_ME_CONFIG_PARAM_I = 4395,
-	NV_DS_MIP_DEREG_RETRIES_I = 4396,
-	NV_RUIM_NO_SUPPORT_I = 4397,
-	NV_UIM_SELECT_DEFAULT_USIM_APP_I = 4398,
-	NV_DETECT_HW_RESET_I = 4399,
-	NV_WCDMA_IM_LEVEL_4_I = 4400,
-	NV_WCDMA_LNA_OFFSET_VS_FREQ_4_I = 4401,
-	NV_WCDMA_LNA_RANGE_FALL_4_I = 4402,
-	NV_WCDMA_LNA_RANGE_OFFSET_4_I = 4403,
-	NV_WCDMA_LNA_RANGE_RISE_4_I = 4404,
-	NV_WCDMA_1900_IM_LEVEL_4_I = 4405,
-	NV_WCDMA_1900_LNA_OFFSET_VS_FREQ_4_I = 4406,
-	NV_WCDMA_1900_LNA_RANGE_FALL_4_I = 4407,
-	NV_WCDMA_1900_LNA_RANGE_OFFSET_4_I = 4408,
-	NV_WCDMA_1900_LNA_RANGE_RISE_4_I = 4409,
-	NV_WCDMA_800_IM_LEVEL_4_I = 4410,
-	NV_WCDMA_800_LNA_OFFSET_VS_FREQ_4_I = 4411,
-	NV_WCDMA_800_LNA_RANGE_FALL_4_I = 4412,
-	NV_WCDMA_800_LNA_RANGE_OFFSET_4_I = 4413,
-	NV_WCDMA_800_LNA_RANGE_RISE_4_I = 4414,
-	NV_WCDMA_1800_IM_LEVEL_4_I = 4415,
-	NV_WCDMA_1800_LNA_OFFSET_VS_FREQ_4_I = 4416,
-	NV_WCDMA_1800_LNA_RANGE_FALL_4_I = 4417,
-	NV_WCDMA_1800_LNA_RANGE_OFFSET_4_I = 4418,
-	NV_WCDMA_1800_LNA_RANGE_RISE_4_I = 4419,
-	NV_WCDMA_900_IM_LEVEL_4_I = 4420,
-	NV_WCDMA_900_LNA_OFFSET_VS_FREQ_4_I = 4421,
-	NV_WCDMA_900_LNA_RANGE_FALL_4_I = 4422,
-	NV_WCDMA_900_LNA_RANGE_OFFSET_4_I = 4423,
-	NV_WCDMA_900_LNA_RANGE_RISE_4_I = 4424,
-	NV_WCDMA_BC4_IM_LEVEL_4_I = 4425,
-	NV_WCDMA_BC4_LNA_OFFSET_VS_FREQ_4_I = 4426,
-	NV_WCDMA_BC4_LNA_RANGE_FALL_4_I = 4427,
-	NV_WCDMA_BC4_LNA_RANGE_OFFSET_4_I = 4428,
-	NV_WCDMA_BC4_LNA_RANGE_RISE_4_I = 4429,
-	NV_IPV6_PRIVACY_EXTENSIONS_ENABLED_I = 4430,
-	NV_IPV6_PRIVATE_ADDRESS_CONFIG_I = 4431,
-	NV_GPRS_GEA_ALGORITHMS_SUPPORTED_I = 4432,
-	NV_REX_TRACE_I = 4433,
-	NV_C1_WCDMA_1800_VGA_GAIN_OFFSET_I = 4434,
-	NV_C1_WCDMA_1800_VGA_GAIN_OFFSET_VS_FREQ_I = 4435,
-	NV_C1_WCDMA_1800_VGA_GAIN_OFFSET_VS_TEMP_I = 4436,
-	NV_C1_WCDMA_1800_LNA_RANGE_RISE_I = 4437,
-	NV_C1_WCDMA_1800_LNA_RANGE_RISE_2_I = 4438,
-	NV_C1_WCDMA_1800_LNA_RANGE_RISE_3_I = 4439,
-	NV_C1_WCDMA_1800_LNA_RANGE_RISE_4_I = 4440,
-	NV_C1_WCDMA_1800_LNA_RANGE_FALL_I = 4441,
-	NV_C1_WCDMA_1800_LNA_RANGE_FALL_2_I = 4442,
-	NV_C1_WCDMA_1800_LNA_RANGE_FALL_3_I = 4443,
-	NV_C1_WCDMA_1800_LNA_RANGE_FALL_4_I = 4444,
-	NV_C1_WCDMA_1800_IM_LEVEL_I = 4445,
-	NV_C1_WCDMA_1800_IM_LEVEL_2_I = 4446,
-	NV_C1_WCDMA_1800_IM_LEVEL_3_I = 4447,
-	NV_C1_WCDMA_1800_IM_LEVEL_4_I = 4448,
-	NV_C1_WCDMA_1800_LNA_RANGE_OFFSET_2_I = 4449,
-	NV_C1_WCDMA_1800_LNA_RANGE_OFFSET_3_I = 4450,
-	NV_C1_WCDMA_1800_LNA_RANGE_OFFSET_4_I = 4451,
-	NV_C1_WCDMA_1800_LNA_OFFSET_VS_FREQ_2_I = 4452,
-	NV_C1_WCDMA_1800_LNA_OFFSET_VS_FREQ_3_I = 4453,
-	NV_C1_WCDMA_1800_LNA_OFFSET_VS_FREQ_4_I = 4454,
-	NV_C1_WCDMA_1800_IM2_I_VALUE_I = 4455,
-	NV_C1_WCDMA_1800_IM2_Q_VALUE_I = 4456,
-	NV_C1_WCDMA_1800_IM2_TRANSCONDUCTOR_VALUE_I = 4457,
-	NV_C1_WCDMA_1800_NONBYPASS_TIMER_I = 4458,
-	NV_C1_WCDMA_1800_BYPASS_TIMER_I = 4459,
-	NV_C1_WCDMA_1800_LNA_RANGE_OFFSET_I = 4460,
-	NV_C1_WCDMA_1800_LNA_OFFSET_VS_FREQ_I = 4461,
-	NV_C1_WCDMA_1800_RX_CAL_CHAN_I = 4462,
-	NV_C1_WCDMA_900_VGA_GAIN_OFFSET_I = 4463,
-	NV_C1_WCDMA_900_VGA_GAIN_OFFSET_VS_FREQ_I = 4464,
-	NV_C1_WCDMA_900_VGA_GAIN_OFFSET_VS_TEMP_I = 4465,
-	NV_C1_WCDMA_900_LNA_RANGE_RISE_I = 4466,
-	NV_C1_WCDMA_900_LNA_RANGE_RISE_2_I = 4467,
-	NV_C1_WCDMA_900_LNA_RANGE_RISE_3_I = 4468,
-	NV_C1_WCDMA_900_LNA_RANGE_RISE_4_I = 4469,
-	NV_C1_WCDMA_900_LNA_RANGE_FALL_I = 4470,
-	NV_C1_WCDMA_900_LNA_RANGE_FALL_2_I = 4471,
-	NV_C1_WCDMA_900_LNA_RANGE_FALL_3_I = 4472,
-	NV_C1_WCDMA_900_LNA_RANGE_FALL_4_I = 4473,
-	NV_C1_WCDMA_900_IM_LEVEL_I = 4474,
-	NV_C1_WCDMA_900_IM_LEVEL_2_I = 4475,
-	NV_C1_WCDMA_900_IM_LEVEL_3_I = 4476,
-	NV_C1_WCDMA_900_IM_LEVEL_4_I = 4477,
-	NV_C1_WCDMA_900_LNA_RANGE_OFFSET_2_I = 4478,
-	NV_C1_WCDMA_900_LNA_RANGE_OFFSET_3_I = 4479,
-	NV_C1_WCDMA_900_LNA_RANGE_OFFSET_4_I = 4480,
-	NV_C1_WCDMA_900_LNA_OFFSET_VS_FREQ_2_I = 4481,
-	NV_C1_WCDMA_900_LNA_OFFSET_VS_FREQ_3_I = 4482,
-	NV_C1_WCDMA_900_LNA_OFFSET_VS_FREQ_4_I = 4483,
-	NV_C1_WCDMA_900_IM2_I_VALUE_I = 4484,
-	NV_C1_WCDMA_900_IM2_Q_VALUE_I = 4485,
-	NV_C1_WCDMA_900_IM2_TRANSCONDUCTOR_VALUE_I = 4486,
-	NV_C1_WCDMA_900_NONBYPASS_TIMER_I = 4487,
-	NV_C1_WCDMA_900_BYPASS_TIMER_I = 4488,
-	NV_C1_WCDMA_900_LNA_RANGE_OFFSET_I = 4489,
-	NV_C1_WCDMA_900_LNA_OFFSET_VS_FREQ_I = 4490,
-	NV_C1_WCDMA_900_RX_CAL_CHAN_I = 4491,
-	NV_C1_WCDMA_BC4_VGA_GAIN_OFFSET_I = 4492,
-	NV_C1_WCDMA_BC4_VGA_GAIN_OFFSET_VS_FREQ_I = 4493,
-	NV_C1_WCDMA_BC4_VGA_GAIN_OFFSET_VS_TEMP_I = 4494,
-	NV_C1_WCDMA_BC4_LNA_RANGE_RISE_I = 4495,
-	NV_C1_WCDMA_BC4_LNA_RANGE_RISE_2_I = 4496,
-	NV_C1_WCDMA_BC4_LNA_RANGE_RISE_3_I = 4497,
-	NV_C1_WCDMA_BC4_LNA_RANGE_RISE_4_I = 4498,
-	NV_C1_WCDMA_BC4_LNA_RANGE_FALL_I = 4499,
-	NV_C1_WCDMA_BC4_LNA_RANGE_FALL_2_I = 4500,
-	NV_C1_WCDMA_BC4_LNA_RANGE_FALL_3_I = 4501,
-	NV_C1_WCDMA_BC4_LNA_RANGE_FALL_4_I = 4502,
-	NV_C1_WCDMA_BC4_IM_LEVEL_I = 4503,
-	NV_C1_WCDMA_BC4_IM_LEVEL_2_I = 4504,
-	NV_C1_WCDMA_BC4_IM_LEVEL_3_I = 4505,
-	NV_C1_WCDMA_BC4_IM_LEVEL_4_I = 4506,
-	NV_C1_WCDMA_BC4_LNA_RANGE_OFFSET_2_I = 4507,
-	NV_C1_WCDMA_BC4_LNA_RANGE_OFFSET_3_I = 4508,
-	NV_C1_WCDMA_BC4_LNA_RANGE_OFFSET_4_I = 4509,
-	NV_C1_WCDMA_BC4_LNA_OFFSET_VS_FREQ_2_I = 4510,
-	NV_C1_WCDMA_BC4_LNA_OFFSET_VS_FREQ_3_I = 4511,
-	NV_C1_WCDMA_BC4_LNA_OFFSET_VS_FREQ_4_I = 4512,
-	NV_C1_WCDMA_BC4_IM2_I_VALUE_I = 4513,
-	NV_C1_WCDMA_BC4_IM2_Q_VALUE_I = 4514,
-	NV_C1_WCDMA_BC4_IM2_TRANSCONDUCTOR_VALUE_I = 4515,
-	NV_C1_WCDMA_BC4_NONBYPASS_TIMER_I = 4516,
-	NV_C1_WCDMA_BC4_BYPASS_TIMER_I = 4517,
-	NV_C1_WCDMA_BC4_LNA_RANGE_OFFSET_I = 4518,
-	NV_C1_WCDMA_BC4_LNA_OFFSET_VS_FREQ_I = 4519,
-	NV_C1_WCDMA_BC4_RX_CAL_CHAN_I = 4520,
-	NV_MF_PREF_RF_CHAN_LIST_I = 4521,
-	NV_MF_IC_UPDATE_RATE_I = 4522,
-	NV_NPT_COUNT_I = 4523,
-	NV_SMS_BEARER_PREFS_I = 4524,
-	NV_BT_DISABLED_I = 4525,
-	NV_HS_USB_CURRENT_COMPOSITION_I = 4526,
-	NV_WLAN_ENABLE_BT_COEX_I = 4527,
-	NV_HDR_EMPA_SUPPORTED_I = 4528,
-	NV_AAGPS_XTRA_ENABLED_I = 4529,
-	NV_AAGPS_XTRA_DOWNLOAD_INTERVAL_I = 4530,
-	NV_AAGPS_XTRA_NUM_DOWNLOAD_ATTEMPTS_I = 4531,
-	NV_AAGPS_XTRA_PRIMARY_SERVER_URL_I = 4532,
-	NV_AAGPS_XTRA_SECONDARY_SERVER_URL_I = 4533,
-	NV_AAGPS_XTRA_TIME_BETWEEN_ATTEMPTS_I = 4534,
-	NV_AAGPS_XTRA_TERTIARY_SERVER_URL_I = 4535,
-	NV_AAGPS_XTRA_AUTO_DOWNLOAD_ENABLED_I = 4536,
-	NV_AAGPS_XTRA_TIME_INFO_ENABLED_I = 4537,
-	NV_AAGPS_XTRA_TIME_INFO_UNC_THRESH_I = 4538,
-	NV_AAGPS_XTRA_TIME_INFO_DELAY_THRESH_I = 4539,
-	NV_AAGPS_XTRA_PRIMARY_SNTP_SERVER_URL_I = 4540,
-	NV_AAGPS_XTRA_SECONDARY_SNTP_SERVER_URL_I = 4541,
-	NV_AAGPS_XTRA_TERTIARY_SNTP_SERVER_URL_I = 4542,
-	NV_VOIP_PRECONDITION_ENABLE_I = 4543,
-	NV_AAGPS_IPC_DM_THREAD_MASK_I = 4544,
-	NV_MF_RF_OVERRIDE_DESC_I = 4545,
-	NV_MF_DMTT_PARAMS_I = 4546,
-	NV_CAMERA_DEFAULT_PREVIEW_ROTATION_I = 4547,
-	NV_RF_BC_CONFIG_DIV_I = 4548,
-	NV_BCX_BLOCK_GPS1_RF_DELAY_I = 4549,
-	NV_BCX_BLOCK_RF_TUNE_RESERVED_I = 4550,
-	NV_BCX_BLOCK_TX_LIM_VS_TEMP_I = 4551,
-	NV_BCX_BLOCK_TX_LIN_MASTER0_I = 4552,
-	NV_BCX_BLOCK_TX_LIN_MASTER1_I = 4553,
-	NV_BCX_BLOCK_TX_LIN_MASTER2_I = 4554,
-	NV_BCX_BLOCK_TX_LIN_MASTER3_I = 4555,
-	NV_BCX_BLOCK_TX_COMP0_I = 4556,
-	NV_BCX_BLOCK_TX_COMP1_I = 4557,
-	NV_BCX_BLOCK_TX_COMP2_I = 4558,
-	NV_BCX_BLOCK_TX_COMP3_I = 4559,
-	NV_BCX_BLOCK_TX_LIM_VS_FREQ_I = 4560,
-	NV_BCX_BLOCK_PA_R1_RISE_I = 4561,
-	NV_BCX_BLOCK_PA_R1_FALL_I = 4562,
-	NV_BCX_BLOCK_PA_R2_RISE_I = 4563,
-	NV_BCX_BLOCK_PA_R2_FALL_I = 4564,
-	NV_BCX_BLOCK_PA_R3_RISE_I = 4565,
-	NV_BCX_BLOCK_PA_R3_FALL_I = 4566,
-	NV_BCX_BLOCK_HDET_OFF_I = 4567,
-	NV_BCX_BLOCK_HDET_SPN_I = 4568,
-	NV_BCX_BLOCK_EXP_HDET_VS_AGC_I = 4569,
-	NV_BCX_BLOCK_ENC_BTF_I = 4570,
-	NV_BCX_BLOCK_VCO_COARSE_TUNE_TABLE_I = 4571,
-	NV_BCX_BLOCK_P1_RISE_FALL_OFF_I = 4572,
-	NV_C0_BCX_BLOCK_TX_CAL_CHAN_I = 4573,
-	NV_C0_BCX_BLOCK_RX_CAL_CHAN_I = 4574,
-	NV_C0_BCX_BLOCK_LNA_1_OFFSET_VS_FREQ_I = 4575,
-	NV_C0_BCX_BLOCK_LNA_2_OFFSET_VS_FREQ_I = 4576,
-	NV_C0_BCX_BLOCK_LNA_3_OFFSET_VS_FREQ_I = 4577,
-	NV_C0_BCX_BLOCK_LNA_4_OFFSET_VS_FREQ_I = 4578,
-	NV_C0_BCX_BLOCK_LNA_1_OFFSET_I = 4579,
-	NV_C0_BCX_BLOCK_LNA_2_OFFSET_I = 4580,
-	NV_C0_BCX_BLOCK_LNA_3_OFFSET_I = 4581,
-	NV_C0_BCX_BLOCK_LNA_4_OFFSET_I = 4582,
-	NV_C0_BCX_BLOCK_IM2_I_VALUE_I = 4583,
-	NV_C0_BCX_BLOCK_IM2_Q_VALUE_I = 4584,
-	NV_C0_BCX_BLOCK_VGA_GAIN_OFFSET_I = 4585,
-	NV_C0_BCX_BLOCK_VGA_GAIN_OFFSET_VS_FREQ_I = 4586,
-	NV_C0_BCX_BLOCK_IM2_TRANSCONDUCTOR_VALUE_I = 4587,
-	NV_C0_BCX_BLOCK_LNA_1_RISE_I = 4588,
-	NV_C0_BCX_BLOCK_LNA_1_FALL_I = 4589,
-	NV_C0_BCX_BLOCK_LNA_2_RISE_I = 4590,
-	NV_C0_BCX_BLOCK_LNA_2_FALL_I = 4591,
-	NV_C0_BCX_BLOCK_LNA_3_RISE_I = 4592,
-	NV_C0_BCX_BLOCK_LNA_3_FALL_I = 4593,
-	NV_C0_BCX_BLOCK_LNA_4_RISE_I = 4594,
-	NV_C0_BCX_BLOCK_LNA_4_FALL_I = 4595,
-	NV_C0_BCX_BLOCK_IM_LEVEL1_I = 4596,
-	NV_C0_BCX_BLOCK_IM_LEVEL2_I = 4597,
-	NV_C0_BCX_BLOCK_IM_LEVEL3_I = 4598,
-	NV_C0_BCX_BLOCK_IM_LEVEL4_I = 4599,
-	NV_C1_BCX_BLOCK_TX_CAL_CHAN_I = 4600,
-	NV_C1_BCX_BLOCK_RX_CAL_CHAN_I = 4601,
-	NV_C1_BCX_BLOCK_LNA_1_OFFSET_VS_FREQ_I = 4602,
-	NV_C1_BCX_BLOCK_LNA_2_OFFSET_VS_FREQ_I = 4603,
-	NV_C1_BCX_BLOCK_LNA_3_OFFSET_VS_FREQ_I = 4604,
-	NV_C1_BCX_BLOCK_LNA_4_OFFSET_VS_FREQ_I = 4605,
-	NV_C1_BCX_BLOCK_LNA_1_OFFSET_I = 4606,
-	NV_C1_BCX_BLOCK_LNA_2_OFFSET_I = 4607,
-	NV_C1_BCX_BLOCK_LNA_3_OFFSET_I = 4608,
-	NV_C1_BCX_BLOCK_LNA_4_OFFSET_I = 4609,
-	NV_C1_BCX_BLOCK_IM2_I_VALUE_I = 4610,
-	NV_C1_BCX_BLOCK_IM2_Q_VALUE_I = 4611,
-	NV_C1_BCX_BLOCK_VGA_GAIN_OFFSET_I = 4612,
-	NV_C1_BCX_BLOCK_VGA_GAIN_OFFSET_VS_FREQ_I = 4613,
-	NV_C1_BCX_BLOCK_IM2_TRANSCONDUCTOR_VALUE_I = 4614,
-	NV_C1_BCX_BLOCK_LNA_1_RISE_I = 4615,
-	NV_C1_BCX_BLOCK_LNA_1_FALL_I = 4616,
-	NV_C1_BCX_BLOCK_LNA_2_RISE_I = 4617,
-	NV_C1_BCX_BLOCK_LNA_2_FALL_I = 4618,
-	NV_C1_BCX_BLOCK_LNA_3_RISE_I = 4619,
-	NV_C1_BCX_BLOCK_LNA_3_FALL_I = 4620,
-	NV_C1_BCX_BLOCK_LNA_4_RISE_I = 4621,
-	NV_C1_BCX_BLOCK_LNA_4_FALL_I = 4622,
-	NV_C1_BCX_BLOCK_IM_LEVEL1_I = 4623,
-	NV_C1_BCX_BLOCK_IM_LEVEL2_I = 4624,
-	NV_C1_BCX_BLOCK_IM_LEVEL3_I = 4625,
-	NV_C1_BCX_BLOCK_IM_LEVEL4_I = 4626,
-	NV_GPS1_XTRA_ENABLED_I = 4627,
-	NV_GPS1_XTRA_DOWNLOAD_INTERVAL_I = 4628,
-	NV_GPS1_XTRA_NUM_DOWNLOAD_ATTEMPTS_I = 4629,
-	NV_GPS1_XTRA_TIME_BETWEEN_ATTEMPTS_I = 4630,
-	NV_GPS1_XTRA_AUTO_DOWNLOAD_ENABLED_I = 4631,
-	NV_GPS1_XTRA_PRIMARY_SERVER_URL_I = 4632,
-	NV_GPS1_XTRA_SECONDARY_SERVER_URL_I = 4633,
-	NV_GPS1_XTRA_TERTIARY_SERVER_URL_I = 4634,
-	NV_DB_LP_SEC_I = 4635,
-	NV_DB_LTM_OFF_I = 4636,
-	NV_DB_DAYLT_I = 4637,
-	NV_BC0_TX_PDM_LIN_0_I = 4638,
-	NV_BC0_TX_PDM_LIN_1_I = 4639,
-	NV_BC0_TX_PDM_LIN_2_I = 4640,
-	NV_BC0_TX_PDM_LIN_3_I = 4641,
-	NV_BC1_TX_PDM_LIN_0_I = 4642,
-	NV_BC1_TX_PDM_LIN_1_I = 4643,
-	NV_BC1_TX_PDM_LIN_2_I = 4644,
-	NV_BC1_TX_PDM_LIN_3_I = 4645,
-	NV_BC3_TX_PDM_LIN_0_I = 4646,
-	NV_BC3_TX_PDM_LIN_1_I = 4647,
-	NV_BC3_TX_PDM_LIN_2_I = 4648,
-	NV_BC3_TX_PDM_LIN_3_I = 4649,
-	NV_BC4_TX_PDM_LIN_0_I = 4650,
-	NV_BC4_TX_PDM_LIN_1_I = 4651,
-	NV_BC4_TX_PDM_LIN_2_I = 4652,
-	NV_BC4_TX_PDM_LIN_3_I = 4653,
-	NV_BC5_TX_PDM_LIN_0_I = 4654,
-	NV_BC5_TX_PDM_LIN_1_I = 4655,
-	NV_BC5_TX_PDM_LIN_2_I = 4656,
-	NV_BC5_TX_PDM_LIN_3_I = 4657,
-	NV_BC6_TX_PDM_LIN_0_I = 4658,
-	NV_BC6_TX_PDM_LIN_1_I = 4659,
-	NV_BC6_TX_PDM_LIN_2_I = 4660,
-	NV_BC6_TX_PDM_LIN_3_I = 4661,
-	NV_BC11_TX_PDM_LIN_0_I = 4662,
-	NV_BC11_TX_PDM_LIN_1_I = 4663,
-	NV_BC11_TX_PDM_LIN_2_I = 4664,
-	NV_BC11_TX_PDM_LIN_3_I = 4665,
-	NV_BC14_TX_PDM_LIN_0_I = 4666,
-	NV_BC14_TX_PDM_LIN_1_I = 4667,
-	NV_BC14_TX_PDM_LIN_2_I = 4668,
-	NV_BC14_TX_PDM_LIN_3_I = 4669,
-	NV_BC15_TX_PDM_LIN_0_I = 4670,
-	NV_BC15_TX_PDM_LIN_1_I = 4671,
-	NV_BC15_TX_PDM_LIN_2_I = 4672,
-	NV_BC15_TX_PDM_LIN_3_I = 4673,
-	NV_HIT_ENABLE_I = 4674,
-	NV_VCI_PARAMETERS_I = 4675,
-	NV_DS707_GO_NULL_TIMER_1X_I = 4676,
-	NV_DS707_GO_NULL_TIMER_DO_I = 4677,
-	NV_WLAN_MAC_ADDRESS_I = 4678,
-	NV_CLK_REGIME_TEST_CFG_I = 4679,
-	NV_DVBH_PAT_ACQ_TIMEOUT_I = 4680,
-	NV_DVBH_PMT_ACQ_TIMEOUT_I = 4681,
-	NV_DVBH_INT_ACQ_TIMEOUT_I = 4682,
-	NV_DVBH_UHF_FREQ_BAND_RANGE_I = 4683,
-	NV_DVBH_VHF_FREQ_BAND_RANGE_I = 4684,
-	NV_DVBH_L_FREQ_BAND_RANGE_I = 4685,
-	NV_DVBH_UHF_BAND_BW_I = 4686,
-	NV_DVBH_UHF_BAND_OFFSET_I = 4687,
-	NV_DVBH_VHF_BAND_BW_I = 4688,
-	NV_DVBH_VHF_BAND_OFFSET_I = 4689,
-	NV_DVBH_L_BAND_BW_I = 4690,
-	NV_DVBH_L_BAND_OFFSET_I = 4691,
-	NV_DVBH_PLATFORM_NW_ID_LIST_I = 4692,
-	NV_HTTP_PROXY_SERVER_ADDR_I = 4693,
-	NV_HTTP_PROXY_SERVER_ADDR_ALTERNATE_I = 4694,
-	NV_CGPS_1X_PDE_SERVER_ADDR_IPV4_I = 4695,
-	NV_CGPS_1X_PDE_SERVER_ADDR_IPV6_I = 4696,
-	NV_CGPS_1X_PDE_SERVER_ADDR_URL_I = 4697,
-	NV_CGPS_1X_MPC_SERVER_ADDR_IPV4_I = 4698,
-	NV_CGPS_1X_MPC_SERVER_ADDR_IPV6_I = 4699,
-	NV_CGPS_1X_MPC_SERVER_ADDR_URL_I = 4700,
-	NV_CGPS_UMTS_PDE_SERVER_ADDR_IPV4_I = 4701,
-	NV_CGPS_UMTS_PDE_SERVER_ADDR_IPV6_I = 4702,
-	NV_CGPS_UMTS_PDE_SERVER_ADDR_URL_I = 4703,
-	NV_CGPS_1X_PDE_SERVER_PORT_I = 4704,
-	NV_CGPS_1X_MPC_SERVER_PORT_I = 4705,
-	NV_CGPS_UMTS_PDE_SERVER_PORT_I = 4706,
-	NV_CGPS_MO_METHOD_I = 4707,
-	NV_CGPS_NMEA_SENTENCE_TYPE_I = 4708,
-	NV_CGPS_MAX_OSC_UNC_ACTIVE_SYS_I = 4709,
-	NV_CGPS_MAX_OSC_UNC_RGS_I = 4710,
-	NV_CGPS_MAX_OSC_UNC_TEMP_TBL_I = 4711,
-	NV_CGPS_MAX_OSC_UNC_RGS_OLD_I = 4712,
-	NV_CGPS_MAX_CARRIER_CODE_FILTER_I = 4713,
-	NV_CGPS_MAX_INTEGRATE_MS_I = 4714,
-	NV_CGPS_ME_RESERVED1_I = 4715,
-	NV_CGPS_ME_RESERVED2_I = 4716,
-	NV_CGPS_ME_RESERVED3_I = 4717,
-	NV_CGPS_ME_RESERVED4_I = 4718,
-	NV_FTM_MODE_BOOT_COUNT_I = 4719,
-	NV_MF_RSSI_CAL_VS_FREQ_4_I = 4720,
-	NV_MF_RSSI_CAL_VS_FREQ_5_I = 4721,
-	NV_NAS_RELEASE_COMPLIANCE_I = 4722,
-	NV_WCDMA_BC4_HS_IM_LEVEL_4_I = 4723,
-	NV_WCDMA_BC4_HS_IM_LEVEL_3_I = 4724,
-	NV_WCDMA_BC4_HS_IM_LEVEL_2_I = 4725,
-	NV_WCDMA_BC4_HS_IM_LEVEL_I = 4726,
-	NV_WCDMA_BC4_HS_LNA_RANGE_RISE_4_I = 4727,
-	NV_WCDMA_BC4_HS_LNA_RANGE_RISE_3_I = 4728,
-	NV_WCDMA_BC4_HS_LNA_RANGE_RISE_2_I = 4729,
-	NV_WCDMA_BC4_HS_LNA_RANGE_RISE_I = 4730,
-	NV_WCDMA_BC4_HS_LNA_RANGE_FALL_2_I = 4731,
-	NV_WCDMA_BC4_HS_LNA_RANGE_FALL_3_I = 4732,
-	NV_WCDMA_BC4_HS_LNA_RANGE_FALL_4_I = 4733,
-	NV_WCDMA_BC4_HS_LNA_RANGE_FALL_I = 4734,
-	NV_WCDMA_900_HS_LNA_RANGE_RISE_2_I = 4735,
-	NV_WCDMA_900_HS_LNA_RANGE_RISE_I = 4736,
-	NV_WCDMA_900_HS_LNA_RANGE_RISE_3_I = 4737,
-	NV_WCDMA_900_HS_LNA_RANGE_RISE_4_I = 4738,
-	NV_WCDMA_900_HS_LNA_RANGE_FALL_4_I = 4739,
-	NV_WCDMA_900_HS_LNA_RANGE_FALL_3_I = 4740,
-	NV_WCDMA_900_HS_LNA_RANGE_FALL_2_I = 4741,
-	NV_WCDMA_900_HS_LNA_RANGE_FALL_I = 4742,
-	NV_WCDMA_900_HS_IM_LEVEL_2_I = 4743,
-	NV_WCDMA_900_HS_IM_LEVEL_3_I = 4744,
-	NV_WCDMA_900_HS_IM_LEVEL_I = 4745,
-	NV_WCDMA_900_HS_IM_LEVEL_4_I = 4746,
-	NV_WCDMA_1800_HS_LNA_RANGE_RISE_3_I = 4747,
-	NV_WCDMA_1800_HS_LNA_RANGE_RISE_4_I = 4748,
-	NV_WCDMA_1800_HS_LNA_RANGE_RISE_2_I = 4749,
-	NV_WCDMA_1800_HS_LNA_RANGE_RISE_I = 4750,
-	NV_WCDMA_1800_HS_LNA_RANGE_FALL_3_I = 4751,
-	NV_WCDMA_1800_HS_LNA_RANGE_FALL_2_I = 4752,
-	NV_WCDMA_1800_HS_LNA_RANGE_FALL_4_I = 4753,
-	NV_WCDMA_1800_HS_LNA_RANGE_FALL_I = 4754,
-	NV_WCDMA_1800_HS_IM_LEVEL_4_I = 4755,
-	NV_WCDMA_1800_HS_IM_LEVEL_3_I = 4756,
-	NV_WCDMA_1800_HS_IM_LEVEL_2_I = 4757,
-	NV_WCDMA_1800_HS_IM_LEVEL_I = 4758,
-	NV_WCDMA_1900_HS_LNA_RANGE_FALL_4_I = 4759,
-	NV_WCDMA_1900_HS_LNA_RANGE_FALL_3_I = 4760,
-	NV_WCDMA_1900_HS_LNA_RANGE_FALL_2_I = 4761,
-	NV_WCDMA_1900_HS_LNA_RANGE_FALL_I = 4762,
-	NV_WCDMA_1900_HS_LNA_RANGE_RISE_4_I = 4763,
-	NV_WCDMA_1900_HS_LNA_RANGE_RISE_3_I = 4764,
-	NV_WCDMA_1900_HS_LNA_RANGE_RISE_2_I = 4765,
-	NV_WCDMA_1900_HS_LNA_RANGE_RISE_I = 4766,
-	NV_WCDMA_1900_HS_IM_LEVEL_2_I = 4767,
-	NV_WCDMA_1900_HS_IM_LEVEL_I = 4768,
-	NV_WCDMA_1900_HS_IM_LEVEL_3_I = 4769,
-	NV_WCDMA_1900_HS_IM_LEVEL_4_I = 4770,
-	NV_WCDMA_800_HS_LNA_RANGE_RISE_4_I = 4771,
-	NV_WCDMA_800_HS_LNA_RANGE_RISE_3_I = 4772,
-	NV_WCDMA_800_HS_LNA_RANGE_RISE_2_I = 4773,
-	NV_WCDMA_800_HS_LNA_RANGE_RISE_I = 4774,
-	NV_WCDMA_800_HS_LNA_RANGE_FALL_2_I = 4775,
-	NV_WCDMA_800_HS_LNA_RANGE_FALL_I = 4776,
-	NV_WCDMA_800_HS_LNA_RANGE_FALL_3_I = 4777,
-	NV_WCDMA_800_HS_LNA_RANGE_FALL_4_I = 4778,
-	NV_WCDMA_800_HS_IM_LEVEL_3_I = 4779,
-	NV_WCDMA_800_HS_IM_LEVEL_2_I = 4780,
-	NV_WCDMA_800_HS_IM_LEVEL_I = 4781,
-	NV_WCDMA_800_HS_IM_LEVEL_4_I = 4782,
-	NV_WCDMA_HS_IM_LEVEL_2_I = 4783,
-	NV_WCDMA_HS_IM_LEVEL_3_I = 4784,
-	NV_WCDMA_HS_IM_LEVEL_4_I = 4785,
-	NV_WCDMA_HS_IM_LEVEL_I = 4786,
-	NV_WCDMA_HS_LNA_RANGE_FALL_4_I = 4787,
-	NV_WCDMA_HS_LNA_RANGE_FALL_3_I = 4788,
-	NV_WCDMA_HS_LNA_RANGE_FALL_2_I = 4789,
-	NV_WCDMA_HS_LNA_RANGE_FALL_I = 4790,
-	NV_WCDMA_HS_LNA_RANGE_RISE_4_I = 4791,
-	NV_WCDMA_HS_LNA_RANGE_RISE_3_I = 4792,
-	NV_WCDMA_HS_LNA_RANGE_RISE_2_I = 4793,
-	NV_WCDMA_HS_LNA_RANGE_RISE_I = 4794,
-	NV_BC0_TX_PDM_0_I = 4795,
-	NV_BC0_TX_PDM_1_I = 4796,
-	NV_BC0_TX_PDM_2_I = 4797,
-	NV_BC0_TX_PDM_3_I = 4798,
-	NV_BC1_TX_PDM_0_I = 4799,
-	NV_BC1_TX_PDM_1_I = 4800,
-	NV_BC1_TX_PDM_2_I = 4801,
-	NV_BC1_TX_PDM_3_I = 4802,
-	NV_BC3_TX_PDM_0_I = 4803,
-	NV_BC3_TX_PDM_1_I = 4804,
-	NV_BC3_TX_PDM_2_I = 4805,
-	NV_BC3_TX_PDM_3_I = 4806,
-	NV_BC4_TX_PDM_0_I = 4807,
-	NV_BC4_TX_PDM_1_I = 4808,
-	NV_BC4_TX_PDM_2_I = 4809,
-	NV_BC4_TX_PDM_3_I = 4810,
-	NV_BC5_TX_PDM_0_I = 4811,
-	NV_BC5_TX_PDM_1_I = 4812,
-	NV_BC5_TX_PDM_2_I = 4813,
-	NV_BC5_TX_PDM_3_I = 4814,
-	NV_BC6_TX_PDM_0_I = 4815,
-	NV_BC6_TX_PDM_1_I = 4816,
-	NV_BC6_TX_PDM_2_I = 4817,
-	NV_BC6_TX_PDM_3_I = 4818,
-	NV_BC11_TX_PDM_0_I = 4819,
-	NV_BC11_TX_PDM_1_I = 4820,
-	NV_BC11_TX_PDM_2_I = 4821,
-	NV_BC11_TX_PDM_3_I = 4822,
-	NV_BC14_TX_PDM_0_I = 4823,
-	NV_BC14_TX_PDM_1_I = 4824,
-	NV_BC14_TX_PDM_2_I = 4825,
-	NV_BC14_TX_PDM_3_I = 4826,
-	NV_BC15_TX_PDM_0_I = 4827,
-	NV_BC15_TX_PDM_1_I = 4828,
-	NV_BC15_TX_PDM_2_I = 4829,
-	NV_BC15_TX_PDM_3_I = 4830,
-	NV_BC0_TX_LIN_0_I = 4831,
-	NV_BC0_TX_LIN_1_I = 4832,
-	NV_BC0_TX_LIN_2_I = 4833,
-	NV_BC0_TX_LIN_3_I = 4834,
-	NV_BC1_TX_LIN_0_I = 4835,
-	NV_BC1_TX_LIN_1_I = 4836,
-	NV_BC1_TX_LIN_2_I = 4837,
-	NV_BC1_TX_LIN_3_I = 4838,
-	NV_BC3_TX_LIN_0_I = 4839,
-	NV_BC3_TX_LIN_1_I = 4840,
-	NV_BC3_TX_LIN_2_I = 4841,
-	NV_BC3_TX_LIN_3_I = 4842,
-	NV_BC4_TX_LIN_0_I = 4843,
-	NV_BC4_TX_LIN_1_I = 4844,
-	NV_BC4_TX_LIN_2_I = 4845,
-	NV_BC4_TX_LIN_3_I = 4846,
-	NV_BC5_TX_LIN_0_I = 4847,
-	NV_BC5_TX_LIN_1_I = 4848,
-	NV_BC5_TX_LIN_2_I = 4849,
-	NV_BC5_TX_LIN_3_I = 4850,
-	NV_BC6_TX_LIN_0_I = 4851,
-	NV_BC6_TX_LIN_1_I = 4852,
-	NV_BC6_TX_LIN_2_I = 4853,
-	NV_BC6_TX_LIN_3_I = 4854,
-	NV_BC11_TX_LIN_0_I = 4855,
-	NV_BC11_TX_LIN_1_I = 4856,
-	NV_BC11_TX_LIN_2_I = 4857,
-	NV_BC11_TX_LIN_3_I = 4858,
-	NV_BC14_TX_LIN_0_I = 4859,
-	NV_BC14_TX_LIN_1_I = 4860,
-	NV_BC14_TX_LIN_2_I = 4861,
-	NV_BC14_TX_LIN_3_I = 4862,
-	NV_BC15_TX_LIN_0_I = 4863,
-	NV_BC15_TX_LIN_1_I = 4864,
-	NV_BC15_TX_LIN_2_I = 4865,
-	NV_BC15_TX_LIN_3_I = 4866,
-	NV_HDR_RX_DIV_BC_ENABLE_MASK_I = 4867,
-	NV_CDMA_RX_DIV_BC_ENABLE_MASK_I = 4868,
-	NV_GSM_CARRIER_SUPPRESSION_I = 4869,
-	NV_GSM_850_CARRIER_SUPPRESSION_I = 4870,
-	NV_GSM_DCS_CARRIER_SUPPRESSION_I = 4871,
-	NV_GSM_1900_CARRIER_SUPPRESSION_I = 4872,
-	NV_DVBH_STORE_NW_INFO_TO_EFS_I = 4873,
-	NV_DVBH_EFS_NW_INFO_EXPIRY_TIME_I = 4874,
-	NV_DVBH_NW_ACQ_ON_CELL_ID_MISMATCH_I = 4875,
-	NV_DVBH_WAIT_FOR_NIT_OTHER_I = 4876,
-	NV_DVBH_ALL_NIT_ACQ_TIMEOUT_I = 4877,
-	NV_DVBH_LNKG_ACQ_TIMEOUT_I = 4878,
-	NV_DISPLAY_UPDATE_POWER_TEST_MODE_I = 4879,
-	NV_BC0_PA_R_MAP_I = 4880,
-	NV_BC1_PA_R_MAP_I = 4881,
-	NV_BC3_PA_R_MAP_I = 4882,
-	NV_BC4_PA_R_MAP_I = 4883,
-	NV_BC5_PA_R_MAP_I = 4884,
-	NV_BC6_PA_R_MAP_I = 4885,
-	NV_BC11_PA_R_MAP_I = 4886,
-	NV_BC14_PA_R_MAP_I = 4887,
-	NV_BC15_PA_R_MAP_I = 4888,
-	NV_HDRSRCH_DBG_MSK_I = 4889,
-	NV_AIMS_ON_I = 4890,
-	NV_MBP_RF_DVBH_CAL_FREQ_I = 4891,
-	NV_MBP_RF_DVBH_GS0_CAL_I = 4892,
-	NV_MBP_RF_DVBH_GS1_CAL_I = 4893,
-	NV_MBP_RF_DVBH_GS2_CAL_I = 4894,
-	NV_MBP_RF_DVBH_GS3_CAL_I = 4895,
-	NV_MBP_RF_DVBH_GS4_CAL_I = 4896,
-	NV_MBP_RF_DVBH_GS5_CAL_I = 4897,
-	NV_MBP_RF_MFLO_CAL_FREQ_I = 4898,
-	NV_MBP_RF_MFLO_GS0_CAL_I = 4899,
-	NV_MBP_RF_MFLO_GS1_CAL_I = 4900,
-	NV_MBP_RF_MFLO_GS2_CAL_I = 4901,
-	NV_MBP_RF_MFLO_GS3_CAL_I = 4902,
-	NV_MBP_RF_MFLO_GS4_CAL_I = 4903,
-	NV_MBP_RF_MFLO_GS5_CAL_I = 4904,
-	NV_QVP_APP_PSVT_ENABLE_FLAG_I = 4905,
-	NV_CGPS_DGPS_CORRECTIONS_ALLOWED_I = 4906,
-	NV_CGPS_MAXIMUM_DGPS_INTERVAL_I = 4907,
-	NV_CGPS_USE_FDIC_I = 4908,
-	NV_CGPS_ALTITUDE_HOLD_MODE_I = 4909,
-	NV_CGPS_PDOP_MASK_I = 4910,
-	NV_CGPS_2D_PDOP_MASK_I = 4911,
-	NV_CGPS_REFERENCE_MODE_I = 4912,
-	NV_CGPS_OPERATION_MODE_I = 4913,
-	NV_CGPS_ELEVATION_MASK_I = 4914,
-	NV_CGPS_MAX_ALMANAC_AGE_IN_WEEKS_I = 4915,
-	NV_CGPS_STEERING_ON_STARTUP_I = 4916,
-	NV_ICMP6_ND_CONFIG_I = 4917,
-	NV_HS_USB_REMOTE_WAKEUP_DELAY_I = 4918,
-	NV_DVBH_UHF_BAND_FREQ_RANGE_AND_OFFSET_1_I = 4919,
-	NV_DVBH_UHF_BAND_FREQ_RANGE_AND_OFFSET_2_I = 4920,
-	NV_DVBH_CELL_ID_RANGE_I = 4921,
-	NV_JCDMA_RUIM_ID_I = 4922,
-	NV_JCDMA_UIM_LOCK_I = 4923,
-	NV_DIAG_FTM_MODE_SWITCH_I = 4924,
-	NV_DHCP4_OPTIONS_MASK_I = 4925,
-	NV_DHCP6_OPTIONS_MASK_I = 4926,
-	NV_GPS1_XTRA_TIME_INFO_ENABLED_I = 4927,
-	NV_GPS1_XTRA_TIME_INFO_UNC_THRESH_I = 4928,
-	NV_GPS1_XTRA_TIME_INFO_DELAY_THRESH_I = 4929,
-	NV_GPS1_XTRA_PRIMARY_SNTP_SERVER_URL_I = 4930,
-	NV_GPS1_XTRA_SECONDARY_SNTP_SERVER_URL_I = 4931,
-	NV_GPS1_XTRA_TERTIARY_SNTP_SERVER_URL_I = 4932,
-	NV_MF_PROXY_I = 4933,
-	NV_MF_PROXY_LEN_I = 4934,
-	NV_WCDMA_1900_C0_C1_DELAY_I = 4935,
-	NV_WCDMA_1800_C0_C1_DELAY_I = 4936,
-	NV_WCDMA_BC4_C0_C1_DELAY_I = 4937,
-	NV_WCDMA_900_C0_C1_DELAY_I = 4938,
-	NV_WCDMA_800_C0_C1_DELAY_I = 4939,
-	NV_IMS_FW_API_ENABLE_FLAG_I = 4940,
-	NV_WCDMA_REL6_TX_BETA_SCALING_COMP_I = 4941,
-	NV_WCDMA_REL6_TX_AGC_OFFSET_I = 4942,
-	NV_WCDMA_REL6_TX_MPR_BACKOFF_I = 4943,
-	NV_WCDMA_1900_REL6_TX_BETA_SCALING_COMP_I = 4944,
-	NV_WCDMA_1900_REL6_TX_AGC_OFFSET_I = 4945,
-	NV_WCDMA_1900_REL6_TX_MPR_BACKOFF_I = 4946,
-	NV_WCDMA_800_REL6_TX_BETA_SCALING_COMP_I = 4947,
-	NV_WCDMA_800_REL6_TX_AGC_OFFSET_I = 4948,
-	NV_WCDMA_800_REL6_TX_MPR_BACKOFF_I = 4949,
-	NV_WCDMA_BC4_REL6_TX_BETA_SCALING_COMP_I = 4950,
-	NV_WCDMA_BC4_REL6_TX_AGC_OFFSET_I = 4951,
-	NV_WCDMA_BC4_REL6_TX_MPR_BACKOFF_I = 4952,
-	NV_XO_FIELD_CALIBRATION_I = 4953,
-	NV_XO_FACTORY_CALIBRATION_I = 4954,
-	NV_XO_CAL_CONV_I = 4955,
-	NV_WCDMA_LNA_PHASE_CTL_I = 4956,
-	NV_C1_WCDMA_LNA_PHASE_CTL_I = 4957,
-	NV_HOME_MCC_I = 4958,
-	NV_USR_SID_TO_MCC_ASSOC_TBL_I = 4959,
-	NV_HS_BASED_PLUS_DIAL_SETTING_I = 4960,
-	NV_DS_AT_V250_REGISTERS_I = 4961,
-	NV_DS_AT_S_REGISTERS_I = 4962,
-	NV_PROCESS_RESTART_SWITCH_I = 4963,
-	NV_HDRSCP_FORCE_AT_CONFIG_I = 4964,
-	NV_WCDMA_TX_COMP_VS_FREQ_0_SECONDARY_I = 4965,
-	NV_WCDMA_TX_COMP_VS_FREQ_1_SECONDARY_I = 4966,
-	NV_WCDMA_TX_COMP_VS_FREQ_2_SECONDARY_I = 4967,
-	NV_WCDMA_TX_COMP_VS_FREQ_3_SECONDARY_I = 4968,
-	NV_WCDMA_TX_COMP_VS_FREQ_SEC_PDM_LIST_I = 4969,
-	NV_WCDMA_1900_TX_COMP_VS_FREQ_0_SECONDARY_I = 4970,
-	NV_WCDMA_1900_TX_COMP_VS_FREQ_1_SECONDARY_I = 4971,
-	NV_WCDMA_1900_TX_COMP_VS_FREQ_2_SECONDARY_I = 4972,
-	NV_WCDMA_1900_TX_COMP_VS_FREQ_3_SECONDARY_I = 4973,
-	NV_WCDMA_1900_TX_COMP_VS_FREQ_SEC_PDM_LIST_I = 4974,
-	NV_WCDMA_800_TX_COMP_VS_FREQ_0_SECONDARY_I = 4975,
-	NV_WCDMA_800_TX_COMP_VS_FREQ_1_SECONDARY_I = 4976,
-	NV_WCDMA_800_TX_COMP_VS_FREQ_2_SECONDARY_I = 4977,
-	NV_WCDMA_800_TX_COMP_VS_FREQ_3_SECONDARY_I = 4978,
-	NV_WCDMA_800_TX_COMP_VS_FREQ_SEC_PDM_LIST_I = 4979,
-	NV_WCDMA_1800_TX_COMP_VS_FREQ_0_SECONDARY_I = 4980,
-	NV_WCDMA_1800_TX_COMP_VS_FREQ_1_SECONDARY_I = 4981,
-	NV_WCDMA_1800_TX_COMP_VS_FREQ_2_SECONDARY_I = 4982,
-	NV_WCDMA_1800_TX_COMP_VS_FREQ_3_SECONDARY_I = 4983,
-	NV_WCDMA_1800_TX_COMP_VS_FREQ_SEC_PDM_LIST_I = 4984,
-	NV_WCDMA_BC4_TX_COMP_VS_FREQ_0_SECONDARY_I = 4985,
-	NV_WCDMA_BC4_TX_COMP_VS_FREQ_1_SECONDARY_I = 4986,
-	NV_WCDMA_BC4_TX_COMP_VS_FREQ_2_SECONDARY_I = 4987,
-	NV_WCDMA_BC4_TX_COMP_VS_FREQ_3_SECONDARY_I = 4988,
-	NV_WCDMA_BC4_TX_COMP_VS_FREQ_SEC_PDM_LIST_I = 4989,
-	NV_WCDMA_900_TX_COMP_VS_FREQ_0_SECONDARY_I = 4990,
-	NV_WCDMA_900_TX_COMP_VS_FREQ_1_SECONDARY_I = 4991,
-	NV_WCDMA_900_TX_COMP_VS_FREQ_2_SECONDARY_I = 4992,
-	NV_WCDMA_900_TX_COMP_VS_FREQ_3_SECONDARY_I = 4993,
-	NV_WCDMA_900_TX_COMP_VS_FREQ_SEC_PDM_LIST_I = 4994,
-	NV_CUST_UQCN_C2K_VERSION_I = 4995,
-	NV_CUST_UQCN_UMTS_VERSION_I = 4996,
-	NV_BC0_TX_PWR_COMP0_I = 4997,
-	NV_BC0_TX_PWR_COMP1_I = 4998,
-	NV_BC0_TX_PWR_COMP2_I = 4999,
-	NV_BC0_TX_PWR_COMP3_I = 5000,
-	NV_BC1_TX_PWR_COMP0_I = 5001,
-	NV_BC1_TX_PWR_COMP1_I = 5002,
-	NV_BC1_TX_PWR_COMP2_I = 5003,
-	NV_BC1_TX_PWR_COMP3_I = 5004,
-	NV_BC3_TX_PWR_COMP0_I = 5005,
-	NV_BC3_TX_PWR_COMP1_I = 5006,
-	NV_BC3_TX_PWR_COMP2_I = 5007,
-	NV_BC3_TX_PWR_COMP3_I = 5008,
-	NV_BC5_TX_PWR_COMP0_I = 5009,
-	NV_BC5_TX_PWR_COMP1_I = 5010,
-	NV_BC5_TX_PWR_COMP2_I = 5011,
-	NV_BC5_TX_PWR_COMP3_I = 5012,
-	NV_BC6_TX_PWR_COMP0_I = 5013,
-	NV_BC6_TX_PWR_COMP1_I = 5014,
-	NV_BC6_TX_PWR_COMP2_I = 5015,
-	NV_BC6_TX_PWR_COMP3_I = 5016,
-	NV_BC11_TX_PWR_COMP0_I = 5017,
-	NV_BC11_TX_PWR_COMP1_I = 5018,
-	NV_BC11_TX_PWR_COMP2_I = 5019,
-	NV_BC11_TX_PWR_COMP3_I = 5020,
-	NV_BC14_TX_PWR_COMP0_I = 5021,
-	NV_BC14_TX_PWR_COMP1_I = 5022,
-	NV_BC14_TX_PWR_COMP2_I = 5023,
-	NV_BC14_TX_PWR_COMP3_I = 5024,
-	NV_BC15_TX_PWR_COMP0_I = 5025,
-	NV_BC15_TX_PWR_COMP1_I = 5026,
-	NV_BC15_TX_PWR_COMP2_I = 5027,
-	NV_BC15_TX_PWR_COMP3_I = 5028,
-	NV_THERM_BINS_I = 5029,
-	NV_BC4_TX_PWR_COMP0_I = 5030,
-	NV_BC4_TX_PWR_COMP1_I = 5031,
-	NV_BC4_TX_PWR_COMP2_I = 5032,
-	NV_BC4_TX_PWR_COMP3_I = 5033,
-	NV_CGPS_QOS_OVERRIDE_ACC_THRESHOLD_I = 5034,
-	NV_CGPS_QOS_OVERRIDE_TIME_I = 5035,
-	NV_WEB_INFO_I = 5036,
-	NV_SIOTA_CALL_INFO_I = 5037,
-	NV_PHONE_BOOT_NAIURL_I = 5038,
-	NV_PHONE_BOOT_URL_I = 5039,
-	NV_DS_PHONE_RDF_URL_I = 5040,
-	NV_BROWSER_DOMAIN_TRUSTED_I = 5041,
-	NV_IOTA_COMMIT_I = 5042,
-	NV_DVBH_NIT_ACTUAL_ACQ_TIMEOUT_I = 5043,
-	NV_HS_USB_DIAG_ON_LEGACY_USB_PORT_I = 5044,
-	NV_HW_ENTROPY_I = 5045,
-	NV_CGPS_MEM_CONFIG_I = 5046,
-	NV_CGPS_NMEA_CONFIG_INFO_I = 5047,
-	NV_WCDMA_800_TIMER_HYSTERISIS_I = 5048,
-	NV_WCDMA_900_TIMER_HYSTERISIS_I = 5049,
-	NV_WCDMA_BC4_TIMER_HYSTERISIS_I = 5050,
-	NV_WCDMA_1800_TIMER_HYSTERISIS_I = 5051,
-	NV_WCDMA_1900_TIMER_HYSTERISIS_I = 5052,
-	NV_WCDMA_2100_TIMER_HYSTERISIS_I = 5053,
-	NV_WCDMA_800_TX_LIN_MASTER_0_ENH_I = 5054,
-	NV_WCDMA_900_TX_LIN_MASTER_0_ENH_I = 5055,
-	NV_WCDMA_BC4_TX_LIN_MASTER_0_ENH_I = 5056,
-	NV_WCDMA_1800_TX_LIN_MASTER_0_ENH_I = 5057,
-	NV_WCDMA_1900_TX_LIN_MASTER_0_ENH_I = 5058,
-	NV_WCDMA_2100_TX_LIN_MASTER_0_ENH_I = 5059,
-	NV_WCDMA_800_TX_PDM_LIN_0_ENH_I = 5060,
-	NV_WCDMA_900_TX_PDM_LIN_0_ENH_I = 5061,
-	NV_WCDMA_BC4_TX_PDM_LIN_0_ENH_I = 5062,
-	NV_WCDMA_1800_TX_PDM_LIN_0_ENH_I = 5063,
-	NV_WCDMA_1900_TX_PDM_LIN_0_ENH_I = 5064,
-	NV_WCDMA_2100_TX_PDM_LIN_0_ENH_I = 5065,
-	NV_GSM_850_KV_CAL_I = 5066,
-	NV_GSM_900_KV_CAL_I = 5067,
-	NV_GSM_1800_KV_CAL_I = 5068,
-	NV_GSM_1900_KV_CAL_I = 5069,
-	NV_BC1_BALUN_CTL_I = 5070,
-	NV_BC2_BALUN_CTL_I = 5071,
-	NV_BC3_BALUN_CTL_I = 5072,
-	NV_BC4_BALUN_CTL_I = 5073,
-	NV_BC6_BALUN_CTL_I = 5074,
-	NV_BC8_BALUN_CTL_I = 5075,
-	NV_BC9_BALUN_CTL_I = 5076,
-	NV_UNDP_HSU_VID_PID_I = 5077,
-	NV_UNDP_HSU_MFGSTR_I = 5078,
-	NV_UNDP_HSU_PRODSTR_I = 5079,
-	NV_RR_ACQ_DB_CHUNK_00_I = 5080,
-	NV_RR_ACQ_DB_CHUNK_01_I = 5081,
-	NV_RR_ACQ_DB_CHUNK_02_I = 5082,
-	NV_RR_ACQ_DB_CHUNK_03_I = 5083,
-	NV_RR_ACQ_DB_CHUNK_04_I = 5084,
-	NV_RR_ACQ_DB_CHUNK_05_I = 5085,
-	NV_RR_ACQ_DB_CHUNK_06_I = 5086,
-	NV_RR_ACQ_DB_CHUNK_07_I = 5087,
-	NV_NITZ_NW_INFO_MCC_I = 5088,
-	NV_NITZ_NW_INFO_MNC_I = 5089,
-	NV_WCDMA_HSUPA_CM_CTRL_I = 5090,
-	NV_GSM_850_SMPS_PDM_TBL_I = 5091,
-	NV_GSM_900_SMPS_PDM_TBL_I = 5092,
-	NV_GSM_1800_SMPS_PDM_TBL_I = 5093,
-	NV_GSM_1900_SMPS_PDM_TBL_I = 5094,
-	NV_WCDMA_1900_LNA_PHASE_CTL_I = 5095,
-	NV_C1_WCDMA_1900_LNA_PHASE_CTL_I = 5096,
-	NV_WCDMA_800_LNA_PHASE_CTL_I = 5097,
-	NV_C1_WCDMA_800_LNA_PHASE_CTL_I = 5098,
-	NV_WCDMA_BC4_LNA_PHASE_CTL_I = 5099,
-	NV_C1_WCDMA_BC4_LNA_PHASE_CTL_I = 5100,
-	NV_WCDMA_900_LNA_PHASE_CTL_I = 5101,
-	NV_C1_WCDMA_900_LNA_PHASE_CTL_I = 5102,
-	NV_WCDMA_1800_LNA_PHASE_CTL_I = 5103,
-	NV_C1_WCDMA_1800_LNA_PHASE_CTL_I = 5104,
-	NV_DIAG_DIAGBUF_TX_SLEEP_TIME_NV_I = 5105,
-	NV_DIAG_DIAGBUF_TX_SLEEP_THRESHOLD_NV_I = 5106,
-	NV_REPEATED_ACCH_I = 5107,
-	NV_BC0_P2_RISE_FALL_OFF_I = 5108,
-	NV_BC1_P2_RISE_FALL_OFF_I = 5109,
-	NV_BC3_P2_RISE_FALL_OFF_I = 5110,
-	NV_BC4_P2_RISE_FALL_OFF_I = 5111,
-	NV_BC5_P2_RISE_FALL_OFF_I = 5112,
-	NV_BC6_P2_RISE_FALL_OFF_I = 5113,
-	NV_BC11_P2_RISE_FALL_OFF_I = 5114,
-	NV_BC14_P2_RISE_FALL_OFF_I = 5115,
-	NV_BC15_P2_RISE_FALL_OFF_I = 5116,
-	NV_BCX_BLOCK_P2_RISE_FALL_OFF_I = 5117,
-	NV_BC0_P3_RISE_FALL_OFF_I = 5118,
-	NV_BC1_P3_RISE_FALL_OFF_I = 5119,
-	NV_BC3_P3_RISE_FALL_OFF_I = 5120,
-	NV_BC4_P3_RISE_FALL_OFF_I = 5121,
-	NV_BC5_P3_RISE_FALL_OFF_I = 5122,
-	NV_BC6_P3_RISE_FALL_OFF_I = 5123,
-	NV_BC11_P3_RISE_FALL_OFF_I = 5124,
-	NV_BC14_P3_RISE_FALL_OFF_I = 5125,
-	NV_BC15_P3_RISE_FALL_OFF_I = 5126,
-	NV_BCX_BLOCK_P3_RISE_FALL_OFF_I = 5127,
-	NV_BC0_HDR_P2_RISE_FALL_OFF_I = 5128,
-	NV_BC1_HDR_P2_RISE_FALL_OFF_I = 5129,
-	NV_BC3_HDR_P2_RISE_FALL_OFF_I = 5130,
-	NV_BC4_HDR_P2_RISE_FALL_OFF_I = 5131,
-	NV_BC5_HDR_P2_RISE_FALL_OFF_I = 5132,
-	NV_BC6_HDR_P2_RISE_FALL_OFF_I = 5133,
-	NV_BC11_HDR_P2_RISE_FALL_OFF_I = 5134,
-	NV_BC14_HDR_P2_RISE_FALL_OFF_I = 5135,
-	NV_BC15_HDR_P2_RISE_FALL_OFF_I = 5136,
-	NV_BCX_BLOCK_HDR_P2_RISE_FALL_OFF_I = 5137,
-	NV_BC0_HDR_P3_RISE_FALL_OFF_I = 5138,
-	NV_BC1_HDR_P3_RISE_FALL_OFF_I = 5139,
-	NV_BC3_HDR_P3_RISE_FALL_OFF_I = 5140,
-	NV_BC4_HDR_P3_RISE_FALL_OFF_I = 5141,
-	NV_BC5_HDR_P3_RISE_FALL_OFF_I = 5142,
-	NV_BC6_HDR_P3_RISE_FALL_OFF_I = 5143,
-	NV_BC11_HDR_P3_RISE_FALL_OFF_I = 5144,
-	NV_BC14_HDR_P3_RISE_FALL_OFF_I = 5145,
-	NV_BC15_HDR_P3_RISE_FALL_OFF_I = 5146,
-	NV_BCX_BLOCK_HDR_P3_RISE_FALL_OFF_I = 5147,
-	NV_BT_TX_RFCAL_I = 5148,
-	NV_BT_LISBON_DISABLED_I = 5149,
-	NV_DS_AT_CSAS_CSCA_SETTINGS_I = 5150,
-	NV_DS_AT_CSAS_CSMP_SETTINGS_I = 5151,
-	NV_DS_AT_CSAS_CSCB_SETTINGS_I = 5152,
-	NV_UE_IMEISV_SVN_I = 5153,
-	NV_GPS_ENGINE_TYPE_I = 5154,
-	NV_UNDP_HSU_VID_PID2_I = 5155,
-	NV_UNDP_NOTEBOOK_INFO_I = 5156,
-	NV_DVBH_DO_FREQ_SCAN_AFTER_SYS_LOST_I = 5157,
-	NV_DVBH_BAT_ACQ_TIMEOUT_I = 5158,
-	NV_DVBH_USE_NW_IDS_FOR_COMPLETE_NW_ACQ_I = 5159,
-	NV_DVBH_INACTIVITY_TIMEOUT_I = 5160,
-	NV_DVBH_GET_PLATFORM_LIST_FROM_FIRST_NIT_I = 5161,
-	NV_DVBH_UPDATE_NW_INFO_FROM_TS_I = 5162,
-	NV_BC10_TX_LIN_MASTER0_I = 5163,
-	NV_BC10_TX_LIN_MASTER1_I = 5164,
-	NV_BC10_TX_LIN_MASTER2_I = 5165,
-	NV_BC10_TX_LIN_MASTER3_I = 5166,
-	NV_BC10_GPS1_RF_DELAY_I = 5167,
-	NV_BC10_TX_LIM_VS_TEMP_I = 5168,
-	NV_BC10_TX_COMP0_I = 5169,
-	NV_BC10_TX_COMP1_I = 5170,
-	NV_BC10_TX_COMP2_I = 5171,
-	NV_BC10_TX_COMP3_I = 5172,
-	NV_BC10_TX_LIM_VS_FREQ_I = 5173,
-	NV_BC10_PA_R1_RISE_I = 5174,
-	NV_BC10_PA_R1_FALL_I = 5175,
-	NV_BC10_PA_R2_RISE_I = 5176,
-	NV_BC10_PA_R2_FALL_I = 5177,
-	NV_BC10_PA_R3_RISE_I = 5178,
-	NV_BC10_PA_R3_FALL_I = 5179,
-	NV_BC10_HDET_OFF_I = 5180,
-	NV_BC10_HDET_SPN_I = 5181,
-	NV_BC10_EXP_HDET_VS_AGC_I = 5182,
-	NV_BC10_ENC_BTF_I = 5183,
-	NV_BC10_VCO_COARSE_TUNE_TABLE_I = 5184,
-	NV_BC10_VCO_TUNE_2_I = 5185,
-	NV_BC10_P1_RISE_FALL_OFF_I = 5186,
-	NV_BC10_HDR_P1_RISE_FALL_OFF_I = 5187,
-	NV_BC10_ANT_QUALITY_I = 5188,
-	NV_BC10_PA_DVS_VOLTAGE_I = 5189,
-	NV_BC10_TX_PDM_LIN_0_I = 5190,
-	NV_BC10_TX_PDM_LIN_1_I = 5191,
-	NV_BC10_TX_PDM_LIN_2_I = 5192,
-	NV_BC10_TX_PDM_LIN_3_I = 5193,
-	NV_BC10_TX_PDM_0_I = 5194,
-	NV_BC10_TX_PDM_1_I = 5195,
-	NV_BC10_TX_PDM_2_I = 5196,
-	NV_BC10_TX_PDM_3_I = 5197,
-	NV_BC10_TX_LIN_0_I = 5198,
-	NV_BC10_TX_LIN_1_I = 5199,
-	NV_BC10_TX_LIN_2_I = 5200,
-	NV_BC10_TX_LIN_3_I = 5201,
-	NV_BC10_PA_R_MAP_I = 5202,
-	NV_BC10_TX_PWR_COMP0_I = 5203,
-	NV_BC10_TX_PWR_COMP1_I = 5204,
-	NV_BC10_TX_PWR_COMP2_I = 5205,
-	NV_BC10_TX_PWR_COMP3_I = 5206,
-	NV_C0_BC10_TX_CAL_CHAN_I = 5207,
-	NV_C0_BC10_RX_CAL_CHAN_I = 5208,
-	NV_C0_BC10_RX_CAL_CHAN_LRU_I = 5209,
-	NV_C0_BC10_LNA_1_OFFSET_I = 5210,
-	NV_C0_BC10_LNA_2_OFFSET_I = 5211,
-	NV_C0_BC10_LNA_3_OFFSET_I = 5212,
-	NV_C0_BC10_LNA_4_OFFSET_I = 5213,
-	NV_C0_BC10_LNA_1_OFFSET_VS_FREQ_I = 5214,
-	NV_C0_BC10_LNA_2_OFFSET_VS_FREQ_I = 5215,
-	NV_C0_BC10_LNA_3_OFFSET_VS_FREQ_I = 5216,
-	NV_C0_BC10_LNA_4_OFFSET_VS_FREQ_I = 5217,
-	NV_C0_BC10_IM2_I_VALUE_I = 5218,
-	NV_C0_BC10_IM2_Q_VALUE_I = 5219,
-	NV_C0_BC10_VGA_GAIN_OFFSET_I = 5220,
-	NV_C0_BC10_VGA_GAIN_OFFSET_VS_FREQ_I = 5221,
-	NV_C0_BC10_IM2_TRANSCONDUCTOR_VALUE_I = 5222,
-	NV_C0_BC10_LNA_1_RISE_I = 5223,
-	NV_C0_BC10_LNA_1_FALL_I = 5224,
-	NV_C0_BC10_LNA_2_RISE_I = 5225,
-	NV_C0_BC10_LNA_2_FALL_I = 5226,
-	NV_C0_BC10_LNA_3_RISE_I = 5227,
-	NV_C0_BC10_LNA_3_FALL_I = 5228,
-	NV_C0_BC10_LNA_4_RISE_I = 5229,
-	NV_C0_BC10_LNA_4_FALL_I = 5230,
-	NV_C0_BC10_IM_LEVEL1_I = 5231,
-	NV_C0_BC10_IM_LEVEL2_I = 5232,
-	NV_C0_BC10_IM_LEVEL3_I = 5233,
-	NV_C0_BC10_IM_LEVEL4_I = 5234,
-	NV_C0_BC10_LNA_SWITCHPOINTS_LPM_1_I = 5235,
-	NV_C0_BC10_LNA_SWITCHPOINTS_LPM_2_I = 5236,
-	NV_C0_BC10_IM2_LPM_1_I = 5237,
-	NV_C0_BC10_IM2_LPM_2_I = 5238,
-	NV_C0_BC10_INTELLICEIVER_CAL_I = 5239,
-	NV_C0_BC10_INTELLICEIVER_DET_THRESH_I = 5240,
-	NV_C1_BC10_TX_CAL_CHAN_I = 5241,
-	NV_C1_BC10_RX_CAL_CHAN_I = 5242,
-	NV_C1_BC10_RX_CAL_CHAN_LRU_I = 5243,
-	NV_C1_BC10_LNA_1_OFFSET_VS_FREQ_I = 5244,
-	NV_C1_BC10_LNA_2_OFFSET_VS_FREQ_I = 5245,
-	NV_C1_BC10_LNA_3_OFFSET_VS_FREQ_I = 5246,
-	NV_C1_BC10_LNA_4_OFFSET_VS_FREQ_I = 5247,
-	NV_C1_BC10_LNA_1_OFFSET_I = 5248,
-	NV_C1_BC10_LNA_2_OFFSET_I = 5249,
-	NV_C1_BC10_LNA_3_OFFSET_I = 5250,
-	NV_C1_BC10_LNA_4_OFFSET_I = 5251,
-	NV_C1_BC10_IM2_I_VALUE_I = 5252,
-	NV_C1_BC10_IM2_Q_VALUE_I = 5253,
-	NV_C1_BC10_VGA_GAIN_OFFSET_I = 5254,
-	NV_C1_BC10_VGA_GAIN_OFFSET_VS_FREQ_I = 5255,
-	NV_C1_BC10_IM2_TRANSCONDUCTOR_VALUE_I = 5256,
-	NV_C1_BC10_LNA_1_RISE_I = 5257,
-	NV_C1_BC10_LNA_1_FALL_I = 5258,
-	NV_C1_BC10_LNA_2_RISE_I = 5259,
-	NV_C1_BC10_LNA_2_FALL_I = 5260,
-	NV_C1_BC10_LNA_3_RISE_I = 5261,
-	NV_C1_BC10_LNA_3_FALL_I = 5262,
-	NV_C1_BC10_LNA_4_RISE_I = 5263,
-	NV_C1_BC10_LNA_4_FALL_I = 5264,
-	NV_C1_BC10_IM_LEVEL1_I = 5265,
-	NV_C1_BC10_IM_LEVEL2_I = 5266,
-	NV_C1_BC10_IM_LEVEL3_I = 5267,
-	NV_C1_BC10_IM_LEVEL4_I = 5268,
-	NV_C1_BC10_VCO_COARSE_TUNE_TABLE_I = 5269,
-	NV_GSM_850_KV_CAL_CHAN_I = 5270,
-	NV_GSM_900_KV_CAL_CHAN_I = 5271,
-	NV_GSM_1800_KV_CAL_CHAN_I = 5272,
-	NV_GSM_1900_KV_CAL_CHAN_I = 5273,
-	NV_WCDMA_900_REL6_TX_BETA_SCALING_COMP_I = 5274,
-	NV_WCDMA_900_REL6_TX_AGC_OFFSET_I = 5275,
-	NV_WCDMA_900_REL6_TX_MPR_BACKOFF_I = 5276,
-	NV_WCDMA_1800_REL6_TX_BETA_SCALING_COMP_I = 5277,
-	NV_WCDMA_1800_REL6_TX_AGC_OFFSET_I = 5278,
-	NV_WCDMA_1800_REL6_TX_MPR_BACKOFF_I = 5279,
-	NV_DISABLE_CM_CALL_TYPE_I = 5280,
-	NV_MULTI_SEC_CODE_I = 5281,
-	NV_MULTI_OTKSL_I = 5282,
-	NV_MULTI_OTKSL_FLAG_I = 5283,
-	NV_DVBH_DO_FREQ_SCAN_AFTER_INT_ACQ_I = 5284,
-	NV_GSM_850_PADAC_DC_OFFSET_TBL_I = 5285,
-	NV_GSM_900_PADAC_DC_OFFSET_TBL_I = 5286,
-	NV_GSM_1800_PADAC_DC_OFFSET_TBL_I = 5287,
-	NV_GSM_1900_PADAC_DC_OFFSET_TBL_I = 5288,
-	NV_CGPS_VCO_AGE_I = 5289,
-	NV_CGPS_OPTIMISTIC_PUNC_I = 5290,
-	NV_GSM_850_RGI_G0_F1_I = 5291,
-	NV_GSM_850_RGI_G1_F1_I = 5292,
-	NV_GSM_850_RGI_G2_F1_I = 5293,
-	NV_GSM_850_RGI_G3_F1_I = 5294,
-	NV_GSM_850_RGI_G0_F2_I = 5295,
-	NV_GSM_850_RGI_G1_F2_I = 5296,
-	NV_GSM_850_RGI_G2_F2_I = 5297,
-	NV_GSM_850_RGI_G3_F2_I = 5298,
-	NV_GSM_900_RGI_G0_F1_I = 5299,
-	NV_GSM_900_RGI_G1_F1_I = 5300,
-	NV_GSM_900_RGI_G2_F1_I = 5301,
-	NV_GSM_900_RGI_G3_F1_I = 5302,
-	NV_GSM_900_RGI_G0_F2_I = 5303,
-	NV_GSM_900_RGI_G1_F2_I = 5304,
-	NV_GSM_900_RGI_G2_F2_I = 5305,
-	NV_GSM_900_RGI_G3_F2_I = 5306,
-	NV_GSM_1800_RGI_G0_F1_I = 5307,
-	NV_GSM_1800_RGI_G1_F1_I = 5308,
-	NV_GSM_1800_RGI_G2_F1_I = 5309,
-	NV_GSM_1800_RGI_G3_F1_I = 5310,
-	NV_GSM_1800_RGI_G0_F2_I = 5311,
-	NV_GSM_1800_RGI_G1_F2_I = 5312,
-	NV_GSM_1800_RGI_G2_F2_I = 5313,
-	NV_GSM_1800_RGI_G3_F2_I = 5314,
-	NV_GSM_1900_RGI_G0_F1_I = 5315,
-	NV_GSM_1900_RGI_G1_F1_I = 5316,
-	NV_GSM_1900_RGI_G2_F1_I = 5317,
-	NV_GSM_1900_RGI_G3_F1_I = 5318,
-	NV_GSM_1900_RGI_G0_F2_I = 5319,
-	NV_GSM_1900_RGI_G1_F2_I = 5320,
-	NV_GSM_1900_RGI_G2_F2_I = 5321,
-	NV_GSM_1900_RGI_G3_F2_I = 5322,
-	NV_GSM_850_PMEAS_G0_F1_I = 5323,
-	NV_GSM_850_PMEAS_G1_F1_I = 5324,
-	NV_GSM_850_PMEAS_G2_F1_I = 5325,
-	NV_GSM_850_PMEAS_G3_F1_I = 5326,
-	NV_GSM_850_PMEAS_G0_F2_I = 5327,
-	NV_GSM_850_PMEAS_G1_F2_I = 5328,
-	NV_GSM_850_PMEAS_G2_F2_I = 5329,
-	NV_GSM_850_PMEAS_G3_F2_I = 5330,
-	NV_GSM_900_PMEAS_G0_F1_I = 5331,
-	NV_GSM_900_PMEAS_G1_F1_I = 5332,
-	NV_GSM_900_PMEAS_G2_F1_I = 5333,
-	NV_GSM_900_PMEAS_G3_F1_I = 5334,
-	NV_GSM_900_PMEAS_G0_F2_I = 5335,
-	NV_GSM_900_PMEAS_G1_F2_I = 5336,
-	NV_GSM_900_PMEAS_G2_F2_I = 5337,
-	NV_GSM_900_PMEAS_G3_F2_I = 5338,
-	NV_GSM_1800_PMEAS_G0_F1_I = 5339,
-	NV_GSM_1800_PMEAS_G1_F1_I = 5340,
-	NV_GSM_1800_PMEAS_G2_F1_I = 5341,
-	NV_GSM_1800_PMEAS_G3_F1_I = 5342,
-	NV_GSM_1800_PMEAS_G0_F2_I = 5343,
-	NV_GSM_1800_PMEAS_G1_F2_I = 5344,
-	NV_GSM_1800_PMEAS_G2_F2_I = 5345,
-	NV_GSM_1800_PMEAS_G3_F2_I = 5346,
-	NV_GSM_1900_PMEAS_G0_F1_I = 5347,
-	NV_GSM_1900_PMEAS_G1_F1_I = 5348,
-	NV_GSM_1900_PMEAS_G2_F1_I = 5349,
-	NV_GSM_1900_PMEAS_G3_F1_I = 5350,
-	NV_GSM_1900_PMEAS_G0_F2_I = 5351,
-	NV_GSM_1900_PMEAS_G1_F2_I = 5352,
-	NV_GSM_1900_PMEAS_G2_F2_I = 5353,
-	NV_GSM_1900_PMEAS_G3_F2_I = 5354,
-	NV_GSM_1800_PA_R1_TO_R2_I = 5355,
-	NV_GSM_1800_PA_R2_TO_R4_I = 5356,
-	NV_GSM_1900_PA_R1_TO_R2_I = 5357,
-	NV_GSM_1900_PA_R2_TO_R4_I = 5358,
-	NV_GSM_850_PA_R1_TO_R2_I = 5359,
-	NV_GSM_850_PA_R2_TO_R3_I = 5360,
-	NV_GSM_850_PA_R3_TO_R4_I = 5361,
-	NV_GSM_900_PA_R1_TO_R2_I = 5362,
-	NV_GSM_900_PA_R2_TO_R3_I = 5363,
-	NV_GSM_900_PA_R3_TO_R4_I = 5364,
-	NV_GSM_850_PA_PREDIST_SWPT1_I = 5365,
-	NV_GSM_850_PA_PREDIST_SWPT2_I = 5366,
-	NV_GSM_900_PA_PREDIST_SWPT1_I = 5367,
-	NV_GSM_900_PA_PREDIST_SWPT2_I = 5368,
-	NV_GSM_1800_PA_PREDIST_SWPT1_I = 5369,
-	NV_GSM_1800_PA_PREDIST_SWPT2_I = 5370,
-	NV_GSM_1900_PA_PREDIST_SWPT1_I = 5371,
-	NV_GSM_1900_PA_PREDIST_SWPT2_I = 5372,
-	NV_HSUPA_IRQ_FLOW_CTRL_2MS_PDU_SIZE_336_I = 5373,
-	NV_HSUPA_IRQ_FLOW_CTRL_2MS_PDU_SIZE_656_I = 5374,
-	NV_BC10_P2_RISE_FALL_OFF_I = 5375,
-	NV_BC10_P3_RISE_FALL_OFF_I = 5376,
-	NV_BC10_HDR_P2_RISE_FALL_OFF_I = 5377,
-	NV_BC10_HDR_P3_RISE_FALL_OFF_I = 5378,
-	NV_PSHO_FEATURE_SUPPORT_I = 5379,
-	NV_GSM_850_KV_VS_TEMP_I = 5380,
-	NV_GSM_900_KV_VS_TEMP_I = 5381,
-	NV_GSM_1800_KV_VS_TEMP_I = 5382,
-	NV_GSM_1900_KV_VS_TEMP_I = 5383,
-	NV_GSM_900_EDGE_PA_ULTRA_LO_TO_LO_I = 5384,
-	NV_GSM_900_EDGE_PA_LO_TO_MID_I = 5385,
-	NV_GSM_900_EDGE_PA_MID_TO_HI_I = 5386,
-	NV_GSM_850_EDGE_PA_ULTRA_LO_TO_LO_I = 5387,
-	NV_GSM_850_EDGE_PA_LO_TO_MID_I = 5388,
-	NV_GSM_850_EDGE_PA_MID_TO_HI_I = 5389,
-	NV_GSM_1800_EDGE_PA_LO_TO_MID_I = 5390,
-	NV_GSM_1800_EDGE_PA_MID_TO_HI_I = 5391,
-	NV_GSM_1900_EDGE_PA_LO_TO_MID_I = 5392,
-	NV_GSM_1900_EDGE_PA_MID_TO_HI_I = 5393,
-	NV_UNDP_NOEM_TEST_I = 5394,
-	NV_GSM_850_LINEAR_PA_TEMP_COMP_I = 5395,
-	NV_GSM_900_LINEAR_PA_TEMP_COMP_I = 5396,
-	NV_GSM_1800_LINEAR_PA_TEMP_COMP_I = 5397,
-	NV_GSM_1900_LINEAR_PA_TEMP_COMP_I = 5398,
-	NV_GSM_850_RGI_G0_F3_I = 5399,
-	NV_GSM_850_RGI_G1_F3_I = 5400,
-	NV_GSM_850_RGI_G2_F3_I = 5401,
-	NV_GSM_850_RGI_G3_F3_I = 5402,
-	NV_GSM_900_RGI_G0_F3_I = 5403,
-	NV_GSM_900_RGI_G1_F3_I = 5404,
-	NV_GSM_900_RGI_G2_F3_I = 5405,
-	NV_GSM_900_RGI_G3_F3_I = 5406,
-	NV_GSM_1800_RGI_G0_F3_I = 5407,
-	NV_GSM_1800_RGI_G1_F3_I = 5408,
-	NV_GSM_1800_RGI_G2_F3_I = 5409,
-	NV_GSM_1800_RGI_G3_F3_I = 5410,
-	NV_GSM_1900_RGI_G0_F3_I = 5411,
-	NV_GSM_1900_RGI_G1_F3_I = 5412,
-	NV_GSM_1900_RGI_G2_F3_I = 5413,
-	NV_GSM_1900_RGI_G3_F3_I = 5414,
-	NV_GSM_850_PMEAS_G0_F3_I = 5415,
-	NV_GSM_850_PMEAS_G1_F3_I = 5416,
-	NV_GSM_850_PMEAS_G2_F3_I = 5417,
-	NV_GSM_850_PMEAS_G3_F3_I = 5418,
-	NV_GSM_900_PMEAS_G0_F3_I = 5419,
-	NV_GSM_900_PMEAS_G1_F3_I = 5420,
-	NV_GSM_900_PMEAS_G2_F3_I = 5421,
-	NV_GSM_900_PMEAS_G3_F3_I = 5422,
-	NV_GSM_1800_PMEAS_G0_F3_I = 5423,
-	NV_GSM_1800_PMEAS_G1_F3_I = 5424,
-	NV_GSM_1800_PMEAS_G2_F3_I = 5425,
-	NV_GSM_1800_PMEAS_G3_F3_I = 5426,
-	NV_GSM_1900_PMEAS_G0_F3_I = 5427,
-	NV_GSM_1900_PMEAS_G1_F3_I = 5428,
-	NV_GSM_1900_PMEAS_G2_F3_I = 5429,
-	NV_GSM_1900_PMEAS_G3_F3_I = 5430,
-	NV_MF_IPDC_SUPERCEDES_CLIPCAST_I = 5431,
-	NV_PROCESS_CAL_I = 5432,
-	NV_C0_BC0_LO_CAL_I = 5433,
-	NV_C0_BC1_LO_CAL_I = 5434,
-	NV_C0_BC2_LO_CAL_I = 5435,
-	NV_C0_BC3_LO_CAL_I = 5436,
-	NV_C0_BC4_LO_CAL_I = 5437,
-	NV_C0_BC5_LO_CAL_I = 5438,
-	NV_C0_BC6_LO_CAL_I = 5439,
-	NV_C0_BC7_LO_CAL_I = 5440,
-	NV_C0_BC8_LO_CAL_I = 5441,
-	NV_C0_BC9_LO_CAL_I = 5442,
-	NV_C0_BC10_LO_CAL_I = 5443,
-	NV_C0_BC11_LO_CAL_I = 5444,
-	NV_C0_BC12_LO_CAL_I = 5445,
-	NV_C0_BC13_LO_CAL_I = 5446,
-	NV_C0_BC14_LO_CAL_I = 5447,
-	NV_C0_BC15_LO_CAL_I = 5448,
-	NV_DC_CAL_I = 5449,
-	NV_MF_BAND_CLASS_SP_INFO_I = 5450,
-	NV_DS_SIP_PROFILE_I = 5451,
-	NV_DS_SIP_ACTIVE_PROFILE_INDEX_I = 5452,
-	NV_DS_SIP_NUM_VALID_PROFILES_I = 5453,
-	NV_DS_SIP_NAI_INFO_I = 5454,
-	NV_DS_SIP_PPP_SS_INFO_I = 5455,
-	NV_DIAG_DIAGBUF_TX_SLEEP_THRESHOLD_EXT_I = 5456,
-	NV_WCDMA_CLTD_FBI_BER_THRESH_I = 5457,
-	NV_WCDMA_TEST_NV_1_I = 5458,
-	NV_WCDMA_2100_EXP_HDET_VS_AGC_V2_I = 5459,
-	NV_WCDMA_1900_EXP_HDET_VS_AGC_V2_I = 5460,
-	NV_WCDMA_800_EXP_HDET_VS_AGC_V2_I = 5461,
-	NV_WCDMA_BC4_EXP_HDET_VS_AGC_V2_I = 5462,
-	NV_WCDMA_1800_EXP_HDET_VS_AGC_V2_I = 5463,
-	NV_WCDMA_900_EXP_HDET_VS_AGC_V2_I = 5464,
-	NV_WCDMA_2100_HDET_OFF_V2_I = 5465,
-	NV_WCDMA_1900_HDET_OFF_V2_I = 5466,
-	NV_WCDMA_800_HDET_OFF_V2_I = 5467,
-	NV_WCDMA_BC4_HDET_OFF_V2_I = 5468,
-	NV_WCDMA_1800_HDET_OFF_V2_I = 5469,
-	NV_WCDMA_900_HDET_OFF_V2_I = 5470,
-	NV_WCDMA_2100_HDET_SPN_V2_I = 5471,
-	NV_WCDMA_1900_HDET_SPN_V2_I = 5472,
-	NV_WCDMA_800_HDET_SPN_V2_I = 5473,
-	NV_WCDMA_BC4_HDET_SPN_V2_I = 5474,
-	NV_WCDMA_1800_HDET_SPN_V2_I = 5475,
-	NV_WCDMA_900_HDET_SPN_V2_I = 5476,
-	NV_GSM_LINEAR_TX_GAIN_PARAM_I = 5477,
-	NV_EDGE_LINEAR_TX_GAIN_PARAM_I = 5478,
-	NV_ENH_THERM_I = 5479,
-	NV_EDGE_850_RGI_G0_F1_I = 5480,
-	NV_EDGE_850_RGI_G1_F1_I = 5481,
-	NV_EDGE_850_RGI_G2_F1_I = 5482,
-	NV_EDGE_850_RGI_G3_F1_I = 5483,
-	NV_EDGE_850_RGI_G0_F2_I = 5484,
-	NV_EDGE_850_RGI_G1_F2_I = 5485,
-	NV_EDGE_850_RGI_G2_F2_I = 5486,
-	NV_EDGE_850_RGI_G3_F2_I = 5487,
-	NV_EDGE_850_RGI_G0_F3_I = 5488,
-	NV_EDGE_850_RGI_G1_F3_I = 5489,
-	NV_EDGE_850_RGI_G2_F3_I = 5490,
-	NV_EDGE_850_RGI_G3_F3_I = 5491,
-	NV_EDGE_900_RGI_G0_F1_I = 5492,
-	NV_EDGE_900_RGI_G1_F1_I = 5493,
-	NV_EDGE_900_RGI_G2_F1_I = 5494,
-	NV_EDGE_900_RGI_G3_F1_I = 5495,
-	NV_EDGE_900_RGI_G0_F2_I = 5496,
-	NV_EDGE_900_RGI_G1_F2_I = 5497,
-	NV_EDGE_900_RGI_G2_F2_I = 5498,
-	NV_EDGE_900_RGI_G3_F2_I = 5499,
-	NV_EDGE_900_RGI_G0_F3_I = 5500,
-	NV_EDGE_900_RGI_G1_F3_I = 5501,
-	NV_EDGE_900_RGI_G2_F3_I = 5502,
-	NV_EDGE_900_RGI_G3_F3_I = 5503,
-	NV_EDGE_1800_RGI_G0_F1_I = 5504,
-	NV_EDGE_1800_RGI_G1_F1_I = 5505,
-	NV_EDGE_1800_RGI_G2_F1_I = 5506,
-	NV_EDGE_1800_RGI_G3_F1_I = 5507,
-	NV_EDGE_1800_RGI_G0_F2_I = 5508,
-	NV_EDGE_1800_RGI_G1_F2_I = 5509,
-	NV_EDGE_1800_RGI_G2_F2_I = 5510,
-	NV_EDGE_1800_RGI_G3_F2_I = 5511,
-	NV_EDGE_1800_RGI_G0_F3_I = 5512,
-	NV_EDGE_1800_RGI_G1_F3_I = 5513,
-	NV_EDGE_1800_RGI_G2_F3_I = 5514,
-	NV_EDGE_1800_RGI_G3_F3_I = 5515,
-	NV_EDGE_1900_RGI_G0_F1_I = 5516,
-	NV_EDGE_1900_RGI_G1_F1_I = 5517,
-	NV_EDGE_1900_RGI_G2_F1_I = 5518,
-	NV_EDGE_1900_RGI_G3_F1_I = 5519,
-	NV_EDGE_1900_RGI_G0_F2_I = 5520,
-	NV_EDGE_1900_RGI_G1_F2_I = 5521,
-	NV_EDGE_1900_RGI_G2_F2_I = 5522,
-	NV_EDGE_1900_RGI_G3_F2_I = 5523,
-	NV_EDGE_1900_RGI_G0_F3_I = 5524,
-	NV_EDGE_1900_RGI_G1_F3_I = 5525,
-	NV_EDGE_1900_RGI_G2_F3_I = 5526,
-	NV_EDGE_1900_RGI_G3_F3_I = 5527,
-	NV_EDGE_850_PMEAS_G0_F1_I = 5528,
-	NV_EDGE_850_PMEAS_G1_F1_I = 5529,
-	NV_EDGE_850_PMEAS_G2_F1_I = 5530,
-	NV_EDGE_850_PMEAS_G3_F1_I = 5531,
-	NV_EDGE_850_PMEAS_G0_F2_I = 5532,
-	NV_EDGE_850_PMEAS_G1_F2_I = 5533,
-	NV_EDGE_850_PMEAS_G2_F2_I = 5534,
-	NV_EDGE_850_PMEAS_G3_F2_I = 5535,
-	NV_EDGE_850_PMEAS_G0_F3_I = 5536,
-	NV_EDGE_850_PMEAS_G1_F3_I = 5537,
-	NV_EDGE_850_PMEAS_G2_F3_I = 5538,
-	NV_EDGE_850_PMEAS_G3_F3_I = 5539,
-	NV_EDGE_900_PMEAS_G0_F1_I = 5540,
-	NV_EDGE_900_PMEAS_G1_F1_I = 5541,
-	NV_EDGE_900_PMEAS_G2_F1_I = 5542,
-	NV_EDGE_900_PMEAS_G3_F1_I = 5543,
-	NV_EDGE_900_PMEAS_G0_F2_I = 5544,
-	NV_EDGE_900_PMEAS_G1_F2_I = 5545,
-	NV_EDGE_900_PMEAS_G2_F2_I = 5546,
-	NV_EDGE_900_PMEAS_G3_F2_I = 5547,
-	NV_EDGE_900_PMEAS_G0_F3_I = 5548,
-	NV_EDGE_900_PMEAS_G1_F3_I = 5549,
-	NV_EDGE_900_PMEAS_G2_F3_I = 5550,
-	NV_EDGE_900_PMEAS_G3_F3_I = 5551,
-	NV_EDGE_1800_PMEAS_G0_F1_I = 5552,
-	NV_EDGE_1800_PMEAS_G1_F1_I = 5553,
-	NV_EDGE_1800_PMEAS_G2_F1_I = 5554,
-	NV_EDGE_1800_PMEAS_G3_F1_I = 5555,
-	NV_EDGE_1800_PMEAS_G0_F2_I = 5556,
-	NV_EDGE_1800_PMEAS_G1_F2_I = 5557,
-	NV_EDGE_1800_PMEAS_G2_F2_I = 5558,
-	NV_EDGE_1800_PMEAS_G3_F2_I = 5559,
-	NV_EDGE_1800_PMEAS_G0_F3_I = 5560,
-	NV_EDGE_1800_PMEAS_G1_F3_I = 5561,
-	NV_EDGE_1800_PMEAS_G2_F3_I = 5562,
-	NV_EDGE_1800_PMEAS_G3_F3_I = 5563,
-	NV_EDGE_1900_PMEAS_G0_F1_I = 5564,
-	NV_EDGE_1900_PMEAS_G1_F1_I = 5565,
-	NV_EDGE_1900_PMEAS_G2_F1_I = 5566,
-	NV_EDGE_1900_PMEAS_G3_F1_I = 5567,
-	NV_EDGE_1900_PMEAS_G0_F2_I = 5568,
-	NV_EDGE_1900_PMEAS_G1_F2_I = 5569,
-	NV_EDGE_1900_PMEAS_G2_F2_I = 5570,
-	NV_EDGE_1900_PMEAS_G3_F2_I = 5571,
-	NV_EDGE_1900_PMEAS_G0_F3_I = 5572,
-	NV_EDGE_1900_PMEAS_G1_F3_I = 5573,
-	NV_EDGE_1900_PMEAS_G2_F3_I = 5574,
-	NV_EDGE_1900_PMEAS_G3_F3_I = 5575,
-	NV_SUPPLY_I = 5576,
-	NV_C0_BC0_IM2_CAL_I = 5577,
-	NV_C0_BC1_IM2_CAL_I = 5578,
-	NV_C0_BC2_IM2_CAL_I = 5579,
-	NV_C0_BC3_IM2_CAL_I = 5580,
-	NV_C0_BC4_IM2_CAL_I = 5581,
-	NV_C0_BC5_IM2_CAL_I = 5582,
-	NV_C0_BC6_IM2_CAL_I = 5583,
-	NV_C0_BC7_IM2_CAL_I = 5584,
-	NV_C0_BC8_IM2_CAL_I = 5585,
-	NV_C0_BC9_IM2_CAL_I = 5586,
-	NV_C0_BC10_IM2_CAL_I = 5587,
-	NV_C0_BC11_IM2_CAL_I = 5588,
-	NV_C0_BC12_IM2_CAL_I = 5589,
-	NV_C0_BC13_IM2_CAL_I = 5590,
-	NV_C0_BC14_IM2_CAL_I = 5591,
-	NV_C0_BC15_IM2_CAL_I = 5592,
-	NV_TOOLKIT_ENV_RETRY_FLAG_I = 5593,
-	NV_CGPS_SBAS_ENABLED_I = 5594,
-	NV_CGPS_SBAS_USER_PREFERENCE_I = 5595,
-	NV_CGPS_DPO_CONTROL_I = 5596,
-	NV_ESN_ME_I = 5597,
-	NV_MEID_ME_I = 5598,
-	NV_CGPS_ON_DEMAND_ENABLED_I = 5599,
-	NV_HDRSCP_SELECT_BCMCS_CONFIG_I = 5600,
-	NV_GSM_850_AMAM_LINEAR_PA_RANGEA_F1_SEG1_I = 5601,
-	NV_GSM_850_AMAM_LINEAR_PA_RANGEA_F1_SEG2_I = 5602,
-	NV_GSM_850_AMAM_LINEAR_PA_RANGEB_F1_SEG1_I = 5603,
-	NV_GSM_850_AMAM_LINEAR_PA_RANGEB_F1_SEG2_I = 5604,
-	NV_GSM_850_AMAM_LINEAR_PA_RANGEA_F2_SEG1_I = 5605,
-	NV_GSM_850_AMAM_LINEAR_PA_RANGEA_F2_SEG2_I = 5606,
-	NV_GSM_850_AMAM_LINEAR_PA_RANGEB_F2_SEG1_I = 5607,
-	NV_GSM_850_AMAM_LINEAR_PA_RANGEB_F2_SEG2_I = 5608,
-	NV_GSM_850_AMAM_LINEAR_PA_RANGEA_F3_SEG1_I = 5609,
-	NV_GSM_850_AMAM_LINEAR_PA_RANGEA_F3_SEG2_I = 5610,
-	NV_GSM_850_AMAM_LINEAR_PA_RANGEB_F3_SEG1_I = 5611,
-	NV_GSM_850_AMAM_LINEAR_PA_RANGEB_F3_SEG2_I = 5612,
-	NV_GSM_900_AMAM_LINEAR_PA_RANGEA_F1_SEG1_I = 5613,
-	NV_GSM_900_AMAM_LINEAR_PA_RANGEA_F1_SEG2_I = 5614,
-	NV_GSM_900_AMAM_LINEAR_PA_RANGEB_F1_SEG1_I = 5615,
-	NV_GSM_900_AMAM_LINEAR_PA_RANGEB_F1_SEG2_I = 5616,
-	NV_GSM_900_AMAM_LINEAR_PA_RANGEA_F2_SEG1_I = 5617,
-	NV_GSM_900_AMAM_LINEAR_PA_RANGEA_F2_SEG2_I = 5618,
-	NV_GSM_900_AMAM_LINEAR_PA_RANGEB_F2_SEG1_I = 5619,
-	NV_GSM_900_AMAM_LINEAR_PA_RANGEB_F2_SEG2_I = 5620,
-	NV_GSM_900_AMAM_LINEAR_PA_RANGEA_F3_SEG1_I = 5621,
-	NV_GSM_900_AMAM_LINEAR_PA_RANGEA_F3_SEG2_I = 5622,
-	NV_GSM_900_AMAM_LINEAR_PA_RANGEB_F3_SEG1_I = 5623,
-	NV_GSM_900_AMAM_LINEAR_PA_RANGEB_F3_SEG2_I = 5624,
-	NV_GSM_1800_AMAM_LINEAR_PA_RANGEA_F1_SEG1_I = 5625,
-	NV_GSM_1800_AMAM_LINEAR_PA_RANGEA_F1_SEG2_I = 5626,
-	NV_GSM_1800_AMAM_LINEAR_PA_RANGEB_F1_SEG1_I = 5627,
-	NV_GSM_1800_AMAM_LINEAR_PA_RANGEB_F1_SEG2_I = 5628,
-	NV_GSM_1800_AMAM_LINEAR_PA_RANGEA_F2_SEG1_I = 5629,
-	NV_GSM_1800_AMAM_LINEAR_PA_RANGEA_F2_SEG2_I = 5630,
-	NV_GSM_1800_AMAM_LINEAR_PA_RANGEB_F2_SEG1_I = 5631,
-	NV_GSM_1800_AMAM_LINEAR_PA_RANGEB_F2_SEG2_I = 5632,
-	NV_GSM_1800_AMAM_LINEAR_PA_RANGEA_F3_SEG1_I = 5633,
-	NV_GSM_1800_AMAM_LINEAR_PA_RANGEA_F3_SEG2_I = 5634,
-	NV_GSM_1800_AMAM_LINEAR_PA_RANGEB_F3_SEG1_I = 5635,
-	NV_GSM_1800_AMAM_LINEAR_PA_RANGEB_F3_SEG2_I = 5636,
-	NV_GSM_1900_AMAM_LINEAR_PA_RANGEA_F1_SEG1_I = 5637,
-	NV_GSM_1900_AMAM_LINEAR_PA_RANGEA_F1_SEG2_I = 5638,
-	NV_GSM_1900_AMAM_LINEAR_PA_RANGEB_F1_SEG1_I = 5639,
-	NV_GSM_1900_AMAM_LINEAR_PA_RANGEB_F1_SEG2_I = 5640,
-	NV_GSM_1900_AMAM_LINEAR_PA_RANGEA_F2_SEG1_I = 5641,
-	NV_GSM_1900_AMAM_LINEAR_PA_RANGEA_F2_SEG2_I = 5642,
-	NV_GSM_1900_AMAM_LINEAR_PA_RANGEB_F2_SEG1_I = 5643,
-	NV_GSM_1900_AMAM_LINEAR_PA_RANGEB_F2_SEG2_I = 5644,
-	NV_GSM_1900_AMAM_LINEAR_PA_RANGEA_F3_SEG1_I = 5645,
-	NV_GSM_1900_AMAM_LINEAR_PA_RANGEA_F3_SEG2_I = 5646,
-	NV_GSM_1900_AMAM_LINEAR_PA_RANGEB_F3_SEG1_I = 5647,
-	NV_GSM_1900_AMAM_LINEAR_PA_RANGEB_F3_SEG2_I = 5648,
-	NV_GSM_850_AMPM_LINEAR_PA_RANGEA_F1_SEG1_I = 5649,
-	NV_GSM_850_AMPM_LINEAR_PA_RANGEA_F1_SEG2_I = 5650,
-	NV_GSM_850_AMPM_LINEAR_PA_RANGEB_F1_SEG1_I = 5651,
-	NV_GSM_850_AMPM_LINEAR_PA_RANGEB_F1_SEG2_I = 5652,
-	NV_GSM_850_AMPM_LINEAR_PA_RANGEA_F2_SEG1_I = 5653,
-	NV_GSM_850_AMPM_LINEAR_PA_RANGEA_F2_SEG2_I = 5654,
-	NV_GSM_850_AMPM_LINEAR_PA_RANGEB_F2_SEG1_I = 5655,
-	NV_GSM_850_AMPM_LINEAR_PA_RANGEB_F2_SEG2_I = 5656,
-	NV_GSM_850_AMPM_LINEAR_PA_RANGEA_F3_SEG1_I = 5657,
-	NV_GSM_850_AMPM_LINEAR_PA_RANGEA_F3_SEG2_I = 5658,
-	NV_GSM_850_AMPM_LINEAR_PA_RANGEB_F3_SEG1_I = 5659,
-	NV_GSM_850_AMPM_LINEAR_PA_RANGEB_F3_SEG2_I = 5660,
-	NV_GSM_900_AMPM_LINEAR_PA_RANGEA_F1_SEG1_I = 5661,
-	NV_GSM_900_AMPM_LINEAR_PA_RANGEA_F1_SEG2_I = 5662,
-	NV_GSM_900_AMPM_LINEAR_PA_RANGEB_F1_SEG1_I = 5663,
-	NV_GSM_900_AMPM_LINEAR_PA_RANGEB_F1_SEG2_I = 5664,
-	NV_GSM_900_AMPM_LINEAR_PA_RANGEA_F2_SEG1_I = 5665,
-	NV_GSM_900_AMPM_LINEAR_PA_RANGEA_F2_SEG2_I = 5666,
-	NV_GSM_900_AMPM_LINEAR_PA_RANGEB_F2_SEG1_I = 5667,
-	NV_GSM_900_AMPM_LINEAR_PA_RANGEB_F2_SEG2_I = 5668,
-	NV_GSM_900_AMPM_LINEAR_PA_RANGEA_F3_SEG1_I = 5669,
-	NV_GSM_900_AMPM_LINEAR_PA_RANGEA_F3_SEG2_I = 5670,
-	NV_GSM_900_AMPM_LINEAR_PA_RANGEB_F3_SEG1_I = 5671,
-	NV_GSM_900_AMPM_LINEAR_PA_RANGEB_F3_SEG2_I = 5672,
-	NV_GSM_1800_AMPM_LINEAR_PA_RANGEA_F1_SEG1_I = 5673,
-	NV_GSM_1800_AMPM_LINEAR_PA_RANGEA_F1_SEG2_I = 5674,
-	NV_GSM_1800_AMPM_LINEAR_PA_RANGEB_F1_SEG1_I = 5675,
-	NV_GSM_1800_AMPM_LINEAR_PA_RANGEB_F1_SEG2_I = 5676,
-	NV_GSM_1800_AMPM_LINEAR_PA_RANGEA_F2_SEG1_I = 5677,
-	NV_GSM_1800_AMPM_LINEAR_PA_RANGEA_F2_SEG2_I = 5678,
-	NV_GSM_1800_AMPM_LINEAR_PA_RANGEB_F2_SEG1_I = 5679,
-	NV_GSM_1800_AMPM_LINEAR_PA_RANGEB_F2_SEG2_I = 5680,
-	NV_GSM_1800_AMPM_LINEAR_PA_RANGEA_F3_SEG1_I = 5681,
-	NV_GSM_1800_AMPM_LINEAR_PA_RANGEA_F3_SEG2_I = 5682,
-	NV_GSM_1800_AMPM_LINEAR_PA_RANGEB_F3_SEG1_I = 5683,
-	NV_GSM_1800_AMPM_LINEAR_PA_RANGEB_F3_SEG2_I = 5684,
-	NV_GSM_1900_AMPM_LINEAR_PA_RANGEA_F1_SEG1_I = 5685,
-	NV_GSM_1900_AMPM_LINEAR_PA_RANGEA_F1_SEG2_I = 5686,
-	NV_GSM_1900_AMPM_LINEAR_PA_RANGEB_F1_SEG1_I = 5687,
-	NV_GSM_1900_AMPM_LINEAR_PA_RANGEB_F1_SEG2_I = 5688,
-	NV_GSM_1900_AMPM_LINEAR_PA_RANGEA_F2_SEG1_I = 5689,
-	NV_GSM_1900_AMPM_LINEAR_PA_RANGEA_F2_SEG2_I = 5690,
-	NV_GSM_1900_AMPM_LINEAR_PA_RANGEB_F2_SEG1_I = 5691,
-	NV_GSM_1900_AMPM_LINEAR_PA_RANGEB_F2_SEG2_I = 5692,
-	NV_GSM_1900_AMPM_LINEAR_PA_RANGEA_F3_SEG1_I = 5693,
-	NV_GSM_1900_AMPM_LINEAR_PA_RANGEA_F3_SEG2_I = 5694,
-	NV_GSM_1900_AMPM_LINEAR_PA_RANGEB_F3_SEG1_I = 5695,
-	NV_GSM_1900_AMPM_LINEAR_PA_RANGEB_F3_SEG2_I = 5696,
-	NV_GSM_850_TX_AGC_SETTING_FOR_PRED_I = 5697,
-	NV_GSM_900_TX_AGC_SETTING_FOR_PRED_I = 5698,
-	NV_GSM_1800_TX_AGC_SETTING_FOR_PRED_I = 5699,
-	NV_GSM_1900_TX_AGC_SETTING_FOR_PRED_I = 5700,
-	NV_MIPV6_BEHAVIOR_I = 5701,
-	NV_MIPV6_ACTIVE_USER_I = 5702,
-	NV_MIPV6_GEN_USER_PROFILE_I = 5703,
-	NV_MIPV6_NAI_0_I = 5704,
-	NV_MIPV6_NAI_1_I = 5705,
-	NV_MIPV6_NAI_2_I = 5706,
-	NV_MIPV6_NAI_3_I = 5707,
-	NV_MIPV6_NAI_4_I = 5708,
-	NV_MIPV6_EAP_AKA_CREDENTIAL_I = 5709,
-	NV_MIPV6_HA_I = 5710,
-	NV_MIPV6_HOA_I = 5711,
-	NV_MIPV6_PRIMARY_DNS_I = 5712,
-	NV_MIPV6_SECONDARY_DNS_I = 5713,
-	NV_MIPV6_IPSEC_CONFIG_I = 5714,
-	NV_MIPV6_REGISTRATION_CONFIG_I = 5715,
-	NV_MIPV6_IPSEC_ON_PAYLOAD_I = 5716,
-	NV_MIPV6_REQUEST_VISITED_NETWORK_HA_I = 5717,
-	NV_MIPV6_PROTECTION_METHOD_I = 5718,
-	NV_MIPV6_MN_AAA_SHARED_SECRET_I = 5719,
-	NV_MIPV6_MN_HA_SHARED_SECRET_I = 5720,
-	NV_MIPV6_AUTH_PROTO_CONFIG_I = 5721,
-	NV_BC0_EXP_HDET_VS_AGC_V2_I = 5722,
-	NV_BC1_EXP_HDET_VS_AGC_V2_I = 5723,
-	NV_BC2_EXP_HDET_VS_AGC_V2_I = 5724,
-	NV_BC3_EXP_HDET_VS_AGC_V2_I = 5725,
-	NV_BC4_EXP_HDET_VS_AGC_V2_I = 5726,
-	NV_BC5_EXP_HDET_VS_AGC_V2_I = 5727,
-	NV_BC6_EXP_HDET_VS_AGC_V2_I = 5728,
-	NV_BC7_EXP_HDET_VS_AGC_V2_I = 5729,
-	NV_BC8_EXP_HDET_VS_AGC_V2_I = 5730,
-	NV_BC9_EXP_HDET_VS_AGC_V2_I = 5731,
-	NV_BC10_EXP_HDET_VS_AGC_V2_I = 5732,
-	NV_BC11_EXP_HDET_VS_AGC_V2_I = 5733,
-	NV_BC12_EXP_HDET_VS_AGC_V2_I = 5734,
-	NV_BC13_EXP_HDET_VS_AGC_V2_I = 5735,
-	NV_BC14_EXP_HDET_VS_AGC_V2_I = 5736,
-	NV_BC15_EXP_HDET_VS_AGC_V2_I = 5737,
-	NV_BC0_HDET_OFF_V2_I = 5738,
-	NV_BC1_HDET_OFF_V2_I = 5739,
-	NV_BC2_HDET_OFF_V2_I = 5740,
-	NV_BC3_HDET_OFF_V2_I = 5741,
-	NV_BC4_HDET_OFF_V2_I = 5742,
-	NV_BC5_HDET_OFF_V2_I = 5743,
-	NV_BC6_HDET_OFF_V2_I = 5744,
-	NV_BC7_HDET_OFF_V2_I = 5745,
-	NV_BC8_HDET_OFF_V2_I = 5746,
-	NV_BC9_HDET_OFF_V2_I = 5747,
-	NV_BC10_HDET_OFF_V2_I = 5748,
-	NV_BC11_HDET_OFF_V2_I = 5749,
-	NV_BC12_HDET_OFF_V2_I = 5750,
-	NV_BC13_HDET_OFF_V2_I = 5751,
-	NV_BC14_HDET_OFF_V2_I = 5752,
-	NV_BC15_HDET_OFF_V2_I = 5753,
-	NV_BC0_HDET_SPN_V2_I = 5754,
-	NV_BC1_HDET_SPN_V2_I = 5755,
-	NV_BC2_HDET_SPN_V2_I = 5756,
-	NV_BC3_HDET_SPN_V2_I = 5757,
-	NV_BC4_HDET_SPN_V2_I = 5758,
-	NV_BC5_HDET_SPN_V2_I = 5759,
-	NV_BC6_HDET_SPN_V2_I = 5760,
-	NV_BC7_HDET_SPN_V2_I = 5761,
-	NV_BC8_HDET_SPN_V2_I = 5762,
-	NV_BC9_HDET_SPN_V2_I = 5763,
-	NV_BC10_HDET_SPN_V2_I = 5764,
-	NV_BC11_HDET_SPN_V2_I = 5765,
-	NV_BC12_HDET_SPN_V2_I = 5766,
-	NV_BC13_HDET_SPN_V2_I = 5767,
-	NV_BC14_HDET_SPN_V2_I = 5768,
-	NV_BC15_HDET_SPN_V2_I = 5769,
-	NV_TOOLKIT_CS_PS_PARALLEL_I = 5770,
-	NV_DVBH_MAX_TS_ACQ_ATTEMPTS_I = 5771,
-	NV_DVBH_MAX_SYS_ACQ_ATTEMPTS_I = 5772,
-	NV_DSAT707_CTA_TIMER_I = 5773,
-	NV_DATA_AGG_TIMER_I = 5774,
-	NV_DHCP6_INFORM_REQ_TRIES_I = 5775,
-	NV_DHCP6_INFORM_REQ_INIT_RETRY_INTERVAL_I = 5776,
-	NV_WCDMA_MIMO_CTRL_I = 5777,
-	NV_UBM_DVBH_L1_CFG_EBI2_WS_I = 5778,
-	NV_UBM_DVBH_L1_CFG_DEBUG_I = 5779,
-	NV_UBM_DVBH_L1_CFG_USE_ACQ_TIMEOUT_I = 5780,
-	NV_UBM_DVBH_L1_CFG_SNOOZE_I = 5781,
-	NV_UBM_DVBH_L1_CFG_SLEEP_I = 5782,
-	NV_UBM_DVBH_L1_CFG_BW_I = 5783,
-	NV_UBM_DVBH_L1_CFG_T_SCAN_LOCKOUT_MS_I = 5784,
-	NV_UBM_DVBH_L1_CFG_T_SCAN_NO_AGC_MS_I = 5785,
-	NV_UBM_DVBH_L1_CFG_SCAN_NO_SIG_TRS_DB_Q6_I = 5786,
-	NV_UBM_DVBH_L1_CFG_T_SCAN_AGC_MS_I = 5787,
-	NV_UBM_DVBH_L1_CFG_T_SCAN_TPS_MS_I = 5788,
-	NV_UBM_DVBH_L1_CFG_SCAN_ENBLD_TRS_DB_Q6_I = 5789,
-	NV_UBM_DVBH_L1_CFG_HANDOFF_THRESH_DB_Q6_I = 5790,
-	NV_UBM_DVBH_L1_CFG_ACQ_TIMEOUT_MS_I = 5791,
-	NV_UBM_DVBH_L1_CFG_RECOVERY_RETRIES_I = 5792,
-	NV_UBM_DVBH_L1_CFG_TOTAL_RECOVERY_CNT_I = 5793,
-	NV_UBM_DVBH_L1_CFG_ACQ_BAILOUT_I = 5794,
-	NV_UBM_DVBH_L1_CFG_PRE_JAMMER_CFG_I = 5795,
-	NV_UBM_DVBH_L1_CFG_JAMMER_NOTCH_GAIN_I = 5796,
-	NV_UBM_DVBH_L1_CFG_POST_JAMMER_CFG_I = 5797,
-	NV_UBM_DVBH_L1_CFG_CPCE_ENABLED_I = 5798,
-	NV_UBM_DVBH_L1_CFG_FAP_LAP_SENS_I = 5799,
-	NV_UBM_DVBH_L1_CFG_MAX_CAND_PATHS_I = 5800,
-	NV_UBM_DVBH_L1_CFG_SIG_RECOVERED_TRSH_Q7_I = 5801,
-	NV_UBM_DVBH_L1_CFG_DISABLE_CPCE_IIR_I = 5802,
-	NV_UBM_DVBH_L1_CFG_TT_CIR_THRESH_I = 5803,
-	NV_UBM_DVBH_L1_CFG_FULL_SLEEP_REACQ_I = 5804,
-	NV_UBM_DVBH_L1_CFG_JAMMER_DETECT_THRESH_I = 5805,
-	NV_UBM_DVBH_L1_CFG_CPCE_LNA_THRESH_I = 5806,
-	NV_UBM_DVBH_L1_CFG_CE_IRR_FILT_GAIN_I = 5807,
-	NV_UBM_DVBH_L1_CFG_CPCE_CHECK_SYM_COUNT_I = 5808,
-	NV_UBM_DVBH_L1_CFG_CPCE_CAND_PS_QPSK_TRS_I = 5809,
-	NV_UBM_DVBH_L1_CFG_ADD_RAMPUP_SYMBOLS_I = 5810,
-	NV_UBM_DVBH_L1_CFG_CPCE_CHCK_SYM_IGNRE_CNT_I = 5811,
-	NV_UBM_DVBH_L1_CFG_RECOVERY_MIN_GOOD_RS1_I = 5812,
-	NV_UBM_DVBH_L1_CFG_RECOVERY_MAX_DROP_COUNT_I = 5813,
-	NV_UBM_DVBH_L1_CFG_T_RECOVERY_SCAN_MS_I = 5814,
-	NV_UBM_DVBH_L1_CFG_CAND_PER_TRS_QPSK_Q14_I = 5815,
-	NV_UBM_DVBH_L1_CFG_CPCE_AGC_VAR_THRESH_I = 5816,
-	NV_UBM_DVBH_L1_CFG_CPCE_AGC_IGNORE_CNT_I = 5817,
-	NV_UBM_DVBH_L1_CFG_CPCE_CAND_PS_16QAM_TRS_I = 5818,
-	NV_UBM_DVBH_L1_CFG_CAND_PER_TRS_16QAM_Q14_I = 5819,
-	NV_UBM_DVBH_L1_JAMMER_SYMBOLS_TO_IIR_I = 5820,
-	NV_UBM_DVBH_L1_JAMMER_IIR_GAIN_I = 5821,
-	NV_UBM_DVBH_L1_CFG_JAMMER_PEAK_ABS_TRS_I = 5822,
-	NV_MAO_TEST_CFG_I = 5823,
-	NV_WWAN_ACCESS_OVER_WIFI_PREFERRED_I = 5824,
-	NV_WIFI_LOCAL_BREAKOUT_ALLOWED_I = 5825,
-	NV_IWLAN_OPERATOR_ID_I = 5826,
-	NV_IWLAN_REALM_I = 5827,
-	NV_IWLAN_AUTH_MODE_I = 5828,
-	NV_IWLAN_SOFT_IKE_REKEY_TIME_I = 5829,
-	NV_IWLAN_HARD_IKE_REKEY_TIME_I = 5830,
-	NV_IWLAN_CHILD_SA_SOFT_LIFETIME_SEC_I = 5831,
-	NV_IWLAN_CHILD_SA_HARD_LIFETIME_SEC_I = 5832,
-	NV_IWLAN_CHILD_SA_SOFT_LIFETIME_BYTES_I = 5833,
-	NV_IWLAN_CHILD_SA_HARD_LIFETIME_BYTES_I = 5834,
-	NV_IWLAN_NAT_KEEPALIVE_INTERVAL_I = 5835,
-	NV_IWLAN_IKE_RETRANSMISSION_INTERVAL_I = 5836,
-	NV_IWLAN_IKE_MAX_RETRANSMISSIONS_I = 5837,
-	NV_IWLAN_IKEV2_IP_CONFIG_MASK_I = 5838,
-	NV_IWLAN_DHCP_IP_CONFIG_MASK_I = 5839,
-	NV_IWLAN_CHILD_SA_ENC_ALGO_PROPOSAL_MASK_I = 5840,
-	NV_IWLAN_IKE_SA_ENC_ALGO_PROPOSAL_MASK_I = 5841,
-	NV_IWLAN_IKE_SA_PRF_ALGO_PROPOSAL_MASK_I = 5842,
-	NV_IWLAN_CHILD_SA_AUTH_ALGO_PROPOSAL_MASK_I = 5843,
-	NV_IWLAN_IKE_SA_AUTH_ALGO_PROPOSAL_MASK_I = 5844,
-	NV_IWLAN_IKE_DH_MODE_I = 5845,
-	NV_IWLAN_PDIF_ADDRESS_I = 5846,
-	NV_IWLAN_MULTI_AUTH_SUPPORTED_I = 5847,
-	NV_IWLAN_PDIF_FQDN_I = 5848,
-	NV_CGPS_SBAS_WAAS_AREA_NODE1_I = 5849,
-	NV_CGPS_SBAS_WAAS_AREA_NODE2_I = 5850,
-	NV_CGPS_SBAS_WAAS_AREA_NODE3_I = 5851,
-	NV_CGPS_SBAS_WAAS_AREA_NODE4_I = 5852,
-	NV_CGPS_SBAS_WAAS_AREA_NODE5_I = 5853,
-	NV_CGPS_SBAS_WAAS_AREA_NODE6_I = 5854,
-	NV_CGPS_SBAS_EGNOS_AREA_NODE1_I = 5855,
-	NV_CGPS_SBAS_EGNOS_AREA_NODE2_I = 5856,
-	NV_CGPS_SBAS_EGNOS_AREA_NODE3_I = 5857,
-	NV_CGPS_SBAS_EGNOS_AREA_NODE4_I = 5858,
-	NV_CGPS_SBAS_EGNOS_AREA_NODE5_I = 5859,
-	NV_CGPS_SBAS_EGNOS_AREA_NODE6_I = 5860,
-	NV_CGPS_SBAS_MSAS_AREA_NODE1_I = 5861,
-	NV_CGPS_SBAS_MSAS_AREA_NODE2_I = 5862,
-	NV_CGPS_SBAS_MSAS_AREA_NODE3_I = 5863,
-	NV_CGPS_SBAS_MSAS_AREA_NODE4_I = 5864,
-	NV_CGPS_SBAS_MSAS_AREA_NODE5_I = 5865,
-	NV_CGPS_SBAS_MSAS_AREA_NODE6_I = 5866,
-	NV_CGPS_SBAS_GAGAN_AREA_NODE1_I = 5867,
-	NV_CGPS_SBAS_GAGAN_AREA_NODE2_I = 5868,
-	NV_CGPS_SBAS_GAGAN_AREA_NODE3_I = 5869,
-	NV_CGPS_SBAS_GAGAN_AREA_NODE4_I = 5870,
-	NV_CGPS_SBAS_GAGAN_AREA_NODE5_I = 5871,
-	NV_CGPS_SBAS_GAGAN_AREA_NODE6_I = 5872,
-	NV_IWLAN_DPD_ENABLED_I = 5873,
-	NV_IWLAN_DPD_TIME_SECS_I = 5874,
-	NV_BT_SOC_REFCLOCK_TYPE_I = 5875,
-	NV_BT_SOC_CLK_SHARING_TYPE_I = 5876,
-	NV_BT_SOC_INBAND_SLEEP_I = 5877,
-	NV_BT_SOC_LOGGING_ENABLED_I = 5878,
-	NV_BT_SOC_PM_MODE_I = 5879,
-	NV_TCP_DEFAULT_ROUND_TRIP_TIME_I = 5880,
-	NV_GPS1_GPS_RFIC_IM2CAL_IM2DAC_I_CHANNEL_I = 5881,
-	NV_GPS1_GPS_RFIC_IM2CAL_IM2DAC_Q_CHANNEL_I = 5882,
-	NV_BC0_HDR_REVA_TX_PREDISTORT_I = 5883,
-	NV_BC1_HDR_REVA_TX_PREDISTORT_I = 5884,
-	NV_BC3_HDR_REVA_TX_PREDISTORT_I = 5885,
-	NV_BC4_HDR_REVA_TX_PREDISTORT_I = 5886,
-	NV_BC6_HDR_REVA_TX_PREDISTORT_I = 5887,
-	NV_BC5_HDR_REVA_TX_PREDISTORT_I = 5888,
-	NV_BC10_HDR_REVA_TX_PREDISTORT_I = 5889,
-	NV_BC11_HDR_REVA_TX_PREDISTORT_I = 5890,
-	NV_BC14_HDR_REVA_TX_PREDISTORT_I = 5891,
-	NV_BC15_HDR_REVA_TX_PREDISTORT_I = 5892,
-	NV_BCX_HDR_REVA_TX_PREDISTORT_I = 5893,
-	NV_HDRMRLPARDA_PARAM_I = 5894,
-	NV_MGRF_SUPPORTED_I = 5895,
-	NV_WCDMA_RXF_MIS_COMP_A_COEFF_I = 5896,
-	NV_WCDMA_RXF_MIS_COMP_B_COEFF_I = 5897,
-	NV_C1_WCDMA_2100_RXF_MIS_COMP_A_COEFF_I = 5898,
-	NV_C1_WCDMA_2100_RXF_MIS_COMP_B_COEFF_I = 5899,
-	NV_WCDMA_1900_RXF_MIS_COMP_A_COEFF_I = 5900,
-	NV_WCDMA_1900_RXF_MIS_COMP_B_COEFF_I = 5901,
-	NV_C1_WCDMA_1900_RXF_MIS_COMP_A_COEFF_I = 5902,
-	NV_C1_WCDMA_1900_RXF_MIS_COMP_B_COEFF_I = 5903,
-	NV_WCDMA_BC4_RXF_MIS_COMP_A_COEFF_I = 5904,
-	NV_WCDMA_BC4_RXF_MIS_COMP_B_COEFF_I = 5905,
-	NV_C1_WCDMA_BC4_RXF_MIS_COMP_A_COEFF_I = 5906,
-	NV_C1_WCDMA_BC4_RXF_MIS_COMP_B_COEFF_I = 5907,
-	NV_WCDMA_800_RXF_MIS_COMP_A_COEFF_I = 5908,
-	NV_WCDMA_800_RXF_MIS_COMP_B_COEFF_I = 5909,
-	NV_C1_WCDMA_800_RXF_MIS_COMP_A_COEFF_I = 5910,
-	NV_C1_WCDMA_800_RXF_MIS_COMP_B_COEFF_I = 5911,
-	NV_WCDMA_RXF_ICI_I_COEF0_1_I = 5912,
-	NV_WCDMA_RXF_ICI_I_COEF2_3_I = 5913,
-	NV_WCDMA_RXF_ICI_I_COEF4_5_I = 5914,
-	NV_WCDMA_RXF_ICI_I_COEF6_7_I = 5915,
-	NV_WCDMA_RXF_ICI_I_COEF8_9_I = 5916,
-	NV_WCDMA_RXF_ICI_I_COEF10_11_I = 5917,
-	NV_WCDMA_RXF_ICI_I_COEF12_13_I = 5918,
-	NV_WCDMA_RXF_ICI_I_COEF14_15_I = 5919,
-	NV_WCDMA_RXF_ICI_Q_COEF0_1_I = 5920,
-	NV_WCDMA_RXF_ICI_Q_COEF2_3_I = 5921,
-	NV_WCDMA_RXF_ICI_Q_COEF4_5_I = 5922,
-	NV_WCDMA_RXF_ICI_Q_COEF6_7_I = 5923,
-	NV_WCDMA_RXF_ICI_Q_COEF8_9_I = 5924,
-	NV_WCDMA_RXF_ICI_Q_COEF10_11_I = 5925,
-	NV_WCDMA_RXF_ICI_Q_COEF12_13_I = 5926,
-	NV_WCDMA_RXF_ICI_Q_COEF14_15_I = 5927,
-	NV_C1_WCDMA_2100_RXF_ICI_I_COEF0_1_I = 5928,
-	NV_C1_WCDMA_2100_RXF_ICI_I_COEF2_3_I = 5929,
-	NV_C1_WCDMA_2100_RXF_ICI_I_COEF4_5_I = 5930,
-	NV_C1_WCDMA_2100_RXF_ICI_I_COEF6_7_I = 5931,
-	NV_C1_WCDMA_2100_RXF_ICI_I_COEF8_9_I = 5932,
-	NV_C1_WCDMA_2100_RXF_ICI_I_COEF10_11_I = 5933,
-	NV_C1_WCDMA_2100_RXF_ICI_I_COEF12_13_I = 5934,
-	NV_C1_WCDMA_2100_RXF_ICI_I_COEF14_15_I = 5935,
-	NV_C1_WCDMA_2100_RXF_ICI_Q_COEF0_1_I = 5936,
-	NV_C1_WCDMA_2100_RXF_ICI_Q_COEF2_3_I = 5937,
-	NV_C1_WCDMA_2100_RXF_ICI_Q_COEF4_5_I = 5938,
-	NV_C1_WCDMA_2100_RXF_ICI_Q_COEF6_7_I = 5939,
-	NV_C1_WCDMA_2100_RXF_ICI_Q_COEF8_9_I = 5940,
-	NV_C1_WCDMA_2100_RXF_ICI_Q_COEF10_11_I = 5941,
-	NV_C1_WCDMA_2100_RXF_ICI_Q_COEF12_13_I = 5942,
-	NV_C1_WCDMA_2100_RXF_ICI_Q_COEF14_15_I = 5943,
-	NV_WCDMA_RXF_ICI_IQ_TRUNC_I = 5944,
-	NV_C1_WCDMA_2100_RXF_ICI_IQ_TRUNC_I = 5945,
-	NV_WCDMA_1900_RXF_ICI_I_COEF0_1_I = 5946,
-	NV_WCDMA_1900_RXF_ICI_I_COEF2_3_I = 5947,
-	NV_WCDMA_1900_RXF_ICI_I_COEF4_5_I = 5948,
-	NV_WCDMA_1900_RXF_ICI_I_COEF6_7_I = 5949,
-	NV_WCDMA_1900_RXF_ICI_I_COEF8_9_I = 5950,
-	NV_WCDMA_1900_RXF_ICI_I_COEF10_11_I = 5951,
-	NV_WCDMA_1900_RXF_ICI_I_COEF12_13_I = 5952,
-	NV_WCDMA_1900_RXF_ICI_I_COEF14_15_I = 5953,
-	NV_WCDMA_1900_RXF_ICI_Q_COEF0_1_I = 5954,
-	NV_WCDMA_1900_RXF_ICI_Q_COEF2_3_I = 5955,
-	NV_WCDMA_1900_RXF_ICI_Q_COEF4_5_I = 5956,
-	NV_WCDMA_1900_RXF_ICI_Q_COEF6_7_I = 5957,
-	NV_WCDMA_1900_RXF_ICI_Q_COEF8_9_I = 5958,
-	NV_WCDMA_1900_RXF_ICI_Q_COEF10_11_I = 5959,
-	NV_WCDMA_1900_RXF_ICI_Q_COEF12_13_I = 5960,
-	NV_WCDMA_1900_RXF_ICI_Q_COEF14_15_I = 5961,
-	NV_C1_WCDMA_1900_RXF_ICI_I_COEF0_1_I = 5962,
-	NV_C1_WCDMA_1900_RXF_ICI_I_COEF2_3_I = 5963,
-	NV_C1_WCDMA_1900_RXF_ICI_I_COEF4_5_I = 5964,
-	NV_C1_WCDMA_1900_RXF_ICI_I_COEF6_7_I = 5965,
-	NV_C1_WCDMA_1900_RXF_ICI_I_COEF8_9_I = 5966,
-	NV_C1_WCDMA_1900_RXF_ICI_I_COEF10_11_I = 5967,
-	NV_C1_WCDMA_1900_RXF_ICI_I_COEF12_13_I = 5968,
-	NV_C1_WCDMA_1900_RXF_ICI_I_COEF14_15_I = 5969,
-	NV_C1_WCDMA_1900_RXF_ICI_Q_COEF0_1_I = 5970,
-	NV_C1_WCDMA_1900_RXF_ICI_Q_COEF2_3_I = 5971,
-	NV_C1_WCDMA_1900_RXF_ICI_Q_COEF4_5_I = 5972,
-	NV_C1_WCDMA_1900_RXF_ICI_Q_COEF6_7_I = 5973,
-	NV_C1_WCDMA_1900_RXF_ICI_Q_COEF8_9_I = 5974,
-	NV_C1_WCDMA_1900_RXF_ICI_Q_COEF10_11_I = 5975,
-	NV_C1_WCDMA_1900_RXF_ICI_Q_COEF12_13_I = 5976,
-	NV_C1_WCDMA_1900_RXF_ICI_Q_COEF14_15_I = 5977,
-	NV_WCDMA_1900_RXF_ICI_IQ_TRUNC_I = 5978,
-	NV_C1_WCDMA_1900_RXF_ICI_IQ_TRUNC_I = 5979,
-	NV_WCDMA_BC4_RXF_ICI_I_COEF0_1_I = 5980,
-	NV_WCDMA_BC4_RXF_ICI_I_COEF2_3_I = 5981,
-	NV_WCDMA_BC4_RXF_ICI_I_COEF4_5_I = 5982,
-	NV_WCDMA_BC4_RXF_ICI_I_COEF6_7_I = 5983,
-	NV_WCDMA_BC4_RXF_ICI_I_COEF8_9_I = 5984,
-	NV_WCDMA_BC4_RXF_ICI_I_COEF10_11_I = 5985,
-	NV_WCDMA_BC4_RXF_ICI_I_COEF12_13_I = 5986,
-	NV_WCDMA_BC4_RXF_ICI_I_COEF14_15_I = 5987,
-	NV_WCDMA_BC4_RXF_ICI_Q_COEF0_1_I = 5988,
-	NV_WCDMA_BC4_RXF_ICI_Q_COEF2_3_I = 5989,
-	NV_WCDMA_BC4_RXF_ICI_Q_COEF4_5_I = 5990,
-	NV_WCDMA_BC4_RXF_ICI_Q_COEF6_7_I = 5991,
-	NV_WCDMA_BC4_RXF_ICI_Q_COEF8_9_I = 5992,
-	NV_WCDMA_BC4_RXF_ICI_Q_COEF10_11_I = 5993,
-	NV_WCDMA_BC4_RXF_ICI_Q_COEF12_13_I = 5994,
-	NV_WCDMA_BC4_RXF_ICI_Q_COEF14_15_I = 5995,
-	NV_C1_WCDMA_BC4_RXF_ICI_I_COEF0_1_I = 5996,
-	NV_C1_WCDMA_BC4_RXF_ICI_I_COEF2_3_I = 5997,
-	NV_C1_WCDMA_BC4_RXF_ICI_I_COEF4_5_I = 5998,
-	NV_C1_WCDMA_BC4_RXF_ICI_I_COEF6_7_I = 5999,
-	NV_C1_WCDMA_BC4_RXF_ICI_I_COEF8_9_I = 6000,
-	NV_C1_WCDMA_BC4_RXF_ICI_I_COEF10_11_I = 6001,
-	NV_C1_WCDMA_BC4_RXF_ICI_I_COEF12_13_I = 6002,
-	NV_C1_WCDMA_BC4_RXF_ICI_I_COEF14_15_I = 6003,
-	NV_C1_WCDMA_BC4_RXF_ICI_Q_COEF0_1_I = 6004,
-	NV_C1_WCDMA_BC4_RXF_ICI_Q_COEF2_3_I = 6005,
-	NV_C1_WCDMA_BC4_RXF_ICI_Q_COEF4_5_I = 6006,
-	NV_C1_WCDMA_BC4_RXF_ICI_Q_COEF6_7_I = 6007,
-	NV_C1_WCDMA_BC4_RXF_ICI_Q_COEF8_9_I = 6008,
-	NV_C1_WCDMA_BC4_RXF_ICI_Q_COEF10_11_I = 6009,
-	NV_C1_WCDMA_BC4_RXF_ICI_Q_COEF12_13_I = 6010,
-	NV_C1_WCDMA_BC4_RXF_ICI_Q_COEF14_15_I = 6011,
-	NV_WCDMA_BC4_RXF_ICI_IQ_TRUNC_I = 6012,
-	NV_C1_WCDMA_BC4_RXF_ICI_IQ_TRUNC_I = 6013,
-	NV_WCDMA_800_RXF_ICI_I_COEF0_1_I = 6014,
-	NV_WCDMA_800_RXF_ICI_I_COEF2_3_I = 6015,
-	NV_WCDMA_800_RXF_ICI_I_COEF4_5_I = 6016,
-	NV_WCDMA_800_RXF_ICI_I_COEF6_7_I = 6017,
-	NV_WCDMA_800_RXF_ICI_I_COEF8_9_I = 6018,
-	NV_WCDMA_800_RXF_ICI_I_COEF10_11_I = 6019,
-	NV_WCDMA_800_RXF_ICI_I_COEF12_13_I = 6020,
-	NV_WCDMA_800_RXF_ICI_I_COEF14_15_I = 6021,
-	NV_WCDMA_800_RXF_ICI_Q_COEF0_1_I = 6022,
-	NV_WCDMA_800_RXF_ICI_Q_COEF2_3_I = 6023,
-	NV_WCDMA_800_RXF_ICI_Q_COEF4_5_I = 6024,
-	NV_WCDMA_800_RXF_ICI_Q_COEF6_7_I = 6025,
-	NV_WCDMA_800_RXF_ICI_Q_COEF8_9_I = 6026,
-	NV_WCDMA_800_RXF_ICI_Q_COEF10_11_I = 6027,
-	NV_WCDMA_800_RXF_ICI_Q_COEF12_13_I = 6028,
-	NV_WCDMA_800_RXF_ICI_Q_COEF14_15_I = 6029,
-	NV_C1_WCDMA_800_RXF_ICI_I_COEF0_1_I = 6030,
-	NV_C1_WCDMA_800_RXF_ICI_I_COEF2_3_I = 6031,
-	NV_C1_WCDMA_800_RXF_ICI_I_COEF4_5_I = 6032,
-	NV_C1_WCDMA_800_RXF_ICI_I_COEF6_7_I = 6033,
-	NV_C1_WCDMA_800_RXF_ICI_I_COEF8_9_I = 6034,
-	NV_C1_WCDMA_800_RXF_ICI_I_COEF10_11_I = 6035,
-	NV_C1_WCDMA_800_RXF_ICI_I_COEF12_13_I = 6036,
-	NV_C1_WCDMA_800_RXF_ICI_I_COEF14_15_I = 6037,
-	NV_C1_WCDMA_800_RXF_ICI_Q_COEF0_1_I = 6038,
-	NV_C1_WCDMA_800_RXF_ICI_Q_COEF2_3_I = 6039,
-	NV_C1_WCDMA_800_RXF_ICI_Q_COEF4_5_I = 6040,
-	NV_C1_WCDMA_800_RXF_ICI_Q_COEF6_7_I = 6041,
-	NV_C1_WCDMA_800_RXF_ICI_Q_COEF8_9_I = 6042,
-	NV_C1_WCDMA_800_RXF_ICI_Q_COEF10_11_I = 6043,
-	NV_C1_WCDMA_800_RXF_ICI_Q_COEF12_13_I = 6044,
-	NV_C1_WCDMA_800_RXF_ICI_Q_COEF14_15_I = 6045,
-	NV_WCDMA_800_RXF_ICI_IQ_TRUNC_I = 6046,
-	NV_C1_WCDMA_800_RXF_ICI_IQ_TRUNC_I = 6047,
-	NV_WCDMA_2100_HS_SWITCHPOINTS_SHIFT_I = 6048,
-	NV_WCDMA_1900_HS_SWITCHPOINTS_SHIFT_I = 6049,
-	NV_WCDMA_1800_HS_SWITCHPOINTS_SHIFT_I = 6050,
-	NV_WCDMA_900_HS_SWITCHPOINTS_SHIFT_I = 6051,
-	NV_WCDMA_800_HS_SWITCHPOINTS_SHIFT_I = 6052,
-	NV_WCDMA_BC4_HS_SWITCHPOINTS_SHIFT_I = 6053,
-	NV_BCX_BLOCK_1_GPS1_RF_DELAY_I = 6054,
-	NV_BCX_BLOCK_1_RF_TUNE_RESERVED_I = 6055,
-	NV_BCX_BLOCK_1_TX_LIM_VS_TEMP_I = 6056,
-	NV_BCX_BLOCK_1_TX_LIN_MASTER0_I = 6057,
-	NV_BCX_BLOCK_1_TX_LIN_MASTER1_I = 6058,
-	NV_BCX_BLOCK_1_TX_LIN_MASTER2_I = 6059,
-	NV_BCX_BLOCK_1_TX_LIN_MASTER3_I = 6060,
-	NV_BCX_BLOCK_1_TX_COMP0_I = 6061,
-	NV_BCX_BLOCK_1_TX_COMP1_I = 6062,
-	NV_BCX_BLOCK_1_TX_COMP2_I = 6063,
-	NV_BCX_BLOCK_1_TX_COMP3_I = 6064,
-	NV_BCX_BLOCK_1_TX_LIM_VS_FREQ_I = 6065,
-	NV_BCX_BLOCK_1_PA_R1_RISE_I = 6066,
-	NV_BCX_BLOCK_1_PA_R1_FALL_I = 6067,
-	NV_BCX_BLOCK_1_PA_R2_RISE_I = 6068,
-	NV_BCX_BLOCK_1_PA_R2_FALL_I = 6069,
-	NV_BCX_BLOCK_1_PA_R3_RISE_I = 6070,
-	NV_BCX_BLOCK_1_PA_R3_FALL_I = 6071,
-	NV_BCX_BLOCK_1_HDET_OFF_I = 6072,
-	NV_BCX_BLOCK_1_HDET_SPN_I = 6073,
-	NV_BCX_BLOCK_1_EXP_HDET_VS_AGC_I = 6074,
-	NV_BCX_BLOCK_1_ENC_BTF_I = 6075,
-	NV_BCX_BLOCK_1_VCO_COARSE_TUNE_TABLE_I = 6076,
-	NV_BCX_BLOCK_1_P1_RISE_FALL_OFF_I = 6077,
-	NV_C0_BCX_BLOCK_1_TX_CAL_CHAN_I = 6078,
-	NV_C0_BCX_BLOCK_1_RX_CAL_CHAN_I = 6079,
-	NV_C0_BCX_BLOCK_1_LNA_1_OFFSET_VS_FREQ_I = 6080,
-	NV_C0_BCX_BLOCK_1_LNA_2_OFFSET_VS_FREQ_I = 6081,
-	NV_C0_BCX_BLOCK_1_LNA_3_OFFSET_VS_FREQ_I = 6082,
-	NV_C0_BCX_BLOCK_1_LNA_4_OFFSET_VS_FREQ_I = 6083,
-	NV_C0_BCX_BLOCK_1_LNA_1_OFFSET_I = 6084,
-	NV_C0_BCX_BLOCK_1_LNA_2_OFFSET_I = 6085,
-	NV_C0_BCX_BLOCK_1_LNA_3_OFFSET_I = 6086,
-	NV_C0_BCX_BLOCK_1_LNA_4_OFFSET_I = 6087,
-	NV_C0_BCX_BLOCK_1_IM2_I_VALUE_I = 6088,
-	NV_C0_BCX_BLOCK_1_IM2_Q_VALUE_I = 6089,
-	NV_C0_BCX_BLOCK_1_VGA_GAIN_OFFSET_I = 6090,
-	NV_C0_BCX_BLOCK_1_VGA_GAIN_OFFSET_VS_FREQ_I = 6091,
-	NV_C0_BCX_BLOCK_1_IM2_TRANSCONDUCTOR_VALUE_I = 6092,
-	NV_C0_BCX_BLOCK_1_LNA_1_RISE_I = 6093,
-	NV_C0_BCX_BLOCK_1_LNA_1_FALL_I = 6094,
-	NV_C0_BCX_BLOCK_1_LNA_2_RISE_I = 6095,
-	NV_C0_BCX_BLOCK_1_LNA_2_FALL_I = 6096,
-	NV_C0_BCX_BLOCK_1_LNA_3_RISE_I = 6097,
-	NV_C0_BCX_BLOCK_1_LNA_3_FALL_I = 6098,
-	NV_C0_BCX_BLOCK_1_LNA_4_RISE_I = 6099,
-	NV_C0_BCX_BLOCK_1_LNA_4_FALL_I = 6100,
-	NV_C0_BCX_BLOCK_1_IM_LEVEL1_I = 6101,
-	NV_C0_BCX_BLOCK_1_IM_LEVEL2_I = 6102,
-	NV_C0_BCX_BLOCK_1_IM_LEVEL3_I = 6103,
-	NV_C0_BCX_BLOCK_1_IM_LEVEL4_I = 6104,
-	NV_C1_BCX_BLOCK_1_TX_CAL_CHAN_I = 6105,
-	NV_C1_BCX_BLOCK_1_RX_CAL_CHAN_I = 6106,
-	NV_C1_BCX_BLOCK_1_LNA_1_OFFSET_VS_FREQ_I = 6107,
-	NV_C1_BCX_BLOCK_1_LNA_2_OFFSET_VS_FREQ_I = 6108,
-	NV_C1_BCX_BLOCK_1_LNA_3_OFFSET_VS_FREQ_I = 6109,
-	NV_C1_BCX_BLOCK_1_LNA_4_OFFSET_VS_FREQ_I = 6110,
-	NV_C1_BCX_BLOCK_1_LNA_1_OFFSET_I = 6111,
-	NV_C1_BCX_BLOCK_1_LNA_2_OFFSET_I = 6112,
-	NV_C1_BCX_BLOCK_1_LNA_3_OFFSET_I = 6113,
-	NV_C1_BCX_BLOCK_1_LNA_4_OFFSET_I = 6114,
-	NV_C1_BCX_BLOCK_1_IM2_I_VALUE_I = 6115,
-	NV_C1_BCX_BLOCK_1_IM2_Q_VALUE_I = 6116,
-	NV_C1_BCX_BLOCK_1_VGA_GAIN_OFFSET_I = 6117,
-	NV_C1_BCX_BLOCK_1_VGA_GAIN_OFFSET_VS_FREQ_I = 6118,
-	NV_C1_BCX_BLOCK_1_IM2_TRANSCONDUCTOR_VALUE_I = 6119,
-	NV_C1_BCX_BLOCK_1_LNA_1_RISE_I = 6120,
-	NV_C1_BCX_BLOCK_1_LNA_1_FALL_I = 6121,
-	NV_C1_BCX_BLOCK_1_LNA_2_RISE_I = 6122,
-	NV_C1_BCX_BLOCK_1_LNA_2_FALL_I = 6123,
-	NV_C1_BCX_BLOCK_1_LNA_3_RISE_I = 6124,
-	NV_C1_BCX_BLOCK_1_LNA_3_FALL_I = 6125,
-	NV_C1_BCX_BLOCK_1_LNA_4_RISE_I = 6126,
-	NV_C1_BCX_BLOCK_1_LNA_4_FALL_I = 6127,
-	NV_C1_BCX_BLOCK_1_IM_LEVEL1_I = 6128,
-	NV_C1_BCX_BLOCK_1_IM_LEVEL2_I = 6129,
-	NV_C1_BCX_BLOCK_1_IM_LEVEL3_I = 6130,
-	NV_C1_BCX_BLOCK_1_IM_LEVEL4_I = 6131,
-	NV_BCX_BLOCK_1_P2_RISE_FALL_OFF_I = 6132,
-	NV_BCX_BLOCK_1_P3_RISE_FALL_OFF_I = 6133,
-	NV_BCX_BLOCK_1_HDR_P2_RISE_FALL_OFF_I = 6134,
-	NV_BCX_BLOCK_1_HDR_P3_RISE_FALL_OFF_I = 6135,
-	NV_BCX_BLOCK_VCO_COARSE_TUNE_2_I = 6136,
-	NV_C1_BCX_BLOCK_VCO_COARSE_TUNE_TABLE_I = 6137,
-	NV_C0_BCX_BLOCK_RX_CAL_CHAN_LRU_I = 6138,
-	NV_C1_BCX_BLOCK_RX_CAL_CHAN_LRU_I = 6139,
-	NV_BCX_BLOCK_HDR_P1_RISE_FALL_OFF_I = 6140,
-	NV_BCX_BLOCK_PA_DVS_VOLTAGE_I = 6141,
-	NV_BCX_BLOCK_VCO_TUNE_2_I = 6142,
-	NV_C0_BCX_BLOCK_IM2_LPM_1_I = 6143,
-	NV_C0_BCX_BLOCK_IM2_LPM_2_I = 6144,
-	NV_C0_BCX_BLOCK_INTELLICEIVER_CAL_I = 6145,
-	NV_C0_BCX_BLOCK_LNA_SWITCHPOINTS_LPM_1_I = 6146,
-	NV_C0_BCX_BLOCK_LNA_SWITCHPOINTS_LPM_2_I = 6147,
-	NV_BCX_BLOCK_ANT_QUALITY_I = 6148,
-	NV_C0_BCX_BLOCK_INTELLICEIVER_DET_THRESH_I = 6149,
-	NV_BCX_BLOCK_TX_PDM_LIN_0_I = 6150,
-	NV_BCX_BLOCK_TX_PDM_LIN_1_I = 6151,
-	NV_BCX_BLOCK_TX_PDM_LIN_2_I = 6152,
-	NV_BCX_BLOCK_TX_PDM_LIN_3_I = 6153,
-	NV_BCX_BLOCK_TX_PDM_0_I = 6154,
-	NV_BCX_BLOCK_TX_PDM_1_I = 6155,
-	NV_BCX_BLOCK_TX_PDM_2_I = 6156,
-	NV_BCX_BLOCK_TX_PDM_3_I = 6157,
-	NV_BCX_BLOCK_TX_LIN_0_I = 6158,
-	NV_BCX_BLOCK_TX_LIN_1_I = 6159,
-	NV_BCX_BLOCK_TX_LIN_2_I = 6160,
-	NV_BCX_BLOCK_TX_LIN_3_I = 6161,
-	NV_BCX_BLOCK_PA_R_MAP_I = 6162,
-	NV_BCX_BLOCK_TX_PWR_COMP0_I = 6163,
-	NV_BCX_BLOCK_TX_PWR_COMP1_I = 6164,
-	NV_BCX_BLOCK_TX_PWR_COMP2_I = 6165,
-	NV_BCX_BLOCK_TX_PWR_COMP3_I = 6166,
-	NV_C0_BCX_BLOCK_LO_CAL_I = 6167,
-	NV_C0_BCX_BLOCK_IM2_CAL_I = 6168,
-	NV_BCX_BLOCK_EXP_HDET_VS_AGC_V2_I = 6169,
-	NV_BCX_BLOCK_HDET_OFF_V2_I = 6170,
-	NV_BCX_BLOCK_HDET_SPN_V2_I = 6171,
-	NV_BCX_BLOCK_1_VCO_COARSE_TUNE_2_I = 6172,
-	NV_C1_BCX_BLOCK_1_VCO_COARSE_TUNE_TABLE_I = 6173,
-	NV_C0_BCX_BLOCK_1_RX_CAL_CHAN_LRU_I = 6174,
-	NV_C1_BCX_BLOCK_1_RX_CAL_CHAN_LRU_I = 6175,
-	NV_BCX_BLOCK_1_HDR_P1_RISE_FALL_OFF_I = 6176,
-	NV_BCX_BLOCK_1_PA_DVS_VOLTAGE_I = 6177,
-	NV_BCX_BLOCK_1_VCO_TUNE_2_I = 6178,
-	NV_C0_BCX_BLOCK_1_IM2_LPM_1_I = 6179,
-	NV_C0_BCX_BLOCK_1_IM2_LPM_2_I = 6180,
-	NV_C0_BCX_BLOCK_1_INTELLICEIVER_CAL_I = 6181,
-	NV_C0_BCX_BLOCK_1_LNA_SWITCHPOINTS_LPM_1_I = 6182,
-	NV_C0_BCX_BLOCK_1_LNA_SWITCHPOINTS_LPM_2_I = 6183,
-	NV_BCX_BLOCK_1_ANT_QUALITY_I = 6184,
-	NV_C0_BCX_BLOCK_1_INTELLICEIVER_DET_THRESH_I = 6185,
-	NV_BCX_BLOCK_1_TX_PDM_LIN_0_I = 6186,
-	NV_BCX_BLOCK_1_TX_PDM_LIN_1_I = 6187,
-	NV_BCX_BLOCK_1_TX_PDM_LIN_2_I = 6188,
-	NV_BCX_BLOCK_1_TX_PDM_LIN_3_I = 6189,
-	NV_BCX_BLOCK_1_TX_PDM_0_I = 6190,
-	NV_BCX_BLOCK_1_TX_PDM_1_I = 6191,
-	NV_BCX_BLOCK_1_TX_PDM_2_I = 6192,
-	NV_BCX_BLOCK_1_TX_PDM_3_I = 6193,
-	NV_BCX_BLOCK_1_TX_LIN_0_I = 6194,
-	NV_BCX_BLOCK_1_TX_LIN_1_I = 6195,
-	NV_BCX_BLOCK_1_TX_LIN_2_I = 6196,
-	NV_BCX_BLOCK_1_TX_LIN_3_I = 6197,
-	NV_BCX_BLOCK_1_PA_R_MAP_I = 6198,
-	NV_BCX_BLOCK_1_TX_PWR_COMP0_I = 6199,
-	NV_BCX_BLOCK_1_TX_PWR_COMP1_I = 6200,
-	NV_BCX_BLOCK_1_TX_PWR_COMP2_I = 6201,
-	NV_BCX_BLOCK_1_TX_PWR_COMP3_I = 6202,
-	NV_C0_BCX_BLOCK_1_LO_CAL_I = 6203,
-	NV_C0_BCX_BLOCK_1_IM2_CAL_I = 6204,
-	NV_BCX_BLOCK_1_EXP_HDET_VS_AGC_V2_I = 6205,
-	NV_BCX_BLOCK_1_HDET_OFF_V2_I = 6206,
-	NV_BCX_BLOCK_1_HDET_SPN_V2_I = 6207,
-	NV_BCX_BLOCK_BAND_CLASS_I = 6208,
-	NV_BCX_BLOCK_1_BAND_CLASS_I = 6209,
-	NV_BCX_BLOCK_SUBCLASS_MASK_I = 6210,
-	NV_BCX_BLOCK_1_SUBCLASS_MASK_I = 6211,
-	NV_UIM_PAR_ERR_WORKAROUND_I = 6212,
-	NV_GPS1_ER_CURVE_FIT_INTERVAL_I = 6213,
-	NV_CGPS_ER_ENABLE_I = 6214,
-	NV_CGPS_ER_START_TIME_I = 6215,
-	NV_CGPS_ER_SLOT_INTERVAL_I = 6216,
-	NV_CGPS_ER_SLOT_PERIOD_I = 6217,
-	NV_UW_FMC_NAT_REFRESH_TIMER_I = 6218,
-	NV_BC0_SUBCLASS_MASK_I = 6219,
-	NV_BC1_SUBCLASS_MASK_I = 6220,
-	NV_BC2_SUBCLASS_MASK_I = 6221,
-	NV_BC3_SUBCLASS_MASK_I = 6222,
-	NV_BC4_SUBCLASS_MASK_I = 6223,
-	NV_BC5_SUBCLASS_MASK_I = 6224,
-	NV_BC6_SUBCLASS_MASK_I = 6225,
-	NV_BC7_SUBCLASS_MASK_I = 6226,
-	NV_BC8_SUBCLASS_MASK_I = 6227,
-	NV_BC9_SUBCLASS_MASK_I = 6228,
-	NV_BC10_SUBCLASS_MASK_I = 6229,
-	NV_BC11_SUBCLASS_MASK_I = 6230,
-	NV_BC12_SUBCLASS_MASK_I = 6231,
-	NV_BC13_SUBCLASS_MASK_I = 6232,
-	NV_BC14_SUBCLASS_MASK_I = 6233,
-	NV_BC15_SUBCLASS_MASK_I = 6234,
-	NV_HS_USB_USE_PMIC_OTG_COMPARATORS_I = 6235,
-	NV_RFR_MULTI_CHIPSET_1_BB_FILTER_I = 6236,
-	NV_C1_RFR_MULTI_CHIPSET_1_BB_FILTER_I = 6237,
-	NV_RFR_MULTI_CHIPSET_1_IQ_LINE_RESISTOR_I = 6238,
-	NV_HS_USB_NUMBER_OF_SDCC_LUNS_I = 6239,
-	NV_THERMAL_MONITOR_THRESHOLDS_I = 6240,
-	NV_THERMAL_MONITOR_TIMERS_I = 6241,
-	NV_DELTA_TX_POWER_I = 6242,
-	NV_THERMAL_CURRENT_MONITOR_CONFIG_I = 6243,
-	NV_THERMAL_MONITOR_MAX_TEMP_I = 6244,
-	NV_PPP_EAP_SHARED_SECRET_I = 6245,
-	NV_PPP_EAP_USER_ID_I = 6246,
-	NV_PPP_VSNCP_CONFIG_DATA_I = 6247,
-	NV_EHRPD_ENABLED_I = 6248,
-	NV_WLAN_ATHEROS_SPECIFIC_CFG_I = 6249,
-	NV_GAN_MODE_PREFERENCE_I = 6250,
-	NV_IWLAN_ENFORCE_PEER_CERT_AUTH_I = 6251,
-	NV_LPM_PERSISTENCE_I = 6252,
-	NV_CSIM_SUPPORT_I = 6253,
-	NV_QMI_ROAM_PREF_I = 6254,
-	NV_UW_FMC_V4_MTU_I = 6255,
-	NV_AAGPS_GLOBAL_ALTITUDE_I = 6256,
-	NV_AAGPS_GLOBAL_ALT_UNC_I = 6257,
-	NV_WWWAN_CONFIG_I = 6258,
-	NV_HS_USB_HOST_MODE_ENABLED_I = 6259,
-	NV_WLAN_CPU_FLOW_CONTROL_CFG_I = 6260,
-	NV_ADSP_DYN_CLOCK_VOLTAGE_I = 6261,
-	NV_MTPDP_APP_I = 6262,
-	NV_AAGPS_ACQUISITION_TIMER_I = 6263,
-	NV_CGPS_MINIMUM_GPS_WEEK_NUMBER_I = 6264,
+#define NV_ITEM(name, id) name = id,
+#define NV_ITEM_EX(name, id, size, type) name = id,
+#include "qc/dm_nv_items.def"
+#undef NV_ITEM
+#undef NV_ITEM_EX
 	NV_MAX_I = 6265
 };
 
@@ -0,0 +1,551 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_nv_backup.cpp
+* @class OpenPST::DmNvBackupWriter, OpenPST::DmNvBackupReader
+* @package OpenPST
+* @brief Indexed binary NV backup container
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "dm_nv_backup.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace OpenPST;
+
+/**
+* @brief DmNvBackupWriter - Constructor
+*/
+DmNvBackupWriter::DmNvBackupWriter() :
+    header(),
+    offset(0)
+{
+
+}
+
+/**
+* @brief ~DmNvBackupWriter - Deconstructor, closes the file if still open
+*/
+DmNvBackupWriter::~DmNvBackupWriter()
+{
+    if (isOpen()) {
+        close();
+    }
+}
+
+/**
+* @brief open - Create the file and write a header with no index
+*
+* @param std::string filePath
+* @param DmNvBackupDeviceInfo& device
+*
+* @return bool
+*/
+bool DmNvBackupWriter::open(std::string filePath, const DmNvBackupDeviceInfo& device)
+{
+    if (isOpen()) {
+        close();
+    }
+
+    file.open(filePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open()) {
+        LOGE("Could not open %s\n", filePath.c_str());
+        return false;
+    }
+
+    header = {};
+    header.magic        = DM_NV_BACKUP_MAGIC;
+    header.version      = DM_NV_BACKUP_VERSION;
+    header.headerSize   = sizeof(DmNvBackupHeader);
+    header.created      = (uint64_t)time(nullptr);
+    header.esn          = device.esn;
+    header.meid         = device.meid;
+
+    std::memcpy(header.firmware, device.firmware.c_str(), device.firmware.size() < sizeof(header.firmware) ? device.firmware.size() : sizeof(header.firmware) - 1);
+
+    index.clear();
+
+    offset = sizeof(header);
+
+    file.write((char*)&header, sizeof(header));
+
+    return file.good();
+}
+
+/**
+* @brief add - Append an item read result
+*
+* @param DmNvBulkResult& result
+*
+* @return bool
+*/
+bool DmNvBackupWriter::add(const DmNvBulkResult& result)
+{
+    DmNvBackupIndexEntry entry = {};
+
+    if (!isOpen()) {
+        return false;
+    }
+
+    entry.item      = result.item;
+    entry.status    = result.status;
+    entry.command   = result.command;
+    entry.nvStatus  = result.nvStatus;
+    entry.offset    = offset;
+
+    if (result.status == kDmNvBulkOk) {
+        entry.size = DIAG_NV_ITEM_SIZE;
+
+        while (entry.size && !result.data[entry.size - 1]) {
+            entry.size--;
+        }
+
+        file.write((char*)result.data, entry.size);
+
+        offset += entry.size;
+    }
+
+    index.push_back(entry);
+
+    return file.good();
+}
+
+/**
+* @brief close - Write the sorted index and patch the header
+*
+* @return bool
+*/
+bool DmNvBackupWriter::close()
+{
+    if (!isOpen()) {
+        return false;
+    }
+
+    std::stable_sort(index.begin(), index.end(), [](const DmNvBackupIndexEntry& a, const DmNvBackupIndexEntry& b) {
+        return a.item < b.item;
+    });
+
+    if (index.size()) {
+        file.write((char*)&index[0], index.size() * sizeof(DmNvBackupIndexEntry));
+    }
+
+    header.itemCount    = index.size();
+    header.indexOffset  = offset;
+
+    file.seekp(0, file.beg);
+    file.write((char*)&header, sizeof(header));
+
+    bool success = file.good();
+
+    file.close();
+
+    return success;
+}
+
+/**
+* @brief isOpen
+*
+* @return bool
+*/
+bool DmNvBackupWriter::isOpen()
+{
+    return file.is_open();
+}
+
+/**
+* @brief DmNvBackupReader - Constructor
+*/
+DmNvBackupReader::DmNvBackupReader() :
+    data(nullptr),
+    size(0),
+    index(nullptr)
+#ifdef _WIN32
+    , fileHandle(INVALID_HANDLE_VALUE),
+    mappingHandle(nullptr)
+#endif
+{
+
+}
+
+/**
+* @brief ~DmNvBackupReader - Deconstructor, unmaps the file
+*/
+DmNvBackupReader::~DmNvBackupReader()
+{
+    close();
+}
+
+/**
+* @brief open - Map a backup and validate its header and index
+*
+* @param std::string filePath
+*
+* @return bool
+*/
+bool DmNvBackupReader::open(std::string filePath)
+{
+    close();
+
+#ifdef _WIN32
+    LARGE_INTEGER fileSize;
+
+    fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (fileHandle == INVALID_HANDLE_VALUE || !GetFileSizeEx(fileHandle, &fileSize) || !fileSize.QuadPart) {
+        LOGE("Could not open %s\n", filePath.c_str());
+        close();
+        return false;
+    }
+
+    mappingHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    if (mappingHandle != nullptr) {
+        data = (const uint8_t*)MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    }
+
+    size = (size_t)fileSize.QuadPart;
+#else
+    struct stat fileStat;
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+
+    if (fd < 0 || fstat(fd, &fileStat) != 0 || !fileStat.st_size) {
+        LOGE("Could not open %s\n", filePath.c_str());
+
+        if (fd >= 0) {
+            ::close(fd);
+        }
+
+        return false;
+    }
+
+    void* mapped = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    ::close(fd);
+
+    if (mapped != MAP_FAILED) {
+        data = (const uint8_t*)mapped;
+        size = fileStat.st_size;
+    }
+#endif
+
+    if (data == nullptr) {
+        LOGE("Could not map %s\n", filePath.c_str());
+        close();
+        return false;
+    }
+
+    const DmNvBackupHeader* header = getHeader();
+
+    if (size < sizeof(DmNvBackupHeader) || header->magic != DM_NV_BACKUP_MAGIC || header->version != DM_NV_BACKUP_VERSION) {
+        LOGE("%s is not an NV backup\n", filePath.c_str());
+        close();
+        return false;
+    }
+
+    if (!header->indexOffset || header->indexOffset < header->headerSize ||
+        (uint64_t)header->indexOffset + (uint64_t)header->itemCount * sizeof(DmNvBackupIndexEntry) > size
+    ) {
+        LOGE("%s has no index, it was not finished\n", filePath.c_str());
+        close();
+        return false;
+    }
+
+    index = (const DmNvBackupIndexEntry*)(data + header->indexOffset);
+
+    // checked once here so lookups can trust the entries
+    for (size_t i = 0; i < header->itemCount; i++) {
+        if (index[i].size > DIAG_NV_ITEM_SIZE || index[i].offset < header->headerSize ||
+            (uint64_t)index[i].offset + index[i].size > header->indexOffset ||
+            (i && index[i].item < index[i - 1].item)
+        ) {
+            LOGE("%s has a corrupt index entry at %lu\n", filePath.c_str(), i);
+            close();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+* @brief close - Unmap the file
+*
+* @return void
+*/
+void DmNvBackupReader::close()
+{
+#ifdef _WIN32
+    if (data != nullptr) {
+        UnmapViewOfFile(data);
+    }
+
+    if (mappingHandle != nullptr) {
+        CloseHandle(mappingHandle);
+    }
+
+    if (fileHandle != INVALID_HANDLE_VALUE) {
+        CloseHandle(fileHandle);
+    }
+
+    fileHandle = INVALID_HANDLE_VALUE;
+    mappingHandle = nullptr;
+#else
+    if (data != nullptr) {
+        munmap((void*)data, size);
+    }
+#endif
+
+    data  = nullptr;
+    size  = 0;
+    index = nullptr;
+}
+
+/**
+* @brief getHeader
+*
+* @return const DmNvBackupHeader*
+*/
+const DmNvBackupHeader* DmNvBackupReader::getHeader()
+{
+    return (const DmNvBackupHeader*)data;
+}
+
+/**
+* @brief getItemCount
+*
+* @return size_t
+*/
+size_t DmNvBackupReader::getItemCount()
+{
+    return index != nullptr ? getHeader()->itemCount : 0;
+}
+
+/**
+* @brief getEntry - Get an index entry by position, entries are sorted by item id
+*
+* @param size_t i
+*
+* @return const DmNvBackupIndexEntry*
+*/
+const DmNvBackupIndexEntry* DmNvBackupReader::getEntry(size_t i)
+{
+    return i < getItemCount() ? &index[i] : nullptr;
+}
+
+/**
+* @brief find - Binary search the index for an item
+*
+* @param uint16_t item
+*
+* @return const DmNvBackupIndexEntry* - nullptr if the item is not in the backup
+*/
+const DmNvBackupIndexEntry* DmNvBackupReader::find(uint16_t item)
+{
+    const DmNvBackupIndexEntry* end = index + getItemCount();
+
+    const DmNvBackupIndexEntry* entry = std::lower_bound(index, end, item, [](const DmNvBackupIndexEntry& a, uint16_t item) {
+        return a.item < item;
+    });
+
+    return entry != end && entry->item == item ? entry : nullptr;
+}
+
+/**
+* @brief read - Get an item as it was read from the device
+*
+* @param const DmNvBackupIndexEntry* entry
+* @param DmNvBulkResult& result
+*
+* @return void
+*/
+void DmNvBackupReader::read(const DmNvBackupIndexEntry* entry, DmNvBulkResult& result)
+{
+    result = {};
+
+    result.item     = entry->item;
+    result.status   = (DmNvBulkStatus)entry->status;
+    result.command  = entry->command;
+    result.nvStatus = entry->nvStatus;
+
+    std::memcpy(result.data, data + entry->offset, entry->size);
+}
+
+/**
+* @brief toText - Write a backup out as the text hexdump the NV read worker writes
+*
+* @param std::string backupPath
+* @param std::string textPath
+*
+* @return bool
+*/
+bool DmNvBackup::toText(std::string backupPath, std::string textPath)
+{
+    DmNvBackupReader reader;
+    DmNvBulkResult result;
+    char tmp[8];
+
+    if (!reader.open(backupPath)) {
+        return false;
+    }
+
+    std::ofstream file(textPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open()) {
+        LOGE("Could not open %s\n", textPath.c_str());
+        return false;
+    }
+
+    for (size_t i = 0; i < reader.getItemCount(); i++) {
+        reader.read(reader.getEntry(i), result);
+
+        if (result.status != kDmNvBulkOk) {
+            file << "========\nError Reading Item " << result.item << "\n========\n";
+            continue;
+        }
+
+        file << "========\nItem " << result.item << "\n========\n";
+
+        // same layout as the Qt hexdump, 16 bytes and their characters per line
+        for (size_t line = 0; line < DIAG_NV_ITEM_SIZE; line += 16) {
+            for (size_t b = line; b < line + 16; b++) {
+                snprintf(tmp, sizeof(tmp), "%02x ", result.data[b]);
+                file << tmp << ((b % 8) == 7 ? " " : "");
+            }
+
+            file << "| ";
+
+            for (size_t b = line; b < line + 16; b++) {
+                file << hex_trans_dump[result.data[b]] << " ";
+            }
+
+            file << "\n";
+        }
+
+        file << "\n";
+    }
+
+    return file.good();
+}
+
+/**
+* @brief fromText - Convert a text hexdump written by the NV read worker
+*
+* @param std::string textPath
+* @param std::string backupPath
+* @param DmNvBackupDeviceInfo& device - Not in the text dump, given by the caller
+*
+* @return bool
+*/
+bool DmNvBackup::fromText(std::string textPath, std::string backupPath, const DmNvBackupDeviceInfo& device)
+{
+    DmNvBackupWriter writer;
+    DmNvBulkResult result = {};
+    std::string line;
+    size_t filled = 0;
+    bool inItem = false;
+    bool success = true;
+
+    std::ifstream file(textPath.c_str(), std::ios::in | std::ios::binary);
+
+    if (!file.is_open()) {
+        LOGE("Could not open %s\n", textPath.c_str());
+        return false;
+    }
+
+    if (!writer.open(backupPath, device)) {
+        return false;
+    }
+
+    while (std::getline(file, line)) {
+        if (line.size() && line[line.size() - 1] == '\r') {
+            line.erase(line.size() - 1);
+        }
+
+        if (line.compare(0, 5, "Item ") == 0 || line.compare(0, 19, "Error Reading Item ") == 0) {
+            if (inItem) {
+                success = writer.add(result) && success;
+            }
+
+            bool failed = line[0] == 'E';
+
+            result = {};
+            result.item = (uint16_t)std::strtoul(line.c_str() + (failed ? 19 : 5), nullptr, 10);
+            result.status = failed ? kDmNvBulkNoResponse : kDmNvBulkOk;
+            result.command = failed ? 0 : DIAG_NV_READ_F;
+
+            filled = 0;
+            inItem = true;
+            continue;
+        }
+
+        size_t separator = line.find('|');
+
+        if (!inItem || result.status != kDmNvBulkOk || separator == std::string::npos) {
+            continue;
+        }
+
+        std::istringstream hex(line.substr(0, separator));
+        std::string byte;
+
+        while (hex >> byte && filled < DIAG_NV_ITEM_SIZE) {
+            result.data[filled++] = (uint8_t)std::strtoul(byte.c_str(), nullptr, 16);
+        }
+    }
+
+    if (inItem) {
+        success = writer.add(result) && success;
+    }
+
+    return writer.close() && success;
+}
+
+/**
+* @brief fromRaw - Convert a dump of QcdmNvResponse structs written back to back
+*
+* @param std::string rawPath
+* @param std::string backupPath
+* @param DmNvBackupDeviceInfo& device - Not in the raw dump, given by the caller
+*
+* @return bool
+*/
+bool DmNvBackup::fromRaw(std::string rawPath, std::string backupPath, const DmNvBackupDeviceInfo& device)
+{
+    DmNvBackupWriter writer;
+    QcdmNvResponse record;
+    bool success = true;
+
+    std::ifstream file(rawPath.c_str(), std::ios::in | std::ios::binary);
+
+    if (!file.is_open()) {
+        LOGE("Could not open %s\n", rawPath.c_str());
+        return false;
+    }
+
+    if (!writer.open(backupPath, device)) {
+        return false;
+    }
+
+    while (file.read((char*)&record, sizeof(record))) {
+        DmNvBulkResult result = {};
+
+        result.item     = record.nvItem;
+        result.status   = kDmNvBulkOk;
+        result.command  = record.command;
+
+        std::memcpy(result.data, record.data, sizeof(result.data));
+
+        success = writer.add(result) && success;
+    }
+
+    return writer.close() && success;
+}
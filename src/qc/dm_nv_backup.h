@@ -0,0 +1,247 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_nv_backup.h
+* @class OpenPST::DmNvBackupWriter, OpenPST::DmNvBackupReader
+* @package OpenPST
+* @brief Indexed binary NV backup container
+*
+* Layout, all values little endian:
+*
+*   [DmNvBackupHeader][payload][payload]...[DmNvBackupIndexEntry x itemCount]
+*
+* Payloads are written as items are read, in whatever order they come. The
+* index is written last, sorted by item id, and the header is patched with its
+* offset, so a file with a zero indexOffset was never finished. Payloads have
+* their trailing zero bytes trimmed and items that failed to read have none,
+* only their index entry with the read status.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_NV_BACKUP_H_
+#define _QC_DM_NV_BACKUP_H_
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <ctime>
+#include "include/definitions.h"
+#include "qc/dm.h"
+#include "qc/dm_nv_bulk_reader.h"
+#include "util/hexdump.h"
+
+#define DM_NV_BACKUP_MAGIC              0x4B42564E // NVBK
+#define DM_NV_BACKUP_VERSION            1
+#define DM_NV_BACKUP_FIRMWARE_LENGTH    40
+
+namespace OpenPST {
+
+    PACKED(typedef struct {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t headerSize;    // sizeof(DmNvBackupHeader), payloads start here
+        uint32_t itemCount;
+        uint32_t indexOffset;   // 0 until the writer is closed
+        uint64_t created;       // unix time
+        uint32_t esn;
+        uint64_t meid;          // 56 bits
+        char     firmware[DM_NV_BACKUP_FIRMWARE_LENGTH]; // version directory, compile date and time, null padded
+    }) DmNvBackupHeader;
+
+    PACKED(typedef struct {
+        uint16_t item;
+        uint8_t  status;        // DmNvBulkStatus
+        uint8_t  command;       // response command code
+        uint16_t nvStatus;      // QcdmNvStatus
+        uint16_t size;          // payload bytes, the rest of the item is zero
+        uint32_t offset;        // payload offset from the start of the file
+    }) DmNvBackupIndexEntry;
+
+    struct DmNvBackupDeviceInfo {
+        uint32_t    esn;
+        uint64_t    meid;
+        std::string firmware;
+    };
+
+    /**
+    * @brief OpenPST::DmNvBackupWriter - Streams items into a new backup
+    */
+    class DmNvBackupWriter {
+        public:
+            /**
+            * @brief DmNvBackupWriter - Constructor
+            */
+            DmNvBackupWriter();
+
+            /**
+            * @brief ~DmNvBackupWriter - Deconstructor, closes the file if still open
+            */
+            ~DmNvBackupWriter();
+
+            /**
+            * @brief open - Create the file and write a header with no index
+            *
+            * @param std::string filePath
+            * @param DmNvBackupDeviceInfo& device
+            *
+            * @return bool
+            */
+            bool open(std::string filePath, const DmNvBackupDeviceInfo& device);
+
+            /**
+            * @brief add - Append an item read result
+            *
+            * @param DmNvBulkResult& result
+            *
+            * @return bool
+            */
+            bool add(const DmNvBulkResult& result);
+
+            /**
+            * @brief close - Write the sorted index and patch the header
+            *
+            * @return bool
+            */
+            bool close();
+
+            /**
+            * @brief isOpen
+            *
+            * @return bool
+            */
+            bool isOpen();
+
+        private:
+            std::ofstream file;
+            DmNvBackupHeader header;
+            std::vector<DmNvBackupIndexEntry> index;
+            uint32_t offset;
+    };
+
+    /**
+    * @brief OpenPST::DmNvBackupReader - Memory maps a backup for lookups by item id
+    */
+    class DmNvBackupReader {
+        public:
+            /**
+            * @brief DmNvBackupReader - Constructor
+            */
+            DmNvBackupReader();
+
+            /**
+            * @brief ~DmNvBackupReader - Deconstructor, unmaps the file
+            */
+            ~DmNvBackupReader();
+
+            /**
+            * @brief open - Map a backup and validate its header and index
+            *
+            * @param std::string filePath
+            *
+            * @return bool
+            */
+            bool open(std::string filePath);
+
+            /**
+            * @brief close - Unmap the file
+            *
+            * @return void
+            */
+            void close();
+
+            /**
+            * @brief getHeader
+            *
+            * @return const DmNvBackupHeader*
+            */
+            const DmNvBackupHeader* getHeader();
+
+            /**
+            * @brief getItemCount
+            *
+            * @return size_t
+            */
+            size_t getItemCount();
+
+            /**
+            * @brief getEntry - Get an index entry by position, entries are sorted by item id
+            *
+            * @param size_t i
+            *
+            * @return const DmNvBackupIndexEntry*
+            */
+            const DmNvBackupIndexEntry* getEntry(size_t i);
+
+            /**
+            * @brief find - Binary search the index for an item
+            *
+            * @param uint16_t item
+            *
+            * @return const DmNvBackupIndexEntry* - nullptr if the item is not in the backup
+            */
+            const DmNvBackupIndexEntry* find(uint16_t item);
+
+            /**
+            * @brief read - Get an item as it was read from the device
+            *
+            * @param const DmNvBackupIndexEntry* entry
+            * @param DmNvBulkResult& result
+            *
+            * @return void
+            */
+            void read(const DmNvBackupIndexEntry* entry, DmNvBulkResult& result);
+
+        private:
+            const uint8_t* data;
+            size_t size;
+            const DmNvBackupIndexEntry* index;
+#ifdef _WIN32
+            void* fileHandle;
+            void* mappingHandle;
+#endif
+    };
+
+    /**
+    * @brief OpenPST::DmNvBackup - Conversion to and from the text and raw binary NV dumps
+    */
+    class DmNvBackup {
+        public:
+            /**
+            * @brief toText - Write a backup out as the text hexdump the NV read worker writes
+            *
+            * @param std::string backupPath
+            * @param std::string textPath
+            *
+            * @return bool
+            */
+            static bool toText(std::string backupPath, std::string textPath);
+
+            /**
+            * @brief fromText - Convert a text hexdump written by the NV read worker
+            *
+            * @param std::string textPath
+            * @param std::string backupPath
+            * @param DmNvBackupDeviceInfo& device - Not in the text dump, given by the caller
+            *
+            * @return bool
+            */
+            static bool fromText(std::string textPath, std::string backupPath, const DmNvBackupDeviceInfo& device);
+
+            /**
+            * @brief fromRaw - Convert a dump of QcdmNvResponse structs written back to back
+            *
+            * @param std::string rawPath
+            * @param std::string backupPath
+            * @param DmNvBackupDeviceInfo& device - Not in the raw dump, given by the caller
+            *
+            * @return bool
+            */
+            static bool fromRaw(std::string rawPath, std::string backupPath, const DmNvBackupDeviceInfo& device);
+    };
+}
+
+#endif // _QC_DM_NV_BACKUP_H_
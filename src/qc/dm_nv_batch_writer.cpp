@@ -0,0 +1,226 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_nv_batch_writer.cpp
+* @class OpenPST::DmNvBatchWriter
+* @package OpenPST
+* @brief Pipelined NV item writes with read back verification
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "dm_nv_batch_writer.h"
+
+using namespace OpenPST;
+
+/**
+* @brief DmNvBatchWriter - Constructor
+*
+* @param QcdmSerial& port
+* @param size_t window
+*/
+DmNvBatchWriter::DmNvBatchWriter(QcdmSerial& port, size_t window) :
+    port(port),
+    pipeline(port, window)
+{
+
+}
+
+/**
+* @brief ~DmNvBatchWriter - Deconstructor
+*/
+DmNvBatchWriter::~DmNvBatchWriter()
+{
+
+}
+
+/**
+* @brief write - Write and verify a batch of items
+*
+* @param std::vector<DmNvWriteItem>& items
+* @param bool rollback
+* @return std::vector<DmNvWriteResult>
+*/
+std::vector<DmNvWriteResult> DmNvBatchWriter::write(const std::vector<DmNvWriteItem>& items, bool rollback)
+{
+    std::vector<DmNvWriteResult> results(items.size(), DmNvWriteResult());
+    std::vector<DmNvBulkResult> before;
+    std::vector<QcdmNvRequest> requests;
+    DmNvBulkResult response;
+    bool failed = false;
+
+    for (size_t i = 0; i < items.size(); i++) {
+        results[i].item             = items[i].item;
+        results[i].status           = kDmNvWriteOk;
+        results[i].response.item    = items[i].item;
+        results[i].rolledBack       = false;
+    }
+
+    if (rollback) {
+        snapshot(items, before);
+    }
+
+    requests.reserve(items.size() * 2);
+
+    for (auto &item : items) {
+        QcdmNvRequest packet = {};
+
+        packet.command = DIAG_NV_WRITE_F;
+        packet.nvItem  = item.item;
+
+        std::memcpy(packet.data, item.data, item.size < DIAG_NV_ITEM_SIZE ? item.size : DIAG_NV_ITEM_SIZE);
+
+        requests.push_back(packet);
+
+        // the device answers in order, so the read back sees the write
+        std::memset(packet.data, 0x00, sizeof(packet.data));
+        packet.command = DIAG_NV_READ_F;
+
+        requests.push_back(packet);
+    }
+
+    pipeline.start(requests);
+
+    for (size_t i = 0; pipeline.next(response); i++) {
+        DmNvWriteResult& result = results[i / 2];
+        const DmNvWriteItem& item = items[i / 2];
+
+        if (i % 2 == 0) {
+            result.response = response;
+
+            if (response.status != kDmNvBulkOk) {
+                result.status = kDmNvWriteFailed;
+            }
+
+            continue;
+        }
+
+        if (result.status != kDmNvWriteOk) {
+            // nothing to verify
+            continue;
+        }
+
+        if (response.status != kDmNvBulkOk) {
+            result.status   = kDmNvWriteVerifyFailed;
+            result.response = response;
+        } else if (std::memcmp(response.data, item.data, item.size < DIAG_NV_ITEM_SIZE ? item.size : DIAG_NV_ITEM_SIZE) != 0) {
+            result.status   = kDmNvWriteMismatch;
+            result.response = response;
+        }
+    }
+
+    for (auto &result : results) {
+        if (result.status != kDmNvWriteOk) {
+            failed = true;
+            break;
+        }
+    }
+
+    if (rollback && failed) {
+        restore(before, results);
+    }
+
+    return results;
+}
+
+/**
+* @brief getStatusString - Describe a result status
+*
+* @param DmNvWriteResult& result
+* @return std::string
+*/
+std::string DmNvBatchWriter::getStatusString(const DmNvWriteResult& result)
+{
+    std::string status;
+
+    switch (result.status) {
+        case kDmNvWriteOk:
+            status = "OK";
+            break;
+        case kDmNvWriteFailed:
+            status = "Write failed, " + DmNvBulkReader::getStatusString(result.response);
+            break;
+        case kDmNvWriteVerifyFailed:
+            status = "Read back failed, " + DmNvBulkReader::getStatusString(result.response);
+            break;
+        case kDmNvWriteMismatch:
+            status = "Read back does not match";
+            break;
+        default:
+            status = "Unknown";
+            break;
+    }
+
+    if (result.rolledBack) {
+        status += " (rolled back)";
+    }
+
+    return status;
+}
+
+/**
+* @brief snapshot - Read the current value of every item in the batch
+*
+* @param std::vector<DmNvWriteItem>& items
+* @param std::vector<DmNvBulkResult>& snapshot
+* @return void
+*/
+void DmNvBatchWriter::snapshot(const std::vector<DmNvWriteItem>& items, std::vector<DmNvBulkResult>& snapshot)
+{
+    std::vector<uint16_t> ids;
+    DmNvBulkResult response;
+
+    ids.reserve(items.size());
+
+    for (auto &item : items) {
+        ids.push_back(item.item);
+    }
+
+    snapshot.clear();
+    snapshot.reserve(items.size());
+
+    pipeline.start(ids);
+
+    while (pipeline.next(response)) {
+        snapshot.push_back(response);
+    }
+}
+
+/**
+* @brief restore - Write back the snapshot of every item that was sent
+*
+* @param std::vector<DmNvBulkResult>& snapshot
+* @param std::vector<DmNvWriteResult>& results
+* @return void
+*/
+void DmNvBatchWriter::restore(const std::vector<DmNvBulkResult>& snapshot, std::vector<DmNvWriteResult>& results)
+{
+    std::vector<QcdmNvRequest> requests;
+    std::vector<size_t> indexes;
+    DmNvBulkResult response;
+
+    for (size_t i = 0; i < snapshot.size(); i++) {
+        if (snapshot[i].status != kDmNvBulkOk) {
+            // inactive before the batch, there is no value to put back
+            continue;
+        }
+
+        QcdmNvRequest packet = {};
+
+        packet.command = DIAG_NV_WRITE_F;
+        packet.nvItem  = snapshot[i].item;
+
+        std::memcpy(packet.data, snapshot[i].data, sizeof(packet.data));
+
+        requests.push_back(packet);
+        indexes.push_back(i);
+    }
+
+    pipeline.start(requests);
+
+    for (size_t i = 0; pipeline.next(response); i++) {
+        if (response.status == kDmNvBulkOk) {
+            results[indexes[i]].rolledBack = true;
+        }
+    }
+}
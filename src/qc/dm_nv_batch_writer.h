@@ -0,0 +1,111 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_nv_batch_writer.h
+* @class OpenPST::DmNvBatchWriter
+* @package OpenPST
+* @brief Pipelined NV item writes with read back verification
+*
+* Each item is written with DIAG_NV_WRITE_F followed by a DIAG_NV_READ_F of
+* the same item, and both go through the same DmNvBulkReader window so a batch
+* costs about as many round trips as the window allows rather than two per
+* item. With rollback enabled the items are read first, and if any item of
+* the batch fails every item that was sent is written back to that snapshot.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_NV_BATCH_WRITER_H_
+#define _QC_DM_NV_BATCH_WRITER_H_
+
+#include <vector>
+#include "include/definitions.h"
+#include "qc/dm.h"
+#include "qc/dm_nv_bulk_reader.h"
+#include "serial/qcdm_serial.h"
+
+namespace OpenPST {
+
+    enum DmNvWriteStatus {
+        kDmNvWriteOk = 0,
+        kDmNvWriteFailed,           // the write was rejected or returned an NV error, see response
+        kDmNvWriteVerifyFailed,     // the read back could not be done, see response
+        kDmNvWriteMismatch          // the read back did not match what was written
+    };
+
+    struct DmNvWriteItem {
+        uint16_t    item;
+        uint8_t     data[DIAG_NV_ITEM_SIZE];
+        size_t      size;           // bytes of data to write and verify, at most DIAG_NV_ITEM_SIZE
+    };
+
+    struct DmNvWriteResult {
+        uint16_t        item;
+        DmNvWriteStatus status;
+        DmNvBulkResult  response;   // the write response, or the read back when verification failed
+        bool            rolledBack; // restored to the snapshot taken before the batch
+    };
+
+    /**
+    * @brief OpenPST::DmNvBatchWriter
+    */
+    class DmNvBatchWriter {
+        public:
+            /**
+            * @brief DmNvBatchWriter - Constructor
+            *
+            * @param QcdmSerial& port
+            * @param size_t window - Requests kept in flight, writes and read backs both count
+            */
+            DmNvBatchWriter(QcdmSerial& port, size_t window = DM_NV_BULK_DEFAULT_WINDOW);
+
+            /**
+            * @brief ~DmNvBatchWriter - Deconstructor
+            */
+            ~DmNvBatchWriter();
+
+            /**
+            * @brief write - Write and verify a batch of items
+            *
+            * Items that were inactive before the batch have nothing to roll back
+            * to and keep the value written. Nothing here throws.
+            *
+            * @param std::vector<DmNvWriteItem>& items
+            * @param bool rollback - Snapshot the items first and restore them if any item fails
+            * @return std::vector<DmNvWriteResult> - One result per item, in order
+            */
+            std::vector<DmNvWriteResult> write(const std::vector<DmNvWriteItem>& items, bool rollback = false);
+
+            /**
+            * @brief getStatusString - Describe a result status
+            *
+            * @param DmNvWriteResult& result
+            * @return std::string
+            */
+            static std::string getStatusString(const DmNvWriteResult& result);
+
+        private:
+            QcdmSerial& port;
+            DmNvBulkReader pipeline;
+
+            /**
+            * @brief snapshot - Read the current value of every item in the batch
+            *
+            * @param std::vector<DmNvWriteItem>& items
+            * @param std::vector<DmNvBulkResult>& snapshot
+            * @return void
+            */
+            void snapshot(const std::vector<DmNvWriteItem>& items, std::vector<DmNvBulkResult>& snapshot);
+
+            /**
+            * @brief restore - Write back the snapshot of every item that was sent
+            *
+            * @param std::vector<DmNvBulkResult>& snapshot
+            * @param std::vector<DmNvWriteResult>& results
+            * @return void
+            */
+            void restore(const std::vector<DmNvBulkResult>& snapshot, std::vector<DmNvWriteResult>& results);
+    };
+}
+
+#endif // _QC_DM_NV_BATCH_WRITER_H_
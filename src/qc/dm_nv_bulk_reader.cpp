@@ -0,0 +1,361 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_nv_bulk_reader.cpp
+* @class OpenPST::DmNvBulkReader
+* @package OpenPST
+* @brief Pipelined NV item reads over diagnostic monitor
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "dm_nv_bulk_reader.h"
+
+using namespace OpenPST;
+
+/**
+* @brief DmNvBulkReader - Constructor
+*
+* @param QcdmSerial& port
+* @param size_t window
+*/
+DmNvBulkReader::DmNvBulkReader(QcdmSerial& port, size_t window) :
+    port(port),
+    window(window ? window : 1),
+    requestFrame(sizeof(QcdmNvRequest)),
+    sent(0),
+    returned(0),
+    outstanding(0),
+    failed(false)
+{
+
+}
+
+/**
+* @brief ~DmNvBulkReader - Deconstructor
+*/
+DmNvBulkReader::~DmNvBulkReader()
+{
+    drain();
+}
+
+/**
+* @brief start - Begin reading items, dropping anything left from a previous start
+*
+* @param std::vector<uint16_t>& items
+* @return void
+*/
+void DmNvBulkReader::start(const std::vector<uint16_t>& items)
+{
+    std::vector<QcdmNvRequest> requests(items.size(), QcdmNvRequest());
+
+    for (size_t i = 0; i < items.size(); i++) {
+        requests[i].command = DIAG_NV_READ_F;
+        requests[i].nvItem  = items[i];
+    }
+
+    start(requests);
+}
+
+/**
+* @brief start - Begin sending a mix of DIAG_NV_READ_F and DIAG_NV_WRITE_F
+* requests, dropping anything left from a previous start
+*
+* @param std::vector<QcdmNvRequest>& requests
+* @return void
+*/
+void DmNvBulkReader::start(const std::vector<QcdmNvRequest>& requests)
+{
+    drain();
+
+    this->requests = requests;
+
+    results.assign(requests.size(), DmNvBulkResult());
+    resolved.assign(requests.size(), false);
+
+    for (size_t i = 0; i < requests.size(); i++) {
+        results[i].item = requests[i].nvItem;
+
+        // writes here do not go through writeNV, so the port can not keep its cache current
+        if (requests[i].command == DIAG_NV_WRITE_F) {
+            port.invalidateNvCache(requests[i].nvItem);
+        }
+    }
+
+    inFlight.clear();
+
+    sent        = 0;
+    returned    = 0;
+    outstanding = 0;
+    failed      = false;
+}
+
+/**
+* @brief next - Get the result of the next item in request order,
+* sending more requests as responses come in
+*
+* @param DmNvBulkResult& result
+* @return bool - false when every item has been returned
+*/
+bool DmNvBulkReader::next(DmNvBulkResult& result)
+{
+    if (returned >= requests.size()) {
+        return false;
+    }
+
+    while (!resolved[returned]) {
+        if (failed) {
+            expire(kDmNvBulkIOError);
+            break;
+        }
+
+        try {
+            fill();
+
+            if (!receive()) {
+                // anything still outstanding is lost, later items get sent fresh
+                expire(kDmNvBulkNoResponse);
+            }
+        } catch (std::exception& e) {
+            failed = true;
+        }
+    }
+
+    result = results[returned++];
+
+    return true;
+}
+
+/**
+* @brief drain - Wait out the responses to requests already sent so
+* they are not read as the response to the next command on the port
+*
+* @return void
+*/
+void DmNvBulkReader::drain()
+{
+    while (outstanding && !failed) {
+        try {
+            if (!receive()) {
+                expire(kDmNvBulkNoResponse);
+            }
+        } catch (std::exception& e) {
+            failed = true;
+        }
+    }
+}
+
+/**
+* @brief getWindow
+*
+* @return size_t
+*/
+size_t DmNvBulkReader::getWindow()
+{
+    return window;
+}
+
+/**
+* @brief getStatusString - Describe a result status
+*
+* @param DmNvBulkResult& result
+* @return std::string
+*/
+std::string DmNvBulkReader::getStatusString(const DmNvBulkResult& result)
+{
+    char tmp[64];
+
+    switch (result.status) {
+        case kDmNvBulkOk:
+            return "OK";
+        case kDmNvBulkNvError:
+            switch (result.nvStatus) {
+                case kQcdmNvStatusBusy:         return "NV busy";
+                case kQcdmNvStatusBadCommand:   return "NV bad command";
+                case kQcdmNvStatusFull:         return "NV memory full";
+                case kQcdmNvStatusFail:         return "NV failure";
+                case kQcdmNvStatusInactive:     return "Item inactive";
+                case kQcdmNvStatusBadParam:     return "NV bad parameter";
+                case kQcdmNvStatusReadOnly:     return "Item is read only";
+                case kQcdmNvStatusBadType:      return "Item not defined for this target";
+                case kQcdmNvStatusNoMemory:     return "NV out of memory";
+                case kQcdmNvStatusNotAllocated: return "Item not allocated";
+            }
+
+            snprintf(tmp, sizeof(tmp), "NV status 0x%04X", result.nvStatus);
+            return tmp;
+        case kDmNvBulkRejected:
+            switch (result.command) {
+                case DIAG_BAD_CMD_F:        return "Invalid command";
+                case DIAG_BAD_PARM_F:       return "Invalid parameter";
+                case DIAG_BAD_LEN_F:        return "Invalid packet length";
+                case DIAG_BAD_MODE_F:       return "Invalid mode";
+                case DIAG_BAD_SPC_MODE_F:   return "SPC locked";
+                case DIAG_BAD_SEC_MODE_F:   return "Security locked";
+            }
+
+            snprintf(tmp, sizeof(tmp), "Rejected with response 0x%02X", result.command);
+            return tmp;
+        case kDmNvBulkNoResponse:
+            return "Device did not respond";
+        case kDmNvBulkIOError:
+            return "Port error";
+    }
+
+    return "Unknown";
+}
+
+/**
+* @brief fill - Send requests until the window is full, in a single write
+*/
+void DmNvBulkReader::fill()
+{
+    std::vector<uint8_t> out;
+
+    while (sent < requests.size() && outstanding < window) {
+        const QcdmNvRequest& packet = requests[sent];
+
+        requestFrame.set(0, reinterpret_cast<const uint8_t*>(&packet), sizeof(packet));
+
+        out.insert(out.end(), requestFrame.getFrame(), requestFrame.getFrame() + requestFrame.getFrameSize());
+
+        inFlight[(packet.command << 16) | packet.nvItem].push_back(sent);
+
+        sent++;
+        outstanding++;
+    }
+
+    if (out.size()) {
+        port.write(&out[0], out.size(), false);
+    }
+}
+
+/**
+* @brief receive - Read whatever the device has sent and dispatch complete frames
+*
+* @return bool - false if nothing arrived before the timeout
+*/
+bool DmNvBulkReader::receive()
+{
+    return port.receiveResponses([this](const uint8_t* packet, size_t size) {
+        dispatch(packet, size);
+    });
+}
+
+/**
+* @brief dispatch - Match a received packet to its request
+*
+* @param uint8_t* data - Unescaped packet without its CRC
+* @param size_t size
+*/
+void DmNvBulkReader::dispatch(const uint8_t* data, size_t size)
+{
+    uint8_t command = data[0];
+
+    if (command == DIAG_NV_READ_F || command == DIAG_NV_WRITE_F) {
+        if (size < sizeof(QcdmNvResponse) - DIAG_NV_ITEM_SIZE) {
+            return;
+        }
+
+        DmNvBulkResult* result = resolve(command, data[1] | (data[2] << 8), kDmNvBulkOk, command);
+
+        if (result == nullptr) {
+            // late response to a request that already timed out, or an item we never asked for
+            return;
+        }
+
+        size_t dataSize = size - (sizeof(QcdmNvResponse) - DIAG_NV_ITEM_SIZE);
+
+        std::memcpy(result->data, &data[3], dataSize < DIAG_NV_ITEM_SIZE ? dataSize : DIAG_NV_ITEM_SIZE);
+
+        if (size >= sizeof(QcdmNvResponse) + sizeof(uint16_t)) {
+            result->nvStatus = data[sizeof(QcdmNvResponse)] | (data[sizeof(QcdmNvResponse) + 1] << 8);
+        }
+
+        if (result->nvStatus != kQcdmNvStatusDone) {
+            result->status = kDmNvBulkNvError;
+        }
+
+        return;
+    }
+
+    if (command != DIAG_BAD_CMD_F && command != DIAG_BAD_PARM_F && command != DIAG_BAD_LEN_F &&
+        command != DIAG_BAD_MODE_F && command != DIAG_BAD_SPC_MODE_F && command != DIAG_BAD_SEC_MODE_F
+    ) {
+        // logs, events and anything else the device sends on its own
+        return;
+    }
+
+    if (size >= 4 && (data[1] == DIAG_NV_READ_F || data[1] == DIAG_NV_WRITE_F)) {
+        // the error response echoes the request
+        resolve(data[1], data[2] | (data[3] << 8), kDmNvBulkRejected, command);
+        return;
+    }
+
+    // no echo, the device answers in order so it belongs to the oldest request
+    size_t oldest = requests.size();
+
+    for (auto &it : inFlight) {
+        if (it.second.front() < oldest) {
+            oldest = it.second.front();
+        }
+    }
+
+    if (oldest < requests.size()) {
+        resolve(requests[oldest].command, requests[oldest].nvItem, kDmNvBulkRejected, command);
+    }
+}
+
+/**
+* @brief resolve - Complete the oldest in flight request for a command and item
+*
+* @return DmNvBulkResult* - nullptr if the item is not in flight
+*/
+DmNvBulkResult* DmNvBulkReader::resolve(uint8_t requestCommand, uint16_t item, DmNvBulkStatus status, uint8_t command)
+{
+    auto it = inFlight.find((requestCommand << 16) | item);
+
+    if (it == inFlight.end()) {
+        return nullptr;
+    }
+
+    size_t index = it->second.front();
+
+    it->second.pop_front();
+
+    if (!it->second.size()) {
+        inFlight.erase(it);
+    }
+
+    outstanding--;
+
+    resolved[index]         = true;
+    results[index].status   = status;
+    results[index].command  = command;
+
+    return &results[index];
+}
+
+/**
+* @brief expire - Fail every in flight request, and everything not yet sent if the port failed
+*/
+void DmNvBulkReader::expire(DmNvBulkStatus status)
+{
+    for (auto &it : inFlight) {
+        for (auto index : it.second) {
+            resolved[index]         = true;
+            results[index].status   = status;
+        }
+    }
+
+    inFlight.clear();
+
+    outstanding = 0;
+
+    if (status == kDmNvBulkIOError) {
+        for (; sent < requests.size(); sent++) {
+            resolved[sent]          = true;
+            results[sent].status    = status;
+        }
+    }
+}
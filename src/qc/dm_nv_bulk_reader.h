@@ -0,0 +1,173 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_nv_bulk_reader.h
+* @class OpenPST::DmNvBulkReader
+* @package OpenPST
+* @brief Pipelined NV item reads over diagnostic monitor
+*
+* Keeps up to window DIAG_NV_READ_F requests in flight instead of waiting on
+* each response before sending the next request. Requests are HDLC framed and
+* written together, and each response is matched back to its request by the
+* command and item id the device echoes in it, so async packets the device
+* interleaves are skipped. Results come back out in request order with a per
+* item status, nothing here throws.
+*
+* DIAG_NV_WRITE_F requests can be mixed in, the device handles requests in the
+* order they were sent so a read queued after a write of the same item reads
+* the new value.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_NV_BULK_READER_H_
+#define _QC_DM_NV_BULK_READER_H_
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <chrono>
+#include "include/definitions.h"
+#include "qc/dm.h"
+#include "qc/hdlc.h"
+#include "qc/hdlc_frame_template.h"
+#include "serial/qcdm_serial.h"
+
+/**
+* Requests kept in flight when no window is given
+*/
+#define DM_NV_BULK_DEFAULT_WINDOW 8
+
+namespace OpenPST {
+
+    enum DmNvBulkStatus {
+        kDmNvBulkOk = 0,
+        kDmNvBulkNvError,       // the device answered with an NV status other than done, see nvStatus
+        kDmNvBulkRejected,      // the device rejected the request, see command for the error response code
+        kDmNvBulkNoResponse,    // no response before the timeout
+        kDmNvBulkIOError        // the port failed, nothing more was read
+    };
+
+    struct DmNvBulkResult {
+        uint16_t        item;
+        DmNvBulkStatus  status;
+        uint16_t        nvStatus;   // QcdmNvStatus when status is kDmNvBulkOk or kDmNvBulkNvError
+        uint8_t         command;    // response command code
+        uint8_t         data[DIAG_NV_ITEM_SIZE];
+    };
+
+    /**
+    * @brief OpenPST::DmNvBulkReader
+    */
+    class DmNvBulkReader {
+        public:
+            /**
+            * @brief DmNvBulkReader - Constructor
+            *
+            * @param QcdmSerial& port
+            * @param size_t window - Requests kept in flight, 1 reads one item at a time
+            */
+            DmNvBulkReader(QcdmSerial& port, size_t window = DM_NV_BULK_DEFAULT_WINDOW);
+
+            /**
+            * @brief ~DmNvBulkReader - Deconstructor, drains any requests still in flight
+            */
+            ~DmNvBulkReader();
+
+            /**
+            * @brief start - Begin reading items, dropping anything left from a previous start
+            *
+            * @param std::vector<uint16_t>& items
+            * @return void
+            */
+            void start(const std::vector<uint16_t>& items);
+
+            /**
+            * @brief start - Begin sending a mix of DIAG_NV_READ_F and DIAG_NV_WRITE_F
+            * requests, dropping anything left from a previous start
+            *
+            * @param std::vector<QcdmNvRequest>& requests
+            * @return void
+            */
+            void start(const std::vector<QcdmNvRequest>& requests);
+
+            /**
+            * @brief next - Get the result of the next item in request order,
+            * sending more requests as responses come in
+            *
+            * @param DmNvBulkResult& result
+            * @return bool - false when every item has been returned
+            */
+            bool next(DmNvBulkResult& result);
+
+            /**
+            * @brief drain - Wait out the responses to requests already sent so
+            * they are not read as the response to the next command on the port
+            *
+            * @return void
+            */
+            void drain();
+
+            /**
+            * @brief getWindow
+            *
+            * @return size_t
+            */
+            size_t getWindow();
+
+            /**
+            * @brief getStatusString - Describe a result status
+            *
+            * @param DmNvBulkResult& result
+            * @return std::string
+            */
+            static std::string getStatusString(const DmNvBulkResult& result);
+
+        private:
+            QcdmSerial& port;
+            size_t window;
+            std::vector<QcdmNvRequest> requests;
+            std::vector<DmNvBulkResult> results;
+            std::vector<bool> resolved;
+            std::map<uint32_t, std::deque<size_t>> inFlight;   // command and item id to request indexes, oldest first
+            HdlcFrameTemplate requestFrame;                     // consecutive requests mostly differ in the item id
+            size_t sent;
+            size_t returned;
+            size_t outstanding;
+            bool failed;
+
+            /**
+            * @brief fill - Send requests until the window is full, in a single write
+            */
+            void fill();
+
+            /**
+            * @brief receive - Read whatever the device has sent and dispatch complete frames
+            *
+            * @return bool - false if nothing arrived before the timeout
+            */
+            bool receive();
+
+            /**
+            * @brief dispatch - Match a received packet to its request
+            *
+            * @param uint8_t* data - Unescaped packet without its CRC
+            * @param size_t size
+            */
+            void dispatch(const uint8_t* data, size_t size);
+
+            /**
+            * @brief resolve - Complete the oldest in flight request for a command and item
+            *
+            * @return DmNvBulkResult* - nullptr if the item is not in flight
+            */
+            DmNvBulkResult* resolve(uint8_t requestCommand, uint16_t item, DmNvBulkStatus status, uint8_t command);
+
+            /**
+            * @brief expire - Fail every in flight request, and everything not yet sent if the port failed
+            */
+            void expire(DmNvBulkStatus status);
+    };
+}
+
+#endif // _QC_DM_NV_BULK_READER_H_
@@ -0,0 +1,152 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_nv_catalogue.cpp
+* @class OpenPST::DmNvCatalogue
+* @package OpenPST
+* @brief Static table of the known NV items, built from dm_nv_items.def
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "dm_nv_catalogue.h"
+#include "dm_nv_catalogue_hash.h"
+
+using namespace OpenPST;
+
+// VS2013 has no constexpr, it only gets the item count checked
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define DM_NV_CATALOGUE_CONSTEXPR const
+#else
+#define DM_NV_CATALOGUE_CONSTEXPR constexpr
+#define DM_NV_CATALOGUE_CHECKSUM
+#endif
+
+static DM_NV_CATALOGUE_CONSTEXPR DmNvItemInfo dmNvCatalogueItems[] = {
+#define NV_ITEM(name, id) { id, #name, DIAG_NV_ITEM_SIZE, kDmNvItemTypeRaw },
+#define NV_ITEM_EX(name, id, size, type) { id, #name, size, type },
+#include "qc/dm_nv_items.def"
+#undef NV_ITEM
+#undef NV_ITEM_EX
+};
+
+static const size_t dmNvCatalogueCount = sizeof(dmNvCatalogueItems) / sizeof(dmNvCatalogueItems[0]);
+
+static_assert(sizeof(dmNvCatalogueItems) / sizeof(dmNvCatalogueItems[0]) == DM_NV_CATALOGUE_HASH_ITEMS,
+    "dm_nv_catalogue_hash.h is out of date, run scripts/nv_catalogue.py");
+
+#ifdef DM_NV_CATALOGUE_CHECKSUM
+/**
+* @brief checksumItem - FNV-1a of an item name, seeded with its id
+*/
+static constexpr uint32_t checksumItem(const char* name, uint32_t hash)
+{
+    return *name ? checksumItem(name + 1, (hash ^ (uint8_t)*name) * 16777619u) : hash;
+}
+
+/**
+* @brief checksumItems - Combine the items pairwise so the recursion stays shallow,
+*                        must match scripts/nv_catalogue.py
+*/
+static constexpr uint32_t checksumItems(size_t low, size_t high)
+{
+    return high - low == 1 ? checksumItem(dmNvCatalogueItems[low].name, 2166136261u ^ dmNvCatalogueItems[low].id) :
+        (checksumItems(low, low + (high - low) / 2) * 16777619u) ^ checksumItems(low + (high - low) / 2, high);
+}
+
+// a renamed, renumbered or reordered item leaves the count alone but breaks the hash tables
+static_assert(checksumItems(0, DM_NV_CATALOGUE_HASH_ITEMS) == DM_NV_CATALOGUE_HASH_CHECKSUM,
+    "dm_nv_catalogue_hash.h is out of date, run scripts/nv_catalogue.py");
+#endif
+
+/**
+* @brief getCount
+*
+* @return size_t
+*/
+size_t DmNvCatalogue::getCount()
+{
+    return dmNvCatalogueCount;
+}
+
+/**
+* @brief getItem - Get an item by its position, items are sorted by id
+*
+* @param size_t index
+* @return const DmNvItemInfo* - nullptr when out of range
+*/
+const DmNvItemInfo* DmNvCatalogue::getItem(size_t index)
+{
+    return index < dmNvCatalogueCount ? &dmNvCatalogueItems[index] : nullptr;
+}
+
+/**
+* @brief findById - Binary search for an item id
+*
+* @param uint16_t id
+* @return const DmNvItemInfo* - nullptr for an unknown item
+*/
+const DmNvItemInfo* DmNvCatalogue::findById(uint16_t id)
+{
+    size_t low = 0;
+    size_t high = dmNvCatalogueCount;
+
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+
+        if (dmNvCatalogueItems[mid].id < id) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return low < dmNvCatalogueCount && dmNvCatalogueItems[low].id == id ? &dmNvCatalogueItems[low] : nullptr;
+}
+
+/**
+* @brief findByName - Perfect hash lookup of an item name
+*
+* @param const char* name
+* @return const DmNvItemInfo* - nullptr for an unknown name
+*/
+const DmNvItemInfo* DmNvCatalogue::findByName(const char* name)
+{
+    uint16_t displacement = dmNvCatalogueHashDisplacements[hashName(name, 0) % DM_NV_CATALOGUE_HASH_BUCKETS];
+    const DmNvItemInfo* item = &dmNvCatalogueItems[dmNvCatalogueHashSlots[hashName(name, displacement) % DM_NV_CATALOGUE_HASH_ITEMS]];
+
+    // any string hashes to some slot, only a match is a hit
+    return strcmp(item->name, name) == 0 ? item : nullptr;
+}
+
+/**
+* @brief getName - Name of an item id
+*
+* @param uint16_t id
+* @return const char* - "Unknown" for an unknown item
+*/
+const char* DmNvCatalogue::getName(uint16_t id)
+{
+    const DmNvItemInfo* item = findById(id);
+
+    return item != nullptr ? item->name : "Unknown";
+}
+
+/**
+* @brief hashName - FNV-1a with the seed mixed into the offset basis
+*
+* @param const char* name
+* @param uint32_t seed
+* @return uint32_t
+*/
+uint32_t DmNvCatalogue::hashName(const char* name, uint32_t seed)
+{
+    uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+
+    while (*name) {
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619u;
+    }
+
+    return hash ^ (hash >> 15);
+}
@@ -0,0 +1,95 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_nv_catalogue.h
+* @class OpenPST::DmNvCatalogue
+* @package OpenPST
+* @brief Static table of the known NV items, built from dm_nv_items.def
+*
+* The table is sorted by id, so it doubles as the id to name index. Names are
+* looked up through a minimal perfect hash generated by scripts/nv_catalogue.py.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_NV_CATALOGUE_H_
+#define _QC_DM_NV_CATALOGUE_H_
+
+#include <string.h>
+#include "include/definitions.h"
+#include "qc/dm.h"
+
+namespace OpenPST {
+
+    enum DmNvItemType : uint8_t {
+        kDmNvItemTypeRaw    = 0,
+        kDmNvItemTypeUint8  = 1,
+        kDmNvItemTypeUint16 = 2,
+        kDmNvItemTypeUint32 = 3,
+        kDmNvItemTypeUint64 = 4,
+        kDmNvItemTypeString = 5
+    };
+
+    struct DmNvItemInfo {
+        uint16_t        id;
+        const char*     name;
+        uint16_t        size;   // bytes of the item data that are used
+        DmNvItemType    type;
+    };
+
+    /**
+    * @brief OpenPST::DmNvCatalogue
+    */
+    class DmNvCatalogue {
+        public:
+            /**
+            * @brief getCount
+            *
+            * @return size_t
+            */
+            static size_t getCount();
+
+            /**
+            * @brief getItem - Get an item by its position, items are sorted by id
+            *
+            * @param size_t index
+            * @return const DmNvItemInfo* - nullptr when out of range
+            */
+            static const DmNvItemInfo* getItem(size_t index);
+
+            /**
+            * @brief findById - Binary search for an item id
+            *
+            * @param uint16_t id
+            * @return const DmNvItemInfo* - nullptr for an unknown item
+            */
+            static const DmNvItemInfo* findById(uint16_t id);
+
+            /**
+            * @brief findByName - Perfect hash lookup of an item name, e.g. NV_MEID_I
+            *
+            * @param const char* name
+            * @return const DmNvItemInfo* - nullptr for an unknown name
+            */
+            static const DmNvItemInfo* findByName(const char* name);
+
+            /**
+            * @brief getName - Name of an item id
+            *
+            * @param uint16_t id
+            * @return const char* - "Unknown" for an unknown item
+            */
+            static const char* getName(uint16_t id);
+
+            /**
+            * @brief hashName - The name hash, must match scripts/nv_catalogue.py
+            *
+            * @param const char* name
+            * @param uint32_t seed
+            * @return uint32_t
+            */
+            static uint32_t hashName(const char* name, uint32_t seed);
+    };
+}
+
+#endif // _QC_DM_NV_CATALOGUE_H_
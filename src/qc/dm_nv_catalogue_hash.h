@@ -0,0 +1,517 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_nv_catalogue_hash.h
+* @package OpenPST
+* @brief Minimal perfect hash of the NV item names in dm_nv_items.def
+*
+* Generated by scripts/nv_catalogue.py, do not edit.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_NV_CATALOGUE_HASH_H_
+#define _QC_DM_NV_CATALOGUE_HASH_H_
+
+#define DM_NV_CATALOGUE_HASH_ITEMS   6220
+#define DM_NV_CATALOGUE_HASH_BUCKETS 1555
+
+// of the ids and names the tables below were built from
+#define DM_NV_CATALOGUE_HASH_CHECKSUM 0xCF4F115C
+
+// per bucket seed, bucket = hashName(name, 0) % DM_NV_CATALOGUE_HASH_BUCKETS
+static const uint16_t dmNvCatalogueHashDisplacements[DM_NV_CATALOGUE_HASH_BUCKETS] = {
+    38, 2, 21, 11, 2, 69, 2, 57, 25, 15, 33, 4, 8, 19, 152, 72,
+    23, 256, 3, 2, 244, 43, 23, 105, 60, 24, 1, 43, 1, 10, 3, 1,
+    5, 28, 61, 2, 8, 24, 85, 37, 11, 5, 32, 2, 28, 70, 292, 1,
+    3, 7, 108, 71, 2, 9, 1, 14, 1, 54, 31, 19, 0, 2, 3, 93,
+    19, 3, 6, 202, 26, 188, 2, 0, 3, 5, 2, 23, 106, 2, 1, 2,
+    3, 47, 61, 1, 6, 7, 3, 1, 63, 2, 9, 40, 3, 63, 11, 56,
+    5, 15, 494, 0, 3, 9, 35, 8, 379, 1, 192, 15, 40, 4, 3, 8,
+    19, 8, 1, 87, 200, 1, 12, 33, 1, 11, 68, 21, 8, 408, 67, 10,
+    1, 4, 39, 22, 75, 3, 4, 58, 14, 64, 42, 2, 33, 35, 245, 295,
+    1, 115, 114, 1, 107, 7, 2, 350, 3, 1, 2, 155, 5, 63, 45, 7,
+    53, 1, 38, 13, 3, 2, 3, 3, 104, 49, 267, 64, 9, 0, 122, 4,
+    3, 3, 4, 121, 81, 4, 10, 63, 136, 0, 10, 1, 8, 10, 924, 94,
+    60, 49, 152, 26, 35, 39, 93, 1, 1, 1, 12, 166, 29, 29, 43, 116,
+    609, 14, 12, 182, 7, 5, 3, 275, 2, 1, 0, 3, 4, 34, 168, 70,
+    6, 1, 61, 377, 130, 29, 9, 10, 440, 52, 7, 85, 91, 43, 78, 35,
+    112, 3, 5, 278, 14, 34, 7, 1, 170, 23, 2, 306, 6, 223, 91, 53,
+    2, 53, 155, 7, 53, 1, 5, 25, 105, 15, 1, 1, 27, 27, 43, 7,
+    76, 50, 1, 3, 21, 123, 76, 22, 3, 1, 3, 59, 433, 1, 1, 21,
+    2, 37, 89, 1, 63, 4, 43, 99, 106, 1, 12, 20, 2, 5, 11, 72,
+    176, 86, 27, 236, 11, 0, 13, 2, 47, 145, 3, 120, 26, 62, 5, 40,
+    1, 1, 1, 30, 28, 133, 21, 2, 9, 5, 59, 23, 4, 284, 1, 37,
+    88, 2, 42, 292, 1, 46, 1, 69, 15, 68, 3, 34, 5, 136, 22, 126,
+    24, 7, 177, 24, 37, 83, 4, 17, 111, 27, 99, 145, 5, 85, 6, 7,
+    192, 2, 62, 42, 82, 138, 89, 231, 4, 392, 34, 61, 151, 10, 45, 45,
+    182, 646, 35, 73, 7, 84, 1, 1, 107, 15, 40, 9, 33, 27, 100, 33,
+    8, 81, 45, 267, 158, 146, 39, 285, 6, 51, 2, 67, 12, 144, 15, 175,
+    41, 117, 1, 87, 66, 1, 723, 8, 5, 2, 211, 1, 34, 87, 2, 54,
+    94, 456, 3, 2, 155, 231, 0, 21, 12, 121, 1, 225, 26, 388, 57, 155,
+    7, 247, 582, 26, 93, 13, 8, 6, 63, 79, 1, 4, 109, 134, 148, 39,
+    1, 33, 36, 221, 1, 1, 78, 7, 24, 114, 67, 116, 1, 7, 6, 129,
+    12, 526, 12, 10, 13, 3, 33, 59, 3, 8, 1, 5, 3, 134, 5, 2,
+    38, 6, 7, 204, 293, 225, 18, 10, 10, 10, 32, 58, 508, 22, 159, 64,
+    103, 35, 148, 138, 6, 186, 0, 82, 156, 8, 2, 108, 97, 13, 4, 96,
+    40, 1, 28, 2, 143, 26, 64, 113, 172, 74, 82, 109, 232, 1, 11, 3,
+    70, 3, 45, 115, 81, 1, 30, 556, 938, 21, 6, 1, 5, 13, 7, 58,
+    4, 1, 27, 3, 23, 30, 3, 352, 95, 3, 121, 27, 101, 8, 168, 24,
+    68, 4, 1, 126, 1, 124, 15, 30, 340, 10, 12, 43, 16, 113, 32, 4,
+    134, 41, 2, 85, 621, 47, 7, 20, 8, 6, 0, 1, 7, 63, 59, 36,
+    19, 62, 34, 12, 1, 7, 1, 0, 1, 190, 35, 49, 31, 62, 67, 233,
+    161, 52, 37, 1, 26, 33, 13, 11, 101, 363, 122, 1, 7, 6, 3, 699,
+    50, 28, 100, 1, 612, 20, 3, 26, 71, 1, 2, 6, 27, 6, 30, 330,
+    9, 32, 167, 10, 7, 596, 5, 10, 55, 1, 1, 12, 66, 38, 11, 32,
+    489, 302, 2, 35, 20, 1, 6, 44, 41, 4, 13, 90, 1, 837, 73, 4,
+    17, 7, 1, 223, 103, 44, 207, 79, 17, 1, 195, 186, 56, 26, 73, 32,
+    4, 158, 181, 2, 1, 4, 20, 24, 53, 60, 348, 4, 1, 97, 40, 178,
+    1, 27, 1, 20, 52, 599, 81, 2, 19, 73, 1, 571, 443, 29, 34, 104,
+    6, 135, 2, 751, 42, 214, 305, 2, 570, 0, 1, 10, 493, 627, 151, 84,
+    72, 113, 586, 243, 2, 10, 20, 200, 1, 6, 0, 54, 11, 7, 1031, 45,
+    64, 176, 295, 21, 61, 2, 85, 1, 52, 794, 15, 245, 11, 34, 16, 10,
+    527, 154, 11, 27, 266, 279, 32, 0, 4, 34, 9, 16, 26, 1, 177, 5,
+    2831, 23, 31, 39, 0, 92, 73, 65, 270, 45, 357, 15, 5, 4, 632, 2,
+    29, 239, 55, 384, 9, 94, 3, 95, 99, 3, 143, 21, 57, 118, 1, 65,
+    223, 1, 486, 5, 32, 1, 255, 4, 63, 56, 256, 1, 228, 0, 290, 194,
+    168, 6, 87, 3, 101, 83, 56, 3, 8, 25, 325, 9, 3, 112, 10, 258,
+    2, 46, 10, 101, 172, 66, 22, 139, 519, 4, 189, 4, 15, 831, 183, 17,
+    18, 83, 8, 22, 272, 1, 516, 164, 12, 2, 156, 26, 54, 5, 85, 138,
+    1, 9, 3, 220, 44, 15, 38, 517, 71, 3, 202, 7, 91, 227, 250, 4,
+    18, 51, 5, 182, 46, 184, 499, 4, 352, 12, 61, 99, 124, 0, 113, 166,
+    0, 0, 1, 130, 26, 224, 66, 12, 12, 167, 1, 1561, 132, 4, 56, 85,
+    23, 7, 485, 3, 30, 36, 3, 1574, 450, 1, 642, 67, 200, 1312, 728, 5,
+    3, 1, 177, 480, 576, 72, 4, 3, 22, 6, 17, 5, 157, 19, 1, 146,
+    11, 219, 3, 227, 13, 100, 0, 1, 2, 386, 7, 4, 1, 2, 105, 72,
+    7, 446, 2, 98, 9, 18, 19, 37, 31, 215, 26, 8, 480, 5, 112, 124,
+    62, 1305, 29, 492, 5, 437, 396, 34, 60, 119, 284, 2, 122, 1, 16, 214,
+    32, 17, 5, 25, 8, 190, 248, 764, 107, 64, 192, 44, 2, 0, 106, 7,
+    0, 5, 237, 476, 97, 2, 1, 11, 3, 76, 47, 117, 488, 1, 128, 55,
+    4, 69, 58, 2, 531, 390, 3424, 418, 15, 218, 447, 10, 119, 88, 6, 20,
+    158, 1, 380, 499, 18, 4, 172, 5, 1, 831, 147, 17, 442, 580, 34, 386,
+    1253, 199, 8, 40, 158, 425, 3, 1, 3, 156, 206, 6, 2, 69, 1523, 5,
+    35, 142, 167, 12, 1465, 67, 1, 205, 119, 250, 67, 22, 1, 50, 13, 324,
+    24, 4, 231, 585, 531, 383, 283, 165, 106, 19, 357, 277, 0, 535, 183, 200,
+    8, 82, 347, 0, 1, 2, 4, 1021, 2, 3, 1, 252, 8, 933, 2717, 24,
+    246, 39, 677, 2, 0, 245, 168, 1, 283, 3, 761, 21, 12, 248, 367, 3,
+    207, 169, 30, 24, 7, 1034, 970, 10, 181, 2, 1096, 6, 6, 39, 1, 390,
+    53, 3, 413, 2, 49, 1, 578, 373, 862, 355, 652, 808, 148, 2632, 28, 375,
+    314, 1, 310, 398, 306, 215, 2032, 113, 75, 4, 20, 435, 97, 15, 11, 246,
+    69, 743, 4, 180, 1306, 1428, 7, 263, 852, 16, 18, 37, 1421, 674, 13, 8,
+    5, 2, 74, 28, 138, 728, 1, 6, 585, 1794, 178, 201, 1, 332, 369, 8,
+    415, 12, 70, 261, 2, 6, 0, 405, 1, 1, 162, 63, 3, 171, 3, 24,
+    507, 71, 2, 0, 305, 1008, 23, 1796, 512, 772, 3, 920, 14, 45, 61, 1,
+    21, 1453, 608, 1009, 1662, 31, 53, 40, 57, 194, 130, 248, 22, 2144, 4, 114,
+    41, 428, 106, 52, 1, 88, 9, 737, 6, 233, 114, 266, 136, 6, 51, 1489,
+    24, 1352, 223, 82, 307, 1, 8, 6, 758, 80, 5404, 869, 557, 10, 45, 1548,
+    541, 159, 949, 224, 25, 840, 598, 31, 2871, 50, 1080, 11, 26, 1, 2, 3,
+    1788, 797, 6, 5, 4, 105, 14, 115, 39, 1481, 26, 217, 186, 99, 497, 974,
+    33, 12, 764, 169, 1531, 131, 1, 159, 325, 3067, 93, 144, 15, 106, 955, 1443,
+    19, 61, 53, 26, 116, 207, 8, 566, 6, 1, 9, 8, 589, 969, 558, 2,
+    0, 4277, 11, 2332, 18, 490, 1605, 936, 6322, 120, 777, 1, 8, 761, 1248, 2,
+    1827, 909, 11, 815, 3722, 196, 16, 2831, 22, 1030, 142, 10, 112, 289, 19, 36,
+    2081, 435, 2, 417, 1471, 31, 0, 31, 1159, 947, 511, 593, 1, 24, 0, 82,
+    123, 647, 637, 1312, 2, 3, 369, 55, 84, 6, 1520, 32, 791, 356, 1244, 2607,
+    1, 16, 164, 37, 38, 775, 6, 80, 284, 15, 111, 21, 13, 15, 244, 362,
+    21, 3, 9, 65, 9, 0, 432, 550, 5330, 290, 6, 239, 93, 1117, 124, 2113,
+    8, 1343, 12, 38, 199, 16, 1215, 37, 64, 44, 71, 5, 289, 1873, 1, 117,
+    490, 7, 128, 487, 11, 24, 2434, 1524, 48, 0, 1682, 491, 162, 182, 75, 11,
+    3, 576, 1673, 20, 31, 330, 0, 14, 39, 2879, 3, 1141, 601, 10, 874, 1096,
+    282, 2429, 11080, 40, 1308, 106, 584, 11, 825, 206, 5706, 5, 53, 174, 1115, 1439,
+    6386, 2621, 726,
+};
+
+// catalogue index of each slot, slot = hashName(name, displacement) % DM_NV_CATALOGUE_HASH_ITEMS
+static const uint16_t dmNvCatalogueHashSlots[DM_NV_CATALOGUE_HASH_ITEMS] = {
+    1783, 4621, 5110, 3977, 1853, 3114, 446, 1571, 2179, 5781, 2463, 248, 2787, 3986, 2270, 3619,
+    1113, 2295, 5900, 4794, 2249, 1422, 2991, 2331, 3793, 5070, 269, 5622, 2933, 5458, 809, 2347,
+    6204, 726, 170, 522, 3996, 5029, 3849, 1578, 2089, 2441, 5376, 1172, 5523, 3428, 2477, 4286,
+    6088, 5671, 3490, 1090, 6049, 5082, 5515, 2084, 2963, 3848, 426, 5924, 3927, 3718, 2794, 3156,
+    2014, 2405, 1861, 3534, 4827, 6026, 5849, 2853, 5261, 4112, 3616, 214, 4185, 6119, 693, 4461,
+    115, 509, 5424, 3388, 5752, 5687, 4910, 2688, 2213, 5290, 1949, 573, 1015, 1782, 3441, 855,
+    189, 5648, 1195, 817, 2964, 2231, 2043, 1381, 768, 3882, 419, 1085, 3538, 4023, 2074, 4245,
+    1965, 1068, 498, 2348, 1602, 1380, 3829, 1738, 4183, 5232, 1323, 5478, 606, 5150, 2683, 290,
+    1852, 1999, 3477, 5453, 92, 4283, 1347, 2762, 948, 3167, 3486, 3093, 696, 5934, 774, 2684,
+    4870, 3631, 4178, 5425, 3184, 1672, 2569, 3193, 5722, 1846, 3884, 2247, 4652, 6076, 1943, 5891,
+    2167, 1203, 5704, 5390, 792, 4377, 1815, 5327, 2423, 5599, 2627, 3467, 2547, 1646, 2546, 982,
+    4609, 4070, 4814, 2204, 5500, 4277, 5826, 2036, 1202, 5169, 5824, 1331, 2536, 3179, 2268, 4971,
+    3569, 1465, 5656, 2641, 2920, 3963, 5842, 4297, 1735, 470, 2459, 4887, 2770, 4064, 2184, 3831,
+    4190, 1302, 3900, 485, 5440, 450, 5974, 991, 3121, 5409, 6113, 4460, 807, 2101, 116, 5112,
+    1240, 2305, 977, 3013, 956, 1818, 2329, 4676, 890, 884, 1706, 2575, 1220, 2503, 3590, 5862,
+    4943, 2914, 592, 2896, 2016, 1492, 4427, 1337, 5339, 5463, 3836, 3533, 3781, 3974, 750, 5034,
+    150, 16, 5602, 5317, 4204, 2335, 2020, 2980, 493, 3064, 652, 1002, 3737, 4392, 2141, 388,
+    3471, 4317, 5738, 5312, 1600, 5, 409, 755, 6138, 5060, 5220, 3069, 3462, 4537, 436, 6006,
+    889, 5176, 992, 4973, 3504, 6031, 3617, 2133, 3338, 588, 3243, 527, 5625, 2023, 804, 5790,
+    1455, 2799, 5646, 3008, 2108, 3633, 2633, 5340, 1781, 4721, 939, 349, 3075, 3137, 418, 394,
+    1789, 2876, 5575, 4972, 1698, 2370, 3665, 1648, 3044, 2447, 3151, 5573, 5356, 5264, 1338, 2191,
+    274, 2165, 76, 6165, 5098, 511, 135, 4249, 3626, 3171, 946, 1708, 5748, 4589, 4662, 4379,
+    344, 3373, 2250, 4977, 2002, 3914, 896, 5979, 4079, 781, 4706, 4836, 2236, 2897, 3104, 6071,
+    5222, 2039, 3941, 5334, 6203, 4318, 1517, 2946, 3970, 3498, 5069, 1761, 1278, 4291, 2152, 1760,
+    3866, 2136, 6217, 5641, 1736, 5600, 3436, 4214, 4480, 6128, 541, 5071, 191, 404, 3582, 5953,
+    4435, 6077, 1052, 714, 5426, 4400, 4655, 5872, 848, 6004, 5025, 4843, 4042, 5997, 1641, 1425,
+    818, 4437, 523, 2398, 1879, 5296, 2512, 5191, 2389, 4871, 3403, 3687, 3662, 3092, 1547, 1358,
+    5316, 555, 4030, 3296, 5890, 6159, 3908, 455, 4371, 5086, 1427, 3906, 3791, 297, 1285, 4647,
+    1099, 681, 3998, 4038, 1107, 5093, 4579, 5717, 1778, 3368, 1197, 6023, 3197, 857, 4201, 4708,
+    5337, 2317, 4957, 5884, 4232, 3868, 1356, 4018, 1157, 4891, 2838, 5989, 4095, 2360, 3720, 1426,
+    4490, 5006, 293, 3609, 2828, 2160, 2796, 2364, 5885, 3990, 2738, 4678, 5068, 6109, 3150, 3696,
+    3326, 2355, 3194, 1249, 5273, 2291, 3426, 473, 2262, 2913, 3220, 4673, 754, 5038, 1370, 5260,
+    5325, 2092, 89, 1094, 1964, 2120, 4787, 2147, 120, 860, 1819, 2588, 1497, 6067, 5582, 4186,
+    3435, 197, 1248, 639, 563, 4657, 5751, 5733, 557, 2602, 801, 2646, 1932, 3042, 4268, 5624,
+    313, 3447, 6036, 3933, 4029, 4763, 5982, 4197, 5975, 448, 1406, 106, 147, 4097, 2308, 5825,
+    2433, 1535, 5593, 5355, 5012, 2628, 4491, 1024, 1726, 2121, 1224, 5464, 3902, 4397, 4866, 5907,
+    4557, 1838, 2746, 3873, 3989, 2395, 3001, 226, 378, 5367, 5581, 741, 4408, 832, 3528, 3087,
+    2538, 3985, 1506, 253, 4996, 4407, 5741, 2402, 987, 4722, 1712, 2129, 870, 2356, 2622, 2343,
+    2740, 440, 4102, 3233, 5308, 1445, 574, 1001, 1872, 745, 4152, 3394, 5813, 2824, 5397, 4687,
+    4450, 5962, 4413, 5121, 1253, 5091, 2474, 531, 1974, 1156, 3449, 2107, 2791, 173, 1689, 1293,
+    99, 423, 1477, 460, 3519, 5307, 5388, 1417, 1415, 3308, 576, 1944, 4356, 4642, 2618, 4010,
+    1373, 1845, 4052, 2729, 209, 4344, 4088, 2143, 3702, 2008, 1733, 1953, 5201, 1496, 1145, 5786,
+    3446, 6003, 2401, 1690, 3765, 2093, 1006, 4572, 3117, 1319, 1346, 706, 4189, 3931, 970, 2956,
+    2162, 4157, 2934, 739, 4535, 5893, 9, 405, 5746, 5943, 2880, 2428, 5138, 5566, 3745, 4076,
+    4210, 3231, 4003, 1472, 1489, 5205, 5694, 5856, 4260, 4258, 3666, 1154, 1340, 504, 4890, 2724,
+    3556, 6212, 780, 5510, 2449, 1388, 4780, 642, 5729, 6144, 1938, 839, 4267, 3029, 4707, 3553,
+    4419, 4345, 3858, 1401, 2404, 4908, 4484, 4823, 1716, 1175, 3641, 3599, 4432, 5416, 2756, 2630,
+    3382, 3983, 5420, 6139, 4559, 4645, 1807, 5672, 3174, 3101, 3455, 845, 4081, 2050, 5259, 551,
+    5077, 1704, 3950, 1470, 1136, 3560, 3723, 4959, 2977, 5744, 4299, 1678, 5895, 1391, 2221, 3684,
+    4907, 2024, 5153, 922, 5916, 308, 4749, 877, 2190, 5078, 1618, 4584, 2378, 365, 4488, 5529,
+    1643, 5708, 4207, 1542, 5937, 961, 1483, 4082, 2842, 4719, 4515, 1855, 2764, 4726, 820, 4745,
+    1384, 5749, 1701, 3886, 1238, 5726, 568, 5030, 1904, 1697, 4396, 6122, 3105, 1451, 4746, 2858,
+    2212, 3108, 649, 6168, 5795, 837, 4103, 3140, 1811, 2313, 5179, 5692, 2993, 3034, 252, 2309,
+    2473, 645, 3864, 1394, 3469, 1565, 1877, 1111, 4934, 4503, 2597, 4075, 5443, 3775, 5379, 2710,
+    680, 5050, 2759, 2772, 2789, 5801, 3239, 258, 4976, 2332, 883, 1993, 3251, 2033, 810, 2927,
+    286, 4835, 4596, 529, 5476, 990, 3192, 1360, 632, 6, 3786, 3427, 5782, 5146, 5134, 3063,
+    6124, 1737, 4365, 4946, 4005, 5737, 1525, 5445, 3084, 4399, 4853, 2742, 6162, 4248, 5627, 3102,
+    4528, 5392, 685, 1475, 307, 3735, 5126, 2891, 2584, 663, 431, 5142, 2437, 2178, 3651, 3997,
+    2919, 5559, 4216, 1668, 3315, 6005, 4854, 4824, 5202, 1207, 5810, 3825, 1573, 5631, 1047, 2161,
+    4096, 5224, 2061, 2872, 2559, 4385, 5545, 4799, 5628, 4316, 1758, 1222, 5894, 2315, 3144, 22,
+    1989, 2524, 4653, 2783, 2954, 1313, 6034, 5833, 4483, 658, 3362, 5914, 5689, 3851, 5042, 5391,
+    3784, 108, 3375, 1792, 2695, 5988, 3584, 5882, 4765, 3406, 1200, 933, 3669, 2625, 370, 1556,
+    3690, 4928, 140, 1196, 4936, 3968, 3955, 4328, 3412, 119, 3491, 6082, 1981, 2614, 1876, 4257,
+    3460, 343, 1449, 1935, 402, 4059, 5897, 6009, 1671, 2970, 4217, 2922, 261, 38, 791, 2386,
+    1469, 4220, 3652, 3183, 5143, 597, 2966, 5567, 4614, 3522, 2737, 158, 3685, 3805, 1615, 4215,
+    163, 5411, 3822, 5601, 4265, 304, 4752, 3657, 3855, 3747, 720, 2866, 4352, 2823, 2281, 4819,
+    5187, 5508, 1299, 3717, 3215, 3402, 4788, 1540, 36, 5507, 2657, 4917, 2781, 2877, 4724, 5753,
+    1522, 5531, 5984, 4970, 398, 5305, 414, 3309, 5044, 6057, 4247, 3642, 5629, 4418, 1353, 5706,
+    2296, 4275, 3655, 4473, 1081, 688, 815, 421, 6158, 5779, 5841, 4704, 4828, 2923, 4026, 2224,
+    3500, 4083, 5774, 6035, 6020, 5783, 4410, 1199, 5684, 142, 1009, 3821, 5460, 6089, 4869, 5958,
+    1971, 4612, 552, 4471, 2207, 3125, 4285, 5596, 1609, 2288, 1439, 2797, 1414, 593, 2935, 2542,
+    291, 3739, 5183, 1091, 3339, 579, 6178, 3981, 5540, 3960, 2413, 3476, 316, 3549, 5125, 5189,
+    3982, 3577, 4139, 1767, 785, 1164, 5351, 4198, 775, 2659, 6038, 5229, 60, 1210, 6127, 2303,
+    5858, 4036, 4184, 3333, 611, 1567, 257, 2, 5612, 3158, 917, 2448, 4867, 2676, 880, 5332,
+    3898, 4940, 2779, 2668, 2579, 4718, 4898, 4151, 2290, 2916, 5017, 723, 6019, 5442, 3508, 4586,
+    3881, 484, 5159, 30, 913, 2865, 3168, 1990, 2245, 1101, 3059, 1227, 3635, 5497, 5246, 3832,
+    5994, 6042, 6044, 278, 2452, 58, 4120, 3721, 5343, 164, 5350, 1711, 1912, 4166, 1359, 790,
+    3290, 2274, 2047, 1282, 5236, 5867, 160, 912, 6021, 701, 2354, 5158, 524, 626, 2478, 3294,
+    644, 6069, 5073, 4350, 1942, 3580, 4442, 3310, 5866, 3492, 5603, 2421, 5528, 42, 2222, 3730,
+    914, 5039, 2271, 5040, 28, 2287, 6098, 5265, 1859, 2026, 1919, 1620, 1010, 2961, 1121, 4034,
+    5272, 2283, 2599, 2583, 4560, 338, 364, 2795, 4443, 3632, 4288, 3343, 4456, 4498, 6219, 111,
+    4738, 4084, 2748, 4817, 4598, 4006, 3389, 5053, 2396, 824, 519, 4604, 5249, 881, 4944, 15,
+    3922, 4790, 3351, 4682, 3965, 270, 888, 5062, 5761, 6136, 4492, 3585, 756, 5784, 1244, 2516,
+    1079, 3360, 4167, 5949, 129, 3930, 951, 3792, 2486, 1219, 2083, 2382, 3991, 5000, 2696, 2255,
+    4295, 3843, 5578, 2768, 1774, 5274, 968, 3661, 235, 4465, 2649, 4694, 5564, 144, 3425, 61,
+    2181, 5762, 702, 2996, 708, 1274, 4821, 3890, 406, 5868, 5162, 4826, 1829, 4975, 2653, 822,
+    981, 1142, 3601, 1263, 1242, 2635, 4674, 46, 5010, 4174, 4455, 133, 2464, 3293, 1775, 1844,
+    4786, 200, 2912, 5439, 2096, 1586, 2383, 3297, 5961, 4759, 1117, 5123, 2950, 311, 1896, 1977,
+    2507, 5570, 5192, 1179, 3602, 3262, 1413, 4077, 3903, 3530, 1860, 2211, 4325, 1424, 4619, 6052,
+    2753, 5831, 382, 3037, 1368, 1158, 2818, 5827, 4252, 4553, 2815, 6040, 1709, 6175, 5990, 4222,
+    327, 5167, 2763, 4878, 6002, 117, 1028, 4522, 5081, 3683, 3433, 5917, 5502, 3487, 3344, 4271,
+    351, 3145, 2561, 5903, 2292, 2109, 1007, 2200, 3366, 3128, 5791, 5778, 1824, 2279, 1916, 1621,
+    2761, 6092, 4885, 165, 1984, 4441, 456, 5837, 722, 4764, 3752, 2836, 1732, 1318, 1564, 5978,
+    2722, 6086, 5172, 4613, 3623, 3478, 2007, 5254, 950, 779, 5326, 1910, 1055, 21, 2743, 898,
+    572, 3839, 384, 3749, 1603, 2316, 1361, 462, 4373, 3678, 1871, 3940, 2048, 2457, 255, 5122,
+    1520, 1874, 5638, 5973, 3166, 3895, 4920, 3225, 5820, 5462, 5117, 3097, 294, 251, 2548, 5632,
+    838, 602, 5041, 1236, 5527, 5766, 1335, 580, 2028, 1452, 5620, 5276, 924, 979, 1436, 2198,
+    6068, 2899, 3994, 4705, 54, 5298, 3670, 709, 1773, 6091, 397, 2252, 4086, 4205, 151, 1713,
+    4905, 1324, 2817, 5640, 3432, 4715, 1123, 1300, 4175, 4176, 6167, 713, 900, 802, 2959, 3146,
+    2325, 4512, 6081, 3395, 5933, 3374, 5412, 3969, 1628, 3591, 2219, 1788, 20, 4651, 5043, 4965,
+    288, 3732, 2572, 3515, 3667, 1816, 3575, 2611, 2921, 63, 1606, 3889, 2642, 4952, 5655, 2349,
+    4448, 474, 1512, 392, 3672, 1911, 3189, 4801, 188, 2403, 3263, 1686, 4710, 3762, 5730, 2839,
+    3292, 3995, 3606, 4716, 1970, 2666, 4451, 1478, 25, 2686, 1691, 4902, 3724, 4364, 1546, 5942,
+    467, 796, 5473, 2005, 5796, 6207, 5571, 229, 2369, 2298, 2755, 2721, 442, 4332, 5964, 1305,
+    5764, 5610, 5319, 5174, 2217, 5262, 3241, 4057, 3850, 1850, 5991, 565, 4573, 2492, 179, 4611,
+    1399, 6104, 736, 5525, 1132, 1153, 427, 5472, 3204, 2513, 1530, 4564, 5710, 5084, 4109, 5180,
+    5716, 4251, 583, 5814, 4664, 3543, 4789, 6115, 909, 4852, 4144, 3359, 1946, 2406, 3682, 5387,
+    2435, 3337, 5906, 4935, 2140, 5016, 3620, 4194, 2819, 3058, 3638, 4067, 2900, 1327, 190, 2019,
+    865, 3912, 5745, 1316, 2617, 5088, 1998, 6166, 4366, 2562, 5001, 1797, 1679, 5736, 413, 162,
+    4953, 1905, 1086, 3172, 5048, 3424, 512, 3480, 3007, 1087, 2878, 4840, 5697, 1891, 993, 353,
+    5521, 454, 5245, 4989, 4092, 6156, 1349, 103, 196, 1503, 102, 1273, 3992, 2374, 1751, 4698,
+    5700, 157, 1734, 4556, 3249, 4031, 4576, 893, 12, 3948, 5899, 3289, 5740, 159, 2353, 4192,
+    5912, 3479, 4519, 4644, 4390, 1065, 4458, 543, 5940, 1105, 5544, 1839, 78, 4438, 4875, 3854,
+    6032, 4380, 4027, 6027, 3421, 2351, 1075, 1988, 1367, 4454, 4298, 5880, 5663, 3875, 3415, 1947,
+    776, 2206, 1764, 3358, 4896, 5295, 184, 532, 6210, 1563, 571, 581, 4230, 2000, 825, 1397,
+    1408, 4372, 2517, 27, 1575, 3545, 2328, 1460, 662, 6014, 830, 1975, 2648, 1088, 4758, 777,
+    2594, 5911, 6112, 740, 107, 4873, 2430, 1785, 915, 3894, 2392, 5558, 3349, 5787, 798, 1498,
+    359, 5705, 4281, 3451, 5775, 3380, 1669, 6180, 5970, 5009, 1296, 1941, 4339, 5225, 1583, 4001,
+    3659, 5196, 4620, 4423, 4479, 337, 5013, 2715, 548, 5816, 47, 1326, 872, 4901, 1635, 4014,
+    5371, 4813, 4155, 5597, 3664, 534, 2679, 4897, 114, 3939, 449, 3319, 1950, 4108, 5992, 5186,
+    1801, 907, 2992, 2115, 3316, 2690, 2180, 4686, 1352, 18, 2229, 647, 995, 3356, 1803, 5380,
+    4457, 5074, 2189, 1794, 1146, 2304, 3082, 4892, 5467, 2544, 3978, 183, 5804, 2918, 3060, 2027,
+    3833, 3473, 3746, 246, 105, 660, 1035, 1314, 1357, 4467, 5864, 3954, 3230, 6008, 4683, 1064,
+    4831, 963, 2514, 4534, 3639, 5329, 3074, 4041, 1543, 3342, 1056, 5584, 5291, 5908, 3188, 4981,
+    949, 795, 333, 4415, 6151, 4100, 762, 4063, 4690, 1144, 2711, 1795, 1805, 1336, 3190, 4776,
+    763, 2280, 425, 4348, 5103, 5945, 1382, 2519, 923, 3200, 2682, 5124, 3993, 11, 5835, 3050,
+    2732, 4829, 976, 148, 2712, 4825, 4272, 1625, 2171, 3240, 3026, 4349, 2044, 506, 1875, 249,
+    3546, 3018, 2881, 2810, 3035, 138, 5067, 4963, 5635, 1549, 6111, 3417, 1574, 1536, 4021, 1226,
+    3593, 2407, 1757, 4960, 434, 4626, 1746, 5836, 5693, 6070, 842, 2058, 4993, 2453, 2777, 4713,
+    2556, 3572, 3244, 1806, 3237, 1148, 5506, 4610, 2981, 3637, 2518, 5754, 3259, 3154, 3561, 4736,
+    3185, 4154, 2442, 1229, 1275, 2085, 4321, 564, 1851, 3509, 355, 5947, 5526, 417, 4529, 131,
+    2187, 4688, 4539, 5662, 3525, 2861, 3901, 2299, 5688, 2456, 567, 3253, 3106, 4583, 2341, 302,
+    225, 1385, 2832, 466, 1591, 2208, 2790, 5565, 2826, 657, 4937, 109, 1115, 2055, 978, 4980,
+    3691, 664, 3116, 194, 5173, 2017, 2310, 2475, 4693, 4221, 5875, 4111, 5936, 3871, 596, 5919,
+    3764, 239, 3874, 4326, 1103, 1692, 5090, 2849, 630, 1016, 4121, 2639, 6216, 1230, 2164, 1996,
+    1371, 1694, 1675, 1140, 2246, 5576, 1661, 4568, 5802, 3163, 2277, 3291, 5561, 4783, 2301, 695,
+    5421, 4849, 3300, 1721, 5094, 2377, 4091, 5210, 4008, 964, 4312, 1058, 794, 2685, 1985, 3110,
+    2592, 764, 219, 4930, 5336, 4505, 4087, 1677, 2613, 1786, 1884, 728, 1045, 733, 1216, 1784,
+    4660, 4098, 5036, 4661, 2949, 6030, 3085, 2822, 5389, 5776, 1493, 2773, 2637, 3046, 4654, 3817,
+    3622, 5226, 5939, 4701, 2225, 2412, 3904, 4202, 6096, 6079, 266, 3152, 5287, 2391, 1519, 936,
+    366, 1257, 3804, 858, 3227, 2500, 5886, 589, 1898, 4569, 4923, 132, 503, 5760, 2707, 4401,
+    4663, 1545, 1042, 5683, 4667, 834, 79, 4449, 3134, 5547, 4565, 1499, 3111, 2671, 3503, 1957,
+    5902, 5647, 5166, 3120, 3260, 1768, 5812, 2669, 3012, 5116, 2986, 2834, 659, 2366, 4290, 4387,
+    1256, 906, 3699, 5446, 87, 1486, 3027, 734, 2852, 166, 4485, 4985, 4855, 1926, 292, 4681,
+    683, 958, 4191, 26, 3283, 5871, 4141, 5681, 492, 1167, 3770, 3952, 902, 5910, 5097, 5960,
+    4106, 2113, 4117, 5844, 5555, 464, 5253, 3565, 4727, 3139, 5606, 5539, 1954, 1345, 4149, 5175,
+    153, 536, 6126, 5431, 1294, 545, 3842, 80, 4238, 5720, 1182, 4777, 773, 5447, 5968, 3936,
+    5595, 4845, 4549, 5925, 5349, 5214, 530, 268, 4019, 3081, 4, 2415, 94, 4595, 4499, 273,
+    1537, 725, 1880, 5954, 2612, 5161, 4398, 1159, 1212, 1558, 1707, 2073, 2840, 4431, 3673, 2609,
+    1983, 3298, 6133, 465, 5324, 1292, 5019, 66, 5377, 1259, 430, 2862, 1152, 3439, 2713, 3879,
+    3070, 83, 2004, 558, 1204, 3261, 6083, 1476, 4679, 2149, 3049, 4050, 2660, 3095, 2967, 2813,
+    3149, 4170, 1181, 625, 2989, 1402, 4343, 495, 1180, 373, 3918, 1269, 4513, 1431, 2483, 2454,
+    3531, 1283, 3562, 577, 1332, 2444, 1931, 5870, 1298, 1289, 1555, 3365, 4532, 6155, 4779, 2698,
+    5928, 3328, 88, 2651, 1752, 3719, 4554, 5701, 2962, 2336, 5288, 3400, 4591, 4421, 3430, 3054,
+    2237, 1481, 2306, 4099, 1728, 5430, 1662, 3066, 6192, 3010, 6007, 5322, 223, 4806, 4955, 3860,
+    2586, 3280, 1139, 1246, 19, 1409, 2455, 3159, 3694, 303, 5966, 4637, 5583, 4363, 216, 1601,
+    2801, 4145, 2269, 919, 3268, 3630, 772, 2205, 3131, 1461, 690, 1613, 3816, 199, 3079, 3646,
+    5888, 5145, 6072, 2632, 2999, 5101, 5015, 610, 4629, 5486, 3502, 6037, 3905, 598, 5855, 1972,
+    2833, 1479, 3006, 1842, 787, 861, 1264, 3583, 2123, 1096, 4278, 299, 3304, 3763, 4755, 1165,
+    4129, 1321, 2526, 1987, 3838, 3247, 2675, 1325, 959, 4748, 2554, 1295, 5969, 4470, 1375, 3256,
+    2754, 3437, 3062, 2075, 546, 5972, 2623, 1579, 6013, 4226, 3384, 2197, 1119, 5401, 4711, 1528,
+    1883, 2884, 2728, 4148, 6142, 3484, 389, 587, 1772, 4171, 1061, 4773, 621, 4921, 420, 997,
+    3002, 661, 4714, 4649, 1301, 501, 3794, 2314, 4757, 4301, 2333, 3205, 332, 3272, 34, 3744,
+    4011, 101, 2488, 878, 4303, 3053, 4327, 3429, 770, 4228, 1959, 400, 3964, 2182, 3264, 4639,
+    354, 1110, 2978, 4760, 5843, 1676, 300, 325, 901, 2261, 4948, 478, 1730, 980, 1114, 4636,
+    2735, 2241, 1664, 2875, 3708, 608, 230, 5572, 1310, 2312, 3973, 5140, 4570, 2904, 4493, 1462,
+    4807, 2076, 3740, 4061, 674, 3867, 3235, 3612, 655, 3202, 1485, 1906, 331, 849, 5119, 5501,
+    2792, 1639, 4982, 3040, 1813, 5542, 697, 4881, 1836, 2901, 628, 3679, 4510, 650, 5524, 2188,
+    2785, 5066, 1570, 5592, 72, 2227, 4338, 1339, 2784, 4414, 3863, 5283, 3777, 2487, 1438, 1004,
+    98, 2209, 2511, 623, 3926, 3353, 3391, 5404, 3329, 1428, 5498, 5552, 247, 4156, 3210, 5193,
+    3162, 505, 4747, 5063, 3925, 3454, 5677, 3921, 578, 3396, 4723, 4227, 4165, 126, 6114, 4978,
+    6107, 2603, 3705, 2284, 3311, 938, 3199, 841, 2987, 687, 5357, 4039, 1843, 2829, 167, 635,
+    1364, 1066, 1355, 5548, 1749, 1149, 2254, 4428, 1412, 840, 4904, 616, 3834, 925, 4463, 2620,
+    942, 2910, 3946, 1162, 5247, 3806, 3236, 944, 2497, 2939, 5102, 1500, 4284, 782, 627, 5115,
+    5986, 4774, 704, 1604, 155, 3327, 3488, 570, 5157, 892, 2699, 4405, 40, 1311, 4782, 2128,
+    1840, 988, 2942, 3847, 3823, 1243, 7, 3273, 4424, 2440, 458, 5165, 4114, 5852, 737, 5711,
+    4949, 192, 2557, 4429, 6214, 1700, 2099, 3574, 671, 5918, 4322, 1521, 3738, 620, 5106, 1194,
+    2372, 667, 1748, 2605, 5459, 2654, 3830, 2327, 3640, 5920, 3191, 4605, 1588, 4984, 3627, 64,
+    3586, 6179, 1334, 205, 3334, 5959, 5177, 483, 346, 3909, 5133, 3650, 5952, 4218, 3814, 5233,
+    5621, 3265, 3153, 5987, 515, 5480, 3542, 1411, 3796, 3482, 3457, 1637, 4689, 5645, 3278, 3540,
+    4279, 2462, 2062, 323, 5076, 4044, 208, 1915, 5318, 5763, 4250, 666, 5137, 2078, 276, 910,
+    3248, 1187, 5255, 5065, 2431, 895, 1089, 2049, 4951, 481, 48, 3663, 3088, 3302, 3325, 521,
+    4481, 1868, 3282, 2289, 1315, 856, 1822, 489, 350, 1102, 6161, 2837, 6123, 3147, 3019, 1799,
+    4697, 1147, 601, 2196, 879, 5955, 1032, 829, 3497, 2958, 3495, 3052, 3485, 5052, 1303, 1623,
+    5223, 3142, 5299, 4282, 4231, 5422, 1991, 4802, 5487, 4638, 3658, 2399, 5770, 2767, 3252, 1638,
+    1577, 1377, 1419, 1218, 2215, 5636, 1252, 2805, 575, 753, 3984, 1288, 4622, 1802, 2892, 5492,
+    3107, 2670, 2465, 3621, 3348, 480, 4224, 6154, 4113, 746, 1585, 5230, 4193, 2468, 3195, 6000,
+    5477, 3127, 1994, 5518, 77, 1986, 869, 3015, 4540, 2574, 1051, 3434, 4158, 1484, 2806, 2094,
+    5619, 6206, 5417, 2069, 3654, 4950, 1969, 6017, 932, 3472, 5414, 4313, 4017, 3274, 4886, 6106,
+    3170, 3143, 1072, 6029, 1127, 5386, 5614, 4501, 749, 5352, 4561, 4351, 5151, 3551, 4253, 3776,
+    1765, 3506, 2582, 2863, 457, 5393, 5755, 1552, 3245, 445, 4860, 3512, 3132, 1025, 5108, 905,
+    1271, 2379, 367, 4531, 3452, 966, 3335, 4496, 2502, 3005, 3250, 360, 2786, 2243, 85, 2071,
+    2100, 3416, 2661, 6157, 4615, 5330, 3122, 5092, 5237, 3017, 37, 3736, 2414, 256, 2334, 4051,
+    6016, 154, 5085, 1365, 5277, 4548, 3499, 4110, 5394, 5822, 4882, 5756, 3267, 385, 4489, 2059,
+    1776, 3876, 2719, 4862, 6182, 2137, 5679, 1309, 44, 4033, 3331, 6169, 1464, 161, 186, 3024,
+    2888, 3324, 1917, 3392, 1468, 1800, 1150, 533, 1607, 1374, 4742, 4511, 3501, 2541, 3014, 4394,
+    2527, 2788, 5365, 2318, 5217, 5011, 3773, 3148, 4276, 264, 5686, 4643, 4517, 1122, 2339, 4292,
+    139, 3238, 171, 4577, 5263, 2124, 4359, 3688, 2928, 6073, 5333, 2466, 3254, 2906, 4666, 1534,
+    4211, 2097, 5358, 5320, 4137, 4793, 375, 5020, 5395, 871, 31, 2610, 336, 1233, 1109, 771,
+    6184, 2232, 2158, 5618, 14, 3919, 5335, 1870, 3604, 2263, 689, 3410, 4906, 3016, 259, 1745,
+    6074, 2835, 3369, 1945, 3692, 5051, 6188, 1286, 2619, 1228, 3589, 322, 5315, 5806, 3680, 931,
+    211, 2775, 5213, 4333, 2727, 5239, 305, 2163, 2531, 538, 5485, 5363, 1457, 2716, 3431, 3757,
+    3224, 5673, 1050, 5168, 5834, 3217, 5289, 5809, 4049, 2769, 3463, 3643, 3371, 703, 5185, 215,
+    1995, 1731, 3011, 1634, 4818, 491, 1804, 828, 1490, 1848, 5537, 3552, 3385, 5346, 4147, 866,
+    5241, 5475, 326, 3911, 3896, 1665, 1796, 4181, 5418, 1962, 3216, 309, 624, 4808, 472, 3698,
+    1093, 6056, 1865, 3859, 4004, 1828, 3443, 1387, 911, 4486, 4812, 3507, 2874, 1863, 5014, 3207,
+    137, 1511, 1270, 4127, 93, 2847, 221, 5996, 1262, 1173, 2134, 2368, 3579, 2400, 3043, 1881,
+    1889, 967, 2011, 4468, 1557, 5851, 643, 1191, 3072, 4035, 710, 3835, 2821, 2726, 5206, 4567,
+    324, 4315, 4912, 5941, 2485, 6012, 984, 5792, 2850, 928, 3899, 2571, 5235, 4530, 4179, 376,
+    2976, 5033, 5956, 4900, 718, 5479, 3080, 1683, 5035, 3307, 3078, 1038, 4597, 4300, 510, 3880,
+    2032, 3934, 4476, 5512, 999, 2936, 3671, 2322, 5402, 5551, 4958, 2326, 1482, 1205, 1206, 1155,
+    3799, 479, 599, 4304, 1720, 4305, 5331, 2674, 3869, 4053, 4751, 926, 1046, 4967, 3988, 1019,
+    5811, 1177, 586, 342, 4195, 3361, 5370, 1118, 3379, 2506, 318, 6116, 2445, 1239, 2736, 2278,
+    4340, 2427, 1739, 5838, 784, 3094, 4164, 1508, 2276, 4876, 4142, 3041, 2990, 2234, 1835, 3789,
+    2895, 3795, 508, 295, 1955, 5037, 4841, 4208, 1724, 4347, 3809, 2218, 3130, 494, 3180, 2480,
+    5793, 3935, 2418, 560, 6033, 549, 4444, 3493, 275, 2238, 4847, 3587, 1864, 638, 3677, 4810,
+    3341, 2350, 3474, 2035, 4929, 5768, 2702, 962, 5120, 1849, 3346, 134, 5589, 4323, 3466, 5661,
+    5650, 4846, 5594, 5314, 854, 2521, 3438, 4795, 852, 5616, 2006, 4032, 3885, 953, 195, 3352,
+    1287, 3404, 1320, 6190, 5251, 5219, 2210, 4212, 550, 3213, 4995, 894, 1548, 3625, 3442, 5732,
+    3801, 613, 5057, 5282, 2001, 2545, 1756, 5104, 1039, 4007, 2105, 5532, 5079, 2489, 6208, 3226,
+    4060, 1071, 1078, 386, 554, 236, 4055, 496, 1747, 5898, 1176, 2046, 2634, 705, 3942, 2827,
+    3932, 903, 4045, 3578, 4160, 525, 4811, 6094, 1018, 5152, 4306, 4991, 6015, 4307, 96, 1041,
+    4131, 387, 3354, 5654, 2300, 5243, 352, 5904, 668, 805, 1284, 206, 2380, 5913, 4223, 5821,
+    1211, 3527, 2199, 2600, 4140, 2985, 619, 4703, 3423, 4700, 4650, 6132, 4578, 2110, 965, 2741,
+    793, 1655, 2257, 53, 4670, 4997, 3731, 1825, 1456, 5268, 4266, 6066, 2426, 5734, 5877, 3861,
+    677, 2615, 287, 1951, 5407, 4600, 329, 5794, 487, 4342, 2771, 4361, 4353, 3767, 6211, 5438,
+    5682, 2523, 1034, 3778, 3378, 335, 3418, 5257, 4968, 4089, 4684, 1395, 4514, 4256, 2709, 5747,
+    4447, 3320, 4816, 6028, 3517, 5556, 5785, 2930, 2130, 3841, 1023, 3636, 1940, 1526, 6176, 1627,
+    244, 24, 4329, 1466, 2793, 6199, 3176, 122, 3883, 3187, 4412, 5488, 4916, 4374, 1128, 2127,
+    2814, 1808, 2539, 4475, 5403, 1434, 1333, 5604, 4320, 5184, 716, 5423, 3414, 4834, 5465, 1631,
+    5644, 3618, 5111, 1290, 372, 5863, 1823, 2239, 3419, 5361, 698, 1430, 369, 3314, 4015, 5731,
+    4331, 2848, 3173, 847, 6130, 217, 1280, 1169, 5887, 5777, 4526, 2038, 836, 1141, 152, 4547,
+    2932, 996, 3459, 4893, 867, 2490, 228, 3347, 2644, 5554, 2065, 5562, 2385, 5024, 3917, 2965,
+    2376, 2010, 222, 2885, 4028, 4606, 5915, 2604, 4104, 5311, 3323, 1566, 5944, 3697, 1133, 3709,
+    2694, 5739, 5398, 2175, 5699, 4994, 1379, 5216, 1961, 2114, 4648, 4741, 4436, 1659, 5536, 5847,
+    3021, 851, 811, 3350, 3714, 1134, 2056, 5434, 4115, 4692, 202, 1755, 3668, 5765, 5400, 4229,
+    5546, 3937, 4524, 2088, 1790, 3377, 1626, 1929, 1714, 410, 5799, 3405, 271, 4422, 5909, 4336,
+    4196, 1619, 2086, 5127, 2012, 4233, 1008, 5415, 921, 4254, 5212, 724, 1699, 4709, 1453, 5938,
+    1581, 735, 850, 4872, 3924, 3003, 927, 499, 1170, 3853, 5725, 3754, 1719, 5231, 1390, 972,
+    4293, 341, 2525, 2373, 4919, 727, 312, 4961, 3367, 5929, 4085, 2034, 1590, 1097, 3567, 2388,
+    4116, 6171, 1033, 1077, 1174, 243, 665, 5364, 3907, 5670, 516, 3211, 3693, 52, 4725, 1026,
+    5921, 232, 812, 2809, 6097, 6141, 3281, 4395, 3557, 5008, 339, 4909, 3332, 3840, 5715, 1076,
+    827, 1317, 2051, 5839, 2233, 766, 3284, 5769, 5557, 4264, 3090, 4858, 5617, 6153, 4766, 5696,
+    218, 3966, 3295, 1421, 5853, 863, 5027, 974, 3033, 4922, 682, 3009, 5854, 5932, 823, 2757,
+    1014, 121, 5588, 3769, 800, 4383, 5660, 3465, 5707, 3828, 1617, 407, 1687, 615, 672, 2905,
+    182, 4874, 6105, 2155, 65, 2193, 542, 5470, 2411, 4797, 1754, 5533, 631, 2240, 4593, 5703,
+    1260, 2673, 5608, 2751, 2758, 4243, 4625, 5252, 4177, 4842, 3518, 6099, 5651, 1753, 3234, 654,
+    2135, 5399, 4237, 3055, 629, 5328, 3288, 277, 1423, 3913, 2616, 3303, 2704, 3208, 2867, 1779,
+    4240, 2154, 2131, 6043, 3494, 2052, 1471, 2484, 2596, 2864, 2504, 686, 5874, 4696, 3198, 1463,
+    1189, 622, 3756, 1894, 4376, 937, 5207, 1936, 4143, 174, 3169, 853, 4691, 2266, 4123, 5147,
+    4781, 2259, 2601, 1827, 4791, 3196, 283, 2132, 1188, 5250, 1921, 371, 2361, 1594, 1560, 5368,
+    2384, 5484, 2371, 100, 1011, 940, 1306, 799, 1322, 1532, 3214, 4420, 348, 1882, 411, 4016,
+    5271, 3219, 1458, 5927, 4182, 3393, 4627, 4983, 1660, 769, 4575, 5344, 1616, 513, 1960, 1037,
+    4048, 5534, 4768, 1488, 3, 451, 1501, 3161, 1245, 2169, 935, 5483, 334, 3313, 91, 1183,
+    145, 3733, 0, 3761, 2747, 124, 260, 5021, 3772, 1074, 2338, 5348, 3071, 3181, 955, 1599,
+    3783, 1610, 989, 3674, 3647, 4404, 5451, 4426, 2258, 2387, 4702, 3929, 3448, 5454, 5471, 2151,
+    960, 2606, 700, 3742, 2766, 5676, 5269, 3862, 5310, 1793, 2718, 412, 6001, 2974, 6051, 2886,
+    6118, 5800, 469, 1685, 4631, 1899, 3979, 983, 3555, 3099, 759, 4502, 280, 2319, 3852, 3581,
+    5995, 2040, 605, 2342, 1529, 3608, 71, 535, 3383, 1554, 3706, 3155, 2937, 4043, 296, 4346,
+    172, 1885, 2436, 2593, 4090, 5861, 5639, 2077, 4739, 862, 5218, 4635, 2851, 2752, 4785, 752,
+    234, 4056, 2652, 2566, 345, 1769, 2691, 1116, 5072, 3413, 3312, 6117, 4899, 4633, 73, 3559,
+    3624, 3803, 254, 4391, 3857, 4580, 1856, 441, 731, 2943, 67, 1920, 6047, 2443, 3047, 1550,
+    4767, 4337, 2458, 5550, 56, 1510, 2340, 5195, 2068, 3301, 1036, 2968, 3819, 118, 1830, 3887,
+    4472, 2739, 2095, 362, 633, 1538, 2045, 1667, 5381, 2117, 1997, 4732, 694, 2495, 453, 49,
+    4939, 5154, 2907, 1544, 476, 4433, 6143, 2650, 2931, 5228, 1369, 2063, 3972, 2235, 3945, 2955,
+    4199, 6108, 6062, 1433, 5341, 502, 5577, 2820, 6202, 4894, 4851, 1108, 104, 5832, 4740, 1494,
+    3676, 2282, 5848, 4302, 783, 2510, 3526, 2251, 5131, 3489, 1104, 5829, 2734, 328, 5695, 4675,
+    5007, 4830, 2064, 3634, 4551, 5058, 4200, 1887, 1383, 4592, 3743, 651, 2494, 2515, 2589, 684,
+    3222, 3928, 3958, 5280, 2307, 5474, 1080, 4445, 4523, 3596, 3645, 2106, 1095, 1531, 3138, 2173,
+    4358, 5181, 3999, 3091, 2030, 1407, 4541, 1044, 4712, 4074, 4172, 5680, 4832, 2760, 717, 3115,
+    590, 757, 267, 2362, 2352, 5543, 6125, 2733, 2145, 319, 2451, 969, 1777, 5869, 4263, 5965,
+    2580, 3450, 33, 3096, 3510, 4543, 3727, 5901, 86, 4927, 4255, 5197, 3607, 1070, 609, 1330,
+    2811, 761, 2984, 1, 897, 4744, 2607, 1166, 4729, 5758, 4527, 2103, 5284, 3564, 2505, 2638,
+    2042, 2522, 2116, 3269, 2871, 210, 3306, 6010, 1924, 4911, 1791, 5493, 843, 1504, 4895, 50,
+    2894, 3938, 5780, 747, 3133, 4518, 4889, 3629, 2530, 6164, 920, 3123, 5360, 5466, 23, 2903,
+    2873, 4236, 3209, 3570, 1151, 3703, 5278, 2256, 1673, 5204, 2230, 5607, 3971, 1982, 1645, 1013,
+    1362, 2680, 5256, 62, 2037, 4884, 438, 4521, 5896, 146, 4859, 2717, 5845, 2893, 1770, 3568,
+    1657, 2550, 289, 2201, 1539, 3409, 4246, 4000, 721, 6063, 5819, 3779, 5321, 5359, 4590, 2297,
+    4861, 4669, 738, 2150, 5408, 1410, 5611, 2260, 5509, 1611, 4778, 3827, 5517, 2730, 778, 5242,
+    3397, 1744, 4868, 1130, 381, 634, 4037, 3458, 5266, 1649, 2938, 2585, 1255, 3766, 1059, 358,
+    1636, 2909, 1435, 5297, 3734, 1250, 3136, 340, 5275, 2573, 3916, 2286, 3595, 3031, 5160, 1291,
+    428, 4932, 5724, 447, 5665, 1895, 2264, 4434, 3336, 4369, 719, 5757, 5587, 2508, 125, 526,
+    4209, 3536, 3126, 4047, 4239, 3558, 2054, 5457, 6145, 5727, 6093, 5240, 4770, 3588, 2520, 1553,
+    4259, 193, 5530, 5018, 459, 2461, 4865, 4287, 1098, 3798, 4672, 2533, 1392, 4020, 2166, 4206,
+    3212, 3073, 607, 3845, 43, 2697, 1048, 673, 711, 2126, 4750, 2782, 4046, 1225, 2220, 5456,
+    1235, 3521, 3464, 3648, 971, 2082, 4833, 3644, 2324, 1958, 272, 3748, 1135, 1710, 4134, 5718,
+    2528, 5087, 6058, 5499, 5721, 1913, 2469, 1682, 6196, 2929, 5983, 3165, 544, 4071, 383, 5808,
+    4998, 2439, 488, 2845, 3206, 4308, 2692, 692, 500, 2780, 127, 2273, 3039, 5163, 1903, 2357,
+    4720, 5221, 6205, 4699, 1057, 2337, 4913, 1441, 1587, 3716, 985, 670, 1405, 1442, 887, 5132,
+    6200, 899, 3788, 2479, 5926, 3407, 4616, 5788, 3279, 6160, 2422, 2194, 4668, 5342, 5516, 3345,
+    1214, 1614, 653, 6078, 2359, 422, 1389, 2558, 2390, 136, 5857, 3628, 3270, 2831, 3959, 1787,
+    13, 368, 5482, 6084, 6061, 3758, 1029, 6174, 4809, 1867, 5258, 1247, 5002, 2687, 1161, 5248,
+    443, 3119, 4695, 5999, 128, 5003, 5728, 4734, 1810, 5496, 3818, 1821, 1012, 5563, 1063, 2846,
+    3285, 3711, 1053, 1073, 5513, 4947, 2498, 1909, 5023, 2416, 4646, 556, 4124, 1584, 3656, 5083,
+    5449, 5649, 5056, 5267, 1833, 707, 3051, 1184, 5139, 1043, 4815, 1344, 2242, 5574, 5735, 3807,
+    3888, 1630, 3330, 1656, 4582, 2323, 3535, 4538, 5818, 3077, 4453, 699, 2125, 2159, 4133, 5505,
+    6059, 3022, 2216, 5830, 537, 320, 3726, 1418, 4411, 885, 2367, 330, 640, 2994, 2174, 2798,
+    3305, 5461, 5948, 1693, 4628, 399, 4838, 5345, 4640, 4938, 2745, 4402, 732, 4756, 4585, 5630,
+    5200, 1771, 45, 3592, 4452, 3961, 6134, 69, 3516, 4153, 2703, 3856, 262, 514, 1722, 3068,
+    3951, 2924, 1741, 2467, 3605, 5817, 3408, 1854, 3771, 10, 4262, 380, 2146, 2658, 1878, 82,
+    4319, 1762, 2358, 2563, 916, 1629, 584, 5637, 3083, 5362, 4945, 3048, 2868, 5338, 875, 5585,
+    5998, 1652, 4974, 5373, 2344, 3032, 2408, 2855, 2725, 3649, 393, 6018, 3340, 5129, 175, 656,
+    51, 945, 2568, 3810, 2655, 1186, 6064, 3160, 5313, 4924, 1654, 4439, 4150, 2591, 4497, 5301,
+    1740, 835, 2621, 3987, 4728, 4360, 1474, 1163, 617, 594, 1509, 4879, 3318, 1973, 2168, 6195,
+    1100, 1914, 4926, 4093, 4753, 2553, 5514, 4630, 2265, 3576, 765, 6022, 2112, 5046, 4772, 2856,
+    1209, 433, 3811, 1304, 317, 3715, 39, 403, 314, 5141, 2409, 2202, 415, 5658, 1715, 213,
+    5182, 3420, 3750, 4309, 2491, 5666, 1869, 4054, 6100, 930, 3286, 2122, 5481, 846, 559, 3571,
+    5873, 3317, 4040, 4065, 2802, 395, 2879, 5615, 3975, 1841, 4941, 5553, 934, 5059, 3615, 975,
+    1518, 4848, 5579, 1766, 2057, 3554, 4659, 603, 859, 5433, 5281, 3398, 1820, 1480, 2915, 4462,
+    2882, 2656, 2470, 4296, 4588, 2631, 3729, 4024, 3707, 2013, 1750, 4792, 4804, 4487, 5369, 3824,
+    5105, 1396, 4477, 3537, 1348, 1084, 2482, 1440, 5149, 3355, 5495, 3255, 416, 2647, 4430, 637,
+    2087, 5980, 1267, 3440, 3523, 5354, 5208, 1083, 1437, 6140, 5931, 1459, 1742, 3813, 5569, 3892,
+    2424, 4382, 4069, 5410, 1505, 1241, 168, 2195, 5244, 4761, 4173, 1907, 5807, 5323, 4839, 612,
+    3614, 2953, 2979, 1725, 5504, 1265, 5374, 5876, 2118, 2471, 5691, 2973, 2708, 17, 2857, 4105,
+    744, 5405, 3782, 1729, 4731, 4334, 2665, 2590, 3600, 2142, 3573, 452, 439, 310, 4330, 212,
+    6065, 2509, 4072, 231, 57, 5634, 1892, 4737, 2543, 507, 4242, 5049, 2060, 957, 6198, 4754,
+    1022, 3713, 5590, 3276, 669, 3038, 3020, 918, 3363, 5580, 401, 1703, 143, 1514, 1446, 4012,
+    29, 70, 1393, 5045, 6146, 1376, 285, 3135, 4314, 3800, 1378, 4270, 1952, 2750, 2844, 227,
+    3175, 3496, 4080, 4025, 5383, 3057, 4469, 1277, 4987, 4903, 1120, 2560, 4406, 943, 3223, 1826,
+    5061, 4504, 5292, 281, 1948, 5922, 4594, 5203, 2393, 3802, 2812, 1297, 4856, 743, 2080, 4563,
+    2066, 1067, 2555, 59, 1354, 3141, 2419, 2705, 1213, 5450, 1069, 1221, 250, 2898, 4274, 2816,
+    4671, 646, 5923, 2859, 4125, 32, 1633, 4294, 808, 95, 4168, 5164, 4509, 2636, 954, 2667,
+    233, 5805, 5511, 1251, 5950, 3920, 4574, 1576, 1129, 973, 2293, 5238, 1580, 6189, 562, 5659,
+    204, 5613, 3539, 2869, 461, 2429, 4533, 2460, 1160, 1858, 5064, 1092, 5657, 5605, 3603, 1702,
+    3401, 1817, 3475, 6181, 2540, 5286, 730, 2672, 4169, 813, 4805, 5285, 5549, 3962, 2854, 4378,
+    2090, 2577, 1527, 585, 729, 1185, 3399, 4289, 1670, 2626, 1743, 6090, 1647, 600, 4062, 2321,
+    3610, 518, 2499, 2997, 1351, 1342, 2438, 2570, 4132, 528, 4992, 2830, 6147, 6121, 4225, 4844,
+    6048, 691, 3953, 5300, 1937, 4495, 1138, 3287, 2971, 6193, 1432, 748, 6186, 1598, 5441, 618,
+    2678, 263, 1651, 3177, 1062, 1963, 3228, 1847, 3846, 2731, 5714, 444, 3468, 1054, 2111, 3100,
+    4623, 4822, 539, 6110, 2565, 1561, 5535, 2887, 5643, 5190, 123, 1454, 826, 4796, 595, 2988,
+    821, 5846, 4988, 2041, 408, 4665, 3036, 5099, 3548, 1582, 5771, 547, 4730, 2960, 3386, 3660,
+    712, 4685, 463, 113, 3837, 5626, 1131, 1541, 1663, 4581, 5156, 3023, 238, 1143, 5865, 2995,
+    1106, 2778, 198, 2420, 1450, 2807, 2253, 3893, 4735, 1857, 4918, 3891, 3790, 767, 4933, 4389,
+    1420, 4459, 3529, 3076, 2244, 566, 1234, 6103, 1467, 3065, 929, 3785, 5878, 2144, 5522, 2267,
+    3246, 3957, 1934, 2302, 3483, 4273, 2330, 4864, 2534, 6173, 3611, 1513, 1873, 2025, 986, 678,
+    2549, 4925, 5491, 4311, 5702, 3826, 6046, 5375, 3681, 5591, 1125, 2662, 2714, 4494, 5032, 2581,
+    5155, 4915, 4362, 4136, 4261, 356, 4188, 5742, 1443, 379, 1644, 6075, 3689, 3266, 886, 3178,
+    758, 4009, 2765, 2925, 1372, 5713, 5541, 347, 1329, 797, 3372, 396, 4558, 5669, 5985, 5859,
+    4602, 1231, 2677, 6148, 2998, 3524, 2432, 2645, 1192, 2706, 2425, 1595, 3370, 84, 5519, 1688,
+    6053, 2493, 97, 5905, 1727, 2067, 6131, 2774, 435, 4409, 4478, 361, 363, 2320, 2598, 3722,
+    2009, 390, 3201, 4542, 2183, 2081, 789, 2472, 4187, 3547, 5437, 55, 1386, 2031, 437, 5892,
+    1992, 591, 3109, 1632, 5004, 2883, 4771, 4603, 68, 3086, 1060, 2551, 1341, 5889, 5767, 2156,
+    3815, 4335, 1507, 298, 5005, 6025, 2481, 2365, 5951, 6095, 3470, 819, 6041, 1502, 1684, 6185,
+    3812, 3061, 3550, 4506, 1681, 2098, 3787, 2952, 4269, 3686, 2624, 4324, 3653, 4954, 1763, 5047,
+    4999, 4546, 1429, 4219, 5772, 6194, 876, 5306, 3461, 4507, 475, 2381, 6101, 4244, 3364, 3944,
+    1223, 4068, 3390, 321, 2640, 4775, 4464, 3872, 4863, 6080, 1930, 4599, 5432, 1328, 816, 1597,
+    1217, 3712, 1939, 2532, 4550, 3028, 3563, 5427, 6055, 4857, 5709, 4820, 5798, 5026, 1809, 833,
+    1562, 3513, 6129, 391, 4310, 4743, 3710, 5598, 2102, 3844, 4126, 3704, 4354, 3067, 5211, 4784,
+    2177, 6152, 5080, 1049, 301, 1624, 1031, 1723, 245, 5107, 6177, 5135, 4159, 4118, 1281, 3299,
+    3422, 4466, 5723, 1020, 3728, 5372, 220, 1569, 4370, 6024, 2029, 4877, 1927, 5455, 1017, 5743,
+    3124, 3089, 3897, 4078, 4446, 5860, 176, 5719, 3741, 4634, 5444, 864, 4162, 5977, 5815, 6183,
+    4122, 1893, 2186, 110, 6085, 4717, 2982, 3910, 6135, 6201, 3453, 2947, 6137, 1908, 265, 5879,
+    156, 237, 432, 3186, 1705, 2689, 4440, 3232, 3218, 1718, 3456, 1923, 4107, 1515, 1551, 3157,
+    2397, 429, 5209, 5435, 5429, 2417, 6218, 2902, 282, 3514, 2192, 2346, 4203, 5385, 2681, 5490,
+    1404, 882, 5963, 3820, 3387, 2138, 5302, 874, 1966, 6213, 5609, 1640, 4161, 5823, 4066, 2450,
+    5096, 5976, 1400, 1363, 497, 1005, 947, 3445, 4608, 2917, 3923, 468, 1403, 1003, 2053, 3768,
+    4677, 3532, 2723, 5712, 5144, 3675, 2825, 5309, 374, 760, 6087, 242, 5178, 5055, 5881, 4624,
+    5413, 1040, 187, 5293, 3760, 4416, 3129, 5750, 3258, 1254, 908, 5667, 636, 4393, 1925, 4341,
+    2843, 2496, 2079, 2104, 4562, 1258, 6039, 998, 1717, 5930, 5883, 3025, 1137, 742, 3321, 6045,
+    5109, 786, 751, 2860, 4733, 1759, 5469, 1266, 5797, 2203, 3030, 8, 517, 284, 4545, 3544,
+    5384, 540, 1978, 1444, 5668, 2434, 3182, 2578, 4601, 3541, 2226, 1798, 2663, 1862, 3878, 482,
+    4500, 5560, 2957, 3113, 4525, 4962, 569, 178, 1897, 2529, 4474, 1491, 2870, 614, 1193, 4964,
+    4552, 5690, 2841, 4013, 177, 3257, 5685, 4837, 6170, 2776, 3753, 1928, 1568, 1112, 4234, 3511,
+    788, 844, 4119, 3808, 5850, 1814, 4931, 3725, 4888, 1343, 112, 2119, 2410, 5136, 1658, 4632,
+    2693, 6172, 1622, 5234, 4508, 3949, 4607, 1171, 6054, 2944, 149, 1967, 4914, 1572, 471, 5347,
+    868, 2567, 2157, 6197, 5981, 1495, 2015, 1276, 5100, 2446, 2476, 6191, 5448, 2926, 4146, 4587,
+    4641, 3695, 5227, 5089, 6050, 2890, 5366, 1592, 679, 5378, 240, 1272, 5215, 2720, 5568, 3774,
+    5114, 5406, 3865, 279, 6102, 4235, 5171, 1650, 3566, 3976, 5031, 2294, 4942, 4135, 1190, 803,
+    952, 4555, 3275, 1674, 5993, 4482, 1976, 3221, 4386, 5642, 2701, 5489, 3956, 490, 4073, 1487,
+    2022, 35, 5270, 4520, 6215, 1021, 4516, 4990, 1605, 5194, 2091, 1533, 3943, 1312, 2214, 4417,
+    2940, 5674, 4800, 5698, 4883, 6149, 2394, 2800, 2070, 3780, 520, 2537, 2664, 5773, 873, 4566,
+    377, 201, 3700, 1642, 648, 4180, 207, 1980, 3376, 5803, 2248, 641, 1126, 2564, 1866, 1237,
+    4101, 4403, 1918, 5840, 4656, 3411, 5396, 424, 941, 3751, 4375, 4658, 1030, 3967, 1198, 5452,
+    1516, 2576, 3271, 5382, 3520, 3004, 2170, 5678, 6060, 5028, 4128, 1168, 2139, 1215, 1524, 4367,
+    3481, 4956, 3381, 2643, 4355, 2975, 5520, 3000, 1608, 6209, 2945, 904, 5199, 306, 4425, 6011,
+    1589, 3045, 2272, 1666, 2983, 4803, 3597, 5075, 3444, 1201, 5759, 241, 1261, 3947, 5633, 6150,
+    1027, 4384, 5198, 1124, 2363, 1696, 2223, 3103, 3322, 3594, 2375, 2744, 141, 582, 1900, 4617,
+    2003, 2629, 806, 5118, 1448, 2535, 1780, 1000, 5789, 3056, 1447, 4536, 5653, 2948, 3505, 5054,
+    1890, 4094, 5130, 5303, 4357, 1834, 831, 75, 4798, 4130, 2285, 5148, 6163, 604, 1901, 2185,
+    3164, 5428, 181, 357, 4850, 5538, 1612, 4163, 6120, 2228, 1695, 1922, 3701, 1653, 5946, 5503,
+    2608, 1178, 4986, 4241, 3915, 1886, 814, 4058, 5170, 4280, 1523, 553, 90, 2018, 1837, 5828,
+    3112, 1596, 2803, 74, 5128, 2911, 4979, 4544, 4388, 3118, 2501, 3357, 2072, 2700, 4571, 41,
+    477, 2749, 4680, 1680, 4368, 2804, 5022, 1593, 1812, 5623, 4022, 2311, 5664, 2552, 1366, 4618,
+    2172, 1888, 486, 3797, 4769, 4381, 5294, 2153, 3870, 5436, 1307, 2176, 5935, 4880, 2021, 2808,
+    81, 6187, 224, 185, 5652, 5957, 5279, 2908, 2889, 3098, 715, 5419, 1979, 5586, 994, 3277,
+    891, 180, 5095, 675, 1831, 2148, 5675, 3242, 1208, 5494, 3877, 315, 1559, 203, 1968, 5304,
+    1398, 676, 1933, 2345, 3980, 2595, 4762, 1902, 1350, 2969, 169, 3203, 3598, 2275, 1279, 4002,
+    5967, 1956, 4138, 3613, 1473, 1268, 130, 1416, 4969, 1308, 5113, 5353, 2941, 3229, 2587, 5971,
+    2972, 5468, 3759, 5188, 1232, 1082, 4966, 3755, 1832, 2951, 561, 4213,
+};
+
+#endif // _QC_DM_NV_CATALOGUE_HASH_H_
@@ -0,0 +1,249 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_nv_sparsity_map.cpp
+* @class OpenPST::DmNvSparsityMap
+* @package OpenPST
+* @brief Which NV items of a device model hold data, learned from earlier reads
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "dm_nv_sparsity_map.h"
+
+using namespace OpenPST;
+
+/**
+* @brief DmNvSparsityMap - Constructor, every item starts unknown
+*
+* @param std::string model
+*/
+DmNvSparsityMap::DmNvSparsityMap(std::string model) :
+    model(model),
+    sweeps(0),
+    states(DM_NV_SPARSITY_MAP_ITEMS, kDmNvItemUnknown)
+{
+
+}
+
+/**
+* @brief ~DmNvSparsityMap - Deconstructor
+*/
+DmNvSparsityMap::~DmNvSparsityMap()
+{
+
+}
+
+/**
+* @brief getModelKey - Key maps by the version directory and model number
+*
+* @param QcdmVersionResponse& version
+* @return std::string
+*/
+std::string DmNvSparsityMap::getModelKey(const QcdmVersionResponse& version)
+{
+    std::string key;
+    char tmp[8];
+
+    for (size_t i = 0; i < sizeof(version.ver_dir) && version.ver_dir[i]; i++) {
+        char c = version.ver_dir[i];
+
+        // the key ends up in a file name
+        if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' || c == '_') {
+            key += c;
+        }
+    }
+
+    snprintf(tmp, sizeof(tmp), "-%d", version.model);
+
+    return key + tmp;
+}
+
+/**
+* @brief getModel
+*
+* @return std::string
+*/
+std::string DmNvSparsityMap::getModel()
+{
+    return model;
+}
+
+/**
+* @brief getSweeps - Reads recorded into the map
+*
+* @return uint32_t
+*/
+uint32_t DmNvSparsityMap::getSweeps()
+{
+    return sweeps;
+}
+
+/**
+* @brief getState
+*
+* @param uint16_t item
+* @return DmNvItemState
+*/
+DmNvItemState DmNvSparsityMap::getState(uint16_t item)
+{
+    return (DmNvItemState)states[item];
+}
+
+/**
+* @brief record - Update an item from a read result, the latest answer wins
+*
+* @param DmNvBulkResult& result
+* @return void
+*/
+void DmNvSparsityMap::record(const DmNvBulkResult& result)
+{
+    switch (result.status) {
+        case kDmNvBulkOk:
+            states[result.item] = kDmNvItemActive;
+            break;
+        case kDmNvBulkNvError:
+            if (result.nvStatus == kQcdmNvStatusInactive || result.nvStatus == kQcdmNvStatusNotAllocated ||
+                result.nvStatus == kQcdmNvStatusBadType
+            ) {
+                states[result.item] = kDmNvItemInactive;
+            }
+            break;
+        case kDmNvBulkRejected:
+            // locked devices reject everything, that says nothing about the item
+            if (result.command == DIAG_BAD_PARM_F) {
+                states[result.item] = kDmNvItemRejected;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+* @brief finishSweep - Count a finished read
+*
+* @return void
+*/
+void DmNvSparsityMap::finishSweep()
+{
+    sweeps++;
+}
+
+/**
+* @brief filter - Drop items known to be inactive or rejected
+*
+* @param std::vector<uint16_t>& items
+* @return size_t - Items dropped
+*/
+size_t DmNvSparsityMap::filter(std::vector<uint16_t>& items)
+{
+    size_t count = items.size();
+
+    items.erase(std::remove_if(items.begin(), items.end(), [this](uint16_t item) {
+        return states[item] == kDmNvItemInactive || states[item] == kDmNvItemRejected;
+    }), items.end());
+
+    return count - items.size();
+}
+
+/**
+* @brief load - Load a map written by save
+*
+* @param std::string filePath
+* @return bool
+*/
+bool DmNvSparsityMap::load(std::string filePath)
+{
+    DmNvSparsityMapHeader header = {};
+    DmNvSparsityMapEntry entry;
+
+    std::ifstream file(filePath.c_str(), std::ios::in | std::ios::binary);
+
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file.read((char*)&header, sizeof(header));
+
+    if (!file.good() || header.magic != DM_NV_SPARSITY_MAP_MAGIC || header.version != DM_NV_SPARSITY_MAP_VERSION ||
+        header.headerSize < sizeof(header) || header.runCount > DM_NV_SPARSITY_MAP_ITEMS
+    ) {
+        LOGE("%s is not an NV sparsity map\n", filePath.c_str());
+        return false;
+    }
+
+    file.seekg(header.headerSize, file.beg);
+
+    std::vector<uint8_t> loaded(DM_NV_SPARSITY_MAP_ITEMS, kDmNvItemUnknown);
+
+    for (uint32_t i = 0; i < header.runCount; i++) {
+        if (!file.read((char*)&entry, sizeof(entry))) {
+            LOGE("%s is truncated\n", filePath.c_str());
+            return false;
+        }
+
+        if (entry.state > kDmNvItemRejected || entry.first > entry.last) {
+            continue;
+        }
+
+        std::fill(loaded.begin() + entry.first, loaded.begin() + entry.last + 1, entry.state);
+    }
+
+    states.swap(loaded);
+
+    model  = std::string(header.model, strnlen(header.model, sizeof(header.model)));
+    sweeps = header.sweeps;
+
+    return true;
+}
+
+/**
+* @brief save
+*
+* @param std::string filePath
+* @return bool
+*/
+bool DmNvSparsityMap::save(std::string filePath)
+{
+    DmNvSparsityMapHeader header = {};
+    std::vector<DmNvSparsityMapEntry> entries;
+
+    for (uint32_t i = 0; i < DM_NV_SPARSITY_MAP_ITEMS;) {
+        uint32_t last = i;
+
+        while (last + 1 < DM_NV_SPARSITY_MAP_ITEMS && states[last + 1] == states[i]) {
+            last++;
+        }
+
+        if (states[i] != kDmNvItemUnknown) {
+            DmNvSparsityMapEntry entry = { (uint16_t)i, (uint16_t)last, states[i], 0 };
+            entries.push_back(entry);
+        }
+
+        i = last + 1;
+    }
+
+    std::ofstream file(filePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open()) {
+        LOGE("Could not open %s\n", filePath.c_str());
+        return false;
+    }
+
+    header.magic        = DM_NV_SPARSITY_MAP_MAGIC;
+    header.version      = DM_NV_SPARSITY_MAP_VERSION;
+    header.headerSize   = sizeof(header);
+    header.runCount     = entries.size();
+    header.sweeps       = sweeps;
+
+    std::memcpy(header.model, model.c_str(), model.size() < sizeof(header.model) ? model.size() : sizeof(header.model) - 1);
+
+    file.write((char*)&header, sizeof(header));
+
+    if (entries.size()) {
+        file.write((char*)&entries[0], entries.size() * sizeof(DmNvSparsityMapEntry));
+    }
+
+    return file.good();
+}
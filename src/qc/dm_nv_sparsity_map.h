@@ -0,0 +1,161 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_nv_sparsity_map.h
+* @class OpenPST::DmNvSparsityMap
+* @package OpenPST
+* @brief Which NV items of a device model hold data, learned from earlier reads
+*
+* Most of the 0 - 65535 item range comes back inactive or rejected, and which
+* items do is close to identical across units of the same model. Results of
+* previous reads are kept per model so range reads can skip the dead items,
+* and a full sweep refreshes them.
+*
+* Layout, all values little endian:
+*
+*   [DmNvSparsityMapHeader][DmNvSparsityMapEntry x runCount]
+*
+* where each entry is a run of consecutive items in the same state, sorted by
+* item id. Unknown items are not stored, and the long dead ranges collapse to a
+* single entry, so maps stay small enough to ship with the tool.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_NV_SPARSITY_MAP_H_
+#define _QC_DM_NV_SPARSITY_MAP_H_
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "include/definitions.h"
+#include "qc/dm.h"
+#include "qc/dm_nv_bulk_reader.h"
+
+#define DM_NV_SPARSITY_MAP_MAGIC            0x4D53564E // NVSM
+#define DM_NV_SPARSITY_MAP_VERSION          1
+#define DM_NV_SPARSITY_MAP_MODEL_LENGTH     32
+#define DM_NV_SPARSITY_MAP_ITEMS            0x10000
+
+namespace OpenPST {
+
+    enum DmNvItemState : uint8_t {
+        kDmNvItemUnknown  = 0,
+        kDmNvItemActive   = 1, // returned data
+        kDmNvItemInactive = 2, // NV status inactive, not allocated or not defined for the target
+        kDmNvItemRejected = 3  // bad parameter response
+    };
+
+    PACKED(typedef struct {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t headerSize;
+        uint32_t runCount;
+        uint32_t sweeps;        // reads recorded into the map
+        char     model[DM_NV_SPARSITY_MAP_MODEL_LENGTH]; // null padded
+    }) DmNvSparsityMapHeader;
+
+    PACKED(typedef struct {
+        uint16_t first;
+        uint16_t last;          // inclusive
+        uint8_t  state;         // DmNvItemState
+        uint8_t  reserved;
+    }) DmNvSparsityMapEntry;
+
+    /**
+    * @brief OpenPST::DmNvSparsityMap
+    */
+    class DmNvSparsityMap {
+        public:
+            /**
+            * @brief DmNvSparsityMap - Constructor, every item starts unknown
+            *
+            * @param std::string model
+            */
+            DmNvSparsityMap(std::string model = "");
+
+            /**
+            * @brief ~DmNvSparsityMap - Deconstructor
+            */
+            ~DmNvSparsityMap();
+
+            /**
+            * @brief getModelKey - Key maps by the version directory and model number
+            *
+            * @param QcdmVersionResponse& version
+            * @return std::string
+            */
+            static std::string getModelKey(const QcdmVersionResponse& version);
+
+            /**
+            * @brief getModel
+            *
+            * @return std::string
+            */
+            std::string getModel();
+
+            /**
+            * @brief getSweeps - Reads recorded into the map
+            *
+            * @return uint32_t
+            */
+            uint32_t getSweeps();
+
+            /**
+            * @brief getState
+            *
+            * @param uint16_t item
+            * @return DmNvItemState
+            */
+            DmNvItemState getState(uint16_t item);
+
+            /**
+            * @brief record - Update an item from a read result, the latest answer
+            * wins. No response and port errors say nothing about the item and are ignored
+            *
+            * @param DmNvBulkResult& result
+            * @return void
+            */
+            void record(const DmNvBulkResult& result);
+
+            /**
+            * @brief finishSweep - Count a finished read
+            *
+            * @return void
+            */
+            void finishSweep();
+
+            /**
+            * @brief filter - Drop items known to be inactive or rejected
+            *
+            * @param std::vector<uint16_t>& items
+            * @return size_t - Items dropped
+            */
+            size_t filter(std::vector<uint16_t>& items);
+
+            /**
+            * @brief load - Load a map written by save
+            *
+            * @param std::string filePath
+            * @return bool
+            */
+            bool load(std::string filePath);
+
+            /**
+            * @brief save
+            *
+            * @param std::string filePath
+            * @return bool
+            */
+            bool save(std::string filePath);
+
+        private:
+            std::string model;
+            uint32_t sweeps;
+            std::vector<uint8_t> states;
+    };
+}
+
+#endif // _QC_DM_NV_SPARSITY_MAP_H_
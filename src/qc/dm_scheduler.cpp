@@ -0,0 +1,607 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_scheduler.cpp
+* @class OpenPST::DmScheduler
+* @package OpenPST
+* @brief Priority command scheduler for a shared diagnostic monitor port
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "dm_scheduler.h"
+
+using namespace OpenPST;
+
+/**
+* @brief DmSchedulerJob - Constructor
+*
+* @param DmSchedulerClass priority
+* @param DmSchedulerTask task
+*/
+DmSchedulerJob::DmSchedulerJob(DmSchedulerClass priority, DmSchedulerTask task) :
+    priority(priority),
+    task(task),
+    cancelled(false),
+    status(kDmSchedulerJobQueued),
+    slices(0),
+    submitted(std::chrono::steady_clock::now()),
+    ready(submitted)
+{
+
+}
+
+/**
+* @brief cancel - Ask the job to stop, it finishes at the end of its current slice
+*
+* @return void
+*/
+void DmSchedulerJob::cancel()
+{
+    cancelled = true;
+}
+
+/**
+* @brief isCancelled
+*
+* @return bool
+*/
+bool DmSchedulerJob::isCancelled()
+{
+    return cancelled;
+}
+
+/**
+* @brief getStatus
+*
+* @return DmSchedulerJobStatus
+*/
+DmSchedulerJobStatus DmSchedulerJob::getStatus()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return status;
+}
+
+/**
+* @brief getError
+*
+* @return std::string
+*/
+std::string DmSchedulerJob::getError()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return error;
+}
+
+/**
+* @brief getSlices
+*
+* @return uint32_t
+*/
+uint32_t DmSchedulerJob::getSlices()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return slices;
+}
+
+/**
+* @brief wait - Wait for the job to finish
+*
+* @param int timeout - ms, -1 waits forever
+*
+* @return bool
+*/
+bool DmSchedulerJob::wait(int timeout)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    auto done = [this]() {
+        return status != kDmSchedulerJobQueued && status != kDmSchedulerJobRunning;
+    };
+
+    if (timeout < 0) {
+        finished.wait(lock, done);
+        return true;
+    }
+
+    return finished.wait_for(lock, std::chrono::milliseconds(timeout), done);
+}
+
+/**
+* @brief finish - Set the final status and wake up waiters
+*/
+void DmSchedulerJob::finish(DmSchedulerJobStatus status, const std::string& error)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        this->status = status;
+        this->error  = error;
+    }
+
+    finished.notify_all();
+}
+
+/**
+* @brief DmSchedulerSlice - Constructor
+*
+* @param QcdmSerial& port
+* @param DmSchedulerJob& job
+* @param std::chrono::steady_clock::time_point deadline
+*/
+DmSchedulerSlice::DmSchedulerSlice(QcdmSerial& port, DmSchedulerJob& job, std::chrono::steady_clock::time_point deadline) :
+    port(port),
+    job(job),
+    deadline(deadline)
+{
+
+}
+
+/**
+* @brief isExpired
+*
+* @return bool
+*/
+bool DmSchedulerSlice::isExpired()
+{
+    return std::chrono::steady_clock::now() >= deadline;
+}
+
+/**
+* @brief isCancelled
+*
+* @return bool
+*/
+bool DmSchedulerSlice::isCancelled()
+{
+    return job.isCancelled();
+}
+
+/**
+* @brief isFirst
+*
+* @return bool
+*/
+bool DmSchedulerSlice::isFirst()
+{
+    // only the scheduler thread changes the count, and it is running this slice
+    return job.slices == 0;
+}
+
+/**
+* @brief DmScheduler - Constructor
+*
+* @param QcdmSerial& port
+* @param int sliceBudget - ms
+*/
+DmScheduler::DmScheduler(QcdmSerial& port, int sliceBudget) :
+    port(port),
+    running(false),
+    sliceBudget(sliceBudget),
+    bulkRun(0)
+{
+    memset(stats, 0x00, sizeof(stats));
+}
+
+/**
+* @brief ~DmScheduler - Deconstructor, stops the scheduler thread
+*/
+DmScheduler::~DmScheduler()
+{
+    stop();
+}
+
+/**
+* @brief start - Start the scheduler thread
+*
+* @return bool - false if already running
+*/
+bool DmScheduler::start()
+{
+    if (worker.joinable()) {
+        return false;
+    }
+
+    running = true;
+
+    worker = std::thread(&DmScheduler::loop, this);
+
+    return true;
+}
+
+/**
+* @brief stop - Cancel every job and stop the scheduler thread once the running slice returns
+*
+* @return void
+*/
+void DmScheduler::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        running = false;
+
+        if (current) {
+            current->cancel();
+        }
+    }
+
+    wake.notify_all();
+
+    if (worker.joinable()) {
+        worker.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (int i = 0; i < kDmSchedulerClassCount; i++) {
+        while (queues[i].size()) {
+            DmSchedulerJobHandle job = queues[i].front();
+            queues[i].pop_front();
+            record(*job, kDmSchedulerJobCancelled);
+        }
+    }
+}
+
+/**
+* @brief isRunning
+*
+* @return bool
+*/
+bool DmScheduler::isRunning()
+{
+    return running;
+}
+
+/**
+* @brief submit - Queue a job, jobs submitted before start() wait for it
+*
+* @param DmSchedulerClass priority
+* @param DmSchedulerTask task
+*
+* @return DmSchedulerJobHandle
+*/
+DmSchedulerJobHandle DmScheduler::submit(DmSchedulerClass priority, DmSchedulerTask task)
+{
+    DmSchedulerJobHandle job(new DmSchedulerJob(priority, task));
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queues[priority].push_back(job);
+    }
+
+    wake.notify_one();
+
+    return job;
+}
+
+/**
+* @brief run - Queue a job and wait for it
+*
+* @param DmSchedulerClass priority
+* @param DmSchedulerTask task
+*
+* @return DmSchedulerJobStatus
+*/
+DmSchedulerJobStatus DmScheduler::run(DmSchedulerClass priority, DmSchedulerTask task)
+{
+    DmSchedulerJobHandle job = submit(priority, task);
+
+    job->wait();
+
+    return job->getStatus();
+}
+
+/**
+* @brief setSliceBudget
+*
+* @param int sliceBudget - ms
+*
+* @return void
+*/
+void DmScheduler::setSliceBudget(int sliceBudget)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    this->sliceBudget = sliceBudget;
+}
+
+/**
+* @brief getStats
+*
+* @param DmSchedulerClass priority
+*
+* @return DmSchedulerStats
+*/
+DmSchedulerStats DmScheduler::getStats(DmSchedulerClass priority)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return stats[priority];
+}
+
+/**
+* @brief resetStats
+*
+* @return void
+*/
+void DmScheduler::resetStats()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    memset(stats, 0x00, sizeof(stats));
+}
+
+/**
+* @brief loop - Scheduler thread
+*/
+void DmScheduler::loop()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (running) {
+        DmSchedulerJobHandle job = pick();
+
+        if (!job) {
+            wake.wait(lock);
+            continue;
+        }
+
+        if (job->isCancelled()) {
+            // never got to run, or cancelled while waiting for its next slice
+            record(*job, kDmSchedulerJobCancelled);
+            continue;
+        }
+
+        DmSchedulerStats& classStats = stats[job->priority];
+        auto start = std::chrono::steady_clock::now();
+        uint64_t wait = micros(job->ready, start);
+
+        classStats.waitTotal += wait;
+
+        if (wait > classStats.waitMax) {
+            classStats.waitMax = wait;
+        }
+
+        {
+            std::lock_guard<std::mutex> jobLock(job->mutex);
+            job->status = kDmSchedulerJobRunning;
+        }
+
+        DmSchedulerSlice slice(port, *job, start + std::chrono::milliseconds(sliceBudget));
+
+        current = job;
+
+        lock.unlock();
+
+        bool more = false;
+        bool failed = false;
+        std::string error;
+
+        try {
+            more = job->task(slice);
+        } catch (std::exception& e) {
+            failed = true;
+            error  = e.what();
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        uint64_t elapsed = micros(start, end);
+
+        {
+            std::lock_guard<std::mutex> jobLock(job->mutex);
+            job->slices++;
+        }
+
+        if (failed || !more || job->isCancelled()) {
+            // whatever the task holds is let go of here, on the thread that owns the port
+            job->task = DmSchedulerTask();
+        }
+
+        lock.lock();
+
+        current.reset();
+
+        classStats.slices++;
+        classStats.sliceTotal += elapsed;
+
+        if (elapsed > classStats.sliceMax) {
+            classStats.sliceMax = elapsed;
+        }
+
+        if (failed) {
+            record(*job, kDmSchedulerJobFailed, error);
+        } else if (job->isCancelled()) {
+            record(*job, kDmSchedulerJobCancelled);
+        } else if (!more) {
+            record(*job, kDmSchedulerJobDone);
+        } else {
+            // back of its class, so jobs of the same class take turns
+            job->ready = end;
+            queues[job->priority].push_back(job);
+        }
+    }
+}
+
+/**
+* @brief pick - Take the next job to run a slice of, with the mutex held
+*
+* @return DmSchedulerJobHandle - nullptr if nothing is queued
+*/
+DmSchedulerJobHandle DmScheduler::pick()
+{
+    std::deque<DmSchedulerJobHandle>* queue = nullptr;
+
+    if (queues[kDmSchedulerInteractive].size()) {
+        queue = &queues[kDmSchedulerInteractive];
+    } else if (queues[kDmSchedulerBulk].size() && (!queues[kDmSchedulerBackground].size() || bulkRun < DM_SCHEDULER_BACKGROUND_SHARE)) {
+        if (queues[kDmSchedulerBackground].size()) {
+            bulkRun++;
+        }
+
+        queue = &queues[kDmSchedulerBulk];
+    } else if (queues[kDmSchedulerBackground].size()) {
+        bulkRun = 0;
+        queue = &queues[kDmSchedulerBackground];
+    }
+
+    if (!queue) {
+        return nullptr;
+    }
+
+    DmSchedulerJobHandle job = queue->front();
+
+    queue->pop_front();
+
+    return job;
+}
+
+/**
+* @brief record - Account a finished job, with the mutex held
+*/
+void DmScheduler::record(DmSchedulerJob& job, DmSchedulerJobStatus status, const std::string& error)
+{
+    DmSchedulerStats& classStats = stats[job.priority];
+    uint64_t response = micros(job.submitted, std::chrono::steady_clock::now());
+
+    classStats.jobs++;
+    classStats.responseTotal += response;
+
+    if (response > classStats.responseMax) {
+        classStats.responseMax = response;
+    }
+
+    if (status == kDmSchedulerJobCancelled) {
+        classStats.cancelled++;
+    } else if (status == kDmSchedulerJobFailed) {
+        classStats.failed++;
+    }
+
+    job.finish(status, error);
+}
+
+/**
+* @brief micros - Microseconds between two points
+*/
+uint64_t DmScheduler::micros(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+}
+
+/**
+* @brief nvReadTask - Read NV items a slice at a time
+*
+* @param std::vector<uint16_t>& items
+* @param size_t window
+* @param std::function<void(const DmNvBulkResult&)> callback
+*
+* @return DmSchedulerTask
+*/
+DmSchedulerTask DmScheduler::nvReadTask(const std::vector<uint16_t>& items, size_t window, std::function<void(const DmNvBulkResult& result)> callback)
+{
+    // made on the first slice, the port is only known then
+    std::shared_ptr<std::unique_ptr<DmNvBulkReader>> reader(new std::unique_ptr<DmNvBulkReader>());
+
+    return [items, window, callback, reader](DmSchedulerSlice& slice) -> bool {
+        DmNvBulkResult result;
+
+        if (!*reader) {
+            reader->reset(new DmNvBulkReader(slice.port, window));
+            (*reader)->start(items);
+        }
+
+        while (!slice.isExpired() && !slice.isCancelled()) {
+            if (!(*reader)->next(result)) {
+                return false;
+            }
+
+            callback(result);
+        }
+
+        // the next job must not read our responses
+        (*reader)->drain();
+
+        return !slice.isCancelled();
+    };
+}
+
+/**
+* @brief DmSchedulerLease - Constructor, waits for the port
+*
+* @param DmScheduler& scheduler
+* @param DmSchedulerClass priority
+*/
+DmSchedulerLease::DmSchedulerLease(DmScheduler& scheduler, DmSchedulerClass priority) :
+    scheduler(scheduler),
+    state(new State())
+{
+    std::thread::id self = std::this_thread::get_id();
+
+    state->held     = false;
+    state->released = false;
+
+    {
+        std::lock_guard<std::mutex> lock(scheduler.mutex);
+
+        // nested, or from a task, the port is already ours
+        if (!scheduler.running || scheduler.leaseHolder == self || scheduler.worker.get_id() == self) {
+            return;
+        }
+    }
+
+    std::shared_ptr<State> shared = state;
+
+    job = scheduler.submit(priority, [shared](DmSchedulerSlice& slice) -> bool {
+        std::unique_lock<std::mutex> lock(shared->mutex);
+
+        shared->held = true;
+        shared->changed.notify_all();
+
+        // parked until the holder is done, the slice budget does not apply
+        while (!shared->released && !slice.isCancelled()) {
+            shared->changed.wait_for(lock, std::chrono::milliseconds(DM_SCHEDULER_LEASE_POLL));
+        }
+
+        return false;
+    });
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+
+    // a job dropped by stop() never runs, the port is free then
+    while (!state->held && !job->wait(0)) {
+        state->changed.wait_for(lock, std::chrono::milliseconds(DM_SCHEDULER_LEASE_POLL));
+    }
+
+    lock.unlock();
+
+    std::lock_guard<std::mutex> schedulerLock(scheduler.mutex);
+
+    scheduler.leaseHolder = self;
+}
+
+/**
+* @brief ~DmSchedulerLease - Deconstructor, gives the port back to the scheduler
+*/
+DmSchedulerLease::~DmSchedulerLease()
+{
+    if (!job) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(scheduler.mutex);
+        scheduler.leaseHolder = std::thread::id();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->released = true;
+    }
+
+    state->changed.notify_all();
+
+    job->wait();
+}
@@ -0,0 +1,391 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file dm_scheduler.h
+* @class OpenPST::DmScheduler
+* @package OpenPST
+* @brief Priority command scheduler for a shared diagnostic monitor port
+*
+* Work on the port is submitted as jobs in one of three classes. A job is a
+* task called once per slice on the scheduler thread, which owns the port
+* while the scheduler runs. A slice does a bounded amount of work, checking
+* isExpired() on the slice it is given, and returns true while work is left.
+* Between two slices the scheduler picks the next job again, interactive jobs
+* first, so an interactive command never waits longer than the slice running
+* when it was submitted. Jobs of the same class take turns slice by slice,
+* and background jobs get a slice after DM_SCHEDULER_BACKGROUND_SHARE bulk
+* slices so a long sweep does not starve them.
+*
+* Each slice must leave nothing in flight when it returns, anything the next
+* job reads has to be an answer to its own requests. Pipelined readers call
+* drain() before returning, see nvReadTask().
+*
+* Cancelling is cooperative. A queued job is dropped without running, and a
+* running job sees isCancelled() on its slice and is not called again.
+*
+* Code that talks to the port directly rather than through a task, like the
+* commands of a window, holds a DmSchedulerLease around it instead.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_DM_SCHEDULER_H_
+#define _QC_DM_SCHEDULER_H_
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include "include/definitions.h"
+#include "qc/dm_nv_bulk_reader.h"
+#include "serial/qcdm_serial.h"
+
+/**
+* Time a bulk or background slice may run when no budget is given
+*/
+#define DM_SCHEDULER_DEFAULT_SLICE 50 // ms
+
+/**
+* Bulk slices run in a row before a waiting background job gets one
+*/
+#define DM_SCHEDULER_BACKGROUND_SHARE 4
+
+/**
+* How often a parked lease job checks for being cancelled
+*/
+#define DM_SCHEDULER_LEASE_POLL 10 // ms
+
+namespace OpenPST {
+
+    enum DmSchedulerClass {
+        kDmSchedulerInteractive = 0,    // user actions, served before anything else
+        kDmSchedulerBulk,               // NV sweeps, EFS crawls, memory dumps
+        kDmSchedulerBackground,         // polling and anything nobody waits on
+        kDmSchedulerClassCount
+    };
+
+    enum DmSchedulerJobStatus {
+        kDmSchedulerJobQueued = 0,
+        kDmSchedulerJobRunning,
+        kDmSchedulerJobDone,
+        kDmSchedulerJobCancelled,
+        kDmSchedulerJobFailed           // the task threw, see getError()
+    };
+
+    /**
+    * Latencies are in microseconds. Wait is the time a job was ready before
+    * its slice started, response is from submit until the job finished.
+    */
+    struct DmSchedulerStats {
+        uint64_t jobs;          // finished, whatever the status
+        uint64_t cancelled;
+        uint64_t failed;
+        uint64_t slices;
+        uint64_t waitTotal;
+        uint64_t waitMax;
+        uint64_t sliceTotal;
+        uint64_t sliceMax;
+        uint64_t responseTotal;
+        uint64_t responseMax;
+    };
+
+    class DmScheduler;
+    class DmSchedulerSlice;
+
+    /**
+    * Called once per slice, returns true while the job has work left. An
+    * exception fails the job, the port is assumed to still be usable.
+    */
+    typedef std::function<bool(DmSchedulerSlice& slice)> DmSchedulerTask;
+
+    /**
+    * @brief OpenPST::DmSchedulerJob - Handle of a submitted job
+    */
+    class DmSchedulerJob {
+        friend class DmScheduler;
+        friend class DmSchedulerSlice;
+
+        public:
+            /**
+            * @brief cancel - Ask the job to stop, it finishes at the end of its current slice
+            *
+            * @return void
+            */
+            void cancel();
+
+            /**
+            * @brief isCancelled
+            *
+            * @return bool
+            */
+            bool isCancelled();
+
+            /**
+            * @brief getStatus
+            *
+            * @return DmSchedulerJobStatus
+            */
+            DmSchedulerJobStatus getStatus();
+
+            /**
+            * @brief getError - Message of the exception that failed the job
+            *
+            * @return std::string
+            */
+            std::string getError();
+
+            /**
+            * @brief getSlices - Slices the job has run
+            *
+            * @return uint32_t
+            */
+            uint32_t getSlices();
+
+            /**
+            * @brief wait - Wait for the job to finish, must not be called from a task
+            *
+            * @param int timeout - ms, -1 waits forever
+            *
+            * @return bool - false if the job had not finished before the timeout
+            */
+            bool wait(int timeout = -1);
+
+        private:
+            DmSchedulerClass priority;
+            DmSchedulerTask task;
+            std::atomic<bool> cancelled;
+            std::mutex mutex;
+            std::condition_variable finished;
+            DmSchedulerJobStatus status;
+            std::string error;
+            uint32_t slices;
+            std::chrono::steady_clock::time_point submitted;
+            std::chrono::steady_clock::time_point ready;  // submitted, or the end of its last slice
+
+            DmSchedulerJob(DmSchedulerClass priority, DmSchedulerTask task);
+
+            /**
+            * @brief finish - Set the final status and wake up waiters
+            */
+            void finish(DmSchedulerJobStatus status, const std::string& error = "");
+    };
+
+    /**
+    * @brief OpenPST::DmSchedulerSlice - What a task gets to work with for one slice
+    */
+    class DmSchedulerSlice {
+        public:
+            QcdmSerial& port;
+
+            DmSchedulerSlice(QcdmSerial& port, DmSchedulerJob& job, std::chrono::steady_clock::time_point deadline);
+
+            /**
+            * @brief isExpired - true once the slice budget is used, the task should wind down and return
+            *
+            * @return bool
+            */
+            bool isExpired();
+
+            /**
+            * @brief isCancelled - true if the job was cancelled, the task should wind down and return false
+            *
+            * @return bool
+            */
+            bool isCancelled();
+
+            /**
+            * @brief isFirst - true on the first slice of the job
+            *
+            * @return bool
+            */
+            bool isFirst();
+
+        private:
+            DmSchedulerJob& job;
+            std::chrono::steady_clock::time_point deadline;
+    };
+
+    typedef std::shared_ptr<DmSchedulerJob> DmSchedulerJobHandle;
+
+    /**
+    * @brief OpenPST::DmScheduler
+    */
+    class DmScheduler {
+        friend class DmSchedulerLease;
+
+        public:
+            /**
+            * @brief DmScheduler - Constructor
+            *
+            * @param QcdmSerial& port
+            * @param int sliceBudget - ms a bulk or background slice may run
+            */
+            DmScheduler(QcdmSerial& port, int sliceBudget = DM_SCHEDULER_DEFAULT_SLICE);
+
+            /**
+            * @brief ~DmScheduler - Deconstructor, stops the scheduler thread
+            */
+            ~DmScheduler();
+
+            /**
+            * @brief start - Start the scheduler thread
+            *
+            * @return bool - false if already running
+            */
+            bool start();
+
+            /**
+            * @brief stop - Cancel every job and stop the scheduler thread once the running slice returns
+            *
+            * @return void
+            */
+            void stop();
+
+            /**
+            * @brief isRunning
+            *
+            * @return bool
+            */
+            bool isRunning();
+
+            /**
+            * @brief submit - Queue a job, safe to call from any thread and from a task
+            *
+            * @param DmSchedulerClass priority
+            * @param DmSchedulerTask task
+            *
+            * @return DmSchedulerJobHandle
+            */
+            DmSchedulerJobHandle submit(DmSchedulerClass priority, DmSchedulerTask task);
+
+            /**
+            * @brief run - Queue a job and wait for it, must not be called from a task
+            *
+            * @param DmSchedulerClass priority
+            * @param DmSchedulerTask task
+            *
+            * @return DmSchedulerJobStatus
+            */
+            DmSchedulerJobStatus run(DmSchedulerClass priority, DmSchedulerTask task);
+
+            /**
+            * @brief setSliceBudget
+            *
+            * @param int sliceBudget - ms
+            *
+            * @return void
+            */
+            void setSliceBudget(int sliceBudget);
+
+            /**
+            * @brief getStats
+            *
+            * @param DmSchedulerClass priority
+            *
+            * @return DmSchedulerStats
+            */
+            DmSchedulerStats getStats(DmSchedulerClass priority);
+
+            /**
+            * @brief resetStats
+            *
+            * @return void
+            */
+            void resetStats();
+
+            /**
+            * @brief nvReadTask - Read NV items a slice at a time
+            *
+            * Each slice takes results until its budget is used, then drains
+            * the requests still in flight so the port is quiet for the next
+            * job. Results drained early are kept for the next slice.
+            *
+            * @param std::vector<uint16_t>& items
+            * @param size_t window - Requests kept in flight
+            * @param std::function<void(const DmNvBulkResult&)> callback - Called on the scheduler thread for each item
+            *
+            * @return DmSchedulerTask
+            */
+            static DmSchedulerTask nvReadTask(const std::vector<uint16_t>& items, size_t window, std::function<void(const DmNvBulkResult& result)> callback);
+
+        private:
+            QcdmSerial& port;
+            std::thread worker;
+            std::atomic<bool> running;
+            std::mutex mutex;
+            std::condition_variable wake;
+            std::deque<DmSchedulerJobHandle> queues[kDmSchedulerClassCount];
+            DmSchedulerJobHandle current;  // running a slice
+            DmSchedulerStats stats[kDmSchedulerClassCount];
+            int sliceBudget;
+            int bulkRun;  // bulk slices in a row while background work waited
+            std::thread::id leaseHolder;  // thread holding a lease, it already owns the port
+
+            /**
+            * @brief loop - Scheduler thread
+            */
+            void loop();
+
+            /**
+            * @brief pick - Take the next job to run a slice of, with the mutex held
+            *
+            * @return DmSchedulerJobHandle - nullptr if nothing is queued
+            */
+            DmSchedulerJobHandle pick();
+
+            /**
+            * @brief record - Account a finished job, with the mutex held
+            */
+            void record(DmSchedulerJob& job, DmSchedulerJobStatus status, const std::string& error = "");
+
+            /**
+            * @brief micros - Microseconds between two points
+            */
+            static uint64_t micros(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to);
+    };
+
+    /**
+    * @brief OpenPST::DmSchedulerLease - Hold the port for the calling thread as a job
+    *
+    * The constructor submits a job that parks the scheduler thread and waits
+    * for it to start, which is within the slice running at the time for an
+    * interactive lease. The port is then the caller's until the lease is
+    * destroyed. A lease taken while the scheduler is not running, from a
+    * task, or by a thread already holding one is a no-op.
+    */
+    class DmSchedulerLease {
+        public:
+            /**
+            * @brief DmSchedulerLease - Constructor, waits for the port
+            *
+            * @param DmScheduler& scheduler
+            * @param DmSchedulerClass priority
+            */
+            DmSchedulerLease(DmScheduler& scheduler, DmSchedulerClass priority = kDmSchedulerInteractive);
+
+            /**
+            * @brief ~DmSchedulerLease - Deconstructor, gives the port back to the scheduler
+            */
+            ~DmSchedulerLease();
+
+        private:
+            struct State {
+                std::mutex mutex;
+                std::condition_variable changed;
+                bool held;
+                bool released;
+            };
+
+            DmScheduler& scheduler;
+            DmSchedulerJobHandle job;
+            std::shared_ptr<State> state;
+    };
+}
+
+#endif // _QC_DM_SCHEDULER_H_
@@ -9,13 +9,36 @@
 */
 #include "hdlc.h"
 
+/**
+* Tables for taking 8 bytes per step in crc16, slice[0] is crc_table and
+* slice[k][i] is crc_table[i] followed by k zero bytes. Built on the first
+* call to crc16, so static initializers elsewhere can use it
+*/
+struct Crc16Slices {
+    uint16_t slice[8][256];
+
+    Crc16Slices() {
+        for (int i = 0; i < 256; i++) {
+            slice[0][i] = crc_table[i];
+        }
+
+        for (int k = 1; k < 8; k++) {
+            for (int i = 0; i < 256; i++) {
+                slice[k][i] = (slice[k - 1][i] >> 8) ^ crc_table[slice[k - 1][i] & 0xff];
+            }
+        }
+    }
+};
+
 int hdlc_request(uint8_t* in, size_t inSize, uint8_t** out, size_t &outSize) {
 
     uint16_t crc = crc16((const char*)in, inSize); // perform the crc or the original data
+    uint8_t trailer[] = { (uint8_t)(crc & 0xFF), (uint8_t)((crc >> 8) & 0xFF) };
 
     outSize = inSize + HDLC_OVERHEAD_LENGTH;
-    for (unsigned int i = 0; i < inSize; i++) {
-        if (in[i] == HDLC_CONTROL_CHAR || in[i] == HDLC_ESC_CHAR) {
+    for (unsigned int i = 0; i < inSize + sizeof(trailer); i++) {
+        uint8_t c = i < inSize ? in[i] : trailer[i - inSize];
+        if (c == HDLC_CONTROL_CHAR || c == HDLC_ESC_CHAR) {
             outSize += 1;
         }
     }
@@ -24,21 +47,20 @@ int hdlc_request(uint8_t* in, size_t inSize, uint8_t** out, size_t &outSize) {
 
     buffer[0] = HDLC_CONTROL_CHAR;
 
+    // the crc is escaped like the data
     int o = 1;
-    for (unsigned int i = 0; i < inSize; i++) {
-        if (in[i] == HDLC_CONTROL_CHAR || in[i] == HDLC_ESC_CHAR) {
+    for (unsigned int i = 0; i < inSize + sizeof(trailer); i++) {
+        uint8_t c = i < inSize ? in[i] : trailer[i - inSize];
+        if (c == HDLC_CONTROL_CHAR || c == HDLC_ESC_CHAR) {
             buffer[o] = HDLC_ESC_CHAR;
-            buffer[++o] = (in[i] == HDLC_ESC_CHAR ? HDLC_ESC_CHAR : HDLC_CONTROL_CHAR) ^ HDLC_ESC_MASK;
+            buffer[++o] = c ^ HDLC_ESC_MASK;
         } else {
-            buffer[o] = in[i];
+            buffer[o] = c;
         }
         o++;
     }
 
-
-    buffer[o] = crc & 0xFF; // add first byte of crc
-    buffer[++o] = (crc >> 8) & 0xFF; // add second byte of crc
-    buffer[++o] = HDLC_CONTROL_CHAR; // Add out ending control character
+    buffer[o] = HDLC_CONTROL_CHAR; // Add out ending control character
 
     *out = buffer;
 
@@ -132,10 +154,80 @@ int hdlc_response(std::vector<uint8_t> &data) {
     return 0;
 }
 
+/**
+* Frame a packet onto the end of out, flag, escaped data and CRC, flag. Lets
+* pipelined requests be built into a single write
+*/
+void hdlc_append(std::vector<uint8_t> &out, const uint8_t* data, size_t size) {
+    uint16_t crc = crc16((const char*)data, size);
+    uint8_t trailer[] = { (uint8_t)(crc & 0xFF), (uint8_t)((crc >> 8) & 0xFF) };
+
+    out.reserve(out.size() + size + HDLC_OVERHEAD_LENGTH);
+    out.push_back(HDLC_CONTROL_CHAR);
+
+    // the crc is escaped like the data
+    for (size_t i = 0; i < size + sizeof(trailer); i++) {
+        uint8_t c = i < size ? data[i] : trailer[i - size];
+        if (c == HDLC_CONTROL_CHAR || c == HDLC_ESC_CHAR) {
+            out.push_back(HDLC_ESC_CHAR);
+            out.push_back(c ^ HDLC_ESC_MASK);
+        } else {
+            out.push_back(c);
+        }
+    }
+
+    out.push_back(HDLC_CONTROL_CHAR);
+}
+
+/**
+* Unescape a frame received without its flags into packet and check its CRC.
+* packet is left without the CRC. Returns false for a frame too short to
+* hold a CRC or one that fails it
+*/
+bool hdlc_decode(const uint8_t* frame, size_t size, std::vector<uint8_t> &packet) {
+    packet.clear();
+    packet.reserve(size);
+
+    for (size_t i = 0; i < size; i++) {
+        if (frame[i] == HDLC_ESC_CHAR && i + 1 < size) {
+            packet.push_back(frame[++i] ^ HDLC_ESC_MASK);
+        } else {
+            packet.push_back(frame[i]);
+        }
+    }
+
+    if (packet.size() <= sizeof(uint16_t)) {
+        return false;
+    }
+
+    size_t packetSize = packet.size() - sizeof(uint16_t);
+
+    if (crc16((const char*)&packet[0], packetSize) != (packet[packetSize] | (packet[packetSize + 1] << 8))) {
+        return false;
+    }
+
+    packet.resize(packetSize);
+
+    return true;
+}
+
 uint16_t crc16(const char *buffer, size_t len) {
+    const uint8_t* p = (const uint8_t*)buffer;
+    static const Crc16Slices slices;
+    const uint16_t (*t)[256] = slices.slice;
     uint16_t crc = 0xffff;
 
+    while (len >= 8) {
+        uint16_t v = crc ^ (p[0] | (p[1] << 8));
+
+        crc = t[7][v & 0xff] ^ t[6][v >> 8] ^ t[5][p[2]] ^ t[4][p[3]] ^
+              t[3][p[4]] ^ t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+
+        p   += 8;
+        len -= 8;
+    }
+
     while (len--)
-        crc = crc_table[(crc ^ *buffer++) & 0xff] ^ (crc >> 8);
+        crc = crc_table[(crc ^ *p++) & 0xff] ^ (crc >> 8);
     return ~crc;
 }
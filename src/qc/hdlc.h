@@ -70,6 +70,8 @@ int hdlc_request(uint8_t* in, size_t inSize, uint8_t** out, size_t &outSize);
 int hdlc_response(uint8_t* in, size_t inSize, uint8_t** out, size_t &outSize);
 int hdlc_request(std::vector<uint8_t> &data);
 int hdlc_response(std::vector<uint8_t> &data);
+void hdlc_append(std::vector<uint8_t> &out, const uint8_t* data, size_t size);
+bool hdlc_decode(const uint8_t* frame, size_t size, std::vector<uint8_t> &packet);
 uint16_t crc16(const char *buffer, size_t len);
 
 #endif // _UTIL_HDLC_H
@@ -0,0 +1,234 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file hdlc_frame_template.cpp
+* @class OpenPST::HdlcFrameTemplate
+* @package OpenPST
+* @brief A request kept HDLC framed between sends
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "hdlc_frame_template.h"
+
+using namespace OpenPST;
+
+/**
+* @brief isEscaped - Bytes that take two bytes in a frame
+*/
+static inline bool isEscaped(uint8_t value)
+{
+    return value == HDLC_CONTROL_CHAR || value == HDLC_ESC_CHAR;
+}
+
+/**
+* @brief HdlcFrameTemplate - Constructor
+*
+* @param uint8_t* data
+* @param size_t size
+*/
+HdlcFrameTemplate::HdlcFrameTemplate(const uint8_t* data, size_t size) :
+    payload(data, data + size),
+    positions(size + 1, 0)
+{
+    crc = crc16(reinterpret_cast<const char*>(&payload[0]), payload.size());
+
+    frame.reserve((size + sizeof(crc)) * 2 + 2);
+    frame.push_back(HDLC_CONTROL_CHAR);
+
+    encode(0);
+}
+
+/**
+* @brief HdlcFrameTemplate - Constructor, for a request of all zero bytes
+*
+* @param size_t size
+*/
+HdlcFrameTemplate::HdlcFrameTemplate(size_t size) :
+    payload(size, 0x00),
+    positions(size + 1, 0)
+{
+    crc = crc16(reinterpret_cast<const char*>(&payload[0]), payload.size());
+
+    frame.reserve((size + sizeof(crc)) * 2 + 2);
+    frame.push_back(HDLC_CONTROL_CHAR);
+
+    encode(0);
+}
+
+/**
+* @brief ~HdlcFrameTemplate - Deconstructor
+*/
+HdlcFrameTemplate::~HdlcFrameTemplate()
+{
+
+}
+
+/**
+* @brief set - Patch bytes of the request
+*
+* @param size_t offset
+* @param uint8_t* value
+* @param size_t size
+* @return void
+*/
+void HdlcFrameTemplate::set(size_t offset, const uint8_t* value, size_t size)
+{
+    if (offset > payload.size() || size > payload.size() - offset) {
+        throw std::out_of_range("Patch is outside of the frame template");
+    }
+
+    // only the bytes that actually change need any work
+    size_t first = 0;
+    size_t last  = size;
+
+    while (first < last && payload[offset + first] == value[first]) {
+        first++;
+    }
+
+    if (first == last) {
+        return;
+    }
+
+    while (payload[offset + last - 1] == value[last - 1]) {
+        last--;
+    }
+
+    size_t rebuild = payload.size();
+    uint16_t reg = 0;
+
+    for (size_t i = offset + first; i < offset + last; i++) {
+        uint8_t before = payload[i];
+        uint8_t after  = value[i - offset];
+
+        reg = crc_table[(reg ^ before ^ after) & 0xFF] ^ (reg >> 8);
+
+        payload[i] = after;
+
+        if (rebuild < payload.size()) {
+            continue;
+        }
+
+        if (isEscaped(before) != isEscaped(after)) {
+            // the frame changes length from here on
+            rebuild = i;
+        } else if (isEscaped(after)) {
+            frame[positions[i] + 1] = after ^ HDLC_ESC_MASK;
+        } else {
+            frame[positions[i]] = after;
+        }
+    }
+
+    crc ^= shift(reg, payload.size() - (offset + last));
+
+    encode(rebuild);
+}
+
+/**
+* @brief getFrame
+*
+* @return uint8_t*
+*/
+uint8_t* HdlcFrameTemplate::getFrame()
+{
+    return &frame[0];
+}
+
+/**
+* @brief getFrameSize
+*
+* @return size_t
+*/
+size_t HdlcFrameTemplate::getFrameSize()
+{
+    return frame.size();
+}
+
+/**
+* @brief getCrc
+*
+* @return uint16_t
+*/
+uint16_t HdlcFrameTemplate::getCrc()
+{
+    return crc;
+}
+
+/**
+* @brief encode - Rebuild the frame from a payload offset to the end
+*
+* @param size_t from
+* @return void
+*/
+void HdlcFrameTemplate::encode(size_t from)
+{
+    uint8_t trailer[] = { (uint8_t)(crc & 0xFF), (uint8_t)((crc >> 8) & 0xFF) };
+
+    frame.resize(from ? positions[from] : HDLC_LEADING_LENGTH);
+
+    for (size_t i = from; i < payload.size(); i++) {
+        positions[i] = frame.size();
+
+        if (isEscaped(payload[i])) {
+            frame.push_back(HDLC_ESC_CHAR);
+            frame.push_back(payload[i] ^ HDLC_ESC_MASK);
+        } else {
+            frame.push_back(payload[i]);
+        }
+    }
+
+    positions[payload.size()] = frame.size();
+
+    for (auto value : trailer) {
+        if (isEscaped(value)) {
+            frame.push_back(HDLC_ESC_CHAR);
+            frame.push_back(value ^ HDLC_ESC_MASK);
+        } else {
+            frame.push_back(value);
+        }
+    }
+
+    frame.push_back(HDLC_CONTROL_CHAR);
+}
+
+/**
+* @brief shift - Advance a CRC register started at zero over a run of zero bytes
+*
+* @param uint16_t reg
+* @param size_t zeros
+* @return uint16_t
+*/
+uint16_t HdlcFrameTemplate::shift(uint16_t reg, size_t zeros)
+{
+    if (!zeros || !reg) {
+        return reg;
+    }
+
+    auto it = shifts.find(zeros);
+
+    if (it == shifts.end()) {
+        std::vector<uint16_t> bits(16);
+
+        for (size_t bit = 0; bit < bits.size(); bit++) {
+            uint16_t value = 1 << bit;
+
+            for (size_t i = 0; i < zeros; i++) {
+                value = crc_table[value & 0xFF] ^ (value >> 8);
+            }
+
+            bits[bit] = value;
+        }
+
+        it = shifts.insert(std::make_pair(zeros, bits)).first;
+    }
+
+    uint16_t result = 0;
+
+    for (size_t bit = 0; reg; bit++, reg >>= 1) {
+        if (reg & 1) {
+            result ^= it->second[bit];
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,133 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file hdlc_frame_template.h
+* @class OpenPST::HdlcFrameTemplate
+* @package OpenPST
+* @brief A request kept HDLC framed between sends
+*
+* Loops that send the same request over and over with a sequence number, an
+* item id or an address changed would CRC and escape the whole request every
+* time. A template frames the request once, and set() patches only the bytes
+* that changed: the CRC is updated from the difference alone, and the escaped
+* frame is rewritten in place unless a patched byte gains or loses an escape,
+* in which case only the frame from that byte on is rebuilt.
+*
+* The CRC is linear, so for a change d to the bytes at offset the new CRC is
+* the old CRC xor the CRC register run from zero over d and then over the
+* zero bytes that follow it. Advancing over those zero bytes is a fixed linear
+* map per length, which is worked out once and cached.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_HDLC_FRAME_TEMPLATE_H_
+#define _QC_HDLC_FRAME_TEMPLATE_H_
+
+#include <vector>
+#include <map>
+#include <stdexcept>
+#include "include/definitions.h"
+#include "qc/hdlc.h"
+
+namespace OpenPST {
+
+    /**
+    * @brief OpenPST::HdlcFrameTemplate
+    */
+    class HdlcFrameTemplate {
+        public:
+            /**
+            * @brief HdlcFrameTemplate - Constructor
+            *
+            * @param uint8_t* data - The request, unescaped and without a CRC
+            * @param size_t size
+            */
+            HdlcFrameTemplate(const uint8_t* data, size_t size);
+
+            /**
+            * @brief HdlcFrameTemplate - Constructor, for a request of all zero bytes
+            *
+            * @param size_t size
+            */
+            HdlcFrameTemplate(size_t size);
+
+            /**
+            * @brief ~HdlcFrameTemplate - Deconstructor
+            */
+            ~HdlcFrameTemplate();
+
+            /**
+            * @brief set - Patch bytes of the request
+            *
+            * @param size_t offset
+            * @param uint8_t* value
+            * @param size_t size
+            * @return void
+            *
+            * @throws std::out_of_range
+            */
+            void set(size_t offset, const uint8_t* value, size_t size);
+
+            /**
+            * @brief set - Patch a field of the request, e.g. set(offsetof(Request, address), address)
+            *
+            * @param size_t offset
+            * @param T value
+            * @return void
+            *
+            * @throws std::out_of_range
+            */
+            template <typename T> void set(size_t offset, T value)
+            {
+                set(offset, reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+            }
+
+            /**
+            * @brief getFrame - The framed request, ready to be written without encapsulation
+            *
+            * @return uint8_t* - Valid until the next set
+            */
+            uint8_t* getFrame();
+
+            /**
+            * @brief getFrameSize
+            *
+            * @return size_t
+            */
+            size_t getFrameSize();
+
+            /**
+            * @brief getCrc
+            *
+            * @return uint16_t
+            */
+            uint16_t getCrc();
+
+        private:
+            std::vector<uint8_t> payload;
+            std::vector<uint8_t> frame;
+            std::vector<size_t> positions;  // frame offset of each payload byte, then of the CRC
+            uint16_t crc;
+            std::map<size_t, std::vector<uint16_t>> shifts; // zero bytes to the register bits advanced over them
+
+            /**
+            * @brief encode - Rebuild the frame from a payload offset to the end
+            *
+            * @param size_t from - payload.size() rebuilds only the CRC
+            * @return void
+            */
+            void encode(size_t from);
+
+            /**
+            * @brief shift - Advance a CRC register started at zero over a run of zero bytes
+            *
+            * @param uint16_t reg
+            * @param size_t zeros
+            * @return uint16_t
+            */
+            uint16_t shift(uint16_t reg, size_t zeros);
+    };
+}
+
+#endif // _QC_HDLC_FRAME_TEMPLATE_H_
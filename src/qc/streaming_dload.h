@@ -41,8 +41,9 @@
 #define STREAMING_DLOAD_FLASH_ID_MAX_SIZE    32
 #define STREAMING_DLOAD_MESSAGE_SIZE  64
 #define STREAMING_DLOAD_MAX_SECTORS 32
+#define STREAMING_DLOAD_SECTOR_SIZE 512 // unit of addresses when STREAMING_DLOAD_FEATURE_BIT_SECTOR_ADDRESSES is negotiated
 
-#define STREAMING_DLOAD_MAX_DATA_SIZE 1024
+#define STREAMING_DLOAD_MAX_DATA_SIZE 1024 // block size assumed until the hello response reports the device maximum
 
 #define STREAMING_DLOAD_MAX_TX_SIZE (STREAMING_DLOAD_MAX_DATA_SIZE * 2)
 #define STREAMING_DLOAD_MAX_RX_SIZE (STREAMING_DLOAD_MAX_DATA_SIZE * 2)
@@ -0,0 +1,215 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file streaming_dload_flash_plan.cpp
+* @class StreamingDloadFlashPlan
+* @package OpenPST
+* @brief Parses a flash plan describing a multi image streaming dload session
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "streaming_dload_flash_plan.h"
+
+using namespace OpenPST;
+
+struct StreamingDloadFlashPlanImageName {
+    const char* name;
+    uint8_t     imageType;
+};
+
+static const StreamingDloadFlashPlanImageName imageNames[] = {
+    { "PBL",        STREAMING_DLOAD_OPEN_MULTI_MODE_PBL },
+    { "QCSBLHDCFG", STREAMING_DLOAD_OPEN_MULTI_MODE_QCSBLHDCFG },
+    { "QCSBL",      STREAMING_DLOAD_OPEN_MULTI_MODE_QCSBL },
+    { "OEMSBL",     STREAMING_DLOAD_OPEN_MULTI_MODE_OEMSBL },
+    { "AMSS",       STREAMING_DLOAD_OPEN_MULTI_MODE_AMSS },
+    { "APPS",       STREAMING_DLOAD_OPEN_MULTI_MODE_APPS },
+    { "OBL",        STREAMING_DLOAD_OPEN_MULTI_MODE_OBL },
+    { "FOTAUI",     STREAMING_DLOAD_OPEN_MULTI_MODE_FOTAUI },
+    { "CEFS",       STREAMING_DLOAD_OPEN_MULTI_MODE_CEFS },
+    { "APPSBL",     STREAMING_DLOAD_OPEN_MULTI_MODE_APPSBL },
+    { "APPS_CEFS",  STREAMING_DLOAD_OPEN_MULTI_MODE_APPS_CEFS },
+    { "FLASH_BIN",  STREAMING_DLOAD_OPEN_MULTI_MODE_FLASH_BIN },
+    { "DSP1",       STREAMING_DLOAD_OPEN_MULTI_MODE_DSP1 },
+    { "CUSTOM",     STREAMING_DLOAD_OPEN_MULTI_MODE_CUSTOM },
+    { "DBL",        STREAMING_DLOAD_OPEN_MULTI_MODE_DBL },
+    { "OSBL",       STREAMING_DLOAD_OPEN_MULTI_MODE_OSBL },
+    { "FSBL",       STREAMING_DLOAD_OPEN_MULTI_MODE_FSBL },
+    { "DSP2",       STREAMING_DLOAD_OPEN_MULTI_MODE_DSP2 },
+    { "RAW",        STREAMING_DLOAD_OPEN_MULTI_MODE_RAW },
+    { "ROFS1",      STREAMING_DLOAD_OPEN_MULTI_MODE_ROFS1 },
+    { "ROFS2",      STREAMING_DLOAD_OPEN_MULTI_MODE_ROFS2 },
+    { "ROFS3",      STREAMING_DLOAD_OPEN_MULTI_MODE_ROFS3 },
+    { "EMMC_USER",  STREAMING_DLOAD_OPEN_MULTI_MODE_EMMC_USER },
+    { "EMMC_BOOT0", STREAMING_DLOAD_OPEN_MULTI_MODE_EMMC_BOOT0 },
+    { "EMMC_BOOT1", STREAMING_DLOAD_OPEN_MULTI_MODE_EMMC_BOOT1 },
+    { "EMMC_RPMB",  STREAMING_DLOAD_OPEN_MULTI_MODE_EMMC_RPMB },
+    { "EMMC_GPP1",  STREAMING_DLOAD_OPEN_MULTI_MODE_EMMC_GPP1 },
+    { "EMMC_GPP2",  STREAMING_DLOAD_OPEN_MULTI_MODE_EMMC_GPP2 },
+    { "EMMC_GPP3",  STREAMING_DLOAD_OPEN_MULTI_MODE_EMMC_GPP3 },
+    { "EMMC_GPP4",  STREAMING_DLOAD_OPEN_MULTI_MODE_EMMC_GPP4 },
+};
+
+/**
+* @brief StreamingDloadFlashPlan - Constructor
+*/
+StreamingDloadFlashPlan::StreamingDloadFlashPlan() :
+    overridePartitionTable(false)
+{
+
+}
+
+/**
+* @brief ~StreamingDloadFlashPlan - Deconstructor
+*/
+StreamingDloadFlashPlan::~StreamingDloadFlashPlan()
+{
+
+}
+
+/**
+* @brief load - Parse a flash plan file, replacing any loaded plan
+*
+* @param std::string filePath - The plan to load
+*
+* @return bool
+*/
+bool StreamingDloadFlashPlan::load(std::string filePath)
+{
+    std::ifstream file(filePath.c_str(), std::ios::in);
+    std::stringstream message;
+
+    partitionTable.clear();
+    overridePartitionTable = false;
+    images.clear();
+    lastError.clear();
+
+    if (!file.is_open()) {
+        lastError = "Could not open " + filePath;
+        return false;
+    }
+
+    size_t separator = filePath.find_last_of("/\\");
+    std::string base = separator == std::string::npos ? "" : filePath.substr(0, separator + 1);
+
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(file, line)) {
+        lineNumber++;
+
+        std::istringstream tokens(line);
+        std::string directive;
+
+        if (!(tokens >> directive) || directive[0] == '#') {
+            continue;
+        }
+
+        if (directive.compare("partition") == 0) {
+            std::string path, flag;
+
+            if (!(tokens >> path)) {
+                message << "Line " << lineNumber << ": partition requires a file";
+                lastError = message.str();
+                return false;
+            }
+
+            partitionTable = resolvePath(base, path);
+            overridePartitionTable = (tokens >> flag) && flag.compare("override") == 0;
+        } else if (directive.compare("image") == 0) {
+            std::string type, path, address;
+            StreamingDloadFlashPlanImage image = {};
+
+            if (!(tokens >> type >> path)) {
+                message << "Line " << lineNumber << ": image requires a type and a file";
+                lastError = message.str();
+                return false;
+            }
+
+            int imageType = getImageTypeByName(type);
+
+            if (imageType < 0) {
+                message << "Line " << lineNumber << ": unknown image type " << type;
+                lastError = message.str();
+                return false;
+            }
+
+            image.imageType = imageType;
+            image.filePath = resolvePath(base, path);
+
+            if (tokens >> address) {
+                size_t parsed = 0;
+
+                try {
+                    image.address = std::stoull(address, &parsed, 16);
+                } catch (std::exception& e) {
+                    parsed = 0;
+                }
+
+                if (parsed != address.size()) {
+                    message << "Line " << lineNumber << ": invalid address " << address;
+                    lastError = message.str();
+                    return false;
+                }
+            }
+
+            images.push_back(image);
+        } else {
+            message << "Line " << lineNumber << ": unknown directive " << directive;
+            lastError = message.str();
+            return false;
+        }
+    }
+
+    if (!images.size()) {
+        lastError = "Plan does not contain any images";
+        return false;
+    }
+
+    return true;
+}
+
+/**
+* @brief getImageTypeByName - Resolve a multi image type from its plan name
+*
+* @param std::string name - AMSS, EMMC_USER, 0x05, etc
+*
+* @return int - The image type or -1 if unknown
+*/
+int StreamingDloadFlashPlan::getImageTypeByName(std::string name)
+{
+    for (auto &entry : imageNames) {
+        if (name.compare(entry.name) == 0) {
+            return entry.imageType;
+        }
+    }
+
+    if (name.size() > 2 && name[0] == '0' && (name[1] == 'x' || name[1] == 'X')) {
+        char* end = nullptr;
+        unsigned long value = strtoul(name.c_str(), &end, 16);
+
+        if (*end == '\0' && value > STREAMING_DLOAD_OPEN_MULTI_MODE_NONE && value <= STREAMING_DLOAD_OPEN_MULTI_MODE_EMMC_GPP4) {
+            return value;
+        }
+    }
+
+    return -1;
+}
+
+/**
+* @brief resolvePath - Resolve a plan relative path
+*
+* @param std::string base - The directory of the plan file
+* @param std::string path
+*
+* @return std::string
+*/
+std::string StreamingDloadFlashPlan::resolvePath(const std::string& base, const std::string& path)
+{
+    if (!path.size() || path[0] == '/' || path[0] == '\\' || (path.size() > 1 && path[1] == ':')) {
+        return path;
+    }
+
+    return base + path;
+}
@@ -0,0 +1,107 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file streaming_dload_flash_plan.h
+* @class StreamingDloadFlashPlan
+* @package OpenPST
+* @brief Parses a flash plan describing a multi image streaming dload session
+*
+* A flash plan is a plain text file with one directive per line. Blank lines
+* and lines starting with # are ignored. Relative file paths are resolved
+* against the directory containing the plan.
+*
+*   partition <file> [override]
+*   image <type> <file> [address]
+*
+* Image types are the STREAMING_DLOAD_OPEN_MULTI_MODE_* names without the
+* prefix (AMSS, OEMSBL, EMMC_USER, ...) or a numeric value (0x05).
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_STREAMING_DLOAD_FLASH_PLAN_H
+#define _QC_STREAMING_DLOAD_FLASH_PLAN_H
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include "include/definitions.h"
+#include "qc/streaming_dload.h"
+
+namespace OpenPST {
+
+    struct StreamingDloadFlashPlanImage {
+        uint8_t     imageType;
+        uint64_t    address;
+        std::string filePath;
+    };
+
+    class StreamingDloadFlashPlan {
+
+        public:
+            /**
+            * @brief path to the partition table to send before any image, empty to skip
+            */
+            std::string partitionTable;
+
+            /**
+            * @brief send the partition table with override existing set
+            */
+            bool overridePartitionTable;
+
+            /**
+            * @brief images to write, in the order they appear in the plan
+            */
+            std::vector<StreamingDloadFlashPlanImage> images;
+
+            /**
+            * @brief description of the last parse error
+            */
+            std::string lastError;
+
+            /**
+            * @brief StreamingDloadFlashPlan
+            */
+            StreamingDloadFlashPlan();
+
+            /**
+            * @brief ~StreamingDloadFlashPlan
+            */
+            ~StreamingDloadFlashPlan();
+
+            /**
+            * @brief load - Parse a flash plan file, replacing any loaded plan
+            *
+            * @param std::string filePath - The plan to load
+            *
+            * @return bool
+            */
+            bool load(std::string filePath);
+
+            /**
+            * @brief getImageTypeByName - Resolve a multi image type from its plan name
+            *
+            * @param std::string name - AMSS, EMMC_USER, 0x05, etc
+            *
+            * @return int - The image type or -1 if unknown
+            */
+            static int getImageTypeByName(std::string name);
+
+        private:
+            /**
+            * @brief resolvePath - Resolve a plan relative path
+            *
+            * @param std::string base - The directory of the plan file
+            * @param std::string path
+            *
+            * @return std::string
+            */
+            std::string resolvePath(const std::string& base, const std::string& path);
+    };
+}
+
+#endif // _QC_STREAMING_DLOAD_FLASH_PLAN_H
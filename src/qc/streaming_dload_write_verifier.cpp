@@ -0,0 +1,246 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file streaming_dload_write_verifier.cpp
+* @class OpenPST::StreamingDloadWriteVerifier
+* @package OpenPST
+* @brief Read back verification of streaming dload writes, interleaved with the writes
+*        themselves instead of a second full read pass
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "streaming_dload_write_verifier.h"
+
+using namespace OpenPST;
+
+/**
+* @brief StreamingDloadWriteVerifier - Constructor
+*
+* @param StreamingDloadSerial& port
+* @param size_t stepSize - Read request size
+* @param size_t lag - Number of most recent ranges to leave queued
+*/
+StreamingDloadWriteVerifier::StreamingDloadWriteVerifier(StreamingDloadSerial& port, size_t stepSize, size_t lag) :
+    port(port),
+    stepSize(stepSize),
+    lag(lag),
+    elapsed(std::chrono::steady_clock::duration::zero()),
+    verifiedSize(0),
+    verifiedRanges(0),
+    failedAddress(0)
+{
+
+}
+
+/**
+* @brief ~StreamingDloadWriteVerifier - Deconstructor
+*/
+StreamingDloadWriteVerifier::~StreamingDloadWriteVerifier()
+{
+    // outstanding comparisons own their buffers, just let them finish
+    for (auto &comparison : comparisons) {
+        comparison.wait();
+    }
+}
+
+/**
+* @brief queue - Queue a range that was just written
+*
+* @param uint64_t address - Address the data was written to
+* @param const uint8_t* data - The source data, copied
+* @param size_t size
+*/
+void StreamingDloadWriteVerifier::queue(uint64_t address, const uint8_t* data, size_t size)
+{
+    StreamingDloadVerifyRange range;
+
+    range.address = address;
+    range.expected.assign(data, data + size);
+
+    pending.push_back(std::move(range));
+}
+
+/**
+* @brief step - Read back queued ranges older than lag and collect finished comparisons
+*
+* @return bool - false on a read error or mismatch
+*/
+bool StreamingDloadWriteVerifier::step()
+{
+    auto start = std::chrono::steady_clock::now();
+    bool result = true;
+
+    while (result && pending.size() > lag) {
+        result = readBack();
+    }
+
+    if (result) {
+        result = collect(false);
+    }
+
+    elapsed += std::chrono::steady_clock::now() - start;
+
+    return result;
+}
+
+/**
+* @brief finish - Read back everything still queued and wait for all comparisons
+*
+* @return bool - false on a read error or mismatch
+*/
+bool StreamingDloadWriteVerifier::finish()
+{
+    auto start = std::chrono::steady_clock::now();
+    bool result = true;
+
+    while (result && pending.size()) {
+        result = readBack();
+    }
+
+    if (result) {
+        result = collect(true);
+    }
+
+    elapsed += std::chrono::steady_clock::now() - start;
+
+    return result;
+}
+
+/**
+* @brief getError
+*
+* @return std::string
+*/
+std::string StreamingDloadWriteVerifier::getError()
+{
+    return error;
+}
+
+/**
+* @brief getElapsed - Time spent on verification by the calling thread, in ms
+*
+* @return int64_t
+*/
+int64_t StreamingDloadWriteVerifier::getElapsed()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+}
+
+/**
+* @brief getVerifiedSize - Bytes read back and found equal
+*
+* @return uint64_t
+*/
+uint64_t StreamingDloadWriteVerifier::getVerifiedSize()
+{
+    return verifiedSize;
+}
+
+/**
+* @brief getVerifiedRanges - Ranges read back and found equal
+*
+* @return size_t
+*/
+size_t StreamingDloadWriteVerifier::getVerifiedRanges()
+{
+    return verifiedRanges;
+}
+
+/**
+* @brief getFailedAddress - Start of the range that failed to read back or compare
+*
+* @return uint64_t
+*/
+uint64_t StreamingDloadWriteVerifier::getFailedAddress()
+{
+    return failedAddress;
+}
+
+/**
+* @brief readBack - Read back the oldest queued range and start its comparison
+*
+* @return bool
+*/
+bool StreamingDloadWriteVerifier::readBack()
+{
+    StreamingDloadVerifyRange& range = pending.front();
+    std::vector<uint8_t> actual;
+    size_t size = range.expected.size();
+
+    if (port.readAddress(range.address, size, actual, stepSize) != kStreamingDloadSuccess || actual.size() < size) {
+        char message[128];
+        snprintf(message, sizeof(message), "Error reading back %lu bytes at 0x%08llX", (unsigned long)size, (unsigned long long)range.address);
+        error = message;
+        failedAddress = range.address;
+        return false;
+    }
+
+    comparisons.push_back(std::async(std::launch::async, &StreamingDloadWriteVerifier::compare, range.address, std::move(range.expected), std::move(actual)));
+
+    pending.pop_front();
+
+    return true;
+}
+
+/**
+* @brief collect - Collect comparison results in order, waiting on them if wait is set
+*
+* @param bool wait
+*
+* @return bool
+*/
+bool StreamingDloadWriteVerifier::collect(bool wait)
+{
+    while (comparisons.size()) {
+        std::future<StreamingDloadVerifyResult>& comparison = comparisons.front();
+
+        if (!wait && comparison.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            break;
+        }
+
+        StreamingDloadVerifyResult result = comparison.get();
+
+        comparisons.pop_front();
+
+        if (result.mismatch >= 0) {
+            char message[128];
+            snprintf(message, sizeof(message), "Verify mismatch at 0x%08llX", (unsigned long long)(result.address + result.mismatch));
+            error = message;
+            failedAddress = result.address;
+            return false;
+        }
+
+        verifiedSize += result.size;
+        verifiedRanges++;
+    }
+
+    return true;
+}
+
+/**
+* @brief compare - Compare a range, runs off the port thread
+*
+* @param uint64_t address
+* @param std::vector<uint8_t> expected
+* @param std::vector<uint8_t> actual
+*
+* @return StreamingDloadVerifyResult
+*/
+StreamingDloadVerifyResult StreamingDloadWriteVerifier::compare(uint64_t address, std::vector<uint8_t> expected, std::vector<uint8_t> actual)
+{
+    StreamingDloadVerifyResult result = { address, expected.size(), -1 };
+
+    if (memcmp(&expected[0], &actual[0], expected.size()) == 0) {
+        return result;
+    }
+
+    for (size_t i = 0; i < expected.size(); i++) {
+        if (expected[i] != actual[i]) {
+            result.mismatch = i;
+            break;
+        }
+    }
+
+    return result;
+}
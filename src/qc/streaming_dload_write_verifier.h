@@ -0,0 +1,153 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file streaming_dload_write_verifier.h
+* @class OpenPST::StreamingDloadWriteVerifier
+* @package OpenPST
+* @brief Read back verification of streaming dload writes, interleaved with the writes
+*        themselves instead of a second full read pass
+*
+* Written ranges are queued as they complete. Between writes the caller lets the
+* verifier read back ranges that are at least lag ranges old. The read back data is
+* compared against a copy of the source on another thread, so the port goes straight
+* back to writing.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _QC_STREAMING_DLOAD_WRITE_VERIFIER_H_
+#define _QC_STREAMING_DLOAD_WRITE_VERIFIER_H_
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <future>
+#include <chrono>
+#include <string.h>
+#include <stdio.h>
+#include "serial/streaming_dload_serial.h"
+
+namespace OpenPST {
+
+    struct StreamingDloadVerifyRange {
+        uint64_t address;
+        std::vector<uint8_t> expected;
+    };
+
+    struct StreamingDloadVerifyResult {
+        uint64_t address;
+        size_t   size;
+        int64_t  mismatch;  // offset of the first differing byte, -1 when equal
+    };
+
+    /**
+    * @brief OpenPST::StreamingDloadWriteVerifier
+    */
+    class StreamingDloadWriteVerifier {
+
+        public:
+            /**
+            * @brief StreamingDloadWriteVerifier
+            *
+            * @param StreamingDloadSerial& port
+            * @param size_t stepSize - Read request size
+            * @param size_t lag - Number of most recent ranges to leave queued
+            */
+            StreamingDloadWriteVerifier(StreamingDloadSerial& port, size_t stepSize, size_t lag = 1);
+
+            /**
+            * @brief ~StreamingDloadWriteVerifier
+            */
+            ~StreamingDloadWriteVerifier();
+
+            /**
+            * @brief queue - Queue a range that was just written
+            *
+            * @param uint64_t address - Address the data was written to
+            * @param const uint8_t* data - The source data, copied
+            * @param size_t size
+            */
+            void queue(uint64_t address, const uint8_t* data, size_t size);
+
+            /**
+            * @brief step - Read back queued ranges older than lag and collect finished
+            *               comparisons. Call between writes.
+            *
+            * @return bool - false on a read error or mismatch
+            */
+            bool step();
+
+            /**
+            * @brief finish - Read back everything still queued and wait for all comparisons
+            *
+            * @return bool - false on a read error or mismatch
+            */
+            bool finish();
+
+            /**
+            * @brief getError
+            *
+            * @return std::string
+            */
+            std::string getError();
+
+            /**
+            * @brief getElapsed - Time spent on verification by the calling thread, in ms
+            *
+            * @return int64_t
+            */
+            int64_t getElapsed();
+
+            /**
+            * @brief getVerifiedSize - Bytes read back and found equal
+            *
+            * @return uint64_t
+            */
+            uint64_t getVerifiedSize();
+
+            /**
+            * @brief getVerifiedRanges - Ranges read back and found equal, they complete
+            *                            in the order they were queued
+            *
+            * @return size_t
+            */
+            size_t getVerifiedRanges();
+
+            /**
+            * @brief getFailedAddress - Start of the range that failed to read back or
+            *                           compare, everything before it was verified
+            *
+            * @return uint64_t
+            */
+            uint64_t getFailedAddress();
+
+        private:
+            StreamingDloadSerial& port;
+            size_t stepSize;
+            size_t lag;
+            std::deque<StreamingDloadVerifyRange> pending;
+            std::deque<std::future<StreamingDloadVerifyResult>> comparisons;
+            std::string error;
+            std::chrono::steady_clock::duration elapsed;
+            uint64_t verifiedSize;
+            size_t verifiedRanges;
+            uint64_t failedAddress;
+
+            /**
+            * @brief readBack - Read back the oldest queued range and start its comparison
+            */
+            bool readBack();
+
+            /**
+            * @brief collect - Collect comparison results, waiting on them if wait is set
+            */
+            bool collect(bool wait);
+
+            /**
+            * @brief compare - Compare a range, runs off the port thread
+            */
+            static StreamingDloadVerifyResult compare(uint64_t address, std::vector<uint8_t> expected, std::vector<uint8_t> actual);
+    };
+}
+
+#endif // _QC_STREAMING_DLOAD_WRITE_VERIFIER_H_
@@ -21,7 +21,13 @@ using namespace OpenPST;
 * @param serial::Timeout - Timeout, defaults to 1000ms
 */
 HdlcSerial::HdlcSerial(std::string port, int baudrate, serial::Timeout timeout) :
-    serial::Serial(port, baudrate, timeout)
+    serial::Serial(port, baudrate, timeout),
+    adaptiveTimeout(true),
+    rtt(timeout.read_timeout_constant, HDLC_RTT_MIN_TIMEOUT, getRttCeiling()),
+    rttKey(0),
+    rttPending(false),
+    stale(false),
+    crcErrors(0)
 {
 
 }
@@ -48,10 +54,10 @@ HdlcSerial::~HdlcSerial()
 */
 size_t HdlcSerial::write (uint8_t *data, size_t size, bool encapsulate)
 {
+    sent(data, size, !encapsulate);
+
     if (!encapsulate) {
-        size_t bytesWritten = Serial::write(data, size);
-        if (bytesWritten) hexdump_tx(&data[0], bytesWritten);
-        return bytesWritten;
+        return writeFrames(data, size);
     }
 
     size_t packetSize = 0;
@@ -84,7 +90,17 @@ size_t HdlcSerial::write (uint8_t *data, size_t size, bool encapsulate)
 */
 size_t HdlcSerial::read (uint8_t *buf, size_t size, bool unescape )
 {
-    size_t bytesRead = Serial::read(buf, size);
+    size_t bytesRead;
+
+    if (unescape && adaptiveTimeout) {
+        bytesRead = readFrame(buf, size);
+    } else if (carry.size()) {
+        bytesRead = carry.size() < size ? carry.size() : size;
+        memcpy(buf, &carry[0], bytesRead);
+        carry.erase(carry.begin(), carry.begin() + bytesRead);
+    } else {
+        bytesRead = Serial::read(buf, size);
+    }
 
     if (!unescape || !bytesRead) {
         if (bytesRead) hexdump_rx(&buf[0], bytesRead);
@@ -121,6 +137,10 @@ size_t HdlcSerial::read (uint8_t *buf, size_t size, bool unescape )
 */
 size_t HdlcSerial::write(std::vector<uint8_t> &data, bool encapsulate)
 {
+    if (data.size()) {
+        sent(&data[0], data.size(), !encapsulate);
+    }
+
     if (!encapsulate) {
         size_t bytesWritten = Serial::write(data);
         if (bytesWritten) hexdump_tx(&data[0], bytesWritten);
@@ -153,7 +173,21 @@ size_t HdlcSerial::read(std::vector<uint8_t> &buffer, size_t size, bool unescape
 
     buffer.reserve(buffer.size() + (size + HDLC_OVERHEAD_LENGTH));
     
-    size_t bytesRead = Serial::read(buffer, size + HDLC_OVERHEAD_LENGTH);
+    size_t bytesRead;
+
+    if (unescape && adaptiveTimeout) {
+        size_t offset = buffer.size();
+
+        buffer.resize(offset + size + HDLC_OVERHEAD_LENGTH);
+        bytesRead = readFrame(&buffer[offset], size + HDLC_OVERHEAD_LENGTH);
+        buffer.resize(offset + bytesRead);
+    } else if (carry.size()) {
+        bytesRead = carry.size() < size + HDLC_OVERHEAD_LENGTH ? carry.size() : size + HDLC_OVERHEAD_LENGTH;
+        buffer.insert(buffer.end(), carry.begin(), carry.begin() + bytesRead);
+        carry.erase(carry.begin(), carry.begin() + bytesRead);
+    } else {
+        bytesRead = Serial::read(buffer, size + HDLC_OVERHEAD_LENGTH);
+    }
 
     if (!unescape || !bytesRead) {
         if (bytesRead) hexdump_rx(&buffer[0], bytesRead);
@@ -166,3 +200,439 @@ size_t HdlcSerial::read(std::vector<uint8_t> &buffer, size_t size, bool unescape
 
     return buffer.size();
 }
+
+/**
+* @brief HdlcSerial::available - Bytes waiting to be read, including any kept from the last frame read
+*
+* @return size_t
+*/
+size_t HdlcSerial::available()
+{
+    return carry.size() + Serial::available();
+}
+
+/**
+* @brief HdlcSerial::setAdaptiveTimeout
+*
+* @param bool enabled
+* @return void
+*/
+void HdlcSerial::setAdaptiveTimeout(bool enabled)
+{
+    adaptiveTimeout = enabled;
+}
+
+/**
+* @brief HdlcSerial::isAdaptiveTimeout
+*
+* @return bool
+*/
+bool HdlcSerial::isAdaptiveTimeout()
+{
+    return adaptiveTimeout;
+}
+
+/**
+* @brief HdlcSerial::getResponseTimeout - ms a response to a request would be waited for
+*
+* @param uint32_t key
+* @return uint32_t
+*/
+uint32_t HdlcSerial::getResponseTimeout(uint32_t key)
+{
+    auto it = commandRtt.find(key);
+
+    // a request never seen before can be far slower than the ones measured so far
+    if (it == commandRtt.end()) {
+        return getInitialTimeout();
+    }
+
+    RttStats stats = it->second.getStats();
+
+    if (!stats.samples && !stats.timeouts) {
+        return getInitialTimeout();
+    }
+
+    return stats.timeout;
+}
+
+/**
+* @brief HdlcSerial::getRttStats
+*
+* @return RttStats
+*/
+RttStats HdlcSerial::getRttStats()
+{
+    return rtt.getStats();
+}
+
+/**
+* @brief HdlcSerial::getCommandRttStats
+*
+* @return std::map<uint32_t, RttStats>
+*/
+std::map<uint32_t, RttStats> HdlcSerial::getCommandRttStats()
+{
+    std::map<uint32_t, RttStats> ret;
+
+    for (auto &it : commandRtt) {
+        ret[it.first] = it.second.getStats();
+    }
+
+    return ret;
+}
+
+/**
+* @brief HdlcSerial::resetRttStats
+*
+* @return void
+*/
+void HdlcSerial::resetRttStats()
+{
+    rtt.reset();
+    commandRtt.clear();
+}
+
+/**
+* @brief HdlcSerial::writeFrames - Write already framed data as is, without noting a request
+*
+* @param uint8_t* data
+* @param size_t size
+* @return size_t - Bytes written
+*/
+size_t HdlcSerial::writeFrames(const uint8_t* data, size_t size)
+{
+    size_t bytesWritten = 0;
+
+    // a write that times out part way would leave a frame cut in half
+    // with every frame after it lost, so keep going while the port takes data
+    while (bytesWritten < size) {
+        size_t written = Serial::write(data + bytesWritten, size - bytesWritten);
+
+        if (!written) {
+            break;
+        }
+
+        bytesWritten += written;
+    }
+
+    if (bytesWritten) hexdump_tx((uint8_t*)data, bytesWritten);
+
+    return bytesWritten;
+}
+
+/**
+* @brief HdlcSerial::receiveFrames - Wait for data and pass every complete frame that came in to handler
+*
+* @param HdlcFrameHandler handler
+* @param uint32_t timeout - ms to wait for the first byte
+* @return bool - false if nothing arrived in time
+*/
+bool HdlcSerial::receiveFrames(const HdlcFrameHandler& handler, uint32_t timeout)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+    size_t received = carry.size();
+
+    while (!Serial::available()) {
+        uint8_t byte;
+
+        // block for the first byte instead of polling, bounded by the port timeout
+        if (Serial::read(&byte, 1)) {
+            carry.push_back(byte);
+            break;
+        }
+
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+    }
+
+    size_t offset = carry.size();
+    size_t waiting = Serial::available();
+
+    if (waiting) {
+        carry.resize(offset + waiting);
+        carry.resize(offset + Serial::read(&carry[offset], waiting));
+    }
+
+    if (carry.size() > received) {
+        hexdump_rx(&carry[received], carry.size() - received);
+    }
+
+    std::vector<uint8_t> packet;
+    size_t start = 0;
+
+    for (size_t i = 0; i < carry.size(); i++) {
+        if (carry[i] != HDLC_CONTROL_CHAR) {
+            continue;
+        }
+
+        if (i > start) {
+            if (hdlc_decode(&carry[start], i - start, packet)) {
+                handler(&packet[0], packet.size());
+            } else {
+                crcErrors++;
+            }
+        }
+
+        start = i + 1;
+    }
+
+    // keep a partial frame for the next call
+    carry.erase(carry.begin(), carry.begin() + start);
+
+    return true;
+}
+
+/**
+* @brief HdlcSerial::receiveResponses - receiveFrames waiting as long as the round trips of the last request written say
+*
+* @param HdlcFrameHandler handler
+* @return bool - false if nothing arrived in time
+*/
+bool HdlcSerial::receiveResponses(const HdlcFrameHandler& handler)
+{
+    auto start = std::chrono::steady_clock::now();
+    uint32_t timeout = getResponseTimeout(rttKey);
+
+    // with requests pipelined the time to the next frame is no round trip, nothing is measured
+    rttPending = false;
+
+    while (!receiveFrames(handler, timeout)) {
+        RttEstimator& estimator = getCommandRtt(rttKey);
+
+        estimator.addTimeout();
+
+        uint32_t elapsed = (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+        // nothing more to wait for once the backoff is at the ceiling
+        if (estimator.getTimeout() <= elapsed) {
+            return false;
+        }
+
+        LOGD("No response yet, waiting up to %u ms\n", estimator.getTimeout());
+
+        timeout = estimator.getTimeout() - elapsed;
+    }
+
+    return true;
+}
+
+/**
+* @brief HdlcSerial::getCrcErrors - Frames receiveFrames dropped for a bad CRC
+*
+* @return uint64_t
+*/
+uint64_t HdlcSerial::getCrcErrors()
+{
+    return crcErrors;
+}
+
+/**
+* @brief HdlcSerial::getRttKey - The first byte, the command for the HDLC protocols
+*
+* @param uint8_t* packet
+* @param size_t size
+* @return uint32_t
+*/
+uint32_t HdlcSerial::getRttKey(const uint8_t* packet, size_t size)
+{
+    return size ? packet[0] : 0;
+}
+
+/**
+* @brief HdlcSerial::sent - Note a request going out
+*
+* @param uint8_t* data
+* @param size_t size
+* @param bool framed - data is already an escaped frame
+*/
+void HdlcSerial::sent(const uint8_t* data, size_t size, bool framed)
+{
+    uint8_t packet[4];
+    size_t packetSize = 0;
+
+    if (stale) {
+        // a response that came in after its wait gave up is not the answer to this request
+        std::vector<uint8_t> discard;
+        size_t waiting;
+
+        carry.clear();
+
+        while ((waiting = Serial::available())) {
+            discard.clear();
+            Serial::read(discard, waiting);
+        }
+
+        stale = false;
+    }
+
+    if (framed) {
+        for (size_t i = 0; i < size && packetSize < sizeof(packet); i++) {
+            if (data[i] == HDLC_CONTROL_CHAR) {
+                if (packetSize) {
+                    break;
+                }
+            } else if (data[i] == HDLC_ESC_CHAR && i + 1 < size) {
+                packet[packetSize++] = data[++i] ^ HDLC_ESC_MASK;
+            } else {
+                packet[packetSize++] = data[i];
+            }
+        }
+    } else {
+        packetSize = size < sizeof(packet) ? size : sizeof(packet);
+        memcpy(packet, data, packetSize);
+    }
+
+    rttKey     = getRttKey(packet, packetSize);
+    rttPending = true;
+    rttSent    = std::chrono::steady_clock::now();
+}
+
+/**
+* @brief HdlcSerial::readFrame - Read up to the end of the next frame, waiting as long as the round trips say
+*
+* A response that does not come within the estimate backs the estimate off
+* and is waited on up to the backed off time, until the ceiling is reached.
+*
+* @param uint8_t* buf
+* @param size_t size
+* @return size_t - Bytes read, 0 on timeout
+*/
+size_t HdlcSerial::readFrame(uint8_t* buf, size_t size)
+{
+    uint32_t timeout = getResponseTimeout(rttKey);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+    bool measure = rttPending;
+    bool started = false;   // seen a byte other than the flag
+    size_t scanned = 0;
+    size_t end = 0;
+
+    rttPending = false;
+
+    while (true) {
+        for (; scanned < carry.size() && scanned < size; scanned++) {
+            if (carry[scanned] != HDLC_CONTROL_CHAR) {
+                started = true;
+            } else if (started) {
+                end = scanned + 1;
+                break;
+            }
+        }
+
+        if (end || scanned >= size) {
+            break;
+        }
+
+        size_t offset = carry.size();
+        size_t waiting = Serial::available();
+
+        if (waiting) {
+            carry.resize(offset + waiting);
+            carry.resize(offset + Serial::read(&carry[offset], waiting));
+        } else {
+            auto now = std::chrono::steady_clock::now();
+
+            if (now >= deadline) {
+                if (!measure) {
+                    break;
+                }
+
+                RttEstimator& estimator = getCommandRtt(rttKey);
+
+                estimator.addTimeout();
+
+                // nothing more to wait for once the backoff is at the ceiling
+                auto extended = rttSent + std::chrono::milliseconds(estimator.getTimeout());
+
+                if (extended <= now) {
+                    break;
+                }
+
+                LOGD("No response yet, waiting up to %u ms\n", estimator.getTimeout());
+
+                deadline = extended;
+                continue;
+            }
+
+            // block for the first byte instead of polling, bounded by the port timeout
+            uint8_t byte;
+
+            if (!Serial::read(&byte, 1)) {
+                continue;
+            }
+
+            carry.push_back(byte);
+        }
+
+        auto now = std::chrono::steady_clock::now();
+
+        if (measure) {
+            uint32_t sample = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(now - rttSent).count();
+
+            getCommandRtt(rttKey).addSample(sample);
+            rtt.addSample(sample);
+
+            measure = false;
+        }
+
+        // keep waiting for as long as the rest of the frame keeps coming
+        deadline = now + std::chrono::milliseconds(timeout);
+    }
+
+    if (!started) {
+        if (measure) {
+            // the request estimate already backed off while waiting
+            rtt.addTimeout();
+            stale = true;
+        }
+
+        return 0;
+    }
+
+    if (!end) {
+        // cut short by the timeout or the size of buf
+        end = scanned;
+    }
+
+    memcpy(buf, &carry[0], end);
+
+    carry.erase(carry.begin(), carry.begin() + end);
+
+    return end;
+}
+
+/**
+* @brief HdlcSerial::getCommandRtt - Estimator of a request key, made on first use
+*/
+RttEstimator& HdlcSerial::getCommandRtt(uint32_t key)
+{
+    auto it = commandRtt.find(key);
+
+    if (it == commandRtt.end()) {
+        it = commandRtt.insert(std::make_pair(key, RttEstimator(getInitialTimeout(), HDLC_RTT_MIN_TIMEOUT, getRttCeiling()))).first;
+    }
+
+    return it->second;
+}
+
+/**
+* @brief HdlcSerial::getInitialTimeout - Wait for a request key without samples, never
+*                                        less than HDLC_RTT_INITIAL_TIMEOUT
+*/
+uint32_t HdlcSerial::getInitialTimeout()
+{
+    uint32_t timeout = rtt.getTimeout();
+
+    return timeout > HDLC_RTT_INITIAL_TIMEOUT ? timeout : HDLC_RTT_INITIAL_TIMEOUT;
+}
+
+/**
+* @brief HdlcSerial::getRttCeiling - Longest wait, never less than the port timeout
+*/
+uint32_t HdlcSerial::getRttCeiling()
+{
+    uint32_t timeout = getTimeout().read_timeout_constant;
+
+    return timeout > HDLC_RTT_MAX_TIMEOUT ? timeout : HDLC_RTT_MAX_TIMEOUT;
+}
@@ -6,18 +6,45 @@
 * @package OpenPST
 * @brief HDLC serial port implementation
 *
+* Reading a response waits for one whole frame instead of the full port
+* timeout. How long it waits is worked out from the round trips measured on
+* the port, per request command once that command has been answered, see
+* RttEstimator. Bytes received past the end of the frame are kept for the
+* next read.
+*
 * @author Gassan Idriss <ghassani@gmail.com>
 */
 
 #ifndef _SERIAL_HDLC_SERIAL_H
 #define _SERIAL_HDLC_SERIAL_H
 
+#include <map>
+#include <vector>
+#include <chrono>
+#include <functional>
 #include "include/definitions.h"
 #include "serial/serial.h"
 #include "util/hexdump.h"
+#include "util/rtt_estimator.h"
+#include "util/sleep.h"
 #include "qc/hdlc.h"
 
+/**
+* Shortest and longest wait for a response, the port timeout is used until
+* the first round trip is measured. A request never measured before is
+* given at least the initial wait, slow commands like an md5sum or a flash
+* erase would otherwise fail against an estimate made from quick ones.
+*/
+#define HDLC_RTT_MIN_TIMEOUT 100 // ms
+#define HDLC_RTT_MAX_TIMEOUT 5000 // ms
+#define HDLC_RTT_INITIAL_TIMEOUT 1000 // ms
+
 namespace OpenPST {
+    /**
+    * Given each frame receiveFrames takes in, unescaped and without its CRC
+    */
+    typedef std::function<void(const uint8_t* packet, size_t size)> HdlcFrameHandler;
+
     class HdlcSerial : public serial::Serial {
         public:
             /**
@@ -89,6 +116,153 @@ namespace OpenPST {
             * @return size_t bytes read
             */
             size_t read(std::vector<uint8_t> &buffer, size_t size, bool unescape = true);
+
+            /**
+            * @brief available - Bytes waiting to be read, including any kept from the last frame read
+            *
+            * @super Serial::available();
+            *
+            * @return size_t
+            */
+            size_t available();
+
+            /**
+            * @brief setAdaptiveTimeout - Wait for responses as long as the measured
+            * round trips say instead of the fixed port timeout, on by default
+            *
+            * @param bool enabled
+            * @return void
+            */
+            void setAdaptiveTimeout(bool enabled);
+
+            /**
+            * @brief isAdaptiveTimeout
+            *
+            * @return bool
+            */
+            bool isAdaptiveTimeout();
+
+            /**
+            * @brief getResponseTimeout - ms a response to a request would be waited for
+            *
+            * @param uint32_t key - See getRttKey
+            * @return uint32_t
+            */
+            uint32_t getResponseTimeout(uint32_t key);
+
+            /**
+            * @brief getRttStats - Round trips of every request on the port
+            *
+            * @return RttStats
+            */
+            RttStats getRttStats();
+
+            /**
+            * @brief getCommandRttStats - Round trips by request key
+            *
+            * @return std::map<uint32_t, RttStats>
+            */
+            std::map<uint32_t, RttStats> getCommandRttStats();
+
+            /**
+            * @brief resetRttStats - Forget every measurement
+            *
+            * @return void
+            */
+            void resetRttStats();
+
+            /**
+            * @brief writeFrames - Write already framed data as is, without noting a request
+            * the way write does. For a reader that owns the receiving side and matches
+            * responses itself, where dropping a late response or the partial frame kept
+            * would lose the answer to another request
+            *
+            * @param uint8_t* data
+            * @param size_t size
+            * @return size_t - Bytes written, less than size only once the port stops taking data
+            */
+            size_t writeFrames(const uint8_t* data, size_t size);
+
+            /**
+            * @brief receiveFrames - Wait for data and pass every complete frame that came in
+            * to handler. Frames failing the CRC are dropped and counted, a partial frame is
+            * kept for the next call. For pipelined requests, whose responses are split out
+            * here rather than read one at a time
+            *
+            * @param HdlcFrameHandler handler
+            * @param uint32_t timeout - ms to wait for the first byte, each wait is a read
+            *                           bounded by the port timeout
+            * @return bool - false if nothing arrived in time
+            */
+            bool receiveFrames(const HdlcFrameHandler& handler, uint32_t timeout);
+
+            /**
+            * @brief receiveResponses - receiveFrames waiting as long as the round trips of
+            * the last request written say, backing them off up to the ceiling while nothing
+            * comes, like a single response read
+            *
+            * @param HdlcFrameHandler handler
+            * @return bool - false if nothing arrived in time
+            */
+            bool receiveResponses(const HdlcFrameHandler& handler);
+
+            /**
+            * @brief getCrcErrors - Frames receiveFrames dropped for a bad CRC
+            *
+            * @return uint64_t
+            */
+            uint64_t getCrcErrors();
+
+        protected:
+            /**
+            * @brief getRttKey - Key round trips of a request are kept under,
+            * the first byte, which is the command for the HDLC protocols
+            *
+            * @param uint8_t* packet - Unframed request
+            * @param size_t size
+            * @return uint32_t
+            */
+            virtual uint32_t getRttKey(const uint8_t* packet, size_t size);
+
+        private:
+            bool adaptiveTimeout;
+            RttEstimator rtt;
+            std::map<uint32_t, RttEstimator> commandRtt;
+            std::vector<uint8_t> carry;                 // received past the end of the last frame read
+            uint32_t rttKey;                            // of the last request written
+            bool rttPending;                            // the last request has not been answered yet
+            bool stale;                                 // the last wait timed out, a late response may come in
+            uint64_t crcErrors;
+            std::chrono::steady_clock::time_point rttSent;
+
+            /**
+            * @brief sent - Note a request going out
+            */
+            void sent(const uint8_t* data, size_t size, bool framed);
+
+            /**
+            * @brief readFrame - Read up to the end of the next frame, waiting as long as the round trips say
+            *
+            * @param uint8_t* buf
+            * @param size_t size
+            * @return size_t - Bytes read, 0 on timeout
+            */
+            size_t readFrame(uint8_t* buf, size_t size);
+
+            /**
+            * @brief getCommandRtt - Estimator of a request key, made on first use
+            */
+            RttEstimator& getCommandRtt(uint32_t key);
+
+            /**
+            * @brief getInitialTimeout - Wait for a request key without samples
+            */
+            uint32_t getInitialTimeout();
+
+            /**
+            * @brief getRttCeiling - Longest wait, never less than the port timeout
+            */
+            uint32_t getRttCeiling();
     };
 }
 
@@ -11,12 +11,16 @@
 */
 
 #include "qcdm_serial.h"
+#include "qc/dm_nv_bulk_reader.h"
 
 using namespace OpenPST;
 using serial::IOException;
 
 QcdmSerial::QcdmSerial(std::string port, int baudrate, serial::Timeout timeout) :
-    HdlcSerial (port, baudrate, timeout)
+    HdlcSerial (port, baudrate, timeout),
+	nvCacheEnabled(false),
+	nvCacheHits(0),
+	nvCacheMisses(0)
 {
 
 }
@@ -83,7 +87,14 @@ bool QcdmSerial::sendSpc(std::string spc)
 
 	response = (QcdmSpcResponse*)buffer;
 
-	return response->status == 1;
+	if (response->status != 1) {
+		return false;
+	}
+
+	// protected items can read back blanked until the device is unlocked
+	invalidateNvCache();
+
+	return true;
 }
 
 bool QcdmSerial::sendPassword(std::string password)
@@ -127,6 +138,8 @@ bool QcdmSerial::sendPassword(std::string password)
 
 void QcdmSerial::switchToDload()
 {
+	invalidateNvCache();
+
 	sendCommand(DIAG_DLOAD_F, false);
 }
 
@@ -138,6 +151,9 @@ bool QcdmSerial::setPhoneMode(QcdmPhoneMode mode)
 	packet.command = DIAG_CONTROL_F;
     packet.mode	   = mode;
 
+	// offline and reset modes reload NV, so nothing cached can be trusted after
+	invalidateNvCache();
+
 	sendCommand(packet.command, reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
 
 	response = (QcdmPhoneModeResponse*)buffer;
@@ -150,6 +166,25 @@ QcdmNvResponse QcdmSerial::readNV(uint16_t itemId)
 	QcdmNvResponse response = {};
 	QcdmNvRequest packet = {};
 
+	if (nvCacheEnabled) {
+		std::lock_guard<std::mutex> lock(nvCacheMutex);
+		auto cached = nvCache.find(itemId);
+
+		if (cached != nvCache.end()) {
+			uint16_t status = kQcdmNvStatusDone;
+
+			// callers reading buffer and lastRxSize see what the device would have sent
+			std::memcpy(buffer, &cached->second, sizeof(QcdmNvResponse));
+			std::memcpy(&buffer[sizeof(QcdmNvResponse)], &status, sizeof(status));
+			lastRxSize = sizeof(QcdmNvResponse) + sizeof(status);
+
+			nvCacheHits++;
+			return cached->second;
+		}
+
+		nvCacheMisses++;
+	}
+
 	packet.command	= DIAG_NV_READ_F;
     packet.nvItem	= itemId;
 
@@ -157,13 +192,66 @@ QcdmNvResponse QcdmSerial::readNV(uint16_t itemId)
 
 	std::memcpy(&response, buffer, sizeof(QcdmNvResponse));
 
+	if (lastRxSize >= sizeof(QcdmNvResponse) + sizeof(uint16_t)) {
+		cacheNV(response, *reinterpret_cast<uint16_t*>(&buffer[sizeof(QcdmNvResponse)]));
+	}
+
 	return response;
 }
 
+size_t QcdmSerial::prefetchNV(const std::vector<uint16_t>& items)
+{
+	std::vector<uint16_t> missing;
+	DmNvBulkResult result;
+	size_t cached = 0;
+
+	if (!nvCacheEnabled) {
+		return 0;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(nvCacheMutex);
+
+		for (auto item : items) {
+			if (nvCache.find(item) == nvCache.end()) {
+				missing.push_back(item);
+			} else {
+				cached++;
+			}
+		}
+	}
+
+	if (!missing.size()) {
+		return cached;
+	}
+
+	DmNvBulkReader reader(*this);
+
+	reader.start(missing);
+
+	while (reader.next(result)) {
+		nvCacheMisses++;
+
+		if (result.status == kDmNvBulkOk) {
+			QcdmNvResponse response = {};
+
+			response.command = DIAG_NV_READ_F;
+			response.nvItem  = result.item;
+			std::memcpy(&response.data, result.data, sizeof(response.data));
+
+			cacheNV(response, result.nvStatus);
+			cached++;
+		}
+	}
+
+	return cached;
+}
+
 
 bool QcdmSerial::writeNV(uint16_t itemId, uint8_t* data, size_t size)
 {
-	QcdmNvRequest packet;
+	QcdmNvRequest packet = {};
+	QcdmNvResponse response = {};
 	
 	if (size > DIAG_NV_ITEM_SIZE) {
 		throw QcdmInvalidArgument("Data is larger than DIAG_NV_ITEM_SIZE");
@@ -173,11 +261,90 @@ bool QcdmSerial::writeNV(uint16_t itemId, uint8_t* data, size_t size)
     packet.nvItem	= itemId;
 	memcpy(&packet.data, data, size);
 
+	// if the write fails part way the old value must not be served
+	invalidateNvCache(itemId);
+
 	sendCommand(packet.command, reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
 
+	// the response echoes the item as written, keep it as the new value
+	if (lastRxSize >= sizeof(QcdmNvResponse) + sizeof(uint16_t)) {
+		std::memcpy(&response, buffer, sizeof(response));
+		response.command = DIAG_NV_READ_F;
+
+		cacheNV(response, *reinterpret_cast<uint16_t*>(&buffer[sizeof(QcdmNvResponse)]));
+	}
+
 	return true;
 }
 
+void QcdmSerial::setNvCacheEnabled(bool enabled)
+{
+	nvCacheEnabled = enabled;
+
+	if (!enabled) {
+		invalidateNvCache();
+	}
+}
+
+bool QcdmSerial::isNvCacheEnabled()
+{
+	return nvCacheEnabled;
+}
+
+void QcdmSerial::invalidateNvCache()
+{
+	std::lock_guard<std::mutex> lock(nvCacheMutex);
+
+	nvCache.clear();
+}
+
+void QcdmSerial::invalidateNvCache(uint16_t itemId)
+{
+	std::lock_guard<std::mutex> lock(nvCacheMutex);
+
+	nvCache.erase(itemId);
+}
+
+void QcdmSerial::invalidateNvCache(const uint8_t* request, size_t size)
+{
+	if (!size) {
+		return;
+	}
+
+	switch (request[0]) {
+		case DIAG_NV_WRITE_F:
+			if (size >= 3) {
+				invalidateNvCache(static_cast<uint16_t>(request[1] | (request[2] << 8)));
+			}
+			break;
+		case DIAG_CONTROL_F:
+		case DIAG_SPC_F:
+		case DIAG_PASSWORD_F:
+		case DIAG_SUBSYS_CMD_F: // EFS holds the item files
+			invalidateNvCache();
+			break;
+	}
+}
+
+uint32_t QcdmSerial::getNvCacheHits()
+{
+	return nvCacheHits;
+}
+
+uint32_t QcdmSerial::getNvCacheMisses()
+{
+	return nvCacheMisses;
+}
+
+void QcdmSerial::cacheNV(const QcdmNvResponse& response, uint16_t status)
+{
+	if (nvCacheEnabled && status == kQcdmNvStatusDone) {
+		std::lock_guard<std::mutex> lock(nvCacheMutex);
+
+		nvCache[response.nvItem] = response;
+	}
+}
+
 QcdmNvPeekResponse QcdmSerial::peekNV(uint32_t address, uint8_t size)
 {
 	QcdmNvPeekRequest packet = {};
@@ -245,12 +412,15 @@ void QcdmSerial::sendCommand(uint8_t command, uint8_t* data, size_t size, bool v
 	size_t responseSize;
 	std::string error;
 
-	write(data, size);
+	lastTxSize = write(data, size);
 
 	if (!(responseSize = read(buffer, DIAG_MAX_PACKET_SIZE))) {
+		lastRxSize = 0;
 		throw QcdmResponseError("Device did not respond");
 	}
 
+	lastRxSize = responseSize;
+
 	if (validate) {
 		if (command && response->command != command) {
 			error = getErrorString(response->command);
@@ -270,6 +440,28 @@ void QcdmSerial::sendCommand(uint8_t command, uint8_t* data, size_t size, bool v
 	}
 }
 
+/**
+* @brief getRttKey - The command, and the subsystem ids for subsystem requests
+*
+* @param uint8_t* packet
+* @param size_t size
+* @return uint32_t
+*/
+uint32_t QcdmSerial::getRttKey(const uint8_t* packet, size_t size)
+{
+	if (!size) {
+		return 0;
+	}
+
+	// subsystem commands from different subsystems take very different times
+	if ((packet[0] == DIAG_SUBSYS_CMD_F || packet[0] == DIAG_SUBSYS_CMD_VER_2_F) && size >= sizeof(QcdmSubsysHeader)) {
+		const QcdmSubsysHeader* header = (const QcdmSubsysHeader*)packet;
+		return header->command | (header->subsysId << 8) | (header->subsysCommand << 16);
+	}
+
+	return packet[0];
+}
+
 std::string QcdmSerial::getErrorString(uint8_t responseCommand)
 {
 	std::string error;
@@ -298,6 +490,93 @@ std::string QcdmSerial::getErrorString(uint8_t responseCommand)
 }
 
 
+std::vector<std::vector<uint8_t>> QcdmSerial::getLogMaskRequests(const std::vector<uint16_t>& logCodes)
+{
+	std::map<uint32_t, std::vector<uint8_t>> masks;
+	std::vector<std::vector<uint8_t>> requests;
+
+	for (auto code : logCodes) {
+		std::vector<uint8_t>& mask = masks[code >> 12];
+		size_t item = code & 0x0FFF;
+
+		if (mask.size() <= item / 8) {
+			mask.resize(item / 8 + 1, 0x00);
+		}
+
+		mask[item / 8] |= 1 << (item % 8);
+	}
+
+	for (auto &it : masks) {
+		std::vector<uint8_t> packet(sizeof(QcdmLogConfigRequest), 0x00);
+
+		packet.insert(packet.end(), it.second.begin(), it.second.end());
+
+		QcdmLogConfigRequest* request = reinterpret_cast<QcdmLogConfigRequest*>(&packet[0]);
+
+		request->command		= DIAG_LOG_CONFIG_F;
+		request->operation		= kQcdmLogConfigSetMask;
+		request->equipmentId	= it.first;
+		request->items			= it.second.size() * 8;
+
+		requests.push_back(packet);
+	}
+
+	return requests;
+}
+
+bool QcdmSerial::setLogMask(const std::vector<uint16_t>& logCodes)
+{
+	bool result = true;
+
+	for (auto &packet : getLogMaskRequests(logCodes)) {
+		sendCommand(DIAG_LOG_CONFIG_F, &packet[0], packet.size());
+
+		if (((QcdmLogConfigResponse*)buffer)->status != 0) {
+			LOGE("Log mask for equipment id %d was refused\n", reinterpret_cast<QcdmLogConfigRequest*>(&packet[0])->equipmentId);
+			result = false;
+		}
+	}
+
+	return result;
+}
+
+bool QcdmSerial::disableLogging()
+{
+	QcdmLogConfigRequest packet = {};
+
+	packet.command		= DIAG_LOG_CONFIG_F;
+	packet.operation	= kQcdmLogConfigDisable;
+
+	sendCommand(DIAG_LOG_CONFIG_F, reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
+
+	return ((QcdmLogConfigResponse*)buffer)->status == 0;
+}
+
+bool QcdmSerial::setEventReporting(bool enabled)
+{
+	QcdmEventReportRequest packet = {};
+
+	packet.command	= DIAG_EVENT_REPORT_F;
+	packet.enable	= enabled ? 1 : 0;
+
+	sendCommand(DIAG_EVENT_REPORT_F, reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
+
+	return true;
+}
+
+bool QcdmSerial::setMessageMask(uint32_t mask)
+{
+	QcdmExtMsgConfigRequest packet = {};
+
+	packet.command		= DIAG_EXT_MSG_CONFIG_F;
+	packet.operation	= kQcdmExtMsgConfigSetAllRtMasks;
+	packet.mask			= mask;
+
+	sendCommand(DIAG_EXT_MSG_CONFIG_F, reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
+
+	return true;
+}
+
 int QcdmSerial::getErrorLog()
 {
     /*
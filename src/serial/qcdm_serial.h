@@ -14,6 +14,9 @@
 #ifndef _SERIAL_QCDM_SERIAL_H
 #define _SERIAL_QCDM_SERIAL_H
 
+#include <map>
+#include <vector>
+#include <mutex>
 #include "include/definitions.h"
 #include "serial/serial.h"
 #include "serial/hdlc_serial.h"
@@ -133,6 +136,16 @@ namespace OpenPST {
             */
 			QcdmNvResponse readNV(uint16_t itemId);
 
+			/**
+			* @brief prefetchNV - Load a set of items into the NV cache with pipelined
+			* reads. Items already cached are not read again, items the device
+			* does not return are left for readNV to report
+			*
+			* @param std::vector<uint16_t>& items
+			* @return size_t - Items of the set now in the cache
+			*/
+			size_t prefetchNV(const std::vector<uint16_t>& items);
+
             /**
             * @brief writeNV - Write an item to non volatile memory
             * @param itemId - NV Item ID
@@ -149,6 +162,64 @@ namespace OpenPST {
 
 			QcdmNvPeekResponse peekNV(uint32_t address, uint8_t size);
 
+			/**
+			* @brief setNvCacheEnabled - Serve repeated readNV calls from memory.
+			* Only successful reads are kept, writeNV updates the cached item, and
+			* the whole cache is dropped on phone mode changes and accepted SPCs.
+			* Code writing NV any other way calls invalidateNvCache, and the owner
+			* of the port drops the cache when it reconnects
+			*
+			* @param bool enabled - Disabling also drops the cache
+			* @return void
+			*/
+			void setNvCacheEnabled(bool enabled);
+
+			/**
+			* @brief isNvCacheEnabled
+			*
+			* @return bool
+			*/
+			bool isNvCacheEnabled();
+
+			/**
+			* @brief invalidateNvCache - Drop every cached item
+			*
+			* @return void
+			*/
+			void invalidateNvCache();
+
+			/**
+			* @brief invalidateNvCache - Drop a single cached item
+			*
+			* @param uint16_t itemId
+			* @return void
+			*/
+			void invalidateNvCache(uint16_t itemId);
+
+			/**
+			* @brief invalidateNvCache - Drop what a raw request may change, for
+			* requests sent without readNV or writeNV
+			*
+			* @param uint8_t* request - Unframed request
+			* @param size_t size
+			* @return void
+			*/
+			void invalidateNvCache(const uint8_t* request, size_t size);
+
+			/**
+			* @brief getNvCacheHits - readNV calls served from the cache
+			*
+			* @return uint32_t
+			*/
+			uint32_t getNvCacheHits();
+
+			/**
+			* @brief getNvCacheMisses - Items read from the device while the cache is enabled
+			*
+			* @return uint32_t
+			*/
+			uint32_t getNvCacheMisses();
+
 			void switchToDload();
 
 			bool sendHtcNvUnlock();
@@ -159,6 +230,61 @@ namespace OpenPST {
 
             
 
+			/**
+			* @brief setLogMask - Enable DIAG_LOG_F packets for a set of log codes, one
+			* DIAG_LOG_CONFIG_F request per equipment id. Codes not given are disabled
+			* for those equipment ids
+			*
+			* @param std::vector<uint16_t>& logCodes - e.g. 0x1098, 0xB0C0
+			* @return bool - false if the device refused any of the masks
+			*
+			* @throws QcdmResponseError
+			* @throws serial::PortNotOpenedException
+			* @throws serial::IOException
+			*/
+			bool setLogMask(const std::vector<uint16_t>& logCodes);
+
+			/**
+			* @brief getLogMaskRequests - The DIAG_LOG_CONFIG_F requests setLogMask sends,
+			* for sending them some other way, like through a DmClient
+			*
+			* @param std::vector<uint16_t>& logCodes
+			* @return std::vector<std::vector<uint8_t>> - One request per equipment id
+			*/
+			static std::vector<std::vector<uint8_t>> getLogMaskRequests(const std::vector<uint16_t>& logCodes);
+
+			/**
+			* @brief disableLogging - Clear the log masks of every equipment id
+			* @return bool
+			*
+			* @throws QcdmResponseError
+			* @throws serial::PortNotOpenedException
+			* @throws serial::IOException
+			*/
+			bool disableLogging();
+
+			/**
+			* @brief setEventReporting - Turn event reports on or off
+			* @param bool enabled
+			* @return bool
+			*
+			* @throws QcdmResponseError
+			* @throws serial::PortNotOpenedException
+			* @throws serial::IOException
+			*/
+			bool setEventReporting(bool enabled);
+
+			/**
+			* @brief setMessageMask - Set the extended message level mask of every subsystem
+			* @param uint32_t mask - 0 turns extended messages off
+			* @return bool
+			*
+			* @throws QcdmResponseError
+			* @throws serial::PortNotOpenedException
+			* @throws serial::IOException
+			*/
+			bool setMessageMask(uint32_t mask);
+
             int getErrorLog();
             int clearErrorLog();
 
@@ -172,7 +298,30 @@ namespace OpenPST {
 			void sendCommand(uint8_t command, bool validate = true);
 			void sendCommand(uint8_t command, uint8_t* data, size_t size, bool validate = true);
 			std::string getErrorString(uint8_t responseCommand);
+		protected:
+			/**
+			* @brief getRttKey - The command, and the subsystem ids for subsystem requests
+			*
+			* @param uint8_t* packet
+			* @param size_t size
+			* @return uint32_t
+			*/
+			uint32_t getRttKey(const uint8_t* packet, size_t size);
 		private:
+			/**
+			* @brief cacheNV - Keep an NV response in the cache if the device reported success
+			*
+			* @param QcdmNvResponse& response
+			* @param uint16_t status - QcdmNvStatus of the response
+			* @return void
+			*/
+			void cacheNV(const QcdmNvResponse& response, uint16_t status);
+
+			std::map<uint16_t, QcdmNvResponse> nvCache;
+			std::mutex nvCacheMutex;  // writers on other threads invalidate
+			bool nvCacheEnabled;
+			uint32_t nvCacheHits;
+			uint32_t nvCacheMisses;
 
     };
 }
@@ -25,6 +25,7 @@ StreamingDloadSerial::StreamingDloadSerial(std::string port, int baudrate, seria
     state({})
 {
     state.hello.maxPreferredBlockSize = STREAMING_DLOAD_MAX_DATA_SIZE;
+    state.blockSize = STREAMING_DLOAD_MAX_DATA_SIZE;
 }
 
 /**
@@ -97,6 +98,19 @@ int StreamingDloadSerial::sendHello(std::string magic, uint8_t version, uint8_t
     memcpy(&state.hello.featureBits, &buffer[dataStartIndex + state.hello.flashIdLength + sizeof(state.hello.windowSize) + sizeof(state.hello.numberOfSectors) + sectorSize-1], sizeof(state.hello.featureBits));
     state.hello.featureBits = flip_endian16(state.hello.featureBits);
 
+    // sector addressing is only in effect when we asked for it and the device echoed it back,
+    // otherwise requests stay byte addressed and are limited to 4GB
+    state.sectorAddresses = (featureBits & STREAMING_DLOAD_FEATURE_BIT_SECTOR_ADDRESSES) != 0 &&
+        (state.hello.featureBits & STREAMING_DLOAD_FEATURE_BIT_SECTOR_ADDRESSES) != 0;
+
+    if (!state.hello.maxPreferredBlockSize) {
+        LOGE("Device reported no preferred block size, using %d bytes\n", STREAMING_DLOAD_MAX_DATA_SIZE);
+        state.hello.maxPreferredBlockSize = STREAMING_DLOAD_MAX_DATA_SIZE;
+    }
+
+    // a new session starts at the device maximum until calibrated
+    state.blockSize = state.hello.maxPreferredBlockSize;
+
     return kStreamingDloadSuccess;
 }
 
@@ -467,6 +481,8 @@ int StreamingDloadSerial::closeMode()
         return kStreamingDloadError;
     }
 
+    state.openMultiMode = STREAMING_DLOAD_OPEN_MULTI_MODE_NONE;
+
     return kStreamingDloadSuccess;
 }
 
@@ -509,6 +525,8 @@ int StreamingDloadSerial::openMultiImage(uint8_t imageType)
         return kStreamingDloadError;
     }
 
+    state.openMultiMode = imageType;
+
     return kStreamingDloadSuccess;
 }
 
@@ -516,15 +534,15 @@ int StreamingDloadSerial::openMultiImage(uint8_t imageType)
 * @brief readAddress - Read x bytes from starting address
 *                      into a memory allocated array
 *
-* @param uint32_t address - The starting address
+* @param uint64_t address - The starting byte address
 * @param size_t length - The length to read from address
 * @param uint8_t** - The memory allocated array containing the read data until success or error encountered.
 * @param size_t& - The size of the memory allocated data
-* @param size_t stepSize - The amount to request per read operation. The max size is 1024.
+* @param size_t stepSize - The amount to request per read operation. Clamped to the session block size.
 *
 * @return int
 */
-int StreamingDloadSerial::readAddress(uint32_t address, size_t length, uint8_t** data, size_t& dataSize, size_t stepSize)
+int StreamingDloadSerial::readAddress(uint64_t address, size_t length, uint8_t** data, size_t& dataSize, size_t stepSize)
 {
     if (!isOpen()) {
         LOGE("Port Not Open\n");
@@ -532,37 +550,46 @@ int StreamingDloadSerial::readAddress(uint32_t address, size_t length, uint8_t**
     }
 
     size_t txSize, rxSize;
+    uint32_t deviceAddress;
 
     uint8_t* out = new uint8_t[length];
     size_t outSize = length;
 
-    uint8_t buffer[STREAMING_DLOAD_MAX_RX_SIZE];
+    std::vector<uint8_t> buffer(getMaxRxSize());
 
     dataSize = 0;
 
-    StreamingDloadReadRequest packet;
+    StreamingDloadReadRequest packet = {};
     packet.command = STREAMING_DLOAD_READ;
 
+    // framed once, each step only patches the address and length
+    HdlcFrameTemplate request(reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
+
     StreamingDloadReadResponse* readRx;
 
-    if (stepSize > state.hello.maxPreferredBlockSize) {
-        stepSize = state.hello.maxPreferredBlockSize;
-    }
+    stepSize = getStepSize(stepSize);
 
     do {
-        packet.address = address + dataSize;
-        packet.length = length <= stepSize ? length : stepSize;
+        if (!getDeviceAddress(address + dataSize, deviceAddress)) {
+            delete out;
+            return kStreamingDloadError;
+        }
+
+        packet.address = deviceAddress;
+        packet.length = length - dataSize <= stepSize ? length - dataSize : stepSize;
 
         LOGE("Requesting %lu bytes from %08X\n", packet.length, packet.address);
 
-        txSize = write((uint8_t*)&packet, sizeof(packet));
+        request.set(0, reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
+
+        txSize = write(request.getFrame(), request.getFrameSize(), false);
 
         if (!txSize) {
             LOGE("Wrote 0 bytes requesting to read %lu bytes from 0x%08X\n", packet.length, packet.address);
             return kStreamingDloadIOError;
         }
 
-        rxSize = read(buffer, STREAMING_DLOAD_MAX_RX_SIZE);
+        rxSize = read(&buffer[0], buffer.size());
 
         if (!rxSize) {
             LOGE("Device did not respond\n");
@@ -570,7 +597,7 @@ int StreamingDloadSerial::readAddress(uint32_t address, size_t length, uint8_t**
             return kStreamingDloadIOError;
         }
 
-        if (!isValidResponse(STREAMING_DLOAD_READ_DATA, buffer, rxSize)) {
+        if (!isValidResponse(STREAMING_DLOAD_READ_DATA, &buffer[0], rxSize)) {
             LOGE("Invalid Response\n");
             delete out;
             return kStreamingDloadError;
@@ -610,14 +637,14 @@ int StreamingDloadSerial::readAddress(uint32_t address, size_t length, uint8_t**
 * @brief readAddress - Read x bytes from starting address
 *                      into a std::vector<uint8_t> container
 *
-* @param uint32_t address - The starting address
+* @param uint64_t address - The starting byte address
 * @param size_t length - The length to read from address
 * @param std::vector<uint8_t> &out - The populated vector containing the read data until success or error encountered.
-* @param size_t stepSize - The amount to request per read operation. The max size is 1024.
+* @param size_t stepSize - The amount to request per read operation. Clamped to the session block size.
 *
 * @return int
 */
-int StreamingDloadSerial::readAddress(uint32_t address, size_t length, std::vector<uint8_t> &out, size_t stepSize)
+int StreamingDloadSerial::readAddress(uint64_t address, size_t length, std::vector<uint8_t> &out, size_t stepSize)
 {
     if (!isOpen()) {
         LOGE("Port Not Open\n");
@@ -628,7 +655,9 @@ int StreamingDloadSerial::readAddress(uint32_t address, size_t length, std::vect
 
     StreamingDloadReadRequest packet = {};
     packet.command = STREAMING_DLOAD_READ;
-    packet.address = address;
+    uint32_t deviceAddress;
+
+    HdlcFrameTemplate request(reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
 
     StreamingDloadReadResponse* readRx;
 
@@ -639,19 +668,25 @@ int StreamingDloadSerial::readAddress(uint32_t address, size_t length, std::vect
     out.reserve(length);
 
     std::vector<uint8_t> tmp;
-    tmp.reserve(packet.length + sizeof(packet));
+    size_t maxRxSize = getMaxRxSize();
 
-    if (stepSize > state.hello.maxPreferredBlockSize) {
-        stepSize = state.hello.maxPreferredBlockSize;
-    }
+    tmp.reserve(maxRxSize);
+
+    stepSize = getStepSize(stepSize);
 
     do {
-        packet.address = packet.address + out.size();       
-        packet.length = length <= stepSize ? length : stepSize;
+        if (!getDeviceAddress(address + out.size(), deviceAddress)) {
+            return kStreamingDloadError;
+        }
+
+        packet.address = deviceAddress;
+        packet.length = length - out.size() <= stepSize ? length - out.size() : stepSize;
         
         LOGE("Requesting %lu bytes from %08X\n", packet.length, packet.address);
 
-        txSize = write((uint8_t*)&packet, sizeof(packet));
+        request.set(0, reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
+
+        txSize = write(request.getFrame(), request.getFrameSize(), false);
         
         if (!txSize) {
             LOGE("Wrote 0 bytes requesting to read %lu bytes from 0x%08X\n", packet.length, packet.address);
@@ -661,7 +696,7 @@ int StreamingDloadSerial::readAddress(uint32_t address, size_t length, std::vect
         // read accounting for additional room for the data to be read
         // and the extra packet data in the header of the response
         // and possibly escaped content
-        rxSize = read(tmp, STREAMING_DLOAD_MAX_RX_SIZE);
+        rxSize = read(tmp, maxRxSize);
 
         if (!rxSize) {
             LOGE("Device did not respond to request to read %lu bytes from 0x%08X\n", packet.length, packet.address);
@@ -680,9 +715,9 @@ int StreamingDloadSerial::readAddress(uint32_t address, size_t length, std::vect
             return kStreamingDloadError;
         }
 
-        // remove the command code, address, and length to only
+        // remove the command code and address to only
         // keep the real data
-        tmp.erase(tmp.end() - rxSize, (tmp.end() - rxSize) + sizeof(packet));
+        tmp.erase(tmp.end() - rxSize, (tmp.end() - rxSize) + sizeof(readRx->command) + sizeof(readRx->address));
 
         out.reserve(out.size() + tmp.size());
         std::copy(tmp.begin(), tmp.end(), std::back_inserter(out));
@@ -705,15 +740,15 @@ int StreamingDloadSerial::readAddress(uint32_t address, size_t length, std::vect
 * @brief readAddress - Read x bytes from starting address
 *                      into a file pointer
 *
-* @param uint32_t address - The starting address
+* @param uint64_t address - The starting byte address
 * @param size_t length - The length to read from address
 * @param FILE* out - The file pointer to write the data to
 * @param size_t& outSize - The amount of bytes written to the file until success or error encountered.
-* @param size_t stepSize - The amount to request per read operation. The max size is 1024.
+* @param size_t stepSize - The amount to request per read operation. Clamped to the session block size.
 *
 * @return int
 */
-int StreamingDloadSerial::readAddress(uint32_t address, size_t length, std::ofstream& out, size_t &outSize, size_t stepSize)
+int StreamingDloadSerial::readAddress(uint64_t address, size_t length, std::ofstream& out, size_t &outSize, size_t stepSize)
 {
     if (!isOpen() || !out.is_open()) {
         LOGE("Port Not Open\n");
@@ -724,42 +759,48 @@ int StreamingDloadSerial::readAddress(uint32_t address, size_t length, std::ofst
 
     StreamingDloadReadRequest packet = {};
     packet.command = STREAMING_DLOAD_READ;
-    packet.address = address;
+    uint32_t deviceAddress;
+
+    HdlcFrameTemplate request(reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
 
     outSize = 0;
 
-    uint8_t tmp[STREAMING_DLOAD_MAX_RX_SIZE];
+    std::vector<uint8_t> tmp(getMaxRxSize());
 
-    if (stepSize > state.hello.maxPreferredBlockSize) {
-        stepSize = state.hello.maxPreferredBlockSize;
-    }
+    stepSize = getStepSize(stepSize);
 
     do {
-        packet.address = packet.address + outSize;
-        packet.length = length <= stepSize ? length : stepSize;
+        if (!getDeviceAddress(address + outSize, deviceAddress)) {
+            return kStreamingDloadError;
+        }
+
+        packet.address = deviceAddress;
+        packet.length = length - outSize <= stepSize ? length - outSize : stepSize;
 
         LOGE("Requesting %lu bytes from %08X\n", packet.length, packet.address);
 
-        txSize = write((uint8_t*)&packet, sizeof(packet));
+        request.set(0, reinterpret_cast<uint8_t*>(&packet), sizeof(packet));
+
+        txSize = write(request.getFrame(), request.getFrameSize(), false);
 
         if (!txSize) {
             LOGE("Wrote 0 bytes requesting to read %lu bytes from 0x%08X\n", packet.length, packet.address);
             return kStreamingDloadIOError;
         }
 
-        rxSize = read(tmp, STREAMING_DLOAD_MAX_RX_SIZE);
+        rxSize = read(&tmp[0], tmp.size());
 
         if (!rxSize) {
             LOGE("Device did not respond to request to read %lu bytes from 0x%08X\n", packet.length, packet.address);
             return kStreamingDloadIOError;
         }
 
-        if (!isValidResponse(STREAMING_DLOAD_READ_DATA, tmp, rxSize)) {
+        if (!isValidResponse(STREAMING_DLOAD_READ_DATA, &tmp[0], rxSize)) {
             LOGE("Invalid response in request to read %lu bytes from 0x%08X. Data read so far is %lu bytes.\n", packet.length, packet.address, outSize);
             return kStreamingDloadError;
         }
 
-        StreamingDloadReadResponse* resp = (StreamingDloadReadResponse*)&tmp;
+        StreamingDloadReadResponse* resp = (StreamingDloadReadResponse*)&tmp[0];
     
         if (resp->address != packet.address) {
             LOGE("Packet address and response address differ\n");
@@ -862,62 +903,48 @@ int StreamingDloadSerial::writePartitionTable(std::string fileName, uint8_t& out
     
 }
 
-int StreamingDloadSerial::streamWrite(uint32_t address, uint8_t* data, size_t dataSize, bool unframed)
+/**
+* @brief streamWrite - Stream write data starting at specified address. Writes hdlc encoded chunks
+*                   of max block size specified by device
+*
+* @param uint64_t address - The starting byte address to write to
+* @param uint8_t data - A pointer to the data to be written
+* @param size_t dataSize - The amount of data to write.
+* @param bool unframed - Write in unframed (non hdlc encoded) packets
+*
+* @return int
+*/
+int StreamingDloadSerial::streamWrite(uint64_t address, uint8_t* data, size_t dataSize, bool unframed)
 {
-    uint8_t packetBuffer[STREAMING_DLOAD_MAX_TX_SIZE] = {};
-    uint8_t responseBuffer[STREAMING_DLOAD_MAX_RX_SIZE] = {};
-
-    StreamingDloadStreamWriteRequest* packet = (StreamingDloadStreamWriteRequest*)packetBuffer;
-
-    if (dataSize > state.hello.maxPreferredBlockSize) {
-
-        size_t bytesWritten = 0;
-        size_t dataSegmentSize = state.hello.maxPreferredBlockSize;
-        
-
-        do {
-            packet->command = unframed ? STREAMING_DLOAD_UNFRAMED_STREAM_WRITE : STREAMING_DLOAD_STREAM_WRITE;
-            packet->address = address + bytesWritten;
-
-            if (dataSegmentSize > (dataSize - bytesWritten)) {
-                dataSegmentSize = dataSize - bytesWritten;
-            }
-
-            memcpy(packet->data, &data[bytesWritten], dataSegmentSize);
-
-            size_t txSize = write((uint8_t*)packet, sizeof(packet->command) + sizeof(packet->address) + dataSize, unframed);
-
-            if (!txSize) {
-                LOGE("Wrote 0 bytes\n");
-                return kStreamingDloadIOError;
-            }
+    if (!isOpen()) {
+        LOGE("Port Not Open\n");
+        return kStreamingDloadIOError;
+    }
 
-            size_t rxSize = read(responseBuffer, STREAMING_DLOAD_MAX_RX_SIZE, unframed);
+    size_t segmentSize = getStepSize(state.hello.maxPreferredBlockSize);
+    size_t headerSize = sizeof(StreamingDloadStreamWriteRequest);
+    size_t bytesWritten = 0;
+    uint32_t deviceAddress;
 
-            if (!rxSize) {
-                LOGE("Device did not respond\n");
-                return kStreamingDloadIOError;
-            }
+    std::vector<uint8_t> packetBuffer(headerSize + (dataSize < segmentSize ? dataSize : segmentSize));
+    uint8_t responseBuffer[STREAMING_DLOAD_MAX_RX_SIZE] = {};
 
-            StreamingDloadStreamWriteResponse* response = (StreamingDloadStreamWriteResponse*) responseBuffer;
+    StreamingDloadStreamWriteRequest* packet = (StreamingDloadStreamWriteRequest*)&packetBuffer[0];
 
-            if (response->address != packet->address) {
-                LOGE("Response address %04X differs from requeasted write address %04X\n", response->address, packet->address);
-                return kStreamingDloadError;
-            }
+    packet->command = unframed ? STREAMING_DLOAD_UNFRAMED_STREAM_WRITE : STREAMING_DLOAD_STREAM_WRITE;
 
-            bytesWritten += dataSegmentSize;
+    do {
+        size_t size = dataSize - bytesWritten < segmentSize ? dataSize - bytesWritten : segmentSize;
 
-        } while (bytesWritten < dataSize);
+        if (!getDeviceAddress(address + bytesWritten, deviceAddress)) {
+            return kStreamingDloadError;
+        }
 
-    } else {
-        packet->command = unframed ? STREAMING_DLOAD_UNFRAMED_STREAM_WRITE : STREAMING_DLOAD_STREAM_WRITE;;
-        packet->address = address;
-        memcpy(packet->data, data, dataSize);
+        packet->address = deviceAddress;
 
-        size_t bytesWritten = write((uint8_t*)packet, sizeof(packet->command) + sizeof(packet->address) + dataSize, (!unframed));
+        memcpy(packet->data, &data[bytesWritten], size);
 
-        if (!bytesWritten) {
+        if (!write(&packetBuffer[0], headerSize + size, (!unframed))) {
             LOGE("Wrote 0 bytes\n");
             return kStreamingDloadIOError;
         }
@@ -940,11 +967,157 @@ int StreamingDloadSerial::streamWrite(uint32_t address, uint8_t* data, size_t da
             return kStreamingDloadError;
         }
 
+        bytesWritten += size;
+
+    } while (bytesWritten < dataSize);
+
+    return kStreamingDloadSuccess;
+}
+
+/**
+* @brief getDeviceAddress - Translate a byte address to the address sent to the device,
+*                           a sector number when sector addressing is negotiated
+*
+* @param uint64_t address - Byte address
+* @param uint32_t& deviceAddress
+*
+* @return bool - false if the address is unaligned or out of range
+*/
+bool StreamingDloadSerial::getDeviceAddress(uint64_t address, uint32_t& deviceAddress)
+{
+    if (state.sectorAddresses) {
+        if (address % STREAMING_DLOAD_SECTOR_SIZE) {
+            LOGE("Address 0x%llX is not aligned to a %d byte sector\n", (unsigned long long)address, STREAMING_DLOAD_SECTOR_SIZE);
+            return false;
+        }
+
+        address /= STREAMING_DLOAD_SECTOR_SIZE;
     }
 
+    if (address > 0xFFFFFFFF) {
+        LOGE("Address 0x%llX is out of range%s\n", (unsigned long long)address, state.sectorAddresses ? "" : ", enable sector addresses in hello");
+        return false;
+    }
+
+    deviceAddress = (uint32_t)address;
+
+    return true;
+}
+
+/**
+* @brief getStepSize - Clamp a transfer step size to the session block size,
+*                      keeping it a sector multiple with sector addressing
+*
+* @param size_t stepSize
+*
+* @return size_t
+*/
+size_t StreamingDloadSerial::getStepSize(size_t stepSize)
+{
+    if (stepSize > state.blockSize) {
+        stepSize = state.blockSize;
+    }
+
+    if (stepSize > state.hello.maxPreferredBlockSize) {
+        stepSize = state.hello.maxPreferredBlockSize;
+    }
+
+    if (state.sectorAddresses) {
+        stepSize -= stepSize % STREAMING_DLOAD_SECTOR_SIZE;
+
+        if (!stepSize) {
+            stepSize = STREAMING_DLOAD_SECTOR_SIZE;
+        }
+    }
+
+    return stepSize;
+}
+
+/**
+* @brief calibrateBlockSize - Time reads of sampleSize bytes at a few block sizes,
+*                             from the device maximum down, and use the fastest
+*                             for the rest of the session
+*
+* @param uint64_t address - The byte address to read from
+* @param std::vector<StreamingDloadCalibrationSample>& samples - One per block size tried
+* @param size_t sampleSize
+*
+* @return int
+*/
+int StreamingDloadSerial::calibrateBlockSize(uint64_t address, std::vector<StreamingDloadCalibrationSample>& samples, size_t sampleSize)
+{
+    if (!isOpen()) {
+        LOGE("Port Not Open\n");
+        return kStreamingDloadIOError;
+    }
+
+    std::vector<uint8_t> buffer;
+    size_t blockSize = state.hello.maxPreferredBlockSize;
+    size_t best = 0;
+
+    // a device preferring less than the minimum still gets its own size measured
+    size_t minimum = blockSize < STREAMING_DLOAD_CALIBRATION_MIN_BLOCK ? blockSize : STREAMING_DLOAD_CALIBRATION_MIN_BLOCK;
+
+    samples.clear();
+
+    // candidates are only clamped by the device maximum while measuring
+    state.blockSize = state.hello.maxPreferredBlockSize;
+
+    for (int i = 0; i < STREAMING_DLOAD_CALIBRATION_STEPS && blockSize >= minimum; i++, blockSize /= 2) {
+        StreamingDloadCalibrationSample sample = {};
+
+        sample.blockSize = getStepSize(blockSize);
+
+        auto start = std::chrono::steady_clock::now();
+
+        int result = readAddress(address, sampleSize, buffer, sample.blockSize);
+
+        if (result != kStreamingDloadSuccess) {
+            LOGE("Calibration read of %lu bytes with %lu byte blocks failed\n", sampleSize, sample.blockSize);
+
+            // a failure past the first candidate still leaves a usable measurement
+            if (!samples.size()) {
+                return result;
+            }
+
+            break;
+        }
+
+        sample.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        sample.rate = sample.elapsed > 0 ? (buffer.size() * 1000000.0) / sample.elapsed : 0;
+
+        LOGD("Calibration: %lu byte blocks read %lu bytes in %lld us\n", sample.blockSize, buffer.size(), sample.elapsed);
+
+        samples.push_back(sample);
+
+        if (samples[best].rate < sample.rate) {
+            best = samples.size() - 1;
+        }
+    }
+
+    if (!samples.size()) {
+        LOGE("Calibration took no samples\n");
+        return kStreamingDloadError;
+    }
+
+    state.blockSize = samples[best].blockSize;
+
     return kStreamingDloadSuccess;
 }
 
+/**
+* @brief getMaxRxSize - Largest response to expect for a block of the device maximum size,
+*                       allowing for every byte to be escaped
+*
+* @return size_t
+*/
+size_t StreamingDloadSerial::getMaxRxSize()
+{
+    size_t size = (sizeof(StreamingDloadReadResponse) + state.hello.maxPreferredBlockSize) * 2 + HDLC_OVERHEAD_LENGTH;
+
+    return size > STREAMING_DLOAD_MAX_RX_SIZE ? size : STREAMING_DLOAD_MAX_RX_SIZE;
+}
+
 /**
 * @brief readQfprom - Havent found a device or mode to use this in
 */
@@ -1021,6 +1194,35 @@ bool StreamingDloadSerial::isValidResponse(uint8_t expectedCommand, std::vector<
     return isValidResponse(expectedCommand, &data[0], data.size());
 }
 
+/**
+* @brief getDeviceId - Identify the device from its hello response, for keying
+*                      journals and other state to it
+*
+* Hello carries no serial number, so this is the flash identifier and the
+* base flash address. It tells apart different devices, not two units of the
+* same device, which still need journals of their own.
+*
+* @return std::string - Hex, without whitespace. Empty before sendHello
+*/
+std::string StreamingDloadSerial::getDeviceId()
+{
+    std::string id;
+    char hex[9];
+
+    if (!state.hello.command) {
+        return id;
+    }
+
+    for (int i = 0; i < state.hello.flashIdLength && i < STREAMING_DLOAD_FLASH_ID_MAX_SIZE; i++) {
+        snprintf(hex, sizeof(hex), "%02x", state.hello.flashIdenfier[i]);
+        id.append(hex);
+    }
+
+    snprintf(hex, sizeof(hex), "%08x", state.hello.baseFlashAddress);
+
+    return id.append("-").append(hex);
+}
+
 /**
 * @brief getNamedError - Get a named error from an error code
 *
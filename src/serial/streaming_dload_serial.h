@@ -14,6 +14,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <chrono>
 #include "include/definitions.h"
 #include "serial/serial.h"
 #include "serial/hdlc_serial.h"
@@ -21,16 +22,34 @@
 #include "util/endian.h"
 #include "qc/streaming_dload.h"
 #include "qc/hdlc.h"
+#include "qc/hdlc_frame_template.h"
+
+/**
+* Amount read at each candidate block size when calibrating, and the
+* number of candidates tried, halving down from the device maximum to no
+* less than the minimum
+*/
+#define STREAMING_DLOAD_CALIBRATION_SAMPLE_SIZE (128 * 1024)
+#define STREAMING_DLOAD_CALIBRATION_STEPS       4
+#define STREAMING_DLOAD_CALIBRATION_MIN_BLOCK   STREAMING_DLOAD_SECTOR_SIZE
 
 namespace OpenPST {
 
     struct StreamingDloadDeviceState {
         uint8_t openMode;
         uint8_t openMultiMode;
+        bool    sectorAddresses;
+        size_t  blockSize;      // transfer block size, maxPreferredBlockSize unless calibrated
         StreamingDloadHelloResponse hello;
         StreamingDloadErrorResponse lastError;
         StreamingDloadLogResponse   lastLog;
     }; 
+
+    struct StreamingDloadCalibrationSample {
+        size_t  blockSize;
+        int64_t elapsed;        // us
+        double  rate;           // bytes per second
+    };
     
     enum StreamingDloadOperationResult {
         kStreamingDloadIOError = -1,
@@ -63,6 +82,12 @@ namespace OpenPST {
             /**
             * @brief sendHello - sends the initial handshake for the session
             *
+            * With STREAMING_DLOAD_FEATURE_BIT_SECTOR_ADDRESSES requested and echoed back in
+            * the device feature bits, read and write requests
+            * carry sector numbers and byte addresses up to 2TB can be reached. Addresses
+            * passed to readAddress and streamWrite are always in bytes and must then be
+            * sector aligned.
+            *
             * @param std::string magic - The magic handhsake word. Should be QCOM FAST DOWNLOAD HOST
             * @param uint8_t version - The max version to be compatible with
             * @param uint8_t compatibleVersion - The lowest version to be compatible with
@@ -159,42 +184,42 @@ namespace OpenPST {
             * @brief readAddress - Read x bytes from starting address 
             *                      into a memory allocated array
             *
-            * @param uint32_t address - The starting address
+            * @param uint64_t address - The starting byte address
             * @param size_t length - The length to read from address
             * @param uint8_t** - The memory allocated array containing the read data until success or error encountered.
             * @param size_t& - The size of the memory allocated data
-            * @param size_t chunkSize - The amount to request per read operation. The max size is 1024.
+            * @param size_t chunkSize - The amount to request per read operation. Clamped to the session block size.
             *
             * @return int
             */
-            int readAddress(uint32_t address, size_t length, uint8_t** out, size_t& outSize, size_t chunkSize);
+            int readAddress(uint64_t address, size_t length, uint8_t** out, size_t& outSize, size_t chunkSize);
 
             /**
             * @brief readAddress - Read x bytes from starting address
             *                      into a std::vector<uint8_t> container
             *
-            * @param uint32_t address - The starting address
+            * @param uint64_t address - The starting byte address
             * @param size_t length - The length to read from address
             * @param std::vector<uint8_t> &out - The populated vector containing the read data until success or error encountered.
-            * @param size_t stepSize - The amount to request per read operation. The max size is 1024.
+            * @param size_t stepSize - The amount to request per read operation. Clamped to the session block size.
             *
             * @return int
             */
-            int readAddress(uint32_t address, size_t length, std::vector<uint8_t> &out, size_t stepSize);
+            int readAddress(uint64_t address, size_t length, std::vector<uint8_t> &out, size_t stepSize);
             
             /**
             * @brief readAddress - Read x bytes from starting address
             *                      into a file pointer
             *
-            * @param uint32_t address - The starting address
+            * @param uint64_t address - The starting byte address
             * @param size_t length - The length to read from address
             * @param FILE* out - The file pointer to write the data to
             * @param size_t& outSize - The amount of bytes written to the file until success or error encountered.
-            * @param size_t stepSize - The amount to request per read operation. The max size is 1024.
+            * @param size_t stepSize - The amount to request per read operation. Clamped to the session block size.
             *
             * @return int
             */
-            int readAddress(uint32_t address, size_t length, std::ofstream& out, size_t &outSize, size_t stepSize);
+            int readAddress(uint64_t address, size_t length, std::ofstream& out, size_t &outSize, size_t stepSize);
             
             /**
             * @brief writePartitionTable - Writes partition table for sessions that require it.
@@ -214,20 +239,53 @@ namespace OpenPST {
             * @brief streamWrite - Stream write data starting at specified address. Writes hdlc encoded chunks
             *                   of max block size specified by device
             *
-            * @param uint32_t address - The starting address to write to
+            * @param uint64_t address - The starting byte address to write to
             * @param uint8_t data - A pointer to the data to be written
             * @param size_t dataSize - The amount of data to write.
             * @param bool unframed - Write in unframed (non hdlc encoded) packets
             *
             * @return int
             */
-            int streamWrite(uint32_t address, uint8_t* data, size_t dataSize, bool unframed = false);
+            int streamWrite(uint64_t address, uint8_t* data, size_t dataSize, bool unframed = false);
             
+            /**
+            * @brief getStepSize - Clamp a transfer step size to the session block size,
+            *                      keeping it a sector multiple with sector addressing
+            *
+            * @param size_t stepSize
+            *
+            * @return size_t
+            */
+            size_t getStepSize(size_t stepSize);
+
+            /**
+            * @brief calibrateBlockSize - Time reads of sampleSize bytes at a few block sizes,
+            *                             from the device maximum down, and use the fastest
+            *                             for the rest of the session
+            *
+            * Reads are used so calibration never changes the flash contents. Call after
+            * sendHello, in a mode that can read address.
+            *
+            * @param uint64_t address - The byte address to read from
+            * @param std::vector<StreamingDloadCalibrationSample>& samples - One per block size tried
+            * @param size_t sampleSize
+            *
+            * @return int
+            */
+            int calibrateBlockSize(uint64_t address, std::vector<StreamingDloadCalibrationSample>& samples, size_t sampleSize = STREAMING_DLOAD_CALIBRATION_SAMPLE_SIZE);
+
             /**
             * @brief readQfprom - Havent found a device or mode to use this in
             */
             int readQfprom(uint32_t rowAddress, uint32_t addressType);
 
+            /**
+            * @brief getDeviceId - Identify the device from its hello response
+            *
+            * @return std::string - Hex, without whitespace. Empty before sendHello
+            */
+            std::string getDeviceId();
+
             /**
             * @brief getNamedError - Get a named error from an error code
             * 
@@ -256,6 +314,25 @@ namespace OpenPST {
             const char* getNamedMultiImage(uint8_t imageType);
 
     private:
+        /**
+        * @brief getMaxRxSize - Largest response to expect for a block of the device maximum size,
+        *                       allowing for every byte to be escaped
+        *
+        * @return size_t
+        */
+        size_t getMaxRxSize();
+
+        /**
+        * @brief getDeviceAddress - Translate a byte address to the address sent to the device,
+        *                           a sector number when sector addressing is negotiated
+        *
+        * @param uint64_t address - Byte address
+        * @param uint32_t& deviceAddress
+        *
+        * @return bool - false if the address is unaligned or out of range
+        */
+        bool getDeviceAddress(uint64_t address, uint32_t& deviceAddress);
+
         /**
         * @brief isValidResponse
         *
@@ -0,0 +1,261 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file block_manifest.cpp
+* @class BlockManifest
+* @package OpenPST
+* @brief Per block hash manifest of an image, used to find which blocks differ
+*        between what is on a device and what is about to be written
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "block_manifest.h"
+
+using namespace OpenPST;
+
+/**
+* @brief BlockManifest - Constructor
+*/
+BlockManifest::BlockManifest() :
+    blockSize(BLOCK_MANIFEST_DEFAULT_BLOCK_SIZE),
+    imageSize(0)
+{
+
+}
+
+/**
+* @brief ~BlockManifest - Deconstructor
+*/
+BlockManifest::~BlockManifest()
+{
+
+}
+
+/**
+* @brief generate - Hash an image file block by block
+*
+* @param std::string filePath - The image to hash
+* @param uint32_t blockSize
+* @param unsigned int threads - 0 to use all available cores
+*
+* @return bool
+*/
+bool BlockManifest::generate(std::string filePath, uint32_t blockSize, unsigned int threads)
+{
+    std::ifstream file(filePath.c_str(), std::ios::in | std::ios::binary);
+
+    if (!file.is_open() || !blockSize) {
+        LOGE("Could not open %s\n", filePath.c_str());
+        return false;
+    }
+
+    file.seekg(0, file.end);
+
+    this->blockSize = blockSize;
+    imageSize = file.tellg();
+
+    file.close();
+
+    uint32_t blockCount = (uint32_t)((imageSize + blockSize - 1) / blockSize);
+
+    hashes.assign(blockCount, 0);
+
+    if (!blockCount) {
+        return true;
+    }
+
+    if (!threads) {
+        threads = std::thread::hardware_concurrency();
+    }
+
+    if (!threads) {
+        threads = 1;
+    }
+
+    if (threads > blockCount) {
+        threads = blockCount;
+    }
+
+    std::vector<std::thread> workers;
+    std::vector<char> results(threads, 0);
+    uint32_t perThread = (blockCount + threads - 1) / threads;
+
+    for (unsigned int i = 0; i < threads; i++) {
+        uint32_t first = i * perThread;
+        uint32_t last = first + perThread < blockCount ? first + perThread : blockCount;
+
+        workers.push_back(std::thread([this, filePath, first, last, i, &results]() {
+            results[i] = hashRange(filePath, first, last);
+        }));
+    }
+
+    bool success = true;
+
+    for (unsigned int i = 0; i < threads; i++) {
+        workers[i].join();
+        success = success && results[i];
+    }
+
+    return success;
+}
+
+/**
+* @brief hashRange - Hash blocks [first, last) of filePath into hashes
+*
+* Each thread owns its own stream and a disjoint slice of hashes, so no
+* locking is needed.
+*/
+bool BlockManifest::hashRange(std::string filePath, uint32_t first, uint32_t last)
+{
+    std::ifstream file(filePath.c_str(), std::ios::in | std::ios::binary);
+
+    if (!file.is_open()) {
+        return false;
+    }
+
+    const uint32_t batch = 16;
+    std::vector<uint8_t> buffer((size_t)blockSize * batch);
+
+    file.seekg((uint64_t)first * blockSize, file.beg);
+
+    for (uint32_t block = first; block < last; block += batch) {
+        uint32_t count = last - block < batch ? last - block : batch;
+        uint64_t offset = (uint64_t)block * blockSize;
+        uint64_t want = (uint64_t)count * blockSize;
+
+        if (offset + want > imageSize) {
+            want = imageSize - offset;
+        }
+
+        file.read((char*)&buffer[0], want);
+
+        if ((uint64_t)file.gcount() != want) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < count; i++) {
+            uint64_t start = (uint64_t)i * blockSize;
+            uint64_t size = want - start < blockSize ? want - start : blockSize;
+
+            hashes[block + i] = xxhash64(&buffer[start], size);
+        }
+    }
+
+    return true;
+}
+
+/**
+* @brief load - Load a manifest written by save
+*
+* @param std::string filePath
+*
+* @return bool
+*/
+bool BlockManifest::load(std::string filePath)
+{
+    std::ifstream file(filePath.c_str(), std::ios::in | std::ios::binary);
+    BlockManifestHeader header = {};
+
+    if (!file.is_open()) {
+        LOGE("Could not open %s\n", filePath.c_str());
+        return false;
+    }
+
+    file.read((char*)&header, sizeof(header));
+
+    if (file.gcount() != sizeof(header) || header.magic != BLOCK_MANIFEST_MAGIC || header.version != BLOCK_MANIFEST_VERSION) {
+        LOGE("%s is not a block manifest\n", filePath.c_str());
+        return false;
+    }
+
+    blockSize = header.blockSize;
+    imageSize = header.imageSize;
+    hashes.resize(header.blockCount);
+
+    if (header.blockCount) {
+        file.read((char*)&hashes[0], header.blockCount * sizeof(uint64_t));
+
+        if ((size_t)file.gcount() != header.blockCount * sizeof(uint64_t)) {
+            LOGE("%s is truncated\n", filePath.c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+* @brief save - Save the manifest
+*
+* @param std::string filePath
+*
+* @return bool
+*/
+bool BlockManifest::save(std::string filePath)
+{
+    std::ofstream file(filePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    BlockManifestHeader header = {};
+
+    if (!file.is_open()) {
+        LOGE("Could not open %s for writing\n", filePath.c_str());
+        return false;
+    }
+
+    header.magic = BLOCK_MANIFEST_MAGIC;
+    header.version = BLOCK_MANIFEST_VERSION;
+    header.blockSize = blockSize;
+    header.blockCount = hashes.size();
+    header.imageSize = imageSize;
+
+    file.write((char*)&header, sizeof(header));
+
+    if (hashes.size()) {
+        file.write((char*)&hashes[0], hashes.size() * sizeof(uint64_t));
+    }
+
+    return file.good();
+}
+
+/**
+* @brief diff - Find the blocks of this manifest that differ from base,
+*               coalesced into contiguous runs
+*
+* A block is considered changed if base does not cover it or its hash differs.
+* Block hashes include the block length, so a short last block never matches a
+* full one. If the block sizes of the manifests differ everything is written.
+*
+* @param BlockManifest& base - The manifest of what is currently on the device
+* @param std::vector<BlockManifestRun>& runs - Byte ranges of this image to write
+*
+* @return uint64_t - Total bytes covered by runs
+*/
+uint64_t BlockManifest::diff(BlockManifest& base, std::vector<BlockManifestRun>& runs)
+{
+    uint64_t total = 0;
+    bool comparable = base.blockSize == blockSize;
+
+    runs.clear();
+
+    for (uint32_t i = 0; i < hashes.size(); i++) {
+        bool changed = !comparable || i >= base.hashes.size() || base.hashes[i] != hashes[i];
+
+        if (!changed) {
+            continue;
+        }
+
+        uint64_t offset = (uint64_t)i * blockSize;
+        uint64_t size = imageSize - offset < blockSize ? imageSize - offset : blockSize;
+
+        if (runs.size() && runs.back().offset + runs.back().size == offset) {
+            runs.back().size += size;
+        } else {
+            BlockManifestRun run = { offset, size };
+            runs.push_back(run);
+        }
+
+        total += size;
+    }
+
+    return total;
+}
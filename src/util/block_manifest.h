@@ -0,0 +1,108 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file block_manifest.h
+* @class BlockManifest
+* @package OpenPST
+* @brief Per block hash manifest of an image, used to find which blocks differ
+*        between what is on a device and what is about to be written
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _UTIL_BLOCK_MANIFEST_H
+#define _UTIL_BLOCK_MANIFEST_H
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include "include/definitions.h"
+#include "util/xxhash.h"
+
+#define BLOCK_MANIFEST_MAGIC                0x314D4842 // BHM1
+#define BLOCK_MANIFEST_VERSION              1
+#define BLOCK_MANIFEST_DEFAULT_BLOCK_SIZE   (64 * 1024)
+
+namespace OpenPST {
+
+    PACKED(typedef struct {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t blockSize;
+        uint32_t blockCount;
+        uint64_t imageSize;
+    }) BlockManifestHeader;
+
+    struct BlockManifestRun {
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    class BlockManifest {
+        public:
+            uint32_t blockSize;
+            uint64_t imageSize;
+            std::vector<uint64_t> hashes;
+
+            /**
+            * @brief BlockManifest
+            */
+            BlockManifest();
+
+            /**
+            * @brief ~BlockManifest
+            */
+            ~BlockManifest();
+
+            /**
+            * @brief generate - Hash an image file block by block. The file is split in
+            *                   contiguous ranges, one per thread, each read independently.
+            *
+            * @param std::string filePath - The image to hash
+            * @param uint32_t blockSize
+            * @param unsigned int threads - 0 to use all available cores
+            *
+            * @return bool
+            */
+            bool generate(std::string filePath, uint32_t blockSize = BLOCK_MANIFEST_DEFAULT_BLOCK_SIZE, unsigned int threads = 0);
+
+            /**
+            * @brief load - Load a manifest written by save
+            *
+            * @param std::string filePath
+            *
+            * @return bool
+            */
+            bool load(std::string filePath);
+
+            /**
+            * @brief save - Save the manifest
+            *
+            * @param std::string filePath
+            *
+            * @return bool
+            */
+            bool save(std::string filePath);
+
+            /**
+            * @brief diff - Find the blocks of this manifest that differ from base,
+            *               coalesced into contiguous runs
+            *
+            * @param BlockManifest& base - The manifest of what is currently on the device
+            * @param std::vector<BlockManifestRun>& runs - Byte ranges of this image to write
+            *
+            * @return uint64_t - Total bytes covered by runs
+            */
+            uint64_t diff(BlockManifest& base, std::vector<BlockManifestRun>& runs);
+
+        private:
+            /**
+            * @brief hashRange - Hash blocks [first, last) of filePath into hashes
+            */
+            bool hashRange(std::string filePath, uint32_t first, uint32_t last);
+    };
+}
+
+#endif // _UTIL_BLOCK_MANIFEST_H
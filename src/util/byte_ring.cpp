@@ -0,0 +1,147 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file byte_ring.cpp
+* @class ByteRing
+* @package OpenPST
+* @brief Lock free single producer, single consumer byte ring
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "byte_ring.h"
+
+using namespace OpenPST;
+
+/**
+* @brief ByteRing
+*
+* @param size_t capacity
+*/
+ByteRing::ByteRing(size_t capacity) :
+    head(0),
+    tail(0)
+{
+    size_t size = 1;
+
+    while (size < capacity) {
+        size <<= 1;
+    }
+
+    buffer.resize(size);
+
+    mask = size - 1;
+}
+
+/**
+* @brief ~ByteRing
+*/
+ByteRing::~ByteRing()
+{
+
+}
+
+/**
+* @brief write - Producer side, append bytes if all of them fit
+*
+* @param uint8_t* data
+* @param size_t size
+* @return bool
+*/
+bool ByteRing::write(const uint8_t* data, size_t size)
+{
+    return write(data, size, nullptr, 0);
+}
+
+/**
+* @brief write - Producer side, append two buffers together if both fit
+*
+* @param uint8_t* header
+* @param size_t headerSize
+* @param uint8_t* data
+* @param size_t size
+* @return bool
+*/
+bool ByteRing::write(const uint8_t* header, size_t headerSize, const uint8_t* data, size_t size)
+{
+    size_t position = head.load(std::memory_order_relaxed);
+
+    if (buffer.size() - (position - tail.load(std::memory_order_acquire)) < headerSize + size) {
+        return false;
+    }
+
+    copyIn(position, header, headerSize);
+    copyIn(position + headerSize, data, size);
+
+    // publish only once every byte is in place
+    head.store(position + headerSize + size, std::memory_order_release);
+
+    return true;
+}
+
+/**
+* @brief read - Consumer side, take up to size bytes
+*
+* @param uint8_t* data
+* @param size_t size
+* @return size_t
+*/
+size_t ByteRing::read(uint8_t* data, size_t size)
+{
+    size_t position = tail.load(std::memory_order_relaxed);
+    size_t used = head.load(std::memory_order_acquire) - position;
+
+    if (size > used) {
+        size = used;
+    }
+
+    if (!size) {
+        return 0;
+    }
+
+    size_t offset = position & mask;
+    size_t first = buffer.size() - offset < size ? buffer.size() - offset : size;
+
+    std::memcpy(data, &buffer[offset], first);
+    std::memcpy(data + first, &buffer[0], size - first);
+
+    tail.store(position + size, std::memory_order_release);
+
+    return size;
+}
+
+/**
+* @brief getCapacity
+*
+* @return size_t
+*/
+size_t ByteRing::getCapacity()
+{
+    return buffer.size();
+}
+
+/**
+* @brief getUsed
+*
+* @return size_t
+*/
+size_t ByteRing::getUsed()
+{
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+}
+
+/**
+* @brief copyIn - Copy into the ring at a position, wrapping around the end
+*/
+void ByteRing::copyIn(size_t position, const uint8_t* data, size_t size)
+{
+    if (!size) {
+        return;
+    }
+
+    size_t offset = position & mask;
+    size_t first = buffer.size() - offset < size ? buffer.size() - offset : size;
+
+    std::memcpy(&buffer[offset], data, first);
+    std::memcpy(&buffer[0], data + first, size - first);
+}
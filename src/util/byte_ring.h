@@ -0,0 +1,96 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file byte_ring.h
+* @class ByteRing
+* @package OpenPST
+* @brief Lock free single producer, single consumer byte ring
+*
+* One thread may write and one other thread may read at the same time without
+* locking. Writes are all or nothing so a record written in one call is never
+* seen half written by the reader.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _UTIL_BYTE_RING_H
+#define _UTIL_BYTE_RING_H
+
+#include <vector>
+#include <atomic>
+#include <cstring>
+#include "include/definitions.h"
+
+namespace OpenPST {
+
+    class ByteRing {
+        public:
+            /**
+            * @brief ByteRing
+            *
+            * @param size_t capacity - Rounded up to a power of two
+            */
+            ByteRing(size_t capacity);
+
+            /**
+            * @brief ~ByteRing
+            */
+            ~ByteRing();
+
+            /**
+            * @brief write - Producer side, append bytes if all of them fit
+            *
+            * @param uint8_t* data
+            * @param size_t size
+            * @return bool - false when there is not enough room, nothing is written
+            */
+            bool write(const uint8_t* data, size_t size);
+
+            /**
+            * @brief write - Producer side, append two buffers together if both fit
+            *
+            * @param uint8_t* header
+            * @param size_t headerSize
+            * @param uint8_t* data
+            * @param size_t size
+            * @return bool - false when there is not enough room, nothing is written
+            */
+            bool write(const uint8_t* header, size_t headerSize, const uint8_t* data, size_t size);
+
+            /**
+            * @brief read - Consumer side, take up to size bytes
+            *
+            * @param uint8_t* data
+            * @param size_t size
+            * @return size_t - Bytes read, 0 when empty
+            */
+            size_t read(uint8_t* data, size_t size);
+
+            /**
+            * @brief getCapacity
+            *
+            * @return size_t
+            */
+            size_t getCapacity();
+
+            /**
+            * @brief getUsed - Bytes waiting to be read, a snapshot
+            *
+            * @return size_t
+            */
+            size_t getUsed();
+
+        private:
+            std::vector<uint8_t> buffer;
+            size_t mask;
+            std::atomic<size_t> head;   // written by the producer, total bytes written
+            std::atomic<size_t> tail;   // written by the consumer, total bytes read
+
+            /**
+            * @brief copyIn - Copy into the ring at a position, wrapping around the end
+            */
+            void copyIn(size_t position, const uint8_t* data, size_t size);
+    };
+}
+
+#endif // _UTIL_BYTE_RING_H
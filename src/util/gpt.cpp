@@ -0,0 +1,184 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file gpt.cpp
+* @class GptTable
+* @package OpenPST
+* @brief GUID partition table parsing
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "gpt.h"
+
+using namespace OpenPST;
+
+/**
+* @brief GptTable - Constructor
+*/
+GptTable::GptTable() :
+    header({})
+{
+
+}
+
+/**
+* @brief ~GptTable - Deconstructor
+*/
+GptTable::~GptTable()
+{
+
+}
+
+/**
+* @brief parseHeader - Parse and validate the header sector
+*
+* @param const uint8_t* data - The contents of GPT_HEADER_LBA
+* @param size_t size
+*
+* @return bool
+*/
+bool GptTable::parseHeader(const uint8_t* data, size_t size)
+{
+    if (size < sizeof(GptHeader)) {
+        lastError = "GPT header is truncated";
+        return false;
+    }
+
+    memcpy(&header, data, sizeof(GptHeader));
+
+    if (memcmp(header.signature, GPT_SIGNATURE, sizeof(header.signature)) != 0) {
+        lastError = "No GPT signature found";
+        return false;
+    }
+
+    if (header.headerSize < sizeof(GptHeader) || header.headerSize > size) {
+        lastError = "GPT header has an invalid size";
+        return false;
+    }
+
+    // the crc is calculated with its own field zeroed
+    std::vector<uint8_t> copy(data, data + header.headerSize);
+    memset(&copy[offsetof(GptHeader, headerCrc32)], 0x00, sizeof(header.headerCrc32));
+
+    if (crc32(&copy[0], copy.size()) != header.headerCrc32) {
+        lastError = "GPT header checksum mismatch";
+        return false;
+    }
+
+    if (header.sizeOfPartitionEntry < sizeof(GptPartitionEntry) || !header.numberOfPartitionEntries ||
+        header.numberOfPartitionEntries > GPT_MAX_ENTRIES
+    ) {
+        lastError = "GPT header describes an invalid partition entry array";
+        return false;
+    }
+
+    return true;
+}
+
+/**
+* @brief parseEntries - Parse and validate the partition entry array described by the header
+*
+* @param const uint8_t* data - The entry array, starting at header.partitionEntryLba
+* @param size_t size
+*
+* @return bool
+*/
+bool GptTable::parseEntries(const uint8_t* data, size_t size)
+{
+    size_t entriesSize = getEntriesSize();
+
+    partitions.clear();
+
+    if (size < entriesSize) {
+        lastError = "GPT partition entry array is truncated";
+        return false;
+    }
+
+    if (crc32(data, entriesSize) != header.partitionEntryArrayCrc32) {
+        lastError = "GPT partition entry array checksum mismatch";
+        return false;
+    }
+
+    static const uint8_t unused[16] = {};
+
+    for (uint32_t i = 0; i < header.numberOfPartitionEntries; i++) {
+        GptPartitionEntry entry;
+
+        memcpy(&entry, data + (i * header.sizeOfPartitionEntry), sizeof(GptPartitionEntry));
+
+        if (memcmp(entry.typeGuid, unused, sizeof(unused)) == 0) {
+            continue;
+        }
+
+        GptPartition partition = {};
+        partition.index = i + 1;
+        partition.firstLba = entry.firstLba;
+        partition.lastLba = entry.lastLba;
+        partition.attributes = entry.attributes;
+
+        // labels are UTF-16LE, anything outside of ascii is replaced
+        for (int c = 0; c < GPT_NAME_LENGTH && entry.name[c]; c++) {
+            partition.name.push_back(entry.name[c] < 0x80 ? (char)entry.name[c] : '_');
+        }
+
+        if (partition.lastLba < partition.firstLba) {
+            lastError = "GPT partition " + partition.name + " ends before it starts";
+            partitions.clear();
+            return false;
+        }
+
+        partitions.push_back(partition);
+    }
+
+    std::sort(partitions.begin(), partitions.end(), [](const GptPartition& a, const GptPartition& b) {
+        return a.firstLba < b.firstLba;
+    });
+
+    return true;
+}
+
+/**
+* @brief getEntriesSize - Size in bytes of the partition entry array
+*
+* @return size_t
+*/
+size_t GptTable::getEntriesSize()
+{
+    return (size_t)header.numberOfPartitionEntries * header.sizeOfPartitionEntry;
+}
+
+/**
+* @brief crc32 - CRC-32 as used by GPT
+*
+* @param const uint8_t* data
+* @param size_t size
+*
+* @return uint32_t
+*/
+uint32_t GptTable::crc32(const uint8_t* data, size_t size)
+{
+    static const std::vector<uint32_t> table = []() {
+        std::vector<uint32_t> table(256);
+
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t value = i;
+
+            for (int bit = 0; bit < 8; bit++) {
+                value = value & 1 ? (value >> 1) ^ 0xEDB88320 : value >> 1;
+            }
+
+            table[i] = value;
+        }
+
+        return table;
+    }();
+
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+
+    return crc ^ 0xFFFFFFFF;
+}
@@ -0,0 +1,120 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file gpt.h
+* @class GptTable
+* @package OpenPST
+* @brief GUID partition table parsing
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _UTIL_GPT_H
+#define _UTIL_GPT_H
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <string.h>
+#include <stddef.h>
+#include "include/definitions.h"
+
+#define GPT_SIGNATURE           "EFI PART"
+#define GPT_HEADER_LBA          1
+#define GPT_NAME_LENGTH         36
+#define GPT_MAX_ENTRIES         1024
+
+namespace OpenPST {
+
+    PACKED(typedef struct {
+        uint8_t  signature[8];
+        uint32_t revision;
+        uint32_t headerSize;
+        uint32_t headerCrc32;
+        uint32_t reserved;
+        uint64_t currentLba;
+        uint64_t backupLba;
+        uint64_t firstUsableLba;
+        uint64_t lastUsableLba;
+        uint8_t  diskGuid[16];
+        uint64_t partitionEntryLba;
+        uint32_t numberOfPartitionEntries;
+        uint32_t sizeOfPartitionEntry;
+        uint32_t partitionEntryArrayCrc32;
+    }) GptHeader;
+
+    PACKED(typedef struct {
+        uint8_t  typeGuid[16];
+        uint8_t  uniqueGuid[16];
+        uint64_t firstLba;
+        uint64_t lastLba;
+        uint64_t attributes;
+        uint16_t name[GPT_NAME_LENGTH];  // UTF-16LE
+    }) GptPartitionEntry;
+
+    struct GptPartition {
+        uint32_t    index;      // 1 based position in the entry array, as in mmcblk0pN
+        std::string name;
+        uint64_t    firstLba;
+        uint64_t    lastLba;
+        uint64_t    attributes;
+    };
+
+    class GptTable {
+        public:
+            GptHeader header;
+            std::vector<GptPartition> partitions;
+            std::string lastError;
+
+            /**
+            * @brief GptTable
+            */
+            GptTable();
+
+            /**
+            * @brief ~GptTable
+            */
+            ~GptTable();
+
+            /**
+            * @brief parseHeader - Parse and validate the header sector
+            *
+            * @param const uint8_t* data - The contents of GPT_HEADER_LBA
+            * @param size_t size
+            *
+            * @return bool
+            */
+            bool parseHeader(const uint8_t* data, size_t size);
+
+            /**
+            * @brief parseEntries - Parse and validate the partition entry array described by
+            *                       the header. Unused entries are dropped and partitions are
+            *                       ordered by their first LBA.
+            *
+            * @param const uint8_t* data - The entry array, starting at header.partitionEntryLba
+            * @param size_t size
+            *
+            * @return bool
+            */
+            bool parseEntries(const uint8_t* data, size_t size);
+
+            /**
+            * @brief getEntriesSize - Size in bytes of the partition entry array
+            *
+            * @return size_t
+            */
+            size_t getEntriesSize();
+
+            /**
+            * @brief crc32 - CRC-32 as used by GPT
+            *
+            * @param const uint8_t* data
+            * @param size_t size
+            *
+            * @return uint32_t
+            */
+            static uint32_t crc32(const uint8_t* data, size_t size);
+    };
+}
+
+#endif // _UTIL_GPT_H
@@ -0,0 +1,126 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file md5.cpp
+* @package OpenPST
+* @brief MD5 (RFC 1321), to compare local files with the hash the device reports
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+* @see https://www.ietf.org/rfc/rfc1321.txt
+*/
+
+#include "md5.h"
+#include <string.h>
+
+static const uint32_t md5_k[64] = {
+    0xD76AA478, 0xE8C7B756, 0x242070DB, 0xC1BDCEEE, 0xF57C0FAF, 0x4787C62A, 0xA8304613, 0xFD469501,
+    0x698098D8, 0x8B44F7AF, 0xFFFF5BB1, 0x895CD7BE, 0x6B901122, 0xFD987193, 0xA679438E, 0x49B40821,
+    0xF61E2562, 0xC040B340, 0x265E5A51, 0xE9B6C7AA, 0xD62F105D, 0x02441453, 0xD8A1E681, 0xE7D3FBC8,
+    0x21E1CDE6, 0xC33707D6, 0xF4D50D87, 0x455A14ED, 0xA9E3E905, 0xFCEFA3F8, 0x676F02D9, 0x8D2A4C8A,
+    0xFFFA3942, 0x8771F681, 0x6D9D6122, 0xFDE5380C, 0xA4BEEA44, 0x4BDECFA9, 0xF6BB4B60, 0xBEBFBC70,
+    0x289B7EC6, 0xEAA127FA, 0xD4EF3085, 0x04881D05, 0xD9D4D039, 0xE6DB99E5, 0x1FA27CF8, 0xC4AC5665,
+    0xF4292244, 0x432AFF97, 0xAB9423A7, 0xFC93A039, 0x655B59C3, 0x8F0CCC92, 0xFFEFF47D, 0x85845DD1,
+    0x6FA87E4F, 0xFE2CE6E0, 0xA3014314, 0x4E0811A1, 0xF7537E82, 0xBD3AF235, 0x2AD7D2BB, 0xEB86D391
+};
+
+static const uint8_t md5_r[64] = {
+    7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+    5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+    4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+    6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+};
+
+static inline uint32_t md5_rotl32(uint32_t value, int bits)
+{
+    return (value << bits) | (value >> (32 - bits));
+}
+
+static void md5_block(uint32_t state[4], const uint8_t* block)
+{
+    uint32_t m[16];
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+
+    for (int i = 0; i < 16; i++) {
+        m[i] = block[i * 4] | (block[i * 4 + 1] << 8) | (block[i * 4 + 2] << 16) | ((uint32_t)block[i * 4 + 3] << 24);
+    }
+
+    for (int i = 0; i < 64; i++) {
+        uint32_t f;
+        int g;
+
+        if (i < 16) {
+            f = (b & c) | (~b & d);
+            g = i;
+        } else if (i < 32) {
+            f = (d & b) | (~d & c);
+            g = (5 * i + 1) & 15;
+        } else if (i < 48) {
+            f = b ^ c ^ d;
+            g = (3 * i + 5) & 15;
+        } else {
+            f = c ^ (b | ~d);
+            g = (7 * i) & 15;
+        }
+
+        uint32_t next = d;
+        d = c;
+        c = b;
+        b = b + md5_rotl32(a + f + md5_k[i] + m[g], md5_r[i]);
+        a = next;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+}
+
+void md5(const uint8_t* data, size_t size, uint8_t digest[16])
+{
+    uint32_t state[4] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476 };
+    uint8_t tail[128] = {};
+    size_t whole = size & ~(size_t)63;
+    size_t rest = size - whole;
+    uint64_t bits = (uint64_t)size * 8;
+
+    for (size_t i = 0; i < whole; i += 64) {
+        md5_block(state, data + i);
+    }
+
+    // the padding and length take one more block, or two if the rest leaves no room
+    if (rest) {
+        memcpy(tail, data + whole, rest);
+    }
+
+    tail[rest] = 0x80;
+
+    size_t tailSize = rest < 56 ? 64 : 128;
+
+    for (int i = 0; i < 8; i++) {
+        tail[tailSize - 8 + i] = (uint8_t)(bits >> (i * 8));
+    }
+
+    for (size_t i = 0; i < tailSize; i += 64) {
+        md5_block(state, tail + i);
+    }
+
+    for (int i = 0; i < 16; i++) {
+        digest[i] = (uint8_t)(state[i / 4] >> ((i % 4) * 8));
+    }
+}
+
+std::string md5_hex(const uint8_t* data, size_t size)
+{
+    static const char digits[] = "0123456789abcdef";
+    uint8_t digest[16];
+    std::string hex;
+
+    md5(data, size, digest);
+
+    for (int i = 0; i < 16; i++) {
+        hex += digits[digest[i] >> 4];
+        hex += digits[digest[i] & 0x0F];
+    }
+
+    return hex;
+}
@@ -0,0 +1,26 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file md5.h
+* @package OpenPST
+* @brief MD5 (RFC 1321), to compare local files with the hash the device reports
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+* @see https://www.ietf.org/rfc/rfc1321.txt
+*/
+
+#ifndef _UTIL_MD5_H
+#define _UTIL_MD5_H
+
+#include "include/definitions.h"
+#include <stddef.h>
+#include <string>
+
+void md5(const uint8_t* data, size_t size, uint8_t digest[16]);
+
+/**
+* Lower case hex, as DmEfsManager::md5sum returns it
+*/
+std::string md5_hex(const uint8_t* data, size_t size);
+
+#endif // _UTIL_MD5_H
@@ -0,0 +1,545 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file nand_ecc.cpp
+* @class NandEcc
+* @package OpenPST
+* @brief Host side NAND ECC, used to correct pages read raw with the device ECC disabled
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "nand_ecc.h"
+
+using namespace OpenPST;
+
+/**
+* @brief parity - Parity of a byte
+*/
+static inline uint8_t parity(uint8_t value)
+{
+    value ^= value >> 4;
+    value ^= value >> 2;
+    value ^= value >> 1;
+    return value & 1;
+}
+
+/**
+* @brief NandEcc - Constructor
+*
+* @param NandEccType type
+* @param size_t dataSize - Data bytes per codeword
+*/
+NandEcc::NandEcc(NandEccType type, size_t dataSize) :
+    type(type),
+    dataSize(dataSize),
+    eccSize(0),
+    valid(dataSize > 0),
+    indexBits(0),
+    t(0),
+    eccBits(0)
+{
+    memset(generator, 0x00, sizeof(generator));
+
+    switch (type) {
+        case kNandEccHamming:
+            while (((size_t)1 << indexBits) < dataSize * 8) {
+                indexBits++;
+            }
+
+            eccBits = indexBits * 2;
+            eccSize = (eccBits + 7) / 8;
+            break;
+        case kNandEccBch4:
+        case kNandEccBch8:
+            t = type == kNandEccBch4 ? 4 : 8;
+            bchInit();
+            eccSize = (eccBits + 7) / 8;
+            valid = valid && dataSize * 8 + eccBits <= NAND_ECC_BCH_N;
+            break;
+        default:
+            valid = false;
+            return;
+    }
+
+    if (!valid) {
+        return;
+    }
+
+    // mask the stored ECC so an erased codeword reads back as a valid one
+    std::vector<uint8_t> erased(dataSize, 0xFF);
+
+    erasedEcc.resize(eccSize);
+
+    if (type == kNandEccHamming) {
+        hammingEncode(&erased[0], &erasedEcc[0]);
+    } else {
+        bchEncode(&erased[0], &erasedEcc[0]);
+    }
+
+    for (auto &b : erasedEcc) {
+        b ^= 0xFF;
+    }
+}
+
+/**
+* @brief ~NandEcc - Deconstructor
+*/
+NandEcc::~NandEcc()
+{
+
+}
+
+/**
+* @brief isValid - false when dataSize is too large for the code
+*
+* @return bool
+*/
+bool NandEcc::isValid()
+{
+    return valid;
+}
+
+/**
+* @brief getType
+*
+* @return NandEccType
+*/
+NandEccType NandEcc::getType()
+{
+    return type;
+}
+
+/**
+* @brief getDataSize - Data bytes per codeword
+*
+* @return size_t
+*/
+size_t NandEcc::getDataSize()
+{
+    return dataSize;
+}
+
+/**
+* @brief getEccSize - ECC bytes per codeword
+*
+* @return size_t
+*/
+size_t NandEcc::getEccSize()
+{
+    return eccSize;
+}
+
+/**
+* @brief encode - Calculate the ECC of a codeword
+*
+* @param const uint8_t* data - getDataSize() bytes
+* @param uint8_t* ecc - getEccSize() bytes
+*/
+void NandEcc::encode(const uint8_t* data, uint8_t* ecc)
+{
+    if (type == kNandEccHamming) {
+        hammingEncode(data, ecc);
+    } else {
+        bchEncode(data, ecc);
+    }
+
+    for (size_t i = 0; i < eccSize; i++) {
+        ecc[i] ^= erasedEcc[i];
+    }
+}
+
+/**
+* @brief correct - Correct a codeword in place
+*
+* @param uint8_t* data - getDataSize() bytes
+* @param uint8_t* ecc - getEccSize() bytes, corrected as well
+*
+* @return int - Number of bits corrected, -1 if uncorrectable
+*/
+int NandEcc::correct(uint8_t* data, uint8_t* ecc)
+{
+    if (type == kNandEccHamming) {
+        return hammingCorrect(data, ecc);
+    }
+
+    return bchCorrect(data, ecc);
+}
+
+/**
+* @brief hammingEncode - Line and column parity of the codeword bit index.
+*
+* Bit i of the codeword is bit (7 - i % 8) of byte i / 8. For every index bit k
+* the ECC holds the parity of all bits whose index has k set, and of all bits
+* whose index has k clear, interleaved as bit 2k and 2k + 1.
+*
+* @param const uint8_t* data
+* @param uint8_t* ecc - Unmasked
+*/
+void NandEcc::hammingEncode(const uint8_t* data, uint8_t* ecc)
+{
+    static const uint8_t columnMask[3] = { 0x55, 0x33, 0x0F };
+
+    uint8_t columns = 0;
+    uint32_t rows = 0;
+    uint8_t total = 0;
+
+    for (size_t i = 0; i < dataSize; i++) {
+        columns ^= data[i];
+
+        if (parity(data[i])) {
+            rows ^= (uint32_t)i;
+        }
+    }
+
+    total = parity(columns);
+
+    memset(ecc, 0x00, eccSize);
+
+    for (int k = 0; k < indexBits; k++) {
+        uint8_t set = k < 3 ? parity(columns & columnMask[k]) : (rows >> (k - 3)) & 1;
+        uint8_t clear = set ^ total;
+
+        ecc[(2 * k) / 8] |= set << ((2 * k) % 8);
+        ecc[(2 * k + 1) / 8] |= clear << ((2 * k + 1) % 8);
+    }
+}
+
+/**
+* @brief hammingCorrect
+*
+* @param uint8_t* data
+* @param uint8_t* ecc
+*
+* @return int
+*/
+int NandEcc::hammingCorrect(uint8_t* data, uint8_t* ecc)
+{
+    std::vector<uint8_t> calculated(eccSize);
+    uint32_t index = 0;
+    int differing = 0;
+    bool single = true;
+
+    hammingEncode(data, &calculated[0]);
+
+    for (int k = 0; k < indexBits; k++) {
+        int setBit = 2 * k, clearBit = 2 * k + 1;
+        uint8_t set = ((calculated[setBit / 8] ^ ecc[setBit / 8] ^ erasedEcc[setBit / 8]) >> (setBit % 8)) & 1;
+        uint8_t clear = ((calculated[clearBit / 8] ^ ecc[clearBit / 8] ^ erasedEcc[clearBit / 8]) >> (clearBit % 8)) & 1;
+
+        differing += set + clear;
+        single = single && (set ^ clear);
+        index |= (uint32_t)set << k;
+    }
+
+    if (!differing) {
+        return 0;
+    }
+
+    // a flip in the ECC itself changes a single parity
+    if (differing == 1) {
+        for (int bit = 0; bit < eccBits; bit++) {
+            uint8_t mask = 1 << (bit % 8);
+
+            if ((calculated[bit / 8] ^ ecc[bit / 8] ^ erasedEcc[bit / 8]) & mask) {
+                ecc[bit / 8] ^= mask;
+            }
+        }
+
+        return 1;
+    }
+
+    // a flip in the data changes exactly one of each pair, and the set parities spell its index
+    if (single && index < dataSize * 8) {
+        data[index / 8] ^= 0x80 >> (index % 8);
+        return 1;
+    }
+
+    return -1;
+}
+
+/**
+* @brief bchInit - Build the field tables and the generator polynomial, the product
+*                  of the minimal polynomials of alpha^1 .. alpha^2t
+*/
+void NandEcc::bchInit()
+{
+    alphaTo.resize(NAND_ECC_BCH_N + 1);
+    indexOf.resize(NAND_ECC_BCH_N + 1);
+
+    uint32_t x = 1;
+
+    for (int i = 0; i < NAND_ECC_BCH_N; i++) {
+        alphaTo[i] = (uint16_t)x;
+        indexOf[x] = (int16_t)i;
+
+        x <<= 1;
+
+        if (x & (1 << NAND_ECC_BCH_M)) {
+            x ^= NAND_ECC_BCH_PRIMITIVE_POLY;
+        }
+    }
+
+    alphaTo[NAND_ECC_BCH_N] = 1;
+    indexOf[0] = -1;
+
+    // roots are the conjugacy classes of the odd powers, even powers are squares of those
+    std::vector<bool> isRoot(NAND_ECC_BCH_N, false);
+
+    for (int i = 1; i < 2 * t; i += 2) {
+        int r = i;
+
+        for (int j = 0; j < NAND_ECC_BCH_M; j++) {
+            isRoot[r] = true;
+            r = (r * 2) % NAND_ECC_BCH_N;
+        }
+    }
+
+    std::vector<uint16_t> g(1, 1);
+
+    for (int r = 0; r < NAND_ECC_BCH_N; r++) {
+        if (!isRoot[r]) {
+            continue;
+        }
+
+        // g(x) *= (x + alpha^r)
+        g.push_back(0);
+
+        for (size_t i = g.size() - 1; i > 0; i--) {
+            g[i] = g[i - 1] ^ gfMultiply(g[i], alphaTo[r]);
+        }
+
+        g[0] = gfMultiply(g[0], alphaTo[r]);
+    }
+
+    eccBits = (int)g.size() - 1;
+
+    // generator bit p holds the coefficient of x^(eccBits - 1 - p), the leading term is implied
+    for (int p = 0; p < eccBits; p++) {
+        if (g[eccBits - 1 - p] & 1) {
+            generator[p / 32] |= 0x80000000 >> (p % 32);
+        }
+    }
+
+    // remainder of each byte value shifted through an empty register, bit at a time
+    const int words = NAND_ECC_BCH_ECC_WORDS + 1;
+
+    remainderTable.assign(256 * words, 0);
+
+    for (int value = 0; value < 256; value++) {
+        uint32_t* entry = &remainderTable[value * words];
+
+        for (int bit = 7; bit >= 0; bit--) {
+            uint32_t feedback = ((value >> bit) & 1) ^ (entry[0] >> 31);
+
+            for (int w = 0; w < words - 1; w++) {
+                entry[w] = (entry[w] << 1) | (entry[w + 1] >> 31);
+            }
+
+            if (feedback) {
+                for (int w = 0; w < words - 1; w++) {
+                    entry[w] ^= generator[w];
+                }
+            }
+        }
+    }
+}
+
+/**
+* @brief bchRemainder - data(x) * x^eccBits mod g(x), same bit layout as generator.
+*                       Steps a byte at a time through remainderTable.
+*
+* @param const uint8_t* data
+* @param uint32_t* remainder - NAND_ECC_BCH_ECC_WORDS + 1 words
+*/
+void NandEcc::bchRemainder(const uint8_t* data, uint32_t* remainder)
+{
+    const int words = NAND_ECC_BCH_ECC_WORDS + 1;
+
+    memset(remainder, 0x00, sizeof(uint32_t) * words);
+
+    for (size_t i = 0; i < dataSize; i++) {
+        const uint32_t* entry = &remainderTable[((remainder[0] >> 24) ^ data[i]) * words];
+
+        for (int w = 0; w < words - 1; w++) {
+            remainder[w] = ((remainder[w] << 8) | (remainder[w + 1] >> 24)) ^ entry[w];
+        }
+    }
+}
+
+/**
+* @brief bchEncode
+*
+* @param const uint8_t* data
+* @param uint8_t* ecc - Unmasked, the remainder most significant bit first
+*/
+void NandEcc::bchEncode(const uint8_t* data, uint8_t* ecc)
+{
+    uint32_t remainder[NAND_ECC_BCH_ECC_WORDS + 1];
+
+    bchRemainder(data, remainder);
+
+    for (size_t i = 0; i < eccSize; i++) {
+        ecc[i] = (uint8_t)(remainder[i / 4] >> (24 - 8 * (i % 4)));
+    }
+}
+
+/**
+* @brief bchCorrect - Syndromes from the ECC difference, Berlekamp-Massey for
+*                     the error locator and a Chien search for its roots
+*
+* @param uint8_t* data
+* @param uint8_t* ecc
+*
+* @return int
+*/
+int NandEcc::bchCorrect(uint8_t* data, uint8_t* ecc)
+{
+    std::vector<uint8_t> calculated(eccSize);
+    std::vector<uint8_t> difference(eccSize);
+    bool clean = true;
+
+    bchEncode(data, &calculated[0]);
+
+    for (size_t i = 0; i < eccSize; i++) {
+        difference[i] = calculated[i] ^ ecc[i] ^ erasedEcc[i];
+    }
+
+    // padding past eccBits in the last byte is not part of the code
+    if (eccBits % 8) {
+        difference[eccSize - 1] &= 0xFF << (8 - eccBits % 8);
+    }
+
+    for (auto &b : difference) {
+        clean = clean && !b;
+    }
+
+    if (clean) {
+        return 0;
+    }
+
+    // the received word is congruent to the difference mod g(x), so both have the same syndromes
+    uint16_t syndromes[2 * NAND_ECC_BCH_MAX_T + 1] = {};
+
+    for (int p = 0; p < eccBits; p++) {
+        if (!((difference[p / 8] >> (7 - p % 8)) & 1)) {
+            continue;
+        }
+
+        int degree = eccBits - 1 - p;
+
+        for (int j = 1; j <= 2 * t; j++) {
+            syndromes[j] ^= gfPow(j * degree);
+        }
+    }
+
+    // Berlekamp-Massey
+    uint16_t locator[2 * NAND_ECC_BCH_MAX_T + 2] = { 1 };
+    uint16_t previous[2 * NAND_ECC_BCH_MAX_T + 2] = { 1 };
+    uint16_t scratch[2 * NAND_ECC_BCH_MAX_T + 2];
+    uint16_t lastDiscrepancy = 1;
+    int length = 0, shift = 1;
+
+    for (int n = 0; n < 2 * t; n++) {
+        uint16_t discrepancy = syndromes[n + 1];
+
+        for (int i = 1; i <= length; i++) {
+            discrepancy ^= gfMultiply(locator[i], syndromes[n + 1 - i]);
+        }
+
+        if (!discrepancy) {
+            shift++;
+            continue;
+        }
+
+        uint16_t scale = gfMultiply(discrepancy, gfPow(NAND_ECC_BCH_N - indexOf[lastDiscrepancy]));
+
+        memcpy(scratch, locator, sizeof(scratch));
+
+        for (int i = 0; i + shift <= 2 * t + 1; i++) {
+            locator[i + shift] ^= gfMultiply(scale, previous[i]);
+        }
+
+        if (2 * length <= n) {
+            length = n + 1 - length;
+            memcpy(previous, scratch, sizeof(previous));
+            lastDiscrepancy = discrepancy;
+            shift = 1;
+        } else {
+            shift++;
+        }
+    }
+
+    if (length > t) {
+        return -1;
+    }
+
+    // Chien search, an error at degree k makes alpha^-k a root of the locator
+    int codewordBits = (int)dataSize * 8 + eccBits;
+    std::vector<int> errors;
+
+    for (int k = 0; k < codewordBits && (int)errors.size() < length; k++) {
+        uint16_t sum = locator[0];
+
+        for (int i = 1; i <= length; i++) {
+            if (locator[i]) {
+                sum ^= gfPow(indexOf[locator[i]] - i * k);
+            }
+        }
+
+        if (!sum) {
+            errors.push_back(k);
+        }
+    }
+
+    if ((int)errors.size() != length) {
+        return -1;
+    }
+
+    for (auto k : errors) {
+        if (k < eccBits) {
+            int p = eccBits - 1 - k;
+            ecc[p / 8] ^= 0x80 >> (p % 8);
+        } else {
+            int i = codewordBits - 1 - k;
+            data[i / 8] ^= 0x80 >> (i % 8);
+        }
+    }
+
+    return length;
+}
+
+/**
+* @brief gfMultiply - Multiply in GF(2^13)
+*
+* @param uint16_t a
+* @param uint16_t b
+*
+* @return uint16_t
+*/
+uint16_t NandEcc::gfMultiply(uint16_t a, uint16_t b)
+{
+    if (!a || !b) {
+        return 0;
+    }
+
+    return alphaTo[(indexOf[a] + indexOf[b]) % NAND_ECC_BCH_N];
+}
+
+/**
+* @brief gfPow - alpha^exponent, exponent may be negative
+*
+* @param int exponent
+*
+* @return uint16_t
+*/
+uint16_t NandEcc::gfPow(int exponent)
+{
+    exponent %= NAND_ECC_BCH_N;
+
+    if (exponent < 0) {
+        exponent += NAND_ECC_BCH_N;
+    }
+
+    return alphaTo[exponent];
+}
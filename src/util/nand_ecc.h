@@ -0,0 +1,137 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file nand_ecc.h
+* @class NandEcc
+* @package OpenPST
+* @brief Host side NAND ECC, used to correct pages read raw with the device ECC disabled
+*
+* Supported codes:
+*
+*   Hamming - single bit correction, double bit detection. Line and column parity
+*             over the codeword bit index, stored inverted (3 bytes per 512)
+*   BCH-4   - 4 bit correction over GF(2^13) (7 bytes per codeword)
+*   BCH-8   - 8 bit correction over GF(2^13) (13 bytes per codeword)
+*
+* As in the Linux software ECC implementations, the stored ECC of an erased
+* codeword is all 0xFF, so erased pages decode clean and bit flips in them are
+* corrected like any other.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _UTIL_NAND_ECC_H
+#define _UTIL_NAND_ECC_H
+
+#include <vector>
+#include <string.h>
+#include "include/definitions.h"
+
+#define NAND_ECC_BCH_M              13
+#define NAND_ECC_BCH_N              ((1 << NAND_ECC_BCH_M) - 1)
+#define NAND_ECC_BCH_PRIMITIVE_POLY 0x201B  // x^13 + x^4 + x^3 + x + 1
+#define NAND_ECC_BCH_MAX_T          8
+#define NAND_ECC_BCH_MAX_ECC_BITS   (NAND_ECC_BCH_M * NAND_ECC_BCH_MAX_T)
+#define NAND_ECC_BCH_ECC_WORDS      ((NAND_ECC_BCH_MAX_ECC_BITS + 31) / 32)
+
+namespace OpenPST {
+
+    enum NandEccType {
+        kNandEccNone    = 0,
+        kNandEccHamming = 1,
+        kNandEccBch4    = 2,
+        kNandEccBch8    = 3
+    };
+
+    class NandEcc {
+        public:
+            /**
+            * @brief NandEcc
+            *
+            * @param NandEccType type
+            * @param size_t dataSize - Data bytes per codeword
+            */
+            NandEcc(NandEccType type, size_t dataSize);
+
+            /**
+            * @brief ~NandEcc
+            */
+            ~NandEcc();
+
+            /**
+            * @brief isValid - false when dataSize is too large for the code
+            *
+            * @return bool
+            */
+            bool isValid();
+
+            /**
+            * @brief getType
+            *
+            * @return NandEccType
+            */
+            NandEccType getType();
+
+            /**
+            * @brief getDataSize - Data bytes per codeword
+            *
+            * @return size_t
+            */
+            size_t getDataSize();
+
+            /**
+            * @brief getEccSize - ECC bytes per codeword
+            *
+            * @return size_t
+            */
+            size_t getEccSize();
+
+            /**
+            * @brief encode - Calculate the ECC of a codeword
+            *
+            * @param const uint8_t* data - getDataSize() bytes
+            * @param uint8_t* ecc - getEccSize() bytes
+            */
+            void encode(const uint8_t* data, uint8_t* ecc);
+
+            /**
+            * @brief correct - Correct a codeword in place
+            *
+            * @param uint8_t* data - getDataSize() bytes
+            * @param uint8_t* ecc - getEccSize() bytes, corrected as well
+            *
+            * @return int - Number of bits corrected, -1 if uncorrectable
+            */
+            int correct(uint8_t* data, uint8_t* ecc);
+
+        private:
+            NandEccType type;
+            size_t dataSize;
+            size_t eccSize;
+            bool valid;
+
+            // hamming
+            int indexBits;
+
+            // bch
+            int t;
+            int eccBits;
+            std::vector<uint16_t> alphaTo;  // alpha^i
+            std::vector<int16_t>  indexOf;  // log_alpha(x), -1 for 0
+            uint32_t generator[NAND_ECC_BCH_ECC_WORDS + 1];
+            std::vector<uint32_t> remainderTable;   // 256 entries of NAND_ECC_BCH_ECC_WORDS + 1 words
+            std::vector<uint8_t> erasedEcc;
+
+            void hammingEncode(const uint8_t* data, uint8_t* ecc);
+            int hammingCorrect(uint8_t* data, uint8_t* ecc);
+
+            void bchInit();
+            void bchRemainder(const uint8_t* data, uint32_t* remainder);
+            void bchEncode(const uint8_t* data, uint8_t* ecc);
+            int bchCorrect(uint8_t* data, uint8_t* ecc);
+            uint16_t gfMultiply(uint16_t a, uint16_t b);
+            uint16_t gfPow(int exponent);
+    };
+}
+
+#endif // _UTIL_NAND_ECC_H
@@ -0,0 +1,210 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file nand_ecc_pipeline.cpp
+* @class NandEccPipeline
+* @package OpenPST
+* @brief Corrects raw NAND pages on a pool of threads while the caller keeps reading
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "nand_ecc_pipeline.h"
+
+using namespace OpenPST;
+
+/**
+* @brief NandEccPipeline - Constructor
+*
+* @param NandPageLayout layout
+* @param size_t threads - 0 for one per hardware thread
+* @param size_t maxPending - Pages in flight before submit blocks
+*/
+NandEccPipeline::NandEccPipeline(NandPageLayout layout, size_t threads, size_t maxPending) :
+    layout(layout),
+    ecc(layout.eccType, layout.codewordSize),
+    maxPending(maxPending ? maxPending : 1),
+    submitted(0),
+    collected(0),
+    stopping(false)
+{
+    if (!isValid()) {
+        return;
+    }
+
+    if (!threads) {
+        threads = std::thread::hardware_concurrency();
+    }
+
+    if (!threads) {
+        threads = 2;
+    }
+
+    for (size_t i = 0; i < threads; i++) {
+        workers.push_back(std::thread(&NandEccPipeline::work, this));
+    }
+}
+
+/**
+* @brief ~NandEccPipeline - Deconstructor
+*/
+NandEccPipeline::~NandEccPipeline()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    queued.notify_all();
+
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+* @brief isValid - false when the codewords and their ECC do not fit the raw page
+*
+* @return bool
+*/
+bool NandEccPipeline::isValid()
+{
+    if (!ecc.isValid() || !layout.pageSize || layout.pageSize % layout.codewordSize) {
+        return false;
+    }
+
+    size_t codewords = layout.pageSize / layout.codewordSize;
+
+    return codewords * (layout.codewordSize + ecc.getEccSize()) <= getRawPageSize();
+}
+
+/**
+* @brief getRawPageSize - pageSize + spareSize
+*
+* @return size_t
+*/
+size_t NandEccPipeline::getRawPageSize()
+{
+    return layout.pageSize + layout.spareSize;
+}
+
+/**
+* @brief submit - Queue a raw page, blocking while maxPending pages are in flight
+*
+* @param NandEccPage page
+*/
+void NandEccPipeline::submit(NandEccPage page)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    finished.wait(lock, [this]() { return submitted - collected < maxPending; });
+
+    pending.push_back(std::make_pair(submitted++, std::move(page)));
+
+    lock.unlock();
+
+    queued.notify_one();
+}
+
+/**
+* @brief next - Get the next corrected page in submit order
+*
+* @param NandEccPage& page
+* @param bool wait
+*
+* @return bool - false when the next page is not ready, or nothing is in flight
+*/
+bool NandEccPipeline::next(NandEccPage& page, bool wait)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    if (collected == submitted) {
+        return false;
+    }
+
+    if (wait) {
+        finished.wait(lock, [this]() { return done.count(collected) > 0; });
+    }
+
+    auto it = done.find(collected);
+
+    if (it == done.end()) {
+        return false;
+    }
+
+    page = std::move(it->second);
+
+    done.erase(it);
+
+    collected++;
+
+    lock.unlock();
+
+    // room for another submit
+    finished.notify_all();
+
+    return true;
+}
+
+/**
+* @brief correctPage - Correct a single raw page in place on the calling thread
+*
+* @param NandEcc& ecc
+* @param NandPageLayout& layout
+* @param NandEccPage& page
+*/
+void NandEccPipeline::correctPage(NandEcc& ecc, NandPageLayout& layout, NandEccPage& page)
+{
+    size_t codewords = layout.pageSize / layout.codewordSize;
+    size_t stride = layout.codewordSize + ecc.getEccSize();
+    uint8_t* raw = &page.data[0];
+
+    page.corrected = 0;
+    page.uncorrectable = 0;
+
+    for (size_t i = 0; i < codewords; i++) {
+        uint8_t* codeword = raw + i * stride;
+        int result = ecc.correct(codeword, codeword + layout.codewordSize);
+
+        if (result < 0) {
+            page.uncorrectable++;
+        } else {
+            page.corrected += result;
+        }
+
+        // pack the main area to the front, the source is always at or ahead of the destination
+        memmove(raw + i * layout.codewordSize, codeword, layout.codewordSize);
+    }
+
+    page.data.resize(layout.pageSize);
+}
+
+/**
+* @brief work - Worker thread loop
+*/
+void NandEccPipeline::work()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        queued.wait(lock, [this]() { return stopping || pending.size(); });
+
+        if (stopping) {
+            return;
+        }
+
+        std::pair<uint64_t, NandEccPage> job = std::move(pending.front());
+
+        pending.pop_front();
+
+        lock.unlock();
+
+        correctPage(ecc, layout, job.second);
+
+        lock.lock();
+
+        done[job.first] = std::move(job.second);
+
+        finished.notify_all();
+    }
+}
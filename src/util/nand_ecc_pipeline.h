@@ -0,0 +1,127 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file nand_ecc_pipeline.h
+* @class NandEccPipeline
+* @package OpenPST
+* @brief Corrects raw NAND pages on a pool of threads while the caller keeps reading
+*
+* A raw page is laid out as the device returns it with ECC disabled:
+*
+*   [codeword 0 data][codeword 0 ecc][codeword 1 data][codeword 1 ecc] ... [remaining spare]
+*
+* where the main area is split into pageSize / codewordSize codewords. Pages
+* come back out of the pipeline with only the corrected main area, in the
+* order they were submitted.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _UTIL_NAND_ECC_PIPELINE_H
+#define _UTIL_NAND_ECC_PIPELINE_H
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "include/definitions.h"
+#include "util/nand_ecc.h"
+
+#define NAND_ECC_PIPELINE_MAX_PENDING 64
+
+namespace OpenPST {
+
+    struct NandPageLayout {
+        size_t      pageSize;       // main area bytes
+        size_t      spareSize;      // spare bytes
+        NandEccType eccType;
+        size_t      codewordSize;   // main area bytes per codeword
+    };
+
+    struct NandEccPage {
+        uint64_t    index;          // caller defined, usually the page number
+        std::vector<uint8_t> data;  // raw page in, corrected main area out
+        int         corrected;      // bits corrected
+        int         uncorrectable;  // codewords that could not be corrected
+    };
+
+    class NandEccPipeline {
+        public:
+            /**
+            * @brief NandEccPipeline
+            *
+            * @param NandPageLayout layout
+            * @param size_t threads - 0 for one per hardware thread
+            * @param size_t maxPending - Pages in flight before submit blocks
+            */
+            NandEccPipeline(NandPageLayout layout, size_t threads = 0, size_t maxPending = NAND_ECC_PIPELINE_MAX_PENDING);
+
+            /**
+            * @brief ~NandEccPipeline - Drops anything not yet collected
+            */
+            ~NandEccPipeline();
+
+            /**
+            * @brief isValid - false when the codewords and their ECC do not fit the raw page
+            *
+            * @return bool
+            */
+            bool isValid();
+
+            /**
+            * @brief getRawPageSize - pageSize + spareSize
+            *
+            * @return size_t
+            */
+            size_t getRawPageSize();
+
+            /**
+            * @brief submit - Queue a raw page, blocking while maxPending pages are in flight
+            *
+            * @param NandEccPage page
+            */
+            void submit(NandEccPage page);
+
+            /**
+            * @brief next - Get the next corrected page in submit order
+            *
+            * @param NandEccPage& page
+            * @param bool wait - Block until the next page is corrected
+            *
+            * @return bool - false when the next page is not ready, or nothing is in flight
+            */
+            bool next(NandEccPage& page, bool wait);
+
+            /**
+            * @brief correctPage - Correct a single raw page in place on the calling thread
+            *
+            * @param NandEcc& ecc
+            * @param NandPageLayout& layout
+            * @param NandEccPage& page
+            */
+            static void correctPage(NandEcc& ecc, NandPageLayout& layout, NandEccPage& page);
+
+        private:
+            NandPageLayout layout;
+            NandEcc ecc;
+            size_t maxPending;
+            std::vector<std::thread> workers;
+            std::mutex mutex;
+            std::condition_variable queued;
+            std::condition_variable finished;
+            std::deque<std::pair<uint64_t, NandEccPage>> pending;
+            std::map<uint64_t, NandEccPage> done;
+            uint64_t submitted;
+            uint64_t collected;
+            bool stopping;
+
+            /**
+            * @brief work - Worker thread loop
+            */
+            void work();
+    };
+}
+
+#endif // _UTIL_NAND_ECC_PIPELINE_H
@@ -0,0 +1,141 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file rtt_estimator.cpp
+* @class RttEstimator
+* @package OpenPST
+* @brief Smoothed round trip time and retransmission style timeout
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "rtt_estimator.h"
+
+using namespace OpenPST;
+
+/**
+* @brief RttEstimator
+*
+* @param uint32_t initial - ms
+* @param uint32_t floor - ms
+* @param uint32_t ceiling - ms
+*/
+RttEstimator::RttEstimator(uint32_t initial, uint32_t floor, uint32_t ceiling) :
+    initial(initial),
+    floor(floor),
+    ceiling(ceiling)
+{
+    reset();
+}
+
+/**
+* @brief ~RttEstimator
+*/
+RttEstimator::~RttEstimator()
+{
+
+}
+
+/**
+* @brief addSample - Record a measured round trip, ends any backoff
+*
+* @param uint32_t rtt - us
+* @return void
+*/
+void RttEstimator::addSample(uint32_t rtt)
+{
+    if (!stats.samples) {
+        stats.smoothed  = rtt;
+        stats.deviation = rtt / 2;
+        stats.min       = rtt;
+        stats.max       = rtt;
+    } else {
+        uint32_t error = rtt > stats.smoothed ? rtt - stats.smoothed : stats.smoothed - rtt;
+
+        // deviation gains 1/4 of the error, the smoothed time 1/8 of the sample
+        stats.deviation = stats.deviation - (stats.deviation >> 2) + (error >> 2);
+        stats.smoothed  = stats.smoothed - (stats.smoothed >> 3) + (rtt >> 3);
+
+        if (rtt < stats.min) {
+            stats.min = rtt;
+        }
+
+        if (rtt > stats.max) {
+            stats.max = rtt;
+        }
+    }
+
+    stats.last = rtt;
+    stats.samples++;
+
+    backoff = 0;
+
+    stats.timeout = getTimeout();
+}
+
+/**
+* @brief addTimeout - Record a wait that got no answer, doubles the timeout
+*
+* @return void
+*/
+void RttEstimator::addTimeout()
+{
+    stats.timeouts++;
+
+    if (getTimeout() < ceiling) {
+        backoff++;
+    }
+
+    stats.timeout = getTimeout();
+}
+
+/**
+* @brief getTimeout - ms to wait for the next answer
+*
+* @return uint32_t
+*/
+uint32_t RttEstimator::getTimeout()
+{
+    uint64_t timeout = stats.samples ? ((uint64_t)stats.smoothed + 4 * (uint64_t)stats.deviation + 999) / 1000 : initial;
+
+    if (timeout < floor) {
+        timeout = floor;
+    }
+
+    timeout <<= backoff;
+
+    return timeout > ceiling ? ceiling : (uint32_t)timeout;
+}
+
+/**
+* @brief hasSamples
+*
+* @return bool
+*/
+bool RttEstimator::hasSamples()
+{
+    return stats.samples > 0;
+}
+
+/**
+* @brief getStats
+*
+* @return RttStats
+*/
+RttStats RttEstimator::getStats()
+{
+    return stats;
+}
+
+/**
+* @brief reset - Forget every sample
+*
+* @return void
+*/
+void RttEstimator::reset()
+{
+    memset(&stats, 0x00, sizeof(stats));
+
+    backoff       = 0;
+    stats.timeout = getTimeout();
+}
@@ -0,0 +1,105 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file rtt_estimator.h
+* @class RttEstimator
+* @package OpenPST
+* @brief Smoothed round trip time and retransmission style timeout
+*
+* Keeps a smoothed round trip time and its mean deviation the way TCP does
+* (RFC 6298). The timeout is the smoothed time plus four deviations, kept
+* between a floor and a ceiling. A timeout doubles it until the next sample
+* comes in, so a device that went away is not waited on at the floor forever.
+* Times are in microseconds, timeouts in milliseconds.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _UTIL_RTT_ESTIMATOR_H
+#define _UTIL_RTT_ESTIMATOR_H
+
+#include <cstring>
+#include "include/definitions.h"
+
+namespace OpenPST {
+
+    struct RttStats {
+        uint64_t samples;
+        uint64_t timeouts;
+        uint32_t smoothed;  // us
+        uint32_t deviation; // us
+        uint32_t min;       // us
+        uint32_t max;       // us
+        uint32_t last;      // us
+        uint32_t timeout;   // ms, what the next wait would use
+    };
+
+    class RttEstimator {
+        public:
+            /**
+            * @brief RttEstimator
+            *
+            * @param uint32_t initial - ms, timeout before the first sample
+            * @param uint32_t floor - ms
+            * @param uint32_t ceiling - ms
+            */
+            RttEstimator(uint32_t initial = 1000, uint32_t floor = 50, uint32_t ceiling = 5000);
+
+            /**
+            * @brief ~RttEstimator
+            */
+            ~RttEstimator();
+
+            /**
+            * @brief addSample - Record a measured round trip, ends any backoff
+            *
+            * @param uint32_t rtt - us
+            * @return void
+            */
+            void addSample(uint32_t rtt);
+
+            /**
+            * @brief addTimeout - Record a wait that got no answer, doubles the timeout
+            *
+            * @return void
+            */
+            void addTimeout();
+
+            /**
+            * @brief getTimeout - ms to wait for the next answer
+            *
+            * @return uint32_t
+            */
+            uint32_t getTimeout();
+
+            /**
+            * @brief hasSamples
+            *
+            * @return bool
+            */
+            bool hasSamples();
+
+            /**
+            * @brief getStats
+            *
+            * @return RttStats
+            */
+            RttStats getStats();
+
+            /**
+            * @brief reset - Forget every sample
+            *
+            * @return void
+            */
+            void reset();
+
+        private:
+            uint32_t initial;
+            uint32_t floor;
+            uint32_t ceiling;
+            uint32_t backoff;   // doublings since the last sample
+            RttStats stats;
+    };
+}
+
+#endif // _UTIL_RTT_ESTIMATOR_H
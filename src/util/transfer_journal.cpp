@@ -0,0 +1,255 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file transfer_journal.cpp
+* @class TransferJournal
+* @package OpenPST
+* @brief Checkpoint journal for long device transfers so they can be resumed
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "transfer_journal.h"
+
+using namespace OpenPST;
+
+/**
+* @brief TransferJournal - Constructor
+*/
+TransferJournal::TransferJournal() :
+    address(0),
+    size(0)
+{
+
+}
+
+/**
+* @brief ~TransferJournal - Deconstructor
+*/
+TransferJournal::~TransferJournal()
+{
+    if (file.is_open()) {
+        file.close();
+    }
+}
+
+/**
+* @brief open - Open a journal for a transfer
+*
+* @param std::string filePath - The journal file
+* @param uint64_t address - Device address the transfer starts at
+* @param uint64_t size - Total size of the transfer
+* @param std::string device - Identifies the device, without whitespace
+* @param bool resume - Keep completed ranges of a matching journal
+*
+* @return bool
+*/
+bool TransferJournal::open(std::string filePath, uint64_t address, uint64_t size, std::string device, bool resume)
+{
+    this->filePath = filePath;
+    this->address = address;
+    this->size = size;
+    this->device = device.size() ? device : "-";
+
+    entries.clear();
+
+    if (resume) {
+        std::ifstream existing(filePath.c_str(), std::ios::in);
+        std::string line, magic, existingDevice;
+        int version = 0;
+        uint64_t existingAddress = 0, existingSize = 0;
+
+        if (existing.is_open() && std::getline(existing, line)) {
+            std::istringstream header(line);
+            header >> magic >> version >> std::hex >> existingAddress >> std::dec >> existingSize >> existingDevice;
+
+            bool matches = magic.compare("openpst-journal") == 0 && version == TRANSFER_JOURNAL_VERSION &&
+                existingAddress == address && existingSize == size;
+
+            if (matches && existingDevice.compare(this->device) != 0) {
+                // the ranges reached another device, none of them are on this one. The
+                // journal is left alone, it is still good for resuming that device
+                LOGE("%s belongs to device %s, not %s\n", filePath.c_str(), existingDevice.c_str(), this->device.c_str());
+                return false;
+            }
+
+            if (matches) {
+                uint64_t expected = 0;
+
+                while (std::getline(existing, line)) {
+                    std::istringstream fields(line);
+                    TransferJournalEntry entry = {};
+
+                    // a torn last line from a crash is simply dropped, ranges may have
+                    // gaps between them but never go backwards
+                    if (!(fields >> entry.offset >> entry.size >> std::hex >> entry.hash) || entry.offset < expected) {
+                        break;
+                    }
+
+                    entries.push_back(entry);
+                    expected = entry.offset + entry.size;
+                }
+            }
+        }
+    }
+
+    return rewrite();
+}
+
+/**
+* @brief resumeOffset - Offset of the first incomplete byte
+*
+* @return uint64_t
+*/
+uint64_t TransferJournal::resumeOffset()
+{
+    if (!entries.size()) {
+        return 0;
+    }
+
+    return entries.back().offset + entries.back().size;
+}
+
+/**
+* @brief checkpoint - Record a completed range
+*
+* @param uint64_t offset - Offset relative to the transfer start
+* @param const uint8_t* data - The data of the range
+* @param uint64_t size
+*
+* @return bool
+*/
+bool TransferJournal::checkpoint(uint64_t offset, const uint8_t* data, uint64_t size)
+{
+    return checkpoint(describe(offset, data, size));
+}
+
+/**
+* @brief checkpoint - Record a completed range described earlier
+*
+* @param TransferJournalEntry& entry
+*
+* @return bool
+*/
+bool TransferJournal::checkpoint(const TransferJournalEntry& entry)
+{
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file << entry.offset << " " << entry.size << " " << std::hex << entry.hash << std::dec << "\n";
+    file.flush();
+
+    entries.push_back(entry);
+
+    return file.good();
+}
+
+/**
+* @brief describe - Hash a range for a later checkpoint
+*
+* @param uint64_t offset
+* @param const uint8_t* data
+* @param uint64_t size
+*
+* @return TransferJournalEntry
+*/
+TransferJournalEntry TransferJournal::describe(uint64_t offset, const uint8_t* data, uint64_t size)
+{
+    TransferJournalEntry entry = { offset, size, xxhash64(data, size) };
+
+    return entry;
+}
+
+/**
+* @brief verify - Check data against a recorded range
+*
+* @param TransferJournalEntry& entry
+* @param const uint8_t* data
+* @param uint64_t size
+*
+* @return bool
+*/
+bool TransferJournal::verify(TransferJournalEntry& entry, const uint8_t* data, uint64_t size)
+{
+    return size == entry.size && xxhash64(data, size) == entry.hash;
+}
+
+/**
+* @brief rollback - Forget the last completed range
+*
+* @return bool
+*/
+bool TransferJournal::rollback()
+{
+    if (entries.size()) {
+        entries.pop_back();
+    }
+
+    return rewrite();
+}
+
+/**
+* @brief rollback - Forget every completed range that ends past offset
+*
+* @param uint64_t offset - Offset relative to the transfer start
+*
+* @return bool
+*/
+bool TransferJournal::rollback(uint64_t offset)
+{
+    size_t count = entries.size();
+
+    while (entries.size() && entries.back().offset + entries.back().size > offset) {
+        entries.pop_back();
+    }
+
+    if (count == entries.size()) {
+        return true;
+    }
+
+    return rewrite();
+}
+
+/**
+* @brief remove - Delete the journal, called once the transfer completes
+*/
+void TransferJournal::remove()
+{
+    if (file.is_open()) {
+        file.close();
+    }
+
+    entries.clear();
+
+    ::remove(filePath.c_str());
+}
+
+/**
+* @brief rewrite - Write the header and all entries to a fresh journal
+*
+* @return bool
+*/
+bool TransferJournal::rewrite()
+{
+    if (file.is_open()) {
+        file.close();
+    }
+
+    file.open(filePath.c_str(), std::ios::out | std::ios::trunc);
+
+    if (!file.is_open()) {
+        LOGE("Could not open journal %s\n", filePath.c_str());
+        return false;
+    }
+
+    file << "openpst-journal " << TRANSFER_JOURNAL_VERSION << " " << std::hex << address << std::dec << " " << size << " " << device << "\n";
+
+    for (auto &entry : entries) {
+        file << entry.offset << " " << entry.size << " " << std::hex << entry.hash << std::dec << "\n";
+    }
+
+    file.flush();
+
+    return file.good();
+}
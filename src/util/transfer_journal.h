@@ -0,0 +1,164 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file transfer_journal.h
+* @class TransferJournal
+* @package OpenPST
+* @brief Checkpoint journal for long device transfers so they can be resumed
+*
+* The journal is a small text file. The first line identifies the transfer
+* and the device it was made with, every following line is one completed
+* range and the hash of its data:
+*
+*   openpst-journal <version> <address> <size> <device>
+*   <offset> <size> <hash>
+*
+* A journal only says what reached one device. Resuming with another device
+* would skip ranges it never received, so the device is part of the match.
+*
+* Ranges are in ascending order. A transfer that only touches part of the
+* data, like a differential write, leaves gaps between them.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _UTIL_TRANSFER_JOURNAL_H
+#define _UTIL_TRANSFER_JOURNAL_H
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include "include/definitions.h"
+#include "util/xxhash.h"
+
+#define TRANSFER_JOURNAL_VERSION            2
+#define TRANSFER_JOURNAL_DEFAULT_RANGE_SIZE (1024 * 1024)
+
+namespace OpenPST {
+
+    struct TransferJournalEntry {
+        uint64_t offset;
+        uint64_t size;
+        uint64_t hash;
+    };
+
+    class TransferJournal {
+        public:
+            std::vector<TransferJournalEntry> entries;
+
+            /**
+            * @brief TransferJournal
+            */
+            TransferJournal();
+
+            /**
+            * @brief ~TransferJournal
+            */
+            ~TransferJournal();
+
+            /**
+            * @brief open - Open a journal for a transfer
+            *
+            * An existing journal is kept only if resume is set and it describes the
+            * same address and size, otherwise a new one is started. A matching journal
+            * made with another device is refused and left as it is.
+            *
+            * @param std::string filePath - The journal file
+            * @param uint64_t address - Device address the transfer starts at
+            * @param uint64_t size - Total size of the transfer
+            * @param std::string device - Identifies the device, without whitespace
+            * @param bool resume - Keep completed ranges of a matching journal
+            *
+            * @return bool - false if the journal can not be written, or belongs to another device
+            */
+            bool open(std::string filePath, uint64_t address, uint64_t size, std::string device, bool resume);
+
+            /**
+            * @brief resumeOffset - Offset of the first incomplete byte
+            *
+            * @return uint64_t
+            */
+            uint64_t resumeOffset();
+
+            /**
+            * @brief checkpoint - Record a completed range
+            *
+            * @param uint64_t offset - Offset relative to the transfer start
+            * @param const uint8_t* data - The data of the range
+            * @param uint64_t size
+            *
+            * @return bool
+            */
+            bool checkpoint(uint64_t offset, const uint8_t* data, uint64_t size);
+
+            /**
+            * @brief checkpoint - Record a completed range described earlier, for
+            *                     transfers that only know a range is done later on
+            *
+            * @param TransferJournalEntry& entry
+            *
+            * @return bool
+            */
+            bool checkpoint(const TransferJournalEntry& entry);
+
+            /**
+            * @brief describe - Hash a range for a later checkpoint
+            *
+            * @param uint64_t offset
+            * @param const uint8_t* data
+            * @param uint64_t size
+            *
+            * @return TransferJournalEntry
+            */
+            static TransferJournalEntry describe(uint64_t offset, const uint8_t* data, uint64_t size);
+
+            /**
+            * @brief verify - Check data against a recorded range
+            *
+            * @param TransferJournalEntry& entry
+            * @param const uint8_t* data
+            * @param uint64_t size
+            *
+            * @return bool
+            */
+            bool verify(TransferJournalEntry& entry, const uint8_t* data, uint64_t size);
+
+            /**
+            * @brief rollback - Forget the last completed range
+            *
+            * @return bool
+            */
+            bool rollback();
+
+            /**
+            * @brief rollback - Forget every completed range that ends past offset
+            *
+            * @param uint64_t offset - Offset relative to the transfer start
+            *
+            * @return bool
+            */
+            bool rollback(uint64_t offset);
+
+            /**
+            * @brief remove - Delete the journal, called once the transfer completes
+            */
+            void remove();
+
+        private:
+            std::string filePath;
+            std::ofstream file;
+            uint64_t address;
+            uint64_t size;
+            std::string device;
+
+            /**
+            * @brief rewrite - Write the header and all entries to a fresh journal
+            */
+            bool rewrite();
+    };
+}
+
+#endif // _UTIL_TRANSFER_JOURNAL_H
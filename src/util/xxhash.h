@@ -0,0 +1,20 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file xxhash.h
+* @package OpenPST
+* @brief 64 bit xxHash, used for fast block comparison. Not cryptographic.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+* @see https://github.com/Cyan4973/xxHash
+*/
+
+#ifndef _UTIL_XXHASH_H
+#define _UTIL_XXHASH_H
+
+#include "include/definitions.h"
+#include <stddef.h>
+
+uint64_t xxhash64(const uint8_t* data, size_t size, uint64_t seed = 0);
+
+#endif // _UTIL_XXHASH_H
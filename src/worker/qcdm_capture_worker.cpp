@@ -0,0 +1,248 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file qcdm_capture_worker.cpp
+* @class QcdmCaptureWorker
+* @package OpenPST
+* @brief Handles background capture and decoding of DIAG log, event and message traffic
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "qcdm_capture_worker.h"
+
+using namespace OpenPST;
+
+QcdmCaptureWorker::QcdmCaptureWorker(DmScheduler& scheduler, QcdmCaptureWorkerRequest request, QObject *parent) :
+	scheduler(scheduler),
+	request(request),
+	QThread(parent),
+	cancelled(false)
+{
+
+}
+
+QcdmCaptureWorker::~QcdmCaptureWorker()
+{
+
+}
+
+/**
+* @brief cancel - Stop a capture, or stop showing records when decoding
+*/
+void QcdmCaptureWorker::cancel()
+{
+	cancelled = true;
+}
+
+void QcdmCaptureWorker::run()
+{
+	if (request.type == QcdmCaptureWorkerRequestTypeCapture) {
+		if (!capture()) {
+			return;
+		}
+
+		// stopping the capture is what ended it, what was captured is still decoded
+		cancelled = false;
+	}
+
+	decode();
+}
+
+/**
+* @brief capture - Capture until cancelled, as one bulk job on the scheduler
+*
+* The DmClient reader needs the port to itself for as long as the capture
+* runs, so the job never gives its slice back. Nothing else gets the port
+* until the capture is stopped, and the window keeps the other tabs disabled
+* meanwhile. The masks are set through the client once it is reading, as
+* the device starts streaming right away.
+*
+* @return bool - false if nothing was captured
+*/
+bool QcdmCaptureWorker::capture()
+{
+	QString tmp;
+	bool started = false;
+	bool portStopped = false;
+
+	DmSchedulerJobHandle job = scheduler.submit(kDmSchedulerBulk, [&](DmSchedulerSlice& slice) {
+		DmClient client(slice.port);
+		DmCapture capture(client);
+		int sinceUpdate = 0;
+
+		client.start();
+
+		if (!capture.start(request.filePath)) {
+			client.stop();
+			throw std::runtime_error("Could not open " + request.filePath);
+		}
+
+		started = true;
+
+		configure(client, true);
+
+		while (!slice.isCancelled() && capture.isRunning()) {
+			sleep(QCDM_CAPTURE_WORKER_POLL);
+
+			if ((sinceUpdate += QCDM_CAPTURE_WORKER_POLL) >= QCDM_CAPTURE_WORKER_UPDATE) {
+				sinceUpdate = 0;
+				request.stats = capture.getStats();
+				emit update(request);
+			}
+		}
+
+		portStopped = !capture.isRunning();
+
+		if (!portStopped) {
+			configure(client, false);
+		}
+
+		capture.stop();
+		client.stop();
+
+		request.stats = capture.getStats();
+
+		emit update(request);
+
+		return false;
+	});
+
+	while (!job->wait(QCDM_CAPTURE_WORKER_POLL)) {
+		if (cancelled) {
+			job->cancel();
+		}
+	}
+
+	if (job->getStatus() == kDmSchedulerJobFailed) {
+		emit error(request, tmp.sprintf("Capture failed: %s", job->getError().c_str()));
+		return started;
+	}
+
+	if (!started) {
+		emit error(request, "Capture cancelled before it started");
+		return false;
+	}
+
+	if (portStopped) {
+		emit error(request, "Capture stopped, the port stopped responding");
+	}
+
+	return true;
+}
+
+/**
+* @brief configure - Turn the requested masks on or off through the client
+*
+* A refused mask is reported and the capture goes on with what was accepted.
+*
+* @param DmClient& client
+* @param bool enable
+*/
+void QcdmCaptureWorker::configure(DmClient& client, bool enable)
+{
+	QString tmp;
+	std::vector<std::vector<uint8_t>> requests;
+
+	if (request.logCodes.size()) {
+		if (enable) {
+			requests = QcdmSerial::getLogMaskRequests(request.logCodes);
+		} else {
+			QcdmLogConfigRequest packet = {};
+
+			packet.command		= DIAG_LOG_CONFIG_F;
+			packet.operation	= kQcdmLogConfigDisable;
+
+			requests.push_back(std::vector<uint8_t>((uint8_t*)&packet, (uint8_t*)&packet + sizeof(packet)));
+		}
+	}
+
+	if (request.events) {
+		QcdmEventReportRequest packet = {};
+
+		packet.command	= DIAG_EVENT_REPORT_F;
+		packet.enable	= enable ? 1 : 0;
+
+		requests.push_back(std::vector<uint8_t>((uint8_t*)&packet, (uint8_t*)&packet + sizeof(packet)));
+	}
+
+	if (request.messageMask) {
+		QcdmExtMsgConfigRequest packet = {};
+
+		packet.command		= DIAG_EXT_MSG_CONFIG_F;
+		packet.operation	= kQcdmExtMsgConfigSetAllRtMasks;
+		packet.mask			= enable ? request.messageMask : 0;
+
+		requests.push_back(std::vector<uint8_t>((uint8_t*)&packet, (uint8_t*)&packet + sizeof(packet)));
+	}
+
+	for (auto &packet : requests) {
+		if (packet[0] == DIAG_EVENT_REPORT_F) {
+			// answered with an empty event report, which goes to the subscribers like any other
+			client.send(&packet[0], packet.size());
+			continue;
+		}
+
+		DmClientResponse response = client.call(&packet[0], packet.size());
+
+		if (response.status != kDmClientOk) {
+			emit error(request, tmp.sprintf("Device did not accept command 0x%02X: %s", packet[0],
+				response.status == kDmClientRejected ? "rejected" : "no response"));
+		} else if (packet[0] == DIAG_LOG_CONFIG_F && response.data.size() >= sizeof(QcdmLogConfigResponse)
+			&& reinterpret_cast<QcdmLogConfigResponse*>(&response.data[0])->status != 0) {
+			emit error(request, tmp.sprintf("Log mask for equipment id %d was refused", reinterpret_cast<QcdmLogConfigRequest*>(&packet[0])->equipmentId));
+		}
+	}
+}
+
+/**
+* @brief decode - Decode the file and send the records to the window in timestamp order
+*/
+void QcdmCaptureWorker::decode()
+{
+	QString tmp;
+	QString lines;
+	DmCaptureDecoder decoder;
+	DmCaptureFilter filter = {};
+	std::vector<DmCaptureRecord> records;
+	size_t shown = 0;
+
+	filter.types = kDmCaptureRecordLog | kDmCaptureRecordEvent | kDmCaptureRecordMessage;
+
+	if (!decoder.open(request.filePath) || !decoder.decode(filter, records)) {
+		emit error(request, tmp.sprintf("Error decoding %s", request.filePath.c_str()));
+		return;
+	}
+
+	request.decodeStats = decoder.getStats();
+	request.records = records.size();
+
+	for (auto &record : records) {
+		if (cancelled || shown == QCDM_CAPTURE_WORKER_MAX_RECORDS) {
+			break;
+		}
+
+		switch (record.type) {
+			case kDmCaptureRecordLog:
+				lines.append(tmp.sprintf("%016llX LOG   0x%04X %d bytes\n", (unsigned long long)record.timestamp, record.code, record.size));
+				break;
+			case kDmCaptureRecordEvent:
+				lines.append(tmp.sprintf("%016llX EVENT %6d %d bytes\n", (unsigned long long)record.timestamp, record.code, record.size));
+				break;
+			default:
+				lines.append(tmp.sprintf("%016llX MSG   %6d %s\n", (unsigned long long)record.timestamp, record.code, DmCaptureDecoder::formatMessage(record).c_str()));
+				break;
+		}
+
+		if (++shown % QCDM_CAPTURE_WORKER_RECORDS_PER_UPDATE == 0) {
+			emit decoded(request, lines);
+			lines.clear();
+		}
+	}
+
+	if (lines.length()) {
+		emit decoded(request, lines);
+	}
+
+	emit complete(request);
+}
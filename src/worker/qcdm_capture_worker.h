@@ -0,0 +1,84 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file qcdm_capture_worker.h
+* @class QcdmCaptureWorker
+* @package OpenPST
+* @brief Handles background capture and decoding of DIAG log, event and message traffic
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+#ifndef _WORKER_QCDM_CAPTURE_WORKER_H
+#define _WORKER_QCDM_CAPTURE_WORKER_H
+
+#include <QThread>
+#include "serial/qcdm_serial.h"
+#include "qc/dm_client.h"
+#include "qc/dm_capture.h"
+#include "qc/dm_capture_decoder.h"
+#include "qc/dm_scheduler.h"
+#include "util/sleep.h"
+
+/**
+* How often the worker checks for being stopped while capturing
+*/
+#define QCDM_CAPTURE_WORKER_POLL 50 // ms
+
+/**
+* How often capture counters are sent to the window
+*/
+#define QCDM_CAPTURE_WORKER_UPDATE 500 // ms
+
+/**
+* Decoded records are sent to the window in blocks of this many lines, and
+* only the first QCDM_CAPTURE_WORKER_MAX_RECORDS are shown at all
+*/
+#define QCDM_CAPTURE_WORKER_RECORDS_PER_UPDATE 256
+#define QCDM_CAPTURE_WORKER_MAX_RECORDS 10000
+
+using namespace serial;
+
+namespace OpenPST {
+
+	struct QcdmCaptureWorkerRequest {
+		int type;
+		std::string filePath;
+		std::vector<uint16_t> logCodes;		// log masks turned on for the capture
+		bool events;
+		uint32_t messageMask;				// 0 leaves extended messages off
+		DmCaptureStats stats;
+		DmCaptureDecodeStats decodeStats;
+		size_t records;						// records decoded, shown or not
+	};
+
+	enum QcdmCaptureWorkerRequestType {
+		QcdmCaptureWorkerRequestTypeCapture = 1, // capture until cancelled, then decode the file
+		QcdmCaptureWorkerRequestTypeDecode  = 2, // decode an existing capture or raw HDLC stream
+	};
+
+	class QcdmCaptureWorker : public QThread
+	{
+		Q_OBJECT
+
+		public:
+			QcdmCaptureWorker(DmScheduler& scheduler, QcdmCaptureWorkerRequest request, QObject *parent = 0);
+			~QcdmCaptureWorker();
+			void cancel();
+		protected:
+			DmScheduler& scheduler;
+			QcdmCaptureWorkerRequest request;
+
+			void run() Q_DECL_OVERRIDE;
+			bool cancelled;
+			bool capture();
+			void configure(DmClient& client, bool enable);
+			void decode();
+		signals:
+			void update(QcdmCaptureWorkerRequest request);
+			void decoded(QcdmCaptureWorkerRequest request, QString records);
+			void complete(QcdmCaptureWorkerRequest request);
+			void error(QcdmCaptureWorkerRequest request, QString msg);
+	};
+}
+
+#endif // _WORKER_QCDM_CAPTURE_WORKER_H
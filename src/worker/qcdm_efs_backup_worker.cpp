@@ -0,0 +1,81 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file qcdm_efs_backup_worker.cpp
+* @class QcdmEfsBackupWorker
+* @package OpenPST
+* @brief Handles background processing of EFS directory backups
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "qcdm_efs_backup_worker.h"
+
+using namespace OpenPST;
+
+QcdmEfsBackupWorker::QcdmEfsBackupWorker(DmEfsManager& efsManager, DmScheduler& scheduler, QcdmEfsBackupWorkerRequest request, QObject *parent) :
+    efsManager(efsManager),
+    scheduler(scheduler),
+    request(request),
+    QThread(parent),
+    cancelled(false)
+{
+
+}
+
+QcdmEfsBackupWorker::~QcdmEfsBackupWorker()
+{
+
+}
+
+void QcdmEfsBackupWorker::cancel()
+{
+    cancelled = true;
+}
+
+void QcdmEfsBackupWorker::run()
+{
+    QString tmp;
+    QElapsedTimer updateTimer;
+    DmEfsBackup backup(efsManager);
+    std::unique_ptr<DmSchedulerLease> lease(new DmSchedulerLease(scheduler, kDmSchedulerBulk));
+
+    std::memset(&request.stats, 0x00, sizeof(request.stats));
+
+    updateTimer.start();
+
+    int result = backup.run(request.remotePath, request.localPath, request.incremental, [this, &updateTimer, &lease](const DmEfsBackupStats& stats, const std::string& path) -> bool {
+        request.stats = stats;
+        request.current = path;
+
+        // nothing is in flight between two files, other jobs get the port for a turn
+        lease.reset();
+        lease.reset(new DmSchedulerLease(scheduler, kDmSchedulerBulk));
+
+        if (updateTimer.elapsed() >= QCDM_EFS_BACKUP_UPDATE_INTERVAL) {
+            updateTimer.restart();
+            emit update(request);
+        }
+
+        return !cancelled;
+    });
+
+    lease.reset();
+
+    request.stats = backup.getStats();
+    request.current.clear();
+
+    if (cancelled) {
+        emit error(request, tmp.sprintf("Backup of %s cancelled after %u of %u files", request.remotePath.c_str(),
+            request.stats.added + request.stats.changed + request.stats.unchanged + request.stats.failed, request.stats.files));
+        return;
+    }
+
+    if (result != DmEfsManager::kDmEfsSuccess) {
+        emit error(request, tmp.sprintf("Error saving %s, %u files failed", request.remotePath.c_str(), request.stats.failed));
+        return;
+    }
+
+    emit update(request);
+    emit complete(request);
+}
\ No newline at end of file
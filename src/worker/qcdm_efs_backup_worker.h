@@ -0,0 +1,60 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file qcdm_efs_backup_worker.h
+* @class QcdmEfsBackupWorker
+* @package OpenPST
+* @brief Handles background processing of EFS directory backups
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+#ifndef _WORKER_QCDM_EFS_BACKUP_WORKER_H
+#define _WORKER_QCDM_EFS_BACKUP_WORKER_H
+
+#include <QThread>
+#include <QElapsedTimer>
+#include <memory>
+#include "qc/dm_efs_manager.h"
+#include "qc/dm_efs_backup.h"
+#include "qc/dm_scheduler.h"
+
+/**
+* Least time between progress updates, so a crawl of small files does not flood the UI thread
+*/
+#define QCDM_EFS_BACKUP_UPDATE_INTERVAL 100 // ms
+
+using namespace serial;
+
+namespace OpenPST {
+
+    struct QcdmEfsBackupWorkerRequest {
+        std::string         remotePath;
+        std::string         localPath;
+        bool                incremental;    // false downloads everything
+        std::string         current;        // file being compared
+        DmEfsBackupStats    stats;
+    };
+
+    class QcdmEfsBackupWorker : public QThread
+    {
+        Q_OBJECT
+
+    public:
+        QcdmEfsBackupWorker(DmEfsManager& efsManager, DmScheduler& scheduler, QcdmEfsBackupWorkerRequest request, QObject *parent = 0);
+        ~QcdmEfsBackupWorker();
+        void cancel();
+    protected:
+        DmEfsManager&  efsManager;
+        DmScheduler&   scheduler;
+        QcdmEfsBackupWorkerRequest request;
+
+        void run() Q_DECL_OVERRIDE;
+        bool cancelled;
+    signals:
+        void update(QcdmEfsBackupWorkerRequest request);
+        void complete(QcdmEfsBackupWorkerRequest request);
+        void error(QcdmEfsBackupWorkerRequest request, QString msg);
+    };
+}
+
+#endif // _WORKER_QCDM_EFS_BACKUP_WORKER_H
\ No newline at end of file
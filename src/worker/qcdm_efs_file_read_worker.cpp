@@ -34,5 +34,52 @@ void QcdmEfsFileReadWorker::cancel()
 
 void QcdmEfsFileReadWorker::run()
 {
-    return;
+    QString tmp;
+    QElapsedTimer updateTimer;
+    DmEfsFileReader reader(
+        efsManager,
+        request.window ? request.window : DM_EFS_READ_DEFAULT_WINDOW,
+        request.chunkSize ? request.chunkSize : DM_EFS_READ_DEFAULT_CHUNK_SIZE
+    );
+
+    request.fileSize = 0;
+    request.bytesRead = 0;
+    request.throughput = 0;
+    request.elapsed = 0;
+
+    updateTimer.start();
+
+    int result = reader.read(request.remotePath, request.localPath, [this, &updateTimer](const DmEfsFileReadStats& stats) -> bool {
+        request.fileSize = stats.fileSize;
+        request.bytesRead = stats.bytesRead;
+        request.throughput = stats.throughput;
+        request.elapsed = stats.elapsed;
+
+        if (updateTimer.elapsed() >= QCDM_EFS_FILE_READ_UPDATE_INTERVAL) {
+            updateTimer.restart();
+            emit update(request);
+        }
+
+        return !cancelled;
+    });
+
+    DmEfsFileReadStats stats = reader.getStats();
+
+    request.fileSize = stats.fileSize;
+    request.bytesRead = stats.bytesRead;
+    request.throughput = stats.throughput;
+    request.elapsed = stats.elapsed;
+
+    if (cancelled) {
+        emit error(request, tmp.sprintf("Read of %s cancelled after %u bytes", request.remotePath.c_str(), request.bytesRead));
+        return;
+    }
+
+    if (result != DmEfsManager::kDmEfsSuccess) {
+        emit error(request, tmp.sprintf("Error reading %s at %u of %u bytes", request.remotePath.c_str(), request.bytesRead, request.fileSize));
+        return;
+    }
+
+    emit update(request);
+    emit complete(request);
 }
\ No newline at end of file
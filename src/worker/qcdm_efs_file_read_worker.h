@@ -12,7 +12,14 @@
 #define _WORKER_QCDM_EFS_FILE_READ_WORKER_H
 
 #include <QThread>
+#include <QElapsedTimer>
 #include "qc/dm_efs_manager.h"
+#include "qc/dm_efs_file_reader.h"
+
+/**
+* Least time between progress updates, so a fast read does not flood the UI thread
+*/
+#define QCDM_EFS_FILE_READ_UPDATE_INTERVAL 100 // ms
 
 using namespace serial;
 
@@ -21,6 +28,12 @@ namespace OpenPST {
     struct QcdmEfsFileReadWorkerRequest {
         std::string remotePath;
         std::string localPath;
+        size_t      window;         // reads in flight, 0 for DM_EFS_READ_DEFAULT_WINDOW
+        size_t      chunkSize;      // bytes per read, 0 for DM_EFS_READ_DEFAULT_CHUNK_SIZE
+        uint32_t    fileSize;
+        uint32_t    bytesRead;
+        uint32_t    throughput;     // bytes per second
+        qint64      elapsed;        // ms
     };
 
     class QcdmEfsFileReadWorker : public QThread
@@ -13,8 +13,9 @@
 
 using namespace OpenPST;
 
-QcdmEfsFileWriteWorker::QcdmEfsFileWriteWorker(DmEfsManager& efsManager, QcdmEfsFileWriteWorkerRequest request, QObject *parent) :
+QcdmEfsFileWriteWorker::QcdmEfsFileWriteWorker(DmEfsManager& efsManager, DmScheduler& scheduler, QcdmEfsFileWriteWorkerRequest request, QObject *parent) :
     efsManager(efsManager),
+    scheduler(scheduler),
     request(request),
     QThread(parent),
     cancelled(false)
@@ -34,5 +35,66 @@ void QcdmEfsFileWriteWorker::cancel()
 
 void QcdmEfsFileWriteWorker::run()
 {
-    return;
+    QString tmp;
+    QElapsedTimer updateTimer;
+    DmEfsFileWriter writer(
+        efsManager,
+        request.window ? request.window : DM_EFS_WRITE_DEFAULT_WINDOW,
+        request.chunkSize ? request.chunkSize : DM_EFS_WRITE_MAX_CHUNK_SIZE
+    );
+
+    request.fileSize = 0;
+    request.bytesWritten = 0;
+    request.throughput = 0;
+    request.elapsed = 0;
+    request.verified = false;
+
+    updateTimer.start();
+
+    int result;
+
+    // writes stay in flight across progress callbacks, so the port is held for the whole file
+    {
+        DmSchedulerLease lease(scheduler, kDmSchedulerBulk);
+
+        result = writer.write(request.localPath, request.remotePath, request.verify, [this, &updateTimer](const DmEfsFileWriteStats& stats) -> bool {
+            request.fileSize = stats.fileSize;
+            request.bytesWritten = stats.bytesWritten;
+            request.throughput = stats.throughput;
+            request.elapsed = stats.elapsed;
+
+            if (updateTimer.elapsed() >= QCDM_EFS_FILE_WRITE_UPDATE_INTERVAL) {
+                updateTimer.restart();
+                emit update(request);
+            }
+
+            return !cancelled;
+        });
+    }
+
+    DmEfsFileWriteStats stats = writer.getStats();
+
+    request.fileSize = stats.fileSize;
+    request.bytesWritten = stats.bytesWritten;
+    request.throughput = stats.throughput;
+    request.elapsed = stats.elapsed;
+    request.verified = stats.verified;
+
+    if (cancelled) {
+        emit error(request, tmp.sprintf("Write of %s cancelled after %u bytes", request.remotePath.c_str(), request.bytesWritten));
+        return;
+    }
+
+    if (result != DmEfsManager::kDmEfsSuccess) {
+        if (request.verify && request.bytesWritten == request.fileSize) {
+            emit error(request, tmp.sprintf("%s was written but does not match %s", request.remotePath.c_str(), request.localPath.c_str()));
+        } else {
+            emit error(request, tmp.sprintf("Error writing %s at %u of %u bytes", request.remotePath.c_str(), request.bytesWritten, request.fileSize));
+        }
+
+        return;
+    }
+
+    emit update(request);
+    emit complete(request);
 }
\ No newline at end of file
@@ -12,14 +12,31 @@
 #define _WORKER_QCDM_EFS_FILE_WRITE_WORKER_H
 
 #include <QThread>
+#include <QElapsedTimer>
 #include "qc/dm_efs_manager.h"
+#include "qc/dm_efs_file_writer.h"
+#include "qc/dm_scheduler.h"
+
+/**
+* Least time between progress updates, so a fast write does not flood the UI thread
+*/
+#define QCDM_EFS_FILE_WRITE_UPDATE_INTERVAL 100 // ms
 
 using namespace serial;
 
 namespace OpenPST {
 
     struct QcdmEfsFileWriteWorkerRequest {
-
+        std::string localPath;
+        std::string remotePath;
+        size_t      window;         // writes in flight, 0 for DM_EFS_WRITE_DEFAULT_WINDOW
+        size_t      chunkSize;      // bytes per write, 0 for DM_EFS_WRITE_MAX_CHUNK_SIZE
+        bool        verify;         // compare md5 sums once written
+        uint32_t    fileSize;
+        uint32_t    bytesWritten;
+        uint32_t    throughput;     // bytes per second
+        qint64      elapsed;        // ms
+        bool        verified;
     };
 
     class QcdmEfsFileWriteWorker : public QThread
@@ -27,11 +44,12 @@ namespace OpenPST {
         Q_OBJECT
 
     public:
-        QcdmEfsFileWriteWorker(DmEfsManager& efsManager, QcdmEfsFileWriteWorkerRequest request, QObject *parent = 0);
+        QcdmEfsFileWriteWorker(DmEfsManager& efsManager, DmScheduler& scheduler, QcdmEfsFileWriteWorkerRequest request, QObject *parent = 0);
         ~QcdmEfsFileWriteWorker();
         void cancel();
     protected:
         DmEfsManager&  efsManager;
+        DmScheduler&   scheduler;
         QcdmEfsFileWriteWorkerRequest request;
 
         void run() Q_DECL_OVERRIDE;
@@ -13,8 +13,8 @@
 
 using namespace OpenPST;
 
-QcdmMemoryReadWorker::QcdmMemoryReadWorker(QcdmSerial& port, QcdmMemoryReadWorkerRequest request, QObject *parent) :
-    port(port),
+QcdmMemoryReadWorker::QcdmMemoryReadWorker(DmScheduler& scheduler, QcdmMemoryReadWorkerRequest request, QObject *parent) :
+    scheduler(scheduler),
     request(request),
     QThread(parent),
     cancelled(false)
@@ -32,7 +32,96 @@ void QcdmMemoryReadWorker::cancel()
     cancelled = true;
 }
 
+/**
+* @brief run - Read the range as a bulk job on the scheduler
+*
+* Chunks are read on the scheduler thread until the slice budget is used, so
+* interactive commands get the port in between. Every chunk read leaves no
+* peek in flight, so a slice can end after any of them.
+*/
 void QcdmMemoryReadWorker::run()
 {
-    return;
+    QString tmp;
+    QElapsedTimer timer;
+    QElapsedTimer updateTimer;
+    size_t window = request.window ? request.window : DM_MEMORY_READ_DEFAULT_WINDOW;
+    std::vector<uint8_t> chunk(QCDM_MEMORY_READ_CHUNK_SIZE);
+
+    timer.start();
+    updateTimer.start();
+
+    request.outSize = 0;
+    request.unreadable = 0;
+    request.failures.clear();
+
+    std::ofstream file(request.outFilePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open()) {
+        emit error(request, tmp.sprintf("Error opening %s for writing", request.outFilePath.c_str()));
+        return;
+    }
+
+    DmSchedulerJobHandle job = scheduler.submit(kDmSchedulerBulk, [&](DmSchedulerSlice& slice) {
+        QString status;
+        DmMemoryReader reader(slice.port, window);
+
+        do {
+            uint32_t size = request.size - request.outSize < chunk.size() ? request.size - request.outSize : (uint32_t)chunk.size();
+            uint32_t address = request.address + request.outSize;
+
+            if (!reader.read(address, size, &chunk[0])) {
+                throw std::runtime_error(status.sprintf("Error reading %u bytes starting from 0x%08X", size, address).toStdString());
+            }
+
+            file.write((char*)&chunk[0], size);
+
+            if (!file.good()) {
+                throw std::runtime_error(status.sprintf("Error writing to %s", request.outFilePath.c_str()).toStdString());
+            }
+
+            request.outSize += size;
+
+            // a signal per chunk would queue faster than the UI repaints on a fast link
+            if (updateTimer.elapsed() >= QCDM_MEMORY_READ_UPDATE_INTERVAL) {
+                updateTimer.restart();
+                emit update(request);
+            }
+        } while (request.outSize < request.size && !slice.isExpired() && !slice.isCancelled());
+
+        // a range left unreadable may carry on into the next slice
+        for (auto& failure : reader.getFailures()) {
+            if (request.failures.size() && (uint64_t)request.failures.back().address + request.failures.back().size == failure.address) {
+                request.failures.back().size += failure.size;
+            } else {
+                request.failures.push_back(failure);
+            }
+
+            request.unreadable += failure.size;
+        }
+
+        return request.outSize < request.size && !slice.isCancelled();
+    });
+
+    while (!job->wait(QCDM_MEMORY_READ_WORKER_POLL)) {
+        if (cancelled) {
+            job->cancel();
+        }
+    }
+
+    file.close();
+
+    request.elapsed = timer.elapsed();
+
+    switch (job->getStatus()) {
+        case kDmSchedulerJobDone:
+            emit update(request);
+            emit complete(request);
+            break;
+        case kDmSchedulerJobFailed:
+            emit error(request, QString::fromStdString(job->getError()));
+            break;
+        default:
+            emit error(request, tmp.sprintf("Memory read cancelled after %u of %u bytes", request.outSize, request.size));
+            break;
+    }
 }
\ No newline at end of file
@@ -13,14 +13,40 @@
 #define _WORKER_QCDM_MEMORY_READ_WORKER_H
 
 #include <QThread>
+#include <QElapsedTimer>
+#include <fstream>
 #include "serial/qcdm_serial.h"
+#include "qc/dm_memory_reader.h"
+#include "qc/dm_scheduler.h"
+
+/**
+* Bytes read from the device before each write to the file
+*/
+#define QCDM_MEMORY_READ_CHUNK_SIZE 4096
+
+/**
+* Least time between progress updates, so a fast read does not flood the UI thread
+*/
+#define QCDM_MEMORY_READ_UPDATE_INTERVAL 100 // ms
+
+/**
+* How often the worker checks for being cancelled while its job runs
+*/
+#define QCDM_MEMORY_READ_WORKER_POLL 50 // ms
 
 using namespace serial;
 
 namespace OpenPST {
 
     struct QcdmMemoryReadWorkerRequest {
-
+        uint32_t        address;
+        uint32_t        size;
+        size_t          window;         // peeks in flight, 0 for DM_MEMORY_READ_DEFAULT_WINDOW
+        std::string     outFilePath;
+        uint32_t        outSize;        // bytes read and written so far
+        uint32_t        unreadable;     // bytes no peek could read, written as zero
+        std::vector<DmMemoryReadFailure> failures;
+        qint64          elapsed;        // ms
     };
 
     class QcdmMemoryReadWorker : public QThread
@@ -28,11 +54,11 @@ namespace OpenPST {
         Q_OBJECT
 
     public:
-        QcdmMemoryReadWorker(QcdmSerial& port, QcdmMemoryReadWorkerRequest request, QObject *parent = 0);
+        QcdmMemoryReadWorker(DmScheduler& scheduler, QcdmMemoryReadWorkerRequest request, QObject *parent = 0);
         ~QcdmMemoryReadWorker();
         void cancel();
     protected:
-        QcdmSerial&  port;
+        DmScheduler& scheduler;
         QcdmMemoryReadWorkerRequest request;
 
         void run() Q_DECL_OVERRIDE;
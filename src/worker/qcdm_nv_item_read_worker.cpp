@@ -13,8 +13,9 @@
 
 using namespace OpenPST;
 
-QcdmNvItemReadWorker::QcdmNvItemReadWorker(QcdmSerial& port, QcdmNvItemReadWorkerRequest request, QObject *parent) :
+QcdmNvItemReadWorker::QcdmNvItemReadWorker(QcdmSerial& port, DmScheduler& scheduler, QcdmNvItemReadWorkerRequest request, QObject *parent) :
 	port(port),
+	scheduler(scheduler),
     request(request),
     QThread(parent),
     cancelled(false)
@@ -34,6 +35,11 @@ void QcdmNvItemReadWorker::cancel()
 
 void QcdmNvItemReadWorker::run()
 {
+	if (request.sparsityMapPath.length()) {
+		sparsityMap = DmNvSparsityMap(request.model);
+		sparsityMap.load(request.sparsityMapPath);
+	}
+
 	if ((request.type != QcdmNvItemReadWorkerRequestTypeLog && request.outFilePath.length())) {
 		return doFileRun();
 	} else {
@@ -45,86 +51,174 @@ void QcdmNvItemReadWorker::doFileRun()
 {
 	QString nvHexHeading;
 	QString nvHex; 
-	QcdmNvResponse nvItem;
+	QcdmNvResponse nvItem = {};
 	QcdmNvItemReadWorkerResponse response = {};
+	DmNvBackupWriter backup;
+	std::ofstream file;
 
-	std::ofstream file(request.outFilePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if (request.type == QcdmNvItemReadWorkerRequestTypeBinary) {
+		DmNvBackupDeviceInfo device = {};
 
-	if (!file.is_open()) {
-		emit error(request, "Error opening file for writing");
-		return;
+		getDeviceInfo(device);
+
+		if (!backup.open(request.outFilePath, device)) {
+			emit error(request, "Error opening file for writing");
+			return;
+		}
+	} else {
+		file.open(request.outFilePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+		if (!file.is_open()) {
+			emit error(request, "Error opening file for writing");
+			return;
+		}
 	}
 
 	response.type = request.type;
+	nvItem.command = DIAG_NV_READ_F;
 
-	for (auto item : request.items) {
+	bool done = readItems([&](const DmNvBulkResult& result) {
+		request.current = result.item;
+		response.item	= result.item;
 
-		if (cancelled) {
-			return;
+		sparsityMap.record(result);
+
+		if (request.type == QcdmNvItemReadWorkerRequestTypeBinary) {
+			// failed items are kept in the backup with their status
+			backup.add(result);
 		}
 
-		request.current = item;
-		response.item	= item;
+		if (result.status != kDmNvBulkOk) {
+			emit error(request, QString::fromStdString(DmNvBulkReader::getStatusString(result)));
 
-		try {
-			nvItem = port.readNV(item);
-		} catch (std::exception e) {
-			emit error(request, e.what());
-			
 			if (request.type == QcdmNvItemReadWorkerRequestTypeText) {
-				nvHexHeading.sprintf("========\nError Reading Item %d\n========\n", nvItem.nvItem);			
+				nvHexHeading.sprintf("========\nError Reading Item %d\n========\n", result.item);
 				file.write(nvHexHeading.toStdString().c_str(), nvHexHeading.size());
-				continue;
 			}
+
+			return;
 		}
 
-		std::memcpy(response.data, nvItem.data, sizeof(nvItem.data));
+		nvItem.nvItem = result.item;
+		std::memcpy(nvItem.data, result.data, sizeof(nvItem.data));
+		std::memcpy(response.data, result.data, sizeof(result.data));
 
 		if (request.type == QcdmNvItemReadWorkerRequestTypeText) {
 			nvHexHeading.sprintf("========\nItem %d\n========\n", nvItem.nvItem);
+			nvHex.clear();
 			hexdump(nvItem.data, sizeof(nvItem.data), nvHex, false);
 			file.write(nvHexHeading.toStdString().c_str(), nvHexHeading.size());
 			file.write(nvHex.toStdString().c_str(), nvHex.size());
-		} else {
-			file.write((char*)&nvItem, sizeof(nvItem));
 		}
 
 		emit update(response);
-	}
+	});
 
-	file.close();
+	if (!done) {
+		return;
+	}
 
-	emit complete(request);
+	if (request.type == QcdmNvItemReadWorkerRequestTypeBinary) {
+		if (!backup.close()) {
+			emit error(request, "Error writing the NV backup");
+			return;
+		}
+	} else {
+		file.close();
+	}
 
+	saveSparsityMap();
 
-		
+	emit complete(request);
 }
 
 void QcdmNvItemReadWorker::doLogRun()
 {
-	QcdmNvResponse nvItem;
 	QcdmNvItemReadWorkerResponse response = {};
 
-	for (auto item : request.items) {
-
-		if (cancelled) {
-			return;
-		}
+	bool done = readItems([&](const DmNvBulkResult& result) {
+		request.current = result.item;
+		response.item = result.item;
 
-		request.current = item;
-		response.item = item;
+		sparsityMap.record(result);
 
-		try {
-			nvItem = port.readNV(item);
-		} catch (std::exception e) {
-			emit error(request, e.what());
-			continue;
+		if (result.status != kDmNvBulkOk) {
+			emit error(request, QString::fromStdString(DmNvBulkReader::getStatusString(result)));
+			return;
 		}
 
-		std::memcpy(response.data, nvItem.data, sizeof(nvItem.data));
+		std::memcpy(response.data, result.data, sizeof(result.data));
 
 		emit update(response);
+	});
+
+	if (!done) {
+		return;
 	}
 
+	saveSparsityMap();
+
 	emit complete(request);
+}
+
+void QcdmNvItemReadWorker::getDeviceInfo(DmNvBackupDeviceInfo& device)
+{
+	QString tmp;
+	QcdmVersionResponse version;
+	QcdmNvResponse nvItem;
+	DmSchedulerLease lease(scheduler, kDmSchedulerBulk);
+
+	// best effort, a backup without the device details is still a backup
+	try {
+		version = port.getVersion();
+		device.firmware = tmp.sprintf("%.8s %.11s %.8s", version.ver_dir, version.cdate, version.ctime).toStdString();
+	} catch (std::exception e) {}
+
+	try {
+		nvItem = port.readNV(NV_ESN_I);
+		std::memcpy(&device.esn, nvItem.data, sizeof(device.esn));
+	} catch (std::exception e) {}
+
+	try {
+		nvItem = port.readNV(NV_MEID_I);
+		std::memcpy(&device.meid, nvItem.data, 7);
+	} catch (std::exception e) {}
+}
+
+void QcdmNvItemReadWorker::saveSparsityMap()
+{
+	if (!request.sparsityMapPath.length()) {
+		return;
+	}
+
+	sparsityMap.finishSweep();
+	sparsityMap.save(request.sparsityMapPath);
+}
+
+/**
+* @brief readItems - Read the requested items as a bulk job on the scheduler
+*
+* The callback runs on the scheduler thread, one slice at a time, so
+* interactive commands get the port in between.
+*
+* @return bool - false if the read was cancelled or failed
+*/
+bool QcdmNvItemReadWorker::readItems(std::function<void(const DmNvBulkResult& result)> callback)
+{
+	QString tmp;
+	DmSchedulerJobHandle job = scheduler.submit(kDmSchedulerBulk, DmScheduler::nvReadTask(
+		request.items, request.window ? request.window : DM_NV_BULK_DEFAULT_WINDOW, callback
+	));
+
+	while (!job->wait(QCDM_NV_ITEM_READ_WORKER_POLL)) {
+		if (cancelled) {
+			job->cancel();
+		}
+	}
+
+	if (job->getStatus() == kDmSchedulerJobFailed) {
+		emit error(request, tmp.sprintf("NV read failed: %s", job->getError().c_str()));
+	}
+
+	return job->getStatus() == kDmSchedulerJobDone;
 }
\ No newline at end of file
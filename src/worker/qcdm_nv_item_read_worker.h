@@ -13,8 +13,18 @@
 
 #include <QThread>
 #include "serial/qcdm_serial.h"
+#include "qc/dm_nv_bulk_reader.h"
+#include "qc/dm_nv_backup.h"
+#include "qc/dm_nv_sparsity_map.h"
+#include "qc/dm_scheduler.h"
 #include <iostream>
 #include <fstream>
+#include <functional>
+
+/**
+* How often the worker checks for being cancelled while its job runs
+*/
+#define QCDM_NV_ITEM_READ_WORKER_POLL 50 // ms
 
 using namespace serial;
 
@@ -25,6 +35,9 @@ namespace OpenPST {
 		std::vector<uint16_t> items;
 		std::string outFilePath;
 		uint16_t current;
+		size_t window; // requests kept in flight, 0 for DM_NV_BULK_DEFAULT_WINDOW
+		std::string model; // model key of the device
+		std::string sparsityMapPath; // results are recorded here when set
     };
 
 	struct QcdmNvItemReadWorkerResponse {
@@ -44,17 +57,22 @@ namespace OpenPST {
 		Q_OBJECT
 
 		public:
-			QcdmNvItemReadWorker(QcdmSerial& port, QcdmNvItemReadWorkerRequest request, QObject *parent = 0);
+			QcdmNvItemReadWorker(QcdmSerial& port, DmScheduler& scheduler, QcdmNvItemReadWorkerRequest request, QObject *parent = 0);
 			~QcdmNvItemReadWorker();
 			void cancel();
 		protected:
 			QcdmSerial&  port;
+			DmScheduler& scheduler;
 			QcdmNvItemReadWorkerRequest request;
+			DmNvSparsityMap sparsityMap;
 
 			void run() Q_DECL_OVERRIDE;
 			bool cancelled;
 			void doFileRun();
 			void doLogRun();
+			void getDeviceInfo(DmNvBackupDeviceInfo& device);
+			void saveSparsityMap();
+			bool readItems(std::function<void(const DmNvBulkResult& result)> callback);
 		signals:
 			void update(QcdmNvItemReadWorkerResponse request);
 			void complete(QcdmNvItemReadWorkerRequest request);
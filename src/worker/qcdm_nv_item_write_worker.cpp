@@ -0,0 +1,167 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file qcdm_nv_item_write_worker.cpp
+* @class QcdmNvItemWriteWorker
+* @package OpenPST
+* @brief Handles background processing of NV item writing
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "qcdm_nv_item_write_worker.h"
+
+using namespace OpenPST;
+
+QcdmNvItemWriteWorker::QcdmNvItemWriteWorker(QcdmSerial& port, DmScheduler& scheduler, QcdmNvItemWriteWorkerRequest request, QObject *parent) :
+	port(port),
+	scheduler(scheduler),
+	request(request),
+	QThread(parent),
+	cancelled(false)
+{
+
+}
+
+QcdmNvItemWriteWorker::~QcdmNvItemWriteWorker()
+{
+
+}
+
+void QcdmNvItemWriteWorker::cancel()
+{
+	cancelled = true;
+}
+
+/**
+* @brief run - Write the items as a bulk job on the scheduler
+*
+* Batches run on the scheduler thread until the slice budget is used, so
+* interactive commands get the port in between. A rollback batch has to be
+* written in one go and holds the port until it is done.
+*/
+void QcdmNvItemWriteWorker::run()
+{
+	QString tmp;
+	std::vector<DmNvWriteItem> items;
+	size_t window = request.window ? request.window : DM_NV_BULK_DEFAULT_WINDOW;
+
+	request.done = 0;
+	request.failed = 0;
+	request.rolledBack = 0;
+
+	if (!loadItems(items)) {
+		return;
+	}
+
+	request.total = items.size();
+
+	emit update(request);
+
+	DmSchedulerJobHandle job = scheduler.submit(kDmSchedulerBulk, [&](DmSchedulerSlice& slice) {
+		QString status;
+		DmNvBatchWriter writer(slice.port, window);
+
+		do {
+			size_t remaining = items.size() - request.done;
+			size_t count = request.rollback || remaining < QCDM_NV_ITEM_WRITE_BATCH_SIZE ? remaining : QCDM_NV_ITEM_WRITE_BATCH_SIZE;
+			std::vector<DmNvWriteItem> batch(items.begin() + request.done, items.begin() + request.done + count);
+
+			for (auto &result : writer.write(batch, request.rollback)) {
+				request.current = result.item;
+				request.done++;
+
+				if (result.rolledBack) {
+					request.rolledBack++;
+				}
+
+				if (result.status != kDmNvWriteOk) {
+					request.failed++;
+					emit error(request, status.sprintf("Error writing item %d: %s", result.item, DmNvBatchWriter::getStatusString(result).c_str()));
+				}
+			}
+
+			emit update(request);
+		} while (request.done < items.size() && !slice.isExpired() && !slice.isCancelled());
+
+		return request.done < items.size() && !slice.isCancelled();
+	});
+
+	while (!job->wait(QCDM_NV_ITEM_WRITE_WORKER_POLL)) {
+		if (cancelled) {
+			job->cancel();
+		}
+	}
+
+	switch (job->getStatus()) {
+		case kDmSchedulerJobDone:
+			emit complete(request);
+			break;
+		case kDmSchedulerJobFailed:
+			emit error(request, tmp.sprintf("NV write failed: %s", job->getError().c_str()));
+			break;
+		default:
+			emit error(request, tmp.sprintf("NV write cancelled after %lu of %lu items", request.done, request.total));
+			break;
+	}
+}
+
+/**
+* @brief loadItems - Read the items to write from a backup or a text dump
+*
+* Both are what the NV read worker writes. Items it could not read are
+* skipped, there is nothing to write for them.
+*
+* @return bool - false if the file could not be read
+*/
+bool QcdmNvItemWriteWorker::loadItems(std::vector<DmNvWriteItem>& items)
+{
+	QString tmp;
+	DmNvBackupReader backup;
+	DmNvBulkResult result;
+	std::string backupPath = request.inFilePath;
+
+	if (request.type == QcdmNvItemWriteWorkerRequestTypeText) {
+		DmNvBackupDeviceInfo device = {};
+
+		backupPath = QDir::temp().filePath("openpst_nv_write.bin").toStdString();
+
+		if (!DmNvBackup::fromText(request.inFilePath, backupPath, device)) {
+			emit error(request, tmp.sprintf("Error reading %s", request.inFilePath.c_str()));
+			return false;
+		}
+	}
+
+	if (!backup.open(backupPath)) {
+		emit error(request, tmp.sprintf("Error reading %s", request.inFilePath.c_str()));
+		return false;
+	}
+
+	items.reserve(backup.getItemCount());
+
+	for (size_t i = 0; i < backup.getItemCount(); i++) {
+		const DmNvBackupIndexEntry* entry = backup.getEntry(i);
+		DmNvWriteItem item = {};
+
+		if (entry->status != kDmNvBulkOk) {
+			continue;
+		}
+
+		backup.read(entry, result);
+
+		item.item = result.item;
+		item.size = DIAG_NV_ITEM_SIZE;
+
+		std::memcpy(item.data, result.data, sizeof(item.data));
+
+		items.push_back(item);
+	}
+
+	backup.close();
+
+	if (request.type == QcdmNvItemWriteWorkerRequestTypeText) {
+		std::remove(backupPath.c_str());
+	}
+
+	return true;
+}
@@ -0,0 +1,75 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file qcdm_nv_item_write_worker.h
+* @class QcdmNvItemWriteWorker
+* @package OpenPST
+* @brief Handles background processing of NV item writing
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+#ifndef _WORKER_QCDM_NV_ITEM_WRITE_WORKER_H
+#define _WORKER_QCDM_NV_ITEM_WRITE_WORKER_H
+
+#include <QThread>
+#include <QDir>
+#include "serial/qcdm_serial.h"
+#include "qc/dm_nv_batch_writer.h"
+#include "qc/dm_nv_backup.h"
+#include "qc/dm_scheduler.h"
+
+/**
+* Items written and verified per batch, a slice runs batches until its budget is used
+*/
+#define QCDM_NV_ITEM_WRITE_BATCH_SIZE 32
+
+/**
+* How often the worker checks for being cancelled while its job runs
+*/
+#define QCDM_NV_ITEM_WRITE_WORKER_POLL 50 // ms
+
+using namespace serial;
+
+namespace OpenPST {
+
+	struct QcdmNvItemWriteWorkerRequest {
+		int type;
+		std::string inFilePath;
+		size_t window;		// requests kept in flight, 0 for DM_NV_BULK_DEFAULT_WINDOW
+		bool rollback;		// restore every item if any fails, the whole file goes in one batch
+		uint16_t current;
+		size_t total;		// items in the file that were read without error
+		size_t done;		// items sent, whatever the result
+		size_t failed;
+		size_t rolledBack;
+	};
+
+	enum QcdmNvItemWriteWorkerRequestType {
+		QcdmNvItemWriteWorkerRequestTypeText   = 1,
+		QcdmNvItemWriteWorkerRequestTypeBinary = 2,
+	};
+
+	class QcdmNvItemWriteWorker : public QThread
+	{
+		Q_OBJECT
+
+		public:
+			QcdmNvItemWriteWorker(QcdmSerial& port, DmScheduler& scheduler, QcdmNvItemWriteWorkerRequest request, QObject *parent = 0);
+			~QcdmNvItemWriteWorker();
+			void cancel();
+		protected:
+			QcdmSerial&  port;
+			DmScheduler& scheduler;
+			QcdmNvItemWriteWorkerRequest request;
+
+			void run() Q_DECL_OVERRIDE;
+			bool cancelled;
+			bool loadItems(std::vector<DmNvWriteItem>& items);
+		signals:
+			void update(QcdmNvItemWriteWorkerRequest request);
+			void complete(QcdmNvItemWriteWorkerRequest request);
+			void error(QcdmNvItemWriteWorkerRequest request, QString msg);
+	};
+}
+
+#endif // _WORKER_QCDM_NV_ITEM_WRITE_WORKER_H
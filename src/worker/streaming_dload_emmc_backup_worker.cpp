@@ -0,0 +1,306 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file streaming_dload_emmc_backup_worker.cpp
+* @class StreamingDloadEmmcBackupWorker
+* @package OpenPST
+* @brief Handles background processing of a GPT driven eMMC user partition backup
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "streaming_dload_emmc_backup_worker.h"
+
+using namespace OpenPST;
+
+StreamingDloadEmmcBackupWorker::StreamingDloadEmmcBackupWorker(StreamingDloadSerial& port, StreamingDloadEmmcBackupWorkerRequest request, QObject *parent) :
+    port(port),
+    request(request),
+    QThread(parent)
+{
+    cancelled = false;
+}
+
+StreamingDloadEmmcBackupWorker::~StreamingDloadEmmcBackupWorker()
+{
+
+}
+
+void StreamingDloadEmmcBackupWorker::cancel()
+{
+    cancelled = true;
+}
+
+void StreamingDloadEmmcBackupWorker::run()
+{
+    QString tmp;
+    GptTable gpt;
+    bool opened = false;
+
+    request.totalSize = 0;
+    request.outSize = 0;
+    request.current = 0;
+    request.partitions.clear();
+
+    if (port.state.openMultiMode != STREAMING_DLOAD_OPEN_MULTI_MODE_EMMC_USER) {
+        if (port.openMultiImage(STREAMING_DLOAD_OPEN_MULTI_MODE_EMMC_USER) != kStreamingDloadSuccess) {
+            emit error(request, "Error opening multi image mode for the eMMC user partition");
+            return;
+        }
+
+        opened = true;
+    }
+
+    if (!readTable(gpt, tmp) || !writeLayout(tmp)) {
+        if (opened) {
+            port.closeMode();
+        }
+
+        emit error(request, tmp);
+        return;
+    }
+
+    for (; request.current < request.partitions.size() && !cancelled; request.current++) {
+        StreamingDloadEmmcBackupPartition& entry = request.partitions[request.current];
+
+        if (entry.skipped) {
+            continue;
+        }
+
+        if (!dumpPartition(entry, tmp)) {
+            if (opened) {
+                port.closeMode();
+            }
+
+            emit error(request, tmp);
+            return;
+        }
+
+        emit partitionComplete(request);
+    }
+
+    if (opened) {
+        port.closeMode();
+    }
+
+    if (cancelled) {
+        emit error(request, tmp.sprintf("eMMC backup cancelled after %llu of %llu bytes, the backup is incomplete",
+            (unsigned long long)request.outSize, (unsigned long long)request.totalSize));
+        return;
+    }
+
+    emit complete(request);
+}
+
+/**
+* @brief readTable - Read the primary GPT, save it and build the partition list
+*
+* @param GptTable& gpt
+* @param QString& message - Set on error
+*
+* @return bool
+*/
+bool StreamingDloadEmmcBackupWorker::readTable(GptTable& gpt, QString& message)
+{
+    std::vector<uint8_t> buffer;
+    uint64_t sectorSize = STREAMING_DLOAD_SECTOR_SIZE;
+
+    if (port.readAddress(GPT_HEADER_LBA * sectorSize, sectorSize, buffer, request.stepSize) != kStreamingDloadSuccess || buffer.size() < sectorSize) {
+        message = "Error reading the GPT header";
+        return false;
+    }
+
+    if (!gpt.parseHeader(&buffer[0], buffer.size())) {
+        message.sprintf("Error parsing the GPT header: %s", gpt.lastError.c_str());
+        return false;
+    }
+
+    // the primary GPT is everything from the protective MBR to the end of the entry array
+    uint64_t entriesOffset = gpt.header.partitionEntryLba * sectorSize;
+    uint64_t tableSize = entriesOffset + gpt.getEntriesSize();
+
+    tableSize = ((tableSize + sectorSize - 1) / sectorSize) * sectorSize;
+
+    if (gpt.header.partitionEntryLba <= GPT_HEADER_LBA || tableSize > gpt.header.firstUsableLba * sectorSize) {
+        message = "GPT partition entries are outside of the table area";
+        return false;
+    }
+
+    if (port.readAddress(0, tableSize, buffer, request.stepSize) != kStreamingDloadSuccess || buffer.size() < tableSize) {
+        message.sprintf("Error reading %llu bytes of GPT", (unsigned long long)tableSize);
+        return false;
+    }
+
+    if (!gpt.parseEntries(&buffer[entriesOffset], tableSize - entriesOffset)) {
+        message.sprintf("Error parsing the GPT partition entries: %s", gpt.lastError.c_str());
+        return false;
+    }
+
+    std::string gptPath = request.outDirectory + "/" + STREAMING_DLOAD_EMMC_BACKUP_GPT_FILE;
+    std::ofstream gptFile(gptPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!gptFile.is_open()) {
+        message.sprintf("Error opening %s for writing", gptPath.c_str());
+        return false;
+    }
+
+    gptFile.write((char*)&buffer[0], tableSize);
+    gptFile.close();
+
+    std::vector<std::string> fileNames;
+
+    for (auto &partition : gpt.partitions) {
+        StreamingDloadEmmcBackupPartition entry = {};
+        std::string name = partition.name.size() ? partition.name : "partition" + std::to_string(partition.index);
+
+        std::replace(name.begin(), name.end(), '/', '_');
+        std::replace(name.begin(), name.end(), '\\', '_');
+
+        // labels are not required to be unique
+        if (std::find(fileNames.begin(), fileNames.end(), name) != fileNames.end()) {
+            name += "_" + std::to_string(partition.index);
+        }
+
+        fileNames.push_back(name);
+
+        entry.partition = partition;
+        entry.skipped = std::find(request.skip.begin(), request.skip.end(), partition.name) != request.skip.end();
+
+        if (!entry.skipped) {
+            entry.fileName = name + ".img";
+            request.totalSize += (partition.lastLba - partition.firstLba + 1) * sectorSize;
+        }
+
+        request.partitions.push_back(entry);
+    }
+
+    return true;
+}
+
+/**
+* @brief writeLayout - Write the partition layout xml, in the same shape as
+*                      scripts/emmc_backup.py with the label and file added
+*
+* @param QString& message - Set on error
+*
+* @return bool
+*/
+bool StreamingDloadEmmcBackupWorker::writeLayout(QString& message)
+{
+    std::string layoutPath = request.outDirectory + "/" + STREAMING_DLOAD_EMMC_BACKUP_LAYOUT_FILE;
+    QFile file(QString::fromStdString(layoutPath));
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        message.sprintf("Error opening %s for writing", layoutPath.c_str());
+        return false;
+    }
+
+    QXmlStreamWriter xml(&file);
+
+    xml.setAutoFormatting(true);
+    xml.writeStartDocument();
+    xml.writeStartElement("data");
+
+    for (auto &entry : request.partitions) {
+        xml.writeEmptyElement("program");
+        xml.writeAttribute("name", QString("mmcblk0p%1").arg(entry.partition.index));
+        xml.writeAttribute("label", QString::fromStdString(entry.partition.name));
+        xml.writeAttribute("filename", QString::fromStdString(entry.fileName));
+        xml.writeAttribute("start", QString::number(entry.partition.firstLba));
+        xml.writeAttribute("size", QString::number(entry.partition.lastLba - entry.partition.firstLba + 1));
+    }
+
+    xml.writeEndElement();
+    xml.writeEndDocument();
+
+    file.close();
+
+    return true;
+}
+
+/**
+* @brief dumpPartition - Dump one partition. Each chunk is handed to a writer
+*                        while the next one is read from the port, so the port
+*                        never waits on the disk.
+*
+* A dump that does not finish, failed or cancelled, is deleted so a truncated
+* image is never left looking like a good one.
+*
+* @param StreamingDloadEmmcBackupPartition& entry
+* @param QString& message - Set on error
+*
+* @return bool - false on error or cancel
+*/
+bool StreamingDloadEmmcBackupWorker::dumpPartition(StreamingDloadEmmcBackupPartition& entry, QString& message)
+{
+    uint64_t address = entry.partition.firstLba * STREAMING_DLOAD_SECTOR_SIZE;
+    uint64_t size = (entry.partition.lastLba - entry.partition.firstLba + 1) * STREAMING_DLOAD_SECTOR_SIZE;
+    uint64_t offset = 0;
+    std::string filePath = request.outDirectory + "/" + entry.fileName;
+
+    std::ofstream file(filePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open()) {
+        message.sprintf("Error opening %s for writing", filePath.c_str());
+        return false;
+    }
+
+    std::vector<uint8_t> buffers[2];
+    std::future<bool> pendingWrite;
+    int current = 0;
+
+    auto discard = [&]() {
+        if (pendingWrite.valid()) {
+            pendingWrite.wait();
+        }
+
+        file.close();
+        std::remove(filePath.c_str());
+    };
+
+    while (offset < size && !cancelled) {
+        size_t chunkSize = size - offset < STREAMING_DLOAD_EMMC_BACKUP_CHUNK_SIZE ? size - offset : STREAMING_DLOAD_EMMC_BACKUP_CHUNK_SIZE;
+        std::vector<uint8_t>& buffer = buffers[current];
+
+        if (port.readAddress(address + offset, chunkSize, buffer, request.stepSize) != kStreamingDloadSuccess || buffer.size() < chunkSize) {
+            discard();
+            message.sprintf("Error reading %lu bytes of %s at address 0x%08llX", chunkSize, entry.partition.name.c_str(), (unsigned long long)(address + offset));
+            return false;
+        }
+
+        // the previous chunk must be on disk before its buffer is read into again
+        if (pendingWrite.valid() && !pendingWrite.get()) {
+            discard();
+            message.sprintf("Error writing to %s", filePath.c_str());
+            return false;
+        }
+
+        pendingWrite = std::async(std::launch::async, [&file, &buffer, chunkSize]() {
+            file.write((char*)&buffer[0], chunkSize);
+            return file.good();
+        });
+
+        current ^= 1;
+        offset += chunkSize;
+        request.outSize += chunkSize;
+
+        emit chunkComplete(request);
+    }
+
+    if (offset < size) {
+        discard();
+        message.sprintf("eMMC backup cancelled after %llu of %llu bytes, removed the partial %s",
+            (unsigned long long)request.outSize, (unsigned long long)request.totalSize, entry.fileName.c_str());
+        return false;
+    }
+
+    if (pendingWrite.valid() && !pendingWrite.get()) {
+        discard();
+        message.sprintf("Error writing to %s", filePath.c_str());
+        return false;
+    }
+
+    file.close();
+
+    return true;
+}
@@ -0,0 +1,92 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file streaming_dload_emmc_backup_worker.h
+* @class StreamingDloadEmmcBackupWorker
+* @package OpenPST
+* @brief Handles background processing of a GPT driven eMMC user partition backup
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+#ifndef _WORKER_STREAMING_DLOAD_EMMC_BACKUP_WORKER_H
+#define _WORKER_STREAMING_DLOAD_EMMC_BACKUP_WORKER_H
+
+#include <QThread>
+#include <QFile>
+#include <QXmlStreamWriter>
+#include <future>
+#include <stdio.h>
+#include "serial/streaming_dload_serial.h"
+#include "qc/streaming_dload.h"
+#include "util/gpt.h"
+
+/**
+* Amount read from the device per request batch. While one chunk is written
+* to disk the next one is read from the port.
+*/
+#define STREAMING_DLOAD_EMMC_BACKUP_CHUNK_SIZE (1024 * 1024)
+
+/**
+* Primary GPT is saved under this name, the layout next to it
+*/
+#define STREAMING_DLOAD_EMMC_BACKUP_GPT_FILE    "gpt_main0.bin"
+#define STREAMING_DLOAD_EMMC_BACKUP_LAYOUT_FILE "partitions.xml"
+
+using namespace serial;
+
+namespace OpenPST {
+
+    struct StreamingDloadEmmcBackupPartition {
+        GptPartition    partition;
+        std::string     fileName;   // relative to the output directory
+        bool            skipped;
+    };
+
+    struct StreamingDloadEmmcBackupWorkerRequest {
+        std::string     outDirectory;
+        std::vector<std::string> skip;      // partition names not to dump
+        size_t          stepSize;
+        uint64_t        totalSize;
+        uint64_t        outSize;
+        std::vector<StreamingDloadEmmcBackupPartition> partitions;
+        size_t          current;            // index into partitions being dumped
+    };
+
+    class StreamingDloadEmmcBackupWorker : public QThread
+    {
+        Q_OBJECT
+
+        public:
+            StreamingDloadEmmcBackupWorker(StreamingDloadSerial& port, StreamingDloadEmmcBackupWorkerRequest request, QObject *parent = 0);
+            ~StreamingDloadEmmcBackupWorker();
+            void cancel();
+        protected:
+            StreamingDloadSerial&  port;
+            StreamingDloadEmmcBackupWorkerRequest request;
+
+            void run() Q_DECL_OVERRIDE;
+            bool cancelled;
+
+            /**
+            * @brief readTable - Read the primary GPT, save it and build the partition list
+            */
+            bool readTable(GptTable& gpt, QString& message);
+
+            /**
+            * @brief writeLayout - Write the partition layout xml
+            */
+            bool writeLayout(QString& message);
+
+            /**
+            * @brief dumpPartition - Dump one partition, overlapping port reads with disk writes
+            */
+            bool dumpPartition(StreamingDloadEmmcBackupPartition& entry, QString& message);
+        signals:
+            void chunkComplete(StreamingDloadEmmcBackupWorkerRequest request);
+            void partitionComplete(StreamingDloadEmmcBackupWorkerRequest request);
+            void complete(StreamingDloadEmmcBackupWorkerRequest request);
+            void error(StreamingDloadEmmcBackupWorkerRequest request, QString msg);
+    };
+}
+
+#endif // _WORKER_STREAMING_DLOAD_EMMC_BACKUP_WORKER_H
@@ -0,0 +1,250 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file streaming_dload_flash_worker.cpp
+* @class StreamingDloadFlashWorker
+* @package OpenPST
+* @brief Handles background processing of a multi image flash plan
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "streaming_dload_flash_worker.h"
+
+using namespace OpenPST;
+
+StreamingDloadFlashWorker::StreamingDloadFlashWorker(StreamingDloadSerial& port, StreamingDloadFlashWorkerRequest request, QObject *parent) :
+    port(port),
+    request(request),
+    QThread(parent)
+{
+    cancelled = false;
+}
+
+StreamingDloadFlashWorker::~StreamingDloadFlashWorker()
+{
+
+}
+
+void StreamingDloadFlashWorker::cancel()
+{
+    cancelled = true;
+}
+
+void StreamingDloadFlashWorker::run()
+{
+    QString tmp;
+    QElapsedTimer timer;
+    std::vector<StreamingDloadFlashPlanImage>& images = request.plan.images;
+    StreamingDloadFlashImage image = {};
+
+    request.outSize = 0;
+    request.steps.clear();
+
+    // map the first image while the partition table goes out
+    prefetch = std::async(std::launch::async, &StreamingDloadFlashWorker::mapImage, images[0].filePath);
+
+    if (request.plan.partitionTable.size()) {
+        StreamingDloadFlashWorkerStep step = {};
+        uint8_t status = 0;
+
+        step.name = "Partition Table";
+
+        timer.start();
+
+        if (port.writePartitionTable(request.plan.partitionTable, status, request.plan.overridePartitionTable) != kStreamingDloadSuccess) {
+            fail(image, tmp.sprintf("Error writing partition table %s. Status: %02X", request.plan.partitionTable.c_str(), status));
+            return;
+        }
+
+        step.elapsed = timer.elapsed();
+
+        request.steps.push_back(step);
+
+        emit stepComplete(request);
+    }
+
+    for (size_t i = 0; i < images.size() && !cancelled; i++) {
+        StreamingDloadFlashPlanImage& entry = images[i];
+        StreamingDloadFlashWorkerStep step = {};
+
+        step.name = port.getNamedMultiImage(entry.imageType);
+
+        timer.start();
+
+        image = prefetch.get();
+
+        step.prefetchWait = timer.elapsed();
+
+        if (image.error.size()) {
+            fail(image, tmp.sprintf("Error mapping %s: %s", entry.filePath.c_str(), image.error.c_str()));
+            return;
+        }
+
+        if (i + 1 < images.size()) {
+            prefetch = std::async(std::launch::async, &StreamingDloadFlashWorker::mapImage, images[i + 1].filePath);
+        }
+
+        timer.start();
+
+        if (port.openMultiImage(entry.imageType) != kStreamingDloadSuccess) {
+            fail(image, tmp.sprintf("Error opening multi image mode for %s", step.name.c_str()));
+            return;
+        }
+
+        size_t blockSize = port.getStepSize(port.state.hello.maxPreferredBlockSize);
+        StreamingDloadWriteVerifier verifier(port, blockSize);
+        size_t queued = 0;
+
+        while (step.size < image.size && !cancelled) {
+            size_t writeSize = image.size - step.size < blockSize ? image.size - step.size : blockSize;
+
+            if (port.streamWrite(entry.address + step.size, image.data + step.size, writeSize, request.unframed) != kStreamingDloadSuccess) {
+                fail(image, tmp.sprintf("Error writing %lu bytes of %s at address 0x%08llX", writeSize, step.name.c_str(), entry.address + step.size));
+                return;
+            }
+
+            step.size += writeSize;
+            request.outSize += writeSize;
+
+            if (request.verify && (step.size - queued >= STREAMING_DLOAD_FLASH_VERIFY_RANGE_SIZE || step.size == image.size)) {
+                verifier.queue(entry.address + queued, image.data + queued, step.size - queued);
+
+                queued = step.size;
+
+                if (!verifier.step()) {
+                    fail(image, tmp.sprintf("Error verifying %s: %s", step.name.c_str(), verifier.getError().c_str()));
+                    return;
+                }
+            }
+
+            emit chunkComplete(request);
+        }
+
+        if (cancelled) {
+            // the partial image is not a step, leave the device out of multi image mode and report it
+            if (port.closeMode() != kStreamingDloadSuccess) {
+                LOGE("Error closing multi image mode for %s after cancel\n", step.name.c_str());
+            }
+
+            fail(image, tmp.sprintf("Flash plan cancelled while writing %s, %lu of %lu bytes written", step.name.c_str(), step.size, image.size));
+            return;
+        }
+
+        if (request.verify && !verifier.finish()) {
+            fail(image, tmp.sprintf("Error verifying %s: %s", step.name.c_str(), verifier.getError().c_str()));
+            return;
+        }
+
+        step.verifyElapsed = verifier.getElapsed();
+
+        if (port.closeMode() != kStreamingDloadSuccess) {
+            fail(image, tmp.sprintf("Error closing multi image mode for %s", step.name.c_str()));
+            return;
+        }
+
+        step.elapsed = timer.elapsed();
+
+        releaseImage(image);
+
+        request.steps.push_back(step);
+
+        emit stepComplete(request);
+    }
+
+    if (cancelled) {
+        fail(image, "Flash plan cancelled");
+        return;
+    }
+
+    if (prefetch.valid()) {
+        StreamingDloadFlashImage pending = prefetch.get();
+        releaseImage(pending);
+    }
+
+    emit complete(request);
+}
+
+/**
+* @brief mapImage - Map an image and fault in the start of it so the first
+*                   blocks are resident by the time the device asks for them
+*
+* @param std::string filePath
+*
+* @return StreamingDloadFlashImage
+*/
+StreamingDloadFlashImage StreamingDloadFlashWorker::mapImage(std::string filePath)
+{
+    StreamingDloadFlashImage image = {};
+
+    image.file = new QFile(QString::fromStdString(filePath));
+
+    if (!image.file->open(QIODevice::ReadOnly)) {
+        image.error = "Could not open file";
+        return image;
+    }
+
+    image.size = image.file->size();
+
+    if (!image.size) {
+        image.error = "File is empty";
+        return image;
+    }
+
+    image.data = image.file->map(0, image.size);
+
+    if (image.data == nullptr) {
+        image.error = image.file->errorString().toStdString();
+        return image;
+    }
+
+    size_t window = image.size < STREAMING_DLOAD_FLASH_PREFETCH_SIZE ? image.size : STREAMING_DLOAD_FLASH_PREFETCH_SIZE;
+    volatile uchar touch = 0;
+
+    for (size_t i = 0; i < window; i += 4096) {
+        touch ^= image.data[i];
+    }
+
+    return image;
+}
+
+/**
+* @brief releaseImage - Unmap and close a mapped image
+*
+* @param StreamingDloadFlashImage& image
+*/
+void StreamingDloadFlashWorker::releaseImage(StreamingDloadFlashImage& image)
+{
+    if (image.file == nullptr) {
+        return;
+    }
+
+    if (image.data != nullptr) {
+        image.file->unmap(image.data);
+    }
+
+    image.file->close();
+
+    delete image.file;
+
+    image.file = nullptr;
+    image.data = nullptr;
+}
+
+/**
+* @brief fail - Release the current and any prefetched image then emit error
+*
+* @param StreamingDloadFlashImage& image - The image being written
+* @param QString msg
+*/
+void StreamingDloadFlashWorker::fail(StreamingDloadFlashImage& image, QString msg)
+{
+    releaseImage(image);
+
+    if (prefetch.valid()) {
+        StreamingDloadFlashImage pending = prefetch.get();
+        releaseImage(pending);
+    }
+
+    emit error(request, msg);
+}
@@ -0,0 +1,99 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file streaming_dload_flash_worker.h
+* @class StreamingDloadFlashWorker
+* @package OpenPST
+* @brief Handles background processing of a multi image flash plan
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+#ifndef _WORKER_STREAMING_DLOAD_FLASH_WORKER_H
+#define _WORKER_STREAMING_DLOAD_FLASH_WORKER_H
+
+#include <QThread>
+#include <QFile>
+#include <QElapsedTimer>
+#include <future>
+#include "serial/streaming_dload_serial.h"
+#include "qc/streaming_dload.h"
+#include "qc/streaming_dload_flash_plan.h"
+#include "qc/streaming_dload_write_verifier.h"
+
+/**
+* Amount of the next image to fault in while the current image streams
+*/
+#define STREAMING_DLOAD_FLASH_PREFETCH_SIZE (16 * 1024 * 1024)
+
+/**
+* Amount of an image queued for read back at once when verifying
+*/
+#define STREAMING_DLOAD_FLASH_VERIFY_RANGE_SIZE (1024 * 1024)
+
+using namespace serial;
+
+namespace OpenPST {
+
+    struct StreamingDloadFlashWorkerStep {
+        std::string     name;
+        size_t          size;
+        qint64          prefetchWait;   // ms spent waiting on the image to be mapped
+        qint64          elapsed;        // ms spent on the device
+        qint64          verifyElapsed;  // ms of elapsed spent reading back
+    };
+
+    struct StreamingDloadFlashWorkerRequest {
+        StreamingDloadFlashPlan plan;
+        bool            unframed;
+        bool            verify;         // read back and compare each image while writing it
+        uint64_t        totalSize;
+        uint64_t        outSize;
+        std::vector<StreamingDloadFlashWorkerStep> steps;
+    };
+
+    struct StreamingDloadFlashImage {
+        QFile*          file;
+        uchar*          data;
+        size_t          size;
+        std::string     error;
+    };
+
+    class StreamingDloadFlashWorker : public QThread
+    {
+        Q_OBJECT
+
+        public:
+            StreamingDloadFlashWorker(StreamingDloadSerial& port, StreamingDloadFlashWorkerRequest request, QObject *parent = 0);
+            ~StreamingDloadFlashWorker();
+            void cancel();
+        protected:
+            StreamingDloadSerial&  port;
+            StreamingDloadFlashWorkerRequest request;
+            std::future<StreamingDloadFlashImage> prefetch;
+
+            void run() Q_DECL_OVERRIDE;
+            bool cancelled;
+
+            /**
+            * @brief mapImage - Map an image and fault in the start of it. Runs off the worker thread.
+            */
+            static StreamingDloadFlashImage mapImage(std::string filePath);
+
+            /**
+            * @brief releaseImage - Unmap and close a mapped image
+            */
+            static void releaseImage(StreamingDloadFlashImage& image);
+
+            /**
+            * @brief fail - Release the current and any prefetched image then emit error
+            */
+            void fail(StreamingDloadFlashImage& image, QString msg);
+        signals:
+            void chunkComplete(StreamingDloadFlashWorkerRequest request);
+            void stepComplete(StreamingDloadFlashWorkerRequest request);
+            void complete(StreamingDloadFlashWorkerRequest request);
+            void error(StreamingDloadFlashWorkerRequest request, QString msg);
+    };
+}
+
+#endif // _WORKER_STREAMING_DLOAD_FLASH_WORKER_H
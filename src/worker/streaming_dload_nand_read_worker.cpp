@@ -0,0 +1,166 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file streaming_dload_nand_read_worker.cpp
+* @class StreamingDloadNandReadWorker
+* @package OpenPST
+* @brief Handles background processing of raw NAND reads corrected on the host
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include "streaming_dload_nand_read_worker.h"
+
+using namespace OpenPST;
+
+StreamingDloadNandReadWorker::StreamingDloadNandReadWorker(StreamingDloadSerial& port, StreamingDloadNandReadWorkerRequest request, QObject *parent) :
+    port(port),
+    request(request),
+    QThread(parent)
+{
+    cancelled = false;
+}
+
+StreamingDloadNandReadWorker::~StreamingDloadNandReadWorker()
+{
+
+}
+
+void StreamingDloadNandReadWorker::cancel()
+{
+    cancelled = true;
+}
+
+void StreamingDloadNandReadWorker::run()
+{
+    QString tmp;
+    QElapsedTimer timer;
+    uint8_t eccState = 0;
+
+    timer.start();
+
+    request.pagesRead = 0;
+    request.pagesWritten = 0;
+    request.correctedBits = 0;
+    request.uncorrectablePages = 0;
+    request.badPages.clear();
+
+    NandEccPipeline pipeline(request.layout, request.threads);
+
+    if (!pipeline.isValid()) {
+        emit error(request, "The ECC codewords do not fit the page and spare size");
+        return;
+    }
+
+    std::ofstream file(request.outFilePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open()) {
+        emit error(request, tmp.sprintf("Error opening %s for writing", request.outFilePath.c_str()));
+        return;
+    }
+
+    if (port.readEcc(eccState) != kStreamingDloadSuccess) {
+        file.close();
+        emit error(request, "Error reading the device ECC state");
+        return;
+    }
+
+    // with the device ECC off reads return the page and spare as stored
+    if (eccState && port.setEcc(0x00) != kStreamingDloadSuccess) {
+        file.close();
+        emit error(request, "Error disabling the device ECC");
+        return;
+    }
+
+    size_t rawPageSize = pipeline.getRawPageSize();
+    size_t stepSize = port.getStepSize(port.state.hello.maxPreferredBlockSize);
+    std::vector<uint8_t> buffer;
+
+    while (request.pagesRead < request.pageCount && !cancelled) {
+        uint64_t pages = request.pageCount - request.pagesRead < STREAMING_DLOAD_NAND_READ_BATCH_PAGES ? request.pageCount - request.pagesRead : STREAMING_DLOAD_NAND_READ_BATCH_PAGES;
+        uint64_t address = request.address + request.pagesRead * rawPageSize;
+
+        if (port.readAddress(address, pages * rawPageSize, buffer, stepSize) != kStreamingDloadSuccess || buffer.size() < pages * rawPageSize) {
+            tmp.sprintf("Error reading %llu raw pages at address 0x%08llX", pages, address);
+            break;
+        }
+
+        // correction runs on the pool while the next batch is read
+        for (uint64_t i = 0; i < pages; i++) {
+            NandEccPage page = {};
+
+            page.index = request.pagesRead + i;
+            page.data.assign(buffer.begin() + i * rawPageSize, buffer.begin() + (i + 1) * rawPageSize);
+
+            pipeline.submit(std::move(page));
+        }
+
+        request.pagesRead += pages;
+
+        if (!collect(pipeline, file, false)) {
+            tmp.sprintf("Error writing to %s", request.outFilePath.c_str());
+            break;
+        }
+
+        emit chunkComplete(request);
+    }
+
+    bool failed = request.pagesRead < request.pageCount && !cancelled;
+
+    if (!failed && !collect(pipeline, file, true)) {
+        tmp.sprintf("Error writing to %s", request.outFilePath.c_str());
+        failed = true;
+    }
+
+    file.close();
+
+    if (eccState && port.setEcc(eccState) != kStreamingDloadSuccess) {
+        if (!failed) {
+            tmp = "Error restoring the device ECC state";
+        }
+
+        failed = true;
+    }
+
+    request.elapsed = timer.elapsed();
+
+    if (failed) {
+        emit error(request, tmp);
+        return;
+    }
+
+    emit complete(request);
+}
+
+/**
+* @brief collect - Write out corrected pages that are ready, waiting on them if wait is set
+*
+* @param NandEccPipeline& pipeline
+* @param std::ofstream& file
+* @param bool wait
+*
+* @return bool - false on a write error
+*/
+bool StreamingDloadNandReadWorker::collect(NandEccPipeline& pipeline, std::ofstream& file, bool wait)
+{
+    NandEccPage page;
+
+    while (pipeline.next(page, wait)) {
+        file.write((char*)&page.data[0], page.data.size());
+
+        if (!file.good()) {
+            return false;
+        }
+
+        request.correctedBits += page.corrected;
+
+        if (page.uncorrectable) {
+            request.uncorrectablePages++;
+            request.badPages.push_back(page.index);
+        }
+
+        request.pagesWritten++;
+    }
+
+    return true;
+}
@@ -0,0 +1,69 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file streaming_dload_nand_read_worker.h
+* @class StreamingDloadNandReadWorker
+* @package OpenPST
+* @brief Handles background processing of raw NAND reads corrected on the host
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+#ifndef _WORKER_STREAMING_DLOAD_NAND_READ_WORKER_H
+#define _WORKER_STREAMING_DLOAD_NAND_READ_WORKER_H
+
+#include <QThread>
+#include <QElapsedTimer>
+#include "serial/streaming_dload_serial.h"
+#include "qc/streaming_dload.h"
+#include "util/nand_ecc_pipeline.h"
+
+/**
+* Pages requested from the device per read
+*/
+#define STREAMING_DLOAD_NAND_READ_BATCH_PAGES 16
+
+using namespace serial;
+
+namespace OpenPST {
+
+    struct StreamingDloadNandReadWorkerRequest {
+        uint64_t        address;        // raw address of the first page, pages are pageSize + spareSize apart
+        uint64_t        pageCount;
+        NandPageLayout  layout;
+        size_t          threads;        // correction threads, 0 for one per hardware thread
+        std::string     outFilePath;
+        uint64_t        pagesRead;
+        uint64_t        pagesWritten;
+        uint64_t        correctedBits;
+        uint64_t        uncorrectablePages;
+        std::vector<uint64_t> badPages; // pages with uncorrectable codewords
+        qint64          elapsed;        // ms
+    };
+
+    class StreamingDloadNandReadWorker : public QThread
+    {
+        Q_OBJECT
+
+        public:
+            StreamingDloadNandReadWorker(StreamingDloadSerial& port, StreamingDloadNandReadWorkerRequest request, QObject *parent = 0);
+            ~StreamingDloadNandReadWorker();
+            void cancel();
+        protected:
+            StreamingDloadSerial&  port;
+            StreamingDloadNandReadWorkerRequest request;
+
+            void run() Q_DECL_OVERRIDE;
+            bool cancelled;
+
+            /**
+            * @brief collect - Write out corrected pages that are ready, waiting on them if wait is set
+            */
+            bool collect(NandEccPipeline& pipeline, std::ofstream& file, bool wait);
+        signals:
+            void chunkComplete(StreamingDloadNandReadWorkerRequest request);
+            void complete(StreamingDloadNandReadWorkerRequest request);
+            void error(StreamingDloadNandReadWorkerRequest request, QString msg);
+    };
+}
+
+#endif // _WORKER_STREAMING_DLOAD_NAND_READ_WORKER_H
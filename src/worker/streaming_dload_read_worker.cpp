@@ -34,52 +34,142 @@ void StreamingDloadReadWorker::cancel()
 void StreamingDloadReadWorker::run()
 {
     QString tmp;
+    TransferJournal journal;
+
+    if (request.stepSize > port.state.hello.maxPreferredBlockSize) {
+        request.stepSize = port.state.hello.maxPreferredBlockSize;
+    }
+
+    if (!journal.open(request.outFilePath + ".journal", request.address, request.size, port.getDeviceId(), request.resume)) {
+        emit error(request, tmp.sprintf("Error opening journal for %s, or it belongs to another device", request.outFilePath.c_str()));
+        return;
+    }
+
+    request.outSize = journal.resumeOffset();
+
+    if (request.outSize && !std::ifstream(request.outFilePath.c_str(), std::ios::in | std::ios::binary).is_open()) {
+        // the journal outlived the file it describes, nothing in it is on disk
+        LOGI("%s is missing, reading it from the start\n", request.outFilePath.c_str());
+
+        if (!journal.open(request.outFilePath + ".journal", request.address, request.size, port.getDeviceId(), false)) {
+            emit error(request, tmp.sprintf("Error opening journal for %s", request.outFilePath.c_str()));
+            return;
+        }
+
+        request.outSize = 0;
+    }
+
+    std::ios::openmode mode = std::ios::out | std::ios::binary;
+
+    if (request.outSize) {
+        mode |= std::ios::in;
+    } else {
+        mode |= std::ios::trunc;
+    }
+
+    std::fstream file(request.outFilePath.c_str(), mode);
 
-    std::ofstream file(request.outFilePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
-    
     if (!file.is_open()) {
         emit error(request, tmp.sprintf("Error opening %s for writing", request.outFilePath.c_str()));
         return;
     }
 
-    if (request.stepSize > port.state.hello.maxPreferredBlockSize) {
-        request.stepSize = port.state.hello.maxPreferredBlockSize;
+    if (request.outSize && !restoreCheckpoint(journal, file, tmp)) {
+        file.close();
+        emit error(request, tmp);
+        return;
     }
 
-    request.outSize = 0;
+    request.outSize = journal.resumeOffset();
+
+    file.seekp(request.outSize, file.beg);
+
+    std::vector<uint8_t> range;
+
+    while (request.outSize < request.size && !cancelled) {
+        size_t rangeSize = request.size - request.outSize < TRANSFER_JOURNAL_DEFAULT_RANGE_SIZE ? request.size - request.outSize : TRANSFER_JOURNAL_DEFAULT_RANGE_SIZE;
+        uint64_t address = request.address + request.outSize;
+
+        if (port.readAddress(address, rangeSize, range, request.stepSize) != kStreamingDloadSuccess || range.size() < rangeSize) {
+            file.close();
+            emit error(request, tmp.sprintf("Error reading %lu bytes from address 0x%08llX", rangeSize, (unsigned long long)address));
+            return;
+        }
 
-    if (request.size <= request.stepSize) {
+        file.write((char*)&range[0], rangeSize);
+        file.flush();
 
-        if (port.readAddress(request.address, request.stepSize, file, request.outSize, request.stepSize) != kStreamingDloadSuccess) {
+        if (!file.good()) {
             file.close();
-            emit error(request, tmp.sprintf("Error reading %lu bytes from address 0x%08X", request.stepSize, request.address));
+            emit error(request, tmp.sprintf("Error writing to %s", request.outFilePath.c_str()));
             return;
         }
 
+        // only once the range is read in full and flushed to the output file
+        journal.checkpoint(request.outSize, &range[0], rangeSize);
+
+        request.outSize += rangeSize;
+
         emit chunkReady(request);
-    } else {
+    }
+
+    file.close();
+
+    // an interrupted read keeps its journal so it can be resumed
+    if (!cancelled) {
+        journal.remove();
+    }
+
+    emit complete(request);
+}
+
+/**
+* @brief restoreCheckpoint - Make sure the last journaled range is really in the
+*                            output file, and optionally still matches the device,
+*                            dropping it from the journal if not
+*
+* @param TransferJournal& journal
+* @param std::fstream& file
+* @param QString& message - Set on error
+*
+* @return bool
+*/
+bool StreamingDloadReadWorker::restoreCheckpoint(TransferJournal& journal, std::fstream& file, QString& message)
+{
+    std::vector<uint8_t> range;
+
+    if (!journal.entries.size()) {
+        return true;
+    }
+
+    TransferJournalEntry last = journal.entries.back();
 
-        
-        uint32_t address = request.address;
+    range.resize(last.size);
 
-        do {
-            size_t chunkOutSize = 0;
+    file.seekg(last.offset, file.beg);
+    file.read((char*)&range[0], last.size);
 
-            if (port.readAddress((address + request.outSize), request.stepSize, file, chunkOutSize, request.stepSize) != kStreamingDloadSuccess) {
-                file.close();
-                emit error(request, tmp.sprintf("Error reading %lu bytes from address 0x%08X", request.stepSize, (address + request.outSize)));
-                return;
-            }
-            
-            request.outSize += chunkOutSize;
+    if ((uint64_t)file.gcount() != last.size || !journal.verify(last, &range[0], last.size)) {
+        LOGI("Last checkpoint at offset %llu is not on disk, reading it again\n", (unsigned long long)last.offset);
+        file.clear();
+        return journal.rollback();
+    }
 
-            emit chunkReady(request);
+    if (!request.verifyLast) {
+        return true;
+    }
 
-        } while (request.outSize < request.size && !cancelled);
+    uint64_t address = request.address + last.offset;
 
-    }       
+    if (port.readAddress(address, last.size, range, request.stepSize) != kStreamingDloadSuccess) {
+        message.sprintf("Error verifying %llu bytes at address 0x%08llX", (unsigned long long)last.size, (unsigned long long)address);
+        return false;
+    }
 
-    file.close();
+    if (range.size() < last.size || !journal.verify(last, &range[0], last.size)) {
+        LOGI("Device data at 0x%08llX no longer matches the last checkpoint, reading it again\n", (unsigned long long)address);
+        return journal.rollback();
+    }
 
-    emit complete(request);
-}
\ No newline at end of file
+    return true;
+}
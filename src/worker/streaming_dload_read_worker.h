@@ -14,17 +14,20 @@
 #include <QThread>
 #include "serial/streaming_dload_serial.h"
 #include "qc/streaming_dload.h"
+#include "util/transfer_journal.h"
 
 using namespace serial;
 
 namespace OpenPST {
 
     struct StreamingDloadReadWorkerRequest {
-        uint32_t        address;
-        size_t          size;
+        uint64_t        address;
+        uint64_t        size;
         size_t          stepSize;
-        size_t          outSize;
+        uint64_t        outSize;
         std::string     outFilePath;        
+        bool            resume;             // continue from the journal left by an interrupted read
+        bool            verifyLast;         // re-read the last journaled range from the device before resuming
     };
     
     class StreamingDloadReadWorker : public QThread
@@ -41,6 +44,8 @@ namespace OpenPST {
 
             void run() Q_DECL_OVERRIDE;         
             bool cancelled;
+
+            bool restoreCheckpoint(TransferJournal& journal, std::fstream& file, QString& message);
         signals:
             void chunkReady(StreamingDloadReadWorkerRequest request);
             void complete(StreamingDloadReadWorkerRequest request);
@@ -19,6 +19,7 @@ StreamingDloadStreamWriteWorker::StreamingDloadStreamWriteWorker(StreamingDloadS
     QThread(parent)
 {
     cancelled = false;
+    journaledRanges = 0;
 }
 
 StreamingDloadStreamWriteWorker::~StreamingDloadStreamWriteWorker()
@@ -34,6 +35,9 @@ void StreamingDloadStreamWriteWorker::cancel()
 void StreamingDloadStreamWriteWorker::run()
 {
     QString tmp;
+    QElapsedTimer timer;
+
+    timer.start();
 
     std::ifstream file(request.filePath.c_str(), std::ios::in | std::ios::binary);
 
@@ -44,51 +48,242 @@ void StreamingDloadStreamWriteWorker::run()
 
     file.seekg(0, file.end);
 
-    size_t fileSize = file.tellg();
+    uint64_t fileSize = file.tellg();
 
     file.seekg(0, file.beg);
 
-    size_t writeSize = port.state.hello.maxPreferredBlockSize;
+    size_t writeSize = port.getStepSize(port.state.hello.maxPreferredBlockSize);
 
+    request.fileSize = fileSize;
     request.outSize = 0;
+    request.skippedSize = 0;
+    request.verifiedSize = 0;
+    request.elapsed = 0;
+    request.verifyElapsed = 0;
+
+    std::vector<BlockManifestRun> runs;
 
-    uint8_t fileBuffer[STREAMING_DLOAD_MAX_TX_SIZE];
+    if (request.baseManifestPath.size()) {
+        BlockManifest base, target;
 
-    if (fileSize <= writeSize) {
+        if (!base.load(request.baseManifestPath)) {
+            file.close();
+            emit error(request, tmp.sprintf("Error loading manifest %s", request.baseManifestPath.c_str()));
+            return;
+        }
 
-        file.read((char*)fileBuffer, fileSize);
+        bool loaded = request.manifestPath.size() ? target.load(request.manifestPath) : target.generate(request.filePath, base.blockSize);
 
-        if (port.streamWrite(request.address, fileBuffer, fileSize, request.unframed) != kStreamingDloadSuccess) {
+        if (!loaded || target.imageSize != fileSize) {
             file.close();
-            emit error(request, tmp.sprintf("Error writing %lu bytes starting at address 0x%04X", fileSize, request.address));
+            emit error(request, tmp.sprintf("Error building manifest for %s", request.filePath.c_str()));
             return;
         }
 
-        emit chunkComplete(request);
+        request.skippedSize = fileSize - target.diff(base, runs);
     } else {
+        BlockManifestRun run = { 0, fileSize };
+        runs.push_back(run);
+    }
+
+    TransferJournal journal;
+
+    if (!journal.open(request.journalPath, request.address, fileSize, port.getDeviceId(), request.resume)) {
+        file.close();
+        emit error(request, tmp.sprintf("Error opening journal %s, or it belongs to another device", request.journalPath.c_str()));
+        return;
+    }
 
-        uint32_t address = request.address;
+    if (journal.entries.size() && !restoreCheckpoint(journal, file, tmp)) {
+        file.close();
+        emit error(request, tmp);
+        return;
+    }
+
+    uint64_t resumeOffset = journal.resumeOffset();
+
+    std::vector<uint8_t> range(TRANSFER_JOURNAL_DEFAULT_RANGE_SIZE);
+
+    // read back of a range trails its write by one range
+    StreamingDloadWriteVerifier verifier(port, writeSize);
+
+    // written but not yet read back, journaled as the verifier confirms them so a
+    // resume never skips a range that was not verified
+    std::deque<TransferJournalEntry> unverified;
+
+    for (auto &run : runs) {
+        uint64_t offset = run.offset > resumeOffset ? run.offset : resumeOffset;
+        uint64_t end = run.offset + run.size;
+
+        if (offset >= end) {
+            continue;
+        }
 
-        do {
+        // skipped blocks and already journaled ranges count towards progress
+        request.outSize = offset;
 
-            file.read((char*)fileBuffer, writeSize);
+        file.seekg(offset, file.beg);
 
-            if (port.streamWrite((address + request.outSize), fileBuffer, writeSize, request.unframed) != kStreamingDloadSuccess) {
+        while (offset < end && !cancelled) {
+            size_t rangeSize = end - offset < range.size() ? end - offset : range.size();
+
+            file.read((char*)&range[0], rangeSize);
+
+            if ((size_t)file.gcount() != rangeSize) {
+                // never send or hash what is left in the buffer from the last range
                 file.close();
-                emit error(request, tmp.sprintf("Error writing %lu bytes starting at address 0x%04X", writeSize, (address + request.outSize)));
+                emit error(request, tmp.sprintf("Error reading %lu bytes from %s at offset %llu", rangeSize, request.filePath.c_str(), (unsigned long long)offset));
                 return;
             }
-            
-            request.outSize += writeSize;
 
-            emit chunkComplete(request);
+            for (size_t written = 0; written < rangeSize && !cancelled; ) {
+                size_t size = rangeSize - written < writeSize ? rangeSize - written : writeSize;
+                uint64_t address = request.address + offset + written;
+
+                if (port.streamWrite(address, &range[written], size, request.unframed) != kStreamingDloadSuccess) {
+                    file.close();
+                    emit error(request, tmp.sprintf("Error writing %lu bytes starting at address 0x%08llX", size, (unsigned long long)address));
+                    return;
+                }
+
+                written += size;
+                request.outSize = offset + written;
+
+                emit chunkComplete(request);
+            }
+
+            if (cancelled) {
+                break;
+            }
+
+            if (request.verify) {
+                verifier.queue(request.address + offset, &range[0], rangeSize);
 
-        } while (request.outSize < fileSize && !cancelled);
+                unverified.push_back(TransferJournal::describe(offset, &range[0], rangeSize));
 
-    }       
+                bool verified = verifier.step();
+
+                checkpointVerified(journal, verifier, unverified);
+
+                if (!verified) {
+                    // the journal must end at the last range known good on the device
+                    journal.rollback(verifier.getFailedAddress() - request.address);
+                    file.close();
+                    request.verifyElapsed = verifier.getElapsed();
+                    request.elapsed = timer.elapsed();
+                    emit error(request, QString::fromStdString(verifier.getError()));
+                    return;
+                }
+
+                request.verifiedSize = verifier.getVerifiedSize();
+            } else {
+                journal.checkpoint(offset, &range[0], rangeSize);
+            }
+
+            offset += rangeSize;
+        }
+
+        if (cancelled) {
+            break;
+        }
+    }
 
     file.close();
 
+    if (cancelled) {
+        // unverified ranges are not journaled, a resume writes them again
+        request.verifiedSize = verifier.getVerifiedSize();
+        request.verifyElapsed = verifier.getElapsed();
+        request.elapsed = timer.elapsed();
+        emit error(request, tmp.sprintf("Stream write cancelled after %llu of %llu bytes, resumable with journal %s",
+            (unsigned long long)request.outSize, (unsigned long long)fileSize, request.journalPath.c_str()));
+        return;
+    }
+
+    if (request.verify && !verifier.finish()) {
+        checkpointVerified(journal, verifier, unverified);
+        journal.rollback(verifier.getFailedAddress() - request.address);
+        request.verifyElapsed = verifier.getElapsed();
+        request.elapsed = timer.elapsed();
+        emit error(request, QString::fromStdString(verifier.getError()));
+        return;
+    }
+
+    request.outSize = fileSize;
+    journal.remove();
+
+    request.verifiedSize = verifier.getVerifiedSize();
+    request.verifyElapsed = verifier.getElapsed();
+    request.elapsed = timer.elapsed();
+
     emit complete(request);
 }
 
+/**
+* @brief checkpointVerified - Journal the written ranges the verifier has confirmed since the last call
+*
+* @param TransferJournal& journal
+* @param StreamingDloadWriteVerifier& verifier
+* @param std::deque<TransferJournalEntry>& unverified - Written ranges in the order they were queued
+*/
+void StreamingDloadStreamWriteWorker::checkpointVerified(TransferJournal& journal, StreamingDloadWriteVerifier& verifier, std::deque<TransferJournalEntry>& unverified)
+{
+    size_t confirmed = verifier.getVerifiedRanges() - journaledRanges;
+
+    while (confirmed-- && unverified.size()) {
+        journal.checkpoint(unverified.front());
+        unverified.pop_front();
+        journaledRanges++;
+    }
+}
+
+/**
+* @brief restoreCheckpoint - Make sure the last journaled range still matches the
+*                            source file, and optionally what was written to the
+*                            device, before skipping everything up to it
+*
+* @param TransferJournal& journal
+* @param std::ifstream& file
+* @param QString& message - Set on error
+*
+* @return bool
+*/
+bool StreamingDloadStreamWriteWorker::restoreCheckpoint(TransferJournal& journal, std::ifstream& file, QString& message)
+{
+    std::vector<uint8_t> range;
+    TransferJournalEntry last = journal.entries.back();
+
+    range.resize(last.size);
+
+    file.seekg(last.offset, file.beg);
+    file.read((char*)&range[0], last.size);
+
+    bool complete = (uint64_t)file.gcount() == last.size;
+
+    file.clear();
+
+    if (!complete || !journal.verify(last, &range[0], last.size)) {
+        // the image changed since the journal was written, nothing in it can be trusted
+        LOGI("%s changed since it was journaled, writing it from the start\n", request.filePath.c_str());
+        journal.entries.clear();
+        return journal.rollback();
+    }
+
+    if (!request.verifyLast) {
+        return true;
+    }
+
+    uint64_t address = request.address + last.offset;
+
+    if (port.readAddress(address, last.size, range, port.state.hello.maxPreferredBlockSize) != kStreamingDloadSuccess) {
+        message.sprintf("Error verifying %llu bytes at address 0x%08llX", (unsigned long long)last.size, (unsigned long long)address);
+        return false;
+    }
+
+    if (range.size() < last.size || !journal.verify(last, &range[0], last.size)) {
+        LOGI("Device data at 0x%08llX does not match the last checkpoint, writing it again\n", (unsigned long long)address);
+        return journal.rollback();
+    }
+
+    return true;
+}
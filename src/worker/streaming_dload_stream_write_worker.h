@@ -12,18 +12,34 @@
 #define _WORKER_STREAMING_DLOAD_STREAM_WRITE_WORKER_H
 
 #include <QThread>
+#include <QElapsedTimer>
+#include <deque>
 #include "serial/streaming_dload_serial.h"
 #include "qc/streaming_dload.h"
+#include "util/block_manifest.h"
+#include "util/transfer_journal.h"
+#include "qc/streaming_dload_write_verifier.h"
 
 using namespace serial;
 
 namespace OpenPST {
 
     struct StreamingDloadStreamWriteWorkerRequest {
-        uint32_t        address;
+        uint64_t        address;
         std::string     filePath;
-        size_t          outSize;
+        uint64_t        fileSize;
+        uint64_t        outSize;
         bool            unframed;
+        std::string     baseManifestPath;   // manifest of the image on the device, enables differential write
+        std::string     manifestPath;       // manifest of filePath, generated when empty
+        uint64_t        skippedSize;
+        std::string     journalPath;        // one per device written, never shared between units
+        bool            resume;             // continue from the journal left by an interrupted write
+        bool            verifyLast;         // read back the last journaled range from the device before resuming
+        bool            verify;             // read back and compare every range while writing
+        uint64_t        verifiedSize;
+        qint64          elapsed;            // ms, whole job
+        qint64          verifyElapsed;      // ms, of elapsed spent reading back
     };
 
     class StreamingDloadStreamWriteWorker : public QThread
@@ -40,6 +56,10 @@ namespace OpenPST {
 
         void run() Q_DECL_OVERRIDE;
         bool cancelled;
+        size_t journaledRanges;
+
+        void checkpointVerified(TransferJournal& journal, StreamingDloadWriteVerifier& verifier, std::deque<TransferJournalEntry>& unverified);
+        bool restoreCheckpoint(TransferJournal& journal, std::ifstream& file, QString& message);
     signals:
         void chunkComplete(StreamingDloadStreamWriteWorkerRequest request);
         void complete(StreamingDloadStreamWriteWorkerRequest request);
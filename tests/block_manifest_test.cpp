@@ -0,0 +1,254 @@
+#include <iostream>
+#include <fstream>
+#include "include/definitions.h"
+#include "util/block_manifest.h"
+#include "util/xxhash.h"
+
+
+using namespace std;
+using namespace OpenPST;
+
+int main();
+bool test_generate();
+bool test_round_trip();
+bool test_load_invalid();
+bool test_diff();
+bool test_diff_block_size();
+bool test_empty_image();
+
+
+#define TEST_IMAGE "block_manifest_test.img"
+#define TEST_MANIFEST "block_manifest_test.bhm"
+#define TEST_BLOCK_SIZE 4096
+#define TEST_IMAGE_SIZE (TEST_BLOCK_SIZE * 37 + 123)	// short last block
+
+static vector<uint8_t> make_image(size_t size, uint32_t seed)
+{
+	vector<uint8_t> image(size);
+
+	for (size_t i = 0; i < size; i++) {
+		seed = seed * 1103515245 + 12345;
+		image[i] = (uint8_t)(seed >> 16);
+	}
+
+	return image;
+}
+
+static bool write_file(const char* filePath, const vector<uint8_t>& data)
+{
+	ofstream file(filePath, ios::out | ios::binary | ios::trunc);
+
+	if (data.size()) {
+		file.write((const char*)&data[0], data.size());
+	}
+
+	return file.good();
+}
+
+bool test_generate()
+{
+	vector<uint8_t> image = make_image(TEST_IMAGE_SIZE, 1);
+	BlockManifest single;
+	BlockManifest threaded;
+
+	write_file(TEST_IMAGE, image);
+
+	if (!single.generate(TEST_IMAGE, TEST_BLOCK_SIZE, 1) || !threaded.generate(TEST_IMAGE, TEST_BLOCK_SIZE, 7)) {
+		printf("Test Failed. Could not hash %s\n", TEST_IMAGE);
+		return false;
+	}
+
+	if (threaded.imageSize != image.size() || threaded.hashes.size() != 38 || threaded.hashes != single.hashes) {
+		printf("Test Failed. %lu hashes over %lu bytes\n", threaded.hashes.size(), (size_t)threaded.imageSize);
+		return false;
+	}
+
+	for (size_t i = 0; i < threaded.hashes.size(); i++) {
+		size_t offset = i * TEST_BLOCK_SIZE;
+		size_t size = image.size() - offset < TEST_BLOCK_SIZE ? image.size() - offset : TEST_BLOCK_SIZE;
+
+		if (threaded.hashes[i] != xxhash64(&image[offset], size)) {
+			printf("Test Failed. Hash of block %lu differs\n", i);
+			return false;
+		}
+	}
+
+	printf("Generate: PASS\n");
+	return true;
+}
+
+bool test_round_trip()
+{
+	BlockManifest manifest;
+	BlockManifest loaded;
+
+	write_file(TEST_IMAGE, make_image(TEST_IMAGE_SIZE, 2));
+
+	if (!manifest.generate(TEST_IMAGE, TEST_BLOCK_SIZE) || !manifest.save(TEST_MANIFEST) || !loaded.load(TEST_MANIFEST)) {
+		return false;
+	}
+
+	if (loaded.blockSize != manifest.blockSize || loaded.imageSize != manifest.imageSize || loaded.hashes != manifest.hashes) {
+		printf("Test Failed. Loaded manifest differs from the saved one\n");
+		return false;
+	}
+
+	ifstream file(TEST_MANIFEST, ios::in | ios::binary | ios::ate);
+
+	if ((size_t)file.tellg() != sizeof(BlockManifestHeader) + manifest.hashes.size() * sizeof(uint64_t)) {
+		printf("Test Failed. Manifest is %lu bytes\n", (size_t)file.tellg());
+		return false;
+	}
+
+	printf("Save And Load: PASS\n");
+	return true;
+}
+
+bool test_load_invalid()
+{
+	BlockManifest manifest;
+	BlockManifest loaded;
+	vector<uint8_t> data;
+
+	write_file(TEST_IMAGE, make_image(TEST_IMAGE_SIZE, 3));
+	manifest.generate(TEST_IMAGE, TEST_BLOCK_SIZE);
+	manifest.save(TEST_MANIFEST);
+
+	// an image is not a manifest
+	if (loaded.load(TEST_IMAGE)) {
+		printf("Test Failed. Loaded an image as a manifest\n");
+		return false;
+	}
+
+	// cut short in the hashes
+	ifstream in(TEST_MANIFEST, ios::in | ios::binary);
+	data.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+	in.close();
+
+	data.resize(data.size() - 4);
+	write_file(TEST_MANIFEST, data);
+
+	if (loaded.load(TEST_MANIFEST)) {
+		printf("Test Failed. Loaded a truncated manifest\n");
+		return false;
+	}
+
+	if (loaded.load("block_manifest_test.missing")) {
+		printf("Test Failed. Loaded a missing manifest\n");
+		return false;
+	}
+
+	printf("Invalid Manifests: PASS\n");
+	return true;
+}
+
+bool test_diff()
+{
+	vector<uint8_t> image = make_image(TEST_IMAGE_SIZE, 4);
+	BlockManifest base;
+	BlockManifest manifest;
+	BlockManifest loaded;
+	vector<BlockManifestRun> runs;
+
+	write_file(TEST_IMAGE, image);
+	base.generate(TEST_IMAGE, TEST_BLOCK_SIZE);
+
+	// blocks 2 and 3 touch and become one run, 10 is on its own, and the image grows past the device copy
+	image[2 * TEST_BLOCK_SIZE + 5] ^= 0xFF;
+	image[3 * TEST_BLOCK_SIZE] ^= 0x01;
+	image[10 * TEST_BLOCK_SIZE + TEST_BLOCK_SIZE - 1] ^= 0x80;
+	image.resize(TEST_IMAGE_SIZE + TEST_BLOCK_SIZE, 0x5A);
+
+	write_file(TEST_IMAGE, image);
+	manifest.generate(TEST_IMAGE, TEST_BLOCK_SIZE);
+
+	// the device side comes from a saved manifest
+	base.save(TEST_MANIFEST);
+	loaded.load(TEST_MANIFEST);
+
+	uint64_t total = manifest.diff(loaded, runs);
+
+	BlockManifestRun expected[] = {
+		{ 2 * TEST_BLOCK_SIZE, 2 * TEST_BLOCK_SIZE },
+		{ 10 * TEST_BLOCK_SIZE, TEST_BLOCK_SIZE },
+		{ 37 * TEST_BLOCK_SIZE, image.size() - 37 * TEST_BLOCK_SIZE },	// the old short block and what follows
+	};
+
+	if (runs.size() != 3 || total != 3 * TEST_BLOCK_SIZE + expected[2].size) {
+		printf("Test Failed. %lu runs covering %lu bytes\n", runs.size(), (size_t)total);
+		return false;
+	}
+
+	for (size_t i = 0; i < runs.size(); i++) {
+		if (runs[i].offset != expected[i].offset || runs[i].size != expected[i].size) {
+			printf("Test Failed. Run %lu is %lu + %lu\n", i, (size_t)runs[i].offset, (size_t)runs[i].size);
+			return false;
+		}
+	}
+
+	// nothing to write against itself
+	if (manifest.diff(manifest, runs) || runs.size()) {
+		printf("Test Failed. Manifest differs from itself\n");
+		return false;
+	}
+
+	printf("Diff: PASS\n");
+	return true;
+}
+
+bool test_diff_block_size()
+{
+	BlockManifest base;
+	BlockManifest manifest;
+	vector<BlockManifestRun> runs;
+
+	write_file(TEST_IMAGE, make_image(TEST_IMAGE_SIZE, 5));
+	base.generate(TEST_IMAGE, TEST_BLOCK_SIZE * 2);
+	manifest.generate(TEST_IMAGE, TEST_BLOCK_SIZE);
+
+	// hashes of different block sizes can not be compared, so everything is written
+	if (manifest.diff(base, runs) != TEST_IMAGE_SIZE || runs.size() != 1 || runs[0].offset != 0) {
+		printf("Test Failed. %lu runs for a different block size\n", runs.size());
+		return false;
+	}
+
+	printf("Diff Block Size: PASS\n");
+	return true;
+}
+
+bool test_empty_image()
+{
+	BlockManifest manifest;
+	BlockManifest loaded;
+	vector<BlockManifestRun> runs;
+
+	write_file(TEST_IMAGE, vector<uint8_t>());
+
+	if (!manifest.generate(TEST_IMAGE, TEST_BLOCK_SIZE) || manifest.hashes.size() || !manifest.save(TEST_MANIFEST) ||
+		!loaded.load(TEST_MANIFEST) || loaded.imageSize || loaded.hashes.size() || manifest.diff(loaded, runs)) {
+		printf("Test Failed. Empty image\n");
+		return false;
+	}
+
+	printf("Empty Image: PASS\n");
+	return true;
+}
+
+int main() {
+	int failed = 0;
+
+	printf("\n\n------------\nStarting Block Manifest Tests\n------------\n\n");
+	failed += !test_generate();
+	failed += !test_round_trip();
+	failed += !test_load_invalid();
+	failed += !test_diff();
+	failed += !test_diff_block_size();
+	failed += !test_empty_image();
+
+	remove(TEST_IMAGE);
+	remove(TEST_MANIFEST);
+
+	cout << "\n\nPress Enter To Exit" << endl;
+	int pause = getchar();
+	return failed;
+}
@@ -0,0 +1,367 @@
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include "include/definitions.h"
+#include "qc/dm.h"
+#include "qc/hdlc.h"
+#include "qc/dm_client.h"
+#include "qc/dm_capture.h"
+#include "qc/dm_capture_decoder.h"
+#include "serial/qcdm_serial.h"
+#include "scripted_serial.h"
+
+
+using namespace std;
+using namespace OpenPST;
+
+int main();
+bool test_log_mask_requests();
+bool test_capture_round_trip();
+bool test_decode_filter();
+bool test_decode_raw_stream();
+
+
+#define TEST_PORT "scripted-capture"
+#define TEST_CAPTURE_FILE "dm_capture_test.bin"
+#define TEST_STREAM_FILE "dm_capture_test.hdlc"
+#define TEST_LOGS 2000
+#define TEST_EVENTS 100
+#define TEST_MESSAGES 100
+#define TEST_TIMEOUT 5000 // ms
+
+// answers everything with an echo, streamed packets are sent by the tests
+static bool capture_device(const vector<uint8_t>& request, vector<uint8_t>& response)
+{
+	response = request;
+	return true;
+}
+
+static vector<uint8_t> make_log(uint16_t code, uint64_t timestamp, uint8_t seed)
+{
+	vector<uint8_t> packet(sizeof(QcdmLogResponse) + sizeof(QcdmLogHeader) + 16, 0x00);
+	QcdmLogResponse* response = (QcdmLogResponse*)&packet[0];
+	QcdmLogHeader* header = (QcdmLogHeader*)&packet[sizeof(QcdmLogResponse)];
+
+	response->command	= DIAG_LOG_F;
+	response->entries	= 1;
+	response->length	= sizeof(QcdmLogHeader) + 16;
+	header->length		= sizeof(QcdmLogHeader) + 16;
+	header->logCode		= code;
+	header->timestamp	= timestamp;
+
+	// flag and escape bytes in the payload get escaped on the wire
+	for (size_t i = 0; i < 16; i++) {
+		packet[sizeof(QcdmLogResponse) + sizeof(QcdmLogHeader) + i] = i % 4 ? (uint8_t)(seed + i) : (i % 8 ? HDLC_CONTROL_CHAR : HDLC_ESC_CHAR);
+	}
+
+	return packet;
+}
+
+static vector<uint8_t> make_event(uint16_t id, uint64_t timestamp)
+{
+	vector<uint8_t> packet(sizeof(QcdmEventReportResponse), 0x00);
+	uint16_t word = id | (2 << 13);	// 2 byte payload
+
+	packet[0] = DIAG_EVENT_REPORT_F;
+
+	packet.insert(packet.end(), (uint8_t*)&word, (uint8_t*)&word + sizeof(word));
+	packet.insert(packet.end(), (uint8_t*)&timestamp, (uint8_t*)&timestamp + sizeof(timestamp));
+	packet.push_back(0xAB);
+	packet.push_back(0xCD);
+
+	((QcdmEventReportResponse*)&packet[0])->length = packet.size() - sizeof(QcdmEventReportResponse);
+
+	return packet;
+}
+
+static vector<uint8_t> make_message(uint16_t subsystem, uint64_t timestamp, uint32_t value)
+{
+	static const char text[] = "value %d\0test.c";
+	vector<uint8_t> packet(sizeof(QcdmExtMsgResponse) + sizeof(value), 0x00);
+	QcdmExtMsgResponse* message = (QcdmExtMsgResponse*)&packet[0];
+
+	message->command	= DIAG_EXT_MSG_F;
+	message->argCount	= 1;
+	message->timestamp	= timestamp;
+	message->line		= 42;
+	message->subsystem	= subsystem;
+
+	memcpy(&packet[sizeof(QcdmExtMsgResponse)], &value, sizeof(value));
+
+	packet.insert(packet.end(), text, text + sizeof(text));
+
+	return packet;
+}
+
+static uint64_t test_timestamp(size_t i)
+{
+	return (uint64_t)(1000 + i) << 16;
+}
+
+/**
+* Streams every packet of the test capture, in blocks sent in reverse
+* timestamp order so the decoder has to sort them
+*/
+static void stream_packets(ScriptedDevice& device)
+{
+	vector<vector<uint8_t>> block;
+
+	for (size_t i = 0; i < TEST_LOGS; i++) {
+		block.push_back(make_log(i % 2 ? 0xB0C0 : 0x1098, test_timestamp(i), (uint8_t)i));
+
+		if (i % 20 == 10) {
+			block.push_back(make_event(i % 0xFFF, test_timestamp(i) + 1));
+			block.push_back(make_message(i % 100, test_timestamp(i) + 2, (uint32_t)i));
+		}
+
+		if (block.size() >= 8) {
+			for (auto it = block.rbegin(); it != block.rend(); it++) {
+				device.stream(*it);
+			}
+
+			block.clear();
+		}
+	}
+
+	for (auto it = block.rbegin(); it != block.rend(); it++) {
+		device.stream(*it);
+	}
+}
+
+bool test_log_mask_requests()
+{
+	vector<vector<uint8_t>> requests = QcdmSerial::getLogMaskRequests({ 0x1098, 0xB0C0, 0xB0C7 });
+
+	if (requests.size() != 2) {
+		printf("Test Failed. Expected a request for 2 equipment ids, got %lu\n", requests.size());
+		return false;
+	}
+
+	QcdmLogConfigRequest* first = (QcdmLogConfigRequest*)&requests[0][0];
+	QcdmLogConfigRequest* second = (QcdmLogConfigRequest*)&requests[1][0];
+
+	if (first->command != DIAG_LOG_CONFIG_F || first->operation != kQcdmLogConfigSetMask || first->equipmentId != 0x01 || first->items != 0x0A0) {
+		printf("Test Failed. Equipment id %d request for %d items\n", first->equipmentId, first->items);
+		return false;
+	}
+
+	if (first->mask[0x098 / 8] != 1 << (0x098 % 8) || requests[0].size() != sizeof(QcdmLogConfigRequest) + first->items / 8) {
+		printf("Test Failed. Bad mask for 0x1098\n");
+		return false;
+	}
+
+	if (second->equipmentId != 0x0B || second->mask[0x0C0 / 8] != 0x81) {
+		printf("Test Failed. Bad mask for 0xB0C0 and 0xB0C7\n");
+		return false;
+	}
+
+	printf("Log Mask Requests: PASS\n");
+	return true;
+}
+
+bool test_capture_round_trip()
+{
+	ScriptedDevice device(TEST_PORT, capture_device);
+	QcdmSerial port(TEST_PORT, 115200, serial::Timeout::simpleTimeout(50));
+	DmClient client(port);
+	DmCapture capture(client);
+	DmCaptureDecoder decoder;
+	DmCaptureFilter filter = { kDmCaptureRecordAll };
+	vector<DmCaptureRecord> records;
+	uint64_t expected = TEST_LOGS + (TEST_LOGS / 20) * 2;
+	size_t logs = 0, events = 0, messages = 0;
+
+	port.open();
+	client.start();
+
+	if (!capture.start(TEST_CAPTURE_FILE)) {
+		printf("Test Failed. Could not start the capture\n");
+		return false;
+	}
+
+	thread streamer(stream_packets, std::ref(device));
+
+	// a request sent while capturing gets its answer, and the answer is not captured
+	uint8_t request = DIAG_VERNO_F;
+	DmClientResponse response = client.call(&request, sizeof(request));
+
+	streamer.join();
+
+	for (int waited = 0; capture.getStats().frames < expected && waited < TEST_TIMEOUT; waited++) {
+		this_thread::sleep_for(chrono::milliseconds(1));
+	}
+
+	capture.stop();
+	client.stop();
+
+	DmCaptureStats stats = capture.getStats();
+
+	if (response.status != kDmClientOk || response.data.size() != 1 || response.data[0] != DIAG_VERNO_F) {
+		printf("Test Failed. Request sent while capturing got status %d\n", response.status);
+		return false;
+	}
+
+	if (stats.frames != expected || stats.framesDropped) {
+		printf("Test Failed. Captured %llu frames, %llu dropped, expected %llu\n", (unsigned long long)stats.frames, (unsigned long long)stats.framesDropped, (unsigned long long)expected);
+		return false;
+	}
+
+	if (!decoder.open(TEST_CAPTURE_FILE) || !decoder.decode(filter, records)) {
+		printf("Test Failed. Could not decode the capture\n");
+		return false;
+	}
+
+	DmCaptureDecodeStats decodeStats = decoder.getStats();
+
+	if (decoder.getFrameCount() != expected || decodeStats.crcErrors || decodeStats.malformed || records.size() != expected) {
+		printf("Test Failed. %lu frames, %lu records, %llu CRC errors, %llu malformed\n", decoder.getFrameCount(), records.size(),
+			(unsigned long long)decodeStats.crcErrors, (unsigned long long)decodeStats.malformed);
+		return false;
+	}
+
+	for (size_t i = 0; i < records.size(); i++) {
+		DmCaptureRecord& record = records[i];
+
+		if (i && record.timestamp < records[i - 1].timestamp) {
+			printf("Test Failed. Record %lu is out of order\n", i);
+			return false;
+		}
+
+		switch (record.type) {
+			case kDmCaptureRecordLog: {
+				vector<uint8_t> packet = make_log(logs % 2 ? 0xB0C0 : 0x1098, test_timestamp(logs), (uint8_t)logs);
+
+				if (record.code != (logs % 2 ? 0xB0C0 : 0x1098) || record.timestamp != test_timestamp(logs) || record.size != 16 ||
+					memcmp(record.data, &packet[sizeof(QcdmLogResponse) + sizeof(QcdmLogHeader)], record.size) != 0) {
+					printf("Test Failed. Log %lu does not match what was streamed\n", logs);
+					return false;
+				}
+
+				logs++;
+				break;
+			}
+			case kDmCaptureRecordEvent:
+				if (record.size != 2 || record.data[0] != 0xAB || record.data[1] != 0xCD) {
+					printf("Test Failed. Event %d does not match what was streamed\n", record.code);
+					return false;
+				}
+
+				events++;
+				break;
+			case kDmCaptureRecordMessage:
+				if (DmCaptureDecoder::formatMessage(record).find("test.c:42 value ") != 0) {
+					printf("Test Failed. Message formatted as %s\n", DmCaptureDecoder::formatMessage(record).c_str());
+					return false;
+				}
+
+				messages++;
+				break;
+			default:
+				printf("Test Failed. Captured a packet with command 0x%02X\n", record.code);
+				return false;
+		}
+	}
+
+	if (logs != TEST_LOGS || events != TEST_LOGS / 20 || messages != TEST_LOGS / 20) {
+		printf("Test Failed. Decoded %lu logs, %lu events and %lu messages\n", logs, events, messages);
+		return false;
+	}
+
+	printf("Capture Round Trip: PASS\n");
+	return true;
+}
+
+bool test_decode_filter()
+{
+	DmCaptureDecoder decoder;
+	DmCaptureFilter filter = { kDmCaptureRecordLog };
+	vector<DmCaptureRecord> records;
+
+	filter.logCodes.push_back(0xB0C0);
+
+	// the capture of test_capture_round_trip
+	if (!decoder.open(TEST_CAPTURE_FILE) || !decoder.decode(filter, records)) {
+		printf("Test Failed. Could not decode the capture\n");
+		return false;
+	}
+
+	if (records.size() != TEST_LOGS / 2) {
+		printf("Test Failed. Expected %d records, got %lu\n", TEST_LOGS / 2, records.size());
+		return false;
+	}
+
+	for (auto &record : records) {
+		if (record.type != kDmCaptureRecordLog || record.code != 0xB0C0) {
+			printf("Test Failed. Filter let through type %d code 0x%04X\n", record.type, record.code);
+			return false;
+		}
+	}
+
+	decoder.close();
+	remove(TEST_CAPTURE_FILE);
+
+	printf("Decode Filter: PASS\n");
+	return true;
+}
+
+bool test_decode_raw_stream()
+{
+	DmCaptureDecoder decoder;
+	DmCaptureFilter filter = { kDmCaptureRecordAll };
+	vector<DmCaptureRecord> records;
+	vector<uint8_t> stream;
+	FILE* fp;
+
+	// what a port would give, with one frame damaged on the way
+	for (size_t i = 0; i < TEST_LOGS; i++) {
+		vector<uint8_t> frame = make_log(0x1098, test_timestamp(i), (uint8_t)i);
+
+		hdlc_request(frame);
+
+		if (i == TEST_LOGS / 2) {
+			frame[frame.size() / 2] ^= 0x01;
+		}
+
+		stream.insert(stream.end(), frame.begin(), frame.end());
+	}
+
+	if ((fp = fopen(TEST_STREAM_FILE, "wb")) == nullptr) {
+		printf("Test Failed. Could not write %s\n", TEST_STREAM_FILE);
+		return false;
+	}
+
+	fwrite(&stream[0], 1, stream.size(), fp);
+	fclose(fp);
+
+	if (!decoder.open(TEST_STREAM_FILE) || !decoder.decode(filter, records)) {
+		printf("Test Failed. Could not decode the stream\n");
+		return false;
+	}
+
+	DmCaptureDecodeStats stats = decoder.getStats();
+
+	if (decoder.getFrameCount() != TEST_LOGS || stats.crcErrors != 1 || records.size() != TEST_LOGS - 1) {
+		printf("Test Failed. %lu frames, %lu records, %llu CRC errors\n", decoder.getFrameCount(), records.size(), (unsigned long long)stats.crcErrors);
+		return false;
+	}
+
+	decoder.close();
+	remove(TEST_STREAM_FILE);
+
+	printf("Decode Raw Stream: PASS\n");
+	return true;
+}
+
+int main() {
+	int failed = 0;
+
+	printf("\n\n------------\nStarting DIAG Capture Tests\n------------\n\n");
+	failed += !test_log_mask_requests();
+	failed += !test_capture_round_trip();
+	failed += !test_decode_filter();
+	failed += !test_decode_raw_stream();
+
+	cout << "\n\nPress Enter To Exit" << endl;
+	int pause = getchar();
+	return failed;
+}
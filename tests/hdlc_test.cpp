@@ -1,5 +1,6 @@
 #include "include/definitions.h"
 #include "qc/hdlc.h"
+#include "qc/hdlc_frame_template.h"
 #include "util/hexdump.h"
 
 
@@ -13,6 +14,10 @@ void test_vector_basic();
 void test_vector_escape();
 void test_vector_unescape();
 void test_real_sample();
+void test_crc16();
+void test_crc_escape();
+void test_frame_template();
+void test_append_decode();
 
 
 static const uint8_t test_hdlc_basic[] = { 0x01, 0x02, 0x03, 0x04 };
@@ -20,6 +25,13 @@ static const uint8_t test_hdlc_basic_encapsulated[] = { HDLC_CONTROL_CHAR, 0x01,
 static const uint8_t test_hdlc_escape[] = { 0x01, 0x02, 0x03, HDLC_CONTROL_CHAR, 0x04, HDLC_ESC_CHAR, 0x05, 0x06, HDLC_CONTROL_CHAR, 0x07 };
 static const uint8_t test_hdlc_escape_encapsulated[] = { HDLC_CONTROL_CHAR, 0x01, 0x02, 0x03, HDLC_ESC_CHAR, 0x5e, 0x04, HDLC_ESC_CHAR, 0x5d, 0x05, 0x06, HDLC_ESC_CHAR, 0x5e, 0x07, 0xd6, 0x16, HDLC_CONTROL_CHAR };
 
+// the CRC of this payload is 0x7D7E, both of its bytes need escaping
+static const uint8_t test_hdlc_crc_escape[] = { 0x4B, 0x13, 0x10, HDLC_ESC_CHAR };
+static const uint8_t test_hdlc_crc_escape_encapsulated[] = { HDLC_CONTROL_CHAR, 0x4B, 0x13, 0x10, HDLC_ESC_CHAR, 0x5d, HDLC_ESC_CHAR, 0x5e, HDLC_ESC_CHAR, 0x5d, HDLC_CONTROL_CHAR };
+
+static const char test_crc16_check[] = "123456789";
+static const uint16_t test_crc16_check_value = 0x906E;
+
 static const uint8_t test_real_escaped_sample_data[] = {
 	0x7e, 0x04, 0x00, 0xc8, 0x00, 0x00, 0xff, 0xe1, 0x04, 0x48, 0x49, 0x42, 0x9f, 0x00, 0x00, 0x40,
 	0x96, 0x7c, 0xfe, 0x79, 0xc8, 0x5a, 0x02, 0xc0, 0x00, 0x7c, 0x1c, 0xc0, 0x00, 0x58, 0x6b, 0xc0,
@@ -332,6 +344,173 @@ void test_unescape()
 	printf("Unescaping: PASS\n");
 }
 
+void test_crc16()
+{
+	printf("Starting CRC16 Test\n");
+
+	uint16_t crc = crc16(test_crc16_check, sizeof(test_crc16_check) - 1);
+
+	if (crc != test_crc16_check_value) {
+		printf("Test Failed. CRC of %s is %04X, expected %04X\n", test_crc16_check, crc, test_crc16_check_value);
+		return;
+	}
+
+	// every length around the 8 byte step against the plain table lookup
+	uint8_t data[64];
+
+	for (int i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)(i * 151 + 7);
+	}
+
+	for (size_t size = 0; size <= sizeof(data); size++) {
+		uint16_t expected = 0xffff;
+
+		for (size_t i = 0; i < size; i++) {
+			expected = crc_table[(expected ^ data[i]) & 0xff] ^ (expected >> 8);
+		}
+
+		expected = ~expected;
+
+		crc = crc16((const char*)data, size);
+
+		if (crc != expected) {
+			printf("Test Failed. CRC of %lu bytes is %04X, expected %04X\n", size, crc, expected);
+			return;
+		}
+	}
+
+	printf("CRC16: PASS\n");
+}
+
+void test_append_decode()
+{
+	printf("Starting Append And Decode Test\n");
+
+	vector<uint8_t> frames;
+
+	// two frames back to back, as pipelined requests are written
+	hdlc_append(frames, test_hdlc_escape, sizeof(test_hdlc_escape));
+	hdlc_append(frames, test_hdlc_crc_escape, sizeof(test_hdlc_crc_escape));
+
+	hexdump(&frames[0], frames.size());
+
+	if (frames.size() != sizeof(test_hdlc_escape_encapsulated) + sizeof(test_hdlc_crc_escape_encapsulated) ||
+		memcmp(&frames[0], test_hdlc_escape_encapsulated, sizeof(test_hdlc_escape_encapsulated)) != 0 ||
+		memcmp(&frames[sizeof(test_hdlc_escape_encapsulated)], test_hdlc_crc_escape_encapsulated, sizeof(test_hdlc_crc_escape_encapsulated)) != 0
+	) {
+		printf("Test Failed. Appended frames do not match hdlc_request\n");
+		return;
+	}
+
+	vector<uint8_t> packet;
+
+	// without the flags
+	if (!hdlc_decode(&test_hdlc_crc_escape_encapsulated[1], sizeof(test_hdlc_crc_escape_encapsulated) - 2, packet) ||
+		packet.size() != sizeof(test_hdlc_crc_escape) || memcmp(&packet[0], test_hdlc_crc_escape, packet.size()) != 0
+	) {
+		printf("Test Failed. Decoded frame does not match the payload\n");
+		return;
+	}
+
+	vector<uint8_t> corrupt(test_hdlc_basic_encapsulated + 1, test_hdlc_basic_encapsulated + sizeof(test_hdlc_basic_encapsulated) - 1);
+
+	corrupt[0] ^= 0x01;
+
+	if (hdlc_decode(&corrupt[0], corrupt.size(), packet) || hdlc_decode(&corrupt[0], 2, packet)) {
+		printf("Test Failed. A corrupt or short frame was decoded\n");
+		return;
+	}
+
+	printf("Append And Decode: PASS\n");
+}
+
+void test_crc_escape()
+{
+	printf("Starting CRC Escaping Test\n");
+
+	vector<uint8_t> data(test_hdlc_crc_escape, test_hdlc_crc_escape + sizeof(test_hdlc_crc_escape));
+
+	hdlc_request(data);
+
+	hexdump(&data[0], data.size());
+
+	if (data.size() != sizeof(test_hdlc_crc_escape_encapsulated) ||
+		memcmp(&data[0], test_hdlc_crc_escape_encapsulated, data.size()) != 0
+	) {
+		printf("Test Failed. CRC was not escaped as expected\n");
+		return;
+	}
+
+	hdlc_response(data);
+
+	if (data.size() != sizeof(test_hdlc_crc_escape) || memcmp(&data[0], test_hdlc_crc_escape, data.size()) != 0) {
+		printf("Test Failed. Unescaped data does not match the payload\n");
+		return;
+	}
+
+	printf("CRC Escaping: PASS\n");
+}
+
+void test_frame_template()
+{
+	printf("Starting Frame Template Test\n");
+
+	// patches that add and remove escapes in the data and in the CRC
+	static const struct { size_t offset; uint8_t value[2]; } patches[] = {
+		{ 2, { 0x10, HDLC_ESC_CHAR } },
+		{ 0, { HDLC_CONTROL_CHAR, HDLC_ESC_CHAR } },
+		{ 6, { 0x01, 0x02 } },
+		{ 2, { 0x28, 0x00 } },
+		{ 0, { 0x4B, 0x13 } },
+		{ 5, { HDLC_ESC_CHAR, HDLC_CONTROL_CHAR } },
+		{ 2, { 0x3e, 0x01 } },
+	};
+
+	uint8_t payload[8] = { 0x4B, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+	OpenPST::HdlcFrameTemplate frame(payload, sizeof(payload));
+
+	for (int i = 0; i < sizeof(patches) / sizeof(patches[0]); i++) {
+		frame.set(patches[i].offset, patches[i].value, sizeof(patches[i].value));
+		memcpy(&payload[patches[i].offset], patches[i].value, sizeof(patches[i].value));
+
+		vector<uint8_t> expected(payload, payload + sizeof(payload));
+
+		hdlc_request(expected);
+
+		if (frame.getFrameSize() != expected.size() || memcmp(frame.getFrame(), &expected[0], expected.size()) != 0) {
+			printf("Test Failed. Frame after patch %d does not match hdlc_request\n", i);
+			hexdump(frame.getFrame(), frame.getFrameSize());
+			hexdump(&expected[0], expected.size());
+			return;
+		}
+	}
+
+	OpenPST::HdlcFrameTemplate escaped(sizeof(test_hdlc_crc_escape));
+
+	escaped.set(0, test_hdlc_crc_escape, sizeof(test_hdlc_crc_escape));
+
+	if (escaped.getFrameSize() != sizeof(test_hdlc_crc_escape_encapsulated) ||
+		memcmp(escaped.getFrame(), test_hdlc_crc_escape_encapsulated, escaped.getFrameSize()) != 0
+	) {
+		printf("Test Failed. Frame template did not escape the CRC\n");
+		return;
+	}
+
+	bool thrown = false;
+
+	try {
+		frame.set(sizeof(payload) - 1, patches[0].value, sizeof(patches[0].value));
+	} catch (std::out_of_range& e) {
+		thrown = true;
+	}
+
+	if (!thrown) {
+		printf("Test Failed. Patch past the end was accepted\n");
+		return;
+	}
+
+	printf("Frame Template: PASS\n");
+}
 
 int main() {
 
@@ -347,6 +526,12 @@ int main() {
 	test_vector_escape();
 	test_vector_unescape();
 
+	printf("\n\n------------\nStarting CRC Tests\n------------\n\n");
+	test_crc16();
+	test_crc_escape();
+	test_frame_template();
+	test_append_decode();
+
 	
 	cout << "\n\nPress Enter To Exit" << endl;
 	int pause = getchar();
@@ -0,0 +1,292 @@
+#include "include/definitions.h"
+#include "qc/dm.h"
+#include "qc/dm_memory_reader.h"
+#include "serial/qcdm_serial.h"
+#include "scripted_serial.h"
+
+
+using namespace std;
+using namespace OpenPST;
+
+int main();
+bool test_window();
+bool test_reordered();
+bool test_narrower_retries();
+bool test_failures();
+bool test_short_port_writes();
+bool test_unanswered();
+
+
+#define TEST_PORT "scripted-memory"
+#define TEST_WINDOW 8
+
+#define TEST_WORD_ONLY_START	0x4000	// registers that only answer word peeks
+#define TEST_WORD_ONLY_END		0x4040
+#define TEST_SINGLE_ONLY_START	0x6000	// only answers one unit per peek
+#define TEST_SINGLE_ONLY_END	0x6040
+#define TEST_UNREADABLE_START	0x8003	// answers nothing, at any width
+#define TEST_UNREADABLE_END		0x8011
+
+static bool deviceSilent = false;	// drops every request
+
+static uint8_t memory_at(uint32_t address)
+{
+	if (address >= TEST_UNREADABLE_START && address < TEST_UNREADABLE_END) {
+		return 0x00;
+	}
+
+	return (uint8_t)(address * 7 + (address >> 8));
+}
+
+static bool overlaps(uint32_t address, uint32_t size, uint32_t start, uint32_t end)
+{
+	return address < end && address + size > start;
+}
+
+static bool memory_device(const vector<uint8_t>& request, vector<uint8_t>& response)
+{
+	const QcdmMemoryPeekRequest* peek = (const QcdmMemoryPeekRequest*)&request[0];
+	uint32_t width = 0;
+
+	if (deviceSilent) {
+		return false;
+	}
+
+	switch (request[0]) {
+		case DIAG_MEMORY_PEEK_BYTE_F:	width = 1; break;
+		case DIAG_MEMORY_PEEK_WORD_F:	width = 2; break;
+		case DIAG_MEMORY_PEEK_DWORD_F:	width = 4; break;
+	}
+
+	uint32_t size = width * peek->length;
+
+	if (!width || request.size() < sizeof(QcdmMemoryPeekRequest) || size > DIAG_MEMORY_PEEK_MAX_SIZE ||
+		(overlaps(peek->address, size, TEST_WORD_ONLY_START, TEST_WORD_ONLY_END) && width != 2) ||
+		(overlaps(peek->address, size, TEST_SINGLE_ONLY_START, TEST_SINGLE_ONLY_END) && peek->length != 1) ||
+		overlaps(peek->address, size, TEST_UNREADABLE_START, TEST_UNREADABLE_END)) {
+		response.push_back(DIAG_BAD_PARM_F);
+		response.insert(response.end(), request.begin(), request.end());
+		return true;
+	}
+
+	response.assign(request.begin(), request.begin() + sizeof(QcdmMemoryPeekRequest));
+
+	for (uint32_t i = 0; i < size; i++) {
+		response.push_back(memory_at(peek->address + i));
+	}
+
+	return true;
+}
+
+static void reset_device(ScriptedDevice& device)
+{
+	device.reset();
+	device.maxWrite = 0;
+	device.reverse = false;
+
+	deviceSilent = false;
+}
+
+static bool check_memory(uint32_t address, const vector<uint8_t>& out)
+{
+	for (size_t i = 0; i < out.size(); i++) {
+		if (out[i] != memory_at(address + (uint32_t)i)) {
+			printf("Test Failed. Byte at 0x%08X is 0x%02X, expected 0x%02X\n", address + (uint32_t)i, out[i], memory_at(address + (uint32_t)i));
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool test_window()
+{
+	ScriptedDevice device(TEST_PORT, memory_device);
+	QcdmSerial port(TEST_PORT, 115200, serial::Timeout::simpleTimeout(50));
+	DmMemoryReader reader(port, TEST_WINDOW);
+	vector<uint8_t> out(4098);
+	uint32_t address = 0x10001;	// odd start and end, so every peek width is used
+
+	reset_device(device);
+	port.open();
+
+	if (!reader.read(address, out.size(), &out[0]) || !check_memory(address, out)) {
+		printf("Test Failed. Read did not match memory\n");
+		return false;
+	}
+
+	if (device.maxInFlight != TEST_WINDOW) {
+		printf("Test Failed. Expected %d peeks in flight, device saw %lu\n", TEST_WINDOW, device.maxInFlight);
+		return false;
+	}
+
+	// byte, word, then dwords up to the end, then word and byte
+	uint8_t expected[] = { DIAG_MEMORY_PEEK_BYTE_F, DIAG_MEMORY_PEEK_WORD_F, DIAG_MEMORY_PEEK_DWORD_F };
+
+	for (size_t i = 0; i < sizeof(expected); i++) {
+		if (device.requests[i][0] != expected[i]) {
+			printf("Test Failed. Peek %lu is 0x%02X, expected 0x%02X\n", i, device.requests[i][0], expected[i]);
+			return false;
+		}
+	}
+
+	if (device.requests.back()[0] != DIAG_MEMORY_PEEK_BYTE_F || reader.getPeekCount() != device.requests.size() || reader.getRetryCount() || reader.getFailures().size()) {
+		printf("Test Failed. %lu peeks, %lu retries, %lu failures\n", (size_t)reader.getPeekCount(), (size_t)reader.getRetryCount(), reader.getFailures().size());
+		return false;
+	}
+
+	printf("Window Matching: PASS\n");
+	return true;
+}
+
+bool test_reordered()
+{
+	ScriptedDevice device(TEST_PORT, memory_device);
+	QcdmSerial port(TEST_PORT, 115200, serial::Timeout::simpleTimeout(50));
+	DmMemoryReader reader(port, TEST_WINDOW);
+	vector<uint8_t> out(2048);
+
+	reset_device(device);
+	port.open();
+
+	// each window comes back last peek first, answers are matched by the address they echo
+	device.reverse = true;
+
+	if (!reader.read(0x20000, out.size(), &out[0]) || !check_memory(0x20000, out)) {
+		return false;
+	}
+
+	printf("Out Of Order Responses: PASS\n");
+	return true;
+}
+
+bool test_narrower_retries()
+{
+	ScriptedDevice device(TEST_PORT, memory_device);
+	QcdmSerial port(TEST_PORT, 115200, serial::Timeout::simpleTimeout(50));
+	DmMemoryReader reader(port, TEST_WINDOW);
+	vector<uint8_t> words(TEST_WORD_ONLY_END - TEST_WORD_ONLY_START + 32);
+	vector<uint8_t> singles(TEST_SINGLE_ONLY_END - TEST_SINGLE_ONLY_START);
+
+	reset_device(device);
+	port.open();
+
+	// dword peeks into the word only range are split and halved until they are answered
+	if (!reader.read(TEST_WORD_ONLY_START - 16, words.size(), &words[0]) || !check_memory(TEST_WORD_ONLY_START - 16, words)) {
+		return false;
+	}
+
+	if (!reader.read(TEST_SINGLE_ONLY_START, singles.size(), &singles[0]) || !check_memory(TEST_SINGLE_ONLY_START, singles)) {
+		return false;
+	}
+
+	if (!reader.getRetryCount() || reader.getFailures().size()) {
+		printf("Test Failed. %lu retries, %lu failures\n", (size_t)reader.getRetryCount(), reader.getFailures().size());
+		return false;
+	}
+
+	for (auto &request : device.requests) {
+		const QcdmMemoryPeekRequest* peek = (const QcdmMemoryPeekRequest*)&request[0];
+
+		// the retries of the word only range never go down to bytes
+		if (peek->address >= TEST_WORD_ONLY_START && peek->address < TEST_WORD_ONLY_END && request[0] == DIAG_MEMORY_PEEK_BYTE_F) {
+			printf("Test Failed. Byte peek at 0x%08X\n", peek->address);
+			return false;
+		}
+	}
+
+	printf("Narrower Peek Retries: PASS\n");
+	return true;
+}
+
+bool test_failures()
+{
+	ScriptedDevice device(TEST_PORT, memory_device);
+	QcdmSerial port(TEST_PORT, 115200, serial::Timeout::simpleTimeout(50));
+	DmMemoryReader reader(port, TEST_WINDOW);
+	vector<uint8_t> out(0x40);
+	uint32_t address = 0x8000;
+
+	reset_device(device);
+	port.open();
+
+	memset(&out[0], 0xEE, out.size());
+
+	// the unreadable bytes come back zero, as memory_at has them
+	if (!reader.read(address, out.size(), &out[0]) || !check_memory(address, out)) {
+		return false;
+	}
+
+	const vector<DmMemoryReadFailure>& failures = reader.getFailures();
+
+	if (failures.size() != 1 || failures[0].address != TEST_UNREADABLE_START || failures[0].size != TEST_UNREADABLE_END - TEST_UNREADABLE_START) {
+		printf("Test Failed. %lu failures, first 0x%08X + %u\n", failures.size(), failures.size() ? failures[0].address : 0, failures.size() ? failures[0].size : 0);
+		return false;
+	}
+
+	printf("Unreadable Ranges: PASS\n");
+	return true;
+}
+
+bool test_short_port_writes()
+{
+	ScriptedDevice device(TEST_PORT, memory_device);
+	QcdmSerial port(TEST_PORT, 115200, serial::Timeout::simpleTimeout(50));
+	DmMemoryReader reader(port, TEST_WINDOW);
+	vector<uint8_t> out(4096);
+
+	reset_device(device);
+	port.open();
+
+	// a window of peeks is one write, the port takes less than a frame at a time
+	device.maxWrite = 5;
+
+	if (!reader.read(0x30000, out.size(), &out[0]) || !check_memory(0x30000, out)) {
+		return false;
+	}
+
+	if (!device.shortWrites || device.badFrames) {
+		printf("Test Failed. %lu short writes, %lu bad frames\n", device.shortWrites, device.badFrames);
+		return false;
+	}
+
+	printf("Short Port Writes: PASS\n");
+	return true;
+}
+
+bool test_unanswered()
+{
+	ScriptedDevice device(TEST_PORT, memory_device);
+	QcdmSerial port(TEST_PORT, 115200, serial::Timeout::simpleTimeout(50));
+	DmMemoryReader reader(port, TEST_WINDOW);
+	vector<uint8_t> out(64);
+
+	reset_device(device);
+	port.open();
+
+	deviceSilent = true;
+
+	if (reader.read(0x40000, out.size(), &out[0])) {
+		printf("Test Failed. Read succeeded without answers\n");
+		return false;
+	}
+
+	printf("No Response: PASS\n");
+	return true;
+}
+
+int main() {
+	int failed = 0;
+
+	printf("\n\n------------\nStarting Memory Reader Tests\n------------\n\n");
+	failed += !test_window();
+	failed += !test_reordered();
+	failed += !test_narrower_retries();
+	failed += !test_failures();
+	failed += !test_short_port_writes();
+	failed += !test_unanswered();
+
+	cout << "\n\nPress Enter To Exit" << endl;
+	int pause = getchar();
+	return failed;
+}
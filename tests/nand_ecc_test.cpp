@@ -0,0 +1,376 @@
+#include <iostream>
+#include <algorithm>
+#include "include/definitions.h"
+#include "util/nand_ecc.h"
+#include "util/nand_ecc_pipeline.h"
+
+
+using namespace std;
+using namespace OpenPST;
+
+int main();
+bool test_vectors();
+bool test_hamming_single_bits();
+bool test_hamming_double_bits();
+bool test_bch_corrections();
+bool test_ecc_flips();
+bool test_erased();
+bool test_pipeline();
+
+
+#define TEST_CODEWORD_SIZE 512
+#define TEST_SEED 0x1234
+
+struct EccVector {
+	NandEccType type;
+	const char* name;
+	uint8_t pattern[13];	// ECC of the TEST_SEED data
+	uint8_t single[13];		// ECC of zeros with 0x10 at byte 0x123
+};
+
+// stored ECC as it is laid out in the spare area, any change here is a format change
+static const EccVector eccVectors[] = {
+	{ kNandEccHamming, "Hamming",
+		{ 0x59, 0x56, 0x99 },
+		{ 0x9A, 0x56, 0x96 } },
+	{ kNandEccBch4, "BCH-4",
+		{ 0x89, 0x2F, 0xE7, 0x51, 0x7B, 0xBE, 0x1F },
+		{ 0xAC, 0x83, 0x69, 0x98, 0xFE, 0x70, 0xCF } },
+	{ kNandEccBch8, "BCH-8",
+		{ 0x37, 0x9B, 0x84, 0xD1, 0xBF, 0xF4, 0x89, 0x56, 0x27, 0x12, 0x3D, 0x00, 0xB3 },
+		{ 0xFD, 0xA0, 0x38, 0x11, 0xE8, 0xAB, 0x48, 0x47, 0xA8, 0x22, 0x7B, 0x09, 0x32 } },
+};
+
+static uint32_t next_random(uint32_t& seed)
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 16;
+}
+
+static void fill_random(uint8_t* data, size_t size, uint32_t seed)
+{
+	for (size_t i = 0; i < size; i++) {
+		data[i] = (uint8_t)next_random(seed);
+	}
+}
+
+static void flip_bit(uint8_t* data, size_t bit)
+{
+	data[bit / 8] ^= 0x80 >> (bit % 8);
+}
+
+bool test_vectors()
+{
+	for (auto &vector : eccVectors) {
+		NandEcc ecc(vector.type, TEST_CODEWORD_SIZE);
+		std::vector<uint8_t> data(TEST_CODEWORD_SIZE);
+		std::vector<uint8_t> out(ecc.getEccSize());
+
+		if (!ecc.isValid() || ecc.getEccSize() != (vector.type == kNandEccHamming ? 3 : vector.type == kNandEccBch4 ? 7 : 13)) {
+			printf("Test Failed. %s has %lu ECC bytes\n", vector.name, ecc.getEccSize());
+			return false;
+		}
+
+		fill_random(&data[0], data.size(), TEST_SEED);
+		ecc.encode(&data[0], &out[0]);
+
+		if (memcmp(&out[0], vector.pattern, out.size()) != 0) {
+			printf("Test Failed. %s ECC of the random codeword differs\n", vector.name);
+			return false;
+		}
+
+		memset(&data[0], 0x00, data.size());
+		data[0x123] = 0x10;
+		ecc.encode(&data[0], &out[0]);
+
+		if (memcmp(&out[0], vector.single, out.size()) != 0) {
+			printf("Test Failed. %s ECC of the single bit codeword differs\n", vector.name);
+			return false;
+		}
+	}
+
+	printf("ECC Vectors: PASS\n");
+	return true;
+}
+
+bool test_hamming_single_bits()
+{
+	NandEcc ecc(kNandEccHamming, TEST_CODEWORD_SIZE);
+	vector<uint8_t> data(TEST_CODEWORD_SIZE);
+	vector<uint8_t> stored(ecc.getEccSize());
+
+	fill_random(&data[0], data.size(), TEST_SEED);
+	ecc.encode(&data[0], &stored[0]);
+
+	// every bit of the codeword
+	for (size_t bit = 0; bit < data.size() * 8; bit++) {
+		vector<uint8_t> flipped(data);
+		vector<uint8_t> flippedEcc(stored);
+
+		flip_bit(&flipped[0], bit);
+
+		if (ecc.correct(&flipped[0], &flippedEcc[0]) != 1 || flipped != data || flippedEcc != stored) {
+			printf("Test Failed. Bit %lu was not corrected\n", bit);
+			return false;
+		}
+	}
+
+	printf("Hamming Single Bits: PASS\n");
+	return true;
+}
+
+bool test_hamming_double_bits()
+{
+	NandEcc ecc(kNandEccHamming, TEST_CODEWORD_SIZE);
+	vector<uint8_t> data(TEST_CODEWORD_SIZE);
+	vector<uint8_t> stored(ecc.getEccSize());
+	uint32_t seed = TEST_SEED;
+
+	fill_random(&data[0], data.size(), TEST_SEED);
+	ecc.encode(&data[0], &stored[0]);
+
+	for (int i = 0; i < 1000; i++) {
+		vector<uint8_t> flipped(data);
+		vector<uint8_t> flippedEcc(stored);
+		size_t first = next_random(seed) % (data.size() * 8);
+		size_t second = (first + 1 + next_random(seed) % (data.size() * 8 - 1)) % (data.size() * 8);
+
+		flip_bit(&flipped[0], first);
+		flip_bit(&flipped[0], second);
+
+		if (ecc.correct(&flipped[0], &flippedEcc[0]) != -1) {
+			printf("Test Failed. Bits %lu and %lu were not detected\n", first, second);
+			return false;
+		}
+	}
+
+	printf("Hamming Double Bits: PASS\n");
+	return true;
+}
+
+bool test_bch_corrections()
+{
+	NandEccType types[] = { kNandEccBch4, kNandEccBch8 };
+	uint32_t seed = TEST_SEED;
+
+	for (auto type : types) {
+		NandEcc ecc(type, TEST_CODEWORD_SIZE);
+		int t = type == kNandEccBch4 ? 4 : 8;
+		vector<uint8_t> data(TEST_CODEWORD_SIZE);
+		vector<uint8_t> stored(ecc.getEccSize());
+		size_t bits = data.size() * 8 + 13 * t;	// the padding at the end of the ECC is not part of the code
+
+		fill_random(&data[0], data.size(), TEST_SEED);
+		ecc.encode(&data[0], &stored[0]);
+
+		// 1 to t flips anywhere in the data or the ECC, then one more than it can correct
+		for (int errors = 1; errors <= t + 1; errors++) {
+			for (int i = 0; i < 200; i++) {
+				vector<uint8_t> codeword(data);
+				vector<size_t> positions;
+
+				codeword.insert(codeword.end(), stored.begin(), stored.end());
+
+				while ((int)positions.size() < errors) {
+					size_t bit = next_random(seed) % bits;
+
+					if (find(positions.begin(), positions.end(), bit) == positions.end()) {
+						positions.push_back(bit);
+						flip_bit(&codeword[0], bit);
+					}
+				}
+
+				int result = ecc.correct(&codeword[0], &codeword[data.size()]);
+
+				if (errors <= t && (result != errors || memcmp(&codeword[0], &data[0], data.size()) != 0 ||
+					memcmp(&codeword[data.size()], &stored[0], stored.size()) != 0)) {
+					printf("Test Failed. BCH-%d returned %d for %d errors\n", t, result, errors);
+					return false;
+				}
+
+				// more than t errors must never come back as the original codeword
+				if (errors > t && result >= 0 && memcmp(&codeword[0], &data[0], data.size()) == 0) {
+					printf("Test Failed. BCH-%d claimed to correct %d errors\n", t, errors);
+					return false;
+				}
+			}
+		}
+	}
+
+	printf("BCH Corrections: PASS\n");
+	return true;
+}
+
+bool test_ecc_flips()
+{
+	NandEccType types[] = { kNandEccHamming, kNandEccBch4, kNandEccBch8 };
+
+	for (auto type : types) {
+		NandEcc ecc(type, TEST_CODEWORD_SIZE);
+		vector<uint8_t> data(TEST_CODEWORD_SIZE);
+		vector<uint8_t> stored(ecc.getEccSize());
+
+		fill_random(&data[0], data.size(), TEST_SEED + 1);
+		ecc.encode(&data[0], &stored[0]);
+
+		// the bits that belong to the code, the rest of the last byte is padding
+		size_t eccBits = type == kNandEccHamming ? 24 : type == kNandEccBch4 ? 52 : 104;
+
+		for (size_t bit = 0; bit < eccBits; bit++) {
+			vector<uint8_t> flipped(data);
+			vector<uint8_t> flippedEcc(stored);
+
+			flip_bit(&flippedEcc[0], bit);
+
+			if (ecc.correct(&flipped[0], &flippedEcc[0]) != 1 || flipped != data || flippedEcc != stored) {
+				printf("Test Failed. Type %d ECC bit %lu was not corrected\n", type, bit);
+				return false;
+			}
+		}
+	}
+
+	printf("ECC Bit Flips: PASS\n");
+	return true;
+}
+
+bool test_erased()
+{
+	NandEccType types[] = { kNandEccHamming, kNandEccBch4, kNandEccBch8 };
+
+	for (auto type : types) {
+		NandEcc ecc(type, TEST_CODEWORD_SIZE);
+		vector<uint8_t> data(TEST_CODEWORD_SIZE, 0xFF);
+		vector<uint8_t> stored(ecc.getEccSize());
+		vector<uint8_t> erased(ecc.getEccSize(), 0xFF);
+
+		ecc.encode(&data[0], &stored[0]);
+
+		if (stored != erased || ecc.correct(&data[0], &stored[0]) != 0) {
+			printf("Test Failed. Erased codeword of type %d is not clean\n", type);
+			return false;
+		}
+
+		// a bit flipped in an erased page is corrected like any other
+		flip_bit(&data[0], 1000);
+
+		if (ecc.correct(&data[0], &stored[0]) != 1 || data != vector<uint8_t>(TEST_CODEWORD_SIZE, 0xFF)) {
+			printf("Test Failed. Erased codeword of type %d was not corrected\n", type);
+			return false;
+		}
+	}
+
+	printf("Erased Codewords: PASS\n");
+	return true;
+}
+
+static bool check_page(const NandEccPage& page, uint64_t expectedIndex, const vector<vector<uint8_t>>& pages)
+{
+	int corrected = (int)(page.index % 4);
+	int uncorrectable = page.index % 8 == 7 ? 1 : 0;
+
+	if (page.index != expectedIndex) {
+		printf("Test Failed. Page %lu came back as page %lu\n", (size_t)expectedIndex, (size_t)page.index);
+		return false;
+	}
+
+	if (page.corrected != corrected || page.uncorrectable != uncorrectable || page.data.size() != pages[page.index].size()) {
+		printf("Test Failed. Page %lu: %d corrected, %d uncorrectable\n", (size_t)page.index, page.corrected, page.uncorrectable);
+		return false;
+	}
+
+	// the uncorrectable codeword is passed through as read, the others must match
+	for (size_t i = 0; i < page.data.size(); i += TEST_CODEWORD_SIZE) {
+		if ((i != TEST_CODEWORD_SIZE || !uncorrectable) && memcmp(&page.data[i], &pages[page.index][i], TEST_CODEWORD_SIZE) != 0) {
+			printf("Test Failed. Page %lu codeword %lu was not corrected\n", (size_t)page.index, i / TEST_CODEWORD_SIZE);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool test_pipeline()
+{
+	NandPageLayout layout = { 2048, 64, kNandEccBch4, TEST_CODEWORD_SIZE };
+	NandEccPipeline pipeline(layout, 4, 8);
+	NandEcc ecc(layout.eccType, layout.codewordSize);
+	size_t codewords = layout.pageSize / layout.codewordSize;
+	size_t stride = layout.codewordSize + ecc.getEccSize();
+	vector<vector<uint8_t>> pages;
+	NandEccPage out;
+	uint64_t received = 0;
+
+	if (!pipeline.isValid() || pipeline.getRawPageSize() != 2112) {
+		printf("Test Failed. Pipeline layout is not valid\n");
+		return false;
+	}
+
+	for (uint64_t index = 0; index < 64; index++) {
+		NandEccPage page = {};
+		vector<uint8_t> main(layout.pageSize);
+
+		fill_random(&main[0], main.size(), TEST_SEED + (uint32_t)index);
+		pages.push_back(main);
+
+		page.index = index;
+		page.data.assign(pipeline.getRawPageSize(), 0xFF);
+
+		for (size_t i = 0; i < codewords; i++) {
+			uint8_t* codeword = &page.data[i * stride];
+
+			memcpy(codeword, &main[i * layout.codewordSize], layout.codewordSize);
+			ecc.encode(codeword, codeword + layout.codewordSize);
+		}
+
+		// index % 4 bits flipped in the first codeword, and more than BCH-4 corrects in the second of every eighth page
+		for (uint64_t i = 0; i < index % 4; i++) {
+			flip_bit(&page.data[0], (size_t)(i * 97 + index));
+		}
+
+		if (index % 8 == 7) {
+			for (size_t i = 0; i < 12; i++) {
+				flip_bit(&page.data[stride], i * 131);
+			}
+		}
+
+		pipeline.submit(page);
+
+		// collect while submitting, waiting only once the pending limit is reached
+		while (pipeline.next(out, index + 1 - received >= 8)) {
+			if (!check_page(out, received++, pages)) {
+				return false;
+			}
+		}
+	}
+
+	while (pipeline.next(out, true)) {
+		if (!check_page(out, received++, pages)) {
+			return false;
+		}
+	}
+
+	if (received != pages.size()) {
+		printf("Test Failed. %lu of %lu pages came back\n", (size_t)received, pages.size());
+		return false;
+	}
+
+	printf("Correction Pipeline: PASS\n");
+	return true;
+}
+
+int main() {
+	int failed = 0;
+
+	printf("\n\n------------\nStarting NAND ECC Tests\n------------\n\n");
+	failed += !test_vectors();
+	failed += !test_hamming_single_bits();
+	failed += !test_hamming_double_bits();
+	failed += !test_bch_corrections();
+	failed += !test_ecc_flips();
+	failed += !test_erased();
+	failed += !test_pipeline();
+
+	cout << "\n\nPress Enter To Exit" << endl;
+	int pause = getchar();
+	return failed;
+}
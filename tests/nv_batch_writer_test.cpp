@@ -0,0 +1,352 @@
+#include <map>
+#include <set>
+#include <array>
+#include "include/definitions.h"
+#include "qc/dm.h"
+#include "qc/dm_nv_batch_writer.h"
+#include "serial/qcdm_serial.h"
+#include "scripted_serial.h"
+
+
+using namespace std;
+using namespace OpenPST;
+
+int main();
+bool test_window();
+bool test_reordered();
+bool test_short_items();
+bool test_short_port_writes();
+bool test_failures();
+bool test_rollback();
+
+
+#define TEST_PORT "scripted-nv"
+#define TEST_WINDOW 8
+
+typedef array<uint8_t, DIAG_NV_ITEM_SIZE> NvItemData;
+
+// what the scripted device keeps in NV
+static map<uint16_t, NvItemData> nvStore;
+static map<uint16_t, size_t> nvLength;	// items shorter on the device than DIAG_NV_ITEM_SIZE
+static set<uint16_t> nvReadOnly;
+static set<uint16_t> nvIgnoresWrites;	// accepts the write but keeps the old value
+static set<uint16_t> nvRejected;		// answers DIAG_BAD_PARM_F
+
+static bool nv_device(const vector<uint8_t>& request, vector<uint8_t>& response)
+{
+	if (request.size() < sizeof(QcdmNvRequest) || (request[0] != DIAG_NV_READ_F && request[0] != DIAG_NV_WRITE_F)) {
+		response.push_back(DIAG_BAD_CMD_F);
+		response.insert(response.end(), request.begin(), request.end());
+		return true;
+	}
+
+	uint16_t item = request[1] | (request[2] << 8);
+	uint16_t status = kQcdmNvStatusDone;
+
+	if (nvRejected.count(item)) {
+		response.push_back(DIAG_BAD_PARM_F);
+		response.insert(response.end(), request.begin(), request.end());
+		return true;
+	}
+
+	response.assign(request.begin(), request.begin() + sizeof(QcdmNvRequest));
+
+	if (request[0] == DIAG_NV_WRITE_F) {
+		if (nvReadOnly.count(item)) {
+			status = kQcdmNvStatusReadOnly;
+		} else if (!nvIgnoresWrites.count(item)) {
+			NvItemData& data = nvStore[item];
+			size_t length = nvLength.count(item) ? nvLength[item] : DIAG_NV_ITEM_SIZE;
+
+			data.fill(0xFF);
+			memcpy(&data[0], &request[3], length);
+		}
+	} else if (nvStore.count(item)) {
+		memcpy(&response[3], &nvStore[item][0], DIAG_NV_ITEM_SIZE);
+	} else {
+		memset(&response[3], 0x00, DIAG_NV_ITEM_SIZE);
+		status = kQcdmNvStatusInactive;
+	}
+
+	response.push_back(status & 0xFF);
+	response.push_back(status >> 8);
+
+	return true;
+}
+
+static void reset_device(ScriptedDevice& device)
+{
+	device.reset();
+	device.maxWrite = 0;
+	device.reverse = false;
+
+	nvStore.clear();
+	nvLength.clear();
+	nvReadOnly.clear();
+	nvIgnoresWrites.clear();
+	nvRejected.clear();
+}
+
+static vector<DmNvWriteItem> make_items(uint16_t first, size_t count, uint8_t seed, size_t size = DIAG_NV_ITEM_SIZE)
+{
+	vector<DmNvWriteItem> items(count, DmNvWriteItem());
+
+	for (size_t i = 0; i < count; i++) {
+		items[i].item = first + (uint16_t)i;
+		items[i].size = size;
+
+		for (size_t j = 0; j < size; j++) {
+			items[i].data[j] = (uint8_t)(seed + i + j);
+		}
+	}
+
+	return items;
+}
+
+static bool check_results(const vector<DmNvWriteItem>& items, const vector<DmNvWriteResult>& results)
+{
+	if (results.size() != items.size()) {
+		printf("Test Failed. Expected %lu results, got %lu\n", items.size(), results.size());
+		return false;
+	}
+
+	for (size_t i = 0; i < items.size(); i++) {
+		if (results[i].item != items[i].item) {
+			printf("Test Failed. Result %lu is for item %d, expected %d\n", i, results[i].item, items[i].item);
+			return false;
+		}
+
+		if (results[i].status != kDmNvWriteOk) {
+			printf("Test Failed. Item %d: %s\n", results[i].item, DmNvBatchWriter::getStatusString(results[i]).c_str());
+			return false;
+		}
+
+		if (memcmp(&nvStore[items[i].item][0], items[i].data, items[i].size) != 0) {
+			printf("Test Failed. Item %d was not written\n", items[i].item);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool test_window()
+{
+	ScriptedDevice device(TEST_PORT, nv_device);
+	QcdmSerial port(TEST_PORT, 115200, serial::Timeout::simpleTimeout(50));
+	DmNvBatchWriter writer(port, TEST_WINDOW);
+	vector<DmNvWriteItem> items = make_items(1000, 100, 0x10);
+
+	reset_device(device);
+	port.open();
+
+	if (!check_results(items, writer.write(items))) {
+		return false;
+	}
+
+	if (device.requests.size() != items.size() * 2) {
+		printf("Test Failed. Expected %lu requests, device saw %lu\n", items.size() * 2, device.requests.size());
+		return false;
+	}
+
+	for (size_t i = 0; i < device.requests.size(); i++) {
+		uint8_t expected = i % 2 ? DIAG_NV_READ_F : DIAG_NV_WRITE_F;
+		uint16_t item = device.requests[i][1] | (device.requests[i][2] << 8);
+
+		if (device.requests[i][0] != expected || item != items[i / 2].item) {
+			printf("Test Failed. Request %lu is 0x%02X for item %d\n", i, device.requests[i][0], item);
+			return false;
+		}
+	}
+
+	// writes and read backs share the window
+	if (device.maxInFlight != TEST_WINDOW) {
+		printf("Test Failed. Expected %d requests in flight, device saw %lu\n", TEST_WINDOW, device.maxInFlight);
+		return false;
+	}
+
+	printf("Window Matching: PASS\n");
+	return true;
+}
+
+bool test_reordered()
+{
+	ScriptedDevice device(TEST_PORT, nv_device);
+	QcdmSerial port(TEST_PORT, 115200, serial::Timeout::simpleTimeout(50));
+	DmNvBatchWriter writer(port, TEST_WINDOW);
+	vector<DmNvWriteItem> items = make_items(2000, 50, 0x20);
+
+	reset_device(device);
+	port.open();
+
+	// each window comes back last request first, results are still matched and returned in order
+	device.reverse = true;
+
+	if (!check_results(items, writer.write(items))) {
+		return false;
+	}
+
+	printf("Out Of Order Responses: PASS\n");
+	return true;
+}
+
+bool test_short_items()
+{
+	ScriptedDevice device(TEST_PORT, nv_device);
+	QcdmSerial port(TEST_PORT, 115200, serial::Timeout::simpleTimeout(50));
+	DmNvBatchWriter writer(port, TEST_WINDOW);
+	vector<DmNvWriteItem> items = make_items(3000, 20, 0x30, 6);
+
+	reset_device(device);
+	port.open();
+
+	// the device keeps 6 bytes and reads the rest back as 0xFF, only the bytes written are compared
+	for (auto &item : items) {
+		nvLength[item.item] = item.size;
+	}
+
+	if (!check_results(items, writer.write(items))) {
+		return false;
+	}
+
+	printf("Short Items: PASS\n");
+	return true;
+}
+
+bool test_short_port_writes()
+{
+	ScriptedDevice device(TEST_PORT, nv_device);
+	QcdmSerial port(TEST_PORT, 115200, serial::Timeout::simpleTimeout(50));
+	DmNvBatchWriter writer(port, TEST_WINDOW);
+	vector<DmNvWriteItem> items = make_items(4000, 40, 0x40);
+
+	reset_device(device);
+	port.open();
+
+	// less than one frame per write
+	device.maxWrite = 50;
+
+	if (!check_results(items, writer.write(items))) {
+		return false;
+	}
+
+	if (!device.shortWrites || device.badFrames) {
+		printf("Test Failed. %lu short writes, %lu bad frames\n", device.shortWrites, device.badFrames);
+		return false;
+	}
+
+	printf("Short Port Writes: PASS\n");
+	return true;
+}
+
+bool test_failures()
+{
+	ScriptedDevice device(TEST_PORT, nv_device);
+	QcdmSerial port(TEST_PORT, 115200, serial::Timeout::simpleTimeout(50));
+	DmNvBatchWriter writer(port, TEST_WINDOW);
+	vector<DmNvWriteItem> items = make_items(5000, 10, 0x50);
+	vector<DmNvWriteResult> results;
+
+	reset_device(device);
+	port.open();
+
+	nvReadOnly.insert(5002);
+	nvIgnoresWrites.insert(5004);
+	nvRejected.insert(5006);
+
+	nvStore[5004].fill(0xAA);
+
+	results = writer.write(items);
+
+	for (auto &result : results) {
+		DmNvWriteStatus expected = kDmNvWriteOk;
+
+		switch (result.item) {
+			case 5002: expected = kDmNvWriteFailed; break;
+			case 5004: expected = kDmNvWriteMismatch; break;
+			case 5006: expected = kDmNvWriteFailed; break;
+		}
+
+		if (result.status != expected || result.rolledBack) {
+			printf("Test Failed. Item %d: %s\n", result.item, DmNvBatchWriter::getStatusString(result).c_str());
+			return false;
+		}
+	}
+
+	if (results[2].response.status != kDmNvBulkNvError || results[2].response.nvStatus != kQcdmNvStatusReadOnly) {
+		printf("Test Failed. Read only item reported as %s\n", DmNvBulkReader::getStatusString(results[2].response).c_str());
+		return false;
+	}
+
+	if (results[6].response.status != kDmNvBulkRejected || results[6].response.command != DIAG_BAD_PARM_F) {
+		printf("Test Failed. Rejected item reported as %s\n", DmNvBulkReader::getStatusString(results[6].response).c_str());
+		return false;
+	}
+
+	printf("Write Failures: PASS\n");
+	return true;
+}
+
+bool test_rollback()
+{
+	ScriptedDevice device(TEST_PORT, nv_device);
+	QcdmSerial port(TEST_PORT, 115200, serial::Timeout::simpleTimeout(50));
+	DmNvBatchWriter writer(port, TEST_WINDOW);
+	vector<DmNvWriteItem> before = make_items(6000, 12, 0x60);
+	vector<DmNvWriteItem> items = make_items(6000, 12, 0x70);
+	vector<DmNvWriteResult> results;
+
+	reset_device(device);
+	port.open();
+
+	// every item but the last has a value to go back to
+	for (size_t i = 0; i < before.size() - 1; i++) {
+		memcpy(&nvStore[before[i].item][0], before[i].data, DIAG_NV_ITEM_SIZE);
+	}
+
+	nvReadOnly.insert(6005);
+
+	results = writer.write(items, true);
+
+	for (size_t i = 0; i < results.size(); i++) {
+		uint16_t item = results[i].item;
+		bool inactive = i == results.size() - 1;
+		bool restored = !inactive && item != 6005;	// the read only item can not be written back either
+
+		if ((results[i].status == kDmNvWriteOk) == (item == 6005)) {
+			printf("Test Failed. Item %d: %s\n", item, DmNvBatchWriter::getStatusString(results[i]).c_str());
+			return false;
+		}
+
+		if (results[i].rolledBack != restored) {
+			printf("Test Failed. Item %d was %srolled back\n", item, restored ? "not " : "");
+			return false;
+		}
+
+		const uint8_t* expected = inactive ? items[i].data : before[i].data;
+
+		if (memcmp(&nvStore[item][0], expected, DIAG_NV_ITEM_SIZE) != 0) {
+			printf("Test Failed. Item %d does not hold the %s value\n", item, inactive ? "written" : "previous");
+			return false;
+		}
+	}
+
+	printf("Rollback: PASS\n");
+	return true;
+}
+
+int main() {
+	int failed = 0;
+
+	printf("\n\n------------\nStarting NV Batch Writer Tests\n------------\n\n");
+	failed += !test_window();
+	failed += !test_reordered();
+	failed += !test_short_items();
+	failed += !test_short_port_writes();
+	failed += !test_failures();
+	failed += !test_rollback();
+
+	cout << "\n\nPress Enter To Exit" << endl;
+	int pause = getchar();
+	return failed;
+}
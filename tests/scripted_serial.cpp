@@ -0,0 +1,314 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file scripted_serial.cpp
+* @class ScriptedDevice
+* @package OpenPST
+* @brief serial::Serial backed by a scripted device instead of a port
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#include <map>
+#include <thread>
+#include <chrono>
+#include "scripted_serial.h"
+#include "qc/hdlc.h"
+
+using namespace serial;
+
+static std::map<std::string, ScriptedDevice*>& devices()
+{
+	static std::map<std::string, ScriptedDevice*> registered;
+	return registered;
+}
+
+ScriptedDevice::ScriptedDevice(const std::string& name, ScriptedHandler handler) :
+	maxWrite(0),
+	reverse(false),
+	name(name),
+	handler(handler)
+{
+	reset();
+	devices()[name] = this;
+}
+
+ScriptedDevice::~ScriptedDevice()
+{
+	devices().erase(name);
+}
+
+ScriptedDevice* ScriptedDevice::find(const std::string& name)
+{
+	auto it = devices().find(name);
+
+	return it == devices().end() ? nullptr : it->second;
+}
+
+void ScriptedDevice::reset()
+{
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+
+	requests.clear();
+	partial.clear();
+	pending.clear();
+	out.clear();
+
+	maxInFlight = 0;
+	shortWrites = 0;
+	badFrames = 0;
+}
+
+size_t ScriptedDevice::write(const uint8_t* data, size_t size)
+{
+	size_t taken = maxWrite && size > maxWrite ? maxWrite : size;
+	std::vector<uint8_t> packet;
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+
+	if (taken < size) {
+		shortWrites++;
+	}
+
+	for (size_t i = 0; i < taken; i++) {
+		if (data[i] != HDLC_CONTROL_CHAR) {
+			partial.push_back(data[i]);
+			continue;
+		}
+
+		if (!partial.size()) {
+			continue;
+		}
+
+		if (hdlc_decode(&partial[0], partial.size(), packet)) {
+			requests.push_back(packet);
+			pending.push_back(packet);
+		} else {
+			badFrames++;
+		}
+
+		partial.clear();
+	}
+
+	if (pending.size() > maxInFlight) {
+		maxInFlight = pending.size();
+	}
+
+	return taken;
+}
+
+size_t ScriptedDevice::available()
+{
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+
+	answer();
+
+	return out.size();
+}
+
+size_t ScriptedDevice::read(uint8_t* buffer, size_t size)
+{
+	size_t count = 0;
+
+	{
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+
+		answer();
+
+		while (count < size && out.size()) {
+			buffer[count++] = out.front();
+			out.pop_front();
+		}
+	}
+
+	if (!count) {
+		// a real port would wait out its timeout here, keep the callers from spinning
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	return count;
+}
+
+void ScriptedDevice::stream(const std::vector<uint8_t>& packet)
+{
+	std::vector<uint8_t> frame(packet);
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+
+	hdlc_request(frame);
+
+	out.insert(out.end(), frame.begin(), frame.end());
+}
+
+void ScriptedDevice::answer()
+{
+	std::deque<std::vector<uint8_t>> answers;
+
+	while (pending.size()) {
+		std::vector<uint8_t> response;
+
+		if (handler(pending.front(), response) && response.size()) {
+			hdlc_request(response);
+
+			if (reverse) {
+				answers.push_front(response);
+			} else {
+				answers.push_back(response);
+			}
+		}
+
+		pending.pop_front();
+	}
+
+	for (auto &response : answers) {
+		out.insert(out.end(), response.begin(), response.end());
+	}
+}
+
+/**
+* The parts of serial::Serial the serial classes use, on top of a ScriptedDevice
+*/
+class Serial::SerialImpl {
+	public:
+		std::string port;
+		uint32_t baudrate;
+		Timeout timeout;
+		ScriptedDevice* device;
+
+		SerialImpl(const std::string& port, uint32_t baudrate, Timeout timeout) :
+			port(port),
+			baudrate(baudrate),
+			timeout(timeout),
+			device(nullptr)
+		{
+
+		}
+};
+
+Serial::Serial(const std::string &port, uint32_t baudrate, Timeout timeout, bytesize_t bytesize, parity_t parity, stopbits_t stopbits, flowcontrol_t flowcontrol) :
+	pimpl_(new SerialImpl(port, baudrate, timeout))
+{
+
+}
+
+Serial::~Serial()
+{
+	delete pimpl_;
+}
+
+void Serial::open()
+{
+	pimpl_->device = ScriptedDevice::find(pimpl_->port);
+
+	if (pimpl_->device == nullptr) {
+		THROW(IOException, "No scripted device for the port");
+	}
+}
+
+bool Serial::isOpen() const
+{
+	return pimpl_->device != nullptr;
+}
+
+void Serial::close()
+{
+	pimpl_->device = nullptr;
+}
+
+size_t Serial::available()
+{
+	if (pimpl_->device == nullptr) {
+		throw PortNotOpenedException("Serial::available");
+	}
+
+	return pimpl_->device->available();
+}
+
+size_t Serial::read(uint8_t *buffer, size_t size)
+{
+	if (pimpl_->device == nullptr) {
+		throw PortNotOpenedException("Serial::read");
+	}
+
+	return pimpl_->device->read(buffer, size);
+}
+
+size_t Serial::read(std::vector<uint8_t> &buffer, size_t size)
+{
+	std::vector<uint8_t> data(size);
+
+	data.resize(read(data.size() ? &data[0] : nullptr, size));
+
+	buffer.insert(buffer.end(), data.begin(), data.end());
+
+	return data.size();
+}
+
+size_t Serial::write(const uint8_t *data, size_t size)
+{
+	if (pimpl_->device == nullptr) {
+		throw PortNotOpenedException("Serial::write");
+	}
+
+	return pimpl_->device->write(data, size);
+}
+
+size_t Serial::write(const std::vector<uint8_t> &data)
+{
+	return data.size() ? write(&data[0], data.size()) : 0;
+}
+
+void Serial::setPort(const std::string &port)
+{
+	pimpl_->port = port;
+}
+
+std::string Serial::getPort() const
+{
+	return pimpl_->port;
+}
+
+void Serial::setTimeout(Timeout &timeout)
+{
+	pimpl_->timeout = timeout;
+}
+
+Timeout Serial::getTimeout() const
+{
+	return pimpl_->timeout;
+}
+
+void Serial::setBaudrate(uint32_t baudrate)
+{
+	pimpl_->baudrate = baudrate;
+}
+
+uint32_t Serial::getBaudrate() const
+{
+	return pimpl_->baudrate;
+}
+
+void Serial::flush()
+{
+
+}
+
+void Serial::flushInput()
+{
+
+}
+
+void Serial::flushOutput()
+{
+
+}
+
+std::vector<PortInfo> serial::list_ports()
+{
+	std::vector<PortInfo> ports;
+
+	for (auto &it : devices()) {
+		PortInfo info = { it.first, "Scripted device", "" };
+		ports.push_back(info);
+	}
+
+	return ports;
+}
@@ -0,0 +1,122 @@
+/**
+* LICENSE PLACEHOLDER
+*
+* @file scripted_serial.h
+* @class ScriptedDevice
+* @package OpenPST
+* @brief serial::Serial backed by a scripted device instead of a port
+*
+* Tests link scripted_serial.cpp in place of lib/serial, so the serial
+* classes run unchanged against a device the test controls. Frames written
+* to a port opened on the device name are decoded and queued, and the next
+* read of the port answers everything queued through the handler. A read
+* with nothing to answer times out right away. Packets the device sends
+* without being asked are queued with stream(), from any thread.
+*
+* @author Gassan Idriss <ghassani@gmail.com>
+*/
+
+#ifndef _TESTS_SCRIPTED_SERIAL_H
+#define _TESTS_SCRIPTED_SERIAL_H
+
+#include <vector>
+#include <deque>
+#include <string>
+#include <mutex>
+#include <functional>
+#include "include/definitions.h"
+#include "serial/serial.h"
+
+/**
+* Answer a decoded request, return false to leave it unanswered
+*/
+typedef std::function<bool(const std::vector<uint8_t>& request, std::vector<uint8_t>& response)> ScriptedHandler;
+
+class ScriptedDevice {
+	public:
+		size_t maxWrite;		// bytes a single write takes, 0 for no limit
+		bool reverse;			// send the answers to what is queued last first, requests are still handled in order
+
+		std::vector<std::vector<uint8_t>> requests;	// every request decoded, in order
+		size_t maxInFlight;		// most requests queued and not answered at once
+		size_t shortWrites;		// writes that took less than they were given
+		size_t badFrames;		// frames dropped for a bad CRC
+
+		/**
+		* @brief ScriptedDevice - Constructor, ports opened on name talk to this device
+		*
+		* @param std::string name
+		* @param ScriptedHandler handler
+		*/
+		ScriptedDevice(const std::string& name, ScriptedHandler handler);
+
+		/**
+		* @brief ~ScriptedDevice - Deconstructor
+		*/
+		~ScriptedDevice();
+
+		/**
+		* @brief find - Get the device a port name belongs to
+		*
+		* @param std::string name
+		* @return ScriptedDevice* - nullptr if there is none
+		*/
+		static ScriptedDevice* find(const std::string& name);
+
+		/**
+		* @brief reset - Drop everything queued and the counters
+		*
+		* @return void
+		*/
+		void reset();
+
+		/**
+		* @brief write - Take bytes written to the port, up to maxWrite
+		*
+		* @param uint8_t* data
+		* @param size_t size
+		* @return size_t - Bytes taken
+		*/
+		size_t write(const uint8_t* data, size_t size);
+
+		/**
+		* @brief available - Answer what is queued and count the bytes ready
+		*
+		* @return size_t
+		*/
+		size_t available();
+
+		/**
+		* @brief read - Answer what is queued and read from the answers
+		*
+		* @param uint8_t* buffer
+		* @param size_t size
+		* @return size_t - Bytes read, 0 is a timeout
+		*/
+		size_t read(uint8_t* buffer, size_t size);
+
+		/**
+		* @brief stream - Send a packet without a request for it, after what is already answered
+		*
+		* Safe to call from the handler or from another thread than the one reading.
+		*
+		* @param std::vector<uint8_t> packet - Unescaped, without a CRC
+		* @return void
+		*/
+		void stream(const std::vector<uint8_t>& packet);
+
+	private:
+		std::string name;
+		ScriptedHandler handler;
+		std::recursive_mutex mutex;
+		std::vector<uint8_t> partial;
+		std::deque<std::vector<uint8_t>> pending;
+		std::deque<uint8_t> out;
+
+		/**
+		* @brief answer - Run the handler on every queued request
+		*/
+		void answer();
+};
+
+#endif // _TESTS_SCRIPTED_SERIAL_H
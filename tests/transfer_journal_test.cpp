@@ -0,0 +1,304 @@
+#include <iostream>
+#include <fstream>
+#include "include/definitions.h"
+#include "util/transfer_journal.h"
+
+
+using namespace std;
+using namespace OpenPST;
+
+int main();
+bool test_round_trip();
+bool test_mismatched_transfer();
+bool test_other_device();
+bool test_torn_journal();
+bool test_verify();
+bool test_rollback();
+bool test_remove();
+
+
+#define TEST_JOURNAL "transfer_journal_test.journal"
+#define TEST_ADDRESS 0x80200000
+#define TEST_SIZE (16 * 1024 * 1024)
+#define TEST_RANGE_SIZE 4096
+#define TEST_DEVICE "0a1b2c3d-00000000"
+
+static vector<uint8_t> make_range(uint32_t seed)
+{
+	vector<uint8_t> data(TEST_RANGE_SIZE);
+
+	for (size_t i = 0; i < data.size(); i++) {
+		seed = seed * 1103515245 + 12345;
+		data[i] = (uint8_t)(seed >> 16);
+	}
+
+	return data;
+}
+
+// ranges 0-3 back to back, then a gap, as a differential write leaves them
+static bool write_journal(TransferJournal& journal)
+{
+	uint64_t offsets[] = { 0, 1, 2, 3, 8, 9 };
+
+	if (!journal.open(TEST_JOURNAL, TEST_ADDRESS, TEST_SIZE, TEST_DEVICE, false)) {
+		return false;
+	}
+
+	for (auto offset : offsets) {
+		vector<uint8_t> data = make_range((uint32_t)offset);
+
+		if (!journal.checkpoint(offset * TEST_RANGE_SIZE, &data[0], data.size())) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool same_entries(const vector<TransferJournalEntry>& a, const vector<TransferJournalEntry>& b)
+{
+	if (a.size() != b.size()) {
+		printf("Test Failed. %lu entries, expected %lu\n", a.size(), b.size());
+		return false;
+	}
+
+	for (size_t i = 0; i < a.size(); i++) {
+		if (a[i].offset != b[i].offset || a[i].size != b[i].size || a[i].hash != b[i].hash) {
+			printf("Test Failed. Entry %lu is %lu + %lu %016llx\n", i, (size_t)a[i].offset, (size_t)a[i].size, (unsigned long long)a[i].hash);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool test_round_trip()
+{
+	TransferJournal journal;
+	TransferJournal resumed;
+
+	if (!write_journal(journal)) {
+		printf("Test Failed. Could not write %s\n", TEST_JOURNAL);
+		return false;
+	}
+
+	// checkpoints are flushed as they are made, nothing is closed before resuming
+	if (!resumed.open(TEST_JOURNAL, TEST_ADDRESS, TEST_SIZE, TEST_DEVICE, true) || !same_entries(resumed.entries, journal.entries)) {
+		return false;
+	}
+
+	if (resumed.resumeOffset() != 10 * TEST_RANGE_SIZE) {
+		printf("Test Failed. Resuming at %lu\n", (size_t)resumed.resumeOffset());
+		return false;
+	}
+
+	// resuming rewrites the journal, which must read back the same again
+	TransferJournal again;
+
+	if (!again.open(TEST_JOURNAL, TEST_ADDRESS, TEST_SIZE, TEST_DEVICE, true) || !same_entries(again.entries, journal.entries)) {
+		return false;
+	}
+
+	printf("Round Trip: PASS\n");
+	return true;
+}
+
+bool test_mismatched_transfer()
+{
+	TransferJournal journal;
+	TransferJournal other;
+
+	write_journal(journal);
+
+	// another address, another size, or not resuming all start over
+	if (!other.open(TEST_JOURNAL, TEST_ADDRESS + TEST_RANGE_SIZE, TEST_SIZE, TEST_DEVICE, true) || other.entries.size()) {
+		printf("Test Failed. Resumed a journal for another address\n");
+		return false;
+	}
+
+	write_journal(journal);
+
+	if (!other.open(TEST_JOURNAL, TEST_ADDRESS, TEST_SIZE + 1, TEST_DEVICE, true) || other.entries.size()) {
+		printf("Test Failed. Resumed a journal for another size\n");
+		return false;
+	}
+
+	write_journal(journal);
+
+	if (!other.open(TEST_JOURNAL, TEST_ADDRESS, TEST_SIZE, TEST_DEVICE, false) || other.entries.size() || other.resumeOffset()) {
+		printf("Test Failed. Resumed a journal without being asked to\n");
+		return false;
+	}
+
+	printf("Mismatched Transfer: PASS\n");
+	return true;
+}
+
+bool test_other_device()
+{
+	TransferJournal journal;
+	TransferJournal other;
+	TransferJournal resumed;
+
+	write_journal(journal);
+
+	// the ranges of one unit are never applied to another, and the journal is kept for the unit it belongs to
+	if (other.open(TEST_JOURNAL, TEST_ADDRESS, TEST_SIZE, "ffffffff-00000000", true)) {
+		printf("Test Failed. Resumed a journal of another device\n");
+		return false;
+	}
+
+	if (!resumed.open(TEST_JOURNAL, TEST_ADDRESS, TEST_SIZE, TEST_DEVICE, true) || !same_entries(resumed.entries, journal.entries)) {
+		return false;
+	}
+
+	// a journal without a device only matches a transfer without one
+	TransferJournal anonymous;
+
+	if (!anonymous.open(TEST_JOURNAL, TEST_ADDRESS, TEST_SIZE, "", false) || other.open(TEST_JOURNAL, TEST_ADDRESS, TEST_SIZE, TEST_DEVICE, true)) {
+		printf("Test Failed. Resumed a journal without a device\n");
+		return false;
+	}
+
+	printf("Other Device: PASS\n");
+	return true;
+}
+
+bool test_torn_journal()
+{
+	TransferJournal journal;
+	TransferJournal resumed;
+	vector<TransferJournalEntry> expected;
+
+	write_journal(journal);
+	expected = journal.entries;
+
+	// a crash in the middle of a checkpoint leaves a partial line
+	ofstream torn(TEST_JOURNAL, ios::out | ios::app);
+	torn << 10 * TEST_RANGE_SIZE << " " << TEST_RANGE_SIZE;
+	torn.close();
+
+	if (!resumed.open(TEST_JOURNAL, TEST_ADDRESS, TEST_SIZE, TEST_DEVICE, true) || !same_entries(resumed.entries, expected)) {
+		return false;
+	}
+
+	// a range going backwards ends the journal there
+	resumed.checkpoint(journal.entries[1]);
+	resumed.checkpoint(journal.entries[5]);
+
+	TransferJournal backwards;
+
+	if (!backwards.open(TEST_JOURNAL, TEST_ADDRESS, TEST_SIZE, TEST_DEVICE, true) || !same_entries(backwards.entries, expected)) {
+		return false;
+	}
+
+	printf("Torn Journal: PASS\n");
+	return true;
+}
+
+bool test_verify()
+{
+	TransferJournal journal;
+	vector<uint8_t> data = make_range(8);
+
+	write_journal(journal);
+
+	TransferJournalEntry& entry = journal.entries[4];
+
+	if (!journal.verify(entry, &data[0], data.size())) {
+		printf("Test Failed. Range did not verify\n");
+		return false;
+	}
+
+	data[100] ^= 0x01;
+
+	if (journal.verify(entry, &data[0], data.size()) || journal.verify(entry, &data[0], data.size() - 1)) {
+		printf("Test Failed. Changed range verified\n");
+		return false;
+	}
+
+	TransferJournalEntry described = TransferJournal::describe(entry.offset, &data[0], data.size());
+
+	if (described.offset != entry.offset || described.size != entry.size || described.hash == entry.hash) {
+		printf("Test Failed. Describe does not match checkpoint\n");
+		return false;
+	}
+
+	printf("Verify: PASS\n");
+	return true;
+}
+
+bool test_rollback()
+{
+	TransferJournal journal;
+	TransferJournal resumed;
+	vector<TransferJournalEntry> expected;
+
+	write_journal(journal);
+
+	// the last range, then everything ending past the gap
+	if (!journal.rollback() || journal.resumeOffset() != 9 * TEST_RANGE_SIZE) {
+		printf("Test Failed. Rollback left %lu\n", (size_t)journal.resumeOffset());
+		return false;
+	}
+
+	if (!journal.rollback(3 * TEST_RANGE_SIZE + 1) || journal.entries.size() != 3 || journal.resumeOffset() != 3 * TEST_RANGE_SIZE) {
+		printf("Test Failed. Rollback to an offset left %lu\n", (size_t)journal.resumeOffset());
+		return false;
+	}
+
+	expected = journal.entries;
+
+	// checkpoints after a rollback follow on
+	vector<uint8_t> data = make_range(3);
+	journal.checkpoint(3 * TEST_RANGE_SIZE, &data[0], data.size());
+	expected.push_back(journal.entries.back());
+
+	if (!resumed.open(TEST_JOURNAL, TEST_ADDRESS, TEST_SIZE, TEST_DEVICE, true) || !same_entries(resumed.entries, expected)) {
+		return false;
+	}
+
+	printf("Rollback: PASS\n");
+	return true;
+}
+
+bool test_remove()
+{
+	TransferJournal journal;
+	TransferJournal resumed;
+
+	write_journal(journal);
+	journal.remove();
+
+	if (ifstream(TEST_JOURNAL).is_open() || journal.entries.size()) {
+		printf("Test Failed. Journal was not removed\n");
+		return false;
+	}
+
+	if (!resumed.open(TEST_JOURNAL, TEST_ADDRESS, TEST_SIZE, TEST_DEVICE, true) || resumed.entries.size()) {
+		printf("Test Failed. Resumed a removed journal\n");
+		return false;
+	}
+
+	resumed.remove();
+
+	printf("Remove: PASS\n");
+	return true;
+}
+
+int main() {
+	int failed = 0;
+
+	printf("\n\n------------\nStarting Transfer Journal Tests\n------------\n\n");
+	failed += !test_round_trip();
+	failed += !test_mismatched_transfer();
+	failed += !test_other_device();
+	failed += !test_torn_journal();
+	failed += !test_verify();
+	failed += !test_rollback();
+	failed += !test_remove();
+
+	cout << "\n\nPress Enter To Exit" << endl;
+	int pause = getchar();
+	return failed;
+}